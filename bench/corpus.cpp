@@ -0,0 +1,406 @@
+/*
+ * File: corpus.cpp
+ * ----------------
+ * Timing harness for the benchmark corpus in bench/corpus.  Each
+ * workload is a program name.bas, with the values for its INPUT
+ * statements in name.in if it reads any, and its expected output in
+ * the golden file name.out.  The harness runs every workload through
+ * the headless interpreter ("basic run") a number of times, checks
+ * the output against the golden file and reports the wall time, the
+ * lines executed per second and the peak resident set size.
+ *
+ * Usage: corpus --basic path [--engine vm|tree|jit] [--repeats n]
+ *               [--format text|json|csv] [--filter text] [--update]
+ *               [dir]
+ *
+ *   --basic   is the interpreter binary to run
+ *   --engine  selects the engine, vm by default
+ *   --repeats is the number of timed runs of each workload, 5 by default
+ *   --format  selects a table (the default), JSON or CSV
+ *   --filter  runs only the workloads whose name contains text
+ *   --update  writes the output of each workload to its golden file
+ *             instead of checking it
+ *   dir       is the corpus directory, bench/corpus by default
+ *
+ * The number of lines a workload executes does not depend on the
+ * engine, so the harness counts them once by running the program on
+ * the tree-walking engine in its own process.  The exit status is 0
+ * if every workload ran and matched its golden file, 1 otherwise and
+ * 2 for bad arguments.  The harness uses fork and exec, so it runs on
+ * Unix systems only.
+ */
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#include "lexer.h"
+#include "parser.h"
+#include "program.h"
+#include "evalstate.h"
+#include "output.h"
+#include "error.h"
+using namespace std;
+
+/*
+ * Type: Workload
+ * --------------
+ * The files of one workload and the results of running it.  status is
+ * "ok", "mismatch", "failed" (the interpreter exited with an error),
+ * "no golden" or, with --update, "updated".
+ */
+
+struct Workload {
+   string name;
+   string program;
+   string input;
+   string golden;
+   long linesExecuted;
+   vector<double> times;
+   long peakRssKb;
+   string status;
+};
+
+/* Function prototypes */
+
+static vector<string> listPrograms(const string & dir);
+static bool readFile(const string & filename, string & text);
+static bool writeFile(const string & filename, const string & text);
+static long countLines(const string & text, const string & input);
+static bool runOnce(const string & basic, const string & engine,
+                    Workload & work, string & output, int & status);
+static double now();
+static void writeText(const vector<Workload> & workloads);
+static void writeJson(const vector<Workload> & workloads, const string & engine);
+static void writeCsv(const vector<Workload> & workloads, const string & engine);
+static void printUsage();
+
+/* Main program */
+
+int main(int argc, char *argv[]) {
+   string basic = "";
+   string engine = "vm";
+   string format = "text";
+   string filter = "";
+   string dir = "bench/corpus";
+   int repeats = 5;
+   bool update = false;
+   bool dirGiven = false;
+   for (int i = 1; i < argc; i++) {
+      string arg = argv[i];
+      bool hasValue = i + 1 < argc;
+      if (arg == "--basic" && hasValue) {
+         basic = argv[++i];
+      } else if (arg == "--engine" && hasValue) {
+         engine = argv[++i];
+      } else if (arg == "--repeats" && hasValue) {
+         repeats = atoi(argv[++i]);
+      } else if (arg == "--format" && hasValue) {
+         format = argv[++i];
+      } else if (arg == "--filter" && hasValue) {
+         filter = argv[++i];
+      } else if (arg == "--update") {
+         update = true;
+      } else if (!dirGiven && arg != "" && arg[0] != '-') {
+         dir = arg;
+         dirGiven = true;
+      } else {
+         printUsage();
+         return 2;
+      }
+   }
+   if (basic == "" || repeats < 1
+       || (engine != "vm" && engine != "tree" && engine != "jit")
+       || (format != "text" && format != "json" && format != "csv")) {
+      printUsage();
+      return 2;
+   }
+   vector<string> names = listPrograms(dir);
+   if (names.empty()) {
+      cerr << "corpus: no programs in " << dir << endl;
+      return 2;
+   }
+   vector<Workload> workloads;
+   bool allOk = true;
+   for (size_t i = 0; i < names.size(); i++) {
+      if (names[i].find(filter) == string::npos) continue;
+      Workload work;
+      work.name = names[i];
+      work.peakRssKb = 0;
+      string base = dir + "/" + names[i];
+      work.program = base + ".bas";
+      string text;
+      string input;
+      bool hasGolden = readFile(base + ".out", work.golden);
+      if (readFile(base + ".in", input)) work.input = base + ".in";
+      readFile(work.program, text);
+      try {
+         work.linesExecuted = countLines(text, input);
+      } catch (ErrorException & ex) {
+         cerr << "corpus: " << work.name << ": " << ex.getMessage() << endl;
+         work.linesExecuted = 0;
+      }
+      work.status = (hasGolden || update) ? "ok" : "no golden";
+      for (int r = 0; r < repeats; r++) {
+         string output;
+         int status;
+         double start = now();
+         if (!runOnce(basic, engine, work, output, status)) return 2;
+         work.times.push_back(now() - start);
+         if (status != 0) {
+            work.status = "failed";
+         } else if (update && r == 0) {
+            if (!writeFile(base + ".out", output)) return 2;
+            work.status = "updated";
+         } else if (!update && hasGolden && output != work.golden) {
+            work.status = "mismatch";
+         }
+      }
+      sort(work.times.begin(), work.times.end());
+      if (work.status != "ok" && work.status != "updated") allOk = false;
+      workloads.push_back(work);
+   }
+   if (format == "text") {
+      writeText(workloads);
+   } else if (format == "json") {
+      writeJson(workloads, engine);
+   } else {
+      writeCsv(workloads, engine);
+   }
+   return allOk ? 0 : 1;
+}
+
+/*
+ * Function: listPrograms
+ * Usage: vector<string> names = listPrograms(dir);
+ * ------------------------------------------------
+ * Returns the names, without the extension, of the .bas files in
+ * dir, in alphabetical order.
+ */
+
+static vector<string> listPrograms(const string & dir) {
+   vector<string> names;
+   DIR *dp = opendir(dir.c_str());
+   if (dp == NULL) return names;
+   struct dirent *entry;
+   while ((entry = readdir(dp)) != NULL) {
+      string file = entry->d_name;
+      if (file.size() > 4 && file.compare(file.size() - 4, 4, ".bas") == 0) {
+         names.push_back(file.substr(0, file.size() - 4));
+      }
+   }
+   closedir(dp);
+   sort(names.begin(), names.end());
+   return names;
+}
+
+static bool readFile(const string & filename, string & text) {
+   ifstream infile(filename.c_str(), ios::binary);
+   if (infile.fail()) return false;
+   ostringstream out;
+   out << infile.rdbuf();
+   text = out.str();
+   return true;
+}
+
+static bool writeFile(const string & filename, const string & text) {
+   ofstream out(filename.c_str(), ios::binary);
+   out.write(text.data(), text.size());
+   if (out.fail()) {
+      cerr << "corpus: cannot write " << filename << endl;
+      return false;
+   }
+   return true;
+}
+
+/*
+ * Function: countLines
+ * Usage: long n = countLines(text, input);
+ * ----------------------------------------
+ * Loads the program text and runs it headless on the tree-walking
+ * engine with the given INPUT values, printing into a private buffer,
+ * and returns the number of statements executed.  Every line of the
+ * program must be numbered.
+ */
+
+static long countLines(const string & text, const string & input) {
+   Program program;
+   Lexer lexer;
+   istringstream lines(text);
+   string line;
+   while (getline(lines, line)) {
+      if (!line.empty() && line[line.size() - 1] == '\r') line.resize(line.size() - 1);
+      lexer.setInput(line);
+      if (!lexer.hasMoreTokens()) continue;
+      Token number = lexer.nextToken();
+      if (!number.isInteger()) error("Line without a line number: " + line);
+      int lineNumber = (int) number.number;
+      if (lexer.hasMoreTokens()) {
+         Statement *stmt = parseStatement(lexer, program.getArena());
+         program.addSourceLine(lineNumber, line);
+         program.setParsedStatement(lineNumber, stmt);
+      } else {
+         program.removeSourceLine(lineNumber);
+      }
+   }
+   program.link();
+   EvalState state;
+   OutputBuffer output;
+   istringstream values(input);
+   state.setOutput(&output);
+   state.setInput(&values);
+   long count = 0;
+   Statement *stmt = program.getFirstStatement();
+   while (stmt != NULL) {
+      state.setNextStatement(stmt->getSuccessor());
+      stmt->execute(state);
+      stmt = state.getNextStatement();
+      count++;
+      if (count % 4096 == 0) output.clear();
+   }
+   return count;
+}
+
+/*
+ * Function: runOnce
+ * Usage: if (!runOnce(basic, engine, work, output, status)) . . .
+ * ---------------------------------------------------------------
+ * Runs the workload once in a child process, with its input file, or
+ * an empty input, as standard input, and collects standard output in
+ * output and the exit status in status.  The peak resident set size
+ * of the child is folded into work.peakRssKb.  Returns false if the
+ * child could not be started.
+ */
+
+static bool runOnce(const string & basic, const string & engine,
+                    Workload & work, string & output, int & status) {
+   int fds[2];
+   if (pipe(fds) != 0) {
+      cerr << "corpus: pipe: " << strerror(errno) << endl;
+      return false;
+   }
+   pid_t pid = fork();
+   if (pid < 0) {
+      cerr << "corpus: fork: " << strerror(errno) << endl;
+      return false;
+   }
+   if (pid == 0) {
+      string inputFile = (work.input == "") ? "/dev/null" : work.input;
+      int fd = open(inputFile.c_str(), O_RDONLY);
+      if (fd < 0) _exit(127);
+      dup2(fd, 0);
+      dup2(fds[1], 1);
+      close(fd);
+      close(fds[0]);
+      close(fds[1]);
+      vector<const char *> args;
+      args.push_back(basic.c_str());
+      args.push_back("run");
+      if (engine == "tree") args.push_back("--tree");
+      if (engine == "jit") args.push_back("--jit");
+      args.push_back(work.program.c_str());
+      args.push_back(NULL);
+      execv(basic.c_str(), (char * const *) &args[0]);
+      _exit(127);
+   }
+   close(fds[1]);
+   output.clear();
+   char buffer[65536];
+   while (true) {
+      ssize_t n = read(fds[0], buffer, sizeof buffer);
+      if (n > 0) {
+         output.append(buffer, n);
+      } else if (n == 0 || errno != EINTR) {
+         break;
+      }
+   }
+   close(fds[0]);
+   int wstatus;
+   struct rusage usage;
+   if (wait4(pid, &wstatus, 0, &usage) < 0) {
+      cerr << "corpus: wait4: " << strerror(errno) << endl;
+      return false;
+   }
+   if (WIFEXITED(wstatus) && WEXITSTATUS(wstatus) == 127) {
+      cerr << "corpus: cannot run " << basic << endl;
+      return false;
+   }
+   status = WIFEXITED(wstatus) ? WEXITSTATUS(wstatus) : -1;
+   work.peakRssKb = max(work.peakRssKb, (long) usage.ru_maxrss);
+   return true;
+}
+
+static double now() {
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* Output */
+
+static double median(const Workload & work) {
+   return work.times[work.times.size() / 2];
+}
+
+static double linesPerSecond(const Workload & work) {
+   double seconds = median(work);
+   return (seconds > 0) ? work.linesExecuted / seconds : 0;
+}
+
+static void writeText(const vector<Workload> & workloads) {
+   printf("%-16s %-10s %12s %10s %10s %14s %10s\n", "workload", "status",
+          "lines", "median s", "min s", "lines/s", "peak KB");
+   for (size_t i = 0; i < workloads.size(); i++) {
+      const Workload & work = workloads[i];
+      printf("%-16s %-10s %12ld %10.4f %10.4f %14.0f %10ld\n",
+             work.name.c_str(), work.status.c_str(), work.linesExecuted,
+             median(work), work.times[0], linesPerSecond(work),
+             work.peakRssKb);
+   }
+}
+
+static void writeJson(const vector<Workload> & workloads, const string & engine) {
+   printf("{\"suite\": \"corpus\", \"engine\": \"%s\", \"results\": [", engine.c_str());
+   for (size_t i = 0; i < workloads.size(); i++) {
+      const Workload & work = workloads[i];
+      printf("%s\n  {\"name\": \"%s\", \"status\": \"%s\", \"lines_executed\": %ld, "
+             "\"repeats\": %d, \"median_seconds\": %.6g, \"min_seconds\": %.6g, "
+             "\"lines_per_second\": %.6g, \"peak_rss_kb\": %ld}",
+             (i == 0) ? "" : ",", work.name.c_str(), work.status.c_str(),
+             work.linesExecuted, (int) work.times.size(), median(work),
+             work.times[0], linesPerSecond(work), work.peakRssKb);
+   }
+   printf("\n]}\n");
+}
+
+static void writeCsv(const vector<Workload> & workloads, const string & engine) {
+   printf("engine,name,status,lines_executed,repeats,median_seconds,"
+          "min_seconds,lines_per_second,peak_rss_kb\n");
+   for (size_t i = 0; i < workloads.size(); i++) {
+      const Workload & work = workloads[i];
+      printf("%s,%s,%s,%ld,%d,%.6g,%.6g,%.6g,%ld\n", engine.c_str(),
+             work.name.c_str(), work.status.c_str(), work.linesExecuted,
+             (int) work.times.size(), median(work), work.times[0],
+             linesPerSecond(work), work.peakRssKb);
+   }
+}
+
+static void printUsage() {
+   cerr << "Usage: corpus --basic path [--engine vm|tree|jit] [--repeats n]" << endl;
+   cerr << "              [--format text|json|csv] [--filter text] [--update]" << endl;
+   cerr << "              [dir]" << endl;
+}
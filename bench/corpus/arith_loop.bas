@@ -0,0 +1,15 @@
+10 REM Tight arithmetic loop: sums of i, i squared and a running mix
+20 LET n = 3000000
+30 LET i = 0
+40 LET s = 0
+50 LET q = 0
+60 LET m = 1
+70 LET i = i + 1
+80 LET s = s + i
+90 LET q = q + i * i / 1000
+100 LET m = m * 0.999999 + 1 / (i + 1)
+110 IF i < n THEN 70
+120 PRINT "sum", s
+130 PRINT "squares", q
+140 PRINT "mix", m
+150 END
@@ -0,0 +1,21 @@
+10 REM Whole-array workload: vectors filled once, then combined and reduced
+20 LET n = 100000
+30 DIM x(n), y(n), z(n)
+40 LET i = 1
+50 LET x(i) = i / n
+60 LET y(i) = 1 / i
+70 LET i = i + 1
+80 IF i < n + 1 THEN 50
+90 LET k = 0
+100 LET t = 0
+110 z() = x() * y()
+120 z() = z() + x()
+130 z() = 2 - z()
+140 y() = y() * 0.999
+150 LET t = t + SUM(z()) + DOT(x(), y())
+160 LET k = k + 1
+170 IF k < 2000 THEN 110
+180 PRINT "sum", SUM(z())
+190 PRINT "dot", DOT(x(), y())
+200 PRINT "total", t
+210 END
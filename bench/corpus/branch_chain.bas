@@ -0,0 +1,30 @@
+10 REM Branch-heavy IF ladder: a sawtooth value 0..9 is classified by
+20 REM a chain of comparisons on every iteration
+30 LET n = 1000000
+40 LET i = 0
+50 LET k = 0
+60 LET a = 0
+70 LET b = 0
+80 LET c = 0
+90 LET d = 0
+100 LET i = i + 1
+110 LET k = k + 1
+120 IF k < 10 THEN 140
+130 LET k = 0
+140 IF k < 2 THEN 200
+150 IF k < 5 THEN 220
+160 IF k = 5 THEN 240
+170 IF k > 7 THEN 260
+180 LET d = d + k
+190 GOTO 270
+200 LET a = a + 1
+210 GOTO 270
+220 LET b = b + k
+230 GOTO 270
+240 LET c = c - 1
+250 GOTO 270
+260 LET d = d - k
+270 IF i < n THEN 100
+280 PRINT "a and b", a, b
+290 PRINT "c and d", c, d
+300 END
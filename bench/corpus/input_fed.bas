@@ -0,0 +1,22 @@
+10 REM INPUT-fed statistics: reads a count and that many values and
+20 REM reports their sum, mean, minimum and maximum
+30 INPUT n
+40 LET i = 0
+50 LET s = 0
+60 INPUT x
+70 LET lo = x
+80 LET hi = x
+90 LET s = s + x
+100 LET i = i + 1
+110 IF i = n THEN 170
+120 INPUT x
+130 IF x > lo THEN 150
+140 LET lo = x
+150 IF x < hi THEN 90
+160 LET hi = x
+165 GOTO 90
+170 PRINT "count", n
+180 PRINT "sum", s
+190 PRINT "mean", s / n
+200 PRINT "min and max", lo, hi
+210 END
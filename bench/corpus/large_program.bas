@@ -0,0 +1,20007 @@
+10 REM Very large program: 20000 straight-line statements run in 20 passes
+20 LET p = 0
+30 LET t = 0
+100 LET v0 = 0
+110 LET v0 = v0 * 3 + 1
+120 LET t = t + v0 / 7
+130 IF t < 0 THEN 140
+140 LET v1 = 4
+150 LET v1 = v1 * 3 + 5
+160 LET t = t + v1 / 7
+170 IF t < 0 THEN 180
+180 LET v2 = 8
+190 LET v2 = v2 * 3 + 9
+200 LET t = t + v2 / 7
+210 IF t < 0 THEN 220
+220 LET v3 = 12
+230 LET v3 = v3 * 3 + 0
+240 LET t = t + v3 / 7
+250 IF t < 0 THEN 260
+260 LET v4 = 16
+270 LET v4 = v4 * 3 + 4
+280 LET t = t + v4 / 7
+290 IF t < 0 THEN 300
+300 LET v5 = 20
+310 LET v5 = v5 * 3 + 8
+320 LET t = t + v5 / 7
+330 IF t < 0 THEN 340
+340 LET v6 = 24
+350 LET v6 = v6 * 3 + 12
+360 LET t = t + v6 / 7
+370 IF t < 0 THEN 380
+380 LET v7 = 28
+390 LET v7 = v7 * 3 + 3
+400 LET t = t + v7 / 7
+410 IF t < 0 THEN 420
+420 LET v8 = 32
+430 LET v8 = v8 * 3 + 7
+440 LET t = t + v8 / 7
+450 IF t < 0 THEN 460
+460 LET v9 = 36
+470 LET v9 = v9 * 3 + 11
+480 LET t = t + v9 / 7
+490 IF t < 0 THEN 500
+500 LET v10 = 40
+510 LET v10 = v10 * 3 + 2
+520 LET t = t + v10 / 7
+530 IF t < 0 THEN 540
+540 LET v11 = 44
+550 LET v11 = v11 * 3 + 6
+560 LET t = t + v11 / 7
+570 IF t < 0 THEN 580
+580 LET v12 = 48
+590 LET v12 = v12 * 3 + 10
+600 LET t = t + v12 / 7
+610 IF t < 0 THEN 620
+620 LET v13 = 52
+630 LET v13 = v13 * 3 + 1
+640 LET t = t + v13 / 7
+650 IF t < 0 THEN 660
+660 LET v14 = 56
+670 LET v14 = v14 * 3 + 5
+680 LET t = t + v14 / 7
+690 IF t < 0 THEN 700
+700 LET v15 = 60
+710 LET v15 = v15 * 3 + 9
+720 LET t = t + v15 / 7
+730 IF t < 0 THEN 740
+740 LET v16 = 64
+750 LET v16 = v16 * 3 + 0
+760 LET t = t + v16 / 7
+770 IF t < 0 THEN 780
+780 LET v17 = 68
+790 LET v17 = v17 * 3 + 4
+800 LET t = t + v17 / 7
+810 IF t < 0 THEN 820
+820 LET v18 = 72
+830 LET v18 = v18 * 3 + 8
+840 LET t = t + v18 / 7
+850 IF t < 0 THEN 860
+860 LET v19 = 76
+870 LET v19 = v19 * 3 + 12
+880 LET t = t + v19 / 7
+890 IF t < 0 THEN 900
+900 LET v20 = 80
+910 LET v20 = v20 * 3 + 3
+920 LET t = t + v20 / 7
+930 IF t < 0 THEN 940
+940 LET v21 = 84
+950 LET v21 = v21 * 3 + 7
+960 LET t = t + v21 / 7
+970 IF t < 0 THEN 980
+980 LET v22 = 88
+990 LET v22 = v22 * 3 + 11
+1000 LET t = t + v22 / 7
+1010 IF t < 0 THEN 1020
+1020 LET v23 = 92
+1030 LET v23 = v23 * 3 + 2
+1040 LET t = t + v23 / 7
+1050 IF t < 0 THEN 1060
+1060 LET v24 = 96
+1070 LET v24 = v24 * 3 + 6
+1080 LET t = t + v24 / 7
+1090 IF t < 0 THEN 1100
+1100 LET v25 = 3
+1110 LET v25 = v25 * 3 + 10
+1120 LET t = t + v25 / 7
+1130 IF t < 0 THEN 1140
+1140 LET v26 = 7
+1150 LET v26 = v26 * 3 + 1
+1160 LET t = t + v26 / 7
+1170 IF t < 0 THEN 1180
+1180 LET v27 = 11
+1190 LET v27 = v27 * 3 + 5
+1200 LET t = t + v27 / 7
+1210 IF t < 0 THEN 1220
+1220 LET v28 = 15
+1230 LET v28 = v28 * 3 + 9
+1240 LET t = t + v28 / 7
+1250 IF t < 0 THEN 1260
+1260 LET v29 = 19
+1270 LET v29 = v29 * 3 + 0
+1280 LET t = t + v29 / 7
+1290 IF t < 0 THEN 1300
+1300 LET v30 = 23
+1310 LET v30 = v30 * 3 + 4
+1320 LET t = t + v30 / 7
+1330 IF t < 0 THEN 1340
+1340 LET v31 = 27
+1350 LET v31 = v31 * 3 + 8
+1360 LET t = t + v31 / 7
+1370 IF t < 0 THEN 1380
+1380 LET v32 = 31
+1390 LET v32 = v32 * 3 + 12
+1400 LET t = t + v32 / 7
+1410 IF t < 0 THEN 1420
+1420 LET v33 = 35
+1430 LET v33 = v33 * 3 + 3
+1440 LET t = t + v33 / 7
+1450 IF t < 0 THEN 1460
+1460 LET v34 = 39
+1470 LET v34 = v34 * 3 + 7
+1480 LET t = t + v34 / 7
+1490 IF t < 0 THEN 1500
+1500 LET v35 = 43
+1510 LET v35 = v35 * 3 + 11
+1520 LET t = t + v35 / 7
+1530 IF t < 0 THEN 1540
+1540 LET v36 = 47
+1550 LET v36 = v36 * 3 + 2
+1560 LET t = t + v36 / 7
+1570 IF t < 0 THEN 1580
+1580 LET v37 = 51
+1590 LET v37 = v37 * 3 + 6
+1600 LET t = t + v37 / 7
+1610 IF t < 0 THEN 1620
+1620 LET v38 = 55
+1630 LET v38 = v38 * 3 + 10
+1640 LET t = t + v38 / 7
+1650 IF t < 0 THEN 1660
+1660 LET v39 = 59
+1670 LET v39 = v39 * 3 + 1
+1680 LET t = t + v39 / 7
+1690 IF t < 0 THEN 1700
+1700 LET v40 = 63
+1710 LET v40 = v40 * 3 + 5
+1720 LET t = t + v40 / 7
+1730 IF t < 0 THEN 1740
+1740 LET v41 = 67
+1750 LET v41 = v41 * 3 + 9
+1760 LET t = t + v41 / 7
+1770 IF t < 0 THEN 1780
+1780 LET v42 = 71
+1790 LET v42 = v42 * 3 + 0
+1800 LET t = t + v42 / 7
+1810 IF t < 0 THEN 1820
+1820 LET v43 = 75
+1830 LET v43 = v43 * 3 + 4
+1840 LET t = t + v43 / 7
+1850 IF t < 0 THEN 1860
+1860 LET v44 = 79
+1870 LET v44 = v44 * 3 + 8
+1880 LET t = t + v44 / 7
+1890 IF t < 0 THEN 1900
+1900 LET v45 = 83
+1910 LET v45 = v45 * 3 + 12
+1920 LET t = t + v45 / 7
+1930 IF t < 0 THEN 1940
+1940 LET v46 = 87
+1950 LET v46 = v46 * 3 + 3
+1960 LET t = t + v46 / 7
+1970 IF t < 0 THEN 1980
+1980 LET v47 = 91
+1990 LET v47 = v47 * 3 + 7
+2000 LET t = t + v47 / 7
+2010 IF t < 0 THEN 2020
+2020 LET v48 = 95
+2030 LET v48 = v48 * 3 + 11
+2040 LET t = t + v48 / 7
+2050 IF t < 0 THEN 2060
+2060 LET v49 = 2
+2070 LET v49 = v49 * 3 + 2
+2080 LET t = t + v49 / 7
+2090 IF t < 0 THEN 2100
+2100 LET v0 = 6
+2110 LET v0 = v0 * 3 + 6
+2120 LET t = t + v0 / 7
+2130 IF t < 0 THEN 2140
+2140 LET v1 = 10
+2150 LET v1 = v1 * 3 + 10
+2160 LET t = t + v1 / 7
+2170 IF t < 0 THEN 2180
+2180 LET v2 = 14
+2190 LET v2 = v2 * 3 + 1
+2200 LET t = t + v2 / 7
+2210 IF t < 0 THEN 2220
+2220 LET v3 = 18
+2230 LET v3 = v3 * 3 + 5
+2240 LET t = t + v3 / 7
+2250 IF t < 0 THEN 2260
+2260 LET v4 = 22
+2270 LET v4 = v4 * 3 + 9
+2280 LET t = t + v4 / 7
+2290 IF t < 0 THEN 2300
+2300 LET v5 = 26
+2310 LET v5 = v5 * 3 + 0
+2320 LET t = t + v5 / 7
+2330 IF t < 0 THEN 2340
+2340 LET v6 = 30
+2350 LET v6 = v6 * 3 + 4
+2360 LET t = t + v6 / 7
+2370 IF t < 0 THEN 2380
+2380 LET v7 = 34
+2390 LET v7 = v7 * 3 + 8
+2400 LET t = t + v7 / 7
+2410 IF t < 0 THEN 2420
+2420 LET v8 = 38
+2430 LET v8 = v8 * 3 + 12
+2440 LET t = t + v8 / 7
+2450 IF t < 0 THEN 2460
+2460 LET v9 = 42
+2470 LET v9 = v9 * 3 + 3
+2480 LET t = t + v9 / 7
+2490 IF t < 0 THEN 2500
+2500 LET v10 = 46
+2510 LET v10 = v10 * 3 + 7
+2520 LET t = t + v10 / 7
+2530 IF t < 0 THEN 2540
+2540 LET v11 = 50
+2550 LET v11 = v11 * 3 + 11
+2560 LET t = t + v11 / 7
+2570 IF t < 0 THEN 2580
+2580 LET v12 = 54
+2590 LET v12 = v12 * 3 + 2
+2600 LET t = t + v12 / 7
+2610 IF t < 0 THEN 2620
+2620 LET v13 = 58
+2630 LET v13 = v13 * 3 + 6
+2640 LET t = t + v13 / 7
+2650 IF t < 0 THEN 2660
+2660 LET v14 = 62
+2670 LET v14 = v14 * 3 + 10
+2680 LET t = t + v14 / 7
+2690 IF t < 0 THEN 2700
+2700 LET v15 = 66
+2710 LET v15 = v15 * 3 + 1
+2720 LET t = t + v15 / 7
+2730 IF t < 0 THEN 2740
+2740 LET v16 = 70
+2750 LET v16 = v16 * 3 + 5
+2760 LET t = t + v16 / 7
+2770 IF t < 0 THEN 2780
+2780 LET v17 = 74
+2790 LET v17 = v17 * 3 + 9
+2800 LET t = t + v17 / 7
+2810 IF t < 0 THEN 2820
+2820 LET v18 = 78
+2830 LET v18 = v18 * 3 + 0
+2840 LET t = t + v18 / 7
+2850 IF t < 0 THEN 2860
+2860 LET v19 = 82
+2870 LET v19 = v19 * 3 + 4
+2880 LET t = t + v19 / 7
+2890 IF t < 0 THEN 2900
+2900 LET v20 = 86
+2910 LET v20 = v20 * 3 + 8
+2920 LET t = t + v20 / 7
+2930 IF t < 0 THEN 2940
+2940 LET v21 = 90
+2950 LET v21 = v21 * 3 + 12
+2960 LET t = t + v21 / 7
+2970 IF t < 0 THEN 2980
+2980 LET v22 = 94
+2990 LET v22 = v22 * 3 + 3
+3000 LET t = t + v22 / 7
+3010 IF t < 0 THEN 3020
+3020 LET v23 = 1
+3030 LET v23 = v23 * 3 + 7
+3040 LET t = t + v23 / 7
+3050 IF t < 0 THEN 3060
+3060 LET v24 = 5
+3070 LET v24 = v24 * 3 + 11
+3080 LET t = t + v24 / 7
+3090 IF t < 0 THEN 3100
+3100 LET v25 = 9
+3110 LET v25 = v25 * 3 + 2
+3120 LET t = t + v25 / 7
+3130 IF t < 0 THEN 3140
+3140 LET v26 = 13
+3150 LET v26 = v26 * 3 + 6
+3160 LET t = t + v26 / 7
+3170 IF t < 0 THEN 3180
+3180 LET v27 = 17
+3190 LET v27 = v27 * 3 + 10
+3200 LET t = t + v27 / 7
+3210 IF t < 0 THEN 3220
+3220 LET v28 = 21
+3230 LET v28 = v28 * 3 + 1
+3240 LET t = t + v28 / 7
+3250 IF t < 0 THEN 3260
+3260 LET v29 = 25
+3270 LET v29 = v29 * 3 + 5
+3280 LET t = t + v29 / 7
+3290 IF t < 0 THEN 3300
+3300 LET v30 = 29
+3310 LET v30 = v30 * 3 + 9
+3320 LET t = t + v30 / 7
+3330 IF t < 0 THEN 3340
+3340 LET v31 = 33
+3350 LET v31 = v31 * 3 + 0
+3360 LET t = t + v31 / 7
+3370 IF t < 0 THEN 3380
+3380 LET v32 = 37
+3390 LET v32 = v32 * 3 + 4
+3400 LET t = t + v32 / 7
+3410 IF t < 0 THEN 3420
+3420 LET v33 = 41
+3430 LET v33 = v33 * 3 + 8
+3440 LET t = t + v33 / 7
+3450 IF t < 0 THEN 3460
+3460 LET v34 = 45
+3470 LET v34 = v34 * 3 + 12
+3480 LET t = t + v34 / 7
+3490 IF t < 0 THEN 3500
+3500 LET v35 = 49
+3510 LET v35 = v35 * 3 + 3
+3520 LET t = t + v35 / 7
+3530 IF t < 0 THEN 3540
+3540 LET v36 = 53
+3550 LET v36 = v36 * 3 + 7
+3560 LET t = t + v36 / 7
+3570 IF t < 0 THEN 3580
+3580 LET v37 = 57
+3590 LET v37 = v37 * 3 + 11
+3600 LET t = t + v37 / 7
+3610 IF t < 0 THEN 3620
+3620 LET v38 = 61
+3630 LET v38 = v38 * 3 + 2
+3640 LET t = t + v38 / 7
+3650 IF t < 0 THEN 3660
+3660 LET v39 = 65
+3670 LET v39 = v39 * 3 + 6
+3680 LET t = t + v39 / 7
+3690 IF t < 0 THEN 3700
+3700 LET v40 = 69
+3710 LET v40 = v40 * 3 + 10
+3720 LET t = t + v40 / 7
+3730 IF t < 0 THEN 3740
+3740 LET v41 = 73
+3750 LET v41 = v41 * 3 + 1
+3760 LET t = t + v41 / 7
+3770 IF t < 0 THEN 3780
+3780 LET v42 = 77
+3790 LET v42 = v42 * 3 + 5
+3800 LET t = t + v42 / 7
+3810 IF t < 0 THEN 3820
+3820 LET v43 = 81
+3830 LET v43 = v43 * 3 + 9
+3840 LET t = t + v43 / 7
+3850 IF t < 0 THEN 3860
+3860 LET v44 = 85
+3870 LET v44 = v44 * 3 + 0
+3880 LET t = t + v44 / 7
+3890 IF t < 0 THEN 3900
+3900 LET v45 = 89
+3910 LET v45 = v45 * 3 + 4
+3920 LET t = t + v45 / 7
+3930 IF t < 0 THEN 3940
+3940 LET v46 = 93
+3950 LET v46 = v46 * 3 + 8
+3960 LET t = t + v46 / 7
+3970 IF t < 0 THEN 3980
+3980 LET v47 = 0
+3990 LET v47 = v47 * 3 + 12
+4000 LET t = t + v47 / 7
+4010 IF t < 0 THEN 4020
+4020 LET v48 = 4
+4030 LET v48 = v48 * 3 + 3
+4040 LET t = t + v48 / 7
+4050 IF t < 0 THEN 4060
+4060 LET v49 = 8
+4070 LET v49 = v49 * 3 + 7
+4080 LET t = t + v49 / 7
+4090 IF t < 0 THEN 4100
+4100 LET v0 = 12
+4110 LET v0 = v0 * 3 + 11
+4120 LET t = t + v0 / 7
+4130 IF t < 0 THEN 4140
+4140 LET v1 = 16
+4150 LET v1 = v1 * 3 + 2
+4160 LET t = t + v1 / 7
+4170 IF t < 0 THEN 4180
+4180 LET v2 = 20
+4190 LET v2 = v2 * 3 + 6
+4200 LET t = t + v2 / 7
+4210 IF t < 0 THEN 4220
+4220 LET v3 = 24
+4230 LET v3 = v3 * 3 + 10
+4240 LET t = t + v3 / 7
+4250 IF t < 0 THEN 4260
+4260 LET v4 = 28
+4270 LET v4 = v4 * 3 + 1
+4280 LET t = t + v4 / 7
+4290 IF t < 0 THEN 4300
+4300 LET v5 = 32
+4310 LET v5 = v5 * 3 + 5
+4320 LET t = t + v5 / 7
+4330 IF t < 0 THEN 4340
+4340 LET v6 = 36
+4350 LET v6 = v6 * 3 + 9
+4360 LET t = t + v6 / 7
+4370 IF t < 0 THEN 4380
+4380 LET v7 = 40
+4390 LET v7 = v7 * 3 + 0
+4400 LET t = t + v7 / 7
+4410 IF t < 0 THEN 4420
+4420 LET v8 = 44
+4430 LET v8 = v8 * 3 + 4
+4440 LET t = t + v8 / 7
+4450 IF t < 0 THEN 4460
+4460 LET v9 = 48
+4470 LET v9 = v9 * 3 + 8
+4480 LET t = t + v9 / 7
+4490 IF t < 0 THEN 4500
+4500 LET v10 = 52
+4510 LET v10 = v10 * 3 + 12
+4520 LET t = t + v10 / 7
+4530 IF t < 0 THEN 4540
+4540 LET v11 = 56
+4550 LET v11 = v11 * 3 + 3
+4560 LET t = t + v11 / 7
+4570 IF t < 0 THEN 4580
+4580 LET v12 = 60
+4590 LET v12 = v12 * 3 + 7
+4600 LET t = t + v12 / 7
+4610 IF t < 0 THEN 4620
+4620 LET v13 = 64
+4630 LET v13 = v13 * 3 + 11
+4640 LET t = t + v13 / 7
+4650 IF t < 0 THEN 4660
+4660 LET v14 = 68
+4670 LET v14 = v14 * 3 + 2
+4680 LET t = t + v14 / 7
+4690 IF t < 0 THEN 4700
+4700 LET v15 = 72
+4710 LET v15 = v15 * 3 + 6
+4720 LET t = t + v15 / 7
+4730 IF t < 0 THEN 4740
+4740 LET v16 = 76
+4750 LET v16 = v16 * 3 + 10
+4760 LET t = t + v16 / 7
+4770 IF t < 0 THEN 4780
+4780 LET v17 = 80
+4790 LET v17 = v17 * 3 + 1
+4800 LET t = t + v17 / 7
+4810 IF t < 0 THEN 4820
+4820 LET v18 = 84
+4830 LET v18 = v18 * 3 + 5
+4840 LET t = t + v18 / 7
+4850 IF t < 0 THEN 4860
+4860 LET v19 = 88
+4870 LET v19 = v19 * 3 + 9
+4880 LET t = t + v19 / 7
+4890 IF t < 0 THEN 4900
+4900 LET v20 = 92
+4910 LET v20 = v20 * 3 + 0
+4920 LET t = t + v20 / 7
+4930 IF t < 0 THEN 4940
+4940 LET v21 = 96
+4950 LET v21 = v21 * 3 + 4
+4960 LET t = t + v21 / 7
+4970 IF t < 0 THEN 4980
+4980 LET v22 = 3
+4990 LET v22 = v22 * 3 + 8
+5000 LET t = t + v22 / 7
+5010 IF t < 0 THEN 5020
+5020 LET v23 = 7
+5030 LET v23 = v23 * 3 + 12
+5040 LET t = t + v23 / 7
+5050 IF t < 0 THEN 5060
+5060 LET v24 = 11
+5070 LET v24 = v24 * 3 + 3
+5080 LET t = t + v24 / 7
+5090 IF t < 0 THEN 5100
+5100 LET v25 = 15
+5110 LET v25 = v25 * 3 + 7
+5120 LET t = t + v25 / 7
+5130 IF t < 0 THEN 5140
+5140 LET v26 = 19
+5150 LET v26 = v26 * 3 + 11
+5160 LET t = t + v26 / 7
+5170 IF t < 0 THEN 5180
+5180 LET v27 = 23
+5190 LET v27 = v27 * 3 + 2
+5200 LET t = t + v27 / 7
+5210 IF t < 0 THEN 5220
+5220 LET v28 = 27
+5230 LET v28 = v28 * 3 + 6
+5240 LET t = t + v28 / 7
+5250 IF t < 0 THEN 5260
+5260 LET v29 = 31
+5270 LET v29 = v29 * 3 + 10
+5280 LET t = t + v29 / 7
+5290 IF t < 0 THEN 5300
+5300 LET v30 = 35
+5310 LET v30 = v30 * 3 + 1
+5320 LET t = t + v30 / 7
+5330 IF t < 0 THEN 5340
+5340 LET v31 = 39
+5350 LET v31 = v31 * 3 + 5
+5360 LET t = t + v31 / 7
+5370 IF t < 0 THEN 5380
+5380 LET v32 = 43
+5390 LET v32 = v32 * 3 + 9
+5400 LET t = t + v32 / 7
+5410 IF t < 0 THEN 5420
+5420 LET v33 = 47
+5430 LET v33 = v33 * 3 + 0
+5440 LET t = t + v33 / 7
+5450 IF t < 0 THEN 5460
+5460 LET v34 = 51
+5470 LET v34 = v34 * 3 + 4
+5480 LET t = t + v34 / 7
+5490 IF t < 0 THEN 5500
+5500 LET v35 = 55
+5510 LET v35 = v35 * 3 + 8
+5520 LET t = t + v35 / 7
+5530 IF t < 0 THEN 5540
+5540 LET v36 = 59
+5550 LET v36 = v36 * 3 + 12
+5560 LET t = t + v36 / 7
+5570 IF t < 0 THEN 5580
+5580 LET v37 = 63
+5590 LET v37 = v37 * 3 + 3
+5600 LET t = t + v37 / 7
+5610 IF t < 0 THEN 5620
+5620 LET v38 = 67
+5630 LET v38 = v38 * 3 + 7
+5640 LET t = t + v38 / 7
+5650 IF t < 0 THEN 5660
+5660 LET v39 = 71
+5670 LET v39 = v39 * 3 + 11
+5680 LET t = t + v39 / 7
+5690 IF t < 0 THEN 5700
+5700 LET v40 = 75
+5710 LET v40 = v40 * 3 + 2
+5720 LET t = t + v40 / 7
+5730 IF t < 0 THEN 5740
+5740 LET v41 = 79
+5750 LET v41 = v41 * 3 + 6
+5760 LET t = t + v41 / 7
+5770 IF t < 0 THEN 5780
+5780 LET v42 = 83
+5790 LET v42 = v42 * 3 + 10
+5800 LET t = t + v42 / 7
+5810 IF t < 0 THEN 5820
+5820 LET v43 = 87
+5830 LET v43 = v43 * 3 + 1
+5840 LET t = t + v43 / 7
+5850 IF t < 0 THEN 5860
+5860 LET v44 = 91
+5870 LET v44 = v44 * 3 + 5
+5880 LET t = t + v44 / 7
+5890 IF t < 0 THEN 5900
+5900 LET v45 = 95
+5910 LET v45 = v45 * 3 + 9
+5920 LET t = t + v45 / 7
+5930 IF t < 0 THEN 5940
+5940 LET v46 = 2
+5950 LET v46 = v46 * 3 + 0
+5960 LET t = t + v46 / 7
+5970 IF t < 0 THEN 5980
+5980 LET v47 = 6
+5990 LET v47 = v47 * 3 + 4
+6000 LET t = t + v47 / 7
+6010 IF t < 0 THEN 6020
+6020 LET v48 = 10
+6030 LET v48 = v48 * 3 + 8
+6040 LET t = t + v48 / 7
+6050 IF t < 0 THEN 6060
+6060 LET v49 = 14
+6070 LET v49 = v49 * 3 + 12
+6080 LET t = t + v49 / 7
+6090 IF t < 0 THEN 6100
+6100 LET v0 = 18
+6110 LET v0 = v0 * 3 + 3
+6120 LET t = t + v0 / 7
+6130 IF t < 0 THEN 6140
+6140 LET v1 = 22
+6150 LET v1 = v1 * 3 + 7
+6160 LET t = t + v1 / 7
+6170 IF t < 0 THEN 6180
+6180 LET v2 = 26
+6190 LET v2 = v2 * 3 + 11
+6200 LET t = t + v2 / 7
+6210 IF t < 0 THEN 6220
+6220 LET v3 = 30
+6230 LET v3 = v3 * 3 + 2
+6240 LET t = t + v3 / 7
+6250 IF t < 0 THEN 6260
+6260 LET v4 = 34
+6270 LET v4 = v4 * 3 + 6
+6280 LET t = t + v4 / 7
+6290 IF t < 0 THEN 6300
+6300 LET v5 = 38
+6310 LET v5 = v5 * 3 + 10
+6320 LET t = t + v5 / 7
+6330 IF t < 0 THEN 6340
+6340 LET v6 = 42
+6350 LET v6 = v6 * 3 + 1
+6360 LET t = t + v6 / 7
+6370 IF t < 0 THEN 6380
+6380 LET v7 = 46
+6390 LET v7 = v7 * 3 + 5
+6400 LET t = t + v7 / 7
+6410 IF t < 0 THEN 6420
+6420 LET v8 = 50
+6430 LET v8 = v8 * 3 + 9
+6440 LET t = t + v8 / 7
+6450 IF t < 0 THEN 6460
+6460 LET v9 = 54
+6470 LET v9 = v9 * 3 + 0
+6480 LET t = t + v9 / 7
+6490 IF t < 0 THEN 6500
+6500 LET v10 = 58
+6510 LET v10 = v10 * 3 + 4
+6520 LET t = t + v10 / 7
+6530 IF t < 0 THEN 6540
+6540 LET v11 = 62
+6550 LET v11 = v11 * 3 + 8
+6560 LET t = t + v11 / 7
+6570 IF t < 0 THEN 6580
+6580 LET v12 = 66
+6590 LET v12 = v12 * 3 + 12
+6600 LET t = t + v12 / 7
+6610 IF t < 0 THEN 6620
+6620 LET v13 = 70
+6630 LET v13 = v13 * 3 + 3
+6640 LET t = t + v13 / 7
+6650 IF t < 0 THEN 6660
+6660 LET v14 = 74
+6670 LET v14 = v14 * 3 + 7
+6680 LET t = t + v14 / 7
+6690 IF t < 0 THEN 6700
+6700 LET v15 = 78
+6710 LET v15 = v15 * 3 + 11
+6720 LET t = t + v15 / 7
+6730 IF t < 0 THEN 6740
+6740 LET v16 = 82
+6750 LET v16 = v16 * 3 + 2
+6760 LET t = t + v16 / 7
+6770 IF t < 0 THEN 6780
+6780 LET v17 = 86
+6790 LET v17 = v17 * 3 + 6
+6800 LET t = t + v17 / 7
+6810 IF t < 0 THEN 6820
+6820 LET v18 = 90
+6830 LET v18 = v18 * 3 + 10
+6840 LET t = t + v18 / 7
+6850 IF t < 0 THEN 6860
+6860 LET v19 = 94
+6870 LET v19 = v19 * 3 + 1
+6880 LET t = t + v19 / 7
+6890 IF t < 0 THEN 6900
+6900 LET v20 = 1
+6910 LET v20 = v20 * 3 + 5
+6920 LET t = t + v20 / 7
+6930 IF t < 0 THEN 6940
+6940 LET v21 = 5
+6950 LET v21 = v21 * 3 + 9
+6960 LET t = t + v21 / 7
+6970 IF t < 0 THEN 6980
+6980 LET v22 = 9
+6990 LET v22 = v22 * 3 + 0
+7000 LET t = t + v22 / 7
+7010 IF t < 0 THEN 7020
+7020 LET v23 = 13
+7030 LET v23 = v23 * 3 + 4
+7040 LET t = t + v23 / 7
+7050 IF t < 0 THEN 7060
+7060 LET v24 = 17
+7070 LET v24 = v24 * 3 + 8
+7080 LET t = t + v24 / 7
+7090 IF t < 0 THEN 7100
+7100 LET v25 = 21
+7110 LET v25 = v25 * 3 + 12
+7120 LET t = t + v25 / 7
+7130 IF t < 0 THEN 7140
+7140 LET v26 = 25
+7150 LET v26 = v26 * 3 + 3
+7160 LET t = t + v26 / 7
+7170 IF t < 0 THEN 7180
+7180 LET v27 = 29
+7190 LET v27 = v27 * 3 + 7
+7200 LET t = t + v27 / 7
+7210 IF t < 0 THEN 7220
+7220 LET v28 = 33
+7230 LET v28 = v28 * 3 + 11
+7240 LET t = t + v28 / 7
+7250 IF t < 0 THEN 7260
+7260 LET v29 = 37
+7270 LET v29 = v29 * 3 + 2
+7280 LET t = t + v29 / 7
+7290 IF t < 0 THEN 7300
+7300 LET v30 = 41
+7310 LET v30 = v30 * 3 + 6
+7320 LET t = t + v30 / 7
+7330 IF t < 0 THEN 7340
+7340 LET v31 = 45
+7350 LET v31 = v31 * 3 + 10
+7360 LET t = t + v31 / 7
+7370 IF t < 0 THEN 7380
+7380 LET v32 = 49
+7390 LET v32 = v32 * 3 + 1
+7400 LET t = t + v32 / 7
+7410 IF t < 0 THEN 7420
+7420 LET v33 = 53
+7430 LET v33 = v33 * 3 + 5
+7440 LET t = t + v33 / 7
+7450 IF t < 0 THEN 7460
+7460 LET v34 = 57
+7470 LET v34 = v34 * 3 + 9
+7480 LET t = t + v34 / 7
+7490 IF t < 0 THEN 7500
+7500 LET v35 = 61
+7510 LET v35 = v35 * 3 + 0
+7520 LET t = t + v35 / 7
+7530 IF t < 0 THEN 7540
+7540 LET v36 = 65
+7550 LET v36 = v36 * 3 + 4
+7560 LET t = t + v36 / 7
+7570 IF t < 0 THEN 7580
+7580 LET v37 = 69
+7590 LET v37 = v37 * 3 + 8
+7600 LET t = t + v37 / 7
+7610 IF t < 0 THEN 7620
+7620 LET v38 = 73
+7630 LET v38 = v38 * 3 + 12
+7640 LET t = t + v38 / 7
+7650 IF t < 0 THEN 7660
+7660 LET v39 = 77
+7670 LET v39 = v39 * 3 + 3
+7680 LET t = t + v39 / 7
+7690 IF t < 0 THEN 7700
+7700 LET v40 = 81
+7710 LET v40 = v40 * 3 + 7
+7720 LET t = t + v40 / 7
+7730 IF t < 0 THEN 7740
+7740 LET v41 = 85
+7750 LET v41 = v41 * 3 + 11
+7760 LET t = t + v41 / 7
+7770 IF t < 0 THEN 7780
+7780 LET v42 = 89
+7790 LET v42 = v42 * 3 + 2
+7800 LET t = t + v42 / 7
+7810 IF t < 0 THEN 7820
+7820 LET v43 = 93
+7830 LET v43 = v43 * 3 + 6
+7840 LET t = t + v43 / 7
+7850 IF t < 0 THEN 7860
+7860 LET v44 = 0
+7870 LET v44 = v44 * 3 + 10
+7880 LET t = t + v44 / 7
+7890 IF t < 0 THEN 7900
+7900 LET v45 = 4
+7910 LET v45 = v45 * 3 + 1
+7920 LET t = t + v45 / 7
+7930 IF t < 0 THEN 7940
+7940 LET v46 = 8
+7950 LET v46 = v46 * 3 + 5
+7960 LET t = t + v46 / 7
+7970 IF t < 0 THEN 7980
+7980 LET v47 = 12
+7990 LET v47 = v47 * 3 + 9
+8000 LET t = t + v47 / 7
+8010 IF t < 0 THEN 8020
+8020 LET v48 = 16
+8030 LET v48 = v48 * 3 + 0
+8040 LET t = t + v48 / 7
+8050 IF t < 0 THEN 8060
+8060 LET v49 = 20
+8070 LET v49 = v49 * 3 + 4
+8080 LET t = t + v49 / 7
+8090 IF t < 0 THEN 8100
+8100 LET v0 = 24
+8110 LET v0 = v0 * 3 + 8
+8120 LET t = t + v0 / 7
+8130 IF t < 0 THEN 8140
+8140 LET v1 = 28
+8150 LET v1 = v1 * 3 + 12
+8160 LET t = t + v1 / 7
+8170 IF t < 0 THEN 8180
+8180 LET v2 = 32
+8190 LET v2 = v2 * 3 + 3
+8200 LET t = t + v2 / 7
+8210 IF t < 0 THEN 8220
+8220 LET v3 = 36
+8230 LET v3 = v3 * 3 + 7
+8240 LET t = t + v3 / 7
+8250 IF t < 0 THEN 8260
+8260 LET v4 = 40
+8270 LET v4 = v4 * 3 + 11
+8280 LET t = t + v4 / 7
+8290 IF t < 0 THEN 8300
+8300 LET v5 = 44
+8310 LET v5 = v5 * 3 + 2
+8320 LET t = t + v5 / 7
+8330 IF t < 0 THEN 8340
+8340 LET v6 = 48
+8350 LET v6 = v6 * 3 + 6
+8360 LET t = t + v6 / 7
+8370 IF t < 0 THEN 8380
+8380 LET v7 = 52
+8390 LET v7 = v7 * 3 + 10
+8400 LET t = t + v7 / 7
+8410 IF t < 0 THEN 8420
+8420 LET v8 = 56
+8430 LET v8 = v8 * 3 + 1
+8440 LET t = t + v8 / 7
+8450 IF t < 0 THEN 8460
+8460 LET v9 = 60
+8470 LET v9 = v9 * 3 + 5
+8480 LET t = t + v9 / 7
+8490 IF t < 0 THEN 8500
+8500 LET v10 = 64
+8510 LET v10 = v10 * 3 + 9
+8520 LET t = t + v10 / 7
+8530 IF t < 0 THEN 8540
+8540 LET v11 = 68
+8550 LET v11 = v11 * 3 + 0
+8560 LET t = t + v11 / 7
+8570 IF t < 0 THEN 8580
+8580 LET v12 = 72
+8590 LET v12 = v12 * 3 + 4
+8600 LET t = t + v12 / 7
+8610 IF t < 0 THEN 8620
+8620 LET v13 = 76
+8630 LET v13 = v13 * 3 + 8
+8640 LET t = t + v13 / 7
+8650 IF t < 0 THEN 8660
+8660 LET v14 = 80
+8670 LET v14 = v14 * 3 + 12
+8680 LET t = t + v14 / 7
+8690 IF t < 0 THEN 8700
+8700 LET v15 = 84
+8710 LET v15 = v15 * 3 + 3
+8720 LET t = t + v15 / 7
+8730 IF t < 0 THEN 8740
+8740 LET v16 = 88
+8750 LET v16 = v16 * 3 + 7
+8760 LET t = t + v16 / 7
+8770 IF t < 0 THEN 8780
+8780 LET v17 = 92
+8790 LET v17 = v17 * 3 + 11
+8800 LET t = t + v17 / 7
+8810 IF t < 0 THEN 8820
+8820 LET v18 = 96
+8830 LET v18 = v18 * 3 + 2
+8840 LET t = t + v18 / 7
+8850 IF t < 0 THEN 8860
+8860 LET v19 = 3
+8870 LET v19 = v19 * 3 + 6
+8880 LET t = t + v19 / 7
+8890 IF t < 0 THEN 8900
+8900 LET v20 = 7
+8910 LET v20 = v20 * 3 + 10
+8920 LET t = t + v20 / 7
+8930 IF t < 0 THEN 8940
+8940 LET v21 = 11
+8950 LET v21 = v21 * 3 + 1
+8960 LET t = t + v21 / 7
+8970 IF t < 0 THEN 8980
+8980 LET v22 = 15
+8990 LET v22 = v22 * 3 + 5
+9000 LET t = t + v22 / 7
+9010 IF t < 0 THEN 9020
+9020 LET v23 = 19
+9030 LET v23 = v23 * 3 + 9
+9040 LET t = t + v23 / 7
+9050 IF t < 0 THEN 9060
+9060 LET v24 = 23
+9070 LET v24 = v24 * 3 + 0
+9080 LET t = t + v24 / 7
+9090 IF t < 0 THEN 9100
+9100 LET v25 = 27
+9110 LET v25 = v25 * 3 + 4
+9120 LET t = t + v25 / 7
+9130 IF t < 0 THEN 9140
+9140 LET v26 = 31
+9150 LET v26 = v26 * 3 + 8
+9160 LET t = t + v26 / 7
+9170 IF t < 0 THEN 9180
+9180 LET v27 = 35
+9190 LET v27 = v27 * 3 + 12
+9200 LET t = t + v27 / 7
+9210 IF t < 0 THEN 9220
+9220 LET v28 = 39
+9230 LET v28 = v28 * 3 + 3
+9240 LET t = t + v28 / 7
+9250 IF t < 0 THEN 9260
+9260 LET v29 = 43
+9270 LET v29 = v29 * 3 + 7
+9280 LET t = t + v29 / 7
+9290 IF t < 0 THEN 9300
+9300 LET v30 = 47
+9310 LET v30 = v30 * 3 + 11
+9320 LET t = t + v30 / 7
+9330 IF t < 0 THEN 9340
+9340 LET v31 = 51
+9350 LET v31 = v31 * 3 + 2
+9360 LET t = t + v31 / 7
+9370 IF t < 0 THEN 9380
+9380 LET v32 = 55
+9390 LET v32 = v32 * 3 + 6
+9400 LET t = t + v32 / 7
+9410 IF t < 0 THEN 9420
+9420 LET v33 = 59
+9430 LET v33 = v33 * 3 + 10
+9440 LET t = t + v33 / 7
+9450 IF t < 0 THEN 9460
+9460 LET v34 = 63
+9470 LET v34 = v34 * 3 + 1
+9480 LET t = t + v34 / 7
+9490 IF t < 0 THEN 9500
+9500 LET v35 = 67
+9510 LET v35 = v35 * 3 + 5
+9520 LET t = t + v35 / 7
+9530 IF t < 0 THEN 9540
+9540 LET v36 = 71
+9550 LET v36 = v36 * 3 + 9
+9560 LET t = t + v36 / 7
+9570 IF t < 0 THEN 9580
+9580 LET v37 = 75
+9590 LET v37 = v37 * 3 + 0
+9600 LET t = t + v37 / 7
+9610 IF t < 0 THEN 9620
+9620 LET v38 = 79
+9630 LET v38 = v38 * 3 + 4
+9640 LET t = t + v38 / 7
+9650 IF t < 0 THEN 9660
+9660 LET v39 = 83
+9670 LET v39 = v39 * 3 + 8
+9680 LET t = t + v39 / 7
+9690 IF t < 0 THEN 9700
+9700 LET v40 = 87
+9710 LET v40 = v40 * 3 + 12
+9720 LET t = t + v40 / 7
+9730 IF t < 0 THEN 9740
+9740 LET v41 = 91
+9750 LET v41 = v41 * 3 + 3
+9760 LET t = t + v41 / 7
+9770 IF t < 0 THEN 9780
+9780 LET v42 = 95
+9790 LET v42 = v42 * 3 + 7
+9800 LET t = t + v42 / 7
+9810 IF t < 0 THEN 9820
+9820 LET v43 = 2
+9830 LET v43 = v43 * 3 + 11
+9840 LET t = t + v43 / 7
+9850 IF t < 0 THEN 9860
+9860 LET v44 = 6
+9870 LET v44 = v44 * 3 + 2
+9880 LET t = t + v44 / 7
+9890 IF t < 0 THEN 9900
+9900 LET v45 = 10
+9910 LET v45 = v45 * 3 + 6
+9920 LET t = t + v45 / 7
+9930 IF t < 0 THEN 9940
+9940 LET v46 = 14
+9950 LET v46 = v46 * 3 + 10
+9960 LET t = t + v46 / 7
+9970 IF t < 0 THEN 9980
+9980 LET v47 = 18
+9990 LET v47 = v47 * 3 + 1
+10000 LET t = t + v47 / 7
+10010 IF t < 0 THEN 10020
+10020 LET v48 = 22
+10030 LET v48 = v48 * 3 + 5
+10040 LET t = t + v48 / 7
+10050 IF t < 0 THEN 10060
+10060 LET v49 = 26
+10070 LET v49 = v49 * 3 + 9
+10080 LET t = t + v49 / 7
+10090 IF t < 0 THEN 10100
+10100 LET v0 = 30
+10110 LET v0 = v0 * 3 + 0
+10120 LET t = t + v0 / 7
+10130 IF t < 0 THEN 10140
+10140 LET v1 = 34
+10150 LET v1 = v1 * 3 + 4
+10160 LET t = t + v1 / 7
+10170 IF t < 0 THEN 10180
+10180 LET v2 = 38
+10190 LET v2 = v2 * 3 + 8
+10200 LET t = t + v2 / 7
+10210 IF t < 0 THEN 10220
+10220 LET v3 = 42
+10230 LET v3 = v3 * 3 + 12
+10240 LET t = t + v3 / 7
+10250 IF t < 0 THEN 10260
+10260 LET v4 = 46
+10270 LET v4 = v4 * 3 + 3
+10280 LET t = t + v4 / 7
+10290 IF t < 0 THEN 10300
+10300 LET v5 = 50
+10310 LET v5 = v5 * 3 + 7
+10320 LET t = t + v5 / 7
+10330 IF t < 0 THEN 10340
+10340 LET v6 = 54
+10350 LET v6 = v6 * 3 + 11
+10360 LET t = t + v6 / 7
+10370 IF t < 0 THEN 10380
+10380 LET v7 = 58
+10390 LET v7 = v7 * 3 + 2
+10400 LET t = t + v7 / 7
+10410 IF t < 0 THEN 10420
+10420 LET v8 = 62
+10430 LET v8 = v8 * 3 + 6
+10440 LET t = t + v8 / 7
+10450 IF t < 0 THEN 10460
+10460 LET v9 = 66
+10470 LET v9 = v9 * 3 + 10
+10480 LET t = t + v9 / 7
+10490 IF t < 0 THEN 10500
+10500 LET v10 = 70
+10510 LET v10 = v10 * 3 + 1
+10520 LET t = t + v10 / 7
+10530 IF t < 0 THEN 10540
+10540 LET v11 = 74
+10550 LET v11 = v11 * 3 + 5
+10560 LET t = t + v11 / 7
+10570 IF t < 0 THEN 10580
+10580 LET v12 = 78
+10590 LET v12 = v12 * 3 + 9
+10600 LET t = t + v12 / 7
+10610 IF t < 0 THEN 10620
+10620 LET v13 = 82
+10630 LET v13 = v13 * 3 + 0
+10640 LET t = t + v13 / 7
+10650 IF t < 0 THEN 10660
+10660 LET v14 = 86
+10670 LET v14 = v14 * 3 + 4
+10680 LET t = t + v14 / 7
+10690 IF t < 0 THEN 10700
+10700 LET v15 = 90
+10710 LET v15 = v15 * 3 + 8
+10720 LET t = t + v15 / 7
+10730 IF t < 0 THEN 10740
+10740 LET v16 = 94
+10750 LET v16 = v16 * 3 + 12
+10760 LET t = t + v16 / 7
+10770 IF t < 0 THEN 10780
+10780 LET v17 = 1
+10790 LET v17 = v17 * 3 + 3
+10800 LET t = t + v17 / 7
+10810 IF t < 0 THEN 10820
+10820 LET v18 = 5
+10830 LET v18 = v18 * 3 + 7
+10840 LET t = t + v18 / 7
+10850 IF t < 0 THEN 10860
+10860 LET v19 = 9
+10870 LET v19 = v19 * 3 + 11
+10880 LET t = t + v19 / 7
+10890 IF t < 0 THEN 10900
+10900 LET v20 = 13
+10910 LET v20 = v20 * 3 + 2
+10920 LET t = t + v20 / 7
+10930 IF t < 0 THEN 10940
+10940 LET v21 = 17
+10950 LET v21 = v21 * 3 + 6
+10960 LET t = t + v21 / 7
+10970 IF t < 0 THEN 10980
+10980 LET v22 = 21
+10990 LET v22 = v22 * 3 + 10
+11000 LET t = t + v22 / 7
+11010 IF t < 0 THEN 11020
+11020 LET v23 = 25
+11030 LET v23 = v23 * 3 + 1
+11040 LET t = t + v23 / 7
+11050 IF t < 0 THEN 11060
+11060 LET v24 = 29
+11070 LET v24 = v24 * 3 + 5
+11080 LET t = t + v24 / 7
+11090 IF t < 0 THEN 11100
+11100 LET v25 = 33
+11110 LET v25 = v25 * 3 + 9
+11120 LET t = t + v25 / 7
+11130 IF t < 0 THEN 11140
+11140 LET v26 = 37
+11150 LET v26 = v26 * 3 + 0
+11160 LET t = t + v26 / 7
+11170 IF t < 0 THEN 11180
+11180 LET v27 = 41
+11190 LET v27 = v27 * 3 + 4
+11200 LET t = t + v27 / 7
+11210 IF t < 0 THEN 11220
+11220 LET v28 = 45
+11230 LET v28 = v28 * 3 + 8
+11240 LET t = t + v28 / 7
+11250 IF t < 0 THEN 11260
+11260 LET v29 = 49
+11270 LET v29 = v29 * 3 + 12
+11280 LET t = t + v29 / 7
+11290 IF t < 0 THEN 11300
+11300 LET v30 = 53
+11310 LET v30 = v30 * 3 + 3
+11320 LET t = t + v30 / 7
+11330 IF t < 0 THEN 11340
+11340 LET v31 = 57
+11350 LET v31 = v31 * 3 + 7
+11360 LET t = t + v31 / 7
+11370 IF t < 0 THEN 11380
+11380 LET v32 = 61
+11390 LET v32 = v32 * 3 + 11
+11400 LET t = t + v32 / 7
+11410 IF t < 0 THEN 11420
+11420 LET v33 = 65
+11430 LET v33 = v33 * 3 + 2
+11440 LET t = t + v33 / 7
+11450 IF t < 0 THEN 11460
+11460 LET v34 = 69
+11470 LET v34 = v34 * 3 + 6
+11480 LET t = t + v34 / 7
+11490 IF t < 0 THEN 11500
+11500 LET v35 = 73
+11510 LET v35 = v35 * 3 + 10
+11520 LET t = t + v35 / 7
+11530 IF t < 0 THEN 11540
+11540 LET v36 = 77
+11550 LET v36 = v36 * 3 + 1
+11560 LET t = t + v36 / 7
+11570 IF t < 0 THEN 11580
+11580 LET v37 = 81
+11590 LET v37 = v37 * 3 + 5
+11600 LET t = t + v37 / 7
+11610 IF t < 0 THEN 11620
+11620 LET v38 = 85
+11630 LET v38 = v38 * 3 + 9
+11640 LET t = t + v38 / 7
+11650 IF t < 0 THEN 11660
+11660 LET v39 = 89
+11670 LET v39 = v39 * 3 + 0
+11680 LET t = t + v39 / 7
+11690 IF t < 0 THEN 11700
+11700 LET v40 = 93
+11710 LET v40 = v40 * 3 + 4
+11720 LET t = t + v40 / 7
+11730 IF t < 0 THEN 11740
+11740 LET v41 = 0
+11750 LET v41 = v41 * 3 + 8
+11760 LET t = t + v41 / 7
+11770 IF t < 0 THEN 11780
+11780 LET v42 = 4
+11790 LET v42 = v42 * 3 + 12
+11800 LET t = t + v42 / 7
+11810 IF t < 0 THEN 11820
+11820 LET v43 = 8
+11830 LET v43 = v43 * 3 + 3
+11840 LET t = t + v43 / 7
+11850 IF t < 0 THEN 11860
+11860 LET v44 = 12
+11870 LET v44 = v44 * 3 + 7
+11880 LET t = t + v44 / 7
+11890 IF t < 0 THEN 11900
+11900 LET v45 = 16
+11910 LET v45 = v45 * 3 + 11
+11920 LET t = t + v45 / 7
+11930 IF t < 0 THEN 11940
+11940 LET v46 = 20
+11950 LET v46 = v46 * 3 + 2
+11960 LET t = t + v46 / 7
+11970 IF t < 0 THEN 11980
+11980 LET v47 = 24
+11990 LET v47 = v47 * 3 + 6
+12000 LET t = t + v47 / 7
+12010 IF t < 0 THEN 12020
+12020 LET v48 = 28
+12030 LET v48 = v48 * 3 + 10
+12040 LET t = t + v48 / 7
+12050 IF t < 0 THEN 12060
+12060 LET v49 = 32
+12070 LET v49 = v49 * 3 + 1
+12080 LET t = t + v49 / 7
+12090 IF t < 0 THEN 12100
+12100 LET v0 = 36
+12110 LET v0 = v0 * 3 + 5
+12120 LET t = t + v0 / 7
+12130 IF t < 0 THEN 12140
+12140 LET v1 = 40
+12150 LET v1 = v1 * 3 + 9
+12160 LET t = t + v1 / 7
+12170 IF t < 0 THEN 12180
+12180 LET v2 = 44
+12190 LET v2 = v2 * 3 + 0
+12200 LET t = t + v2 / 7
+12210 IF t < 0 THEN 12220
+12220 LET v3 = 48
+12230 LET v3 = v3 * 3 + 4
+12240 LET t = t + v3 / 7
+12250 IF t < 0 THEN 12260
+12260 LET v4 = 52
+12270 LET v4 = v4 * 3 + 8
+12280 LET t = t + v4 / 7
+12290 IF t < 0 THEN 12300
+12300 LET v5 = 56
+12310 LET v5 = v5 * 3 + 12
+12320 LET t = t + v5 / 7
+12330 IF t < 0 THEN 12340
+12340 LET v6 = 60
+12350 LET v6 = v6 * 3 + 3
+12360 LET t = t + v6 / 7
+12370 IF t < 0 THEN 12380
+12380 LET v7 = 64
+12390 LET v7 = v7 * 3 + 7
+12400 LET t = t + v7 / 7
+12410 IF t < 0 THEN 12420
+12420 LET v8 = 68
+12430 LET v8 = v8 * 3 + 11
+12440 LET t = t + v8 / 7
+12450 IF t < 0 THEN 12460
+12460 LET v9 = 72
+12470 LET v9 = v9 * 3 + 2
+12480 LET t = t + v9 / 7
+12490 IF t < 0 THEN 12500
+12500 LET v10 = 76
+12510 LET v10 = v10 * 3 + 6
+12520 LET t = t + v10 / 7
+12530 IF t < 0 THEN 12540
+12540 LET v11 = 80
+12550 LET v11 = v11 * 3 + 10
+12560 LET t = t + v11 / 7
+12570 IF t < 0 THEN 12580
+12580 LET v12 = 84
+12590 LET v12 = v12 * 3 + 1
+12600 LET t = t + v12 / 7
+12610 IF t < 0 THEN 12620
+12620 LET v13 = 88
+12630 LET v13 = v13 * 3 + 5
+12640 LET t = t + v13 / 7
+12650 IF t < 0 THEN 12660
+12660 LET v14 = 92
+12670 LET v14 = v14 * 3 + 9
+12680 LET t = t + v14 / 7
+12690 IF t < 0 THEN 12700
+12700 LET v15 = 96
+12710 LET v15 = v15 * 3 + 0
+12720 LET t = t + v15 / 7
+12730 IF t < 0 THEN 12740
+12740 LET v16 = 3
+12750 LET v16 = v16 * 3 + 4
+12760 LET t = t + v16 / 7
+12770 IF t < 0 THEN 12780
+12780 LET v17 = 7
+12790 LET v17 = v17 * 3 + 8
+12800 LET t = t + v17 / 7
+12810 IF t < 0 THEN 12820
+12820 LET v18 = 11
+12830 LET v18 = v18 * 3 + 12
+12840 LET t = t + v18 / 7
+12850 IF t < 0 THEN 12860
+12860 LET v19 = 15
+12870 LET v19 = v19 * 3 + 3
+12880 LET t = t + v19 / 7
+12890 IF t < 0 THEN 12900
+12900 LET v20 = 19
+12910 LET v20 = v20 * 3 + 7
+12920 LET t = t + v20 / 7
+12930 IF t < 0 THEN 12940
+12940 LET v21 = 23
+12950 LET v21 = v21 * 3 + 11
+12960 LET t = t + v21 / 7
+12970 IF t < 0 THEN 12980
+12980 LET v22 = 27
+12990 LET v22 = v22 * 3 + 2
+13000 LET t = t + v22 / 7
+13010 IF t < 0 THEN 13020
+13020 LET v23 = 31
+13030 LET v23 = v23 * 3 + 6
+13040 LET t = t + v23 / 7
+13050 IF t < 0 THEN 13060
+13060 LET v24 = 35
+13070 LET v24 = v24 * 3 + 10
+13080 LET t = t + v24 / 7
+13090 IF t < 0 THEN 13100
+13100 LET v25 = 39
+13110 LET v25 = v25 * 3 + 1
+13120 LET t = t + v25 / 7
+13130 IF t < 0 THEN 13140
+13140 LET v26 = 43
+13150 LET v26 = v26 * 3 + 5
+13160 LET t = t + v26 / 7
+13170 IF t < 0 THEN 13180
+13180 LET v27 = 47
+13190 LET v27 = v27 * 3 + 9
+13200 LET t = t + v27 / 7
+13210 IF t < 0 THEN 13220
+13220 LET v28 = 51
+13230 LET v28 = v28 * 3 + 0
+13240 LET t = t + v28 / 7
+13250 IF t < 0 THEN 13260
+13260 LET v29 = 55
+13270 LET v29 = v29 * 3 + 4
+13280 LET t = t + v29 / 7
+13290 IF t < 0 THEN 13300
+13300 LET v30 = 59
+13310 LET v30 = v30 * 3 + 8
+13320 LET t = t + v30 / 7
+13330 IF t < 0 THEN 13340
+13340 LET v31 = 63
+13350 LET v31 = v31 * 3 + 12
+13360 LET t = t + v31 / 7
+13370 IF t < 0 THEN 13380
+13380 LET v32 = 67
+13390 LET v32 = v32 * 3 + 3
+13400 LET t = t + v32 / 7
+13410 IF t < 0 THEN 13420
+13420 LET v33 = 71
+13430 LET v33 = v33 * 3 + 7
+13440 LET t = t + v33 / 7
+13450 IF t < 0 THEN 13460
+13460 LET v34 = 75
+13470 LET v34 = v34 * 3 + 11
+13480 LET t = t + v34 / 7
+13490 IF t < 0 THEN 13500
+13500 LET v35 = 79
+13510 LET v35 = v35 * 3 + 2
+13520 LET t = t + v35 / 7
+13530 IF t < 0 THEN 13540
+13540 LET v36 = 83
+13550 LET v36 = v36 * 3 + 6
+13560 LET t = t + v36 / 7
+13570 IF t < 0 THEN 13580
+13580 LET v37 = 87
+13590 LET v37 = v37 * 3 + 10
+13600 LET t = t + v37 / 7
+13610 IF t < 0 THEN 13620
+13620 LET v38 = 91
+13630 LET v38 = v38 * 3 + 1
+13640 LET t = t + v38 / 7
+13650 IF t < 0 THEN 13660
+13660 LET v39 = 95
+13670 LET v39 = v39 * 3 + 5
+13680 LET t = t + v39 / 7
+13690 IF t < 0 THEN 13700
+13700 LET v40 = 2
+13710 LET v40 = v40 * 3 + 9
+13720 LET t = t + v40 / 7
+13730 IF t < 0 THEN 13740
+13740 LET v41 = 6
+13750 LET v41 = v41 * 3 + 0
+13760 LET t = t + v41 / 7
+13770 IF t < 0 THEN 13780
+13780 LET v42 = 10
+13790 LET v42 = v42 * 3 + 4
+13800 LET t = t + v42 / 7
+13810 IF t < 0 THEN 13820
+13820 LET v43 = 14
+13830 LET v43 = v43 * 3 + 8
+13840 LET t = t + v43 / 7
+13850 IF t < 0 THEN 13860
+13860 LET v44 = 18
+13870 LET v44 = v44 * 3 + 12
+13880 LET t = t + v44 / 7
+13890 IF t < 0 THEN 13900
+13900 LET v45 = 22
+13910 LET v45 = v45 * 3 + 3
+13920 LET t = t + v45 / 7
+13930 IF t < 0 THEN 13940
+13940 LET v46 = 26
+13950 LET v46 = v46 * 3 + 7
+13960 LET t = t + v46 / 7
+13970 IF t < 0 THEN 13980
+13980 LET v47 = 30
+13990 LET v47 = v47 * 3 + 11
+14000 LET t = t + v47 / 7
+14010 IF t < 0 THEN 14020
+14020 LET v48 = 34
+14030 LET v48 = v48 * 3 + 2
+14040 LET t = t + v48 / 7
+14050 IF t < 0 THEN 14060
+14060 LET v49 = 38
+14070 LET v49 = v49 * 3 + 6
+14080 LET t = t + v49 / 7
+14090 IF t < 0 THEN 14100
+14100 LET v0 = 42
+14110 LET v0 = v0 * 3 + 10
+14120 LET t = t + v0 / 7
+14130 IF t < 0 THEN 14140
+14140 LET v1 = 46
+14150 LET v1 = v1 * 3 + 1
+14160 LET t = t + v1 / 7
+14170 IF t < 0 THEN 14180
+14180 LET v2 = 50
+14190 LET v2 = v2 * 3 + 5
+14200 LET t = t + v2 / 7
+14210 IF t < 0 THEN 14220
+14220 LET v3 = 54
+14230 LET v3 = v3 * 3 + 9
+14240 LET t = t + v3 / 7
+14250 IF t < 0 THEN 14260
+14260 LET v4 = 58
+14270 LET v4 = v4 * 3 + 0
+14280 LET t = t + v4 / 7
+14290 IF t < 0 THEN 14300
+14300 LET v5 = 62
+14310 LET v5 = v5 * 3 + 4
+14320 LET t = t + v5 / 7
+14330 IF t < 0 THEN 14340
+14340 LET v6 = 66
+14350 LET v6 = v6 * 3 + 8
+14360 LET t = t + v6 / 7
+14370 IF t < 0 THEN 14380
+14380 LET v7 = 70
+14390 LET v7 = v7 * 3 + 12
+14400 LET t = t + v7 / 7
+14410 IF t < 0 THEN 14420
+14420 LET v8 = 74
+14430 LET v8 = v8 * 3 + 3
+14440 LET t = t + v8 / 7
+14450 IF t < 0 THEN 14460
+14460 LET v9 = 78
+14470 LET v9 = v9 * 3 + 7
+14480 LET t = t + v9 / 7
+14490 IF t < 0 THEN 14500
+14500 LET v10 = 82
+14510 LET v10 = v10 * 3 + 11
+14520 LET t = t + v10 / 7
+14530 IF t < 0 THEN 14540
+14540 LET v11 = 86
+14550 LET v11 = v11 * 3 + 2
+14560 LET t = t + v11 / 7
+14570 IF t < 0 THEN 14580
+14580 LET v12 = 90
+14590 LET v12 = v12 * 3 + 6
+14600 LET t = t + v12 / 7
+14610 IF t < 0 THEN 14620
+14620 LET v13 = 94
+14630 LET v13 = v13 * 3 + 10
+14640 LET t = t + v13 / 7
+14650 IF t < 0 THEN 14660
+14660 LET v14 = 1
+14670 LET v14 = v14 * 3 + 1
+14680 LET t = t + v14 / 7
+14690 IF t < 0 THEN 14700
+14700 LET v15 = 5
+14710 LET v15 = v15 * 3 + 5
+14720 LET t = t + v15 / 7
+14730 IF t < 0 THEN 14740
+14740 LET v16 = 9
+14750 LET v16 = v16 * 3 + 9
+14760 LET t = t + v16 / 7
+14770 IF t < 0 THEN 14780
+14780 LET v17 = 13
+14790 LET v17 = v17 * 3 + 0
+14800 LET t = t + v17 / 7
+14810 IF t < 0 THEN 14820
+14820 LET v18 = 17
+14830 LET v18 = v18 * 3 + 4
+14840 LET t = t + v18 / 7
+14850 IF t < 0 THEN 14860
+14860 LET v19 = 21
+14870 LET v19 = v19 * 3 + 8
+14880 LET t = t + v19 / 7
+14890 IF t < 0 THEN 14900
+14900 LET v20 = 25
+14910 LET v20 = v20 * 3 + 12
+14920 LET t = t + v20 / 7
+14930 IF t < 0 THEN 14940
+14940 LET v21 = 29
+14950 LET v21 = v21 * 3 + 3
+14960 LET t = t + v21 / 7
+14970 IF t < 0 THEN 14980
+14980 LET v22 = 33
+14990 LET v22 = v22 * 3 + 7
+15000 LET t = t + v22 / 7
+15010 IF t < 0 THEN 15020
+15020 LET v23 = 37
+15030 LET v23 = v23 * 3 + 11
+15040 LET t = t + v23 / 7
+15050 IF t < 0 THEN 15060
+15060 LET v24 = 41
+15070 LET v24 = v24 * 3 + 2
+15080 LET t = t + v24 / 7
+15090 IF t < 0 THEN 15100
+15100 LET v25 = 45
+15110 LET v25 = v25 * 3 + 6
+15120 LET t = t + v25 / 7
+15130 IF t < 0 THEN 15140
+15140 LET v26 = 49
+15150 LET v26 = v26 * 3 + 10
+15160 LET t = t + v26 / 7
+15170 IF t < 0 THEN 15180
+15180 LET v27 = 53
+15190 LET v27 = v27 * 3 + 1
+15200 LET t = t + v27 / 7
+15210 IF t < 0 THEN 15220
+15220 LET v28 = 57
+15230 LET v28 = v28 * 3 + 5
+15240 LET t = t + v28 / 7
+15250 IF t < 0 THEN 15260
+15260 LET v29 = 61
+15270 LET v29 = v29 * 3 + 9
+15280 LET t = t + v29 / 7
+15290 IF t < 0 THEN 15300
+15300 LET v30 = 65
+15310 LET v30 = v30 * 3 + 0
+15320 LET t = t + v30 / 7
+15330 IF t < 0 THEN 15340
+15340 LET v31 = 69
+15350 LET v31 = v31 * 3 + 4
+15360 LET t = t + v31 / 7
+15370 IF t < 0 THEN 15380
+15380 LET v32 = 73
+15390 LET v32 = v32 * 3 + 8
+15400 LET t = t + v32 / 7
+15410 IF t < 0 THEN 15420
+15420 LET v33 = 77
+15430 LET v33 = v33 * 3 + 12
+15440 LET t = t + v33 / 7
+15450 IF t < 0 THEN 15460
+15460 LET v34 = 81
+15470 LET v34 = v34 * 3 + 3
+15480 LET t = t + v34 / 7
+15490 IF t < 0 THEN 15500
+15500 LET v35 = 85
+15510 LET v35 = v35 * 3 + 7
+15520 LET t = t + v35 / 7
+15530 IF t < 0 THEN 15540
+15540 LET v36 = 89
+15550 LET v36 = v36 * 3 + 11
+15560 LET t = t + v36 / 7
+15570 IF t < 0 THEN 15580
+15580 LET v37 = 93
+15590 LET v37 = v37 * 3 + 2
+15600 LET t = t + v37 / 7
+15610 IF t < 0 THEN 15620
+15620 LET v38 = 0
+15630 LET v38 = v38 * 3 + 6
+15640 LET t = t + v38 / 7
+15650 IF t < 0 THEN 15660
+15660 LET v39 = 4
+15670 LET v39 = v39 * 3 + 10
+15680 LET t = t + v39 / 7
+15690 IF t < 0 THEN 15700
+15700 LET v40 = 8
+15710 LET v40 = v40 * 3 + 1
+15720 LET t = t + v40 / 7
+15730 IF t < 0 THEN 15740
+15740 LET v41 = 12
+15750 LET v41 = v41 * 3 + 5
+15760 LET t = t + v41 / 7
+15770 IF t < 0 THEN 15780
+15780 LET v42 = 16
+15790 LET v42 = v42 * 3 + 9
+15800 LET t = t + v42 / 7
+15810 IF t < 0 THEN 15820
+15820 LET v43 = 20
+15830 LET v43 = v43 * 3 + 0
+15840 LET t = t + v43 / 7
+15850 IF t < 0 THEN 15860
+15860 LET v44 = 24
+15870 LET v44 = v44 * 3 + 4
+15880 LET t = t + v44 / 7
+15890 IF t < 0 THEN 15900
+15900 LET v45 = 28
+15910 LET v45 = v45 * 3 + 8
+15920 LET t = t + v45 / 7
+15930 IF t < 0 THEN 15940
+15940 LET v46 = 32
+15950 LET v46 = v46 * 3 + 12
+15960 LET t = t + v46 / 7
+15970 IF t < 0 THEN 15980
+15980 LET v47 = 36
+15990 LET v47 = v47 * 3 + 3
+16000 LET t = t + v47 / 7
+16010 IF t < 0 THEN 16020
+16020 LET v48 = 40
+16030 LET v48 = v48 * 3 + 7
+16040 LET t = t + v48 / 7
+16050 IF t < 0 THEN 16060
+16060 LET v49 = 44
+16070 LET v49 = v49 * 3 + 11
+16080 LET t = t + v49 / 7
+16090 IF t < 0 THEN 16100
+16100 LET v0 = 48
+16110 LET v0 = v0 * 3 + 2
+16120 LET t = t + v0 / 7
+16130 IF t < 0 THEN 16140
+16140 LET v1 = 52
+16150 LET v1 = v1 * 3 + 6
+16160 LET t = t + v1 / 7
+16170 IF t < 0 THEN 16180
+16180 LET v2 = 56
+16190 LET v2 = v2 * 3 + 10
+16200 LET t = t + v2 / 7
+16210 IF t < 0 THEN 16220
+16220 LET v3 = 60
+16230 LET v3 = v3 * 3 + 1
+16240 LET t = t + v3 / 7
+16250 IF t < 0 THEN 16260
+16260 LET v4 = 64
+16270 LET v4 = v4 * 3 + 5
+16280 LET t = t + v4 / 7
+16290 IF t < 0 THEN 16300
+16300 LET v5 = 68
+16310 LET v5 = v5 * 3 + 9
+16320 LET t = t + v5 / 7
+16330 IF t < 0 THEN 16340
+16340 LET v6 = 72
+16350 LET v6 = v6 * 3 + 0
+16360 LET t = t + v6 / 7
+16370 IF t < 0 THEN 16380
+16380 LET v7 = 76
+16390 LET v7 = v7 * 3 + 4
+16400 LET t = t + v7 / 7
+16410 IF t < 0 THEN 16420
+16420 LET v8 = 80
+16430 LET v8 = v8 * 3 + 8
+16440 LET t = t + v8 / 7
+16450 IF t < 0 THEN 16460
+16460 LET v9 = 84
+16470 LET v9 = v9 * 3 + 12
+16480 LET t = t + v9 / 7
+16490 IF t < 0 THEN 16500
+16500 LET v10 = 88
+16510 LET v10 = v10 * 3 + 3
+16520 LET t = t + v10 / 7
+16530 IF t < 0 THEN 16540
+16540 LET v11 = 92
+16550 LET v11 = v11 * 3 + 7
+16560 LET t = t + v11 / 7
+16570 IF t < 0 THEN 16580
+16580 LET v12 = 96
+16590 LET v12 = v12 * 3 + 11
+16600 LET t = t + v12 / 7
+16610 IF t < 0 THEN 16620
+16620 LET v13 = 3
+16630 LET v13 = v13 * 3 + 2
+16640 LET t = t + v13 / 7
+16650 IF t < 0 THEN 16660
+16660 LET v14 = 7
+16670 LET v14 = v14 * 3 + 6
+16680 LET t = t + v14 / 7
+16690 IF t < 0 THEN 16700
+16700 LET v15 = 11
+16710 LET v15 = v15 * 3 + 10
+16720 LET t = t + v15 / 7
+16730 IF t < 0 THEN 16740
+16740 LET v16 = 15
+16750 LET v16 = v16 * 3 + 1
+16760 LET t = t + v16 / 7
+16770 IF t < 0 THEN 16780
+16780 LET v17 = 19
+16790 LET v17 = v17 * 3 + 5
+16800 LET t = t + v17 / 7
+16810 IF t < 0 THEN 16820
+16820 LET v18 = 23
+16830 LET v18 = v18 * 3 + 9
+16840 LET t = t + v18 / 7
+16850 IF t < 0 THEN 16860
+16860 LET v19 = 27
+16870 LET v19 = v19 * 3 + 0
+16880 LET t = t + v19 / 7
+16890 IF t < 0 THEN 16900
+16900 LET v20 = 31
+16910 LET v20 = v20 * 3 + 4
+16920 LET t = t + v20 / 7
+16930 IF t < 0 THEN 16940
+16940 LET v21 = 35
+16950 LET v21 = v21 * 3 + 8
+16960 LET t = t + v21 / 7
+16970 IF t < 0 THEN 16980
+16980 LET v22 = 39
+16990 LET v22 = v22 * 3 + 12
+17000 LET t = t + v22 / 7
+17010 IF t < 0 THEN 17020
+17020 LET v23 = 43
+17030 LET v23 = v23 * 3 + 3
+17040 LET t = t + v23 / 7
+17050 IF t < 0 THEN 17060
+17060 LET v24 = 47
+17070 LET v24 = v24 * 3 + 7
+17080 LET t = t + v24 / 7
+17090 IF t < 0 THEN 17100
+17100 LET v25 = 51
+17110 LET v25 = v25 * 3 + 11
+17120 LET t = t + v25 / 7
+17130 IF t < 0 THEN 17140
+17140 LET v26 = 55
+17150 LET v26 = v26 * 3 + 2
+17160 LET t = t + v26 / 7
+17170 IF t < 0 THEN 17180
+17180 LET v27 = 59
+17190 LET v27 = v27 * 3 + 6
+17200 LET t = t + v27 / 7
+17210 IF t < 0 THEN 17220
+17220 LET v28 = 63
+17230 LET v28 = v28 * 3 + 10
+17240 LET t = t + v28 / 7
+17250 IF t < 0 THEN 17260
+17260 LET v29 = 67
+17270 LET v29 = v29 * 3 + 1
+17280 LET t = t + v29 / 7
+17290 IF t < 0 THEN 17300
+17300 LET v30 = 71
+17310 LET v30 = v30 * 3 + 5
+17320 LET t = t + v30 / 7
+17330 IF t < 0 THEN 17340
+17340 LET v31 = 75
+17350 LET v31 = v31 * 3 + 9
+17360 LET t = t + v31 / 7
+17370 IF t < 0 THEN 17380
+17380 LET v32 = 79
+17390 LET v32 = v32 * 3 + 0
+17400 LET t = t + v32 / 7
+17410 IF t < 0 THEN 17420
+17420 LET v33 = 83
+17430 LET v33 = v33 * 3 + 4
+17440 LET t = t + v33 / 7
+17450 IF t < 0 THEN 17460
+17460 LET v34 = 87
+17470 LET v34 = v34 * 3 + 8
+17480 LET t = t + v34 / 7
+17490 IF t < 0 THEN 17500
+17500 LET v35 = 91
+17510 LET v35 = v35 * 3 + 12
+17520 LET t = t + v35 / 7
+17530 IF t < 0 THEN 17540
+17540 LET v36 = 95
+17550 LET v36 = v36 * 3 + 3
+17560 LET t = t + v36 / 7
+17570 IF t < 0 THEN 17580
+17580 LET v37 = 2
+17590 LET v37 = v37 * 3 + 7
+17600 LET t = t + v37 / 7
+17610 IF t < 0 THEN 17620
+17620 LET v38 = 6
+17630 LET v38 = v38 * 3 + 11
+17640 LET t = t + v38 / 7
+17650 IF t < 0 THEN 17660
+17660 LET v39 = 10
+17670 LET v39 = v39 * 3 + 2
+17680 LET t = t + v39 / 7
+17690 IF t < 0 THEN 17700
+17700 LET v40 = 14
+17710 LET v40 = v40 * 3 + 6
+17720 LET t = t + v40 / 7
+17730 IF t < 0 THEN 17740
+17740 LET v41 = 18
+17750 LET v41 = v41 * 3 + 10
+17760 LET t = t + v41 / 7
+17770 IF t < 0 THEN 17780
+17780 LET v42 = 22
+17790 LET v42 = v42 * 3 + 1
+17800 LET t = t + v42 / 7
+17810 IF t < 0 THEN 17820
+17820 LET v43 = 26
+17830 LET v43 = v43 * 3 + 5
+17840 LET t = t + v43 / 7
+17850 IF t < 0 THEN 17860
+17860 LET v44 = 30
+17870 LET v44 = v44 * 3 + 9
+17880 LET t = t + v44 / 7
+17890 IF t < 0 THEN 17900
+17900 LET v45 = 34
+17910 LET v45 = v45 * 3 + 0
+17920 LET t = t + v45 / 7
+17930 IF t < 0 THEN 17940
+17940 LET v46 = 38
+17950 LET v46 = v46 * 3 + 4
+17960 LET t = t + v46 / 7
+17970 IF t < 0 THEN 17980
+17980 LET v47 = 42
+17990 LET v47 = v47 * 3 + 8
+18000 LET t = t + v47 / 7
+18010 IF t < 0 THEN 18020
+18020 LET v48 = 46
+18030 LET v48 = v48 * 3 + 12
+18040 LET t = t + v48 / 7
+18050 IF t < 0 THEN 18060
+18060 LET v49 = 50
+18070 LET v49 = v49 * 3 + 3
+18080 LET t = t + v49 / 7
+18090 IF t < 0 THEN 18100
+18100 LET v0 = 54
+18110 LET v0 = v0 * 3 + 7
+18120 LET t = t + v0 / 7
+18130 IF t < 0 THEN 18140
+18140 LET v1 = 58
+18150 LET v1 = v1 * 3 + 11
+18160 LET t = t + v1 / 7
+18170 IF t < 0 THEN 18180
+18180 LET v2 = 62
+18190 LET v2 = v2 * 3 + 2
+18200 LET t = t + v2 / 7
+18210 IF t < 0 THEN 18220
+18220 LET v3 = 66
+18230 LET v3 = v3 * 3 + 6
+18240 LET t = t + v3 / 7
+18250 IF t < 0 THEN 18260
+18260 LET v4 = 70
+18270 LET v4 = v4 * 3 + 10
+18280 LET t = t + v4 / 7
+18290 IF t < 0 THEN 18300
+18300 LET v5 = 74
+18310 LET v5 = v5 * 3 + 1
+18320 LET t = t + v5 / 7
+18330 IF t < 0 THEN 18340
+18340 LET v6 = 78
+18350 LET v6 = v6 * 3 + 5
+18360 LET t = t + v6 / 7
+18370 IF t < 0 THEN 18380
+18380 LET v7 = 82
+18390 LET v7 = v7 * 3 + 9
+18400 LET t = t + v7 / 7
+18410 IF t < 0 THEN 18420
+18420 LET v8 = 86
+18430 LET v8 = v8 * 3 + 0
+18440 LET t = t + v8 / 7
+18450 IF t < 0 THEN 18460
+18460 LET v9 = 90
+18470 LET v9 = v9 * 3 + 4
+18480 LET t = t + v9 / 7
+18490 IF t < 0 THEN 18500
+18500 LET v10 = 94
+18510 LET v10 = v10 * 3 + 8
+18520 LET t = t + v10 / 7
+18530 IF t < 0 THEN 18540
+18540 LET v11 = 1
+18550 LET v11 = v11 * 3 + 12
+18560 LET t = t + v11 / 7
+18570 IF t < 0 THEN 18580
+18580 LET v12 = 5
+18590 LET v12 = v12 * 3 + 3
+18600 LET t = t + v12 / 7
+18610 IF t < 0 THEN 18620
+18620 LET v13 = 9
+18630 LET v13 = v13 * 3 + 7
+18640 LET t = t + v13 / 7
+18650 IF t < 0 THEN 18660
+18660 LET v14 = 13
+18670 LET v14 = v14 * 3 + 11
+18680 LET t = t + v14 / 7
+18690 IF t < 0 THEN 18700
+18700 LET v15 = 17
+18710 LET v15 = v15 * 3 + 2
+18720 LET t = t + v15 / 7
+18730 IF t < 0 THEN 18740
+18740 LET v16 = 21
+18750 LET v16 = v16 * 3 + 6
+18760 LET t = t + v16 / 7
+18770 IF t < 0 THEN 18780
+18780 LET v17 = 25
+18790 LET v17 = v17 * 3 + 10
+18800 LET t = t + v17 / 7
+18810 IF t < 0 THEN 18820
+18820 LET v18 = 29
+18830 LET v18 = v18 * 3 + 1
+18840 LET t = t + v18 / 7
+18850 IF t < 0 THEN 18860
+18860 LET v19 = 33
+18870 LET v19 = v19 * 3 + 5
+18880 LET t = t + v19 / 7
+18890 IF t < 0 THEN 18900
+18900 LET v20 = 37
+18910 LET v20 = v20 * 3 + 9
+18920 LET t = t + v20 / 7
+18930 IF t < 0 THEN 18940
+18940 LET v21 = 41
+18950 LET v21 = v21 * 3 + 0
+18960 LET t = t + v21 / 7
+18970 IF t < 0 THEN 18980
+18980 LET v22 = 45
+18990 LET v22 = v22 * 3 + 4
+19000 LET t = t + v22 / 7
+19010 IF t < 0 THEN 19020
+19020 LET v23 = 49
+19030 LET v23 = v23 * 3 + 8
+19040 LET t = t + v23 / 7
+19050 IF t < 0 THEN 19060
+19060 LET v24 = 53
+19070 LET v24 = v24 * 3 + 12
+19080 LET t = t + v24 / 7
+19090 IF t < 0 THEN 19100
+19100 LET v25 = 57
+19110 LET v25 = v25 * 3 + 3
+19120 LET t = t + v25 / 7
+19130 IF t < 0 THEN 19140
+19140 LET v26 = 61
+19150 LET v26 = v26 * 3 + 7
+19160 LET t = t + v26 / 7
+19170 IF t < 0 THEN 19180
+19180 LET v27 = 65
+19190 LET v27 = v27 * 3 + 11
+19200 LET t = t + v27 / 7
+19210 IF t < 0 THEN 19220
+19220 LET v28 = 69
+19230 LET v28 = v28 * 3 + 2
+19240 LET t = t + v28 / 7
+19250 IF t < 0 THEN 19260
+19260 LET v29 = 73
+19270 LET v29 = v29 * 3 + 6
+19280 LET t = t + v29 / 7
+19290 IF t < 0 THEN 19300
+19300 LET v30 = 77
+19310 LET v30 = v30 * 3 + 10
+19320 LET t = t + v30 / 7
+19330 IF t < 0 THEN 19340
+19340 LET v31 = 81
+19350 LET v31 = v31 * 3 + 1
+19360 LET t = t + v31 / 7
+19370 IF t < 0 THEN 19380
+19380 LET v32 = 85
+19390 LET v32 = v32 * 3 + 5
+19400 LET t = t + v32 / 7
+19410 IF t < 0 THEN 19420
+19420 LET v33 = 89
+19430 LET v33 = v33 * 3 + 9
+19440 LET t = t + v33 / 7
+19450 IF t < 0 THEN 19460
+19460 LET v34 = 93
+19470 LET v34 = v34 * 3 + 0
+19480 LET t = t + v34 / 7
+19490 IF t < 0 THEN 19500
+19500 LET v35 = 0
+19510 LET v35 = v35 * 3 + 4
+19520 LET t = t + v35 / 7
+19530 IF t < 0 THEN 19540
+19540 LET v36 = 4
+19550 LET v36 = v36 * 3 + 8
+19560 LET t = t + v36 / 7
+19570 IF t < 0 THEN 19580
+19580 LET v37 = 8
+19590 LET v37 = v37 * 3 + 12
+19600 LET t = t + v37 / 7
+19610 IF t < 0 THEN 19620
+19620 LET v38 = 12
+19630 LET v38 = v38 * 3 + 3
+19640 LET t = t + v38 / 7
+19650 IF t < 0 THEN 19660
+19660 LET v39 = 16
+19670 LET v39 = v39 * 3 + 7
+19680 LET t = t + v39 / 7
+19690 IF t < 0 THEN 19700
+19700 LET v40 = 20
+19710 LET v40 = v40 * 3 + 11
+19720 LET t = t + v40 / 7
+19730 IF t < 0 THEN 19740
+19740 LET v41 = 24
+19750 LET v41 = v41 * 3 + 2
+19760 LET t = t + v41 / 7
+19770 IF t < 0 THEN 19780
+19780 LET v42 = 28
+19790 LET v42 = v42 * 3 + 6
+19800 LET t = t + v42 / 7
+19810 IF t < 0 THEN 19820
+19820 LET v43 = 32
+19830 LET v43 = v43 * 3 + 10
+19840 LET t = t + v43 / 7
+19850 IF t < 0 THEN 19860
+19860 LET v44 = 36
+19870 LET v44 = v44 * 3 + 1
+19880 LET t = t + v44 / 7
+19890 IF t < 0 THEN 19900
+19900 LET v45 = 40
+19910 LET v45 = v45 * 3 + 5
+19920 LET t = t + v45 / 7
+19930 IF t < 0 THEN 19940
+19940 LET v46 = 44
+19950 LET v46 = v46 * 3 + 9
+19960 LET t = t + v46 / 7
+19970 IF t < 0 THEN 19980
+19980 LET v47 = 48
+19990 LET v47 = v47 * 3 + 0
+20000 LET t = t + v47 / 7
+20010 IF t < 0 THEN 20020
+20020 LET v48 = 52
+20030 LET v48 = v48 * 3 + 4
+20040 LET t = t + v48 / 7
+20050 IF t < 0 THEN 20060
+20060 LET v49 = 56
+20070 LET v49 = v49 * 3 + 8
+20080 LET t = t + v49 / 7
+20090 IF t < 0 THEN 20100
+20100 LET v0 = 60
+20110 LET v0 = v0 * 3 + 12
+20120 LET t = t + v0 / 7
+20130 IF t < 0 THEN 20140
+20140 LET v1 = 64
+20150 LET v1 = v1 * 3 + 3
+20160 LET t = t + v1 / 7
+20170 IF t < 0 THEN 20180
+20180 LET v2 = 68
+20190 LET v2 = v2 * 3 + 7
+20200 LET t = t + v2 / 7
+20210 IF t < 0 THEN 20220
+20220 LET v3 = 72
+20230 LET v3 = v3 * 3 + 11
+20240 LET t = t + v3 / 7
+20250 IF t < 0 THEN 20260
+20260 LET v4 = 76
+20270 LET v4 = v4 * 3 + 2
+20280 LET t = t + v4 / 7
+20290 IF t < 0 THEN 20300
+20300 LET v5 = 80
+20310 LET v5 = v5 * 3 + 6
+20320 LET t = t + v5 / 7
+20330 IF t < 0 THEN 20340
+20340 LET v6 = 84
+20350 LET v6 = v6 * 3 + 10
+20360 LET t = t + v6 / 7
+20370 IF t < 0 THEN 20380
+20380 LET v7 = 88
+20390 LET v7 = v7 * 3 + 1
+20400 LET t = t + v7 / 7
+20410 IF t < 0 THEN 20420
+20420 LET v8 = 92
+20430 LET v8 = v8 * 3 + 5
+20440 LET t = t + v8 / 7
+20450 IF t < 0 THEN 20460
+20460 LET v9 = 96
+20470 LET v9 = v9 * 3 + 9
+20480 LET t = t + v9 / 7
+20490 IF t < 0 THEN 20500
+20500 LET v10 = 3
+20510 LET v10 = v10 * 3 + 0
+20520 LET t = t + v10 / 7
+20530 IF t < 0 THEN 20540
+20540 LET v11 = 7
+20550 LET v11 = v11 * 3 + 4
+20560 LET t = t + v11 / 7
+20570 IF t < 0 THEN 20580
+20580 LET v12 = 11
+20590 LET v12 = v12 * 3 + 8
+20600 LET t = t + v12 / 7
+20610 IF t < 0 THEN 20620
+20620 LET v13 = 15
+20630 LET v13 = v13 * 3 + 12
+20640 LET t = t + v13 / 7
+20650 IF t < 0 THEN 20660
+20660 LET v14 = 19
+20670 LET v14 = v14 * 3 + 3
+20680 LET t = t + v14 / 7
+20690 IF t < 0 THEN 20700
+20700 LET v15 = 23
+20710 LET v15 = v15 * 3 + 7
+20720 LET t = t + v15 / 7
+20730 IF t < 0 THEN 20740
+20740 LET v16 = 27
+20750 LET v16 = v16 * 3 + 11
+20760 LET t = t + v16 / 7
+20770 IF t < 0 THEN 20780
+20780 LET v17 = 31
+20790 LET v17 = v17 * 3 + 2
+20800 LET t = t + v17 / 7
+20810 IF t < 0 THEN 20820
+20820 LET v18 = 35
+20830 LET v18 = v18 * 3 + 6
+20840 LET t = t + v18 / 7
+20850 IF t < 0 THEN 20860
+20860 LET v19 = 39
+20870 LET v19 = v19 * 3 + 10
+20880 LET t = t + v19 / 7
+20890 IF t < 0 THEN 20900
+20900 LET v20 = 43
+20910 LET v20 = v20 * 3 + 1
+20920 LET t = t + v20 / 7
+20930 IF t < 0 THEN 20940
+20940 LET v21 = 47
+20950 LET v21 = v21 * 3 + 5
+20960 LET t = t + v21 / 7
+20970 IF t < 0 THEN 20980
+20980 LET v22 = 51
+20990 LET v22 = v22 * 3 + 9
+21000 LET t = t + v22 / 7
+21010 IF t < 0 THEN 21020
+21020 LET v23 = 55
+21030 LET v23 = v23 * 3 + 0
+21040 LET t = t + v23 / 7
+21050 IF t < 0 THEN 21060
+21060 LET v24 = 59
+21070 LET v24 = v24 * 3 + 4
+21080 LET t = t + v24 / 7
+21090 IF t < 0 THEN 21100
+21100 LET v25 = 63
+21110 LET v25 = v25 * 3 + 8
+21120 LET t = t + v25 / 7
+21130 IF t < 0 THEN 21140
+21140 LET v26 = 67
+21150 LET v26 = v26 * 3 + 12
+21160 LET t = t + v26 / 7
+21170 IF t < 0 THEN 21180
+21180 LET v27 = 71
+21190 LET v27 = v27 * 3 + 3
+21200 LET t = t + v27 / 7
+21210 IF t < 0 THEN 21220
+21220 LET v28 = 75
+21230 LET v28 = v28 * 3 + 7
+21240 LET t = t + v28 / 7
+21250 IF t < 0 THEN 21260
+21260 LET v29 = 79
+21270 LET v29 = v29 * 3 + 11
+21280 LET t = t + v29 / 7
+21290 IF t < 0 THEN 21300
+21300 LET v30 = 83
+21310 LET v30 = v30 * 3 + 2
+21320 LET t = t + v30 / 7
+21330 IF t < 0 THEN 21340
+21340 LET v31 = 87
+21350 LET v31 = v31 * 3 + 6
+21360 LET t = t + v31 / 7
+21370 IF t < 0 THEN 21380
+21380 LET v32 = 91
+21390 LET v32 = v32 * 3 + 10
+21400 LET t = t + v32 / 7
+21410 IF t < 0 THEN 21420
+21420 LET v33 = 95
+21430 LET v33 = v33 * 3 + 1
+21440 LET t = t + v33 / 7
+21450 IF t < 0 THEN 21460
+21460 LET v34 = 2
+21470 LET v34 = v34 * 3 + 5
+21480 LET t = t + v34 / 7
+21490 IF t < 0 THEN 21500
+21500 LET v35 = 6
+21510 LET v35 = v35 * 3 + 9
+21520 LET t = t + v35 / 7
+21530 IF t < 0 THEN 21540
+21540 LET v36 = 10
+21550 LET v36 = v36 * 3 + 0
+21560 LET t = t + v36 / 7
+21570 IF t < 0 THEN 21580
+21580 LET v37 = 14
+21590 LET v37 = v37 * 3 + 4
+21600 LET t = t + v37 / 7
+21610 IF t < 0 THEN 21620
+21620 LET v38 = 18
+21630 LET v38 = v38 * 3 + 8
+21640 LET t = t + v38 / 7
+21650 IF t < 0 THEN 21660
+21660 LET v39 = 22
+21670 LET v39 = v39 * 3 + 12
+21680 LET t = t + v39 / 7
+21690 IF t < 0 THEN 21700
+21700 LET v40 = 26
+21710 LET v40 = v40 * 3 + 3
+21720 LET t = t + v40 / 7
+21730 IF t < 0 THEN 21740
+21740 LET v41 = 30
+21750 LET v41 = v41 * 3 + 7
+21760 LET t = t + v41 / 7
+21770 IF t < 0 THEN 21780
+21780 LET v42 = 34
+21790 LET v42 = v42 * 3 + 11
+21800 LET t = t + v42 / 7
+21810 IF t < 0 THEN 21820
+21820 LET v43 = 38
+21830 LET v43 = v43 * 3 + 2
+21840 LET t = t + v43 / 7
+21850 IF t < 0 THEN 21860
+21860 LET v44 = 42
+21870 LET v44 = v44 * 3 + 6
+21880 LET t = t + v44 / 7
+21890 IF t < 0 THEN 21900
+21900 LET v45 = 46
+21910 LET v45 = v45 * 3 + 10
+21920 LET t = t + v45 / 7
+21930 IF t < 0 THEN 21940
+21940 LET v46 = 50
+21950 LET v46 = v46 * 3 + 1
+21960 LET t = t + v46 / 7
+21970 IF t < 0 THEN 21980
+21980 LET v47 = 54
+21990 LET v47 = v47 * 3 + 5
+22000 LET t = t + v47 / 7
+22010 IF t < 0 THEN 22020
+22020 LET v48 = 58
+22030 LET v48 = v48 * 3 + 9
+22040 LET t = t + v48 / 7
+22050 IF t < 0 THEN 22060
+22060 LET v49 = 62
+22070 LET v49 = v49 * 3 + 0
+22080 LET t = t + v49 / 7
+22090 IF t < 0 THEN 22100
+22100 LET v0 = 66
+22110 LET v0 = v0 * 3 + 4
+22120 LET t = t + v0 / 7
+22130 IF t < 0 THEN 22140
+22140 LET v1 = 70
+22150 LET v1 = v1 * 3 + 8
+22160 LET t = t + v1 / 7
+22170 IF t < 0 THEN 22180
+22180 LET v2 = 74
+22190 LET v2 = v2 * 3 + 12
+22200 LET t = t + v2 / 7
+22210 IF t < 0 THEN 22220
+22220 LET v3 = 78
+22230 LET v3 = v3 * 3 + 3
+22240 LET t = t + v3 / 7
+22250 IF t < 0 THEN 22260
+22260 LET v4 = 82
+22270 LET v4 = v4 * 3 + 7
+22280 LET t = t + v4 / 7
+22290 IF t < 0 THEN 22300
+22300 LET v5 = 86
+22310 LET v5 = v5 * 3 + 11
+22320 LET t = t + v5 / 7
+22330 IF t < 0 THEN 22340
+22340 LET v6 = 90
+22350 LET v6 = v6 * 3 + 2
+22360 LET t = t + v6 / 7
+22370 IF t < 0 THEN 22380
+22380 LET v7 = 94
+22390 LET v7 = v7 * 3 + 6
+22400 LET t = t + v7 / 7
+22410 IF t < 0 THEN 22420
+22420 LET v8 = 1
+22430 LET v8 = v8 * 3 + 10
+22440 LET t = t + v8 / 7
+22450 IF t < 0 THEN 22460
+22460 LET v9 = 5
+22470 LET v9 = v9 * 3 + 1
+22480 LET t = t + v9 / 7
+22490 IF t < 0 THEN 22500
+22500 LET v10 = 9
+22510 LET v10 = v10 * 3 + 5
+22520 LET t = t + v10 / 7
+22530 IF t < 0 THEN 22540
+22540 LET v11 = 13
+22550 LET v11 = v11 * 3 + 9
+22560 LET t = t + v11 / 7
+22570 IF t < 0 THEN 22580
+22580 LET v12 = 17
+22590 LET v12 = v12 * 3 + 0
+22600 LET t = t + v12 / 7
+22610 IF t < 0 THEN 22620
+22620 LET v13 = 21
+22630 LET v13 = v13 * 3 + 4
+22640 LET t = t + v13 / 7
+22650 IF t < 0 THEN 22660
+22660 LET v14 = 25
+22670 LET v14 = v14 * 3 + 8
+22680 LET t = t + v14 / 7
+22690 IF t < 0 THEN 22700
+22700 LET v15 = 29
+22710 LET v15 = v15 * 3 + 12
+22720 LET t = t + v15 / 7
+22730 IF t < 0 THEN 22740
+22740 LET v16 = 33
+22750 LET v16 = v16 * 3 + 3
+22760 LET t = t + v16 / 7
+22770 IF t < 0 THEN 22780
+22780 LET v17 = 37
+22790 LET v17 = v17 * 3 + 7
+22800 LET t = t + v17 / 7
+22810 IF t < 0 THEN 22820
+22820 LET v18 = 41
+22830 LET v18 = v18 * 3 + 11
+22840 LET t = t + v18 / 7
+22850 IF t < 0 THEN 22860
+22860 LET v19 = 45
+22870 LET v19 = v19 * 3 + 2
+22880 LET t = t + v19 / 7
+22890 IF t < 0 THEN 22900
+22900 LET v20 = 49
+22910 LET v20 = v20 * 3 + 6
+22920 LET t = t + v20 / 7
+22930 IF t < 0 THEN 22940
+22940 LET v21 = 53
+22950 LET v21 = v21 * 3 + 10
+22960 LET t = t + v21 / 7
+22970 IF t < 0 THEN 22980
+22980 LET v22 = 57
+22990 LET v22 = v22 * 3 + 1
+23000 LET t = t + v22 / 7
+23010 IF t < 0 THEN 23020
+23020 LET v23 = 61
+23030 LET v23 = v23 * 3 + 5
+23040 LET t = t + v23 / 7
+23050 IF t < 0 THEN 23060
+23060 LET v24 = 65
+23070 LET v24 = v24 * 3 + 9
+23080 LET t = t + v24 / 7
+23090 IF t < 0 THEN 23100
+23100 LET v25 = 69
+23110 LET v25 = v25 * 3 + 0
+23120 LET t = t + v25 / 7
+23130 IF t < 0 THEN 23140
+23140 LET v26 = 73
+23150 LET v26 = v26 * 3 + 4
+23160 LET t = t + v26 / 7
+23170 IF t < 0 THEN 23180
+23180 LET v27 = 77
+23190 LET v27 = v27 * 3 + 8
+23200 LET t = t + v27 / 7
+23210 IF t < 0 THEN 23220
+23220 LET v28 = 81
+23230 LET v28 = v28 * 3 + 12
+23240 LET t = t + v28 / 7
+23250 IF t < 0 THEN 23260
+23260 LET v29 = 85
+23270 LET v29 = v29 * 3 + 3
+23280 LET t = t + v29 / 7
+23290 IF t < 0 THEN 23300
+23300 LET v30 = 89
+23310 LET v30 = v30 * 3 + 7
+23320 LET t = t + v30 / 7
+23330 IF t < 0 THEN 23340
+23340 LET v31 = 93
+23350 LET v31 = v31 * 3 + 11
+23360 LET t = t + v31 / 7
+23370 IF t < 0 THEN 23380
+23380 LET v32 = 0
+23390 LET v32 = v32 * 3 + 2
+23400 LET t = t + v32 / 7
+23410 IF t < 0 THEN 23420
+23420 LET v33 = 4
+23430 LET v33 = v33 * 3 + 6
+23440 LET t = t + v33 / 7
+23450 IF t < 0 THEN 23460
+23460 LET v34 = 8
+23470 LET v34 = v34 * 3 + 10
+23480 LET t = t + v34 / 7
+23490 IF t < 0 THEN 23500
+23500 LET v35 = 12
+23510 LET v35 = v35 * 3 + 1
+23520 LET t = t + v35 / 7
+23530 IF t < 0 THEN 23540
+23540 LET v36 = 16
+23550 LET v36 = v36 * 3 + 5
+23560 LET t = t + v36 / 7
+23570 IF t < 0 THEN 23580
+23580 LET v37 = 20
+23590 LET v37 = v37 * 3 + 9
+23600 LET t = t + v37 / 7
+23610 IF t < 0 THEN 23620
+23620 LET v38 = 24
+23630 LET v38 = v38 * 3 + 0
+23640 LET t = t + v38 / 7
+23650 IF t < 0 THEN 23660
+23660 LET v39 = 28
+23670 LET v39 = v39 * 3 + 4
+23680 LET t = t + v39 / 7
+23690 IF t < 0 THEN 23700
+23700 LET v40 = 32
+23710 LET v40 = v40 * 3 + 8
+23720 LET t = t + v40 / 7
+23730 IF t < 0 THEN 23740
+23740 LET v41 = 36
+23750 LET v41 = v41 * 3 + 12
+23760 LET t = t + v41 / 7
+23770 IF t < 0 THEN 23780
+23780 LET v42 = 40
+23790 LET v42 = v42 * 3 + 3
+23800 LET t = t + v42 / 7
+23810 IF t < 0 THEN 23820
+23820 LET v43 = 44
+23830 LET v43 = v43 * 3 + 7
+23840 LET t = t + v43 / 7
+23850 IF t < 0 THEN 23860
+23860 LET v44 = 48
+23870 LET v44 = v44 * 3 + 11
+23880 LET t = t + v44 / 7
+23890 IF t < 0 THEN 23900
+23900 LET v45 = 52
+23910 LET v45 = v45 * 3 + 2
+23920 LET t = t + v45 / 7
+23930 IF t < 0 THEN 23940
+23940 LET v46 = 56
+23950 LET v46 = v46 * 3 + 6
+23960 LET t = t + v46 / 7
+23970 IF t < 0 THEN 23980
+23980 LET v47 = 60
+23990 LET v47 = v47 * 3 + 10
+24000 LET t = t + v47 / 7
+24010 IF t < 0 THEN 24020
+24020 LET v48 = 64
+24030 LET v48 = v48 * 3 + 1
+24040 LET t = t + v48 / 7
+24050 IF t < 0 THEN 24060
+24060 LET v49 = 68
+24070 LET v49 = v49 * 3 + 5
+24080 LET t = t + v49 / 7
+24090 IF t < 0 THEN 24100
+24100 LET v0 = 72
+24110 LET v0 = v0 * 3 + 9
+24120 LET t = t + v0 / 7
+24130 IF t < 0 THEN 24140
+24140 LET v1 = 76
+24150 LET v1 = v1 * 3 + 0
+24160 LET t = t + v1 / 7
+24170 IF t < 0 THEN 24180
+24180 LET v2 = 80
+24190 LET v2 = v2 * 3 + 4
+24200 LET t = t + v2 / 7
+24210 IF t < 0 THEN 24220
+24220 LET v3 = 84
+24230 LET v3 = v3 * 3 + 8
+24240 LET t = t + v3 / 7
+24250 IF t < 0 THEN 24260
+24260 LET v4 = 88
+24270 LET v4 = v4 * 3 + 12
+24280 LET t = t + v4 / 7
+24290 IF t < 0 THEN 24300
+24300 LET v5 = 92
+24310 LET v5 = v5 * 3 + 3
+24320 LET t = t + v5 / 7
+24330 IF t < 0 THEN 24340
+24340 LET v6 = 96
+24350 LET v6 = v6 * 3 + 7
+24360 LET t = t + v6 / 7
+24370 IF t < 0 THEN 24380
+24380 LET v7 = 3
+24390 LET v7 = v7 * 3 + 11
+24400 LET t = t + v7 / 7
+24410 IF t < 0 THEN 24420
+24420 LET v8 = 7
+24430 LET v8 = v8 * 3 + 2
+24440 LET t = t + v8 / 7
+24450 IF t < 0 THEN 24460
+24460 LET v9 = 11
+24470 LET v9 = v9 * 3 + 6
+24480 LET t = t + v9 / 7
+24490 IF t < 0 THEN 24500
+24500 LET v10 = 15
+24510 LET v10 = v10 * 3 + 10
+24520 LET t = t + v10 / 7
+24530 IF t < 0 THEN 24540
+24540 LET v11 = 19
+24550 LET v11 = v11 * 3 + 1
+24560 LET t = t + v11 / 7
+24570 IF t < 0 THEN 24580
+24580 LET v12 = 23
+24590 LET v12 = v12 * 3 + 5
+24600 LET t = t + v12 / 7
+24610 IF t < 0 THEN 24620
+24620 LET v13 = 27
+24630 LET v13 = v13 * 3 + 9
+24640 LET t = t + v13 / 7
+24650 IF t < 0 THEN 24660
+24660 LET v14 = 31
+24670 LET v14 = v14 * 3 + 0
+24680 LET t = t + v14 / 7
+24690 IF t < 0 THEN 24700
+24700 LET v15 = 35
+24710 LET v15 = v15 * 3 + 4
+24720 LET t = t + v15 / 7
+24730 IF t < 0 THEN 24740
+24740 LET v16 = 39
+24750 LET v16 = v16 * 3 + 8
+24760 LET t = t + v16 / 7
+24770 IF t < 0 THEN 24780
+24780 LET v17 = 43
+24790 LET v17 = v17 * 3 + 12
+24800 LET t = t + v17 / 7
+24810 IF t < 0 THEN 24820
+24820 LET v18 = 47
+24830 LET v18 = v18 * 3 + 3
+24840 LET t = t + v18 / 7
+24850 IF t < 0 THEN 24860
+24860 LET v19 = 51
+24870 LET v19 = v19 * 3 + 7
+24880 LET t = t + v19 / 7
+24890 IF t < 0 THEN 24900
+24900 LET v20 = 55
+24910 LET v20 = v20 * 3 + 11
+24920 LET t = t + v20 / 7
+24930 IF t < 0 THEN 24940
+24940 LET v21 = 59
+24950 LET v21 = v21 * 3 + 2
+24960 LET t = t + v21 / 7
+24970 IF t < 0 THEN 24980
+24980 LET v22 = 63
+24990 LET v22 = v22 * 3 + 6
+25000 LET t = t + v22 / 7
+25010 IF t < 0 THEN 25020
+25020 LET v23 = 67
+25030 LET v23 = v23 * 3 + 10
+25040 LET t = t + v23 / 7
+25050 IF t < 0 THEN 25060
+25060 LET v24 = 71
+25070 LET v24 = v24 * 3 + 1
+25080 LET t = t + v24 / 7
+25090 IF t < 0 THEN 25100
+25100 LET v25 = 75
+25110 LET v25 = v25 * 3 + 5
+25120 LET t = t + v25 / 7
+25130 IF t < 0 THEN 25140
+25140 LET v26 = 79
+25150 LET v26 = v26 * 3 + 9
+25160 LET t = t + v26 / 7
+25170 IF t < 0 THEN 25180
+25180 LET v27 = 83
+25190 LET v27 = v27 * 3 + 0
+25200 LET t = t + v27 / 7
+25210 IF t < 0 THEN 25220
+25220 LET v28 = 87
+25230 LET v28 = v28 * 3 + 4
+25240 LET t = t + v28 / 7
+25250 IF t < 0 THEN 25260
+25260 LET v29 = 91
+25270 LET v29 = v29 * 3 + 8
+25280 LET t = t + v29 / 7
+25290 IF t < 0 THEN 25300
+25300 LET v30 = 95
+25310 LET v30 = v30 * 3 + 12
+25320 LET t = t + v30 / 7
+25330 IF t < 0 THEN 25340
+25340 LET v31 = 2
+25350 LET v31 = v31 * 3 + 3
+25360 LET t = t + v31 / 7
+25370 IF t < 0 THEN 25380
+25380 LET v32 = 6
+25390 LET v32 = v32 * 3 + 7
+25400 LET t = t + v32 / 7
+25410 IF t < 0 THEN 25420
+25420 LET v33 = 10
+25430 LET v33 = v33 * 3 + 11
+25440 LET t = t + v33 / 7
+25450 IF t < 0 THEN 25460
+25460 LET v34 = 14
+25470 LET v34 = v34 * 3 + 2
+25480 LET t = t + v34 / 7
+25490 IF t < 0 THEN 25500
+25500 LET v35 = 18
+25510 LET v35 = v35 * 3 + 6
+25520 LET t = t + v35 / 7
+25530 IF t < 0 THEN 25540
+25540 LET v36 = 22
+25550 LET v36 = v36 * 3 + 10
+25560 LET t = t + v36 / 7
+25570 IF t < 0 THEN 25580
+25580 LET v37 = 26
+25590 LET v37 = v37 * 3 + 1
+25600 LET t = t + v37 / 7
+25610 IF t < 0 THEN 25620
+25620 LET v38 = 30
+25630 LET v38 = v38 * 3 + 5
+25640 LET t = t + v38 / 7
+25650 IF t < 0 THEN 25660
+25660 LET v39 = 34
+25670 LET v39 = v39 * 3 + 9
+25680 LET t = t + v39 / 7
+25690 IF t < 0 THEN 25700
+25700 LET v40 = 38
+25710 LET v40 = v40 * 3 + 0
+25720 LET t = t + v40 / 7
+25730 IF t < 0 THEN 25740
+25740 LET v41 = 42
+25750 LET v41 = v41 * 3 + 4
+25760 LET t = t + v41 / 7
+25770 IF t < 0 THEN 25780
+25780 LET v42 = 46
+25790 LET v42 = v42 * 3 + 8
+25800 LET t = t + v42 / 7
+25810 IF t < 0 THEN 25820
+25820 LET v43 = 50
+25830 LET v43 = v43 * 3 + 12
+25840 LET t = t + v43 / 7
+25850 IF t < 0 THEN 25860
+25860 LET v44 = 54
+25870 LET v44 = v44 * 3 + 3
+25880 LET t = t + v44 / 7
+25890 IF t < 0 THEN 25900
+25900 LET v45 = 58
+25910 LET v45 = v45 * 3 + 7
+25920 LET t = t + v45 / 7
+25930 IF t < 0 THEN 25940
+25940 LET v46 = 62
+25950 LET v46 = v46 * 3 + 11
+25960 LET t = t + v46 / 7
+25970 IF t < 0 THEN 25980
+25980 LET v47 = 66
+25990 LET v47 = v47 * 3 + 2
+26000 LET t = t + v47 / 7
+26010 IF t < 0 THEN 26020
+26020 LET v48 = 70
+26030 LET v48 = v48 * 3 + 6
+26040 LET t = t + v48 / 7
+26050 IF t < 0 THEN 26060
+26060 LET v49 = 74
+26070 LET v49 = v49 * 3 + 10
+26080 LET t = t + v49 / 7
+26090 IF t < 0 THEN 26100
+26100 LET v0 = 78
+26110 LET v0 = v0 * 3 + 1
+26120 LET t = t + v0 / 7
+26130 IF t < 0 THEN 26140
+26140 LET v1 = 82
+26150 LET v1 = v1 * 3 + 5
+26160 LET t = t + v1 / 7
+26170 IF t < 0 THEN 26180
+26180 LET v2 = 86
+26190 LET v2 = v2 * 3 + 9
+26200 LET t = t + v2 / 7
+26210 IF t < 0 THEN 26220
+26220 LET v3 = 90
+26230 LET v3 = v3 * 3 + 0
+26240 LET t = t + v3 / 7
+26250 IF t < 0 THEN 26260
+26260 LET v4 = 94
+26270 LET v4 = v4 * 3 + 4
+26280 LET t = t + v4 / 7
+26290 IF t < 0 THEN 26300
+26300 LET v5 = 1
+26310 LET v5 = v5 * 3 + 8
+26320 LET t = t + v5 / 7
+26330 IF t < 0 THEN 26340
+26340 LET v6 = 5
+26350 LET v6 = v6 * 3 + 12
+26360 LET t = t + v6 / 7
+26370 IF t < 0 THEN 26380
+26380 LET v7 = 9
+26390 LET v7 = v7 * 3 + 3
+26400 LET t = t + v7 / 7
+26410 IF t < 0 THEN 26420
+26420 LET v8 = 13
+26430 LET v8 = v8 * 3 + 7
+26440 LET t = t + v8 / 7
+26450 IF t < 0 THEN 26460
+26460 LET v9 = 17
+26470 LET v9 = v9 * 3 + 11
+26480 LET t = t + v9 / 7
+26490 IF t < 0 THEN 26500
+26500 LET v10 = 21
+26510 LET v10 = v10 * 3 + 2
+26520 LET t = t + v10 / 7
+26530 IF t < 0 THEN 26540
+26540 LET v11 = 25
+26550 LET v11 = v11 * 3 + 6
+26560 LET t = t + v11 / 7
+26570 IF t < 0 THEN 26580
+26580 LET v12 = 29
+26590 LET v12 = v12 * 3 + 10
+26600 LET t = t + v12 / 7
+26610 IF t < 0 THEN 26620
+26620 LET v13 = 33
+26630 LET v13 = v13 * 3 + 1
+26640 LET t = t + v13 / 7
+26650 IF t < 0 THEN 26660
+26660 LET v14 = 37
+26670 LET v14 = v14 * 3 + 5
+26680 LET t = t + v14 / 7
+26690 IF t < 0 THEN 26700
+26700 LET v15 = 41
+26710 LET v15 = v15 * 3 + 9
+26720 LET t = t + v15 / 7
+26730 IF t < 0 THEN 26740
+26740 LET v16 = 45
+26750 LET v16 = v16 * 3 + 0
+26760 LET t = t + v16 / 7
+26770 IF t < 0 THEN 26780
+26780 LET v17 = 49
+26790 LET v17 = v17 * 3 + 4
+26800 LET t = t + v17 / 7
+26810 IF t < 0 THEN 26820
+26820 LET v18 = 53
+26830 LET v18 = v18 * 3 + 8
+26840 LET t = t + v18 / 7
+26850 IF t < 0 THEN 26860
+26860 LET v19 = 57
+26870 LET v19 = v19 * 3 + 12
+26880 LET t = t + v19 / 7
+26890 IF t < 0 THEN 26900
+26900 LET v20 = 61
+26910 LET v20 = v20 * 3 + 3
+26920 LET t = t + v20 / 7
+26930 IF t < 0 THEN 26940
+26940 LET v21 = 65
+26950 LET v21 = v21 * 3 + 7
+26960 LET t = t + v21 / 7
+26970 IF t < 0 THEN 26980
+26980 LET v22 = 69
+26990 LET v22 = v22 * 3 + 11
+27000 LET t = t + v22 / 7
+27010 IF t < 0 THEN 27020
+27020 LET v23 = 73
+27030 LET v23 = v23 * 3 + 2
+27040 LET t = t + v23 / 7
+27050 IF t < 0 THEN 27060
+27060 LET v24 = 77
+27070 LET v24 = v24 * 3 + 6
+27080 LET t = t + v24 / 7
+27090 IF t < 0 THEN 27100
+27100 LET v25 = 81
+27110 LET v25 = v25 * 3 + 10
+27120 LET t = t + v25 / 7
+27130 IF t < 0 THEN 27140
+27140 LET v26 = 85
+27150 LET v26 = v26 * 3 + 1
+27160 LET t = t + v26 / 7
+27170 IF t < 0 THEN 27180
+27180 LET v27 = 89
+27190 LET v27 = v27 * 3 + 5
+27200 LET t = t + v27 / 7
+27210 IF t < 0 THEN 27220
+27220 LET v28 = 93
+27230 LET v28 = v28 * 3 + 9
+27240 LET t = t + v28 / 7
+27250 IF t < 0 THEN 27260
+27260 LET v29 = 0
+27270 LET v29 = v29 * 3 + 0
+27280 LET t = t + v29 / 7
+27290 IF t < 0 THEN 27300
+27300 LET v30 = 4
+27310 LET v30 = v30 * 3 + 4
+27320 LET t = t + v30 / 7
+27330 IF t < 0 THEN 27340
+27340 LET v31 = 8
+27350 LET v31 = v31 * 3 + 8
+27360 LET t = t + v31 / 7
+27370 IF t < 0 THEN 27380
+27380 LET v32 = 12
+27390 LET v32 = v32 * 3 + 12
+27400 LET t = t + v32 / 7
+27410 IF t < 0 THEN 27420
+27420 LET v33 = 16
+27430 LET v33 = v33 * 3 + 3
+27440 LET t = t + v33 / 7
+27450 IF t < 0 THEN 27460
+27460 LET v34 = 20
+27470 LET v34 = v34 * 3 + 7
+27480 LET t = t + v34 / 7
+27490 IF t < 0 THEN 27500
+27500 LET v35 = 24
+27510 LET v35 = v35 * 3 + 11
+27520 LET t = t + v35 / 7
+27530 IF t < 0 THEN 27540
+27540 LET v36 = 28
+27550 LET v36 = v36 * 3 + 2
+27560 LET t = t + v36 / 7
+27570 IF t < 0 THEN 27580
+27580 LET v37 = 32
+27590 LET v37 = v37 * 3 + 6
+27600 LET t = t + v37 / 7
+27610 IF t < 0 THEN 27620
+27620 LET v38 = 36
+27630 LET v38 = v38 * 3 + 10
+27640 LET t = t + v38 / 7
+27650 IF t < 0 THEN 27660
+27660 LET v39 = 40
+27670 LET v39 = v39 * 3 + 1
+27680 LET t = t + v39 / 7
+27690 IF t < 0 THEN 27700
+27700 LET v40 = 44
+27710 LET v40 = v40 * 3 + 5
+27720 LET t = t + v40 / 7
+27730 IF t < 0 THEN 27740
+27740 LET v41 = 48
+27750 LET v41 = v41 * 3 + 9
+27760 LET t = t + v41 / 7
+27770 IF t < 0 THEN 27780
+27780 LET v42 = 52
+27790 LET v42 = v42 * 3 + 0
+27800 LET t = t + v42 / 7
+27810 IF t < 0 THEN 27820
+27820 LET v43 = 56
+27830 LET v43 = v43 * 3 + 4
+27840 LET t = t + v43 / 7
+27850 IF t < 0 THEN 27860
+27860 LET v44 = 60
+27870 LET v44 = v44 * 3 + 8
+27880 LET t = t + v44 / 7
+27890 IF t < 0 THEN 27900
+27900 LET v45 = 64
+27910 LET v45 = v45 * 3 + 12
+27920 LET t = t + v45 / 7
+27930 IF t < 0 THEN 27940
+27940 LET v46 = 68
+27950 LET v46 = v46 * 3 + 3
+27960 LET t = t + v46 / 7
+27970 IF t < 0 THEN 27980
+27980 LET v47 = 72
+27990 LET v47 = v47 * 3 + 7
+28000 LET t = t + v47 / 7
+28010 IF t < 0 THEN 28020
+28020 LET v48 = 76
+28030 LET v48 = v48 * 3 + 11
+28040 LET t = t + v48 / 7
+28050 IF t < 0 THEN 28060
+28060 LET v49 = 80
+28070 LET v49 = v49 * 3 + 2
+28080 LET t = t + v49 / 7
+28090 IF t < 0 THEN 28100
+28100 LET v0 = 84
+28110 LET v0 = v0 * 3 + 6
+28120 LET t = t + v0 / 7
+28130 IF t < 0 THEN 28140
+28140 LET v1 = 88
+28150 LET v1 = v1 * 3 + 10
+28160 LET t = t + v1 / 7
+28170 IF t < 0 THEN 28180
+28180 LET v2 = 92
+28190 LET v2 = v2 * 3 + 1
+28200 LET t = t + v2 / 7
+28210 IF t < 0 THEN 28220
+28220 LET v3 = 96
+28230 LET v3 = v3 * 3 + 5
+28240 LET t = t + v3 / 7
+28250 IF t < 0 THEN 28260
+28260 LET v4 = 3
+28270 LET v4 = v4 * 3 + 9
+28280 LET t = t + v4 / 7
+28290 IF t < 0 THEN 28300
+28300 LET v5 = 7
+28310 LET v5 = v5 * 3 + 0
+28320 LET t = t + v5 / 7
+28330 IF t < 0 THEN 28340
+28340 LET v6 = 11
+28350 LET v6 = v6 * 3 + 4
+28360 LET t = t + v6 / 7
+28370 IF t < 0 THEN 28380
+28380 LET v7 = 15
+28390 LET v7 = v7 * 3 + 8
+28400 LET t = t + v7 / 7
+28410 IF t < 0 THEN 28420
+28420 LET v8 = 19
+28430 LET v8 = v8 * 3 + 12
+28440 LET t = t + v8 / 7
+28450 IF t < 0 THEN 28460
+28460 LET v9 = 23
+28470 LET v9 = v9 * 3 + 3
+28480 LET t = t + v9 / 7
+28490 IF t < 0 THEN 28500
+28500 LET v10 = 27
+28510 LET v10 = v10 * 3 + 7
+28520 LET t = t + v10 / 7
+28530 IF t < 0 THEN 28540
+28540 LET v11 = 31
+28550 LET v11 = v11 * 3 + 11
+28560 LET t = t + v11 / 7
+28570 IF t < 0 THEN 28580
+28580 LET v12 = 35
+28590 LET v12 = v12 * 3 + 2
+28600 LET t = t + v12 / 7
+28610 IF t < 0 THEN 28620
+28620 LET v13 = 39
+28630 LET v13 = v13 * 3 + 6
+28640 LET t = t + v13 / 7
+28650 IF t < 0 THEN 28660
+28660 LET v14 = 43
+28670 LET v14 = v14 * 3 + 10
+28680 LET t = t + v14 / 7
+28690 IF t < 0 THEN 28700
+28700 LET v15 = 47
+28710 LET v15 = v15 * 3 + 1
+28720 LET t = t + v15 / 7
+28730 IF t < 0 THEN 28740
+28740 LET v16 = 51
+28750 LET v16 = v16 * 3 + 5
+28760 LET t = t + v16 / 7
+28770 IF t < 0 THEN 28780
+28780 LET v17 = 55
+28790 LET v17 = v17 * 3 + 9
+28800 LET t = t + v17 / 7
+28810 IF t < 0 THEN 28820
+28820 LET v18 = 59
+28830 LET v18 = v18 * 3 + 0
+28840 LET t = t + v18 / 7
+28850 IF t < 0 THEN 28860
+28860 LET v19 = 63
+28870 LET v19 = v19 * 3 + 4
+28880 LET t = t + v19 / 7
+28890 IF t < 0 THEN 28900
+28900 LET v20 = 67
+28910 LET v20 = v20 * 3 + 8
+28920 LET t = t + v20 / 7
+28930 IF t < 0 THEN 28940
+28940 LET v21 = 71
+28950 LET v21 = v21 * 3 + 12
+28960 LET t = t + v21 / 7
+28970 IF t < 0 THEN 28980
+28980 LET v22 = 75
+28990 LET v22 = v22 * 3 + 3
+29000 LET t = t + v22 / 7
+29010 IF t < 0 THEN 29020
+29020 LET v23 = 79
+29030 LET v23 = v23 * 3 + 7
+29040 LET t = t + v23 / 7
+29050 IF t < 0 THEN 29060
+29060 LET v24 = 83
+29070 LET v24 = v24 * 3 + 11
+29080 LET t = t + v24 / 7
+29090 IF t < 0 THEN 29100
+29100 LET v25 = 87
+29110 LET v25 = v25 * 3 + 2
+29120 LET t = t + v25 / 7
+29130 IF t < 0 THEN 29140
+29140 LET v26 = 91
+29150 LET v26 = v26 * 3 + 6
+29160 LET t = t + v26 / 7
+29170 IF t < 0 THEN 29180
+29180 LET v27 = 95
+29190 LET v27 = v27 * 3 + 10
+29200 LET t = t + v27 / 7
+29210 IF t < 0 THEN 29220
+29220 LET v28 = 2
+29230 LET v28 = v28 * 3 + 1
+29240 LET t = t + v28 / 7
+29250 IF t < 0 THEN 29260
+29260 LET v29 = 6
+29270 LET v29 = v29 * 3 + 5
+29280 LET t = t + v29 / 7
+29290 IF t < 0 THEN 29300
+29300 LET v30 = 10
+29310 LET v30 = v30 * 3 + 9
+29320 LET t = t + v30 / 7
+29330 IF t < 0 THEN 29340
+29340 LET v31 = 14
+29350 LET v31 = v31 * 3 + 0
+29360 LET t = t + v31 / 7
+29370 IF t < 0 THEN 29380
+29380 LET v32 = 18
+29390 LET v32 = v32 * 3 + 4
+29400 LET t = t + v32 / 7
+29410 IF t < 0 THEN 29420
+29420 LET v33 = 22
+29430 LET v33 = v33 * 3 + 8
+29440 LET t = t + v33 / 7
+29450 IF t < 0 THEN 29460
+29460 LET v34 = 26
+29470 LET v34 = v34 * 3 + 12
+29480 LET t = t + v34 / 7
+29490 IF t < 0 THEN 29500
+29500 LET v35 = 30
+29510 LET v35 = v35 * 3 + 3
+29520 LET t = t + v35 / 7
+29530 IF t < 0 THEN 29540
+29540 LET v36 = 34
+29550 LET v36 = v36 * 3 + 7
+29560 LET t = t + v36 / 7
+29570 IF t < 0 THEN 29580
+29580 LET v37 = 38
+29590 LET v37 = v37 * 3 + 11
+29600 LET t = t + v37 / 7
+29610 IF t < 0 THEN 29620
+29620 LET v38 = 42
+29630 LET v38 = v38 * 3 + 2
+29640 LET t = t + v38 / 7
+29650 IF t < 0 THEN 29660
+29660 LET v39 = 46
+29670 LET v39 = v39 * 3 + 6
+29680 LET t = t + v39 / 7
+29690 IF t < 0 THEN 29700
+29700 LET v40 = 50
+29710 LET v40 = v40 * 3 + 10
+29720 LET t = t + v40 / 7
+29730 IF t < 0 THEN 29740
+29740 LET v41 = 54
+29750 LET v41 = v41 * 3 + 1
+29760 LET t = t + v41 / 7
+29770 IF t < 0 THEN 29780
+29780 LET v42 = 58
+29790 LET v42 = v42 * 3 + 5
+29800 LET t = t + v42 / 7
+29810 IF t < 0 THEN 29820
+29820 LET v43 = 62
+29830 LET v43 = v43 * 3 + 9
+29840 LET t = t + v43 / 7
+29850 IF t < 0 THEN 29860
+29860 LET v44 = 66
+29870 LET v44 = v44 * 3 + 0
+29880 LET t = t + v44 / 7
+29890 IF t < 0 THEN 29900
+29900 LET v45 = 70
+29910 LET v45 = v45 * 3 + 4
+29920 LET t = t + v45 / 7
+29930 IF t < 0 THEN 29940
+29940 LET v46 = 74
+29950 LET v46 = v46 * 3 + 8
+29960 LET t = t + v46 / 7
+29970 IF t < 0 THEN 29980
+29980 LET v47 = 78
+29990 LET v47 = v47 * 3 + 12
+30000 LET t = t + v47 / 7
+30010 IF t < 0 THEN 30020
+30020 LET v48 = 82
+30030 LET v48 = v48 * 3 + 3
+30040 LET t = t + v48 / 7
+30050 IF t < 0 THEN 30060
+30060 LET v49 = 86
+30070 LET v49 = v49 * 3 + 7
+30080 LET t = t + v49 / 7
+30090 IF t < 0 THEN 30100
+30100 LET v0 = 90
+30110 LET v0 = v0 * 3 + 11
+30120 LET t = t + v0 / 7
+30130 IF t < 0 THEN 30140
+30140 LET v1 = 94
+30150 LET v1 = v1 * 3 + 2
+30160 LET t = t + v1 / 7
+30170 IF t < 0 THEN 30180
+30180 LET v2 = 1
+30190 LET v2 = v2 * 3 + 6
+30200 LET t = t + v2 / 7
+30210 IF t < 0 THEN 30220
+30220 LET v3 = 5
+30230 LET v3 = v3 * 3 + 10
+30240 LET t = t + v3 / 7
+30250 IF t < 0 THEN 30260
+30260 LET v4 = 9
+30270 LET v4 = v4 * 3 + 1
+30280 LET t = t + v4 / 7
+30290 IF t < 0 THEN 30300
+30300 LET v5 = 13
+30310 LET v5 = v5 * 3 + 5
+30320 LET t = t + v5 / 7
+30330 IF t < 0 THEN 30340
+30340 LET v6 = 17
+30350 LET v6 = v6 * 3 + 9
+30360 LET t = t + v6 / 7
+30370 IF t < 0 THEN 30380
+30380 LET v7 = 21
+30390 LET v7 = v7 * 3 + 0
+30400 LET t = t + v7 / 7
+30410 IF t < 0 THEN 30420
+30420 LET v8 = 25
+30430 LET v8 = v8 * 3 + 4
+30440 LET t = t + v8 / 7
+30450 IF t < 0 THEN 30460
+30460 LET v9 = 29
+30470 LET v9 = v9 * 3 + 8
+30480 LET t = t + v9 / 7
+30490 IF t < 0 THEN 30500
+30500 LET v10 = 33
+30510 LET v10 = v10 * 3 + 12
+30520 LET t = t + v10 / 7
+30530 IF t < 0 THEN 30540
+30540 LET v11 = 37
+30550 LET v11 = v11 * 3 + 3
+30560 LET t = t + v11 / 7
+30570 IF t < 0 THEN 30580
+30580 LET v12 = 41
+30590 LET v12 = v12 * 3 + 7
+30600 LET t = t + v12 / 7
+30610 IF t < 0 THEN 30620
+30620 LET v13 = 45
+30630 LET v13 = v13 * 3 + 11
+30640 LET t = t + v13 / 7
+30650 IF t < 0 THEN 30660
+30660 LET v14 = 49
+30670 LET v14 = v14 * 3 + 2
+30680 LET t = t + v14 / 7
+30690 IF t < 0 THEN 30700
+30700 LET v15 = 53
+30710 LET v15 = v15 * 3 + 6
+30720 LET t = t + v15 / 7
+30730 IF t < 0 THEN 30740
+30740 LET v16 = 57
+30750 LET v16 = v16 * 3 + 10
+30760 LET t = t + v16 / 7
+30770 IF t < 0 THEN 30780
+30780 LET v17 = 61
+30790 LET v17 = v17 * 3 + 1
+30800 LET t = t + v17 / 7
+30810 IF t < 0 THEN 30820
+30820 LET v18 = 65
+30830 LET v18 = v18 * 3 + 5
+30840 LET t = t + v18 / 7
+30850 IF t < 0 THEN 30860
+30860 LET v19 = 69
+30870 LET v19 = v19 * 3 + 9
+30880 LET t = t + v19 / 7
+30890 IF t < 0 THEN 30900
+30900 LET v20 = 73
+30910 LET v20 = v20 * 3 + 0
+30920 LET t = t + v20 / 7
+30930 IF t < 0 THEN 30940
+30940 LET v21 = 77
+30950 LET v21 = v21 * 3 + 4
+30960 LET t = t + v21 / 7
+30970 IF t < 0 THEN 30980
+30980 LET v22 = 81
+30990 LET v22 = v22 * 3 + 8
+31000 LET t = t + v22 / 7
+31010 IF t < 0 THEN 31020
+31020 LET v23 = 85
+31030 LET v23 = v23 * 3 + 12
+31040 LET t = t + v23 / 7
+31050 IF t < 0 THEN 31060
+31060 LET v24 = 89
+31070 LET v24 = v24 * 3 + 3
+31080 LET t = t + v24 / 7
+31090 IF t < 0 THEN 31100
+31100 LET v25 = 93
+31110 LET v25 = v25 * 3 + 7
+31120 LET t = t + v25 / 7
+31130 IF t < 0 THEN 31140
+31140 LET v26 = 0
+31150 LET v26 = v26 * 3 + 11
+31160 LET t = t + v26 / 7
+31170 IF t < 0 THEN 31180
+31180 LET v27 = 4
+31190 LET v27 = v27 * 3 + 2
+31200 LET t = t + v27 / 7
+31210 IF t < 0 THEN 31220
+31220 LET v28 = 8
+31230 LET v28 = v28 * 3 + 6
+31240 LET t = t + v28 / 7
+31250 IF t < 0 THEN 31260
+31260 LET v29 = 12
+31270 LET v29 = v29 * 3 + 10
+31280 LET t = t + v29 / 7
+31290 IF t < 0 THEN 31300
+31300 LET v30 = 16
+31310 LET v30 = v30 * 3 + 1
+31320 LET t = t + v30 / 7
+31330 IF t < 0 THEN 31340
+31340 LET v31 = 20
+31350 LET v31 = v31 * 3 + 5
+31360 LET t = t + v31 / 7
+31370 IF t < 0 THEN 31380
+31380 LET v32 = 24
+31390 LET v32 = v32 * 3 + 9
+31400 LET t = t + v32 / 7
+31410 IF t < 0 THEN 31420
+31420 LET v33 = 28
+31430 LET v33 = v33 * 3 + 0
+31440 LET t = t + v33 / 7
+31450 IF t < 0 THEN 31460
+31460 LET v34 = 32
+31470 LET v34 = v34 * 3 + 4
+31480 LET t = t + v34 / 7
+31490 IF t < 0 THEN 31500
+31500 LET v35 = 36
+31510 LET v35 = v35 * 3 + 8
+31520 LET t = t + v35 / 7
+31530 IF t < 0 THEN 31540
+31540 LET v36 = 40
+31550 LET v36 = v36 * 3 + 12
+31560 LET t = t + v36 / 7
+31570 IF t < 0 THEN 31580
+31580 LET v37 = 44
+31590 LET v37 = v37 * 3 + 3
+31600 LET t = t + v37 / 7
+31610 IF t < 0 THEN 31620
+31620 LET v38 = 48
+31630 LET v38 = v38 * 3 + 7
+31640 LET t = t + v38 / 7
+31650 IF t < 0 THEN 31660
+31660 LET v39 = 52
+31670 LET v39 = v39 * 3 + 11
+31680 LET t = t + v39 / 7
+31690 IF t < 0 THEN 31700
+31700 LET v40 = 56
+31710 LET v40 = v40 * 3 + 2
+31720 LET t = t + v40 / 7
+31730 IF t < 0 THEN 31740
+31740 LET v41 = 60
+31750 LET v41 = v41 * 3 + 6
+31760 LET t = t + v41 / 7
+31770 IF t < 0 THEN 31780
+31780 LET v42 = 64
+31790 LET v42 = v42 * 3 + 10
+31800 LET t = t + v42 / 7
+31810 IF t < 0 THEN 31820
+31820 LET v43 = 68
+31830 LET v43 = v43 * 3 + 1
+31840 LET t = t + v43 / 7
+31850 IF t < 0 THEN 31860
+31860 LET v44 = 72
+31870 LET v44 = v44 * 3 + 5
+31880 LET t = t + v44 / 7
+31890 IF t < 0 THEN 31900
+31900 LET v45 = 76
+31910 LET v45 = v45 * 3 + 9
+31920 LET t = t + v45 / 7
+31930 IF t < 0 THEN 31940
+31940 LET v46 = 80
+31950 LET v46 = v46 * 3 + 0
+31960 LET t = t + v46 / 7
+31970 IF t < 0 THEN 31980
+31980 LET v47 = 84
+31990 LET v47 = v47 * 3 + 4
+32000 LET t = t + v47 / 7
+32010 IF t < 0 THEN 32020
+32020 LET v48 = 88
+32030 LET v48 = v48 * 3 + 8
+32040 LET t = t + v48 / 7
+32050 IF t < 0 THEN 32060
+32060 LET v49 = 92
+32070 LET v49 = v49 * 3 + 12
+32080 LET t = t + v49 / 7
+32090 IF t < 0 THEN 32100
+32100 LET v0 = 96
+32110 LET v0 = v0 * 3 + 3
+32120 LET t = t + v0 / 7
+32130 IF t < 0 THEN 32140
+32140 LET v1 = 3
+32150 LET v1 = v1 * 3 + 7
+32160 LET t = t + v1 / 7
+32170 IF t < 0 THEN 32180
+32180 LET v2 = 7
+32190 LET v2 = v2 * 3 + 11
+32200 LET t = t + v2 / 7
+32210 IF t < 0 THEN 32220
+32220 LET v3 = 11
+32230 LET v3 = v3 * 3 + 2
+32240 LET t = t + v3 / 7
+32250 IF t < 0 THEN 32260
+32260 LET v4 = 15
+32270 LET v4 = v4 * 3 + 6
+32280 LET t = t + v4 / 7
+32290 IF t < 0 THEN 32300
+32300 LET v5 = 19
+32310 LET v5 = v5 * 3 + 10
+32320 LET t = t + v5 / 7
+32330 IF t < 0 THEN 32340
+32340 LET v6 = 23
+32350 LET v6 = v6 * 3 + 1
+32360 LET t = t + v6 / 7
+32370 IF t < 0 THEN 32380
+32380 LET v7 = 27
+32390 LET v7 = v7 * 3 + 5
+32400 LET t = t + v7 / 7
+32410 IF t < 0 THEN 32420
+32420 LET v8 = 31
+32430 LET v8 = v8 * 3 + 9
+32440 LET t = t + v8 / 7
+32450 IF t < 0 THEN 32460
+32460 LET v9 = 35
+32470 LET v9 = v9 * 3 + 0
+32480 LET t = t + v9 / 7
+32490 IF t < 0 THEN 32500
+32500 LET v10 = 39
+32510 LET v10 = v10 * 3 + 4
+32520 LET t = t + v10 / 7
+32530 IF t < 0 THEN 32540
+32540 LET v11 = 43
+32550 LET v11 = v11 * 3 + 8
+32560 LET t = t + v11 / 7
+32570 IF t < 0 THEN 32580
+32580 LET v12 = 47
+32590 LET v12 = v12 * 3 + 12
+32600 LET t = t + v12 / 7
+32610 IF t < 0 THEN 32620
+32620 LET v13 = 51
+32630 LET v13 = v13 * 3 + 3
+32640 LET t = t + v13 / 7
+32650 IF t < 0 THEN 32660
+32660 LET v14 = 55
+32670 LET v14 = v14 * 3 + 7
+32680 LET t = t + v14 / 7
+32690 IF t < 0 THEN 32700
+32700 LET v15 = 59
+32710 LET v15 = v15 * 3 + 11
+32720 LET t = t + v15 / 7
+32730 IF t < 0 THEN 32740
+32740 LET v16 = 63
+32750 LET v16 = v16 * 3 + 2
+32760 LET t = t + v16 / 7
+32770 IF t < 0 THEN 32780
+32780 LET v17 = 67
+32790 LET v17 = v17 * 3 + 6
+32800 LET t = t + v17 / 7
+32810 IF t < 0 THEN 32820
+32820 LET v18 = 71
+32830 LET v18 = v18 * 3 + 10
+32840 LET t = t + v18 / 7
+32850 IF t < 0 THEN 32860
+32860 LET v19 = 75
+32870 LET v19 = v19 * 3 + 1
+32880 LET t = t + v19 / 7
+32890 IF t < 0 THEN 32900
+32900 LET v20 = 79
+32910 LET v20 = v20 * 3 + 5
+32920 LET t = t + v20 / 7
+32930 IF t < 0 THEN 32940
+32940 LET v21 = 83
+32950 LET v21 = v21 * 3 + 9
+32960 LET t = t + v21 / 7
+32970 IF t < 0 THEN 32980
+32980 LET v22 = 87
+32990 LET v22 = v22 * 3 + 0
+33000 LET t = t + v22 / 7
+33010 IF t < 0 THEN 33020
+33020 LET v23 = 91
+33030 LET v23 = v23 * 3 + 4
+33040 LET t = t + v23 / 7
+33050 IF t < 0 THEN 33060
+33060 LET v24 = 95
+33070 LET v24 = v24 * 3 + 8
+33080 LET t = t + v24 / 7
+33090 IF t < 0 THEN 33100
+33100 LET v25 = 2
+33110 LET v25 = v25 * 3 + 12
+33120 LET t = t + v25 / 7
+33130 IF t < 0 THEN 33140
+33140 LET v26 = 6
+33150 LET v26 = v26 * 3 + 3
+33160 LET t = t + v26 / 7
+33170 IF t < 0 THEN 33180
+33180 LET v27 = 10
+33190 LET v27 = v27 * 3 + 7
+33200 LET t = t + v27 / 7
+33210 IF t < 0 THEN 33220
+33220 LET v28 = 14
+33230 LET v28 = v28 * 3 + 11
+33240 LET t = t + v28 / 7
+33250 IF t < 0 THEN 33260
+33260 LET v29 = 18
+33270 LET v29 = v29 * 3 + 2
+33280 LET t = t + v29 / 7
+33290 IF t < 0 THEN 33300
+33300 LET v30 = 22
+33310 LET v30 = v30 * 3 + 6
+33320 LET t = t + v30 / 7
+33330 IF t < 0 THEN 33340
+33340 LET v31 = 26
+33350 LET v31 = v31 * 3 + 10
+33360 LET t = t + v31 / 7
+33370 IF t < 0 THEN 33380
+33380 LET v32 = 30
+33390 LET v32 = v32 * 3 + 1
+33400 LET t = t + v32 / 7
+33410 IF t < 0 THEN 33420
+33420 LET v33 = 34
+33430 LET v33 = v33 * 3 + 5
+33440 LET t = t + v33 / 7
+33450 IF t < 0 THEN 33460
+33460 LET v34 = 38
+33470 LET v34 = v34 * 3 + 9
+33480 LET t = t + v34 / 7
+33490 IF t < 0 THEN 33500
+33500 LET v35 = 42
+33510 LET v35 = v35 * 3 + 0
+33520 LET t = t + v35 / 7
+33530 IF t < 0 THEN 33540
+33540 LET v36 = 46
+33550 LET v36 = v36 * 3 + 4
+33560 LET t = t + v36 / 7
+33570 IF t < 0 THEN 33580
+33580 LET v37 = 50
+33590 LET v37 = v37 * 3 + 8
+33600 LET t = t + v37 / 7
+33610 IF t < 0 THEN 33620
+33620 LET v38 = 54
+33630 LET v38 = v38 * 3 + 12
+33640 LET t = t + v38 / 7
+33650 IF t < 0 THEN 33660
+33660 LET v39 = 58
+33670 LET v39 = v39 * 3 + 3
+33680 LET t = t + v39 / 7
+33690 IF t < 0 THEN 33700
+33700 LET v40 = 62
+33710 LET v40 = v40 * 3 + 7
+33720 LET t = t + v40 / 7
+33730 IF t < 0 THEN 33740
+33740 LET v41 = 66
+33750 LET v41 = v41 * 3 + 11
+33760 LET t = t + v41 / 7
+33770 IF t < 0 THEN 33780
+33780 LET v42 = 70
+33790 LET v42 = v42 * 3 + 2
+33800 LET t = t + v42 / 7
+33810 IF t < 0 THEN 33820
+33820 LET v43 = 74
+33830 LET v43 = v43 * 3 + 6
+33840 LET t = t + v43 / 7
+33850 IF t < 0 THEN 33860
+33860 LET v44 = 78
+33870 LET v44 = v44 * 3 + 10
+33880 LET t = t + v44 / 7
+33890 IF t < 0 THEN 33900
+33900 LET v45 = 82
+33910 LET v45 = v45 * 3 + 1
+33920 LET t = t + v45 / 7
+33930 IF t < 0 THEN 33940
+33940 LET v46 = 86
+33950 LET v46 = v46 * 3 + 5
+33960 LET t = t + v46 / 7
+33970 IF t < 0 THEN 33980
+33980 LET v47 = 90
+33990 LET v47 = v47 * 3 + 9
+34000 LET t = t + v47 / 7
+34010 IF t < 0 THEN 34020
+34020 LET v48 = 94
+34030 LET v48 = v48 * 3 + 0
+34040 LET t = t + v48 / 7
+34050 IF t < 0 THEN 34060
+34060 LET v49 = 1
+34070 LET v49 = v49 * 3 + 4
+34080 LET t = t + v49 / 7
+34090 IF t < 0 THEN 34100
+34100 LET v0 = 5
+34110 LET v0 = v0 * 3 + 8
+34120 LET t = t + v0 / 7
+34130 IF t < 0 THEN 34140
+34140 LET v1 = 9
+34150 LET v1 = v1 * 3 + 12
+34160 LET t = t + v1 / 7
+34170 IF t < 0 THEN 34180
+34180 LET v2 = 13
+34190 LET v2 = v2 * 3 + 3
+34200 LET t = t + v2 / 7
+34210 IF t < 0 THEN 34220
+34220 LET v3 = 17
+34230 LET v3 = v3 * 3 + 7
+34240 LET t = t + v3 / 7
+34250 IF t < 0 THEN 34260
+34260 LET v4 = 21
+34270 LET v4 = v4 * 3 + 11
+34280 LET t = t + v4 / 7
+34290 IF t < 0 THEN 34300
+34300 LET v5 = 25
+34310 LET v5 = v5 * 3 + 2
+34320 LET t = t + v5 / 7
+34330 IF t < 0 THEN 34340
+34340 LET v6 = 29
+34350 LET v6 = v6 * 3 + 6
+34360 LET t = t + v6 / 7
+34370 IF t < 0 THEN 34380
+34380 LET v7 = 33
+34390 LET v7 = v7 * 3 + 10
+34400 LET t = t + v7 / 7
+34410 IF t < 0 THEN 34420
+34420 LET v8 = 37
+34430 LET v8 = v8 * 3 + 1
+34440 LET t = t + v8 / 7
+34450 IF t < 0 THEN 34460
+34460 LET v9 = 41
+34470 LET v9 = v9 * 3 + 5
+34480 LET t = t + v9 / 7
+34490 IF t < 0 THEN 34500
+34500 LET v10 = 45
+34510 LET v10 = v10 * 3 + 9
+34520 LET t = t + v10 / 7
+34530 IF t < 0 THEN 34540
+34540 LET v11 = 49
+34550 LET v11 = v11 * 3 + 0
+34560 LET t = t + v11 / 7
+34570 IF t < 0 THEN 34580
+34580 LET v12 = 53
+34590 LET v12 = v12 * 3 + 4
+34600 LET t = t + v12 / 7
+34610 IF t < 0 THEN 34620
+34620 LET v13 = 57
+34630 LET v13 = v13 * 3 + 8
+34640 LET t = t + v13 / 7
+34650 IF t < 0 THEN 34660
+34660 LET v14 = 61
+34670 LET v14 = v14 * 3 + 12
+34680 LET t = t + v14 / 7
+34690 IF t < 0 THEN 34700
+34700 LET v15 = 65
+34710 LET v15 = v15 * 3 + 3
+34720 LET t = t + v15 / 7
+34730 IF t < 0 THEN 34740
+34740 LET v16 = 69
+34750 LET v16 = v16 * 3 + 7
+34760 LET t = t + v16 / 7
+34770 IF t < 0 THEN 34780
+34780 LET v17 = 73
+34790 LET v17 = v17 * 3 + 11
+34800 LET t = t + v17 / 7
+34810 IF t < 0 THEN 34820
+34820 LET v18 = 77
+34830 LET v18 = v18 * 3 + 2
+34840 LET t = t + v18 / 7
+34850 IF t < 0 THEN 34860
+34860 LET v19 = 81
+34870 LET v19 = v19 * 3 + 6
+34880 LET t = t + v19 / 7
+34890 IF t < 0 THEN 34900
+34900 LET v20 = 85
+34910 LET v20 = v20 * 3 + 10
+34920 LET t = t + v20 / 7
+34930 IF t < 0 THEN 34940
+34940 LET v21 = 89
+34950 LET v21 = v21 * 3 + 1
+34960 LET t = t + v21 / 7
+34970 IF t < 0 THEN 34980
+34980 LET v22 = 93
+34990 LET v22 = v22 * 3 + 5
+35000 LET t = t + v22 / 7
+35010 IF t < 0 THEN 35020
+35020 LET v23 = 0
+35030 LET v23 = v23 * 3 + 9
+35040 LET t = t + v23 / 7
+35050 IF t < 0 THEN 35060
+35060 LET v24 = 4
+35070 LET v24 = v24 * 3 + 0
+35080 LET t = t + v24 / 7
+35090 IF t < 0 THEN 35100
+35100 LET v25 = 8
+35110 LET v25 = v25 * 3 + 4
+35120 LET t = t + v25 / 7
+35130 IF t < 0 THEN 35140
+35140 LET v26 = 12
+35150 LET v26 = v26 * 3 + 8
+35160 LET t = t + v26 / 7
+35170 IF t < 0 THEN 35180
+35180 LET v27 = 16
+35190 LET v27 = v27 * 3 + 12
+35200 LET t = t + v27 / 7
+35210 IF t < 0 THEN 35220
+35220 LET v28 = 20
+35230 LET v28 = v28 * 3 + 3
+35240 LET t = t + v28 / 7
+35250 IF t < 0 THEN 35260
+35260 LET v29 = 24
+35270 LET v29 = v29 * 3 + 7
+35280 LET t = t + v29 / 7
+35290 IF t < 0 THEN 35300
+35300 LET v30 = 28
+35310 LET v30 = v30 * 3 + 11
+35320 LET t = t + v30 / 7
+35330 IF t < 0 THEN 35340
+35340 LET v31 = 32
+35350 LET v31 = v31 * 3 + 2
+35360 LET t = t + v31 / 7
+35370 IF t < 0 THEN 35380
+35380 LET v32 = 36
+35390 LET v32 = v32 * 3 + 6
+35400 LET t = t + v32 / 7
+35410 IF t < 0 THEN 35420
+35420 LET v33 = 40
+35430 LET v33 = v33 * 3 + 10
+35440 LET t = t + v33 / 7
+35450 IF t < 0 THEN 35460
+35460 LET v34 = 44
+35470 LET v34 = v34 * 3 + 1
+35480 LET t = t + v34 / 7
+35490 IF t < 0 THEN 35500
+35500 LET v35 = 48
+35510 LET v35 = v35 * 3 + 5
+35520 LET t = t + v35 / 7
+35530 IF t < 0 THEN 35540
+35540 LET v36 = 52
+35550 LET v36 = v36 * 3 + 9
+35560 LET t = t + v36 / 7
+35570 IF t < 0 THEN 35580
+35580 LET v37 = 56
+35590 LET v37 = v37 * 3 + 0
+35600 LET t = t + v37 / 7
+35610 IF t < 0 THEN 35620
+35620 LET v38 = 60
+35630 LET v38 = v38 * 3 + 4
+35640 LET t = t + v38 / 7
+35650 IF t < 0 THEN 35660
+35660 LET v39 = 64
+35670 LET v39 = v39 * 3 + 8
+35680 LET t = t + v39 / 7
+35690 IF t < 0 THEN 35700
+35700 LET v40 = 68
+35710 LET v40 = v40 * 3 + 12
+35720 LET t = t + v40 / 7
+35730 IF t < 0 THEN 35740
+35740 LET v41 = 72
+35750 LET v41 = v41 * 3 + 3
+35760 LET t = t + v41 / 7
+35770 IF t < 0 THEN 35780
+35780 LET v42 = 76
+35790 LET v42 = v42 * 3 + 7
+35800 LET t = t + v42 / 7
+35810 IF t < 0 THEN 35820
+35820 LET v43 = 80
+35830 LET v43 = v43 * 3 + 11
+35840 LET t = t + v43 / 7
+35850 IF t < 0 THEN 35860
+35860 LET v44 = 84
+35870 LET v44 = v44 * 3 + 2
+35880 LET t = t + v44 / 7
+35890 IF t < 0 THEN 35900
+35900 LET v45 = 88
+35910 LET v45 = v45 * 3 + 6
+35920 LET t = t + v45 / 7
+35930 IF t < 0 THEN 35940
+35940 LET v46 = 92
+35950 LET v46 = v46 * 3 + 10
+35960 LET t = t + v46 / 7
+35970 IF t < 0 THEN 35980
+35980 LET v47 = 96
+35990 LET v47 = v47 * 3 + 1
+36000 LET t = t + v47 / 7
+36010 IF t < 0 THEN 36020
+36020 LET v48 = 3
+36030 LET v48 = v48 * 3 + 5
+36040 LET t = t + v48 / 7
+36050 IF t < 0 THEN 36060
+36060 LET v49 = 7
+36070 LET v49 = v49 * 3 + 9
+36080 LET t = t + v49 / 7
+36090 IF t < 0 THEN 36100
+36100 LET v0 = 11
+36110 LET v0 = v0 * 3 + 0
+36120 LET t = t + v0 / 7
+36130 IF t < 0 THEN 36140
+36140 LET v1 = 15
+36150 LET v1 = v1 * 3 + 4
+36160 LET t = t + v1 / 7
+36170 IF t < 0 THEN 36180
+36180 LET v2 = 19
+36190 LET v2 = v2 * 3 + 8
+36200 LET t = t + v2 / 7
+36210 IF t < 0 THEN 36220
+36220 LET v3 = 23
+36230 LET v3 = v3 * 3 + 12
+36240 LET t = t + v3 / 7
+36250 IF t < 0 THEN 36260
+36260 LET v4 = 27
+36270 LET v4 = v4 * 3 + 3
+36280 LET t = t + v4 / 7
+36290 IF t < 0 THEN 36300
+36300 LET v5 = 31
+36310 LET v5 = v5 * 3 + 7
+36320 LET t = t + v5 / 7
+36330 IF t < 0 THEN 36340
+36340 LET v6 = 35
+36350 LET v6 = v6 * 3 + 11
+36360 LET t = t + v6 / 7
+36370 IF t < 0 THEN 36380
+36380 LET v7 = 39
+36390 LET v7 = v7 * 3 + 2
+36400 LET t = t + v7 / 7
+36410 IF t < 0 THEN 36420
+36420 LET v8 = 43
+36430 LET v8 = v8 * 3 + 6
+36440 LET t = t + v8 / 7
+36450 IF t < 0 THEN 36460
+36460 LET v9 = 47
+36470 LET v9 = v9 * 3 + 10
+36480 LET t = t + v9 / 7
+36490 IF t < 0 THEN 36500
+36500 LET v10 = 51
+36510 LET v10 = v10 * 3 + 1
+36520 LET t = t + v10 / 7
+36530 IF t < 0 THEN 36540
+36540 LET v11 = 55
+36550 LET v11 = v11 * 3 + 5
+36560 LET t = t + v11 / 7
+36570 IF t < 0 THEN 36580
+36580 LET v12 = 59
+36590 LET v12 = v12 * 3 + 9
+36600 LET t = t + v12 / 7
+36610 IF t < 0 THEN 36620
+36620 LET v13 = 63
+36630 LET v13 = v13 * 3 + 0
+36640 LET t = t + v13 / 7
+36650 IF t < 0 THEN 36660
+36660 LET v14 = 67
+36670 LET v14 = v14 * 3 + 4
+36680 LET t = t + v14 / 7
+36690 IF t < 0 THEN 36700
+36700 LET v15 = 71
+36710 LET v15 = v15 * 3 + 8
+36720 LET t = t + v15 / 7
+36730 IF t < 0 THEN 36740
+36740 LET v16 = 75
+36750 LET v16 = v16 * 3 + 12
+36760 LET t = t + v16 / 7
+36770 IF t < 0 THEN 36780
+36780 LET v17 = 79
+36790 LET v17 = v17 * 3 + 3
+36800 LET t = t + v17 / 7
+36810 IF t < 0 THEN 36820
+36820 LET v18 = 83
+36830 LET v18 = v18 * 3 + 7
+36840 LET t = t + v18 / 7
+36850 IF t < 0 THEN 36860
+36860 LET v19 = 87
+36870 LET v19 = v19 * 3 + 11
+36880 LET t = t + v19 / 7
+36890 IF t < 0 THEN 36900
+36900 LET v20 = 91
+36910 LET v20 = v20 * 3 + 2
+36920 LET t = t + v20 / 7
+36930 IF t < 0 THEN 36940
+36940 LET v21 = 95
+36950 LET v21 = v21 * 3 + 6
+36960 LET t = t + v21 / 7
+36970 IF t < 0 THEN 36980
+36980 LET v22 = 2
+36990 LET v22 = v22 * 3 + 10
+37000 LET t = t + v22 / 7
+37010 IF t < 0 THEN 37020
+37020 LET v23 = 6
+37030 LET v23 = v23 * 3 + 1
+37040 LET t = t + v23 / 7
+37050 IF t < 0 THEN 37060
+37060 LET v24 = 10
+37070 LET v24 = v24 * 3 + 5
+37080 LET t = t + v24 / 7
+37090 IF t < 0 THEN 37100
+37100 LET v25 = 14
+37110 LET v25 = v25 * 3 + 9
+37120 LET t = t + v25 / 7
+37130 IF t < 0 THEN 37140
+37140 LET v26 = 18
+37150 LET v26 = v26 * 3 + 0
+37160 LET t = t + v26 / 7
+37170 IF t < 0 THEN 37180
+37180 LET v27 = 22
+37190 LET v27 = v27 * 3 + 4
+37200 LET t = t + v27 / 7
+37210 IF t < 0 THEN 37220
+37220 LET v28 = 26
+37230 LET v28 = v28 * 3 + 8
+37240 LET t = t + v28 / 7
+37250 IF t < 0 THEN 37260
+37260 LET v29 = 30
+37270 LET v29 = v29 * 3 + 12
+37280 LET t = t + v29 / 7
+37290 IF t < 0 THEN 37300
+37300 LET v30 = 34
+37310 LET v30 = v30 * 3 + 3
+37320 LET t = t + v30 / 7
+37330 IF t < 0 THEN 37340
+37340 LET v31 = 38
+37350 LET v31 = v31 * 3 + 7
+37360 LET t = t + v31 / 7
+37370 IF t < 0 THEN 37380
+37380 LET v32 = 42
+37390 LET v32 = v32 * 3 + 11
+37400 LET t = t + v32 / 7
+37410 IF t < 0 THEN 37420
+37420 LET v33 = 46
+37430 LET v33 = v33 * 3 + 2
+37440 LET t = t + v33 / 7
+37450 IF t < 0 THEN 37460
+37460 LET v34 = 50
+37470 LET v34 = v34 * 3 + 6
+37480 LET t = t + v34 / 7
+37490 IF t < 0 THEN 37500
+37500 LET v35 = 54
+37510 LET v35 = v35 * 3 + 10
+37520 LET t = t + v35 / 7
+37530 IF t < 0 THEN 37540
+37540 LET v36 = 58
+37550 LET v36 = v36 * 3 + 1
+37560 LET t = t + v36 / 7
+37570 IF t < 0 THEN 37580
+37580 LET v37 = 62
+37590 LET v37 = v37 * 3 + 5
+37600 LET t = t + v37 / 7
+37610 IF t < 0 THEN 37620
+37620 LET v38 = 66
+37630 LET v38 = v38 * 3 + 9
+37640 LET t = t + v38 / 7
+37650 IF t < 0 THEN 37660
+37660 LET v39 = 70
+37670 LET v39 = v39 * 3 + 0
+37680 LET t = t + v39 / 7
+37690 IF t < 0 THEN 37700
+37700 LET v40 = 74
+37710 LET v40 = v40 * 3 + 4
+37720 LET t = t + v40 / 7
+37730 IF t < 0 THEN 37740
+37740 LET v41 = 78
+37750 LET v41 = v41 * 3 + 8
+37760 LET t = t + v41 / 7
+37770 IF t < 0 THEN 37780
+37780 LET v42 = 82
+37790 LET v42 = v42 * 3 + 12
+37800 LET t = t + v42 / 7
+37810 IF t < 0 THEN 37820
+37820 LET v43 = 86
+37830 LET v43 = v43 * 3 + 3
+37840 LET t = t + v43 / 7
+37850 IF t < 0 THEN 37860
+37860 LET v44 = 90
+37870 LET v44 = v44 * 3 + 7
+37880 LET t = t + v44 / 7
+37890 IF t < 0 THEN 37900
+37900 LET v45 = 94
+37910 LET v45 = v45 * 3 + 11
+37920 LET t = t + v45 / 7
+37930 IF t < 0 THEN 37940
+37940 LET v46 = 1
+37950 LET v46 = v46 * 3 + 2
+37960 LET t = t + v46 / 7
+37970 IF t < 0 THEN 37980
+37980 LET v47 = 5
+37990 LET v47 = v47 * 3 + 6
+38000 LET t = t + v47 / 7
+38010 IF t < 0 THEN 38020
+38020 LET v48 = 9
+38030 LET v48 = v48 * 3 + 10
+38040 LET t = t + v48 / 7
+38050 IF t < 0 THEN 38060
+38060 LET v49 = 13
+38070 LET v49 = v49 * 3 + 1
+38080 LET t = t + v49 / 7
+38090 IF t < 0 THEN 38100
+38100 LET v0 = 17
+38110 LET v0 = v0 * 3 + 5
+38120 LET t = t + v0 / 7
+38130 IF t < 0 THEN 38140
+38140 LET v1 = 21
+38150 LET v1 = v1 * 3 + 9
+38160 LET t = t + v1 / 7
+38170 IF t < 0 THEN 38180
+38180 LET v2 = 25
+38190 LET v2 = v2 * 3 + 0
+38200 LET t = t + v2 / 7
+38210 IF t < 0 THEN 38220
+38220 LET v3 = 29
+38230 LET v3 = v3 * 3 + 4
+38240 LET t = t + v3 / 7
+38250 IF t < 0 THEN 38260
+38260 LET v4 = 33
+38270 LET v4 = v4 * 3 + 8
+38280 LET t = t + v4 / 7
+38290 IF t < 0 THEN 38300
+38300 LET v5 = 37
+38310 LET v5 = v5 * 3 + 12
+38320 LET t = t + v5 / 7
+38330 IF t < 0 THEN 38340
+38340 LET v6 = 41
+38350 LET v6 = v6 * 3 + 3
+38360 LET t = t + v6 / 7
+38370 IF t < 0 THEN 38380
+38380 LET v7 = 45
+38390 LET v7 = v7 * 3 + 7
+38400 LET t = t + v7 / 7
+38410 IF t < 0 THEN 38420
+38420 LET v8 = 49
+38430 LET v8 = v8 * 3 + 11
+38440 LET t = t + v8 / 7
+38450 IF t < 0 THEN 38460
+38460 LET v9 = 53
+38470 LET v9 = v9 * 3 + 2
+38480 LET t = t + v9 / 7
+38490 IF t < 0 THEN 38500
+38500 LET v10 = 57
+38510 LET v10 = v10 * 3 + 6
+38520 LET t = t + v10 / 7
+38530 IF t < 0 THEN 38540
+38540 LET v11 = 61
+38550 LET v11 = v11 * 3 + 10
+38560 LET t = t + v11 / 7
+38570 IF t < 0 THEN 38580
+38580 LET v12 = 65
+38590 LET v12 = v12 * 3 + 1
+38600 LET t = t + v12 / 7
+38610 IF t < 0 THEN 38620
+38620 LET v13 = 69
+38630 LET v13 = v13 * 3 + 5
+38640 LET t = t + v13 / 7
+38650 IF t < 0 THEN 38660
+38660 LET v14 = 73
+38670 LET v14 = v14 * 3 + 9
+38680 LET t = t + v14 / 7
+38690 IF t < 0 THEN 38700
+38700 LET v15 = 77
+38710 LET v15 = v15 * 3 + 0
+38720 LET t = t + v15 / 7
+38730 IF t < 0 THEN 38740
+38740 LET v16 = 81
+38750 LET v16 = v16 * 3 + 4
+38760 LET t = t + v16 / 7
+38770 IF t < 0 THEN 38780
+38780 LET v17 = 85
+38790 LET v17 = v17 * 3 + 8
+38800 LET t = t + v17 / 7
+38810 IF t < 0 THEN 38820
+38820 LET v18 = 89
+38830 LET v18 = v18 * 3 + 12
+38840 LET t = t + v18 / 7
+38850 IF t < 0 THEN 38860
+38860 LET v19 = 93
+38870 LET v19 = v19 * 3 + 3
+38880 LET t = t + v19 / 7
+38890 IF t < 0 THEN 38900
+38900 LET v20 = 0
+38910 LET v20 = v20 * 3 + 7
+38920 LET t = t + v20 / 7
+38930 IF t < 0 THEN 38940
+38940 LET v21 = 4
+38950 LET v21 = v21 * 3 + 11
+38960 LET t = t + v21 / 7
+38970 IF t < 0 THEN 38980
+38980 LET v22 = 8
+38990 LET v22 = v22 * 3 + 2
+39000 LET t = t + v22 / 7
+39010 IF t < 0 THEN 39020
+39020 LET v23 = 12
+39030 LET v23 = v23 * 3 + 6
+39040 LET t = t + v23 / 7
+39050 IF t < 0 THEN 39060
+39060 LET v24 = 16
+39070 LET v24 = v24 * 3 + 10
+39080 LET t = t + v24 / 7
+39090 IF t < 0 THEN 39100
+39100 LET v25 = 20
+39110 LET v25 = v25 * 3 + 1
+39120 LET t = t + v25 / 7
+39130 IF t < 0 THEN 39140
+39140 LET v26 = 24
+39150 LET v26 = v26 * 3 + 5
+39160 LET t = t + v26 / 7
+39170 IF t < 0 THEN 39180
+39180 LET v27 = 28
+39190 LET v27 = v27 * 3 + 9
+39200 LET t = t + v27 / 7
+39210 IF t < 0 THEN 39220
+39220 LET v28 = 32
+39230 LET v28 = v28 * 3 + 0
+39240 LET t = t + v28 / 7
+39250 IF t < 0 THEN 39260
+39260 LET v29 = 36
+39270 LET v29 = v29 * 3 + 4
+39280 LET t = t + v29 / 7
+39290 IF t < 0 THEN 39300
+39300 LET v30 = 40
+39310 LET v30 = v30 * 3 + 8
+39320 LET t = t + v30 / 7
+39330 IF t < 0 THEN 39340
+39340 LET v31 = 44
+39350 LET v31 = v31 * 3 + 12
+39360 LET t = t + v31 / 7
+39370 IF t < 0 THEN 39380
+39380 LET v32 = 48
+39390 LET v32 = v32 * 3 + 3
+39400 LET t = t + v32 / 7
+39410 IF t < 0 THEN 39420
+39420 LET v33 = 52
+39430 LET v33 = v33 * 3 + 7
+39440 LET t = t + v33 / 7
+39450 IF t < 0 THEN 39460
+39460 LET v34 = 56
+39470 LET v34 = v34 * 3 + 11
+39480 LET t = t + v34 / 7
+39490 IF t < 0 THEN 39500
+39500 LET v35 = 60
+39510 LET v35 = v35 * 3 + 2
+39520 LET t = t + v35 / 7
+39530 IF t < 0 THEN 39540
+39540 LET v36 = 64
+39550 LET v36 = v36 * 3 + 6
+39560 LET t = t + v36 / 7
+39570 IF t < 0 THEN 39580
+39580 LET v37 = 68
+39590 LET v37 = v37 * 3 + 10
+39600 LET t = t + v37 / 7
+39610 IF t < 0 THEN 39620
+39620 LET v38 = 72
+39630 LET v38 = v38 * 3 + 1
+39640 LET t = t + v38 / 7
+39650 IF t < 0 THEN 39660
+39660 LET v39 = 76
+39670 LET v39 = v39 * 3 + 5
+39680 LET t = t + v39 / 7
+39690 IF t < 0 THEN 39700
+39700 LET v40 = 80
+39710 LET v40 = v40 * 3 + 9
+39720 LET t = t + v40 / 7
+39730 IF t < 0 THEN 39740
+39740 LET v41 = 84
+39750 LET v41 = v41 * 3 + 0
+39760 LET t = t + v41 / 7
+39770 IF t < 0 THEN 39780
+39780 LET v42 = 88
+39790 LET v42 = v42 * 3 + 4
+39800 LET t = t + v42 / 7
+39810 IF t < 0 THEN 39820
+39820 LET v43 = 92
+39830 LET v43 = v43 * 3 + 8
+39840 LET t = t + v43 / 7
+39850 IF t < 0 THEN 39860
+39860 LET v44 = 96
+39870 LET v44 = v44 * 3 + 12
+39880 LET t = t + v44 / 7
+39890 IF t < 0 THEN 39900
+39900 LET v45 = 3
+39910 LET v45 = v45 * 3 + 3
+39920 LET t = t + v45 / 7
+39930 IF t < 0 THEN 39940
+39940 LET v46 = 7
+39950 LET v46 = v46 * 3 + 7
+39960 LET t = t + v46 / 7
+39970 IF t < 0 THEN 39980
+39980 LET v47 = 11
+39990 LET v47 = v47 * 3 + 11
+40000 LET t = t + v47 / 7
+40010 IF t < 0 THEN 40020
+40020 LET v48 = 15
+40030 LET v48 = v48 * 3 + 2
+40040 LET t = t + v48 / 7
+40050 IF t < 0 THEN 40060
+40060 LET v49 = 19
+40070 LET v49 = v49 * 3 + 6
+40080 LET t = t + v49 / 7
+40090 IF t < 0 THEN 40100
+40100 LET v0 = 23
+40110 LET v0 = v0 * 3 + 10
+40120 LET t = t + v0 / 7
+40130 IF t < 0 THEN 40140
+40140 LET v1 = 27
+40150 LET v1 = v1 * 3 + 1
+40160 LET t = t + v1 / 7
+40170 IF t < 0 THEN 40180
+40180 LET v2 = 31
+40190 LET v2 = v2 * 3 + 5
+40200 LET t = t + v2 / 7
+40210 IF t < 0 THEN 40220
+40220 LET v3 = 35
+40230 LET v3 = v3 * 3 + 9
+40240 LET t = t + v3 / 7
+40250 IF t < 0 THEN 40260
+40260 LET v4 = 39
+40270 LET v4 = v4 * 3 + 0
+40280 LET t = t + v4 / 7
+40290 IF t < 0 THEN 40300
+40300 LET v5 = 43
+40310 LET v5 = v5 * 3 + 4
+40320 LET t = t + v5 / 7
+40330 IF t < 0 THEN 40340
+40340 LET v6 = 47
+40350 LET v6 = v6 * 3 + 8
+40360 LET t = t + v6 / 7
+40370 IF t < 0 THEN 40380
+40380 LET v7 = 51
+40390 LET v7 = v7 * 3 + 12
+40400 LET t = t + v7 / 7
+40410 IF t < 0 THEN 40420
+40420 LET v8 = 55
+40430 LET v8 = v8 * 3 + 3
+40440 LET t = t + v8 / 7
+40450 IF t < 0 THEN 40460
+40460 LET v9 = 59
+40470 LET v9 = v9 * 3 + 7
+40480 LET t = t + v9 / 7
+40490 IF t < 0 THEN 40500
+40500 LET v10 = 63
+40510 LET v10 = v10 * 3 + 11
+40520 LET t = t + v10 / 7
+40530 IF t < 0 THEN 40540
+40540 LET v11 = 67
+40550 LET v11 = v11 * 3 + 2
+40560 LET t = t + v11 / 7
+40570 IF t < 0 THEN 40580
+40580 LET v12 = 71
+40590 LET v12 = v12 * 3 + 6
+40600 LET t = t + v12 / 7
+40610 IF t < 0 THEN 40620
+40620 LET v13 = 75
+40630 LET v13 = v13 * 3 + 10
+40640 LET t = t + v13 / 7
+40650 IF t < 0 THEN 40660
+40660 LET v14 = 79
+40670 LET v14 = v14 * 3 + 1
+40680 LET t = t + v14 / 7
+40690 IF t < 0 THEN 40700
+40700 LET v15 = 83
+40710 LET v15 = v15 * 3 + 5
+40720 LET t = t + v15 / 7
+40730 IF t < 0 THEN 40740
+40740 LET v16 = 87
+40750 LET v16 = v16 * 3 + 9
+40760 LET t = t + v16 / 7
+40770 IF t < 0 THEN 40780
+40780 LET v17 = 91
+40790 LET v17 = v17 * 3 + 0
+40800 LET t = t + v17 / 7
+40810 IF t < 0 THEN 40820
+40820 LET v18 = 95
+40830 LET v18 = v18 * 3 + 4
+40840 LET t = t + v18 / 7
+40850 IF t < 0 THEN 40860
+40860 LET v19 = 2
+40870 LET v19 = v19 * 3 + 8
+40880 LET t = t + v19 / 7
+40890 IF t < 0 THEN 40900
+40900 LET v20 = 6
+40910 LET v20 = v20 * 3 + 12
+40920 LET t = t + v20 / 7
+40930 IF t < 0 THEN 40940
+40940 LET v21 = 10
+40950 LET v21 = v21 * 3 + 3
+40960 LET t = t + v21 / 7
+40970 IF t < 0 THEN 40980
+40980 LET v22 = 14
+40990 LET v22 = v22 * 3 + 7
+41000 LET t = t + v22 / 7
+41010 IF t < 0 THEN 41020
+41020 LET v23 = 18
+41030 LET v23 = v23 * 3 + 11
+41040 LET t = t + v23 / 7
+41050 IF t < 0 THEN 41060
+41060 LET v24 = 22
+41070 LET v24 = v24 * 3 + 2
+41080 LET t = t + v24 / 7
+41090 IF t < 0 THEN 41100
+41100 LET v25 = 26
+41110 LET v25 = v25 * 3 + 6
+41120 LET t = t + v25 / 7
+41130 IF t < 0 THEN 41140
+41140 LET v26 = 30
+41150 LET v26 = v26 * 3 + 10
+41160 LET t = t + v26 / 7
+41170 IF t < 0 THEN 41180
+41180 LET v27 = 34
+41190 LET v27 = v27 * 3 + 1
+41200 LET t = t + v27 / 7
+41210 IF t < 0 THEN 41220
+41220 LET v28 = 38
+41230 LET v28 = v28 * 3 + 5
+41240 LET t = t + v28 / 7
+41250 IF t < 0 THEN 41260
+41260 LET v29 = 42
+41270 LET v29 = v29 * 3 + 9
+41280 LET t = t + v29 / 7
+41290 IF t < 0 THEN 41300
+41300 LET v30 = 46
+41310 LET v30 = v30 * 3 + 0
+41320 LET t = t + v30 / 7
+41330 IF t < 0 THEN 41340
+41340 LET v31 = 50
+41350 LET v31 = v31 * 3 + 4
+41360 LET t = t + v31 / 7
+41370 IF t < 0 THEN 41380
+41380 LET v32 = 54
+41390 LET v32 = v32 * 3 + 8
+41400 LET t = t + v32 / 7
+41410 IF t < 0 THEN 41420
+41420 LET v33 = 58
+41430 LET v33 = v33 * 3 + 12
+41440 LET t = t + v33 / 7
+41450 IF t < 0 THEN 41460
+41460 LET v34 = 62
+41470 LET v34 = v34 * 3 + 3
+41480 LET t = t + v34 / 7
+41490 IF t < 0 THEN 41500
+41500 LET v35 = 66
+41510 LET v35 = v35 * 3 + 7
+41520 LET t = t + v35 / 7
+41530 IF t < 0 THEN 41540
+41540 LET v36 = 70
+41550 LET v36 = v36 * 3 + 11
+41560 LET t = t + v36 / 7
+41570 IF t < 0 THEN 41580
+41580 LET v37 = 74
+41590 LET v37 = v37 * 3 + 2
+41600 LET t = t + v37 / 7
+41610 IF t < 0 THEN 41620
+41620 LET v38 = 78
+41630 LET v38 = v38 * 3 + 6
+41640 LET t = t + v38 / 7
+41650 IF t < 0 THEN 41660
+41660 LET v39 = 82
+41670 LET v39 = v39 * 3 + 10
+41680 LET t = t + v39 / 7
+41690 IF t < 0 THEN 41700
+41700 LET v40 = 86
+41710 LET v40 = v40 * 3 + 1
+41720 LET t = t + v40 / 7
+41730 IF t < 0 THEN 41740
+41740 LET v41 = 90
+41750 LET v41 = v41 * 3 + 5
+41760 LET t = t + v41 / 7
+41770 IF t < 0 THEN 41780
+41780 LET v42 = 94
+41790 LET v42 = v42 * 3 + 9
+41800 LET t = t + v42 / 7
+41810 IF t < 0 THEN 41820
+41820 LET v43 = 1
+41830 LET v43 = v43 * 3 + 0
+41840 LET t = t + v43 / 7
+41850 IF t < 0 THEN 41860
+41860 LET v44 = 5
+41870 LET v44 = v44 * 3 + 4
+41880 LET t = t + v44 / 7
+41890 IF t < 0 THEN 41900
+41900 LET v45 = 9
+41910 LET v45 = v45 * 3 + 8
+41920 LET t = t + v45 / 7
+41930 IF t < 0 THEN 41940
+41940 LET v46 = 13
+41950 LET v46 = v46 * 3 + 12
+41960 LET t = t + v46 / 7
+41970 IF t < 0 THEN 41980
+41980 LET v47 = 17
+41990 LET v47 = v47 * 3 + 3
+42000 LET t = t + v47 / 7
+42010 IF t < 0 THEN 42020
+42020 LET v48 = 21
+42030 LET v48 = v48 * 3 + 7
+42040 LET t = t + v48 / 7
+42050 IF t < 0 THEN 42060
+42060 LET v49 = 25
+42070 LET v49 = v49 * 3 + 11
+42080 LET t = t + v49 / 7
+42090 IF t < 0 THEN 42100
+42100 LET v0 = 29
+42110 LET v0 = v0 * 3 + 2
+42120 LET t = t + v0 / 7
+42130 IF t < 0 THEN 42140
+42140 LET v1 = 33
+42150 LET v1 = v1 * 3 + 6
+42160 LET t = t + v1 / 7
+42170 IF t < 0 THEN 42180
+42180 LET v2 = 37
+42190 LET v2 = v2 * 3 + 10
+42200 LET t = t + v2 / 7
+42210 IF t < 0 THEN 42220
+42220 LET v3 = 41
+42230 LET v3 = v3 * 3 + 1
+42240 LET t = t + v3 / 7
+42250 IF t < 0 THEN 42260
+42260 LET v4 = 45
+42270 LET v4 = v4 * 3 + 5
+42280 LET t = t + v4 / 7
+42290 IF t < 0 THEN 42300
+42300 LET v5 = 49
+42310 LET v5 = v5 * 3 + 9
+42320 LET t = t + v5 / 7
+42330 IF t < 0 THEN 42340
+42340 LET v6 = 53
+42350 LET v6 = v6 * 3 + 0
+42360 LET t = t + v6 / 7
+42370 IF t < 0 THEN 42380
+42380 LET v7 = 57
+42390 LET v7 = v7 * 3 + 4
+42400 LET t = t + v7 / 7
+42410 IF t < 0 THEN 42420
+42420 LET v8 = 61
+42430 LET v8 = v8 * 3 + 8
+42440 LET t = t + v8 / 7
+42450 IF t < 0 THEN 42460
+42460 LET v9 = 65
+42470 LET v9 = v9 * 3 + 12
+42480 LET t = t + v9 / 7
+42490 IF t < 0 THEN 42500
+42500 LET v10 = 69
+42510 LET v10 = v10 * 3 + 3
+42520 LET t = t + v10 / 7
+42530 IF t < 0 THEN 42540
+42540 LET v11 = 73
+42550 LET v11 = v11 * 3 + 7
+42560 LET t = t + v11 / 7
+42570 IF t < 0 THEN 42580
+42580 LET v12 = 77
+42590 LET v12 = v12 * 3 + 11
+42600 LET t = t + v12 / 7
+42610 IF t < 0 THEN 42620
+42620 LET v13 = 81
+42630 LET v13 = v13 * 3 + 2
+42640 LET t = t + v13 / 7
+42650 IF t < 0 THEN 42660
+42660 LET v14 = 85
+42670 LET v14 = v14 * 3 + 6
+42680 LET t = t + v14 / 7
+42690 IF t < 0 THEN 42700
+42700 LET v15 = 89
+42710 LET v15 = v15 * 3 + 10
+42720 LET t = t + v15 / 7
+42730 IF t < 0 THEN 42740
+42740 LET v16 = 93
+42750 LET v16 = v16 * 3 + 1
+42760 LET t = t + v16 / 7
+42770 IF t < 0 THEN 42780
+42780 LET v17 = 0
+42790 LET v17 = v17 * 3 + 5
+42800 LET t = t + v17 / 7
+42810 IF t < 0 THEN 42820
+42820 LET v18 = 4
+42830 LET v18 = v18 * 3 + 9
+42840 LET t = t + v18 / 7
+42850 IF t < 0 THEN 42860
+42860 LET v19 = 8
+42870 LET v19 = v19 * 3 + 0
+42880 LET t = t + v19 / 7
+42890 IF t < 0 THEN 42900
+42900 LET v20 = 12
+42910 LET v20 = v20 * 3 + 4
+42920 LET t = t + v20 / 7
+42930 IF t < 0 THEN 42940
+42940 LET v21 = 16
+42950 LET v21 = v21 * 3 + 8
+42960 LET t = t + v21 / 7
+42970 IF t < 0 THEN 42980
+42980 LET v22 = 20
+42990 LET v22 = v22 * 3 + 12
+43000 LET t = t + v22 / 7
+43010 IF t < 0 THEN 43020
+43020 LET v23 = 24
+43030 LET v23 = v23 * 3 + 3
+43040 LET t = t + v23 / 7
+43050 IF t < 0 THEN 43060
+43060 LET v24 = 28
+43070 LET v24 = v24 * 3 + 7
+43080 LET t = t + v24 / 7
+43090 IF t < 0 THEN 43100
+43100 LET v25 = 32
+43110 LET v25 = v25 * 3 + 11
+43120 LET t = t + v25 / 7
+43130 IF t < 0 THEN 43140
+43140 LET v26 = 36
+43150 LET v26 = v26 * 3 + 2
+43160 LET t = t + v26 / 7
+43170 IF t < 0 THEN 43180
+43180 LET v27 = 40
+43190 LET v27 = v27 * 3 + 6
+43200 LET t = t + v27 / 7
+43210 IF t < 0 THEN 43220
+43220 LET v28 = 44
+43230 LET v28 = v28 * 3 + 10
+43240 LET t = t + v28 / 7
+43250 IF t < 0 THEN 43260
+43260 LET v29 = 48
+43270 LET v29 = v29 * 3 + 1
+43280 LET t = t + v29 / 7
+43290 IF t < 0 THEN 43300
+43300 LET v30 = 52
+43310 LET v30 = v30 * 3 + 5
+43320 LET t = t + v30 / 7
+43330 IF t < 0 THEN 43340
+43340 LET v31 = 56
+43350 LET v31 = v31 * 3 + 9
+43360 LET t = t + v31 / 7
+43370 IF t < 0 THEN 43380
+43380 LET v32 = 60
+43390 LET v32 = v32 * 3 + 0
+43400 LET t = t + v32 / 7
+43410 IF t < 0 THEN 43420
+43420 LET v33 = 64
+43430 LET v33 = v33 * 3 + 4
+43440 LET t = t + v33 / 7
+43450 IF t < 0 THEN 43460
+43460 LET v34 = 68
+43470 LET v34 = v34 * 3 + 8
+43480 LET t = t + v34 / 7
+43490 IF t < 0 THEN 43500
+43500 LET v35 = 72
+43510 LET v35 = v35 * 3 + 12
+43520 LET t = t + v35 / 7
+43530 IF t < 0 THEN 43540
+43540 LET v36 = 76
+43550 LET v36 = v36 * 3 + 3
+43560 LET t = t + v36 / 7
+43570 IF t < 0 THEN 43580
+43580 LET v37 = 80
+43590 LET v37 = v37 * 3 + 7
+43600 LET t = t + v37 / 7
+43610 IF t < 0 THEN 43620
+43620 LET v38 = 84
+43630 LET v38 = v38 * 3 + 11
+43640 LET t = t + v38 / 7
+43650 IF t < 0 THEN 43660
+43660 LET v39 = 88
+43670 LET v39 = v39 * 3 + 2
+43680 LET t = t + v39 / 7
+43690 IF t < 0 THEN 43700
+43700 LET v40 = 92
+43710 LET v40 = v40 * 3 + 6
+43720 LET t = t + v40 / 7
+43730 IF t < 0 THEN 43740
+43740 LET v41 = 96
+43750 LET v41 = v41 * 3 + 10
+43760 LET t = t + v41 / 7
+43770 IF t < 0 THEN 43780
+43780 LET v42 = 3
+43790 LET v42 = v42 * 3 + 1
+43800 LET t = t + v42 / 7
+43810 IF t < 0 THEN 43820
+43820 LET v43 = 7
+43830 LET v43 = v43 * 3 + 5
+43840 LET t = t + v43 / 7
+43850 IF t < 0 THEN 43860
+43860 LET v44 = 11
+43870 LET v44 = v44 * 3 + 9
+43880 LET t = t + v44 / 7
+43890 IF t < 0 THEN 43900
+43900 LET v45 = 15
+43910 LET v45 = v45 * 3 + 0
+43920 LET t = t + v45 / 7
+43930 IF t < 0 THEN 43940
+43940 LET v46 = 19
+43950 LET v46 = v46 * 3 + 4
+43960 LET t = t + v46 / 7
+43970 IF t < 0 THEN 43980
+43980 LET v47 = 23
+43990 LET v47 = v47 * 3 + 8
+44000 LET t = t + v47 / 7
+44010 IF t < 0 THEN 44020
+44020 LET v48 = 27
+44030 LET v48 = v48 * 3 + 12
+44040 LET t = t + v48 / 7
+44050 IF t < 0 THEN 44060
+44060 LET v49 = 31
+44070 LET v49 = v49 * 3 + 3
+44080 LET t = t + v49 / 7
+44090 IF t < 0 THEN 44100
+44100 LET v0 = 35
+44110 LET v0 = v0 * 3 + 7
+44120 LET t = t + v0 / 7
+44130 IF t < 0 THEN 44140
+44140 LET v1 = 39
+44150 LET v1 = v1 * 3 + 11
+44160 LET t = t + v1 / 7
+44170 IF t < 0 THEN 44180
+44180 LET v2 = 43
+44190 LET v2 = v2 * 3 + 2
+44200 LET t = t + v2 / 7
+44210 IF t < 0 THEN 44220
+44220 LET v3 = 47
+44230 LET v3 = v3 * 3 + 6
+44240 LET t = t + v3 / 7
+44250 IF t < 0 THEN 44260
+44260 LET v4 = 51
+44270 LET v4 = v4 * 3 + 10
+44280 LET t = t + v4 / 7
+44290 IF t < 0 THEN 44300
+44300 LET v5 = 55
+44310 LET v5 = v5 * 3 + 1
+44320 LET t = t + v5 / 7
+44330 IF t < 0 THEN 44340
+44340 LET v6 = 59
+44350 LET v6 = v6 * 3 + 5
+44360 LET t = t + v6 / 7
+44370 IF t < 0 THEN 44380
+44380 LET v7 = 63
+44390 LET v7 = v7 * 3 + 9
+44400 LET t = t + v7 / 7
+44410 IF t < 0 THEN 44420
+44420 LET v8 = 67
+44430 LET v8 = v8 * 3 + 0
+44440 LET t = t + v8 / 7
+44450 IF t < 0 THEN 44460
+44460 LET v9 = 71
+44470 LET v9 = v9 * 3 + 4
+44480 LET t = t + v9 / 7
+44490 IF t < 0 THEN 44500
+44500 LET v10 = 75
+44510 LET v10 = v10 * 3 + 8
+44520 LET t = t + v10 / 7
+44530 IF t < 0 THEN 44540
+44540 LET v11 = 79
+44550 LET v11 = v11 * 3 + 12
+44560 LET t = t + v11 / 7
+44570 IF t < 0 THEN 44580
+44580 LET v12 = 83
+44590 LET v12 = v12 * 3 + 3
+44600 LET t = t + v12 / 7
+44610 IF t < 0 THEN 44620
+44620 LET v13 = 87
+44630 LET v13 = v13 * 3 + 7
+44640 LET t = t + v13 / 7
+44650 IF t < 0 THEN 44660
+44660 LET v14 = 91
+44670 LET v14 = v14 * 3 + 11
+44680 LET t = t + v14 / 7
+44690 IF t < 0 THEN 44700
+44700 LET v15 = 95
+44710 LET v15 = v15 * 3 + 2
+44720 LET t = t + v15 / 7
+44730 IF t < 0 THEN 44740
+44740 LET v16 = 2
+44750 LET v16 = v16 * 3 + 6
+44760 LET t = t + v16 / 7
+44770 IF t < 0 THEN 44780
+44780 LET v17 = 6
+44790 LET v17 = v17 * 3 + 10
+44800 LET t = t + v17 / 7
+44810 IF t < 0 THEN 44820
+44820 LET v18 = 10
+44830 LET v18 = v18 * 3 + 1
+44840 LET t = t + v18 / 7
+44850 IF t < 0 THEN 44860
+44860 LET v19 = 14
+44870 LET v19 = v19 * 3 + 5
+44880 LET t = t + v19 / 7
+44890 IF t < 0 THEN 44900
+44900 LET v20 = 18
+44910 LET v20 = v20 * 3 + 9
+44920 LET t = t + v20 / 7
+44930 IF t < 0 THEN 44940
+44940 LET v21 = 22
+44950 LET v21 = v21 * 3 + 0
+44960 LET t = t + v21 / 7
+44970 IF t < 0 THEN 44980
+44980 LET v22 = 26
+44990 LET v22 = v22 * 3 + 4
+45000 LET t = t + v22 / 7
+45010 IF t < 0 THEN 45020
+45020 LET v23 = 30
+45030 LET v23 = v23 * 3 + 8
+45040 LET t = t + v23 / 7
+45050 IF t < 0 THEN 45060
+45060 LET v24 = 34
+45070 LET v24 = v24 * 3 + 12
+45080 LET t = t + v24 / 7
+45090 IF t < 0 THEN 45100
+45100 LET v25 = 38
+45110 LET v25 = v25 * 3 + 3
+45120 LET t = t + v25 / 7
+45130 IF t < 0 THEN 45140
+45140 LET v26 = 42
+45150 LET v26 = v26 * 3 + 7
+45160 LET t = t + v26 / 7
+45170 IF t < 0 THEN 45180
+45180 LET v27 = 46
+45190 LET v27 = v27 * 3 + 11
+45200 LET t = t + v27 / 7
+45210 IF t < 0 THEN 45220
+45220 LET v28 = 50
+45230 LET v28 = v28 * 3 + 2
+45240 LET t = t + v28 / 7
+45250 IF t < 0 THEN 45260
+45260 LET v29 = 54
+45270 LET v29 = v29 * 3 + 6
+45280 LET t = t + v29 / 7
+45290 IF t < 0 THEN 45300
+45300 LET v30 = 58
+45310 LET v30 = v30 * 3 + 10
+45320 LET t = t + v30 / 7
+45330 IF t < 0 THEN 45340
+45340 LET v31 = 62
+45350 LET v31 = v31 * 3 + 1
+45360 LET t = t + v31 / 7
+45370 IF t < 0 THEN 45380
+45380 LET v32 = 66
+45390 LET v32 = v32 * 3 + 5
+45400 LET t = t + v32 / 7
+45410 IF t < 0 THEN 45420
+45420 LET v33 = 70
+45430 LET v33 = v33 * 3 + 9
+45440 LET t = t + v33 / 7
+45450 IF t < 0 THEN 45460
+45460 LET v34 = 74
+45470 LET v34 = v34 * 3 + 0
+45480 LET t = t + v34 / 7
+45490 IF t < 0 THEN 45500
+45500 LET v35 = 78
+45510 LET v35 = v35 * 3 + 4
+45520 LET t = t + v35 / 7
+45530 IF t < 0 THEN 45540
+45540 LET v36 = 82
+45550 LET v36 = v36 * 3 + 8
+45560 LET t = t + v36 / 7
+45570 IF t < 0 THEN 45580
+45580 LET v37 = 86
+45590 LET v37 = v37 * 3 + 12
+45600 LET t = t + v37 / 7
+45610 IF t < 0 THEN 45620
+45620 LET v38 = 90
+45630 LET v38 = v38 * 3 + 3
+45640 LET t = t + v38 / 7
+45650 IF t < 0 THEN 45660
+45660 LET v39 = 94
+45670 LET v39 = v39 * 3 + 7
+45680 LET t = t + v39 / 7
+45690 IF t < 0 THEN 45700
+45700 LET v40 = 1
+45710 LET v40 = v40 * 3 + 11
+45720 LET t = t + v40 / 7
+45730 IF t < 0 THEN 45740
+45740 LET v41 = 5
+45750 LET v41 = v41 * 3 + 2
+45760 LET t = t + v41 / 7
+45770 IF t < 0 THEN 45780
+45780 LET v42 = 9
+45790 LET v42 = v42 * 3 + 6
+45800 LET t = t + v42 / 7
+45810 IF t < 0 THEN 45820
+45820 LET v43 = 13
+45830 LET v43 = v43 * 3 + 10
+45840 LET t = t + v43 / 7
+45850 IF t < 0 THEN 45860
+45860 LET v44 = 17
+45870 LET v44 = v44 * 3 + 1
+45880 LET t = t + v44 / 7
+45890 IF t < 0 THEN 45900
+45900 LET v45 = 21
+45910 LET v45 = v45 * 3 + 5
+45920 LET t = t + v45 / 7
+45930 IF t < 0 THEN 45940
+45940 LET v46 = 25
+45950 LET v46 = v46 * 3 + 9
+45960 LET t = t + v46 / 7
+45970 IF t < 0 THEN 45980
+45980 LET v47 = 29
+45990 LET v47 = v47 * 3 + 0
+46000 LET t = t + v47 / 7
+46010 IF t < 0 THEN 46020
+46020 LET v48 = 33
+46030 LET v48 = v48 * 3 + 4
+46040 LET t = t + v48 / 7
+46050 IF t < 0 THEN 46060
+46060 LET v49 = 37
+46070 LET v49 = v49 * 3 + 8
+46080 LET t = t + v49 / 7
+46090 IF t < 0 THEN 46100
+46100 LET v0 = 41
+46110 LET v0 = v0 * 3 + 12
+46120 LET t = t + v0 / 7
+46130 IF t < 0 THEN 46140
+46140 LET v1 = 45
+46150 LET v1 = v1 * 3 + 3
+46160 LET t = t + v1 / 7
+46170 IF t < 0 THEN 46180
+46180 LET v2 = 49
+46190 LET v2 = v2 * 3 + 7
+46200 LET t = t + v2 / 7
+46210 IF t < 0 THEN 46220
+46220 LET v3 = 53
+46230 LET v3 = v3 * 3 + 11
+46240 LET t = t + v3 / 7
+46250 IF t < 0 THEN 46260
+46260 LET v4 = 57
+46270 LET v4 = v4 * 3 + 2
+46280 LET t = t + v4 / 7
+46290 IF t < 0 THEN 46300
+46300 LET v5 = 61
+46310 LET v5 = v5 * 3 + 6
+46320 LET t = t + v5 / 7
+46330 IF t < 0 THEN 46340
+46340 LET v6 = 65
+46350 LET v6 = v6 * 3 + 10
+46360 LET t = t + v6 / 7
+46370 IF t < 0 THEN 46380
+46380 LET v7 = 69
+46390 LET v7 = v7 * 3 + 1
+46400 LET t = t + v7 / 7
+46410 IF t < 0 THEN 46420
+46420 LET v8 = 73
+46430 LET v8 = v8 * 3 + 5
+46440 LET t = t + v8 / 7
+46450 IF t < 0 THEN 46460
+46460 LET v9 = 77
+46470 LET v9 = v9 * 3 + 9
+46480 LET t = t + v9 / 7
+46490 IF t < 0 THEN 46500
+46500 LET v10 = 81
+46510 LET v10 = v10 * 3 + 0
+46520 LET t = t + v10 / 7
+46530 IF t < 0 THEN 46540
+46540 LET v11 = 85
+46550 LET v11 = v11 * 3 + 4
+46560 LET t = t + v11 / 7
+46570 IF t < 0 THEN 46580
+46580 LET v12 = 89
+46590 LET v12 = v12 * 3 + 8
+46600 LET t = t + v12 / 7
+46610 IF t < 0 THEN 46620
+46620 LET v13 = 93
+46630 LET v13 = v13 * 3 + 12
+46640 LET t = t + v13 / 7
+46650 IF t < 0 THEN 46660
+46660 LET v14 = 0
+46670 LET v14 = v14 * 3 + 3
+46680 LET t = t + v14 / 7
+46690 IF t < 0 THEN 46700
+46700 LET v15 = 4
+46710 LET v15 = v15 * 3 + 7
+46720 LET t = t + v15 / 7
+46730 IF t < 0 THEN 46740
+46740 LET v16 = 8
+46750 LET v16 = v16 * 3 + 11
+46760 LET t = t + v16 / 7
+46770 IF t < 0 THEN 46780
+46780 LET v17 = 12
+46790 LET v17 = v17 * 3 + 2
+46800 LET t = t + v17 / 7
+46810 IF t < 0 THEN 46820
+46820 LET v18 = 16
+46830 LET v18 = v18 * 3 + 6
+46840 LET t = t + v18 / 7
+46850 IF t < 0 THEN 46860
+46860 LET v19 = 20
+46870 LET v19 = v19 * 3 + 10
+46880 LET t = t + v19 / 7
+46890 IF t < 0 THEN 46900
+46900 LET v20 = 24
+46910 LET v20 = v20 * 3 + 1
+46920 LET t = t + v20 / 7
+46930 IF t < 0 THEN 46940
+46940 LET v21 = 28
+46950 LET v21 = v21 * 3 + 5
+46960 LET t = t + v21 / 7
+46970 IF t < 0 THEN 46980
+46980 LET v22 = 32
+46990 LET v22 = v22 * 3 + 9
+47000 LET t = t + v22 / 7
+47010 IF t < 0 THEN 47020
+47020 LET v23 = 36
+47030 LET v23 = v23 * 3 + 0
+47040 LET t = t + v23 / 7
+47050 IF t < 0 THEN 47060
+47060 LET v24 = 40
+47070 LET v24 = v24 * 3 + 4
+47080 LET t = t + v24 / 7
+47090 IF t < 0 THEN 47100
+47100 LET v25 = 44
+47110 LET v25 = v25 * 3 + 8
+47120 LET t = t + v25 / 7
+47130 IF t < 0 THEN 47140
+47140 LET v26 = 48
+47150 LET v26 = v26 * 3 + 12
+47160 LET t = t + v26 / 7
+47170 IF t < 0 THEN 47180
+47180 LET v27 = 52
+47190 LET v27 = v27 * 3 + 3
+47200 LET t = t + v27 / 7
+47210 IF t < 0 THEN 47220
+47220 LET v28 = 56
+47230 LET v28 = v28 * 3 + 7
+47240 LET t = t + v28 / 7
+47250 IF t < 0 THEN 47260
+47260 LET v29 = 60
+47270 LET v29 = v29 * 3 + 11
+47280 LET t = t + v29 / 7
+47290 IF t < 0 THEN 47300
+47300 LET v30 = 64
+47310 LET v30 = v30 * 3 + 2
+47320 LET t = t + v30 / 7
+47330 IF t < 0 THEN 47340
+47340 LET v31 = 68
+47350 LET v31 = v31 * 3 + 6
+47360 LET t = t + v31 / 7
+47370 IF t < 0 THEN 47380
+47380 LET v32 = 72
+47390 LET v32 = v32 * 3 + 10
+47400 LET t = t + v32 / 7
+47410 IF t < 0 THEN 47420
+47420 LET v33 = 76
+47430 LET v33 = v33 * 3 + 1
+47440 LET t = t + v33 / 7
+47450 IF t < 0 THEN 47460
+47460 LET v34 = 80
+47470 LET v34 = v34 * 3 + 5
+47480 LET t = t + v34 / 7
+47490 IF t < 0 THEN 47500
+47500 LET v35 = 84
+47510 LET v35 = v35 * 3 + 9
+47520 LET t = t + v35 / 7
+47530 IF t < 0 THEN 47540
+47540 LET v36 = 88
+47550 LET v36 = v36 * 3 + 0
+47560 LET t = t + v36 / 7
+47570 IF t < 0 THEN 47580
+47580 LET v37 = 92
+47590 LET v37 = v37 * 3 + 4
+47600 LET t = t + v37 / 7
+47610 IF t < 0 THEN 47620
+47620 LET v38 = 96
+47630 LET v38 = v38 * 3 + 8
+47640 LET t = t + v38 / 7
+47650 IF t < 0 THEN 47660
+47660 LET v39 = 3
+47670 LET v39 = v39 * 3 + 12
+47680 LET t = t + v39 / 7
+47690 IF t < 0 THEN 47700
+47700 LET v40 = 7
+47710 LET v40 = v40 * 3 + 3
+47720 LET t = t + v40 / 7
+47730 IF t < 0 THEN 47740
+47740 LET v41 = 11
+47750 LET v41 = v41 * 3 + 7
+47760 LET t = t + v41 / 7
+47770 IF t < 0 THEN 47780
+47780 LET v42 = 15
+47790 LET v42 = v42 * 3 + 11
+47800 LET t = t + v42 / 7
+47810 IF t < 0 THEN 47820
+47820 LET v43 = 19
+47830 LET v43 = v43 * 3 + 2
+47840 LET t = t + v43 / 7
+47850 IF t < 0 THEN 47860
+47860 LET v44 = 23
+47870 LET v44 = v44 * 3 + 6
+47880 LET t = t + v44 / 7
+47890 IF t < 0 THEN 47900
+47900 LET v45 = 27
+47910 LET v45 = v45 * 3 + 10
+47920 LET t = t + v45 / 7
+47930 IF t < 0 THEN 47940
+47940 LET v46 = 31
+47950 LET v46 = v46 * 3 + 1
+47960 LET t = t + v46 / 7
+47970 IF t < 0 THEN 47980
+47980 LET v47 = 35
+47990 LET v47 = v47 * 3 + 5
+48000 LET t = t + v47 / 7
+48010 IF t < 0 THEN 48020
+48020 LET v48 = 39
+48030 LET v48 = v48 * 3 + 9
+48040 LET t = t + v48 / 7
+48050 IF t < 0 THEN 48060
+48060 LET v49 = 43
+48070 LET v49 = v49 * 3 + 0
+48080 LET t = t + v49 / 7
+48090 IF t < 0 THEN 48100
+48100 LET v0 = 47
+48110 LET v0 = v0 * 3 + 4
+48120 LET t = t + v0 / 7
+48130 IF t < 0 THEN 48140
+48140 LET v1 = 51
+48150 LET v1 = v1 * 3 + 8
+48160 LET t = t + v1 / 7
+48170 IF t < 0 THEN 48180
+48180 LET v2 = 55
+48190 LET v2 = v2 * 3 + 12
+48200 LET t = t + v2 / 7
+48210 IF t < 0 THEN 48220
+48220 LET v3 = 59
+48230 LET v3 = v3 * 3 + 3
+48240 LET t = t + v3 / 7
+48250 IF t < 0 THEN 48260
+48260 LET v4 = 63
+48270 LET v4 = v4 * 3 + 7
+48280 LET t = t + v4 / 7
+48290 IF t < 0 THEN 48300
+48300 LET v5 = 67
+48310 LET v5 = v5 * 3 + 11
+48320 LET t = t + v5 / 7
+48330 IF t < 0 THEN 48340
+48340 LET v6 = 71
+48350 LET v6 = v6 * 3 + 2
+48360 LET t = t + v6 / 7
+48370 IF t < 0 THEN 48380
+48380 LET v7 = 75
+48390 LET v7 = v7 * 3 + 6
+48400 LET t = t + v7 / 7
+48410 IF t < 0 THEN 48420
+48420 LET v8 = 79
+48430 LET v8 = v8 * 3 + 10
+48440 LET t = t + v8 / 7
+48450 IF t < 0 THEN 48460
+48460 LET v9 = 83
+48470 LET v9 = v9 * 3 + 1
+48480 LET t = t + v9 / 7
+48490 IF t < 0 THEN 48500
+48500 LET v10 = 87
+48510 LET v10 = v10 * 3 + 5
+48520 LET t = t + v10 / 7
+48530 IF t < 0 THEN 48540
+48540 LET v11 = 91
+48550 LET v11 = v11 * 3 + 9
+48560 LET t = t + v11 / 7
+48570 IF t < 0 THEN 48580
+48580 LET v12 = 95
+48590 LET v12 = v12 * 3 + 0
+48600 LET t = t + v12 / 7
+48610 IF t < 0 THEN 48620
+48620 LET v13 = 2
+48630 LET v13 = v13 * 3 + 4
+48640 LET t = t + v13 / 7
+48650 IF t < 0 THEN 48660
+48660 LET v14 = 6
+48670 LET v14 = v14 * 3 + 8
+48680 LET t = t + v14 / 7
+48690 IF t < 0 THEN 48700
+48700 LET v15 = 10
+48710 LET v15 = v15 * 3 + 12
+48720 LET t = t + v15 / 7
+48730 IF t < 0 THEN 48740
+48740 LET v16 = 14
+48750 LET v16 = v16 * 3 + 3
+48760 LET t = t + v16 / 7
+48770 IF t < 0 THEN 48780
+48780 LET v17 = 18
+48790 LET v17 = v17 * 3 + 7
+48800 LET t = t + v17 / 7
+48810 IF t < 0 THEN 48820
+48820 LET v18 = 22
+48830 LET v18 = v18 * 3 + 11
+48840 LET t = t + v18 / 7
+48850 IF t < 0 THEN 48860
+48860 LET v19 = 26
+48870 LET v19 = v19 * 3 + 2
+48880 LET t = t + v19 / 7
+48890 IF t < 0 THEN 48900
+48900 LET v20 = 30
+48910 LET v20 = v20 * 3 + 6
+48920 LET t = t + v20 / 7
+48930 IF t < 0 THEN 48940
+48940 LET v21 = 34
+48950 LET v21 = v21 * 3 + 10
+48960 LET t = t + v21 / 7
+48970 IF t < 0 THEN 48980
+48980 LET v22 = 38
+48990 LET v22 = v22 * 3 + 1
+49000 LET t = t + v22 / 7
+49010 IF t < 0 THEN 49020
+49020 LET v23 = 42
+49030 LET v23 = v23 * 3 + 5
+49040 LET t = t + v23 / 7
+49050 IF t < 0 THEN 49060
+49060 LET v24 = 46
+49070 LET v24 = v24 * 3 + 9
+49080 LET t = t + v24 / 7
+49090 IF t < 0 THEN 49100
+49100 LET v25 = 50
+49110 LET v25 = v25 * 3 + 0
+49120 LET t = t + v25 / 7
+49130 IF t < 0 THEN 49140
+49140 LET v26 = 54
+49150 LET v26 = v26 * 3 + 4
+49160 LET t = t + v26 / 7
+49170 IF t < 0 THEN 49180
+49180 LET v27 = 58
+49190 LET v27 = v27 * 3 + 8
+49200 LET t = t + v27 / 7
+49210 IF t < 0 THEN 49220
+49220 LET v28 = 62
+49230 LET v28 = v28 * 3 + 12
+49240 LET t = t + v28 / 7
+49250 IF t < 0 THEN 49260
+49260 LET v29 = 66
+49270 LET v29 = v29 * 3 + 3
+49280 LET t = t + v29 / 7
+49290 IF t < 0 THEN 49300
+49300 LET v30 = 70
+49310 LET v30 = v30 * 3 + 7
+49320 LET t = t + v30 / 7
+49330 IF t < 0 THEN 49340
+49340 LET v31 = 74
+49350 LET v31 = v31 * 3 + 11
+49360 LET t = t + v31 / 7
+49370 IF t < 0 THEN 49380
+49380 LET v32 = 78
+49390 LET v32 = v32 * 3 + 2
+49400 LET t = t + v32 / 7
+49410 IF t < 0 THEN 49420
+49420 LET v33 = 82
+49430 LET v33 = v33 * 3 + 6
+49440 LET t = t + v33 / 7
+49450 IF t < 0 THEN 49460
+49460 LET v34 = 86
+49470 LET v34 = v34 * 3 + 10
+49480 LET t = t + v34 / 7
+49490 IF t < 0 THEN 49500
+49500 LET v35 = 90
+49510 LET v35 = v35 * 3 + 1
+49520 LET t = t + v35 / 7
+49530 IF t < 0 THEN 49540
+49540 LET v36 = 94
+49550 LET v36 = v36 * 3 + 5
+49560 LET t = t + v36 / 7
+49570 IF t < 0 THEN 49580
+49580 LET v37 = 1
+49590 LET v37 = v37 * 3 + 9
+49600 LET t = t + v37 / 7
+49610 IF t < 0 THEN 49620
+49620 LET v38 = 5
+49630 LET v38 = v38 * 3 + 0
+49640 LET t = t + v38 / 7
+49650 IF t < 0 THEN 49660
+49660 LET v39 = 9
+49670 LET v39 = v39 * 3 + 4
+49680 LET t = t + v39 / 7
+49690 IF t < 0 THEN 49700
+49700 LET v40 = 13
+49710 LET v40 = v40 * 3 + 8
+49720 LET t = t + v40 / 7
+49730 IF t < 0 THEN 49740
+49740 LET v41 = 17
+49750 LET v41 = v41 * 3 + 12
+49760 LET t = t + v41 / 7
+49770 IF t < 0 THEN 49780
+49780 LET v42 = 21
+49790 LET v42 = v42 * 3 + 3
+49800 LET t = t + v42 / 7
+49810 IF t < 0 THEN 49820
+49820 LET v43 = 25
+49830 LET v43 = v43 * 3 + 7
+49840 LET t = t + v43 / 7
+49850 IF t < 0 THEN 49860
+49860 LET v44 = 29
+49870 LET v44 = v44 * 3 + 11
+49880 LET t = t + v44 / 7
+49890 IF t < 0 THEN 49900
+49900 LET v45 = 33
+49910 LET v45 = v45 * 3 + 2
+49920 LET t = t + v45 / 7
+49930 IF t < 0 THEN 49940
+49940 LET v46 = 37
+49950 LET v46 = v46 * 3 + 6
+49960 LET t = t + v46 / 7
+49970 IF t < 0 THEN 49980
+49980 LET v47 = 41
+49990 LET v47 = v47 * 3 + 10
+50000 LET t = t + v47 / 7
+50010 IF t < 0 THEN 50020
+50020 LET v48 = 45
+50030 LET v48 = v48 * 3 + 1
+50040 LET t = t + v48 / 7
+50050 IF t < 0 THEN 50060
+50060 LET v49 = 49
+50070 LET v49 = v49 * 3 + 5
+50080 LET t = t + v49 / 7
+50090 IF t < 0 THEN 50100
+50100 LET v0 = 53
+50110 LET v0 = v0 * 3 + 9
+50120 LET t = t + v0 / 7
+50130 IF t < 0 THEN 50140
+50140 LET v1 = 57
+50150 LET v1 = v1 * 3 + 0
+50160 LET t = t + v1 / 7
+50170 IF t < 0 THEN 50180
+50180 LET v2 = 61
+50190 LET v2 = v2 * 3 + 4
+50200 LET t = t + v2 / 7
+50210 IF t < 0 THEN 50220
+50220 LET v3 = 65
+50230 LET v3 = v3 * 3 + 8
+50240 LET t = t + v3 / 7
+50250 IF t < 0 THEN 50260
+50260 LET v4 = 69
+50270 LET v4 = v4 * 3 + 12
+50280 LET t = t + v4 / 7
+50290 IF t < 0 THEN 50300
+50300 LET v5 = 73
+50310 LET v5 = v5 * 3 + 3
+50320 LET t = t + v5 / 7
+50330 IF t < 0 THEN 50340
+50340 LET v6 = 77
+50350 LET v6 = v6 * 3 + 7
+50360 LET t = t + v6 / 7
+50370 IF t < 0 THEN 50380
+50380 LET v7 = 81
+50390 LET v7 = v7 * 3 + 11
+50400 LET t = t + v7 / 7
+50410 IF t < 0 THEN 50420
+50420 LET v8 = 85
+50430 LET v8 = v8 * 3 + 2
+50440 LET t = t + v8 / 7
+50450 IF t < 0 THEN 50460
+50460 LET v9 = 89
+50470 LET v9 = v9 * 3 + 6
+50480 LET t = t + v9 / 7
+50490 IF t < 0 THEN 50500
+50500 LET v10 = 93
+50510 LET v10 = v10 * 3 + 10
+50520 LET t = t + v10 / 7
+50530 IF t < 0 THEN 50540
+50540 LET v11 = 0
+50550 LET v11 = v11 * 3 + 1
+50560 LET t = t + v11 / 7
+50570 IF t < 0 THEN 50580
+50580 LET v12 = 4
+50590 LET v12 = v12 * 3 + 5
+50600 LET t = t + v12 / 7
+50610 IF t < 0 THEN 50620
+50620 LET v13 = 8
+50630 LET v13 = v13 * 3 + 9
+50640 LET t = t + v13 / 7
+50650 IF t < 0 THEN 50660
+50660 LET v14 = 12
+50670 LET v14 = v14 * 3 + 0
+50680 LET t = t + v14 / 7
+50690 IF t < 0 THEN 50700
+50700 LET v15 = 16
+50710 LET v15 = v15 * 3 + 4
+50720 LET t = t + v15 / 7
+50730 IF t < 0 THEN 50740
+50740 LET v16 = 20
+50750 LET v16 = v16 * 3 + 8
+50760 LET t = t + v16 / 7
+50770 IF t < 0 THEN 50780
+50780 LET v17 = 24
+50790 LET v17 = v17 * 3 + 12
+50800 LET t = t + v17 / 7
+50810 IF t < 0 THEN 50820
+50820 LET v18 = 28
+50830 LET v18 = v18 * 3 + 3
+50840 LET t = t + v18 / 7
+50850 IF t < 0 THEN 50860
+50860 LET v19 = 32
+50870 LET v19 = v19 * 3 + 7
+50880 LET t = t + v19 / 7
+50890 IF t < 0 THEN 50900
+50900 LET v20 = 36
+50910 LET v20 = v20 * 3 + 11
+50920 LET t = t + v20 / 7
+50930 IF t < 0 THEN 50940
+50940 LET v21 = 40
+50950 LET v21 = v21 * 3 + 2
+50960 LET t = t + v21 / 7
+50970 IF t < 0 THEN 50980
+50980 LET v22 = 44
+50990 LET v22 = v22 * 3 + 6
+51000 LET t = t + v22 / 7
+51010 IF t < 0 THEN 51020
+51020 LET v23 = 48
+51030 LET v23 = v23 * 3 + 10
+51040 LET t = t + v23 / 7
+51050 IF t < 0 THEN 51060
+51060 LET v24 = 52
+51070 LET v24 = v24 * 3 + 1
+51080 LET t = t + v24 / 7
+51090 IF t < 0 THEN 51100
+51100 LET v25 = 56
+51110 LET v25 = v25 * 3 + 5
+51120 LET t = t + v25 / 7
+51130 IF t < 0 THEN 51140
+51140 LET v26 = 60
+51150 LET v26 = v26 * 3 + 9
+51160 LET t = t + v26 / 7
+51170 IF t < 0 THEN 51180
+51180 LET v27 = 64
+51190 LET v27 = v27 * 3 + 0
+51200 LET t = t + v27 / 7
+51210 IF t < 0 THEN 51220
+51220 LET v28 = 68
+51230 LET v28 = v28 * 3 + 4
+51240 LET t = t + v28 / 7
+51250 IF t < 0 THEN 51260
+51260 LET v29 = 72
+51270 LET v29 = v29 * 3 + 8
+51280 LET t = t + v29 / 7
+51290 IF t < 0 THEN 51300
+51300 LET v30 = 76
+51310 LET v30 = v30 * 3 + 12
+51320 LET t = t + v30 / 7
+51330 IF t < 0 THEN 51340
+51340 LET v31 = 80
+51350 LET v31 = v31 * 3 + 3
+51360 LET t = t + v31 / 7
+51370 IF t < 0 THEN 51380
+51380 LET v32 = 84
+51390 LET v32 = v32 * 3 + 7
+51400 LET t = t + v32 / 7
+51410 IF t < 0 THEN 51420
+51420 LET v33 = 88
+51430 LET v33 = v33 * 3 + 11
+51440 LET t = t + v33 / 7
+51450 IF t < 0 THEN 51460
+51460 LET v34 = 92
+51470 LET v34 = v34 * 3 + 2
+51480 LET t = t + v34 / 7
+51490 IF t < 0 THEN 51500
+51500 LET v35 = 96
+51510 LET v35 = v35 * 3 + 6
+51520 LET t = t + v35 / 7
+51530 IF t < 0 THEN 51540
+51540 LET v36 = 3
+51550 LET v36 = v36 * 3 + 10
+51560 LET t = t + v36 / 7
+51570 IF t < 0 THEN 51580
+51580 LET v37 = 7
+51590 LET v37 = v37 * 3 + 1
+51600 LET t = t + v37 / 7
+51610 IF t < 0 THEN 51620
+51620 LET v38 = 11
+51630 LET v38 = v38 * 3 + 5
+51640 LET t = t + v38 / 7
+51650 IF t < 0 THEN 51660
+51660 LET v39 = 15
+51670 LET v39 = v39 * 3 + 9
+51680 LET t = t + v39 / 7
+51690 IF t < 0 THEN 51700
+51700 LET v40 = 19
+51710 LET v40 = v40 * 3 + 0
+51720 LET t = t + v40 / 7
+51730 IF t < 0 THEN 51740
+51740 LET v41 = 23
+51750 LET v41 = v41 * 3 + 4
+51760 LET t = t + v41 / 7
+51770 IF t < 0 THEN 51780
+51780 LET v42 = 27
+51790 LET v42 = v42 * 3 + 8
+51800 LET t = t + v42 / 7
+51810 IF t < 0 THEN 51820
+51820 LET v43 = 31
+51830 LET v43 = v43 * 3 + 12
+51840 LET t = t + v43 / 7
+51850 IF t < 0 THEN 51860
+51860 LET v44 = 35
+51870 LET v44 = v44 * 3 + 3
+51880 LET t = t + v44 / 7
+51890 IF t < 0 THEN 51900
+51900 LET v45 = 39
+51910 LET v45 = v45 * 3 + 7
+51920 LET t = t + v45 / 7
+51930 IF t < 0 THEN 51940
+51940 LET v46 = 43
+51950 LET v46 = v46 * 3 + 11
+51960 LET t = t + v46 / 7
+51970 IF t < 0 THEN 51980
+51980 LET v47 = 47
+51990 LET v47 = v47 * 3 + 2
+52000 LET t = t + v47 / 7
+52010 IF t < 0 THEN 52020
+52020 LET v48 = 51
+52030 LET v48 = v48 * 3 + 6
+52040 LET t = t + v48 / 7
+52050 IF t < 0 THEN 52060
+52060 LET v49 = 55
+52070 LET v49 = v49 * 3 + 10
+52080 LET t = t + v49 / 7
+52090 IF t < 0 THEN 52100
+52100 LET v0 = 59
+52110 LET v0 = v0 * 3 + 1
+52120 LET t = t + v0 / 7
+52130 IF t < 0 THEN 52140
+52140 LET v1 = 63
+52150 LET v1 = v1 * 3 + 5
+52160 LET t = t + v1 / 7
+52170 IF t < 0 THEN 52180
+52180 LET v2 = 67
+52190 LET v2 = v2 * 3 + 9
+52200 LET t = t + v2 / 7
+52210 IF t < 0 THEN 52220
+52220 LET v3 = 71
+52230 LET v3 = v3 * 3 + 0
+52240 LET t = t + v3 / 7
+52250 IF t < 0 THEN 52260
+52260 LET v4 = 75
+52270 LET v4 = v4 * 3 + 4
+52280 LET t = t + v4 / 7
+52290 IF t < 0 THEN 52300
+52300 LET v5 = 79
+52310 LET v5 = v5 * 3 + 8
+52320 LET t = t + v5 / 7
+52330 IF t < 0 THEN 52340
+52340 LET v6 = 83
+52350 LET v6 = v6 * 3 + 12
+52360 LET t = t + v6 / 7
+52370 IF t < 0 THEN 52380
+52380 LET v7 = 87
+52390 LET v7 = v7 * 3 + 3
+52400 LET t = t + v7 / 7
+52410 IF t < 0 THEN 52420
+52420 LET v8 = 91
+52430 LET v8 = v8 * 3 + 7
+52440 LET t = t + v8 / 7
+52450 IF t < 0 THEN 52460
+52460 LET v9 = 95
+52470 LET v9 = v9 * 3 + 11
+52480 LET t = t + v9 / 7
+52490 IF t < 0 THEN 52500
+52500 LET v10 = 2
+52510 LET v10 = v10 * 3 + 2
+52520 LET t = t + v10 / 7
+52530 IF t < 0 THEN 52540
+52540 LET v11 = 6
+52550 LET v11 = v11 * 3 + 6
+52560 LET t = t + v11 / 7
+52570 IF t < 0 THEN 52580
+52580 LET v12 = 10
+52590 LET v12 = v12 * 3 + 10
+52600 LET t = t + v12 / 7
+52610 IF t < 0 THEN 52620
+52620 LET v13 = 14
+52630 LET v13 = v13 * 3 + 1
+52640 LET t = t + v13 / 7
+52650 IF t < 0 THEN 52660
+52660 LET v14 = 18
+52670 LET v14 = v14 * 3 + 5
+52680 LET t = t + v14 / 7
+52690 IF t < 0 THEN 52700
+52700 LET v15 = 22
+52710 LET v15 = v15 * 3 + 9
+52720 LET t = t + v15 / 7
+52730 IF t < 0 THEN 52740
+52740 LET v16 = 26
+52750 LET v16 = v16 * 3 + 0
+52760 LET t = t + v16 / 7
+52770 IF t < 0 THEN 52780
+52780 LET v17 = 30
+52790 LET v17 = v17 * 3 + 4
+52800 LET t = t + v17 / 7
+52810 IF t < 0 THEN 52820
+52820 LET v18 = 34
+52830 LET v18 = v18 * 3 + 8
+52840 LET t = t + v18 / 7
+52850 IF t < 0 THEN 52860
+52860 LET v19 = 38
+52870 LET v19 = v19 * 3 + 12
+52880 LET t = t + v19 / 7
+52890 IF t < 0 THEN 52900
+52900 LET v20 = 42
+52910 LET v20 = v20 * 3 + 3
+52920 LET t = t + v20 / 7
+52930 IF t < 0 THEN 52940
+52940 LET v21 = 46
+52950 LET v21 = v21 * 3 + 7
+52960 LET t = t + v21 / 7
+52970 IF t < 0 THEN 52980
+52980 LET v22 = 50
+52990 LET v22 = v22 * 3 + 11
+53000 LET t = t + v22 / 7
+53010 IF t < 0 THEN 53020
+53020 LET v23 = 54
+53030 LET v23 = v23 * 3 + 2
+53040 LET t = t + v23 / 7
+53050 IF t < 0 THEN 53060
+53060 LET v24 = 58
+53070 LET v24 = v24 * 3 + 6
+53080 LET t = t + v24 / 7
+53090 IF t < 0 THEN 53100
+53100 LET v25 = 62
+53110 LET v25 = v25 * 3 + 10
+53120 LET t = t + v25 / 7
+53130 IF t < 0 THEN 53140
+53140 LET v26 = 66
+53150 LET v26 = v26 * 3 + 1
+53160 LET t = t + v26 / 7
+53170 IF t < 0 THEN 53180
+53180 LET v27 = 70
+53190 LET v27 = v27 * 3 + 5
+53200 LET t = t + v27 / 7
+53210 IF t < 0 THEN 53220
+53220 LET v28 = 74
+53230 LET v28 = v28 * 3 + 9
+53240 LET t = t + v28 / 7
+53250 IF t < 0 THEN 53260
+53260 LET v29 = 78
+53270 LET v29 = v29 * 3 + 0
+53280 LET t = t + v29 / 7
+53290 IF t < 0 THEN 53300
+53300 LET v30 = 82
+53310 LET v30 = v30 * 3 + 4
+53320 LET t = t + v30 / 7
+53330 IF t < 0 THEN 53340
+53340 LET v31 = 86
+53350 LET v31 = v31 * 3 + 8
+53360 LET t = t + v31 / 7
+53370 IF t < 0 THEN 53380
+53380 LET v32 = 90
+53390 LET v32 = v32 * 3 + 12
+53400 LET t = t + v32 / 7
+53410 IF t < 0 THEN 53420
+53420 LET v33 = 94
+53430 LET v33 = v33 * 3 + 3
+53440 LET t = t + v33 / 7
+53450 IF t < 0 THEN 53460
+53460 LET v34 = 1
+53470 LET v34 = v34 * 3 + 7
+53480 LET t = t + v34 / 7
+53490 IF t < 0 THEN 53500
+53500 LET v35 = 5
+53510 LET v35 = v35 * 3 + 11
+53520 LET t = t + v35 / 7
+53530 IF t < 0 THEN 53540
+53540 LET v36 = 9
+53550 LET v36 = v36 * 3 + 2
+53560 LET t = t + v36 / 7
+53570 IF t < 0 THEN 53580
+53580 LET v37 = 13
+53590 LET v37 = v37 * 3 + 6
+53600 LET t = t + v37 / 7
+53610 IF t < 0 THEN 53620
+53620 LET v38 = 17
+53630 LET v38 = v38 * 3 + 10
+53640 LET t = t + v38 / 7
+53650 IF t < 0 THEN 53660
+53660 LET v39 = 21
+53670 LET v39 = v39 * 3 + 1
+53680 LET t = t + v39 / 7
+53690 IF t < 0 THEN 53700
+53700 LET v40 = 25
+53710 LET v40 = v40 * 3 + 5
+53720 LET t = t + v40 / 7
+53730 IF t < 0 THEN 53740
+53740 LET v41 = 29
+53750 LET v41 = v41 * 3 + 9
+53760 LET t = t + v41 / 7
+53770 IF t < 0 THEN 53780
+53780 LET v42 = 33
+53790 LET v42 = v42 * 3 + 0
+53800 LET t = t + v42 / 7
+53810 IF t < 0 THEN 53820
+53820 LET v43 = 37
+53830 LET v43 = v43 * 3 + 4
+53840 LET t = t + v43 / 7
+53850 IF t < 0 THEN 53860
+53860 LET v44 = 41
+53870 LET v44 = v44 * 3 + 8
+53880 LET t = t + v44 / 7
+53890 IF t < 0 THEN 53900
+53900 LET v45 = 45
+53910 LET v45 = v45 * 3 + 12
+53920 LET t = t + v45 / 7
+53930 IF t < 0 THEN 53940
+53940 LET v46 = 49
+53950 LET v46 = v46 * 3 + 3
+53960 LET t = t + v46 / 7
+53970 IF t < 0 THEN 53980
+53980 LET v47 = 53
+53990 LET v47 = v47 * 3 + 7
+54000 LET t = t + v47 / 7
+54010 IF t < 0 THEN 54020
+54020 LET v48 = 57
+54030 LET v48 = v48 * 3 + 11
+54040 LET t = t + v48 / 7
+54050 IF t < 0 THEN 54060
+54060 LET v49 = 61
+54070 LET v49 = v49 * 3 + 2
+54080 LET t = t + v49 / 7
+54090 IF t < 0 THEN 54100
+54100 LET v0 = 65
+54110 LET v0 = v0 * 3 + 6
+54120 LET t = t + v0 / 7
+54130 IF t < 0 THEN 54140
+54140 LET v1 = 69
+54150 LET v1 = v1 * 3 + 10
+54160 LET t = t + v1 / 7
+54170 IF t < 0 THEN 54180
+54180 LET v2 = 73
+54190 LET v2 = v2 * 3 + 1
+54200 LET t = t + v2 / 7
+54210 IF t < 0 THEN 54220
+54220 LET v3 = 77
+54230 LET v3 = v3 * 3 + 5
+54240 LET t = t + v3 / 7
+54250 IF t < 0 THEN 54260
+54260 LET v4 = 81
+54270 LET v4 = v4 * 3 + 9
+54280 LET t = t + v4 / 7
+54290 IF t < 0 THEN 54300
+54300 LET v5 = 85
+54310 LET v5 = v5 * 3 + 0
+54320 LET t = t + v5 / 7
+54330 IF t < 0 THEN 54340
+54340 LET v6 = 89
+54350 LET v6 = v6 * 3 + 4
+54360 LET t = t + v6 / 7
+54370 IF t < 0 THEN 54380
+54380 LET v7 = 93
+54390 LET v7 = v7 * 3 + 8
+54400 LET t = t + v7 / 7
+54410 IF t < 0 THEN 54420
+54420 LET v8 = 0
+54430 LET v8 = v8 * 3 + 12
+54440 LET t = t + v8 / 7
+54450 IF t < 0 THEN 54460
+54460 LET v9 = 4
+54470 LET v9 = v9 * 3 + 3
+54480 LET t = t + v9 / 7
+54490 IF t < 0 THEN 54500
+54500 LET v10 = 8
+54510 LET v10 = v10 * 3 + 7
+54520 LET t = t + v10 / 7
+54530 IF t < 0 THEN 54540
+54540 LET v11 = 12
+54550 LET v11 = v11 * 3 + 11
+54560 LET t = t + v11 / 7
+54570 IF t < 0 THEN 54580
+54580 LET v12 = 16
+54590 LET v12 = v12 * 3 + 2
+54600 LET t = t + v12 / 7
+54610 IF t < 0 THEN 54620
+54620 LET v13 = 20
+54630 LET v13 = v13 * 3 + 6
+54640 LET t = t + v13 / 7
+54650 IF t < 0 THEN 54660
+54660 LET v14 = 24
+54670 LET v14 = v14 * 3 + 10
+54680 LET t = t + v14 / 7
+54690 IF t < 0 THEN 54700
+54700 LET v15 = 28
+54710 LET v15 = v15 * 3 + 1
+54720 LET t = t + v15 / 7
+54730 IF t < 0 THEN 54740
+54740 LET v16 = 32
+54750 LET v16 = v16 * 3 + 5
+54760 LET t = t + v16 / 7
+54770 IF t < 0 THEN 54780
+54780 LET v17 = 36
+54790 LET v17 = v17 * 3 + 9
+54800 LET t = t + v17 / 7
+54810 IF t < 0 THEN 54820
+54820 LET v18 = 40
+54830 LET v18 = v18 * 3 + 0
+54840 LET t = t + v18 / 7
+54850 IF t < 0 THEN 54860
+54860 LET v19 = 44
+54870 LET v19 = v19 * 3 + 4
+54880 LET t = t + v19 / 7
+54890 IF t < 0 THEN 54900
+54900 LET v20 = 48
+54910 LET v20 = v20 * 3 + 8
+54920 LET t = t + v20 / 7
+54930 IF t < 0 THEN 54940
+54940 LET v21 = 52
+54950 LET v21 = v21 * 3 + 12
+54960 LET t = t + v21 / 7
+54970 IF t < 0 THEN 54980
+54980 LET v22 = 56
+54990 LET v22 = v22 * 3 + 3
+55000 LET t = t + v22 / 7
+55010 IF t < 0 THEN 55020
+55020 LET v23 = 60
+55030 LET v23 = v23 * 3 + 7
+55040 LET t = t + v23 / 7
+55050 IF t < 0 THEN 55060
+55060 LET v24 = 64
+55070 LET v24 = v24 * 3 + 11
+55080 LET t = t + v24 / 7
+55090 IF t < 0 THEN 55100
+55100 LET v25 = 68
+55110 LET v25 = v25 * 3 + 2
+55120 LET t = t + v25 / 7
+55130 IF t < 0 THEN 55140
+55140 LET v26 = 72
+55150 LET v26 = v26 * 3 + 6
+55160 LET t = t + v26 / 7
+55170 IF t < 0 THEN 55180
+55180 LET v27 = 76
+55190 LET v27 = v27 * 3 + 10
+55200 LET t = t + v27 / 7
+55210 IF t < 0 THEN 55220
+55220 LET v28 = 80
+55230 LET v28 = v28 * 3 + 1
+55240 LET t = t + v28 / 7
+55250 IF t < 0 THEN 55260
+55260 LET v29 = 84
+55270 LET v29 = v29 * 3 + 5
+55280 LET t = t + v29 / 7
+55290 IF t < 0 THEN 55300
+55300 LET v30 = 88
+55310 LET v30 = v30 * 3 + 9
+55320 LET t = t + v30 / 7
+55330 IF t < 0 THEN 55340
+55340 LET v31 = 92
+55350 LET v31 = v31 * 3 + 0
+55360 LET t = t + v31 / 7
+55370 IF t < 0 THEN 55380
+55380 LET v32 = 96
+55390 LET v32 = v32 * 3 + 4
+55400 LET t = t + v32 / 7
+55410 IF t < 0 THEN 55420
+55420 LET v33 = 3
+55430 LET v33 = v33 * 3 + 8
+55440 LET t = t + v33 / 7
+55450 IF t < 0 THEN 55460
+55460 LET v34 = 7
+55470 LET v34 = v34 * 3 + 12
+55480 LET t = t + v34 / 7
+55490 IF t < 0 THEN 55500
+55500 LET v35 = 11
+55510 LET v35 = v35 * 3 + 3
+55520 LET t = t + v35 / 7
+55530 IF t < 0 THEN 55540
+55540 LET v36 = 15
+55550 LET v36 = v36 * 3 + 7
+55560 LET t = t + v36 / 7
+55570 IF t < 0 THEN 55580
+55580 LET v37 = 19
+55590 LET v37 = v37 * 3 + 11
+55600 LET t = t + v37 / 7
+55610 IF t < 0 THEN 55620
+55620 LET v38 = 23
+55630 LET v38 = v38 * 3 + 2
+55640 LET t = t + v38 / 7
+55650 IF t < 0 THEN 55660
+55660 LET v39 = 27
+55670 LET v39 = v39 * 3 + 6
+55680 LET t = t + v39 / 7
+55690 IF t < 0 THEN 55700
+55700 LET v40 = 31
+55710 LET v40 = v40 * 3 + 10
+55720 LET t = t + v40 / 7
+55730 IF t < 0 THEN 55740
+55740 LET v41 = 35
+55750 LET v41 = v41 * 3 + 1
+55760 LET t = t + v41 / 7
+55770 IF t < 0 THEN 55780
+55780 LET v42 = 39
+55790 LET v42 = v42 * 3 + 5
+55800 LET t = t + v42 / 7
+55810 IF t < 0 THEN 55820
+55820 LET v43 = 43
+55830 LET v43 = v43 * 3 + 9
+55840 LET t = t + v43 / 7
+55850 IF t < 0 THEN 55860
+55860 LET v44 = 47
+55870 LET v44 = v44 * 3 + 0
+55880 LET t = t + v44 / 7
+55890 IF t < 0 THEN 55900
+55900 LET v45 = 51
+55910 LET v45 = v45 * 3 + 4
+55920 LET t = t + v45 / 7
+55930 IF t < 0 THEN 55940
+55940 LET v46 = 55
+55950 LET v46 = v46 * 3 + 8
+55960 LET t = t + v46 / 7
+55970 IF t < 0 THEN 55980
+55980 LET v47 = 59
+55990 LET v47 = v47 * 3 + 12
+56000 LET t = t + v47 / 7
+56010 IF t < 0 THEN 56020
+56020 LET v48 = 63
+56030 LET v48 = v48 * 3 + 3
+56040 LET t = t + v48 / 7
+56050 IF t < 0 THEN 56060
+56060 LET v49 = 67
+56070 LET v49 = v49 * 3 + 7
+56080 LET t = t + v49 / 7
+56090 IF t < 0 THEN 56100
+56100 LET v0 = 71
+56110 LET v0 = v0 * 3 + 11
+56120 LET t = t + v0 / 7
+56130 IF t < 0 THEN 56140
+56140 LET v1 = 75
+56150 LET v1 = v1 * 3 + 2
+56160 LET t = t + v1 / 7
+56170 IF t < 0 THEN 56180
+56180 LET v2 = 79
+56190 LET v2 = v2 * 3 + 6
+56200 LET t = t + v2 / 7
+56210 IF t < 0 THEN 56220
+56220 LET v3 = 83
+56230 LET v3 = v3 * 3 + 10
+56240 LET t = t + v3 / 7
+56250 IF t < 0 THEN 56260
+56260 LET v4 = 87
+56270 LET v4 = v4 * 3 + 1
+56280 LET t = t + v4 / 7
+56290 IF t < 0 THEN 56300
+56300 LET v5 = 91
+56310 LET v5 = v5 * 3 + 5
+56320 LET t = t + v5 / 7
+56330 IF t < 0 THEN 56340
+56340 LET v6 = 95
+56350 LET v6 = v6 * 3 + 9
+56360 LET t = t + v6 / 7
+56370 IF t < 0 THEN 56380
+56380 LET v7 = 2
+56390 LET v7 = v7 * 3 + 0
+56400 LET t = t + v7 / 7
+56410 IF t < 0 THEN 56420
+56420 LET v8 = 6
+56430 LET v8 = v8 * 3 + 4
+56440 LET t = t + v8 / 7
+56450 IF t < 0 THEN 56460
+56460 LET v9 = 10
+56470 LET v9 = v9 * 3 + 8
+56480 LET t = t + v9 / 7
+56490 IF t < 0 THEN 56500
+56500 LET v10 = 14
+56510 LET v10 = v10 * 3 + 12
+56520 LET t = t + v10 / 7
+56530 IF t < 0 THEN 56540
+56540 LET v11 = 18
+56550 LET v11 = v11 * 3 + 3
+56560 LET t = t + v11 / 7
+56570 IF t < 0 THEN 56580
+56580 LET v12 = 22
+56590 LET v12 = v12 * 3 + 7
+56600 LET t = t + v12 / 7
+56610 IF t < 0 THEN 56620
+56620 LET v13 = 26
+56630 LET v13 = v13 * 3 + 11
+56640 LET t = t + v13 / 7
+56650 IF t < 0 THEN 56660
+56660 LET v14 = 30
+56670 LET v14 = v14 * 3 + 2
+56680 LET t = t + v14 / 7
+56690 IF t < 0 THEN 56700
+56700 LET v15 = 34
+56710 LET v15 = v15 * 3 + 6
+56720 LET t = t + v15 / 7
+56730 IF t < 0 THEN 56740
+56740 LET v16 = 38
+56750 LET v16 = v16 * 3 + 10
+56760 LET t = t + v16 / 7
+56770 IF t < 0 THEN 56780
+56780 LET v17 = 42
+56790 LET v17 = v17 * 3 + 1
+56800 LET t = t + v17 / 7
+56810 IF t < 0 THEN 56820
+56820 LET v18 = 46
+56830 LET v18 = v18 * 3 + 5
+56840 LET t = t + v18 / 7
+56850 IF t < 0 THEN 56860
+56860 LET v19 = 50
+56870 LET v19 = v19 * 3 + 9
+56880 LET t = t + v19 / 7
+56890 IF t < 0 THEN 56900
+56900 LET v20 = 54
+56910 LET v20 = v20 * 3 + 0
+56920 LET t = t + v20 / 7
+56930 IF t < 0 THEN 56940
+56940 LET v21 = 58
+56950 LET v21 = v21 * 3 + 4
+56960 LET t = t + v21 / 7
+56970 IF t < 0 THEN 56980
+56980 LET v22 = 62
+56990 LET v22 = v22 * 3 + 8
+57000 LET t = t + v22 / 7
+57010 IF t < 0 THEN 57020
+57020 LET v23 = 66
+57030 LET v23 = v23 * 3 + 12
+57040 LET t = t + v23 / 7
+57050 IF t < 0 THEN 57060
+57060 LET v24 = 70
+57070 LET v24 = v24 * 3 + 3
+57080 LET t = t + v24 / 7
+57090 IF t < 0 THEN 57100
+57100 LET v25 = 74
+57110 LET v25 = v25 * 3 + 7
+57120 LET t = t + v25 / 7
+57130 IF t < 0 THEN 57140
+57140 LET v26 = 78
+57150 LET v26 = v26 * 3 + 11
+57160 LET t = t + v26 / 7
+57170 IF t < 0 THEN 57180
+57180 LET v27 = 82
+57190 LET v27 = v27 * 3 + 2
+57200 LET t = t + v27 / 7
+57210 IF t < 0 THEN 57220
+57220 LET v28 = 86
+57230 LET v28 = v28 * 3 + 6
+57240 LET t = t + v28 / 7
+57250 IF t < 0 THEN 57260
+57260 LET v29 = 90
+57270 LET v29 = v29 * 3 + 10
+57280 LET t = t + v29 / 7
+57290 IF t < 0 THEN 57300
+57300 LET v30 = 94
+57310 LET v30 = v30 * 3 + 1
+57320 LET t = t + v30 / 7
+57330 IF t < 0 THEN 57340
+57340 LET v31 = 1
+57350 LET v31 = v31 * 3 + 5
+57360 LET t = t + v31 / 7
+57370 IF t < 0 THEN 57380
+57380 LET v32 = 5
+57390 LET v32 = v32 * 3 + 9
+57400 LET t = t + v32 / 7
+57410 IF t < 0 THEN 57420
+57420 LET v33 = 9
+57430 LET v33 = v33 * 3 + 0
+57440 LET t = t + v33 / 7
+57450 IF t < 0 THEN 57460
+57460 LET v34 = 13
+57470 LET v34 = v34 * 3 + 4
+57480 LET t = t + v34 / 7
+57490 IF t < 0 THEN 57500
+57500 LET v35 = 17
+57510 LET v35 = v35 * 3 + 8
+57520 LET t = t + v35 / 7
+57530 IF t < 0 THEN 57540
+57540 LET v36 = 21
+57550 LET v36 = v36 * 3 + 12
+57560 LET t = t + v36 / 7
+57570 IF t < 0 THEN 57580
+57580 LET v37 = 25
+57590 LET v37 = v37 * 3 + 3
+57600 LET t = t + v37 / 7
+57610 IF t < 0 THEN 57620
+57620 LET v38 = 29
+57630 LET v38 = v38 * 3 + 7
+57640 LET t = t + v38 / 7
+57650 IF t < 0 THEN 57660
+57660 LET v39 = 33
+57670 LET v39 = v39 * 3 + 11
+57680 LET t = t + v39 / 7
+57690 IF t < 0 THEN 57700
+57700 LET v40 = 37
+57710 LET v40 = v40 * 3 + 2
+57720 LET t = t + v40 / 7
+57730 IF t < 0 THEN 57740
+57740 LET v41 = 41
+57750 LET v41 = v41 * 3 + 6
+57760 LET t = t + v41 / 7
+57770 IF t < 0 THEN 57780
+57780 LET v42 = 45
+57790 LET v42 = v42 * 3 + 10
+57800 LET t = t + v42 / 7
+57810 IF t < 0 THEN 57820
+57820 LET v43 = 49
+57830 LET v43 = v43 * 3 + 1
+57840 LET t = t + v43 / 7
+57850 IF t < 0 THEN 57860
+57860 LET v44 = 53
+57870 LET v44 = v44 * 3 + 5
+57880 LET t = t + v44 / 7
+57890 IF t < 0 THEN 57900
+57900 LET v45 = 57
+57910 LET v45 = v45 * 3 + 9
+57920 LET t = t + v45 / 7
+57930 IF t < 0 THEN 57940
+57940 LET v46 = 61
+57950 LET v46 = v46 * 3 + 0
+57960 LET t = t + v46 / 7
+57970 IF t < 0 THEN 57980
+57980 LET v47 = 65
+57990 LET v47 = v47 * 3 + 4
+58000 LET t = t + v47 / 7
+58010 IF t < 0 THEN 58020
+58020 LET v48 = 69
+58030 LET v48 = v48 * 3 + 8
+58040 LET t = t + v48 / 7
+58050 IF t < 0 THEN 58060
+58060 LET v49 = 73
+58070 LET v49 = v49 * 3 + 12
+58080 LET t = t + v49 / 7
+58090 IF t < 0 THEN 58100
+58100 LET v0 = 77
+58110 LET v0 = v0 * 3 + 3
+58120 LET t = t + v0 / 7
+58130 IF t < 0 THEN 58140
+58140 LET v1 = 81
+58150 LET v1 = v1 * 3 + 7
+58160 LET t = t + v1 / 7
+58170 IF t < 0 THEN 58180
+58180 LET v2 = 85
+58190 LET v2 = v2 * 3 + 11
+58200 LET t = t + v2 / 7
+58210 IF t < 0 THEN 58220
+58220 LET v3 = 89
+58230 LET v3 = v3 * 3 + 2
+58240 LET t = t + v3 / 7
+58250 IF t < 0 THEN 58260
+58260 LET v4 = 93
+58270 LET v4 = v4 * 3 + 6
+58280 LET t = t + v4 / 7
+58290 IF t < 0 THEN 58300
+58300 LET v5 = 0
+58310 LET v5 = v5 * 3 + 10
+58320 LET t = t + v5 / 7
+58330 IF t < 0 THEN 58340
+58340 LET v6 = 4
+58350 LET v6 = v6 * 3 + 1
+58360 LET t = t + v6 / 7
+58370 IF t < 0 THEN 58380
+58380 LET v7 = 8
+58390 LET v7 = v7 * 3 + 5
+58400 LET t = t + v7 / 7
+58410 IF t < 0 THEN 58420
+58420 LET v8 = 12
+58430 LET v8 = v8 * 3 + 9
+58440 LET t = t + v8 / 7
+58450 IF t < 0 THEN 58460
+58460 LET v9 = 16
+58470 LET v9 = v9 * 3 + 0
+58480 LET t = t + v9 / 7
+58490 IF t < 0 THEN 58500
+58500 LET v10 = 20
+58510 LET v10 = v10 * 3 + 4
+58520 LET t = t + v10 / 7
+58530 IF t < 0 THEN 58540
+58540 LET v11 = 24
+58550 LET v11 = v11 * 3 + 8
+58560 LET t = t + v11 / 7
+58570 IF t < 0 THEN 58580
+58580 LET v12 = 28
+58590 LET v12 = v12 * 3 + 12
+58600 LET t = t + v12 / 7
+58610 IF t < 0 THEN 58620
+58620 LET v13 = 32
+58630 LET v13 = v13 * 3 + 3
+58640 LET t = t + v13 / 7
+58650 IF t < 0 THEN 58660
+58660 LET v14 = 36
+58670 LET v14 = v14 * 3 + 7
+58680 LET t = t + v14 / 7
+58690 IF t < 0 THEN 58700
+58700 LET v15 = 40
+58710 LET v15 = v15 * 3 + 11
+58720 LET t = t + v15 / 7
+58730 IF t < 0 THEN 58740
+58740 LET v16 = 44
+58750 LET v16 = v16 * 3 + 2
+58760 LET t = t + v16 / 7
+58770 IF t < 0 THEN 58780
+58780 LET v17 = 48
+58790 LET v17 = v17 * 3 + 6
+58800 LET t = t + v17 / 7
+58810 IF t < 0 THEN 58820
+58820 LET v18 = 52
+58830 LET v18 = v18 * 3 + 10
+58840 LET t = t + v18 / 7
+58850 IF t < 0 THEN 58860
+58860 LET v19 = 56
+58870 LET v19 = v19 * 3 + 1
+58880 LET t = t + v19 / 7
+58890 IF t < 0 THEN 58900
+58900 LET v20 = 60
+58910 LET v20 = v20 * 3 + 5
+58920 LET t = t + v20 / 7
+58930 IF t < 0 THEN 58940
+58940 LET v21 = 64
+58950 LET v21 = v21 * 3 + 9
+58960 LET t = t + v21 / 7
+58970 IF t < 0 THEN 58980
+58980 LET v22 = 68
+58990 LET v22 = v22 * 3 + 0
+59000 LET t = t + v22 / 7
+59010 IF t < 0 THEN 59020
+59020 LET v23 = 72
+59030 LET v23 = v23 * 3 + 4
+59040 LET t = t + v23 / 7
+59050 IF t < 0 THEN 59060
+59060 LET v24 = 76
+59070 LET v24 = v24 * 3 + 8
+59080 LET t = t + v24 / 7
+59090 IF t < 0 THEN 59100
+59100 LET v25 = 80
+59110 LET v25 = v25 * 3 + 12
+59120 LET t = t + v25 / 7
+59130 IF t < 0 THEN 59140
+59140 LET v26 = 84
+59150 LET v26 = v26 * 3 + 3
+59160 LET t = t + v26 / 7
+59170 IF t < 0 THEN 59180
+59180 LET v27 = 88
+59190 LET v27 = v27 * 3 + 7
+59200 LET t = t + v27 / 7
+59210 IF t < 0 THEN 59220
+59220 LET v28 = 92
+59230 LET v28 = v28 * 3 + 11
+59240 LET t = t + v28 / 7
+59250 IF t < 0 THEN 59260
+59260 LET v29 = 96
+59270 LET v29 = v29 * 3 + 2
+59280 LET t = t + v29 / 7
+59290 IF t < 0 THEN 59300
+59300 LET v30 = 3
+59310 LET v30 = v30 * 3 + 6
+59320 LET t = t + v30 / 7
+59330 IF t < 0 THEN 59340
+59340 LET v31 = 7
+59350 LET v31 = v31 * 3 + 10
+59360 LET t = t + v31 / 7
+59370 IF t < 0 THEN 59380
+59380 LET v32 = 11
+59390 LET v32 = v32 * 3 + 1
+59400 LET t = t + v32 / 7
+59410 IF t < 0 THEN 59420
+59420 LET v33 = 15
+59430 LET v33 = v33 * 3 + 5
+59440 LET t = t + v33 / 7
+59450 IF t < 0 THEN 59460
+59460 LET v34 = 19
+59470 LET v34 = v34 * 3 + 9
+59480 LET t = t + v34 / 7
+59490 IF t < 0 THEN 59500
+59500 LET v35 = 23
+59510 LET v35 = v35 * 3 + 0
+59520 LET t = t + v35 / 7
+59530 IF t < 0 THEN 59540
+59540 LET v36 = 27
+59550 LET v36 = v36 * 3 + 4
+59560 LET t = t + v36 / 7
+59570 IF t < 0 THEN 59580
+59580 LET v37 = 31
+59590 LET v37 = v37 * 3 + 8
+59600 LET t = t + v37 / 7
+59610 IF t < 0 THEN 59620
+59620 LET v38 = 35
+59630 LET v38 = v38 * 3 + 12
+59640 LET t = t + v38 / 7
+59650 IF t < 0 THEN 59660
+59660 LET v39 = 39
+59670 LET v39 = v39 * 3 + 3
+59680 LET t = t + v39 / 7
+59690 IF t < 0 THEN 59700
+59700 LET v40 = 43
+59710 LET v40 = v40 * 3 + 7
+59720 LET t = t + v40 / 7
+59730 IF t < 0 THEN 59740
+59740 LET v41 = 47
+59750 LET v41 = v41 * 3 + 11
+59760 LET t = t + v41 / 7
+59770 IF t < 0 THEN 59780
+59780 LET v42 = 51
+59790 LET v42 = v42 * 3 + 2
+59800 LET t = t + v42 / 7
+59810 IF t < 0 THEN 59820
+59820 LET v43 = 55
+59830 LET v43 = v43 * 3 + 6
+59840 LET t = t + v43 / 7
+59850 IF t < 0 THEN 59860
+59860 LET v44 = 59
+59870 LET v44 = v44 * 3 + 10
+59880 LET t = t + v44 / 7
+59890 IF t < 0 THEN 59900
+59900 LET v45 = 63
+59910 LET v45 = v45 * 3 + 1
+59920 LET t = t + v45 / 7
+59930 IF t < 0 THEN 59940
+59940 LET v46 = 67
+59950 LET v46 = v46 * 3 + 5
+59960 LET t = t + v46 / 7
+59970 IF t < 0 THEN 59980
+59980 LET v47 = 71
+59990 LET v47 = v47 * 3 + 9
+60000 LET t = t + v47 / 7
+60010 IF t < 0 THEN 60020
+60020 LET v48 = 75
+60030 LET v48 = v48 * 3 + 0
+60040 LET t = t + v48 / 7
+60050 IF t < 0 THEN 60060
+60060 LET v49 = 79
+60070 LET v49 = v49 * 3 + 4
+60080 LET t = t + v49 / 7
+60090 IF t < 0 THEN 60100
+60100 LET v0 = 83
+60110 LET v0 = v0 * 3 + 8
+60120 LET t = t + v0 / 7
+60130 IF t < 0 THEN 60140
+60140 LET v1 = 87
+60150 LET v1 = v1 * 3 + 12
+60160 LET t = t + v1 / 7
+60170 IF t < 0 THEN 60180
+60180 LET v2 = 91
+60190 LET v2 = v2 * 3 + 3
+60200 LET t = t + v2 / 7
+60210 IF t < 0 THEN 60220
+60220 LET v3 = 95
+60230 LET v3 = v3 * 3 + 7
+60240 LET t = t + v3 / 7
+60250 IF t < 0 THEN 60260
+60260 LET v4 = 2
+60270 LET v4 = v4 * 3 + 11
+60280 LET t = t + v4 / 7
+60290 IF t < 0 THEN 60300
+60300 LET v5 = 6
+60310 LET v5 = v5 * 3 + 2
+60320 LET t = t + v5 / 7
+60330 IF t < 0 THEN 60340
+60340 LET v6 = 10
+60350 LET v6 = v6 * 3 + 6
+60360 LET t = t + v6 / 7
+60370 IF t < 0 THEN 60380
+60380 LET v7 = 14
+60390 LET v7 = v7 * 3 + 10
+60400 LET t = t + v7 / 7
+60410 IF t < 0 THEN 60420
+60420 LET v8 = 18
+60430 LET v8 = v8 * 3 + 1
+60440 LET t = t + v8 / 7
+60450 IF t < 0 THEN 60460
+60460 LET v9 = 22
+60470 LET v9 = v9 * 3 + 5
+60480 LET t = t + v9 / 7
+60490 IF t < 0 THEN 60500
+60500 LET v10 = 26
+60510 LET v10 = v10 * 3 + 9
+60520 LET t = t + v10 / 7
+60530 IF t < 0 THEN 60540
+60540 LET v11 = 30
+60550 LET v11 = v11 * 3 + 0
+60560 LET t = t + v11 / 7
+60570 IF t < 0 THEN 60580
+60580 LET v12 = 34
+60590 LET v12 = v12 * 3 + 4
+60600 LET t = t + v12 / 7
+60610 IF t < 0 THEN 60620
+60620 LET v13 = 38
+60630 LET v13 = v13 * 3 + 8
+60640 LET t = t + v13 / 7
+60650 IF t < 0 THEN 60660
+60660 LET v14 = 42
+60670 LET v14 = v14 * 3 + 12
+60680 LET t = t + v14 / 7
+60690 IF t < 0 THEN 60700
+60700 LET v15 = 46
+60710 LET v15 = v15 * 3 + 3
+60720 LET t = t + v15 / 7
+60730 IF t < 0 THEN 60740
+60740 LET v16 = 50
+60750 LET v16 = v16 * 3 + 7
+60760 LET t = t + v16 / 7
+60770 IF t < 0 THEN 60780
+60780 LET v17 = 54
+60790 LET v17 = v17 * 3 + 11
+60800 LET t = t + v17 / 7
+60810 IF t < 0 THEN 60820
+60820 LET v18 = 58
+60830 LET v18 = v18 * 3 + 2
+60840 LET t = t + v18 / 7
+60850 IF t < 0 THEN 60860
+60860 LET v19 = 62
+60870 LET v19 = v19 * 3 + 6
+60880 LET t = t + v19 / 7
+60890 IF t < 0 THEN 60900
+60900 LET v20 = 66
+60910 LET v20 = v20 * 3 + 10
+60920 LET t = t + v20 / 7
+60930 IF t < 0 THEN 60940
+60940 LET v21 = 70
+60950 LET v21 = v21 * 3 + 1
+60960 LET t = t + v21 / 7
+60970 IF t < 0 THEN 60980
+60980 LET v22 = 74
+60990 LET v22 = v22 * 3 + 5
+61000 LET t = t + v22 / 7
+61010 IF t < 0 THEN 61020
+61020 LET v23 = 78
+61030 LET v23 = v23 * 3 + 9
+61040 LET t = t + v23 / 7
+61050 IF t < 0 THEN 61060
+61060 LET v24 = 82
+61070 LET v24 = v24 * 3 + 0
+61080 LET t = t + v24 / 7
+61090 IF t < 0 THEN 61100
+61100 LET v25 = 86
+61110 LET v25 = v25 * 3 + 4
+61120 LET t = t + v25 / 7
+61130 IF t < 0 THEN 61140
+61140 LET v26 = 90
+61150 LET v26 = v26 * 3 + 8
+61160 LET t = t + v26 / 7
+61170 IF t < 0 THEN 61180
+61180 LET v27 = 94
+61190 LET v27 = v27 * 3 + 12
+61200 LET t = t + v27 / 7
+61210 IF t < 0 THEN 61220
+61220 LET v28 = 1
+61230 LET v28 = v28 * 3 + 3
+61240 LET t = t + v28 / 7
+61250 IF t < 0 THEN 61260
+61260 LET v29 = 5
+61270 LET v29 = v29 * 3 + 7
+61280 LET t = t + v29 / 7
+61290 IF t < 0 THEN 61300
+61300 LET v30 = 9
+61310 LET v30 = v30 * 3 + 11
+61320 LET t = t + v30 / 7
+61330 IF t < 0 THEN 61340
+61340 LET v31 = 13
+61350 LET v31 = v31 * 3 + 2
+61360 LET t = t + v31 / 7
+61370 IF t < 0 THEN 61380
+61380 LET v32 = 17
+61390 LET v32 = v32 * 3 + 6
+61400 LET t = t + v32 / 7
+61410 IF t < 0 THEN 61420
+61420 LET v33 = 21
+61430 LET v33 = v33 * 3 + 10
+61440 LET t = t + v33 / 7
+61450 IF t < 0 THEN 61460
+61460 LET v34 = 25
+61470 LET v34 = v34 * 3 + 1
+61480 LET t = t + v34 / 7
+61490 IF t < 0 THEN 61500
+61500 LET v35 = 29
+61510 LET v35 = v35 * 3 + 5
+61520 LET t = t + v35 / 7
+61530 IF t < 0 THEN 61540
+61540 LET v36 = 33
+61550 LET v36 = v36 * 3 + 9
+61560 LET t = t + v36 / 7
+61570 IF t < 0 THEN 61580
+61580 LET v37 = 37
+61590 LET v37 = v37 * 3 + 0
+61600 LET t = t + v37 / 7
+61610 IF t < 0 THEN 61620
+61620 LET v38 = 41
+61630 LET v38 = v38 * 3 + 4
+61640 LET t = t + v38 / 7
+61650 IF t < 0 THEN 61660
+61660 LET v39 = 45
+61670 LET v39 = v39 * 3 + 8
+61680 LET t = t + v39 / 7
+61690 IF t < 0 THEN 61700
+61700 LET v40 = 49
+61710 LET v40 = v40 * 3 + 12
+61720 LET t = t + v40 / 7
+61730 IF t < 0 THEN 61740
+61740 LET v41 = 53
+61750 LET v41 = v41 * 3 + 3
+61760 LET t = t + v41 / 7
+61770 IF t < 0 THEN 61780
+61780 LET v42 = 57
+61790 LET v42 = v42 * 3 + 7
+61800 LET t = t + v42 / 7
+61810 IF t < 0 THEN 61820
+61820 LET v43 = 61
+61830 LET v43 = v43 * 3 + 11
+61840 LET t = t + v43 / 7
+61850 IF t < 0 THEN 61860
+61860 LET v44 = 65
+61870 LET v44 = v44 * 3 + 2
+61880 LET t = t + v44 / 7
+61890 IF t < 0 THEN 61900
+61900 LET v45 = 69
+61910 LET v45 = v45 * 3 + 6
+61920 LET t = t + v45 / 7
+61930 IF t < 0 THEN 61940
+61940 LET v46 = 73
+61950 LET v46 = v46 * 3 + 10
+61960 LET t = t + v46 / 7
+61970 IF t < 0 THEN 61980
+61980 LET v47 = 77
+61990 LET v47 = v47 * 3 + 1
+62000 LET t = t + v47 / 7
+62010 IF t < 0 THEN 62020
+62020 LET v48 = 81
+62030 LET v48 = v48 * 3 + 5
+62040 LET t = t + v48 / 7
+62050 IF t < 0 THEN 62060
+62060 LET v49 = 85
+62070 LET v49 = v49 * 3 + 9
+62080 LET t = t + v49 / 7
+62090 IF t < 0 THEN 62100
+62100 LET v0 = 89
+62110 LET v0 = v0 * 3 + 0
+62120 LET t = t + v0 / 7
+62130 IF t < 0 THEN 62140
+62140 LET v1 = 93
+62150 LET v1 = v1 * 3 + 4
+62160 LET t = t + v1 / 7
+62170 IF t < 0 THEN 62180
+62180 LET v2 = 0
+62190 LET v2 = v2 * 3 + 8
+62200 LET t = t + v2 / 7
+62210 IF t < 0 THEN 62220
+62220 LET v3 = 4
+62230 LET v3 = v3 * 3 + 12
+62240 LET t = t + v3 / 7
+62250 IF t < 0 THEN 62260
+62260 LET v4 = 8
+62270 LET v4 = v4 * 3 + 3
+62280 LET t = t + v4 / 7
+62290 IF t < 0 THEN 62300
+62300 LET v5 = 12
+62310 LET v5 = v5 * 3 + 7
+62320 LET t = t + v5 / 7
+62330 IF t < 0 THEN 62340
+62340 LET v6 = 16
+62350 LET v6 = v6 * 3 + 11
+62360 LET t = t + v6 / 7
+62370 IF t < 0 THEN 62380
+62380 LET v7 = 20
+62390 LET v7 = v7 * 3 + 2
+62400 LET t = t + v7 / 7
+62410 IF t < 0 THEN 62420
+62420 LET v8 = 24
+62430 LET v8 = v8 * 3 + 6
+62440 LET t = t + v8 / 7
+62450 IF t < 0 THEN 62460
+62460 LET v9 = 28
+62470 LET v9 = v9 * 3 + 10
+62480 LET t = t + v9 / 7
+62490 IF t < 0 THEN 62500
+62500 LET v10 = 32
+62510 LET v10 = v10 * 3 + 1
+62520 LET t = t + v10 / 7
+62530 IF t < 0 THEN 62540
+62540 LET v11 = 36
+62550 LET v11 = v11 * 3 + 5
+62560 LET t = t + v11 / 7
+62570 IF t < 0 THEN 62580
+62580 LET v12 = 40
+62590 LET v12 = v12 * 3 + 9
+62600 LET t = t + v12 / 7
+62610 IF t < 0 THEN 62620
+62620 LET v13 = 44
+62630 LET v13 = v13 * 3 + 0
+62640 LET t = t + v13 / 7
+62650 IF t < 0 THEN 62660
+62660 LET v14 = 48
+62670 LET v14 = v14 * 3 + 4
+62680 LET t = t + v14 / 7
+62690 IF t < 0 THEN 62700
+62700 LET v15 = 52
+62710 LET v15 = v15 * 3 + 8
+62720 LET t = t + v15 / 7
+62730 IF t < 0 THEN 62740
+62740 LET v16 = 56
+62750 LET v16 = v16 * 3 + 12
+62760 LET t = t + v16 / 7
+62770 IF t < 0 THEN 62780
+62780 LET v17 = 60
+62790 LET v17 = v17 * 3 + 3
+62800 LET t = t + v17 / 7
+62810 IF t < 0 THEN 62820
+62820 LET v18 = 64
+62830 LET v18 = v18 * 3 + 7
+62840 LET t = t + v18 / 7
+62850 IF t < 0 THEN 62860
+62860 LET v19 = 68
+62870 LET v19 = v19 * 3 + 11
+62880 LET t = t + v19 / 7
+62890 IF t < 0 THEN 62900
+62900 LET v20 = 72
+62910 LET v20 = v20 * 3 + 2
+62920 LET t = t + v20 / 7
+62930 IF t < 0 THEN 62940
+62940 LET v21 = 76
+62950 LET v21 = v21 * 3 + 6
+62960 LET t = t + v21 / 7
+62970 IF t < 0 THEN 62980
+62980 LET v22 = 80
+62990 LET v22 = v22 * 3 + 10
+63000 LET t = t + v22 / 7
+63010 IF t < 0 THEN 63020
+63020 LET v23 = 84
+63030 LET v23 = v23 * 3 + 1
+63040 LET t = t + v23 / 7
+63050 IF t < 0 THEN 63060
+63060 LET v24 = 88
+63070 LET v24 = v24 * 3 + 5
+63080 LET t = t + v24 / 7
+63090 IF t < 0 THEN 63100
+63100 LET v25 = 92
+63110 LET v25 = v25 * 3 + 9
+63120 LET t = t + v25 / 7
+63130 IF t < 0 THEN 63140
+63140 LET v26 = 96
+63150 LET v26 = v26 * 3 + 0
+63160 LET t = t + v26 / 7
+63170 IF t < 0 THEN 63180
+63180 LET v27 = 3
+63190 LET v27 = v27 * 3 + 4
+63200 LET t = t + v27 / 7
+63210 IF t < 0 THEN 63220
+63220 LET v28 = 7
+63230 LET v28 = v28 * 3 + 8
+63240 LET t = t + v28 / 7
+63250 IF t < 0 THEN 63260
+63260 LET v29 = 11
+63270 LET v29 = v29 * 3 + 12
+63280 LET t = t + v29 / 7
+63290 IF t < 0 THEN 63300
+63300 LET v30 = 15
+63310 LET v30 = v30 * 3 + 3
+63320 LET t = t + v30 / 7
+63330 IF t < 0 THEN 63340
+63340 LET v31 = 19
+63350 LET v31 = v31 * 3 + 7
+63360 LET t = t + v31 / 7
+63370 IF t < 0 THEN 63380
+63380 LET v32 = 23
+63390 LET v32 = v32 * 3 + 11
+63400 LET t = t + v32 / 7
+63410 IF t < 0 THEN 63420
+63420 LET v33 = 27
+63430 LET v33 = v33 * 3 + 2
+63440 LET t = t + v33 / 7
+63450 IF t < 0 THEN 63460
+63460 LET v34 = 31
+63470 LET v34 = v34 * 3 + 6
+63480 LET t = t + v34 / 7
+63490 IF t < 0 THEN 63500
+63500 LET v35 = 35
+63510 LET v35 = v35 * 3 + 10
+63520 LET t = t + v35 / 7
+63530 IF t < 0 THEN 63540
+63540 LET v36 = 39
+63550 LET v36 = v36 * 3 + 1
+63560 LET t = t + v36 / 7
+63570 IF t < 0 THEN 63580
+63580 LET v37 = 43
+63590 LET v37 = v37 * 3 + 5
+63600 LET t = t + v37 / 7
+63610 IF t < 0 THEN 63620
+63620 LET v38 = 47
+63630 LET v38 = v38 * 3 + 9
+63640 LET t = t + v38 / 7
+63650 IF t < 0 THEN 63660
+63660 LET v39 = 51
+63670 LET v39 = v39 * 3 + 0
+63680 LET t = t + v39 / 7
+63690 IF t < 0 THEN 63700
+63700 LET v40 = 55
+63710 LET v40 = v40 * 3 + 4
+63720 LET t = t + v40 / 7
+63730 IF t < 0 THEN 63740
+63740 LET v41 = 59
+63750 LET v41 = v41 * 3 + 8
+63760 LET t = t + v41 / 7
+63770 IF t < 0 THEN 63780
+63780 LET v42 = 63
+63790 LET v42 = v42 * 3 + 12
+63800 LET t = t + v42 / 7
+63810 IF t < 0 THEN 63820
+63820 LET v43 = 67
+63830 LET v43 = v43 * 3 + 3
+63840 LET t = t + v43 / 7
+63850 IF t < 0 THEN 63860
+63860 LET v44 = 71
+63870 LET v44 = v44 * 3 + 7
+63880 LET t = t + v44 / 7
+63890 IF t < 0 THEN 63900
+63900 LET v45 = 75
+63910 LET v45 = v45 * 3 + 11
+63920 LET t = t + v45 / 7
+63930 IF t < 0 THEN 63940
+63940 LET v46 = 79
+63950 LET v46 = v46 * 3 + 2
+63960 LET t = t + v46 / 7
+63970 IF t < 0 THEN 63980
+63980 LET v47 = 83
+63990 LET v47 = v47 * 3 + 6
+64000 LET t = t + v47 / 7
+64010 IF t < 0 THEN 64020
+64020 LET v48 = 87
+64030 LET v48 = v48 * 3 + 10
+64040 LET t = t + v48 / 7
+64050 IF t < 0 THEN 64060
+64060 LET v49 = 91
+64070 LET v49 = v49 * 3 + 1
+64080 LET t = t + v49 / 7
+64090 IF t < 0 THEN 64100
+64100 LET v0 = 95
+64110 LET v0 = v0 * 3 + 5
+64120 LET t = t + v0 / 7
+64130 IF t < 0 THEN 64140
+64140 LET v1 = 2
+64150 LET v1 = v1 * 3 + 9
+64160 LET t = t + v1 / 7
+64170 IF t < 0 THEN 64180
+64180 LET v2 = 6
+64190 LET v2 = v2 * 3 + 0
+64200 LET t = t + v2 / 7
+64210 IF t < 0 THEN 64220
+64220 LET v3 = 10
+64230 LET v3 = v3 * 3 + 4
+64240 LET t = t + v3 / 7
+64250 IF t < 0 THEN 64260
+64260 LET v4 = 14
+64270 LET v4 = v4 * 3 + 8
+64280 LET t = t + v4 / 7
+64290 IF t < 0 THEN 64300
+64300 LET v5 = 18
+64310 LET v5 = v5 * 3 + 12
+64320 LET t = t + v5 / 7
+64330 IF t < 0 THEN 64340
+64340 LET v6 = 22
+64350 LET v6 = v6 * 3 + 3
+64360 LET t = t + v6 / 7
+64370 IF t < 0 THEN 64380
+64380 LET v7 = 26
+64390 LET v7 = v7 * 3 + 7
+64400 LET t = t + v7 / 7
+64410 IF t < 0 THEN 64420
+64420 LET v8 = 30
+64430 LET v8 = v8 * 3 + 11
+64440 LET t = t + v8 / 7
+64450 IF t < 0 THEN 64460
+64460 LET v9 = 34
+64470 LET v9 = v9 * 3 + 2
+64480 LET t = t + v9 / 7
+64490 IF t < 0 THEN 64500
+64500 LET v10 = 38
+64510 LET v10 = v10 * 3 + 6
+64520 LET t = t + v10 / 7
+64530 IF t < 0 THEN 64540
+64540 LET v11 = 42
+64550 LET v11 = v11 * 3 + 10
+64560 LET t = t + v11 / 7
+64570 IF t < 0 THEN 64580
+64580 LET v12 = 46
+64590 LET v12 = v12 * 3 + 1
+64600 LET t = t + v12 / 7
+64610 IF t < 0 THEN 64620
+64620 LET v13 = 50
+64630 LET v13 = v13 * 3 + 5
+64640 LET t = t + v13 / 7
+64650 IF t < 0 THEN 64660
+64660 LET v14 = 54
+64670 LET v14 = v14 * 3 + 9
+64680 LET t = t + v14 / 7
+64690 IF t < 0 THEN 64700
+64700 LET v15 = 58
+64710 LET v15 = v15 * 3 + 0
+64720 LET t = t + v15 / 7
+64730 IF t < 0 THEN 64740
+64740 LET v16 = 62
+64750 LET v16 = v16 * 3 + 4
+64760 LET t = t + v16 / 7
+64770 IF t < 0 THEN 64780
+64780 LET v17 = 66
+64790 LET v17 = v17 * 3 + 8
+64800 LET t = t + v17 / 7
+64810 IF t < 0 THEN 64820
+64820 LET v18 = 70
+64830 LET v18 = v18 * 3 + 12
+64840 LET t = t + v18 / 7
+64850 IF t < 0 THEN 64860
+64860 LET v19 = 74
+64870 LET v19 = v19 * 3 + 3
+64880 LET t = t + v19 / 7
+64890 IF t < 0 THEN 64900
+64900 LET v20 = 78
+64910 LET v20 = v20 * 3 + 7
+64920 LET t = t + v20 / 7
+64930 IF t < 0 THEN 64940
+64940 LET v21 = 82
+64950 LET v21 = v21 * 3 + 11
+64960 LET t = t + v21 / 7
+64970 IF t < 0 THEN 64980
+64980 LET v22 = 86
+64990 LET v22 = v22 * 3 + 2
+65000 LET t = t + v22 / 7
+65010 IF t < 0 THEN 65020
+65020 LET v23 = 90
+65030 LET v23 = v23 * 3 + 6
+65040 LET t = t + v23 / 7
+65050 IF t < 0 THEN 65060
+65060 LET v24 = 94
+65070 LET v24 = v24 * 3 + 10
+65080 LET t = t + v24 / 7
+65090 IF t < 0 THEN 65100
+65100 LET v25 = 1
+65110 LET v25 = v25 * 3 + 1
+65120 LET t = t + v25 / 7
+65130 IF t < 0 THEN 65140
+65140 LET v26 = 5
+65150 LET v26 = v26 * 3 + 5
+65160 LET t = t + v26 / 7
+65170 IF t < 0 THEN 65180
+65180 LET v27 = 9
+65190 LET v27 = v27 * 3 + 9
+65200 LET t = t + v27 / 7
+65210 IF t < 0 THEN 65220
+65220 LET v28 = 13
+65230 LET v28 = v28 * 3 + 0
+65240 LET t = t + v28 / 7
+65250 IF t < 0 THEN 65260
+65260 LET v29 = 17
+65270 LET v29 = v29 * 3 + 4
+65280 LET t = t + v29 / 7
+65290 IF t < 0 THEN 65300
+65300 LET v30 = 21
+65310 LET v30 = v30 * 3 + 8
+65320 LET t = t + v30 / 7
+65330 IF t < 0 THEN 65340
+65340 LET v31 = 25
+65350 LET v31 = v31 * 3 + 12
+65360 LET t = t + v31 / 7
+65370 IF t < 0 THEN 65380
+65380 LET v32 = 29
+65390 LET v32 = v32 * 3 + 3
+65400 LET t = t + v32 / 7
+65410 IF t < 0 THEN 65420
+65420 LET v33 = 33
+65430 LET v33 = v33 * 3 + 7
+65440 LET t = t + v33 / 7
+65450 IF t < 0 THEN 65460
+65460 LET v34 = 37
+65470 LET v34 = v34 * 3 + 11
+65480 LET t = t + v34 / 7
+65490 IF t < 0 THEN 65500
+65500 LET v35 = 41
+65510 LET v35 = v35 * 3 + 2
+65520 LET t = t + v35 / 7
+65530 IF t < 0 THEN 65540
+65540 LET v36 = 45
+65550 LET v36 = v36 * 3 + 6
+65560 LET t = t + v36 / 7
+65570 IF t < 0 THEN 65580
+65580 LET v37 = 49
+65590 LET v37 = v37 * 3 + 10
+65600 LET t = t + v37 / 7
+65610 IF t < 0 THEN 65620
+65620 LET v38 = 53
+65630 LET v38 = v38 * 3 + 1
+65640 LET t = t + v38 / 7
+65650 IF t < 0 THEN 65660
+65660 LET v39 = 57
+65670 LET v39 = v39 * 3 + 5
+65680 LET t = t + v39 / 7
+65690 IF t < 0 THEN 65700
+65700 LET v40 = 61
+65710 LET v40 = v40 * 3 + 9
+65720 LET t = t + v40 / 7
+65730 IF t < 0 THEN 65740
+65740 LET v41 = 65
+65750 LET v41 = v41 * 3 + 0
+65760 LET t = t + v41 / 7
+65770 IF t < 0 THEN 65780
+65780 LET v42 = 69
+65790 LET v42 = v42 * 3 + 4
+65800 LET t = t + v42 / 7
+65810 IF t < 0 THEN 65820
+65820 LET v43 = 73
+65830 LET v43 = v43 * 3 + 8
+65840 LET t = t + v43 / 7
+65850 IF t < 0 THEN 65860
+65860 LET v44 = 77
+65870 LET v44 = v44 * 3 + 12
+65880 LET t = t + v44 / 7
+65890 IF t < 0 THEN 65900
+65900 LET v45 = 81
+65910 LET v45 = v45 * 3 + 3
+65920 LET t = t + v45 / 7
+65930 IF t < 0 THEN 65940
+65940 LET v46 = 85
+65950 LET v46 = v46 * 3 + 7
+65960 LET t = t + v46 / 7
+65970 IF t < 0 THEN 65980
+65980 LET v47 = 89
+65990 LET v47 = v47 * 3 + 11
+66000 LET t = t + v47 / 7
+66010 IF t < 0 THEN 66020
+66020 LET v48 = 93
+66030 LET v48 = v48 * 3 + 2
+66040 LET t = t + v48 / 7
+66050 IF t < 0 THEN 66060
+66060 LET v49 = 0
+66070 LET v49 = v49 * 3 + 6
+66080 LET t = t + v49 / 7
+66090 IF t < 0 THEN 66100
+66100 LET v0 = 4
+66110 LET v0 = v0 * 3 + 10
+66120 LET t = t + v0 / 7
+66130 IF t < 0 THEN 66140
+66140 LET v1 = 8
+66150 LET v1 = v1 * 3 + 1
+66160 LET t = t + v1 / 7
+66170 IF t < 0 THEN 66180
+66180 LET v2 = 12
+66190 LET v2 = v2 * 3 + 5
+66200 LET t = t + v2 / 7
+66210 IF t < 0 THEN 66220
+66220 LET v3 = 16
+66230 LET v3 = v3 * 3 + 9
+66240 LET t = t + v3 / 7
+66250 IF t < 0 THEN 66260
+66260 LET v4 = 20
+66270 LET v4 = v4 * 3 + 0
+66280 LET t = t + v4 / 7
+66290 IF t < 0 THEN 66300
+66300 LET v5 = 24
+66310 LET v5 = v5 * 3 + 4
+66320 LET t = t + v5 / 7
+66330 IF t < 0 THEN 66340
+66340 LET v6 = 28
+66350 LET v6 = v6 * 3 + 8
+66360 LET t = t + v6 / 7
+66370 IF t < 0 THEN 66380
+66380 LET v7 = 32
+66390 LET v7 = v7 * 3 + 12
+66400 LET t = t + v7 / 7
+66410 IF t < 0 THEN 66420
+66420 LET v8 = 36
+66430 LET v8 = v8 * 3 + 3
+66440 LET t = t + v8 / 7
+66450 IF t < 0 THEN 66460
+66460 LET v9 = 40
+66470 LET v9 = v9 * 3 + 7
+66480 LET t = t + v9 / 7
+66490 IF t < 0 THEN 66500
+66500 LET v10 = 44
+66510 LET v10 = v10 * 3 + 11
+66520 LET t = t + v10 / 7
+66530 IF t < 0 THEN 66540
+66540 LET v11 = 48
+66550 LET v11 = v11 * 3 + 2
+66560 LET t = t + v11 / 7
+66570 IF t < 0 THEN 66580
+66580 LET v12 = 52
+66590 LET v12 = v12 * 3 + 6
+66600 LET t = t + v12 / 7
+66610 IF t < 0 THEN 66620
+66620 LET v13 = 56
+66630 LET v13 = v13 * 3 + 10
+66640 LET t = t + v13 / 7
+66650 IF t < 0 THEN 66660
+66660 LET v14 = 60
+66670 LET v14 = v14 * 3 + 1
+66680 LET t = t + v14 / 7
+66690 IF t < 0 THEN 66700
+66700 LET v15 = 64
+66710 LET v15 = v15 * 3 + 5
+66720 LET t = t + v15 / 7
+66730 IF t < 0 THEN 66740
+66740 LET v16 = 68
+66750 LET v16 = v16 * 3 + 9
+66760 LET t = t + v16 / 7
+66770 IF t < 0 THEN 66780
+66780 LET v17 = 72
+66790 LET v17 = v17 * 3 + 0
+66800 LET t = t + v17 / 7
+66810 IF t < 0 THEN 66820
+66820 LET v18 = 76
+66830 LET v18 = v18 * 3 + 4
+66840 LET t = t + v18 / 7
+66850 IF t < 0 THEN 66860
+66860 LET v19 = 80
+66870 LET v19 = v19 * 3 + 8
+66880 LET t = t + v19 / 7
+66890 IF t < 0 THEN 66900
+66900 LET v20 = 84
+66910 LET v20 = v20 * 3 + 12
+66920 LET t = t + v20 / 7
+66930 IF t < 0 THEN 66940
+66940 LET v21 = 88
+66950 LET v21 = v21 * 3 + 3
+66960 LET t = t + v21 / 7
+66970 IF t < 0 THEN 66980
+66980 LET v22 = 92
+66990 LET v22 = v22 * 3 + 7
+67000 LET t = t + v22 / 7
+67010 IF t < 0 THEN 67020
+67020 LET v23 = 96
+67030 LET v23 = v23 * 3 + 11
+67040 LET t = t + v23 / 7
+67050 IF t < 0 THEN 67060
+67060 LET v24 = 3
+67070 LET v24 = v24 * 3 + 2
+67080 LET t = t + v24 / 7
+67090 IF t < 0 THEN 67100
+67100 LET v25 = 7
+67110 LET v25 = v25 * 3 + 6
+67120 LET t = t + v25 / 7
+67130 IF t < 0 THEN 67140
+67140 LET v26 = 11
+67150 LET v26 = v26 * 3 + 10
+67160 LET t = t + v26 / 7
+67170 IF t < 0 THEN 67180
+67180 LET v27 = 15
+67190 LET v27 = v27 * 3 + 1
+67200 LET t = t + v27 / 7
+67210 IF t < 0 THEN 67220
+67220 LET v28 = 19
+67230 LET v28 = v28 * 3 + 5
+67240 LET t = t + v28 / 7
+67250 IF t < 0 THEN 67260
+67260 LET v29 = 23
+67270 LET v29 = v29 * 3 + 9
+67280 LET t = t + v29 / 7
+67290 IF t < 0 THEN 67300
+67300 LET v30 = 27
+67310 LET v30 = v30 * 3 + 0
+67320 LET t = t + v30 / 7
+67330 IF t < 0 THEN 67340
+67340 LET v31 = 31
+67350 LET v31 = v31 * 3 + 4
+67360 LET t = t + v31 / 7
+67370 IF t < 0 THEN 67380
+67380 LET v32 = 35
+67390 LET v32 = v32 * 3 + 8
+67400 LET t = t + v32 / 7
+67410 IF t < 0 THEN 67420
+67420 LET v33 = 39
+67430 LET v33 = v33 * 3 + 12
+67440 LET t = t + v33 / 7
+67450 IF t < 0 THEN 67460
+67460 LET v34 = 43
+67470 LET v34 = v34 * 3 + 3
+67480 LET t = t + v34 / 7
+67490 IF t < 0 THEN 67500
+67500 LET v35 = 47
+67510 LET v35 = v35 * 3 + 7
+67520 LET t = t + v35 / 7
+67530 IF t < 0 THEN 67540
+67540 LET v36 = 51
+67550 LET v36 = v36 * 3 + 11
+67560 LET t = t + v36 / 7
+67570 IF t < 0 THEN 67580
+67580 LET v37 = 55
+67590 LET v37 = v37 * 3 + 2
+67600 LET t = t + v37 / 7
+67610 IF t < 0 THEN 67620
+67620 LET v38 = 59
+67630 LET v38 = v38 * 3 + 6
+67640 LET t = t + v38 / 7
+67650 IF t < 0 THEN 67660
+67660 LET v39 = 63
+67670 LET v39 = v39 * 3 + 10
+67680 LET t = t + v39 / 7
+67690 IF t < 0 THEN 67700
+67700 LET v40 = 67
+67710 LET v40 = v40 * 3 + 1
+67720 LET t = t + v40 / 7
+67730 IF t < 0 THEN 67740
+67740 LET v41 = 71
+67750 LET v41 = v41 * 3 + 5
+67760 LET t = t + v41 / 7
+67770 IF t < 0 THEN 67780
+67780 LET v42 = 75
+67790 LET v42 = v42 * 3 + 9
+67800 LET t = t + v42 / 7
+67810 IF t < 0 THEN 67820
+67820 LET v43 = 79
+67830 LET v43 = v43 * 3 + 0
+67840 LET t = t + v43 / 7
+67850 IF t < 0 THEN 67860
+67860 LET v44 = 83
+67870 LET v44 = v44 * 3 + 4
+67880 LET t = t + v44 / 7
+67890 IF t < 0 THEN 67900
+67900 LET v45 = 87
+67910 LET v45 = v45 * 3 + 8
+67920 LET t = t + v45 / 7
+67930 IF t < 0 THEN 67940
+67940 LET v46 = 91
+67950 LET v46 = v46 * 3 + 12
+67960 LET t = t + v46 / 7
+67970 IF t < 0 THEN 67980
+67980 LET v47 = 95
+67990 LET v47 = v47 * 3 + 3
+68000 LET t = t + v47 / 7
+68010 IF t < 0 THEN 68020
+68020 LET v48 = 2
+68030 LET v48 = v48 * 3 + 7
+68040 LET t = t + v48 / 7
+68050 IF t < 0 THEN 68060
+68060 LET v49 = 6
+68070 LET v49 = v49 * 3 + 11
+68080 LET t = t + v49 / 7
+68090 IF t < 0 THEN 68100
+68100 LET v0 = 10
+68110 LET v0 = v0 * 3 + 2
+68120 LET t = t + v0 / 7
+68130 IF t < 0 THEN 68140
+68140 LET v1 = 14
+68150 LET v1 = v1 * 3 + 6
+68160 LET t = t + v1 / 7
+68170 IF t < 0 THEN 68180
+68180 LET v2 = 18
+68190 LET v2 = v2 * 3 + 10
+68200 LET t = t + v2 / 7
+68210 IF t < 0 THEN 68220
+68220 LET v3 = 22
+68230 LET v3 = v3 * 3 + 1
+68240 LET t = t + v3 / 7
+68250 IF t < 0 THEN 68260
+68260 LET v4 = 26
+68270 LET v4 = v4 * 3 + 5
+68280 LET t = t + v4 / 7
+68290 IF t < 0 THEN 68300
+68300 LET v5 = 30
+68310 LET v5 = v5 * 3 + 9
+68320 LET t = t + v5 / 7
+68330 IF t < 0 THEN 68340
+68340 LET v6 = 34
+68350 LET v6 = v6 * 3 + 0
+68360 LET t = t + v6 / 7
+68370 IF t < 0 THEN 68380
+68380 LET v7 = 38
+68390 LET v7 = v7 * 3 + 4
+68400 LET t = t + v7 / 7
+68410 IF t < 0 THEN 68420
+68420 LET v8 = 42
+68430 LET v8 = v8 * 3 + 8
+68440 LET t = t + v8 / 7
+68450 IF t < 0 THEN 68460
+68460 LET v9 = 46
+68470 LET v9 = v9 * 3 + 12
+68480 LET t = t + v9 / 7
+68490 IF t < 0 THEN 68500
+68500 LET v10 = 50
+68510 LET v10 = v10 * 3 + 3
+68520 LET t = t + v10 / 7
+68530 IF t < 0 THEN 68540
+68540 LET v11 = 54
+68550 LET v11 = v11 * 3 + 7
+68560 LET t = t + v11 / 7
+68570 IF t < 0 THEN 68580
+68580 LET v12 = 58
+68590 LET v12 = v12 * 3 + 11
+68600 LET t = t + v12 / 7
+68610 IF t < 0 THEN 68620
+68620 LET v13 = 62
+68630 LET v13 = v13 * 3 + 2
+68640 LET t = t + v13 / 7
+68650 IF t < 0 THEN 68660
+68660 LET v14 = 66
+68670 LET v14 = v14 * 3 + 6
+68680 LET t = t + v14 / 7
+68690 IF t < 0 THEN 68700
+68700 LET v15 = 70
+68710 LET v15 = v15 * 3 + 10
+68720 LET t = t + v15 / 7
+68730 IF t < 0 THEN 68740
+68740 LET v16 = 74
+68750 LET v16 = v16 * 3 + 1
+68760 LET t = t + v16 / 7
+68770 IF t < 0 THEN 68780
+68780 LET v17 = 78
+68790 LET v17 = v17 * 3 + 5
+68800 LET t = t + v17 / 7
+68810 IF t < 0 THEN 68820
+68820 LET v18 = 82
+68830 LET v18 = v18 * 3 + 9
+68840 LET t = t + v18 / 7
+68850 IF t < 0 THEN 68860
+68860 LET v19 = 86
+68870 LET v19 = v19 * 3 + 0
+68880 LET t = t + v19 / 7
+68890 IF t < 0 THEN 68900
+68900 LET v20 = 90
+68910 LET v20 = v20 * 3 + 4
+68920 LET t = t + v20 / 7
+68930 IF t < 0 THEN 68940
+68940 LET v21 = 94
+68950 LET v21 = v21 * 3 + 8
+68960 LET t = t + v21 / 7
+68970 IF t < 0 THEN 68980
+68980 LET v22 = 1
+68990 LET v22 = v22 * 3 + 12
+69000 LET t = t + v22 / 7
+69010 IF t < 0 THEN 69020
+69020 LET v23 = 5
+69030 LET v23 = v23 * 3 + 3
+69040 LET t = t + v23 / 7
+69050 IF t < 0 THEN 69060
+69060 LET v24 = 9
+69070 LET v24 = v24 * 3 + 7
+69080 LET t = t + v24 / 7
+69090 IF t < 0 THEN 69100
+69100 LET v25 = 13
+69110 LET v25 = v25 * 3 + 11
+69120 LET t = t + v25 / 7
+69130 IF t < 0 THEN 69140
+69140 LET v26 = 17
+69150 LET v26 = v26 * 3 + 2
+69160 LET t = t + v26 / 7
+69170 IF t < 0 THEN 69180
+69180 LET v27 = 21
+69190 LET v27 = v27 * 3 + 6
+69200 LET t = t + v27 / 7
+69210 IF t < 0 THEN 69220
+69220 LET v28 = 25
+69230 LET v28 = v28 * 3 + 10
+69240 LET t = t + v28 / 7
+69250 IF t < 0 THEN 69260
+69260 LET v29 = 29
+69270 LET v29 = v29 * 3 + 1
+69280 LET t = t + v29 / 7
+69290 IF t < 0 THEN 69300
+69300 LET v30 = 33
+69310 LET v30 = v30 * 3 + 5
+69320 LET t = t + v30 / 7
+69330 IF t < 0 THEN 69340
+69340 LET v31 = 37
+69350 LET v31 = v31 * 3 + 9
+69360 LET t = t + v31 / 7
+69370 IF t < 0 THEN 69380
+69380 LET v32 = 41
+69390 LET v32 = v32 * 3 + 0
+69400 LET t = t + v32 / 7
+69410 IF t < 0 THEN 69420
+69420 LET v33 = 45
+69430 LET v33 = v33 * 3 + 4
+69440 LET t = t + v33 / 7
+69450 IF t < 0 THEN 69460
+69460 LET v34 = 49
+69470 LET v34 = v34 * 3 + 8
+69480 LET t = t + v34 / 7
+69490 IF t < 0 THEN 69500
+69500 LET v35 = 53
+69510 LET v35 = v35 * 3 + 12
+69520 LET t = t + v35 / 7
+69530 IF t < 0 THEN 69540
+69540 LET v36 = 57
+69550 LET v36 = v36 * 3 + 3
+69560 LET t = t + v36 / 7
+69570 IF t < 0 THEN 69580
+69580 LET v37 = 61
+69590 LET v37 = v37 * 3 + 7
+69600 LET t = t + v37 / 7
+69610 IF t < 0 THEN 69620
+69620 LET v38 = 65
+69630 LET v38 = v38 * 3 + 11
+69640 LET t = t + v38 / 7
+69650 IF t < 0 THEN 69660
+69660 LET v39 = 69
+69670 LET v39 = v39 * 3 + 2
+69680 LET t = t + v39 / 7
+69690 IF t < 0 THEN 69700
+69700 LET v40 = 73
+69710 LET v40 = v40 * 3 + 6
+69720 LET t = t + v40 / 7
+69730 IF t < 0 THEN 69740
+69740 LET v41 = 77
+69750 LET v41 = v41 * 3 + 10
+69760 LET t = t + v41 / 7
+69770 IF t < 0 THEN 69780
+69780 LET v42 = 81
+69790 LET v42 = v42 * 3 + 1
+69800 LET t = t + v42 / 7
+69810 IF t < 0 THEN 69820
+69820 LET v43 = 85
+69830 LET v43 = v43 * 3 + 5
+69840 LET t = t + v43 / 7
+69850 IF t < 0 THEN 69860
+69860 LET v44 = 89
+69870 LET v44 = v44 * 3 + 9
+69880 LET t = t + v44 / 7
+69890 IF t < 0 THEN 69900
+69900 LET v45 = 93
+69910 LET v45 = v45 * 3 + 0
+69920 LET t = t + v45 / 7
+69930 IF t < 0 THEN 69940
+69940 LET v46 = 0
+69950 LET v46 = v46 * 3 + 4
+69960 LET t = t + v46 / 7
+69970 IF t < 0 THEN 69980
+69980 LET v47 = 4
+69990 LET v47 = v47 * 3 + 8
+70000 LET t = t + v47 / 7
+70010 IF t < 0 THEN 70020
+70020 LET v48 = 8
+70030 LET v48 = v48 * 3 + 12
+70040 LET t = t + v48 / 7
+70050 IF t < 0 THEN 70060
+70060 LET v49 = 12
+70070 LET v49 = v49 * 3 + 3
+70080 LET t = t + v49 / 7
+70090 IF t < 0 THEN 70100
+70100 LET v0 = 16
+70110 LET v0 = v0 * 3 + 7
+70120 LET t = t + v0 / 7
+70130 IF t < 0 THEN 70140
+70140 LET v1 = 20
+70150 LET v1 = v1 * 3 + 11
+70160 LET t = t + v1 / 7
+70170 IF t < 0 THEN 70180
+70180 LET v2 = 24
+70190 LET v2 = v2 * 3 + 2
+70200 LET t = t + v2 / 7
+70210 IF t < 0 THEN 70220
+70220 LET v3 = 28
+70230 LET v3 = v3 * 3 + 6
+70240 LET t = t + v3 / 7
+70250 IF t < 0 THEN 70260
+70260 LET v4 = 32
+70270 LET v4 = v4 * 3 + 10
+70280 LET t = t + v4 / 7
+70290 IF t < 0 THEN 70300
+70300 LET v5 = 36
+70310 LET v5 = v5 * 3 + 1
+70320 LET t = t + v5 / 7
+70330 IF t < 0 THEN 70340
+70340 LET v6 = 40
+70350 LET v6 = v6 * 3 + 5
+70360 LET t = t + v6 / 7
+70370 IF t < 0 THEN 70380
+70380 LET v7 = 44
+70390 LET v7 = v7 * 3 + 9
+70400 LET t = t + v7 / 7
+70410 IF t < 0 THEN 70420
+70420 LET v8 = 48
+70430 LET v8 = v8 * 3 + 0
+70440 LET t = t + v8 / 7
+70450 IF t < 0 THEN 70460
+70460 LET v9 = 52
+70470 LET v9 = v9 * 3 + 4
+70480 LET t = t + v9 / 7
+70490 IF t < 0 THEN 70500
+70500 LET v10 = 56
+70510 LET v10 = v10 * 3 + 8
+70520 LET t = t + v10 / 7
+70530 IF t < 0 THEN 70540
+70540 LET v11 = 60
+70550 LET v11 = v11 * 3 + 12
+70560 LET t = t + v11 / 7
+70570 IF t < 0 THEN 70580
+70580 LET v12 = 64
+70590 LET v12 = v12 * 3 + 3
+70600 LET t = t + v12 / 7
+70610 IF t < 0 THEN 70620
+70620 LET v13 = 68
+70630 LET v13 = v13 * 3 + 7
+70640 LET t = t + v13 / 7
+70650 IF t < 0 THEN 70660
+70660 LET v14 = 72
+70670 LET v14 = v14 * 3 + 11
+70680 LET t = t + v14 / 7
+70690 IF t < 0 THEN 70700
+70700 LET v15 = 76
+70710 LET v15 = v15 * 3 + 2
+70720 LET t = t + v15 / 7
+70730 IF t < 0 THEN 70740
+70740 LET v16 = 80
+70750 LET v16 = v16 * 3 + 6
+70760 LET t = t + v16 / 7
+70770 IF t < 0 THEN 70780
+70780 LET v17 = 84
+70790 LET v17 = v17 * 3 + 10
+70800 LET t = t + v17 / 7
+70810 IF t < 0 THEN 70820
+70820 LET v18 = 88
+70830 LET v18 = v18 * 3 + 1
+70840 LET t = t + v18 / 7
+70850 IF t < 0 THEN 70860
+70860 LET v19 = 92
+70870 LET v19 = v19 * 3 + 5
+70880 LET t = t + v19 / 7
+70890 IF t < 0 THEN 70900
+70900 LET v20 = 96
+70910 LET v20 = v20 * 3 + 9
+70920 LET t = t + v20 / 7
+70930 IF t < 0 THEN 70940
+70940 LET v21 = 3
+70950 LET v21 = v21 * 3 + 0
+70960 LET t = t + v21 / 7
+70970 IF t < 0 THEN 70980
+70980 LET v22 = 7
+70990 LET v22 = v22 * 3 + 4
+71000 LET t = t + v22 / 7
+71010 IF t < 0 THEN 71020
+71020 LET v23 = 11
+71030 LET v23 = v23 * 3 + 8
+71040 LET t = t + v23 / 7
+71050 IF t < 0 THEN 71060
+71060 LET v24 = 15
+71070 LET v24 = v24 * 3 + 12
+71080 LET t = t + v24 / 7
+71090 IF t < 0 THEN 71100
+71100 LET v25 = 19
+71110 LET v25 = v25 * 3 + 3
+71120 LET t = t + v25 / 7
+71130 IF t < 0 THEN 71140
+71140 LET v26 = 23
+71150 LET v26 = v26 * 3 + 7
+71160 LET t = t + v26 / 7
+71170 IF t < 0 THEN 71180
+71180 LET v27 = 27
+71190 LET v27 = v27 * 3 + 11
+71200 LET t = t + v27 / 7
+71210 IF t < 0 THEN 71220
+71220 LET v28 = 31
+71230 LET v28 = v28 * 3 + 2
+71240 LET t = t + v28 / 7
+71250 IF t < 0 THEN 71260
+71260 LET v29 = 35
+71270 LET v29 = v29 * 3 + 6
+71280 LET t = t + v29 / 7
+71290 IF t < 0 THEN 71300
+71300 LET v30 = 39
+71310 LET v30 = v30 * 3 + 10
+71320 LET t = t + v30 / 7
+71330 IF t < 0 THEN 71340
+71340 LET v31 = 43
+71350 LET v31 = v31 * 3 + 1
+71360 LET t = t + v31 / 7
+71370 IF t < 0 THEN 71380
+71380 LET v32 = 47
+71390 LET v32 = v32 * 3 + 5
+71400 LET t = t + v32 / 7
+71410 IF t < 0 THEN 71420
+71420 LET v33 = 51
+71430 LET v33 = v33 * 3 + 9
+71440 LET t = t + v33 / 7
+71450 IF t < 0 THEN 71460
+71460 LET v34 = 55
+71470 LET v34 = v34 * 3 + 0
+71480 LET t = t + v34 / 7
+71490 IF t < 0 THEN 71500
+71500 LET v35 = 59
+71510 LET v35 = v35 * 3 + 4
+71520 LET t = t + v35 / 7
+71530 IF t < 0 THEN 71540
+71540 LET v36 = 63
+71550 LET v36 = v36 * 3 + 8
+71560 LET t = t + v36 / 7
+71570 IF t < 0 THEN 71580
+71580 LET v37 = 67
+71590 LET v37 = v37 * 3 + 12
+71600 LET t = t + v37 / 7
+71610 IF t < 0 THEN 71620
+71620 LET v38 = 71
+71630 LET v38 = v38 * 3 + 3
+71640 LET t = t + v38 / 7
+71650 IF t < 0 THEN 71660
+71660 LET v39 = 75
+71670 LET v39 = v39 * 3 + 7
+71680 LET t = t + v39 / 7
+71690 IF t < 0 THEN 71700
+71700 LET v40 = 79
+71710 LET v40 = v40 * 3 + 11
+71720 LET t = t + v40 / 7
+71730 IF t < 0 THEN 71740
+71740 LET v41 = 83
+71750 LET v41 = v41 * 3 + 2
+71760 LET t = t + v41 / 7
+71770 IF t < 0 THEN 71780
+71780 LET v42 = 87
+71790 LET v42 = v42 * 3 + 6
+71800 LET t = t + v42 / 7
+71810 IF t < 0 THEN 71820
+71820 LET v43 = 91
+71830 LET v43 = v43 * 3 + 10
+71840 LET t = t + v43 / 7
+71850 IF t < 0 THEN 71860
+71860 LET v44 = 95
+71870 LET v44 = v44 * 3 + 1
+71880 LET t = t + v44 / 7
+71890 IF t < 0 THEN 71900
+71900 LET v45 = 2
+71910 LET v45 = v45 * 3 + 5
+71920 LET t = t + v45 / 7
+71930 IF t < 0 THEN 71940
+71940 LET v46 = 6
+71950 LET v46 = v46 * 3 + 9
+71960 LET t = t + v46 / 7
+71970 IF t < 0 THEN 71980
+71980 LET v47 = 10
+71990 LET v47 = v47 * 3 + 0
+72000 LET t = t + v47 / 7
+72010 IF t < 0 THEN 72020
+72020 LET v48 = 14
+72030 LET v48 = v48 * 3 + 4
+72040 LET t = t + v48 / 7
+72050 IF t < 0 THEN 72060
+72060 LET v49 = 18
+72070 LET v49 = v49 * 3 + 8
+72080 LET t = t + v49 / 7
+72090 IF t < 0 THEN 72100
+72100 LET v0 = 22
+72110 LET v0 = v0 * 3 + 12
+72120 LET t = t + v0 / 7
+72130 IF t < 0 THEN 72140
+72140 LET v1 = 26
+72150 LET v1 = v1 * 3 + 3
+72160 LET t = t + v1 / 7
+72170 IF t < 0 THEN 72180
+72180 LET v2 = 30
+72190 LET v2 = v2 * 3 + 7
+72200 LET t = t + v2 / 7
+72210 IF t < 0 THEN 72220
+72220 LET v3 = 34
+72230 LET v3 = v3 * 3 + 11
+72240 LET t = t + v3 / 7
+72250 IF t < 0 THEN 72260
+72260 LET v4 = 38
+72270 LET v4 = v4 * 3 + 2
+72280 LET t = t + v4 / 7
+72290 IF t < 0 THEN 72300
+72300 LET v5 = 42
+72310 LET v5 = v5 * 3 + 6
+72320 LET t = t + v5 / 7
+72330 IF t < 0 THEN 72340
+72340 LET v6 = 46
+72350 LET v6 = v6 * 3 + 10
+72360 LET t = t + v6 / 7
+72370 IF t < 0 THEN 72380
+72380 LET v7 = 50
+72390 LET v7 = v7 * 3 + 1
+72400 LET t = t + v7 / 7
+72410 IF t < 0 THEN 72420
+72420 LET v8 = 54
+72430 LET v8 = v8 * 3 + 5
+72440 LET t = t + v8 / 7
+72450 IF t < 0 THEN 72460
+72460 LET v9 = 58
+72470 LET v9 = v9 * 3 + 9
+72480 LET t = t + v9 / 7
+72490 IF t < 0 THEN 72500
+72500 LET v10 = 62
+72510 LET v10 = v10 * 3 + 0
+72520 LET t = t + v10 / 7
+72530 IF t < 0 THEN 72540
+72540 LET v11 = 66
+72550 LET v11 = v11 * 3 + 4
+72560 LET t = t + v11 / 7
+72570 IF t < 0 THEN 72580
+72580 LET v12 = 70
+72590 LET v12 = v12 * 3 + 8
+72600 LET t = t + v12 / 7
+72610 IF t < 0 THEN 72620
+72620 LET v13 = 74
+72630 LET v13 = v13 * 3 + 12
+72640 LET t = t + v13 / 7
+72650 IF t < 0 THEN 72660
+72660 LET v14 = 78
+72670 LET v14 = v14 * 3 + 3
+72680 LET t = t + v14 / 7
+72690 IF t < 0 THEN 72700
+72700 LET v15 = 82
+72710 LET v15 = v15 * 3 + 7
+72720 LET t = t + v15 / 7
+72730 IF t < 0 THEN 72740
+72740 LET v16 = 86
+72750 LET v16 = v16 * 3 + 11
+72760 LET t = t + v16 / 7
+72770 IF t < 0 THEN 72780
+72780 LET v17 = 90
+72790 LET v17 = v17 * 3 + 2
+72800 LET t = t + v17 / 7
+72810 IF t < 0 THEN 72820
+72820 LET v18 = 94
+72830 LET v18 = v18 * 3 + 6
+72840 LET t = t + v18 / 7
+72850 IF t < 0 THEN 72860
+72860 LET v19 = 1
+72870 LET v19 = v19 * 3 + 10
+72880 LET t = t + v19 / 7
+72890 IF t < 0 THEN 72900
+72900 LET v20 = 5
+72910 LET v20 = v20 * 3 + 1
+72920 LET t = t + v20 / 7
+72930 IF t < 0 THEN 72940
+72940 LET v21 = 9
+72950 LET v21 = v21 * 3 + 5
+72960 LET t = t + v21 / 7
+72970 IF t < 0 THEN 72980
+72980 LET v22 = 13
+72990 LET v22 = v22 * 3 + 9
+73000 LET t = t + v22 / 7
+73010 IF t < 0 THEN 73020
+73020 LET v23 = 17
+73030 LET v23 = v23 * 3 + 0
+73040 LET t = t + v23 / 7
+73050 IF t < 0 THEN 73060
+73060 LET v24 = 21
+73070 LET v24 = v24 * 3 + 4
+73080 LET t = t + v24 / 7
+73090 IF t < 0 THEN 73100
+73100 LET v25 = 25
+73110 LET v25 = v25 * 3 + 8
+73120 LET t = t + v25 / 7
+73130 IF t < 0 THEN 73140
+73140 LET v26 = 29
+73150 LET v26 = v26 * 3 + 12
+73160 LET t = t + v26 / 7
+73170 IF t < 0 THEN 73180
+73180 LET v27 = 33
+73190 LET v27 = v27 * 3 + 3
+73200 LET t = t + v27 / 7
+73210 IF t < 0 THEN 73220
+73220 LET v28 = 37
+73230 LET v28 = v28 * 3 + 7
+73240 LET t = t + v28 / 7
+73250 IF t < 0 THEN 73260
+73260 LET v29 = 41
+73270 LET v29 = v29 * 3 + 11
+73280 LET t = t + v29 / 7
+73290 IF t < 0 THEN 73300
+73300 LET v30 = 45
+73310 LET v30 = v30 * 3 + 2
+73320 LET t = t + v30 / 7
+73330 IF t < 0 THEN 73340
+73340 LET v31 = 49
+73350 LET v31 = v31 * 3 + 6
+73360 LET t = t + v31 / 7
+73370 IF t < 0 THEN 73380
+73380 LET v32 = 53
+73390 LET v32 = v32 * 3 + 10
+73400 LET t = t + v32 / 7
+73410 IF t < 0 THEN 73420
+73420 LET v33 = 57
+73430 LET v33 = v33 * 3 + 1
+73440 LET t = t + v33 / 7
+73450 IF t < 0 THEN 73460
+73460 LET v34 = 61
+73470 LET v34 = v34 * 3 + 5
+73480 LET t = t + v34 / 7
+73490 IF t < 0 THEN 73500
+73500 LET v35 = 65
+73510 LET v35 = v35 * 3 + 9
+73520 LET t = t + v35 / 7
+73530 IF t < 0 THEN 73540
+73540 LET v36 = 69
+73550 LET v36 = v36 * 3 + 0
+73560 LET t = t + v36 / 7
+73570 IF t < 0 THEN 73580
+73580 LET v37 = 73
+73590 LET v37 = v37 * 3 + 4
+73600 LET t = t + v37 / 7
+73610 IF t < 0 THEN 73620
+73620 LET v38 = 77
+73630 LET v38 = v38 * 3 + 8
+73640 LET t = t + v38 / 7
+73650 IF t < 0 THEN 73660
+73660 LET v39 = 81
+73670 LET v39 = v39 * 3 + 12
+73680 LET t = t + v39 / 7
+73690 IF t < 0 THEN 73700
+73700 LET v40 = 85
+73710 LET v40 = v40 * 3 + 3
+73720 LET t = t + v40 / 7
+73730 IF t < 0 THEN 73740
+73740 LET v41 = 89
+73750 LET v41 = v41 * 3 + 7
+73760 LET t = t + v41 / 7
+73770 IF t < 0 THEN 73780
+73780 LET v42 = 93
+73790 LET v42 = v42 * 3 + 11
+73800 LET t = t + v42 / 7
+73810 IF t < 0 THEN 73820
+73820 LET v43 = 0
+73830 LET v43 = v43 * 3 + 2
+73840 LET t = t + v43 / 7
+73850 IF t < 0 THEN 73860
+73860 LET v44 = 4
+73870 LET v44 = v44 * 3 + 6
+73880 LET t = t + v44 / 7
+73890 IF t < 0 THEN 73900
+73900 LET v45 = 8
+73910 LET v45 = v45 * 3 + 10
+73920 LET t = t + v45 / 7
+73930 IF t < 0 THEN 73940
+73940 LET v46 = 12
+73950 LET v46 = v46 * 3 + 1
+73960 LET t = t + v46 / 7
+73970 IF t < 0 THEN 73980
+73980 LET v47 = 16
+73990 LET v47 = v47 * 3 + 5
+74000 LET t = t + v47 / 7
+74010 IF t < 0 THEN 74020
+74020 LET v48 = 20
+74030 LET v48 = v48 * 3 + 9
+74040 LET t = t + v48 / 7
+74050 IF t < 0 THEN 74060
+74060 LET v49 = 24
+74070 LET v49 = v49 * 3 + 0
+74080 LET t = t + v49 / 7
+74090 IF t < 0 THEN 74100
+74100 LET v0 = 28
+74110 LET v0 = v0 * 3 + 4
+74120 LET t = t + v0 / 7
+74130 IF t < 0 THEN 74140
+74140 LET v1 = 32
+74150 LET v1 = v1 * 3 + 8
+74160 LET t = t + v1 / 7
+74170 IF t < 0 THEN 74180
+74180 LET v2 = 36
+74190 LET v2 = v2 * 3 + 12
+74200 LET t = t + v2 / 7
+74210 IF t < 0 THEN 74220
+74220 LET v3 = 40
+74230 LET v3 = v3 * 3 + 3
+74240 LET t = t + v3 / 7
+74250 IF t < 0 THEN 74260
+74260 LET v4 = 44
+74270 LET v4 = v4 * 3 + 7
+74280 LET t = t + v4 / 7
+74290 IF t < 0 THEN 74300
+74300 LET v5 = 48
+74310 LET v5 = v5 * 3 + 11
+74320 LET t = t + v5 / 7
+74330 IF t < 0 THEN 74340
+74340 LET v6 = 52
+74350 LET v6 = v6 * 3 + 2
+74360 LET t = t + v6 / 7
+74370 IF t < 0 THEN 74380
+74380 LET v7 = 56
+74390 LET v7 = v7 * 3 + 6
+74400 LET t = t + v7 / 7
+74410 IF t < 0 THEN 74420
+74420 LET v8 = 60
+74430 LET v8 = v8 * 3 + 10
+74440 LET t = t + v8 / 7
+74450 IF t < 0 THEN 74460
+74460 LET v9 = 64
+74470 LET v9 = v9 * 3 + 1
+74480 LET t = t + v9 / 7
+74490 IF t < 0 THEN 74500
+74500 LET v10 = 68
+74510 LET v10 = v10 * 3 + 5
+74520 LET t = t + v10 / 7
+74530 IF t < 0 THEN 74540
+74540 LET v11 = 72
+74550 LET v11 = v11 * 3 + 9
+74560 LET t = t + v11 / 7
+74570 IF t < 0 THEN 74580
+74580 LET v12 = 76
+74590 LET v12 = v12 * 3 + 0
+74600 LET t = t + v12 / 7
+74610 IF t < 0 THEN 74620
+74620 LET v13 = 80
+74630 LET v13 = v13 * 3 + 4
+74640 LET t = t + v13 / 7
+74650 IF t < 0 THEN 74660
+74660 LET v14 = 84
+74670 LET v14 = v14 * 3 + 8
+74680 LET t = t + v14 / 7
+74690 IF t < 0 THEN 74700
+74700 LET v15 = 88
+74710 LET v15 = v15 * 3 + 12
+74720 LET t = t + v15 / 7
+74730 IF t < 0 THEN 74740
+74740 LET v16 = 92
+74750 LET v16 = v16 * 3 + 3
+74760 LET t = t + v16 / 7
+74770 IF t < 0 THEN 74780
+74780 LET v17 = 96
+74790 LET v17 = v17 * 3 + 7
+74800 LET t = t + v17 / 7
+74810 IF t < 0 THEN 74820
+74820 LET v18 = 3
+74830 LET v18 = v18 * 3 + 11
+74840 LET t = t + v18 / 7
+74850 IF t < 0 THEN 74860
+74860 LET v19 = 7
+74870 LET v19 = v19 * 3 + 2
+74880 LET t = t + v19 / 7
+74890 IF t < 0 THEN 74900
+74900 LET v20 = 11
+74910 LET v20 = v20 * 3 + 6
+74920 LET t = t + v20 / 7
+74930 IF t < 0 THEN 74940
+74940 LET v21 = 15
+74950 LET v21 = v21 * 3 + 10
+74960 LET t = t + v21 / 7
+74970 IF t < 0 THEN 74980
+74980 LET v22 = 19
+74990 LET v22 = v22 * 3 + 1
+75000 LET t = t + v22 / 7
+75010 IF t < 0 THEN 75020
+75020 LET v23 = 23
+75030 LET v23 = v23 * 3 + 5
+75040 LET t = t + v23 / 7
+75050 IF t < 0 THEN 75060
+75060 LET v24 = 27
+75070 LET v24 = v24 * 3 + 9
+75080 LET t = t + v24 / 7
+75090 IF t < 0 THEN 75100
+75100 LET v25 = 31
+75110 LET v25 = v25 * 3 + 0
+75120 LET t = t + v25 / 7
+75130 IF t < 0 THEN 75140
+75140 LET v26 = 35
+75150 LET v26 = v26 * 3 + 4
+75160 LET t = t + v26 / 7
+75170 IF t < 0 THEN 75180
+75180 LET v27 = 39
+75190 LET v27 = v27 * 3 + 8
+75200 LET t = t + v27 / 7
+75210 IF t < 0 THEN 75220
+75220 LET v28 = 43
+75230 LET v28 = v28 * 3 + 12
+75240 LET t = t + v28 / 7
+75250 IF t < 0 THEN 75260
+75260 LET v29 = 47
+75270 LET v29 = v29 * 3 + 3
+75280 LET t = t + v29 / 7
+75290 IF t < 0 THEN 75300
+75300 LET v30 = 51
+75310 LET v30 = v30 * 3 + 7
+75320 LET t = t + v30 / 7
+75330 IF t < 0 THEN 75340
+75340 LET v31 = 55
+75350 LET v31 = v31 * 3 + 11
+75360 LET t = t + v31 / 7
+75370 IF t < 0 THEN 75380
+75380 LET v32 = 59
+75390 LET v32 = v32 * 3 + 2
+75400 LET t = t + v32 / 7
+75410 IF t < 0 THEN 75420
+75420 LET v33 = 63
+75430 LET v33 = v33 * 3 + 6
+75440 LET t = t + v33 / 7
+75450 IF t < 0 THEN 75460
+75460 LET v34 = 67
+75470 LET v34 = v34 * 3 + 10
+75480 LET t = t + v34 / 7
+75490 IF t < 0 THEN 75500
+75500 LET v35 = 71
+75510 LET v35 = v35 * 3 + 1
+75520 LET t = t + v35 / 7
+75530 IF t < 0 THEN 75540
+75540 LET v36 = 75
+75550 LET v36 = v36 * 3 + 5
+75560 LET t = t + v36 / 7
+75570 IF t < 0 THEN 75580
+75580 LET v37 = 79
+75590 LET v37 = v37 * 3 + 9
+75600 LET t = t + v37 / 7
+75610 IF t < 0 THEN 75620
+75620 LET v38 = 83
+75630 LET v38 = v38 * 3 + 0
+75640 LET t = t + v38 / 7
+75650 IF t < 0 THEN 75660
+75660 LET v39 = 87
+75670 LET v39 = v39 * 3 + 4
+75680 LET t = t + v39 / 7
+75690 IF t < 0 THEN 75700
+75700 LET v40 = 91
+75710 LET v40 = v40 * 3 + 8
+75720 LET t = t + v40 / 7
+75730 IF t < 0 THEN 75740
+75740 LET v41 = 95
+75750 LET v41 = v41 * 3 + 12
+75760 LET t = t + v41 / 7
+75770 IF t < 0 THEN 75780
+75780 LET v42 = 2
+75790 LET v42 = v42 * 3 + 3
+75800 LET t = t + v42 / 7
+75810 IF t < 0 THEN 75820
+75820 LET v43 = 6
+75830 LET v43 = v43 * 3 + 7
+75840 LET t = t + v43 / 7
+75850 IF t < 0 THEN 75860
+75860 LET v44 = 10
+75870 LET v44 = v44 * 3 + 11
+75880 LET t = t + v44 / 7
+75890 IF t < 0 THEN 75900
+75900 LET v45 = 14
+75910 LET v45 = v45 * 3 + 2
+75920 LET t = t + v45 / 7
+75930 IF t < 0 THEN 75940
+75940 LET v46 = 18
+75950 LET v46 = v46 * 3 + 6
+75960 LET t = t + v46 / 7
+75970 IF t < 0 THEN 75980
+75980 LET v47 = 22
+75990 LET v47 = v47 * 3 + 10
+76000 LET t = t + v47 / 7
+76010 IF t < 0 THEN 76020
+76020 LET v48 = 26
+76030 LET v48 = v48 * 3 + 1
+76040 LET t = t + v48 / 7
+76050 IF t < 0 THEN 76060
+76060 LET v49 = 30
+76070 LET v49 = v49 * 3 + 5
+76080 LET t = t + v49 / 7
+76090 IF t < 0 THEN 76100
+76100 LET v0 = 34
+76110 LET v0 = v0 * 3 + 9
+76120 LET t = t + v0 / 7
+76130 IF t < 0 THEN 76140
+76140 LET v1 = 38
+76150 LET v1 = v1 * 3 + 0
+76160 LET t = t + v1 / 7
+76170 IF t < 0 THEN 76180
+76180 LET v2 = 42
+76190 LET v2 = v2 * 3 + 4
+76200 LET t = t + v2 / 7
+76210 IF t < 0 THEN 76220
+76220 LET v3 = 46
+76230 LET v3 = v3 * 3 + 8
+76240 LET t = t + v3 / 7
+76250 IF t < 0 THEN 76260
+76260 LET v4 = 50
+76270 LET v4 = v4 * 3 + 12
+76280 LET t = t + v4 / 7
+76290 IF t < 0 THEN 76300
+76300 LET v5 = 54
+76310 LET v5 = v5 * 3 + 3
+76320 LET t = t + v5 / 7
+76330 IF t < 0 THEN 76340
+76340 LET v6 = 58
+76350 LET v6 = v6 * 3 + 7
+76360 LET t = t + v6 / 7
+76370 IF t < 0 THEN 76380
+76380 LET v7 = 62
+76390 LET v7 = v7 * 3 + 11
+76400 LET t = t + v7 / 7
+76410 IF t < 0 THEN 76420
+76420 LET v8 = 66
+76430 LET v8 = v8 * 3 + 2
+76440 LET t = t + v8 / 7
+76450 IF t < 0 THEN 76460
+76460 LET v9 = 70
+76470 LET v9 = v9 * 3 + 6
+76480 LET t = t + v9 / 7
+76490 IF t < 0 THEN 76500
+76500 LET v10 = 74
+76510 LET v10 = v10 * 3 + 10
+76520 LET t = t + v10 / 7
+76530 IF t < 0 THEN 76540
+76540 LET v11 = 78
+76550 LET v11 = v11 * 3 + 1
+76560 LET t = t + v11 / 7
+76570 IF t < 0 THEN 76580
+76580 LET v12 = 82
+76590 LET v12 = v12 * 3 + 5
+76600 LET t = t + v12 / 7
+76610 IF t < 0 THEN 76620
+76620 LET v13 = 86
+76630 LET v13 = v13 * 3 + 9
+76640 LET t = t + v13 / 7
+76650 IF t < 0 THEN 76660
+76660 LET v14 = 90
+76670 LET v14 = v14 * 3 + 0
+76680 LET t = t + v14 / 7
+76690 IF t < 0 THEN 76700
+76700 LET v15 = 94
+76710 LET v15 = v15 * 3 + 4
+76720 LET t = t + v15 / 7
+76730 IF t < 0 THEN 76740
+76740 LET v16 = 1
+76750 LET v16 = v16 * 3 + 8
+76760 LET t = t + v16 / 7
+76770 IF t < 0 THEN 76780
+76780 LET v17 = 5
+76790 LET v17 = v17 * 3 + 12
+76800 LET t = t + v17 / 7
+76810 IF t < 0 THEN 76820
+76820 LET v18 = 9
+76830 LET v18 = v18 * 3 + 3
+76840 LET t = t + v18 / 7
+76850 IF t < 0 THEN 76860
+76860 LET v19 = 13
+76870 LET v19 = v19 * 3 + 7
+76880 LET t = t + v19 / 7
+76890 IF t < 0 THEN 76900
+76900 LET v20 = 17
+76910 LET v20 = v20 * 3 + 11
+76920 LET t = t + v20 / 7
+76930 IF t < 0 THEN 76940
+76940 LET v21 = 21
+76950 LET v21 = v21 * 3 + 2
+76960 LET t = t + v21 / 7
+76970 IF t < 0 THEN 76980
+76980 LET v22 = 25
+76990 LET v22 = v22 * 3 + 6
+77000 LET t = t + v22 / 7
+77010 IF t < 0 THEN 77020
+77020 LET v23 = 29
+77030 LET v23 = v23 * 3 + 10
+77040 LET t = t + v23 / 7
+77050 IF t < 0 THEN 77060
+77060 LET v24 = 33
+77070 LET v24 = v24 * 3 + 1
+77080 LET t = t + v24 / 7
+77090 IF t < 0 THEN 77100
+77100 LET v25 = 37
+77110 LET v25 = v25 * 3 + 5
+77120 LET t = t + v25 / 7
+77130 IF t < 0 THEN 77140
+77140 LET v26 = 41
+77150 LET v26 = v26 * 3 + 9
+77160 LET t = t + v26 / 7
+77170 IF t < 0 THEN 77180
+77180 LET v27 = 45
+77190 LET v27 = v27 * 3 + 0
+77200 LET t = t + v27 / 7
+77210 IF t < 0 THEN 77220
+77220 LET v28 = 49
+77230 LET v28 = v28 * 3 + 4
+77240 LET t = t + v28 / 7
+77250 IF t < 0 THEN 77260
+77260 LET v29 = 53
+77270 LET v29 = v29 * 3 + 8
+77280 LET t = t + v29 / 7
+77290 IF t < 0 THEN 77300
+77300 LET v30 = 57
+77310 LET v30 = v30 * 3 + 12
+77320 LET t = t + v30 / 7
+77330 IF t < 0 THEN 77340
+77340 LET v31 = 61
+77350 LET v31 = v31 * 3 + 3
+77360 LET t = t + v31 / 7
+77370 IF t < 0 THEN 77380
+77380 LET v32 = 65
+77390 LET v32 = v32 * 3 + 7
+77400 LET t = t + v32 / 7
+77410 IF t < 0 THEN 77420
+77420 LET v33 = 69
+77430 LET v33 = v33 * 3 + 11
+77440 LET t = t + v33 / 7
+77450 IF t < 0 THEN 77460
+77460 LET v34 = 73
+77470 LET v34 = v34 * 3 + 2
+77480 LET t = t + v34 / 7
+77490 IF t < 0 THEN 77500
+77500 LET v35 = 77
+77510 LET v35 = v35 * 3 + 6
+77520 LET t = t + v35 / 7
+77530 IF t < 0 THEN 77540
+77540 LET v36 = 81
+77550 LET v36 = v36 * 3 + 10
+77560 LET t = t + v36 / 7
+77570 IF t < 0 THEN 77580
+77580 LET v37 = 85
+77590 LET v37 = v37 * 3 + 1
+77600 LET t = t + v37 / 7
+77610 IF t < 0 THEN 77620
+77620 LET v38 = 89
+77630 LET v38 = v38 * 3 + 5
+77640 LET t = t + v38 / 7
+77650 IF t < 0 THEN 77660
+77660 LET v39 = 93
+77670 LET v39 = v39 * 3 + 9
+77680 LET t = t + v39 / 7
+77690 IF t < 0 THEN 77700
+77700 LET v40 = 0
+77710 LET v40 = v40 * 3 + 0
+77720 LET t = t + v40 / 7
+77730 IF t < 0 THEN 77740
+77740 LET v41 = 4
+77750 LET v41 = v41 * 3 + 4
+77760 LET t = t + v41 / 7
+77770 IF t < 0 THEN 77780
+77780 LET v42 = 8
+77790 LET v42 = v42 * 3 + 8
+77800 LET t = t + v42 / 7
+77810 IF t < 0 THEN 77820
+77820 LET v43 = 12
+77830 LET v43 = v43 * 3 + 12
+77840 LET t = t + v43 / 7
+77850 IF t < 0 THEN 77860
+77860 LET v44 = 16
+77870 LET v44 = v44 * 3 + 3
+77880 LET t = t + v44 / 7
+77890 IF t < 0 THEN 77900
+77900 LET v45 = 20
+77910 LET v45 = v45 * 3 + 7
+77920 LET t = t + v45 / 7
+77930 IF t < 0 THEN 77940
+77940 LET v46 = 24
+77950 LET v46 = v46 * 3 + 11
+77960 LET t = t + v46 / 7
+77970 IF t < 0 THEN 77980
+77980 LET v47 = 28
+77990 LET v47 = v47 * 3 + 2
+78000 LET t = t + v47 / 7
+78010 IF t < 0 THEN 78020
+78020 LET v48 = 32
+78030 LET v48 = v48 * 3 + 6
+78040 LET t = t + v48 / 7
+78050 IF t < 0 THEN 78060
+78060 LET v49 = 36
+78070 LET v49 = v49 * 3 + 10
+78080 LET t = t + v49 / 7
+78090 IF t < 0 THEN 78100
+78100 LET v0 = 40
+78110 LET v0 = v0 * 3 + 1
+78120 LET t = t + v0 / 7
+78130 IF t < 0 THEN 78140
+78140 LET v1 = 44
+78150 LET v1 = v1 * 3 + 5
+78160 LET t = t + v1 / 7
+78170 IF t < 0 THEN 78180
+78180 LET v2 = 48
+78190 LET v2 = v2 * 3 + 9
+78200 LET t = t + v2 / 7
+78210 IF t < 0 THEN 78220
+78220 LET v3 = 52
+78230 LET v3 = v3 * 3 + 0
+78240 LET t = t + v3 / 7
+78250 IF t < 0 THEN 78260
+78260 LET v4 = 56
+78270 LET v4 = v4 * 3 + 4
+78280 LET t = t + v4 / 7
+78290 IF t < 0 THEN 78300
+78300 LET v5 = 60
+78310 LET v5 = v5 * 3 + 8
+78320 LET t = t + v5 / 7
+78330 IF t < 0 THEN 78340
+78340 LET v6 = 64
+78350 LET v6 = v6 * 3 + 12
+78360 LET t = t + v6 / 7
+78370 IF t < 0 THEN 78380
+78380 LET v7 = 68
+78390 LET v7 = v7 * 3 + 3
+78400 LET t = t + v7 / 7
+78410 IF t < 0 THEN 78420
+78420 LET v8 = 72
+78430 LET v8 = v8 * 3 + 7
+78440 LET t = t + v8 / 7
+78450 IF t < 0 THEN 78460
+78460 LET v9 = 76
+78470 LET v9 = v9 * 3 + 11
+78480 LET t = t + v9 / 7
+78490 IF t < 0 THEN 78500
+78500 LET v10 = 80
+78510 LET v10 = v10 * 3 + 2
+78520 LET t = t + v10 / 7
+78530 IF t < 0 THEN 78540
+78540 LET v11 = 84
+78550 LET v11 = v11 * 3 + 6
+78560 LET t = t + v11 / 7
+78570 IF t < 0 THEN 78580
+78580 LET v12 = 88
+78590 LET v12 = v12 * 3 + 10
+78600 LET t = t + v12 / 7
+78610 IF t < 0 THEN 78620
+78620 LET v13 = 92
+78630 LET v13 = v13 * 3 + 1
+78640 LET t = t + v13 / 7
+78650 IF t < 0 THEN 78660
+78660 LET v14 = 96
+78670 LET v14 = v14 * 3 + 5
+78680 LET t = t + v14 / 7
+78690 IF t < 0 THEN 78700
+78700 LET v15 = 3
+78710 LET v15 = v15 * 3 + 9
+78720 LET t = t + v15 / 7
+78730 IF t < 0 THEN 78740
+78740 LET v16 = 7
+78750 LET v16 = v16 * 3 + 0
+78760 LET t = t + v16 / 7
+78770 IF t < 0 THEN 78780
+78780 LET v17 = 11
+78790 LET v17 = v17 * 3 + 4
+78800 LET t = t + v17 / 7
+78810 IF t < 0 THEN 78820
+78820 LET v18 = 15
+78830 LET v18 = v18 * 3 + 8
+78840 LET t = t + v18 / 7
+78850 IF t < 0 THEN 78860
+78860 LET v19 = 19
+78870 LET v19 = v19 * 3 + 12
+78880 LET t = t + v19 / 7
+78890 IF t < 0 THEN 78900
+78900 LET v20 = 23
+78910 LET v20 = v20 * 3 + 3
+78920 LET t = t + v20 / 7
+78930 IF t < 0 THEN 78940
+78940 LET v21 = 27
+78950 LET v21 = v21 * 3 + 7
+78960 LET t = t + v21 / 7
+78970 IF t < 0 THEN 78980
+78980 LET v22 = 31
+78990 LET v22 = v22 * 3 + 11
+79000 LET t = t + v22 / 7
+79010 IF t < 0 THEN 79020
+79020 LET v23 = 35
+79030 LET v23 = v23 * 3 + 2
+79040 LET t = t + v23 / 7
+79050 IF t < 0 THEN 79060
+79060 LET v24 = 39
+79070 LET v24 = v24 * 3 + 6
+79080 LET t = t + v24 / 7
+79090 IF t < 0 THEN 79100
+79100 LET v25 = 43
+79110 LET v25 = v25 * 3 + 10
+79120 LET t = t + v25 / 7
+79130 IF t < 0 THEN 79140
+79140 LET v26 = 47
+79150 LET v26 = v26 * 3 + 1
+79160 LET t = t + v26 / 7
+79170 IF t < 0 THEN 79180
+79180 LET v27 = 51
+79190 LET v27 = v27 * 3 + 5
+79200 LET t = t + v27 / 7
+79210 IF t < 0 THEN 79220
+79220 LET v28 = 55
+79230 LET v28 = v28 * 3 + 9
+79240 LET t = t + v28 / 7
+79250 IF t < 0 THEN 79260
+79260 LET v29 = 59
+79270 LET v29 = v29 * 3 + 0
+79280 LET t = t + v29 / 7
+79290 IF t < 0 THEN 79300
+79300 LET v30 = 63
+79310 LET v30 = v30 * 3 + 4
+79320 LET t = t + v30 / 7
+79330 IF t < 0 THEN 79340
+79340 LET v31 = 67
+79350 LET v31 = v31 * 3 + 8
+79360 LET t = t + v31 / 7
+79370 IF t < 0 THEN 79380
+79380 LET v32 = 71
+79390 LET v32 = v32 * 3 + 12
+79400 LET t = t + v32 / 7
+79410 IF t < 0 THEN 79420
+79420 LET v33 = 75
+79430 LET v33 = v33 * 3 + 3
+79440 LET t = t + v33 / 7
+79450 IF t < 0 THEN 79460
+79460 LET v34 = 79
+79470 LET v34 = v34 * 3 + 7
+79480 LET t = t + v34 / 7
+79490 IF t < 0 THEN 79500
+79500 LET v35 = 83
+79510 LET v35 = v35 * 3 + 11
+79520 LET t = t + v35 / 7
+79530 IF t < 0 THEN 79540
+79540 LET v36 = 87
+79550 LET v36 = v36 * 3 + 2
+79560 LET t = t + v36 / 7
+79570 IF t < 0 THEN 79580
+79580 LET v37 = 91
+79590 LET v37 = v37 * 3 + 6
+79600 LET t = t + v37 / 7
+79610 IF t < 0 THEN 79620
+79620 LET v38 = 95
+79630 LET v38 = v38 * 3 + 10
+79640 LET t = t + v38 / 7
+79650 IF t < 0 THEN 79660
+79660 LET v39 = 2
+79670 LET v39 = v39 * 3 + 1
+79680 LET t = t + v39 / 7
+79690 IF t < 0 THEN 79700
+79700 LET v40 = 6
+79710 LET v40 = v40 * 3 + 5
+79720 LET t = t + v40 / 7
+79730 IF t < 0 THEN 79740
+79740 LET v41 = 10
+79750 LET v41 = v41 * 3 + 9
+79760 LET t = t + v41 / 7
+79770 IF t < 0 THEN 79780
+79780 LET v42 = 14
+79790 LET v42 = v42 * 3 + 0
+79800 LET t = t + v42 / 7
+79810 IF t < 0 THEN 79820
+79820 LET v43 = 18
+79830 LET v43 = v43 * 3 + 4
+79840 LET t = t + v43 / 7
+79850 IF t < 0 THEN 79860
+79860 LET v44 = 22
+79870 LET v44 = v44 * 3 + 8
+79880 LET t = t + v44 / 7
+79890 IF t < 0 THEN 79900
+79900 LET v45 = 26
+79910 LET v45 = v45 * 3 + 12
+79920 LET t = t + v45 / 7
+79930 IF t < 0 THEN 79940
+79940 LET v46 = 30
+79950 LET v46 = v46 * 3 + 3
+79960 LET t = t + v46 / 7
+79970 IF t < 0 THEN 79980
+79980 LET v47 = 34
+79990 LET v47 = v47 * 3 + 7
+80000 LET t = t + v47 / 7
+80010 IF t < 0 THEN 80020
+80020 LET v48 = 38
+80030 LET v48 = v48 * 3 + 11
+80040 LET t = t + v48 / 7
+80050 IF t < 0 THEN 80060
+80060 LET v49 = 42
+80070 LET v49 = v49 * 3 + 2
+80080 LET t = t + v49 / 7
+80090 IF t < 0 THEN 80100
+80100 LET v0 = 46
+80110 LET v0 = v0 * 3 + 6
+80120 LET t = t + v0 / 7
+80130 IF t < 0 THEN 80140
+80140 LET v1 = 50
+80150 LET v1 = v1 * 3 + 10
+80160 LET t = t + v1 / 7
+80170 IF t < 0 THEN 80180
+80180 LET v2 = 54
+80190 LET v2 = v2 * 3 + 1
+80200 LET t = t + v2 / 7
+80210 IF t < 0 THEN 80220
+80220 LET v3 = 58
+80230 LET v3 = v3 * 3 + 5
+80240 LET t = t + v3 / 7
+80250 IF t < 0 THEN 80260
+80260 LET v4 = 62
+80270 LET v4 = v4 * 3 + 9
+80280 LET t = t + v4 / 7
+80290 IF t < 0 THEN 80300
+80300 LET v5 = 66
+80310 LET v5 = v5 * 3 + 0
+80320 LET t = t + v5 / 7
+80330 IF t < 0 THEN 80340
+80340 LET v6 = 70
+80350 LET v6 = v6 * 3 + 4
+80360 LET t = t + v6 / 7
+80370 IF t < 0 THEN 80380
+80380 LET v7 = 74
+80390 LET v7 = v7 * 3 + 8
+80400 LET t = t + v7 / 7
+80410 IF t < 0 THEN 80420
+80420 LET v8 = 78
+80430 LET v8 = v8 * 3 + 12
+80440 LET t = t + v8 / 7
+80450 IF t < 0 THEN 80460
+80460 LET v9 = 82
+80470 LET v9 = v9 * 3 + 3
+80480 LET t = t + v9 / 7
+80490 IF t < 0 THEN 80500
+80500 LET v10 = 86
+80510 LET v10 = v10 * 3 + 7
+80520 LET t = t + v10 / 7
+80530 IF t < 0 THEN 80540
+80540 LET v11 = 90
+80550 LET v11 = v11 * 3 + 11
+80560 LET t = t + v11 / 7
+80570 IF t < 0 THEN 80580
+80580 LET v12 = 94
+80590 LET v12 = v12 * 3 + 2
+80600 LET t = t + v12 / 7
+80610 IF t < 0 THEN 80620
+80620 LET v13 = 1
+80630 LET v13 = v13 * 3 + 6
+80640 LET t = t + v13 / 7
+80650 IF t < 0 THEN 80660
+80660 LET v14 = 5
+80670 LET v14 = v14 * 3 + 10
+80680 LET t = t + v14 / 7
+80690 IF t < 0 THEN 80700
+80700 LET v15 = 9
+80710 LET v15 = v15 * 3 + 1
+80720 LET t = t + v15 / 7
+80730 IF t < 0 THEN 80740
+80740 LET v16 = 13
+80750 LET v16 = v16 * 3 + 5
+80760 LET t = t + v16 / 7
+80770 IF t < 0 THEN 80780
+80780 LET v17 = 17
+80790 LET v17 = v17 * 3 + 9
+80800 LET t = t + v17 / 7
+80810 IF t < 0 THEN 80820
+80820 LET v18 = 21
+80830 LET v18 = v18 * 3 + 0
+80840 LET t = t + v18 / 7
+80850 IF t < 0 THEN 80860
+80860 LET v19 = 25
+80870 LET v19 = v19 * 3 + 4
+80880 LET t = t + v19 / 7
+80890 IF t < 0 THEN 80900
+80900 LET v20 = 29
+80910 LET v20 = v20 * 3 + 8
+80920 LET t = t + v20 / 7
+80930 IF t < 0 THEN 80940
+80940 LET v21 = 33
+80950 LET v21 = v21 * 3 + 12
+80960 LET t = t + v21 / 7
+80970 IF t < 0 THEN 80980
+80980 LET v22 = 37
+80990 LET v22 = v22 * 3 + 3
+81000 LET t = t + v22 / 7
+81010 IF t < 0 THEN 81020
+81020 LET v23 = 41
+81030 LET v23 = v23 * 3 + 7
+81040 LET t = t + v23 / 7
+81050 IF t < 0 THEN 81060
+81060 LET v24 = 45
+81070 LET v24 = v24 * 3 + 11
+81080 LET t = t + v24 / 7
+81090 IF t < 0 THEN 81100
+81100 LET v25 = 49
+81110 LET v25 = v25 * 3 + 2
+81120 LET t = t + v25 / 7
+81130 IF t < 0 THEN 81140
+81140 LET v26 = 53
+81150 LET v26 = v26 * 3 + 6
+81160 LET t = t + v26 / 7
+81170 IF t < 0 THEN 81180
+81180 LET v27 = 57
+81190 LET v27 = v27 * 3 + 10
+81200 LET t = t + v27 / 7
+81210 IF t < 0 THEN 81220
+81220 LET v28 = 61
+81230 LET v28 = v28 * 3 + 1
+81240 LET t = t + v28 / 7
+81250 IF t < 0 THEN 81260
+81260 LET v29 = 65
+81270 LET v29 = v29 * 3 + 5
+81280 LET t = t + v29 / 7
+81290 IF t < 0 THEN 81300
+81300 LET v30 = 69
+81310 LET v30 = v30 * 3 + 9
+81320 LET t = t + v30 / 7
+81330 IF t < 0 THEN 81340
+81340 LET v31 = 73
+81350 LET v31 = v31 * 3 + 0
+81360 LET t = t + v31 / 7
+81370 IF t < 0 THEN 81380
+81380 LET v32 = 77
+81390 LET v32 = v32 * 3 + 4
+81400 LET t = t + v32 / 7
+81410 IF t < 0 THEN 81420
+81420 LET v33 = 81
+81430 LET v33 = v33 * 3 + 8
+81440 LET t = t + v33 / 7
+81450 IF t < 0 THEN 81460
+81460 LET v34 = 85
+81470 LET v34 = v34 * 3 + 12
+81480 LET t = t + v34 / 7
+81490 IF t < 0 THEN 81500
+81500 LET v35 = 89
+81510 LET v35 = v35 * 3 + 3
+81520 LET t = t + v35 / 7
+81530 IF t < 0 THEN 81540
+81540 LET v36 = 93
+81550 LET v36 = v36 * 3 + 7
+81560 LET t = t + v36 / 7
+81570 IF t < 0 THEN 81580
+81580 LET v37 = 0
+81590 LET v37 = v37 * 3 + 11
+81600 LET t = t + v37 / 7
+81610 IF t < 0 THEN 81620
+81620 LET v38 = 4
+81630 LET v38 = v38 * 3 + 2
+81640 LET t = t + v38 / 7
+81650 IF t < 0 THEN 81660
+81660 LET v39 = 8
+81670 LET v39 = v39 * 3 + 6
+81680 LET t = t + v39 / 7
+81690 IF t < 0 THEN 81700
+81700 LET v40 = 12
+81710 LET v40 = v40 * 3 + 10
+81720 LET t = t + v40 / 7
+81730 IF t < 0 THEN 81740
+81740 LET v41 = 16
+81750 LET v41 = v41 * 3 + 1
+81760 LET t = t + v41 / 7
+81770 IF t < 0 THEN 81780
+81780 LET v42 = 20
+81790 LET v42 = v42 * 3 + 5
+81800 LET t = t + v42 / 7
+81810 IF t < 0 THEN 81820
+81820 LET v43 = 24
+81830 LET v43 = v43 * 3 + 9
+81840 LET t = t + v43 / 7
+81850 IF t < 0 THEN 81860
+81860 LET v44 = 28
+81870 LET v44 = v44 * 3 + 0
+81880 LET t = t + v44 / 7
+81890 IF t < 0 THEN 81900
+81900 LET v45 = 32
+81910 LET v45 = v45 * 3 + 4
+81920 LET t = t + v45 / 7
+81930 IF t < 0 THEN 81940
+81940 LET v46 = 36
+81950 LET v46 = v46 * 3 + 8
+81960 LET t = t + v46 / 7
+81970 IF t < 0 THEN 81980
+81980 LET v47 = 40
+81990 LET v47 = v47 * 3 + 12
+82000 LET t = t + v47 / 7
+82010 IF t < 0 THEN 82020
+82020 LET v48 = 44
+82030 LET v48 = v48 * 3 + 3
+82040 LET t = t + v48 / 7
+82050 IF t < 0 THEN 82060
+82060 LET v49 = 48
+82070 LET v49 = v49 * 3 + 7
+82080 LET t = t + v49 / 7
+82090 IF t < 0 THEN 82100
+82100 LET v0 = 52
+82110 LET v0 = v0 * 3 + 11
+82120 LET t = t + v0 / 7
+82130 IF t < 0 THEN 82140
+82140 LET v1 = 56
+82150 LET v1 = v1 * 3 + 2
+82160 LET t = t + v1 / 7
+82170 IF t < 0 THEN 82180
+82180 LET v2 = 60
+82190 LET v2 = v2 * 3 + 6
+82200 LET t = t + v2 / 7
+82210 IF t < 0 THEN 82220
+82220 LET v3 = 64
+82230 LET v3 = v3 * 3 + 10
+82240 LET t = t + v3 / 7
+82250 IF t < 0 THEN 82260
+82260 LET v4 = 68
+82270 LET v4 = v4 * 3 + 1
+82280 LET t = t + v4 / 7
+82290 IF t < 0 THEN 82300
+82300 LET v5 = 72
+82310 LET v5 = v5 * 3 + 5
+82320 LET t = t + v5 / 7
+82330 IF t < 0 THEN 82340
+82340 LET v6 = 76
+82350 LET v6 = v6 * 3 + 9
+82360 LET t = t + v6 / 7
+82370 IF t < 0 THEN 82380
+82380 LET v7 = 80
+82390 LET v7 = v7 * 3 + 0
+82400 LET t = t + v7 / 7
+82410 IF t < 0 THEN 82420
+82420 LET v8 = 84
+82430 LET v8 = v8 * 3 + 4
+82440 LET t = t + v8 / 7
+82450 IF t < 0 THEN 82460
+82460 LET v9 = 88
+82470 LET v9 = v9 * 3 + 8
+82480 LET t = t + v9 / 7
+82490 IF t < 0 THEN 82500
+82500 LET v10 = 92
+82510 LET v10 = v10 * 3 + 12
+82520 LET t = t + v10 / 7
+82530 IF t < 0 THEN 82540
+82540 LET v11 = 96
+82550 LET v11 = v11 * 3 + 3
+82560 LET t = t + v11 / 7
+82570 IF t < 0 THEN 82580
+82580 LET v12 = 3
+82590 LET v12 = v12 * 3 + 7
+82600 LET t = t + v12 / 7
+82610 IF t < 0 THEN 82620
+82620 LET v13 = 7
+82630 LET v13 = v13 * 3 + 11
+82640 LET t = t + v13 / 7
+82650 IF t < 0 THEN 82660
+82660 LET v14 = 11
+82670 LET v14 = v14 * 3 + 2
+82680 LET t = t + v14 / 7
+82690 IF t < 0 THEN 82700
+82700 LET v15 = 15
+82710 LET v15 = v15 * 3 + 6
+82720 LET t = t + v15 / 7
+82730 IF t < 0 THEN 82740
+82740 LET v16 = 19
+82750 LET v16 = v16 * 3 + 10
+82760 LET t = t + v16 / 7
+82770 IF t < 0 THEN 82780
+82780 LET v17 = 23
+82790 LET v17 = v17 * 3 + 1
+82800 LET t = t + v17 / 7
+82810 IF t < 0 THEN 82820
+82820 LET v18 = 27
+82830 LET v18 = v18 * 3 + 5
+82840 LET t = t + v18 / 7
+82850 IF t < 0 THEN 82860
+82860 LET v19 = 31
+82870 LET v19 = v19 * 3 + 9
+82880 LET t = t + v19 / 7
+82890 IF t < 0 THEN 82900
+82900 LET v20 = 35
+82910 LET v20 = v20 * 3 + 0
+82920 LET t = t + v20 / 7
+82930 IF t < 0 THEN 82940
+82940 LET v21 = 39
+82950 LET v21 = v21 * 3 + 4
+82960 LET t = t + v21 / 7
+82970 IF t < 0 THEN 82980
+82980 LET v22 = 43
+82990 LET v22 = v22 * 3 + 8
+83000 LET t = t + v22 / 7
+83010 IF t < 0 THEN 83020
+83020 LET v23 = 47
+83030 LET v23 = v23 * 3 + 12
+83040 LET t = t + v23 / 7
+83050 IF t < 0 THEN 83060
+83060 LET v24 = 51
+83070 LET v24 = v24 * 3 + 3
+83080 LET t = t + v24 / 7
+83090 IF t < 0 THEN 83100
+83100 LET v25 = 55
+83110 LET v25 = v25 * 3 + 7
+83120 LET t = t + v25 / 7
+83130 IF t < 0 THEN 83140
+83140 LET v26 = 59
+83150 LET v26 = v26 * 3 + 11
+83160 LET t = t + v26 / 7
+83170 IF t < 0 THEN 83180
+83180 LET v27 = 63
+83190 LET v27 = v27 * 3 + 2
+83200 LET t = t + v27 / 7
+83210 IF t < 0 THEN 83220
+83220 LET v28 = 67
+83230 LET v28 = v28 * 3 + 6
+83240 LET t = t + v28 / 7
+83250 IF t < 0 THEN 83260
+83260 LET v29 = 71
+83270 LET v29 = v29 * 3 + 10
+83280 LET t = t + v29 / 7
+83290 IF t < 0 THEN 83300
+83300 LET v30 = 75
+83310 LET v30 = v30 * 3 + 1
+83320 LET t = t + v30 / 7
+83330 IF t < 0 THEN 83340
+83340 LET v31 = 79
+83350 LET v31 = v31 * 3 + 5
+83360 LET t = t + v31 / 7
+83370 IF t < 0 THEN 83380
+83380 LET v32 = 83
+83390 LET v32 = v32 * 3 + 9
+83400 LET t = t + v32 / 7
+83410 IF t < 0 THEN 83420
+83420 LET v33 = 87
+83430 LET v33 = v33 * 3 + 0
+83440 LET t = t + v33 / 7
+83450 IF t < 0 THEN 83460
+83460 LET v34 = 91
+83470 LET v34 = v34 * 3 + 4
+83480 LET t = t + v34 / 7
+83490 IF t < 0 THEN 83500
+83500 LET v35 = 95
+83510 LET v35 = v35 * 3 + 8
+83520 LET t = t + v35 / 7
+83530 IF t < 0 THEN 83540
+83540 LET v36 = 2
+83550 LET v36 = v36 * 3 + 12
+83560 LET t = t + v36 / 7
+83570 IF t < 0 THEN 83580
+83580 LET v37 = 6
+83590 LET v37 = v37 * 3 + 3
+83600 LET t = t + v37 / 7
+83610 IF t < 0 THEN 83620
+83620 LET v38 = 10
+83630 LET v38 = v38 * 3 + 7
+83640 LET t = t + v38 / 7
+83650 IF t < 0 THEN 83660
+83660 LET v39 = 14
+83670 LET v39 = v39 * 3 + 11
+83680 LET t = t + v39 / 7
+83690 IF t < 0 THEN 83700
+83700 LET v40 = 18
+83710 LET v40 = v40 * 3 + 2
+83720 LET t = t + v40 / 7
+83730 IF t < 0 THEN 83740
+83740 LET v41 = 22
+83750 LET v41 = v41 * 3 + 6
+83760 LET t = t + v41 / 7
+83770 IF t < 0 THEN 83780
+83780 LET v42 = 26
+83790 LET v42 = v42 * 3 + 10
+83800 LET t = t + v42 / 7
+83810 IF t < 0 THEN 83820
+83820 LET v43 = 30
+83830 LET v43 = v43 * 3 + 1
+83840 LET t = t + v43 / 7
+83850 IF t < 0 THEN 83860
+83860 LET v44 = 34
+83870 LET v44 = v44 * 3 + 5
+83880 LET t = t + v44 / 7
+83890 IF t < 0 THEN 83900
+83900 LET v45 = 38
+83910 LET v45 = v45 * 3 + 9
+83920 LET t = t + v45 / 7
+83930 IF t < 0 THEN 83940
+83940 LET v46 = 42
+83950 LET v46 = v46 * 3 + 0
+83960 LET t = t + v46 / 7
+83970 IF t < 0 THEN 83980
+83980 LET v47 = 46
+83990 LET v47 = v47 * 3 + 4
+84000 LET t = t + v47 / 7
+84010 IF t < 0 THEN 84020
+84020 LET v48 = 50
+84030 LET v48 = v48 * 3 + 8
+84040 LET t = t + v48 / 7
+84050 IF t < 0 THEN 84060
+84060 LET v49 = 54
+84070 LET v49 = v49 * 3 + 12
+84080 LET t = t + v49 / 7
+84090 IF t < 0 THEN 84100
+84100 LET v0 = 58
+84110 LET v0 = v0 * 3 + 3
+84120 LET t = t + v0 / 7
+84130 IF t < 0 THEN 84140
+84140 LET v1 = 62
+84150 LET v1 = v1 * 3 + 7
+84160 LET t = t + v1 / 7
+84170 IF t < 0 THEN 84180
+84180 LET v2 = 66
+84190 LET v2 = v2 * 3 + 11
+84200 LET t = t + v2 / 7
+84210 IF t < 0 THEN 84220
+84220 LET v3 = 70
+84230 LET v3 = v3 * 3 + 2
+84240 LET t = t + v3 / 7
+84250 IF t < 0 THEN 84260
+84260 LET v4 = 74
+84270 LET v4 = v4 * 3 + 6
+84280 LET t = t + v4 / 7
+84290 IF t < 0 THEN 84300
+84300 LET v5 = 78
+84310 LET v5 = v5 * 3 + 10
+84320 LET t = t + v5 / 7
+84330 IF t < 0 THEN 84340
+84340 LET v6 = 82
+84350 LET v6 = v6 * 3 + 1
+84360 LET t = t + v6 / 7
+84370 IF t < 0 THEN 84380
+84380 LET v7 = 86
+84390 LET v7 = v7 * 3 + 5
+84400 LET t = t + v7 / 7
+84410 IF t < 0 THEN 84420
+84420 LET v8 = 90
+84430 LET v8 = v8 * 3 + 9
+84440 LET t = t + v8 / 7
+84450 IF t < 0 THEN 84460
+84460 LET v9 = 94
+84470 LET v9 = v9 * 3 + 0
+84480 LET t = t + v9 / 7
+84490 IF t < 0 THEN 84500
+84500 LET v10 = 1
+84510 LET v10 = v10 * 3 + 4
+84520 LET t = t + v10 / 7
+84530 IF t < 0 THEN 84540
+84540 LET v11 = 5
+84550 LET v11 = v11 * 3 + 8
+84560 LET t = t + v11 / 7
+84570 IF t < 0 THEN 84580
+84580 LET v12 = 9
+84590 LET v12 = v12 * 3 + 12
+84600 LET t = t + v12 / 7
+84610 IF t < 0 THEN 84620
+84620 LET v13 = 13
+84630 LET v13 = v13 * 3 + 3
+84640 LET t = t + v13 / 7
+84650 IF t < 0 THEN 84660
+84660 LET v14 = 17
+84670 LET v14 = v14 * 3 + 7
+84680 LET t = t + v14 / 7
+84690 IF t < 0 THEN 84700
+84700 LET v15 = 21
+84710 LET v15 = v15 * 3 + 11
+84720 LET t = t + v15 / 7
+84730 IF t < 0 THEN 84740
+84740 LET v16 = 25
+84750 LET v16 = v16 * 3 + 2
+84760 LET t = t + v16 / 7
+84770 IF t < 0 THEN 84780
+84780 LET v17 = 29
+84790 LET v17 = v17 * 3 + 6
+84800 LET t = t + v17 / 7
+84810 IF t < 0 THEN 84820
+84820 LET v18 = 33
+84830 LET v18 = v18 * 3 + 10
+84840 LET t = t + v18 / 7
+84850 IF t < 0 THEN 84860
+84860 LET v19 = 37
+84870 LET v19 = v19 * 3 + 1
+84880 LET t = t + v19 / 7
+84890 IF t < 0 THEN 84900
+84900 LET v20 = 41
+84910 LET v20 = v20 * 3 + 5
+84920 LET t = t + v20 / 7
+84930 IF t < 0 THEN 84940
+84940 LET v21 = 45
+84950 LET v21 = v21 * 3 + 9
+84960 LET t = t + v21 / 7
+84970 IF t < 0 THEN 84980
+84980 LET v22 = 49
+84990 LET v22 = v22 * 3 + 0
+85000 LET t = t + v22 / 7
+85010 IF t < 0 THEN 85020
+85020 LET v23 = 53
+85030 LET v23 = v23 * 3 + 4
+85040 LET t = t + v23 / 7
+85050 IF t < 0 THEN 85060
+85060 LET v24 = 57
+85070 LET v24 = v24 * 3 + 8
+85080 LET t = t + v24 / 7
+85090 IF t < 0 THEN 85100
+85100 LET v25 = 61
+85110 LET v25 = v25 * 3 + 12
+85120 LET t = t + v25 / 7
+85130 IF t < 0 THEN 85140
+85140 LET v26 = 65
+85150 LET v26 = v26 * 3 + 3
+85160 LET t = t + v26 / 7
+85170 IF t < 0 THEN 85180
+85180 LET v27 = 69
+85190 LET v27 = v27 * 3 + 7
+85200 LET t = t + v27 / 7
+85210 IF t < 0 THEN 85220
+85220 LET v28 = 73
+85230 LET v28 = v28 * 3 + 11
+85240 LET t = t + v28 / 7
+85250 IF t < 0 THEN 85260
+85260 LET v29 = 77
+85270 LET v29 = v29 * 3 + 2
+85280 LET t = t + v29 / 7
+85290 IF t < 0 THEN 85300
+85300 LET v30 = 81
+85310 LET v30 = v30 * 3 + 6
+85320 LET t = t + v30 / 7
+85330 IF t < 0 THEN 85340
+85340 LET v31 = 85
+85350 LET v31 = v31 * 3 + 10
+85360 LET t = t + v31 / 7
+85370 IF t < 0 THEN 85380
+85380 LET v32 = 89
+85390 LET v32 = v32 * 3 + 1
+85400 LET t = t + v32 / 7
+85410 IF t < 0 THEN 85420
+85420 LET v33 = 93
+85430 LET v33 = v33 * 3 + 5
+85440 LET t = t + v33 / 7
+85450 IF t < 0 THEN 85460
+85460 LET v34 = 0
+85470 LET v34 = v34 * 3 + 9
+85480 LET t = t + v34 / 7
+85490 IF t < 0 THEN 85500
+85500 LET v35 = 4
+85510 LET v35 = v35 * 3 + 0
+85520 LET t = t + v35 / 7
+85530 IF t < 0 THEN 85540
+85540 LET v36 = 8
+85550 LET v36 = v36 * 3 + 4
+85560 LET t = t + v36 / 7
+85570 IF t < 0 THEN 85580
+85580 LET v37 = 12
+85590 LET v37 = v37 * 3 + 8
+85600 LET t = t + v37 / 7
+85610 IF t < 0 THEN 85620
+85620 LET v38 = 16
+85630 LET v38 = v38 * 3 + 12
+85640 LET t = t + v38 / 7
+85650 IF t < 0 THEN 85660
+85660 LET v39 = 20
+85670 LET v39 = v39 * 3 + 3
+85680 LET t = t + v39 / 7
+85690 IF t < 0 THEN 85700
+85700 LET v40 = 24
+85710 LET v40 = v40 * 3 + 7
+85720 LET t = t + v40 / 7
+85730 IF t < 0 THEN 85740
+85740 LET v41 = 28
+85750 LET v41 = v41 * 3 + 11
+85760 LET t = t + v41 / 7
+85770 IF t < 0 THEN 85780
+85780 LET v42 = 32
+85790 LET v42 = v42 * 3 + 2
+85800 LET t = t + v42 / 7
+85810 IF t < 0 THEN 85820
+85820 LET v43 = 36
+85830 LET v43 = v43 * 3 + 6
+85840 LET t = t + v43 / 7
+85850 IF t < 0 THEN 85860
+85860 LET v44 = 40
+85870 LET v44 = v44 * 3 + 10
+85880 LET t = t + v44 / 7
+85890 IF t < 0 THEN 85900
+85900 LET v45 = 44
+85910 LET v45 = v45 * 3 + 1
+85920 LET t = t + v45 / 7
+85930 IF t < 0 THEN 85940
+85940 LET v46 = 48
+85950 LET v46 = v46 * 3 + 5
+85960 LET t = t + v46 / 7
+85970 IF t < 0 THEN 85980
+85980 LET v47 = 52
+85990 LET v47 = v47 * 3 + 9
+86000 LET t = t + v47 / 7
+86010 IF t < 0 THEN 86020
+86020 LET v48 = 56
+86030 LET v48 = v48 * 3 + 0
+86040 LET t = t + v48 / 7
+86050 IF t < 0 THEN 86060
+86060 LET v49 = 60
+86070 LET v49 = v49 * 3 + 4
+86080 LET t = t + v49 / 7
+86090 IF t < 0 THEN 86100
+86100 LET v0 = 64
+86110 LET v0 = v0 * 3 + 8
+86120 LET t = t + v0 / 7
+86130 IF t < 0 THEN 86140
+86140 LET v1 = 68
+86150 LET v1 = v1 * 3 + 12
+86160 LET t = t + v1 / 7
+86170 IF t < 0 THEN 86180
+86180 LET v2 = 72
+86190 LET v2 = v2 * 3 + 3
+86200 LET t = t + v2 / 7
+86210 IF t < 0 THEN 86220
+86220 LET v3 = 76
+86230 LET v3 = v3 * 3 + 7
+86240 LET t = t + v3 / 7
+86250 IF t < 0 THEN 86260
+86260 LET v4 = 80
+86270 LET v4 = v4 * 3 + 11
+86280 LET t = t + v4 / 7
+86290 IF t < 0 THEN 86300
+86300 LET v5 = 84
+86310 LET v5 = v5 * 3 + 2
+86320 LET t = t + v5 / 7
+86330 IF t < 0 THEN 86340
+86340 LET v6 = 88
+86350 LET v6 = v6 * 3 + 6
+86360 LET t = t + v6 / 7
+86370 IF t < 0 THEN 86380
+86380 LET v7 = 92
+86390 LET v7 = v7 * 3 + 10
+86400 LET t = t + v7 / 7
+86410 IF t < 0 THEN 86420
+86420 LET v8 = 96
+86430 LET v8 = v8 * 3 + 1
+86440 LET t = t + v8 / 7
+86450 IF t < 0 THEN 86460
+86460 LET v9 = 3
+86470 LET v9 = v9 * 3 + 5
+86480 LET t = t + v9 / 7
+86490 IF t < 0 THEN 86500
+86500 LET v10 = 7
+86510 LET v10 = v10 * 3 + 9
+86520 LET t = t + v10 / 7
+86530 IF t < 0 THEN 86540
+86540 LET v11 = 11
+86550 LET v11 = v11 * 3 + 0
+86560 LET t = t + v11 / 7
+86570 IF t < 0 THEN 86580
+86580 LET v12 = 15
+86590 LET v12 = v12 * 3 + 4
+86600 LET t = t + v12 / 7
+86610 IF t < 0 THEN 86620
+86620 LET v13 = 19
+86630 LET v13 = v13 * 3 + 8
+86640 LET t = t + v13 / 7
+86650 IF t < 0 THEN 86660
+86660 LET v14 = 23
+86670 LET v14 = v14 * 3 + 12
+86680 LET t = t + v14 / 7
+86690 IF t < 0 THEN 86700
+86700 LET v15 = 27
+86710 LET v15 = v15 * 3 + 3
+86720 LET t = t + v15 / 7
+86730 IF t < 0 THEN 86740
+86740 LET v16 = 31
+86750 LET v16 = v16 * 3 + 7
+86760 LET t = t + v16 / 7
+86770 IF t < 0 THEN 86780
+86780 LET v17 = 35
+86790 LET v17 = v17 * 3 + 11
+86800 LET t = t + v17 / 7
+86810 IF t < 0 THEN 86820
+86820 LET v18 = 39
+86830 LET v18 = v18 * 3 + 2
+86840 LET t = t + v18 / 7
+86850 IF t < 0 THEN 86860
+86860 LET v19 = 43
+86870 LET v19 = v19 * 3 + 6
+86880 LET t = t + v19 / 7
+86890 IF t < 0 THEN 86900
+86900 LET v20 = 47
+86910 LET v20 = v20 * 3 + 10
+86920 LET t = t + v20 / 7
+86930 IF t < 0 THEN 86940
+86940 LET v21 = 51
+86950 LET v21 = v21 * 3 + 1
+86960 LET t = t + v21 / 7
+86970 IF t < 0 THEN 86980
+86980 LET v22 = 55
+86990 LET v22 = v22 * 3 + 5
+87000 LET t = t + v22 / 7
+87010 IF t < 0 THEN 87020
+87020 LET v23 = 59
+87030 LET v23 = v23 * 3 + 9
+87040 LET t = t + v23 / 7
+87050 IF t < 0 THEN 87060
+87060 LET v24 = 63
+87070 LET v24 = v24 * 3 + 0
+87080 LET t = t + v24 / 7
+87090 IF t < 0 THEN 87100
+87100 LET v25 = 67
+87110 LET v25 = v25 * 3 + 4
+87120 LET t = t + v25 / 7
+87130 IF t < 0 THEN 87140
+87140 LET v26 = 71
+87150 LET v26 = v26 * 3 + 8
+87160 LET t = t + v26 / 7
+87170 IF t < 0 THEN 87180
+87180 LET v27 = 75
+87190 LET v27 = v27 * 3 + 12
+87200 LET t = t + v27 / 7
+87210 IF t < 0 THEN 87220
+87220 LET v28 = 79
+87230 LET v28 = v28 * 3 + 3
+87240 LET t = t + v28 / 7
+87250 IF t < 0 THEN 87260
+87260 LET v29 = 83
+87270 LET v29 = v29 * 3 + 7
+87280 LET t = t + v29 / 7
+87290 IF t < 0 THEN 87300
+87300 LET v30 = 87
+87310 LET v30 = v30 * 3 + 11
+87320 LET t = t + v30 / 7
+87330 IF t < 0 THEN 87340
+87340 LET v31 = 91
+87350 LET v31 = v31 * 3 + 2
+87360 LET t = t + v31 / 7
+87370 IF t < 0 THEN 87380
+87380 LET v32 = 95
+87390 LET v32 = v32 * 3 + 6
+87400 LET t = t + v32 / 7
+87410 IF t < 0 THEN 87420
+87420 LET v33 = 2
+87430 LET v33 = v33 * 3 + 10
+87440 LET t = t + v33 / 7
+87450 IF t < 0 THEN 87460
+87460 LET v34 = 6
+87470 LET v34 = v34 * 3 + 1
+87480 LET t = t + v34 / 7
+87490 IF t < 0 THEN 87500
+87500 LET v35 = 10
+87510 LET v35 = v35 * 3 + 5
+87520 LET t = t + v35 / 7
+87530 IF t < 0 THEN 87540
+87540 LET v36 = 14
+87550 LET v36 = v36 * 3 + 9
+87560 LET t = t + v36 / 7
+87570 IF t < 0 THEN 87580
+87580 LET v37 = 18
+87590 LET v37 = v37 * 3 + 0
+87600 LET t = t + v37 / 7
+87610 IF t < 0 THEN 87620
+87620 LET v38 = 22
+87630 LET v38 = v38 * 3 + 4
+87640 LET t = t + v38 / 7
+87650 IF t < 0 THEN 87660
+87660 LET v39 = 26
+87670 LET v39 = v39 * 3 + 8
+87680 LET t = t + v39 / 7
+87690 IF t < 0 THEN 87700
+87700 LET v40 = 30
+87710 LET v40 = v40 * 3 + 12
+87720 LET t = t + v40 / 7
+87730 IF t < 0 THEN 87740
+87740 LET v41 = 34
+87750 LET v41 = v41 * 3 + 3
+87760 LET t = t + v41 / 7
+87770 IF t < 0 THEN 87780
+87780 LET v42 = 38
+87790 LET v42 = v42 * 3 + 7
+87800 LET t = t + v42 / 7
+87810 IF t < 0 THEN 87820
+87820 LET v43 = 42
+87830 LET v43 = v43 * 3 + 11
+87840 LET t = t + v43 / 7
+87850 IF t < 0 THEN 87860
+87860 LET v44 = 46
+87870 LET v44 = v44 * 3 + 2
+87880 LET t = t + v44 / 7
+87890 IF t < 0 THEN 87900
+87900 LET v45 = 50
+87910 LET v45 = v45 * 3 + 6
+87920 LET t = t + v45 / 7
+87930 IF t < 0 THEN 87940
+87940 LET v46 = 54
+87950 LET v46 = v46 * 3 + 10
+87960 LET t = t + v46 / 7
+87970 IF t < 0 THEN 87980
+87980 LET v47 = 58
+87990 LET v47 = v47 * 3 + 1
+88000 LET t = t + v47 / 7
+88010 IF t < 0 THEN 88020
+88020 LET v48 = 62
+88030 LET v48 = v48 * 3 + 5
+88040 LET t = t + v48 / 7
+88050 IF t < 0 THEN 88060
+88060 LET v49 = 66
+88070 LET v49 = v49 * 3 + 9
+88080 LET t = t + v49 / 7
+88090 IF t < 0 THEN 88100
+88100 LET v0 = 70
+88110 LET v0 = v0 * 3 + 0
+88120 LET t = t + v0 / 7
+88130 IF t < 0 THEN 88140
+88140 LET v1 = 74
+88150 LET v1 = v1 * 3 + 4
+88160 LET t = t + v1 / 7
+88170 IF t < 0 THEN 88180
+88180 LET v2 = 78
+88190 LET v2 = v2 * 3 + 8
+88200 LET t = t + v2 / 7
+88210 IF t < 0 THEN 88220
+88220 LET v3 = 82
+88230 LET v3 = v3 * 3 + 12
+88240 LET t = t + v3 / 7
+88250 IF t < 0 THEN 88260
+88260 LET v4 = 86
+88270 LET v4 = v4 * 3 + 3
+88280 LET t = t + v4 / 7
+88290 IF t < 0 THEN 88300
+88300 LET v5 = 90
+88310 LET v5 = v5 * 3 + 7
+88320 LET t = t + v5 / 7
+88330 IF t < 0 THEN 88340
+88340 LET v6 = 94
+88350 LET v6 = v6 * 3 + 11
+88360 LET t = t + v6 / 7
+88370 IF t < 0 THEN 88380
+88380 LET v7 = 1
+88390 LET v7 = v7 * 3 + 2
+88400 LET t = t + v7 / 7
+88410 IF t < 0 THEN 88420
+88420 LET v8 = 5
+88430 LET v8 = v8 * 3 + 6
+88440 LET t = t + v8 / 7
+88450 IF t < 0 THEN 88460
+88460 LET v9 = 9
+88470 LET v9 = v9 * 3 + 10
+88480 LET t = t + v9 / 7
+88490 IF t < 0 THEN 88500
+88500 LET v10 = 13
+88510 LET v10 = v10 * 3 + 1
+88520 LET t = t + v10 / 7
+88530 IF t < 0 THEN 88540
+88540 LET v11 = 17
+88550 LET v11 = v11 * 3 + 5
+88560 LET t = t + v11 / 7
+88570 IF t < 0 THEN 88580
+88580 LET v12 = 21
+88590 LET v12 = v12 * 3 + 9
+88600 LET t = t + v12 / 7
+88610 IF t < 0 THEN 88620
+88620 LET v13 = 25
+88630 LET v13 = v13 * 3 + 0
+88640 LET t = t + v13 / 7
+88650 IF t < 0 THEN 88660
+88660 LET v14 = 29
+88670 LET v14 = v14 * 3 + 4
+88680 LET t = t + v14 / 7
+88690 IF t < 0 THEN 88700
+88700 LET v15 = 33
+88710 LET v15 = v15 * 3 + 8
+88720 LET t = t + v15 / 7
+88730 IF t < 0 THEN 88740
+88740 LET v16 = 37
+88750 LET v16 = v16 * 3 + 12
+88760 LET t = t + v16 / 7
+88770 IF t < 0 THEN 88780
+88780 LET v17 = 41
+88790 LET v17 = v17 * 3 + 3
+88800 LET t = t + v17 / 7
+88810 IF t < 0 THEN 88820
+88820 LET v18 = 45
+88830 LET v18 = v18 * 3 + 7
+88840 LET t = t + v18 / 7
+88850 IF t < 0 THEN 88860
+88860 LET v19 = 49
+88870 LET v19 = v19 * 3 + 11
+88880 LET t = t + v19 / 7
+88890 IF t < 0 THEN 88900
+88900 LET v20 = 53
+88910 LET v20 = v20 * 3 + 2
+88920 LET t = t + v20 / 7
+88930 IF t < 0 THEN 88940
+88940 LET v21 = 57
+88950 LET v21 = v21 * 3 + 6
+88960 LET t = t + v21 / 7
+88970 IF t < 0 THEN 88980
+88980 LET v22 = 61
+88990 LET v22 = v22 * 3 + 10
+89000 LET t = t + v22 / 7
+89010 IF t < 0 THEN 89020
+89020 LET v23 = 65
+89030 LET v23 = v23 * 3 + 1
+89040 LET t = t + v23 / 7
+89050 IF t < 0 THEN 89060
+89060 LET v24 = 69
+89070 LET v24 = v24 * 3 + 5
+89080 LET t = t + v24 / 7
+89090 IF t < 0 THEN 89100
+89100 LET v25 = 73
+89110 LET v25 = v25 * 3 + 9
+89120 LET t = t + v25 / 7
+89130 IF t < 0 THEN 89140
+89140 LET v26 = 77
+89150 LET v26 = v26 * 3 + 0
+89160 LET t = t + v26 / 7
+89170 IF t < 0 THEN 89180
+89180 LET v27 = 81
+89190 LET v27 = v27 * 3 + 4
+89200 LET t = t + v27 / 7
+89210 IF t < 0 THEN 89220
+89220 LET v28 = 85
+89230 LET v28 = v28 * 3 + 8
+89240 LET t = t + v28 / 7
+89250 IF t < 0 THEN 89260
+89260 LET v29 = 89
+89270 LET v29 = v29 * 3 + 12
+89280 LET t = t + v29 / 7
+89290 IF t < 0 THEN 89300
+89300 LET v30 = 93
+89310 LET v30 = v30 * 3 + 3
+89320 LET t = t + v30 / 7
+89330 IF t < 0 THEN 89340
+89340 LET v31 = 0
+89350 LET v31 = v31 * 3 + 7
+89360 LET t = t + v31 / 7
+89370 IF t < 0 THEN 89380
+89380 LET v32 = 4
+89390 LET v32 = v32 * 3 + 11
+89400 LET t = t + v32 / 7
+89410 IF t < 0 THEN 89420
+89420 LET v33 = 8
+89430 LET v33 = v33 * 3 + 2
+89440 LET t = t + v33 / 7
+89450 IF t < 0 THEN 89460
+89460 LET v34 = 12
+89470 LET v34 = v34 * 3 + 6
+89480 LET t = t + v34 / 7
+89490 IF t < 0 THEN 89500
+89500 LET v35 = 16
+89510 LET v35 = v35 * 3 + 10
+89520 LET t = t + v35 / 7
+89530 IF t < 0 THEN 89540
+89540 LET v36 = 20
+89550 LET v36 = v36 * 3 + 1
+89560 LET t = t + v36 / 7
+89570 IF t < 0 THEN 89580
+89580 LET v37 = 24
+89590 LET v37 = v37 * 3 + 5
+89600 LET t = t + v37 / 7
+89610 IF t < 0 THEN 89620
+89620 LET v38 = 28
+89630 LET v38 = v38 * 3 + 9
+89640 LET t = t + v38 / 7
+89650 IF t < 0 THEN 89660
+89660 LET v39 = 32
+89670 LET v39 = v39 * 3 + 0
+89680 LET t = t + v39 / 7
+89690 IF t < 0 THEN 89700
+89700 LET v40 = 36
+89710 LET v40 = v40 * 3 + 4
+89720 LET t = t + v40 / 7
+89730 IF t < 0 THEN 89740
+89740 LET v41 = 40
+89750 LET v41 = v41 * 3 + 8
+89760 LET t = t + v41 / 7
+89770 IF t < 0 THEN 89780
+89780 LET v42 = 44
+89790 LET v42 = v42 * 3 + 12
+89800 LET t = t + v42 / 7
+89810 IF t < 0 THEN 89820
+89820 LET v43 = 48
+89830 LET v43 = v43 * 3 + 3
+89840 LET t = t + v43 / 7
+89850 IF t < 0 THEN 89860
+89860 LET v44 = 52
+89870 LET v44 = v44 * 3 + 7
+89880 LET t = t + v44 / 7
+89890 IF t < 0 THEN 89900
+89900 LET v45 = 56
+89910 LET v45 = v45 * 3 + 11
+89920 LET t = t + v45 / 7
+89930 IF t < 0 THEN 89940
+89940 LET v46 = 60
+89950 LET v46 = v46 * 3 + 2
+89960 LET t = t + v46 / 7
+89970 IF t < 0 THEN 89980
+89980 LET v47 = 64
+89990 LET v47 = v47 * 3 + 6
+90000 LET t = t + v47 / 7
+90010 IF t < 0 THEN 90020
+90020 LET v48 = 68
+90030 LET v48 = v48 * 3 + 10
+90040 LET t = t + v48 / 7
+90050 IF t < 0 THEN 90060
+90060 LET v49 = 72
+90070 LET v49 = v49 * 3 + 1
+90080 LET t = t + v49 / 7
+90090 IF t < 0 THEN 90100
+90100 LET v0 = 76
+90110 LET v0 = v0 * 3 + 5
+90120 LET t = t + v0 / 7
+90130 IF t < 0 THEN 90140
+90140 LET v1 = 80
+90150 LET v1 = v1 * 3 + 9
+90160 LET t = t + v1 / 7
+90170 IF t < 0 THEN 90180
+90180 LET v2 = 84
+90190 LET v2 = v2 * 3 + 0
+90200 LET t = t + v2 / 7
+90210 IF t < 0 THEN 90220
+90220 LET v3 = 88
+90230 LET v3 = v3 * 3 + 4
+90240 LET t = t + v3 / 7
+90250 IF t < 0 THEN 90260
+90260 LET v4 = 92
+90270 LET v4 = v4 * 3 + 8
+90280 LET t = t + v4 / 7
+90290 IF t < 0 THEN 90300
+90300 LET v5 = 96
+90310 LET v5 = v5 * 3 + 12
+90320 LET t = t + v5 / 7
+90330 IF t < 0 THEN 90340
+90340 LET v6 = 3
+90350 LET v6 = v6 * 3 + 3
+90360 LET t = t + v6 / 7
+90370 IF t < 0 THEN 90380
+90380 LET v7 = 7
+90390 LET v7 = v7 * 3 + 7
+90400 LET t = t + v7 / 7
+90410 IF t < 0 THEN 90420
+90420 LET v8 = 11
+90430 LET v8 = v8 * 3 + 11
+90440 LET t = t + v8 / 7
+90450 IF t < 0 THEN 90460
+90460 LET v9 = 15
+90470 LET v9 = v9 * 3 + 2
+90480 LET t = t + v9 / 7
+90490 IF t < 0 THEN 90500
+90500 LET v10 = 19
+90510 LET v10 = v10 * 3 + 6
+90520 LET t = t + v10 / 7
+90530 IF t < 0 THEN 90540
+90540 LET v11 = 23
+90550 LET v11 = v11 * 3 + 10
+90560 LET t = t + v11 / 7
+90570 IF t < 0 THEN 90580
+90580 LET v12 = 27
+90590 LET v12 = v12 * 3 + 1
+90600 LET t = t + v12 / 7
+90610 IF t < 0 THEN 90620
+90620 LET v13 = 31
+90630 LET v13 = v13 * 3 + 5
+90640 LET t = t + v13 / 7
+90650 IF t < 0 THEN 90660
+90660 LET v14 = 35
+90670 LET v14 = v14 * 3 + 9
+90680 LET t = t + v14 / 7
+90690 IF t < 0 THEN 90700
+90700 LET v15 = 39
+90710 LET v15 = v15 * 3 + 0
+90720 LET t = t + v15 / 7
+90730 IF t < 0 THEN 90740
+90740 LET v16 = 43
+90750 LET v16 = v16 * 3 + 4
+90760 LET t = t + v16 / 7
+90770 IF t < 0 THEN 90780
+90780 LET v17 = 47
+90790 LET v17 = v17 * 3 + 8
+90800 LET t = t + v17 / 7
+90810 IF t < 0 THEN 90820
+90820 LET v18 = 51
+90830 LET v18 = v18 * 3 + 12
+90840 LET t = t + v18 / 7
+90850 IF t < 0 THEN 90860
+90860 LET v19 = 55
+90870 LET v19 = v19 * 3 + 3
+90880 LET t = t + v19 / 7
+90890 IF t < 0 THEN 90900
+90900 LET v20 = 59
+90910 LET v20 = v20 * 3 + 7
+90920 LET t = t + v20 / 7
+90930 IF t < 0 THEN 90940
+90940 LET v21 = 63
+90950 LET v21 = v21 * 3 + 11
+90960 LET t = t + v21 / 7
+90970 IF t < 0 THEN 90980
+90980 LET v22 = 67
+90990 LET v22 = v22 * 3 + 2
+91000 LET t = t + v22 / 7
+91010 IF t < 0 THEN 91020
+91020 LET v23 = 71
+91030 LET v23 = v23 * 3 + 6
+91040 LET t = t + v23 / 7
+91050 IF t < 0 THEN 91060
+91060 LET v24 = 75
+91070 LET v24 = v24 * 3 + 10
+91080 LET t = t + v24 / 7
+91090 IF t < 0 THEN 91100
+91100 LET v25 = 79
+91110 LET v25 = v25 * 3 + 1
+91120 LET t = t + v25 / 7
+91130 IF t < 0 THEN 91140
+91140 LET v26 = 83
+91150 LET v26 = v26 * 3 + 5
+91160 LET t = t + v26 / 7
+91170 IF t < 0 THEN 91180
+91180 LET v27 = 87
+91190 LET v27 = v27 * 3 + 9
+91200 LET t = t + v27 / 7
+91210 IF t < 0 THEN 91220
+91220 LET v28 = 91
+91230 LET v28 = v28 * 3 + 0
+91240 LET t = t + v28 / 7
+91250 IF t < 0 THEN 91260
+91260 LET v29 = 95
+91270 LET v29 = v29 * 3 + 4
+91280 LET t = t + v29 / 7
+91290 IF t < 0 THEN 91300
+91300 LET v30 = 2
+91310 LET v30 = v30 * 3 + 8
+91320 LET t = t + v30 / 7
+91330 IF t < 0 THEN 91340
+91340 LET v31 = 6
+91350 LET v31 = v31 * 3 + 12
+91360 LET t = t + v31 / 7
+91370 IF t < 0 THEN 91380
+91380 LET v32 = 10
+91390 LET v32 = v32 * 3 + 3
+91400 LET t = t + v32 / 7
+91410 IF t < 0 THEN 91420
+91420 LET v33 = 14
+91430 LET v33 = v33 * 3 + 7
+91440 LET t = t + v33 / 7
+91450 IF t < 0 THEN 91460
+91460 LET v34 = 18
+91470 LET v34 = v34 * 3 + 11
+91480 LET t = t + v34 / 7
+91490 IF t < 0 THEN 91500
+91500 LET v35 = 22
+91510 LET v35 = v35 * 3 + 2
+91520 LET t = t + v35 / 7
+91530 IF t < 0 THEN 91540
+91540 LET v36 = 26
+91550 LET v36 = v36 * 3 + 6
+91560 LET t = t + v36 / 7
+91570 IF t < 0 THEN 91580
+91580 LET v37 = 30
+91590 LET v37 = v37 * 3 + 10
+91600 LET t = t + v37 / 7
+91610 IF t < 0 THEN 91620
+91620 LET v38 = 34
+91630 LET v38 = v38 * 3 + 1
+91640 LET t = t + v38 / 7
+91650 IF t < 0 THEN 91660
+91660 LET v39 = 38
+91670 LET v39 = v39 * 3 + 5
+91680 LET t = t + v39 / 7
+91690 IF t < 0 THEN 91700
+91700 LET v40 = 42
+91710 LET v40 = v40 * 3 + 9
+91720 LET t = t + v40 / 7
+91730 IF t < 0 THEN 91740
+91740 LET v41 = 46
+91750 LET v41 = v41 * 3 + 0
+91760 LET t = t + v41 / 7
+91770 IF t < 0 THEN 91780
+91780 LET v42 = 50
+91790 LET v42 = v42 * 3 + 4
+91800 LET t = t + v42 / 7
+91810 IF t < 0 THEN 91820
+91820 LET v43 = 54
+91830 LET v43 = v43 * 3 + 8
+91840 LET t = t + v43 / 7
+91850 IF t < 0 THEN 91860
+91860 LET v44 = 58
+91870 LET v44 = v44 * 3 + 12
+91880 LET t = t + v44 / 7
+91890 IF t < 0 THEN 91900
+91900 LET v45 = 62
+91910 LET v45 = v45 * 3 + 3
+91920 LET t = t + v45 / 7
+91930 IF t < 0 THEN 91940
+91940 LET v46 = 66
+91950 LET v46 = v46 * 3 + 7
+91960 LET t = t + v46 / 7
+91970 IF t < 0 THEN 91980
+91980 LET v47 = 70
+91990 LET v47 = v47 * 3 + 11
+92000 LET t = t + v47 / 7
+92010 IF t < 0 THEN 92020
+92020 LET v48 = 74
+92030 LET v48 = v48 * 3 + 2
+92040 LET t = t + v48 / 7
+92050 IF t < 0 THEN 92060
+92060 LET v49 = 78
+92070 LET v49 = v49 * 3 + 6
+92080 LET t = t + v49 / 7
+92090 IF t < 0 THEN 92100
+92100 LET v0 = 82
+92110 LET v0 = v0 * 3 + 10
+92120 LET t = t + v0 / 7
+92130 IF t < 0 THEN 92140
+92140 LET v1 = 86
+92150 LET v1 = v1 * 3 + 1
+92160 LET t = t + v1 / 7
+92170 IF t < 0 THEN 92180
+92180 LET v2 = 90
+92190 LET v2 = v2 * 3 + 5
+92200 LET t = t + v2 / 7
+92210 IF t < 0 THEN 92220
+92220 LET v3 = 94
+92230 LET v3 = v3 * 3 + 9
+92240 LET t = t + v3 / 7
+92250 IF t < 0 THEN 92260
+92260 LET v4 = 1
+92270 LET v4 = v4 * 3 + 0
+92280 LET t = t + v4 / 7
+92290 IF t < 0 THEN 92300
+92300 LET v5 = 5
+92310 LET v5 = v5 * 3 + 4
+92320 LET t = t + v5 / 7
+92330 IF t < 0 THEN 92340
+92340 LET v6 = 9
+92350 LET v6 = v6 * 3 + 8
+92360 LET t = t + v6 / 7
+92370 IF t < 0 THEN 92380
+92380 LET v7 = 13
+92390 LET v7 = v7 * 3 + 12
+92400 LET t = t + v7 / 7
+92410 IF t < 0 THEN 92420
+92420 LET v8 = 17
+92430 LET v8 = v8 * 3 + 3
+92440 LET t = t + v8 / 7
+92450 IF t < 0 THEN 92460
+92460 LET v9 = 21
+92470 LET v9 = v9 * 3 + 7
+92480 LET t = t + v9 / 7
+92490 IF t < 0 THEN 92500
+92500 LET v10 = 25
+92510 LET v10 = v10 * 3 + 11
+92520 LET t = t + v10 / 7
+92530 IF t < 0 THEN 92540
+92540 LET v11 = 29
+92550 LET v11 = v11 * 3 + 2
+92560 LET t = t + v11 / 7
+92570 IF t < 0 THEN 92580
+92580 LET v12 = 33
+92590 LET v12 = v12 * 3 + 6
+92600 LET t = t + v12 / 7
+92610 IF t < 0 THEN 92620
+92620 LET v13 = 37
+92630 LET v13 = v13 * 3 + 10
+92640 LET t = t + v13 / 7
+92650 IF t < 0 THEN 92660
+92660 LET v14 = 41
+92670 LET v14 = v14 * 3 + 1
+92680 LET t = t + v14 / 7
+92690 IF t < 0 THEN 92700
+92700 LET v15 = 45
+92710 LET v15 = v15 * 3 + 5
+92720 LET t = t + v15 / 7
+92730 IF t < 0 THEN 92740
+92740 LET v16 = 49
+92750 LET v16 = v16 * 3 + 9
+92760 LET t = t + v16 / 7
+92770 IF t < 0 THEN 92780
+92780 LET v17 = 53
+92790 LET v17 = v17 * 3 + 0
+92800 LET t = t + v17 / 7
+92810 IF t < 0 THEN 92820
+92820 LET v18 = 57
+92830 LET v18 = v18 * 3 + 4
+92840 LET t = t + v18 / 7
+92850 IF t < 0 THEN 92860
+92860 LET v19 = 61
+92870 LET v19 = v19 * 3 + 8
+92880 LET t = t + v19 / 7
+92890 IF t < 0 THEN 92900
+92900 LET v20 = 65
+92910 LET v20 = v20 * 3 + 12
+92920 LET t = t + v20 / 7
+92930 IF t < 0 THEN 92940
+92940 LET v21 = 69
+92950 LET v21 = v21 * 3 + 3
+92960 LET t = t + v21 / 7
+92970 IF t < 0 THEN 92980
+92980 LET v22 = 73
+92990 LET v22 = v22 * 3 + 7
+93000 LET t = t + v22 / 7
+93010 IF t < 0 THEN 93020
+93020 LET v23 = 77
+93030 LET v23 = v23 * 3 + 11
+93040 LET t = t + v23 / 7
+93050 IF t < 0 THEN 93060
+93060 LET v24 = 81
+93070 LET v24 = v24 * 3 + 2
+93080 LET t = t + v24 / 7
+93090 IF t < 0 THEN 93100
+93100 LET v25 = 85
+93110 LET v25 = v25 * 3 + 6
+93120 LET t = t + v25 / 7
+93130 IF t < 0 THEN 93140
+93140 LET v26 = 89
+93150 LET v26 = v26 * 3 + 10
+93160 LET t = t + v26 / 7
+93170 IF t < 0 THEN 93180
+93180 LET v27 = 93
+93190 LET v27 = v27 * 3 + 1
+93200 LET t = t + v27 / 7
+93210 IF t < 0 THEN 93220
+93220 LET v28 = 0
+93230 LET v28 = v28 * 3 + 5
+93240 LET t = t + v28 / 7
+93250 IF t < 0 THEN 93260
+93260 LET v29 = 4
+93270 LET v29 = v29 * 3 + 9
+93280 LET t = t + v29 / 7
+93290 IF t < 0 THEN 93300
+93300 LET v30 = 8
+93310 LET v30 = v30 * 3 + 0
+93320 LET t = t + v30 / 7
+93330 IF t < 0 THEN 93340
+93340 LET v31 = 12
+93350 LET v31 = v31 * 3 + 4
+93360 LET t = t + v31 / 7
+93370 IF t < 0 THEN 93380
+93380 LET v32 = 16
+93390 LET v32 = v32 * 3 + 8
+93400 LET t = t + v32 / 7
+93410 IF t < 0 THEN 93420
+93420 LET v33 = 20
+93430 LET v33 = v33 * 3 + 12
+93440 LET t = t + v33 / 7
+93450 IF t < 0 THEN 93460
+93460 LET v34 = 24
+93470 LET v34 = v34 * 3 + 3
+93480 LET t = t + v34 / 7
+93490 IF t < 0 THEN 93500
+93500 LET v35 = 28
+93510 LET v35 = v35 * 3 + 7
+93520 LET t = t + v35 / 7
+93530 IF t < 0 THEN 93540
+93540 LET v36 = 32
+93550 LET v36 = v36 * 3 + 11
+93560 LET t = t + v36 / 7
+93570 IF t < 0 THEN 93580
+93580 LET v37 = 36
+93590 LET v37 = v37 * 3 + 2
+93600 LET t = t + v37 / 7
+93610 IF t < 0 THEN 93620
+93620 LET v38 = 40
+93630 LET v38 = v38 * 3 + 6
+93640 LET t = t + v38 / 7
+93650 IF t < 0 THEN 93660
+93660 LET v39 = 44
+93670 LET v39 = v39 * 3 + 10
+93680 LET t = t + v39 / 7
+93690 IF t < 0 THEN 93700
+93700 LET v40 = 48
+93710 LET v40 = v40 * 3 + 1
+93720 LET t = t + v40 / 7
+93730 IF t < 0 THEN 93740
+93740 LET v41 = 52
+93750 LET v41 = v41 * 3 + 5
+93760 LET t = t + v41 / 7
+93770 IF t < 0 THEN 93780
+93780 LET v42 = 56
+93790 LET v42 = v42 * 3 + 9
+93800 LET t = t + v42 / 7
+93810 IF t < 0 THEN 93820
+93820 LET v43 = 60
+93830 LET v43 = v43 * 3 + 0
+93840 LET t = t + v43 / 7
+93850 IF t < 0 THEN 93860
+93860 LET v44 = 64
+93870 LET v44 = v44 * 3 + 4
+93880 LET t = t + v44 / 7
+93890 IF t < 0 THEN 93900
+93900 LET v45 = 68
+93910 LET v45 = v45 * 3 + 8
+93920 LET t = t + v45 / 7
+93930 IF t < 0 THEN 93940
+93940 LET v46 = 72
+93950 LET v46 = v46 * 3 + 12
+93960 LET t = t + v46 / 7
+93970 IF t < 0 THEN 93980
+93980 LET v47 = 76
+93990 LET v47 = v47 * 3 + 3
+94000 LET t = t + v47 / 7
+94010 IF t < 0 THEN 94020
+94020 LET v48 = 80
+94030 LET v48 = v48 * 3 + 7
+94040 LET t = t + v48 / 7
+94050 IF t < 0 THEN 94060
+94060 LET v49 = 84
+94070 LET v49 = v49 * 3 + 11
+94080 LET t = t + v49 / 7
+94090 IF t < 0 THEN 94100
+94100 LET v0 = 88
+94110 LET v0 = v0 * 3 + 2
+94120 LET t = t + v0 / 7
+94130 IF t < 0 THEN 94140
+94140 LET v1 = 92
+94150 LET v1 = v1 * 3 + 6
+94160 LET t = t + v1 / 7
+94170 IF t < 0 THEN 94180
+94180 LET v2 = 96
+94190 LET v2 = v2 * 3 + 10
+94200 LET t = t + v2 / 7
+94210 IF t < 0 THEN 94220
+94220 LET v3 = 3
+94230 LET v3 = v3 * 3 + 1
+94240 LET t = t + v3 / 7
+94250 IF t < 0 THEN 94260
+94260 LET v4 = 7
+94270 LET v4 = v4 * 3 + 5
+94280 LET t = t + v4 / 7
+94290 IF t < 0 THEN 94300
+94300 LET v5 = 11
+94310 LET v5 = v5 * 3 + 9
+94320 LET t = t + v5 / 7
+94330 IF t < 0 THEN 94340
+94340 LET v6 = 15
+94350 LET v6 = v6 * 3 + 0
+94360 LET t = t + v6 / 7
+94370 IF t < 0 THEN 94380
+94380 LET v7 = 19
+94390 LET v7 = v7 * 3 + 4
+94400 LET t = t + v7 / 7
+94410 IF t < 0 THEN 94420
+94420 LET v8 = 23
+94430 LET v8 = v8 * 3 + 8
+94440 LET t = t + v8 / 7
+94450 IF t < 0 THEN 94460
+94460 LET v9 = 27
+94470 LET v9 = v9 * 3 + 12
+94480 LET t = t + v9 / 7
+94490 IF t < 0 THEN 94500
+94500 LET v10 = 31
+94510 LET v10 = v10 * 3 + 3
+94520 LET t = t + v10 / 7
+94530 IF t < 0 THEN 94540
+94540 LET v11 = 35
+94550 LET v11 = v11 * 3 + 7
+94560 LET t = t + v11 / 7
+94570 IF t < 0 THEN 94580
+94580 LET v12 = 39
+94590 LET v12 = v12 * 3 + 11
+94600 LET t = t + v12 / 7
+94610 IF t < 0 THEN 94620
+94620 LET v13 = 43
+94630 LET v13 = v13 * 3 + 2
+94640 LET t = t + v13 / 7
+94650 IF t < 0 THEN 94660
+94660 LET v14 = 47
+94670 LET v14 = v14 * 3 + 6
+94680 LET t = t + v14 / 7
+94690 IF t < 0 THEN 94700
+94700 LET v15 = 51
+94710 LET v15 = v15 * 3 + 10
+94720 LET t = t + v15 / 7
+94730 IF t < 0 THEN 94740
+94740 LET v16 = 55
+94750 LET v16 = v16 * 3 + 1
+94760 LET t = t + v16 / 7
+94770 IF t < 0 THEN 94780
+94780 LET v17 = 59
+94790 LET v17 = v17 * 3 + 5
+94800 LET t = t + v17 / 7
+94810 IF t < 0 THEN 94820
+94820 LET v18 = 63
+94830 LET v18 = v18 * 3 + 9
+94840 LET t = t + v18 / 7
+94850 IF t < 0 THEN 94860
+94860 LET v19 = 67
+94870 LET v19 = v19 * 3 + 0
+94880 LET t = t + v19 / 7
+94890 IF t < 0 THEN 94900
+94900 LET v20 = 71
+94910 LET v20 = v20 * 3 + 4
+94920 LET t = t + v20 / 7
+94930 IF t < 0 THEN 94940
+94940 LET v21 = 75
+94950 LET v21 = v21 * 3 + 8
+94960 LET t = t + v21 / 7
+94970 IF t < 0 THEN 94980
+94980 LET v22 = 79
+94990 LET v22 = v22 * 3 + 12
+95000 LET t = t + v22 / 7
+95010 IF t < 0 THEN 95020
+95020 LET v23 = 83
+95030 LET v23 = v23 * 3 + 3
+95040 LET t = t + v23 / 7
+95050 IF t < 0 THEN 95060
+95060 LET v24 = 87
+95070 LET v24 = v24 * 3 + 7
+95080 LET t = t + v24 / 7
+95090 IF t < 0 THEN 95100
+95100 LET v25 = 91
+95110 LET v25 = v25 * 3 + 11
+95120 LET t = t + v25 / 7
+95130 IF t < 0 THEN 95140
+95140 LET v26 = 95
+95150 LET v26 = v26 * 3 + 2
+95160 LET t = t + v26 / 7
+95170 IF t < 0 THEN 95180
+95180 LET v27 = 2
+95190 LET v27 = v27 * 3 + 6
+95200 LET t = t + v27 / 7
+95210 IF t < 0 THEN 95220
+95220 LET v28 = 6
+95230 LET v28 = v28 * 3 + 10
+95240 LET t = t + v28 / 7
+95250 IF t < 0 THEN 95260
+95260 LET v29 = 10
+95270 LET v29 = v29 * 3 + 1
+95280 LET t = t + v29 / 7
+95290 IF t < 0 THEN 95300
+95300 LET v30 = 14
+95310 LET v30 = v30 * 3 + 5
+95320 LET t = t + v30 / 7
+95330 IF t < 0 THEN 95340
+95340 LET v31 = 18
+95350 LET v31 = v31 * 3 + 9
+95360 LET t = t + v31 / 7
+95370 IF t < 0 THEN 95380
+95380 LET v32 = 22
+95390 LET v32 = v32 * 3 + 0
+95400 LET t = t + v32 / 7
+95410 IF t < 0 THEN 95420
+95420 LET v33 = 26
+95430 LET v33 = v33 * 3 + 4
+95440 LET t = t + v33 / 7
+95450 IF t < 0 THEN 95460
+95460 LET v34 = 30
+95470 LET v34 = v34 * 3 + 8
+95480 LET t = t + v34 / 7
+95490 IF t < 0 THEN 95500
+95500 LET v35 = 34
+95510 LET v35 = v35 * 3 + 12
+95520 LET t = t + v35 / 7
+95530 IF t < 0 THEN 95540
+95540 LET v36 = 38
+95550 LET v36 = v36 * 3 + 3
+95560 LET t = t + v36 / 7
+95570 IF t < 0 THEN 95580
+95580 LET v37 = 42
+95590 LET v37 = v37 * 3 + 7
+95600 LET t = t + v37 / 7
+95610 IF t < 0 THEN 95620
+95620 LET v38 = 46
+95630 LET v38 = v38 * 3 + 11
+95640 LET t = t + v38 / 7
+95650 IF t < 0 THEN 95660
+95660 LET v39 = 50
+95670 LET v39 = v39 * 3 + 2
+95680 LET t = t + v39 / 7
+95690 IF t < 0 THEN 95700
+95700 LET v40 = 54
+95710 LET v40 = v40 * 3 + 6
+95720 LET t = t + v40 / 7
+95730 IF t < 0 THEN 95740
+95740 LET v41 = 58
+95750 LET v41 = v41 * 3 + 10
+95760 LET t = t + v41 / 7
+95770 IF t < 0 THEN 95780
+95780 LET v42 = 62
+95790 LET v42 = v42 * 3 + 1
+95800 LET t = t + v42 / 7
+95810 IF t < 0 THEN 95820
+95820 LET v43 = 66
+95830 LET v43 = v43 * 3 + 5
+95840 LET t = t + v43 / 7
+95850 IF t < 0 THEN 95860
+95860 LET v44 = 70
+95870 LET v44 = v44 * 3 + 9
+95880 LET t = t + v44 / 7
+95890 IF t < 0 THEN 95900
+95900 LET v45 = 74
+95910 LET v45 = v45 * 3 + 0
+95920 LET t = t + v45 / 7
+95930 IF t < 0 THEN 95940
+95940 LET v46 = 78
+95950 LET v46 = v46 * 3 + 4
+95960 LET t = t + v46 / 7
+95970 IF t < 0 THEN 95980
+95980 LET v47 = 82
+95990 LET v47 = v47 * 3 + 8
+96000 LET t = t + v47 / 7
+96010 IF t < 0 THEN 96020
+96020 LET v48 = 86
+96030 LET v48 = v48 * 3 + 12
+96040 LET t = t + v48 / 7
+96050 IF t < 0 THEN 96060
+96060 LET v49 = 90
+96070 LET v49 = v49 * 3 + 3
+96080 LET t = t + v49 / 7
+96090 IF t < 0 THEN 96100
+96100 LET v0 = 94
+96110 LET v0 = v0 * 3 + 7
+96120 LET t = t + v0 / 7
+96130 IF t < 0 THEN 96140
+96140 LET v1 = 1
+96150 LET v1 = v1 * 3 + 11
+96160 LET t = t + v1 / 7
+96170 IF t < 0 THEN 96180
+96180 LET v2 = 5
+96190 LET v2 = v2 * 3 + 2
+96200 LET t = t + v2 / 7
+96210 IF t < 0 THEN 96220
+96220 LET v3 = 9
+96230 LET v3 = v3 * 3 + 6
+96240 LET t = t + v3 / 7
+96250 IF t < 0 THEN 96260
+96260 LET v4 = 13
+96270 LET v4 = v4 * 3 + 10
+96280 LET t = t + v4 / 7
+96290 IF t < 0 THEN 96300
+96300 LET v5 = 17
+96310 LET v5 = v5 * 3 + 1
+96320 LET t = t + v5 / 7
+96330 IF t < 0 THEN 96340
+96340 LET v6 = 21
+96350 LET v6 = v6 * 3 + 5
+96360 LET t = t + v6 / 7
+96370 IF t < 0 THEN 96380
+96380 LET v7 = 25
+96390 LET v7 = v7 * 3 + 9
+96400 LET t = t + v7 / 7
+96410 IF t < 0 THEN 96420
+96420 LET v8 = 29
+96430 LET v8 = v8 * 3 + 0
+96440 LET t = t + v8 / 7
+96450 IF t < 0 THEN 96460
+96460 LET v9 = 33
+96470 LET v9 = v9 * 3 + 4
+96480 LET t = t + v9 / 7
+96490 IF t < 0 THEN 96500
+96500 LET v10 = 37
+96510 LET v10 = v10 * 3 + 8
+96520 LET t = t + v10 / 7
+96530 IF t < 0 THEN 96540
+96540 LET v11 = 41
+96550 LET v11 = v11 * 3 + 12
+96560 LET t = t + v11 / 7
+96570 IF t < 0 THEN 96580
+96580 LET v12 = 45
+96590 LET v12 = v12 * 3 + 3
+96600 LET t = t + v12 / 7
+96610 IF t < 0 THEN 96620
+96620 LET v13 = 49
+96630 LET v13 = v13 * 3 + 7
+96640 LET t = t + v13 / 7
+96650 IF t < 0 THEN 96660
+96660 LET v14 = 53
+96670 LET v14 = v14 * 3 + 11
+96680 LET t = t + v14 / 7
+96690 IF t < 0 THEN 96700
+96700 LET v15 = 57
+96710 LET v15 = v15 * 3 + 2
+96720 LET t = t + v15 / 7
+96730 IF t < 0 THEN 96740
+96740 LET v16 = 61
+96750 LET v16 = v16 * 3 + 6
+96760 LET t = t + v16 / 7
+96770 IF t < 0 THEN 96780
+96780 LET v17 = 65
+96790 LET v17 = v17 * 3 + 10
+96800 LET t = t + v17 / 7
+96810 IF t < 0 THEN 96820
+96820 LET v18 = 69
+96830 LET v18 = v18 * 3 + 1
+96840 LET t = t + v18 / 7
+96850 IF t < 0 THEN 96860
+96860 LET v19 = 73
+96870 LET v19 = v19 * 3 + 5
+96880 LET t = t + v19 / 7
+96890 IF t < 0 THEN 96900
+96900 LET v20 = 77
+96910 LET v20 = v20 * 3 + 9
+96920 LET t = t + v20 / 7
+96930 IF t < 0 THEN 96940
+96940 LET v21 = 81
+96950 LET v21 = v21 * 3 + 0
+96960 LET t = t + v21 / 7
+96970 IF t < 0 THEN 96980
+96980 LET v22 = 85
+96990 LET v22 = v22 * 3 + 4
+97000 LET t = t + v22 / 7
+97010 IF t < 0 THEN 97020
+97020 LET v23 = 89
+97030 LET v23 = v23 * 3 + 8
+97040 LET t = t + v23 / 7
+97050 IF t < 0 THEN 97060
+97060 LET v24 = 93
+97070 LET v24 = v24 * 3 + 12
+97080 LET t = t + v24 / 7
+97090 IF t < 0 THEN 97100
+97100 LET v25 = 0
+97110 LET v25 = v25 * 3 + 3
+97120 LET t = t + v25 / 7
+97130 IF t < 0 THEN 97140
+97140 LET v26 = 4
+97150 LET v26 = v26 * 3 + 7
+97160 LET t = t + v26 / 7
+97170 IF t < 0 THEN 97180
+97180 LET v27 = 8
+97190 LET v27 = v27 * 3 + 11
+97200 LET t = t + v27 / 7
+97210 IF t < 0 THEN 97220
+97220 LET v28 = 12
+97230 LET v28 = v28 * 3 + 2
+97240 LET t = t + v28 / 7
+97250 IF t < 0 THEN 97260
+97260 LET v29 = 16
+97270 LET v29 = v29 * 3 + 6
+97280 LET t = t + v29 / 7
+97290 IF t < 0 THEN 97300
+97300 LET v30 = 20
+97310 LET v30 = v30 * 3 + 10
+97320 LET t = t + v30 / 7
+97330 IF t < 0 THEN 97340
+97340 LET v31 = 24
+97350 LET v31 = v31 * 3 + 1
+97360 LET t = t + v31 / 7
+97370 IF t < 0 THEN 97380
+97380 LET v32 = 28
+97390 LET v32 = v32 * 3 + 5
+97400 LET t = t + v32 / 7
+97410 IF t < 0 THEN 97420
+97420 LET v33 = 32
+97430 LET v33 = v33 * 3 + 9
+97440 LET t = t + v33 / 7
+97450 IF t < 0 THEN 97460
+97460 LET v34 = 36
+97470 LET v34 = v34 * 3 + 0
+97480 LET t = t + v34 / 7
+97490 IF t < 0 THEN 97500
+97500 LET v35 = 40
+97510 LET v35 = v35 * 3 + 4
+97520 LET t = t + v35 / 7
+97530 IF t < 0 THEN 97540
+97540 LET v36 = 44
+97550 LET v36 = v36 * 3 + 8
+97560 LET t = t + v36 / 7
+97570 IF t < 0 THEN 97580
+97580 LET v37 = 48
+97590 LET v37 = v37 * 3 + 12
+97600 LET t = t + v37 / 7
+97610 IF t < 0 THEN 97620
+97620 LET v38 = 52
+97630 LET v38 = v38 * 3 + 3
+97640 LET t = t + v38 / 7
+97650 IF t < 0 THEN 97660
+97660 LET v39 = 56
+97670 LET v39 = v39 * 3 + 7
+97680 LET t = t + v39 / 7
+97690 IF t < 0 THEN 97700
+97700 LET v40 = 60
+97710 LET v40 = v40 * 3 + 11
+97720 LET t = t + v40 / 7
+97730 IF t < 0 THEN 97740
+97740 LET v41 = 64
+97750 LET v41 = v41 * 3 + 2
+97760 LET t = t + v41 / 7
+97770 IF t < 0 THEN 97780
+97780 LET v42 = 68
+97790 LET v42 = v42 * 3 + 6
+97800 LET t = t + v42 / 7
+97810 IF t < 0 THEN 97820
+97820 LET v43 = 72
+97830 LET v43 = v43 * 3 + 10
+97840 LET t = t + v43 / 7
+97850 IF t < 0 THEN 97860
+97860 LET v44 = 76
+97870 LET v44 = v44 * 3 + 1
+97880 LET t = t + v44 / 7
+97890 IF t < 0 THEN 97900
+97900 LET v45 = 80
+97910 LET v45 = v45 * 3 + 5
+97920 LET t = t + v45 / 7
+97930 IF t < 0 THEN 97940
+97940 LET v46 = 84
+97950 LET v46 = v46 * 3 + 9
+97960 LET t = t + v46 / 7
+97970 IF t < 0 THEN 97980
+97980 LET v47 = 88
+97990 LET v47 = v47 * 3 + 0
+98000 LET t = t + v47 / 7
+98010 IF t < 0 THEN 98020
+98020 LET v48 = 92
+98030 LET v48 = v48 * 3 + 4
+98040 LET t = t + v48 / 7
+98050 IF t < 0 THEN 98060
+98060 LET v49 = 96
+98070 LET v49 = v49 * 3 + 8
+98080 LET t = t + v49 / 7
+98090 IF t < 0 THEN 98100
+98100 LET v0 = 3
+98110 LET v0 = v0 * 3 + 12
+98120 LET t = t + v0 / 7
+98130 IF t < 0 THEN 98140
+98140 LET v1 = 7
+98150 LET v1 = v1 * 3 + 3
+98160 LET t = t + v1 / 7
+98170 IF t < 0 THEN 98180
+98180 LET v2 = 11
+98190 LET v2 = v2 * 3 + 7
+98200 LET t = t + v2 / 7
+98210 IF t < 0 THEN 98220
+98220 LET v3 = 15
+98230 LET v3 = v3 * 3 + 11
+98240 LET t = t + v3 / 7
+98250 IF t < 0 THEN 98260
+98260 LET v4 = 19
+98270 LET v4 = v4 * 3 + 2
+98280 LET t = t + v4 / 7
+98290 IF t < 0 THEN 98300
+98300 LET v5 = 23
+98310 LET v5 = v5 * 3 + 6
+98320 LET t = t + v5 / 7
+98330 IF t < 0 THEN 98340
+98340 LET v6 = 27
+98350 LET v6 = v6 * 3 + 10
+98360 LET t = t + v6 / 7
+98370 IF t < 0 THEN 98380
+98380 LET v7 = 31
+98390 LET v7 = v7 * 3 + 1
+98400 LET t = t + v7 / 7
+98410 IF t < 0 THEN 98420
+98420 LET v8 = 35
+98430 LET v8 = v8 * 3 + 5
+98440 LET t = t + v8 / 7
+98450 IF t < 0 THEN 98460
+98460 LET v9 = 39
+98470 LET v9 = v9 * 3 + 9
+98480 LET t = t + v9 / 7
+98490 IF t < 0 THEN 98500
+98500 LET v10 = 43
+98510 LET v10 = v10 * 3 + 0
+98520 LET t = t + v10 / 7
+98530 IF t < 0 THEN 98540
+98540 LET v11 = 47
+98550 LET v11 = v11 * 3 + 4
+98560 LET t = t + v11 / 7
+98570 IF t < 0 THEN 98580
+98580 LET v12 = 51
+98590 LET v12 = v12 * 3 + 8
+98600 LET t = t + v12 / 7
+98610 IF t < 0 THEN 98620
+98620 LET v13 = 55
+98630 LET v13 = v13 * 3 + 12
+98640 LET t = t + v13 / 7
+98650 IF t < 0 THEN 98660
+98660 LET v14 = 59
+98670 LET v14 = v14 * 3 + 3
+98680 LET t = t + v14 / 7
+98690 IF t < 0 THEN 98700
+98700 LET v15 = 63
+98710 LET v15 = v15 * 3 + 7
+98720 LET t = t + v15 / 7
+98730 IF t < 0 THEN 98740
+98740 LET v16 = 67
+98750 LET v16 = v16 * 3 + 11
+98760 LET t = t + v16 / 7
+98770 IF t < 0 THEN 98780
+98780 LET v17 = 71
+98790 LET v17 = v17 * 3 + 2
+98800 LET t = t + v17 / 7
+98810 IF t < 0 THEN 98820
+98820 LET v18 = 75
+98830 LET v18 = v18 * 3 + 6
+98840 LET t = t + v18 / 7
+98850 IF t < 0 THEN 98860
+98860 LET v19 = 79
+98870 LET v19 = v19 * 3 + 10
+98880 LET t = t + v19 / 7
+98890 IF t < 0 THEN 98900
+98900 LET v20 = 83
+98910 LET v20 = v20 * 3 + 1
+98920 LET t = t + v20 / 7
+98930 IF t < 0 THEN 98940
+98940 LET v21 = 87
+98950 LET v21 = v21 * 3 + 5
+98960 LET t = t + v21 / 7
+98970 IF t < 0 THEN 98980
+98980 LET v22 = 91
+98990 LET v22 = v22 * 3 + 9
+99000 LET t = t + v22 / 7
+99010 IF t < 0 THEN 99020
+99020 LET v23 = 95
+99030 LET v23 = v23 * 3 + 0
+99040 LET t = t + v23 / 7
+99050 IF t < 0 THEN 99060
+99060 LET v24 = 2
+99070 LET v24 = v24 * 3 + 4
+99080 LET t = t + v24 / 7
+99090 IF t < 0 THEN 99100
+99100 LET v25 = 6
+99110 LET v25 = v25 * 3 + 8
+99120 LET t = t + v25 / 7
+99130 IF t < 0 THEN 99140
+99140 LET v26 = 10
+99150 LET v26 = v26 * 3 + 12
+99160 LET t = t + v26 / 7
+99170 IF t < 0 THEN 99180
+99180 LET v27 = 14
+99190 LET v27 = v27 * 3 + 3
+99200 LET t = t + v27 / 7
+99210 IF t < 0 THEN 99220
+99220 LET v28 = 18
+99230 LET v28 = v28 * 3 + 7
+99240 LET t = t + v28 / 7
+99250 IF t < 0 THEN 99260
+99260 LET v29 = 22
+99270 LET v29 = v29 * 3 + 11
+99280 LET t = t + v29 / 7
+99290 IF t < 0 THEN 99300
+99300 LET v30 = 26
+99310 LET v30 = v30 * 3 + 2
+99320 LET t = t + v30 / 7
+99330 IF t < 0 THEN 99340
+99340 LET v31 = 30
+99350 LET v31 = v31 * 3 + 6
+99360 LET t = t + v31 / 7
+99370 IF t < 0 THEN 99380
+99380 LET v32 = 34
+99390 LET v32 = v32 * 3 + 10
+99400 LET t = t + v32 / 7
+99410 IF t < 0 THEN 99420
+99420 LET v33 = 38
+99430 LET v33 = v33 * 3 + 1
+99440 LET t = t + v33 / 7
+99450 IF t < 0 THEN 99460
+99460 LET v34 = 42
+99470 LET v34 = v34 * 3 + 5
+99480 LET t = t + v34 / 7
+99490 IF t < 0 THEN 99500
+99500 LET v35 = 46
+99510 LET v35 = v35 * 3 + 9
+99520 LET t = t + v35 / 7
+99530 IF t < 0 THEN 99540
+99540 LET v36 = 50
+99550 LET v36 = v36 * 3 + 0
+99560 LET t = t + v36 / 7
+99570 IF t < 0 THEN 99580
+99580 LET v37 = 54
+99590 LET v37 = v37 * 3 + 4
+99600 LET t = t + v37 / 7
+99610 IF t < 0 THEN 99620
+99620 LET v38 = 58
+99630 LET v38 = v38 * 3 + 8
+99640 LET t = t + v38 / 7
+99650 IF t < 0 THEN 99660
+99660 LET v39 = 62
+99670 LET v39 = v39 * 3 + 12
+99680 LET t = t + v39 / 7
+99690 IF t < 0 THEN 99700
+99700 LET v40 = 66
+99710 LET v40 = v40 * 3 + 3
+99720 LET t = t + v40 / 7
+99730 IF t < 0 THEN 99740
+99740 LET v41 = 70
+99750 LET v41 = v41 * 3 + 7
+99760 LET t = t + v41 / 7
+99770 IF t < 0 THEN 99780
+99780 LET v42 = 74
+99790 LET v42 = v42 * 3 + 11
+99800 LET t = t + v42 / 7
+99810 IF t < 0 THEN 99820
+99820 LET v43 = 78
+99830 LET v43 = v43 * 3 + 2
+99840 LET t = t + v43 / 7
+99850 IF t < 0 THEN 99860
+99860 LET v44 = 82
+99870 LET v44 = v44 * 3 + 6
+99880 LET t = t + v44 / 7
+99890 IF t < 0 THEN 99900
+99900 LET v45 = 86
+99910 LET v45 = v45 * 3 + 10
+99920 LET t = t + v45 / 7
+99930 IF t < 0 THEN 99940
+99940 LET v46 = 90
+99950 LET v46 = v46 * 3 + 1
+99960 LET t = t + v46 / 7
+99970 IF t < 0 THEN 99980
+99980 LET v47 = 94
+99990 LET v47 = v47 * 3 + 5
+100000 LET t = t + v47 / 7
+100010 IF t < 0 THEN 100020
+100020 LET v48 = 1
+100030 LET v48 = v48 * 3 + 9
+100040 LET t = t + v48 / 7
+100050 IF t < 0 THEN 100060
+100060 LET v49 = 5
+100070 LET v49 = v49 * 3 + 0
+100080 LET t = t + v49 / 7
+100090 IF t < 0 THEN 100100
+100100 LET v0 = 9
+100110 LET v0 = v0 * 3 + 4
+100120 LET t = t + v0 / 7
+100130 IF t < 0 THEN 100140
+100140 LET v1 = 13
+100150 LET v1 = v1 * 3 + 8
+100160 LET t = t + v1 / 7
+100170 IF t < 0 THEN 100180
+100180 LET v2 = 17
+100190 LET v2 = v2 * 3 + 12
+100200 LET t = t + v2 / 7
+100210 IF t < 0 THEN 100220
+100220 LET v3 = 21
+100230 LET v3 = v3 * 3 + 3
+100240 LET t = t + v3 / 7
+100250 IF t < 0 THEN 100260
+100260 LET v4 = 25
+100270 LET v4 = v4 * 3 + 7
+100280 LET t = t + v4 / 7
+100290 IF t < 0 THEN 100300
+100300 LET v5 = 29
+100310 LET v5 = v5 * 3 + 11
+100320 LET t = t + v5 / 7
+100330 IF t < 0 THEN 100340
+100340 LET v6 = 33
+100350 LET v6 = v6 * 3 + 2
+100360 LET t = t + v6 / 7
+100370 IF t < 0 THEN 100380
+100380 LET v7 = 37
+100390 LET v7 = v7 * 3 + 6
+100400 LET t = t + v7 / 7
+100410 IF t < 0 THEN 100420
+100420 LET v8 = 41
+100430 LET v8 = v8 * 3 + 10
+100440 LET t = t + v8 / 7
+100450 IF t < 0 THEN 100460
+100460 LET v9 = 45
+100470 LET v9 = v9 * 3 + 1
+100480 LET t = t + v9 / 7
+100490 IF t < 0 THEN 100500
+100500 LET v10 = 49
+100510 LET v10 = v10 * 3 + 5
+100520 LET t = t + v10 / 7
+100530 IF t < 0 THEN 100540
+100540 LET v11 = 53
+100550 LET v11 = v11 * 3 + 9
+100560 LET t = t + v11 / 7
+100570 IF t < 0 THEN 100580
+100580 LET v12 = 57
+100590 LET v12 = v12 * 3 + 0
+100600 LET t = t + v12 / 7
+100610 IF t < 0 THEN 100620
+100620 LET v13 = 61
+100630 LET v13 = v13 * 3 + 4
+100640 LET t = t + v13 / 7
+100650 IF t < 0 THEN 100660
+100660 LET v14 = 65
+100670 LET v14 = v14 * 3 + 8
+100680 LET t = t + v14 / 7
+100690 IF t < 0 THEN 100700
+100700 LET v15 = 69
+100710 LET v15 = v15 * 3 + 12
+100720 LET t = t + v15 / 7
+100730 IF t < 0 THEN 100740
+100740 LET v16 = 73
+100750 LET v16 = v16 * 3 + 3
+100760 LET t = t + v16 / 7
+100770 IF t < 0 THEN 100780
+100780 LET v17 = 77
+100790 LET v17 = v17 * 3 + 7
+100800 LET t = t + v17 / 7
+100810 IF t < 0 THEN 100820
+100820 LET v18 = 81
+100830 LET v18 = v18 * 3 + 11
+100840 LET t = t + v18 / 7
+100850 IF t < 0 THEN 100860
+100860 LET v19 = 85
+100870 LET v19 = v19 * 3 + 2
+100880 LET t = t + v19 / 7
+100890 IF t < 0 THEN 100900
+100900 LET v20 = 89
+100910 LET v20 = v20 * 3 + 6
+100920 LET t = t + v20 / 7
+100930 IF t < 0 THEN 100940
+100940 LET v21 = 93
+100950 LET v21 = v21 * 3 + 10
+100960 LET t = t + v21 / 7
+100970 IF t < 0 THEN 100980
+100980 LET v22 = 0
+100990 LET v22 = v22 * 3 + 1
+101000 LET t = t + v22 / 7
+101010 IF t < 0 THEN 101020
+101020 LET v23 = 4
+101030 LET v23 = v23 * 3 + 5
+101040 LET t = t + v23 / 7
+101050 IF t < 0 THEN 101060
+101060 LET v24 = 8
+101070 LET v24 = v24 * 3 + 9
+101080 LET t = t + v24 / 7
+101090 IF t < 0 THEN 101100
+101100 LET v25 = 12
+101110 LET v25 = v25 * 3 + 0
+101120 LET t = t + v25 / 7
+101130 IF t < 0 THEN 101140
+101140 LET v26 = 16
+101150 LET v26 = v26 * 3 + 4
+101160 LET t = t + v26 / 7
+101170 IF t < 0 THEN 101180
+101180 LET v27 = 20
+101190 LET v27 = v27 * 3 + 8
+101200 LET t = t + v27 / 7
+101210 IF t < 0 THEN 101220
+101220 LET v28 = 24
+101230 LET v28 = v28 * 3 + 12
+101240 LET t = t + v28 / 7
+101250 IF t < 0 THEN 101260
+101260 LET v29 = 28
+101270 LET v29 = v29 * 3 + 3
+101280 LET t = t + v29 / 7
+101290 IF t < 0 THEN 101300
+101300 LET v30 = 32
+101310 LET v30 = v30 * 3 + 7
+101320 LET t = t + v30 / 7
+101330 IF t < 0 THEN 101340
+101340 LET v31 = 36
+101350 LET v31 = v31 * 3 + 11
+101360 LET t = t + v31 / 7
+101370 IF t < 0 THEN 101380
+101380 LET v32 = 40
+101390 LET v32 = v32 * 3 + 2
+101400 LET t = t + v32 / 7
+101410 IF t < 0 THEN 101420
+101420 LET v33 = 44
+101430 LET v33 = v33 * 3 + 6
+101440 LET t = t + v33 / 7
+101450 IF t < 0 THEN 101460
+101460 LET v34 = 48
+101470 LET v34 = v34 * 3 + 10
+101480 LET t = t + v34 / 7
+101490 IF t < 0 THEN 101500
+101500 LET v35 = 52
+101510 LET v35 = v35 * 3 + 1
+101520 LET t = t + v35 / 7
+101530 IF t < 0 THEN 101540
+101540 LET v36 = 56
+101550 LET v36 = v36 * 3 + 5
+101560 LET t = t + v36 / 7
+101570 IF t < 0 THEN 101580
+101580 LET v37 = 60
+101590 LET v37 = v37 * 3 + 9
+101600 LET t = t + v37 / 7
+101610 IF t < 0 THEN 101620
+101620 LET v38 = 64
+101630 LET v38 = v38 * 3 + 0
+101640 LET t = t + v38 / 7
+101650 IF t < 0 THEN 101660
+101660 LET v39 = 68
+101670 LET v39 = v39 * 3 + 4
+101680 LET t = t + v39 / 7
+101690 IF t < 0 THEN 101700
+101700 LET v40 = 72
+101710 LET v40 = v40 * 3 + 8
+101720 LET t = t + v40 / 7
+101730 IF t < 0 THEN 101740
+101740 LET v41 = 76
+101750 LET v41 = v41 * 3 + 12
+101760 LET t = t + v41 / 7
+101770 IF t < 0 THEN 101780
+101780 LET v42 = 80
+101790 LET v42 = v42 * 3 + 3
+101800 LET t = t + v42 / 7
+101810 IF t < 0 THEN 101820
+101820 LET v43 = 84
+101830 LET v43 = v43 * 3 + 7
+101840 LET t = t + v43 / 7
+101850 IF t < 0 THEN 101860
+101860 LET v44 = 88
+101870 LET v44 = v44 * 3 + 11
+101880 LET t = t + v44 / 7
+101890 IF t < 0 THEN 101900
+101900 LET v45 = 92
+101910 LET v45 = v45 * 3 + 2
+101920 LET t = t + v45 / 7
+101930 IF t < 0 THEN 101940
+101940 LET v46 = 96
+101950 LET v46 = v46 * 3 + 6
+101960 LET t = t + v46 / 7
+101970 IF t < 0 THEN 101980
+101980 LET v47 = 3
+101990 LET v47 = v47 * 3 + 10
+102000 LET t = t + v47 / 7
+102010 IF t < 0 THEN 102020
+102020 LET v48 = 7
+102030 LET v48 = v48 * 3 + 1
+102040 LET t = t + v48 / 7
+102050 IF t < 0 THEN 102060
+102060 LET v49 = 11
+102070 LET v49 = v49 * 3 + 5
+102080 LET t = t + v49 / 7
+102090 IF t < 0 THEN 102100
+102100 LET v0 = 15
+102110 LET v0 = v0 * 3 + 9
+102120 LET t = t + v0 / 7
+102130 IF t < 0 THEN 102140
+102140 LET v1 = 19
+102150 LET v1 = v1 * 3 + 0
+102160 LET t = t + v1 / 7
+102170 IF t < 0 THEN 102180
+102180 LET v2 = 23
+102190 LET v2 = v2 * 3 + 4
+102200 LET t = t + v2 / 7
+102210 IF t < 0 THEN 102220
+102220 LET v3 = 27
+102230 LET v3 = v3 * 3 + 8
+102240 LET t = t + v3 / 7
+102250 IF t < 0 THEN 102260
+102260 LET v4 = 31
+102270 LET v4 = v4 * 3 + 12
+102280 LET t = t + v4 / 7
+102290 IF t < 0 THEN 102300
+102300 LET v5 = 35
+102310 LET v5 = v5 * 3 + 3
+102320 LET t = t + v5 / 7
+102330 IF t < 0 THEN 102340
+102340 LET v6 = 39
+102350 LET v6 = v6 * 3 + 7
+102360 LET t = t + v6 / 7
+102370 IF t < 0 THEN 102380
+102380 LET v7 = 43
+102390 LET v7 = v7 * 3 + 11
+102400 LET t = t + v7 / 7
+102410 IF t < 0 THEN 102420
+102420 LET v8 = 47
+102430 LET v8 = v8 * 3 + 2
+102440 LET t = t + v8 / 7
+102450 IF t < 0 THEN 102460
+102460 LET v9 = 51
+102470 LET v9 = v9 * 3 + 6
+102480 LET t = t + v9 / 7
+102490 IF t < 0 THEN 102500
+102500 LET v10 = 55
+102510 LET v10 = v10 * 3 + 10
+102520 LET t = t + v10 / 7
+102530 IF t < 0 THEN 102540
+102540 LET v11 = 59
+102550 LET v11 = v11 * 3 + 1
+102560 LET t = t + v11 / 7
+102570 IF t < 0 THEN 102580
+102580 LET v12 = 63
+102590 LET v12 = v12 * 3 + 5
+102600 LET t = t + v12 / 7
+102610 IF t < 0 THEN 102620
+102620 LET v13 = 67
+102630 LET v13 = v13 * 3 + 9
+102640 LET t = t + v13 / 7
+102650 IF t < 0 THEN 102660
+102660 LET v14 = 71
+102670 LET v14 = v14 * 3 + 0
+102680 LET t = t + v14 / 7
+102690 IF t < 0 THEN 102700
+102700 LET v15 = 75
+102710 LET v15 = v15 * 3 + 4
+102720 LET t = t + v15 / 7
+102730 IF t < 0 THEN 102740
+102740 LET v16 = 79
+102750 LET v16 = v16 * 3 + 8
+102760 LET t = t + v16 / 7
+102770 IF t < 0 THEN 102780
+102780 LET v17 = 83
+102790 LET v17 = v17 * 3 + 12
+102800 LET t = t + v17 / 7
+102810 IF t < 0 THEN 102820
+102820 LET v18 = 87
+102830 LET v18 = v18 * 3 + 3
+102840 LET t = t + v18 / 7
+102850 IF t < 0 THEN 102860
+102860 LET v19 = 91
+102870 LET v19 = v19 * 3 + 7
+102880 LET t = t + v19 / 7
+102890 IF t < 0 THEN 102900
+102900 LET v20 = 95
+102910 LET v20 = v20 * 3 + 11
+102920 LET t = t + v20 / 7
+102930 IF t < 0 THEN 102940
+102940 LET v21 = 2
+102950 LET v21 = v21 * 3 + 2
+102960 LET t = t + v21 / 7
+102970 IF t < 0 THEN 102980
+102980 LET v22 = 6
+102990 LET v22 = v22 * 3 + 6
+103000 LET t = t + v22 / 7
+103010 IF t < 0 THEN 103020
+103020 LET v23 = 10
+103030 LET v23 = v23 * 3 + 10
+103040 LET t = t + v23 / 7
+103050 IF t < 0 THEN 103060
+103060 LET v24 = 14
+103070 LET v24 = v24 * 3 + 1
+103080 LET t = t + v24 / 7
+103090 IF t < 0 THEN 103100
+103100 LET v25 = 18
+103110 LET v25 = v25 * 3 + 5
+103120 LET t = t + v25 / 7
+103130 IF t < 0 THEN 103140
+103140 LET v26 = 22
+103150 LET v26 = v26 * 3 + 9
+103160 LET t = t + v26 / 7
+103170 IF t < 0 THEN 103180
+103180 LET v27 = 26
+103190 LET v27 = v27 * 3 + 0
+103200 LET t = t + v27 / 7
+103210 IF t < 0 THEN 103220
+103220 LET v28 = 30
+103230 LET v28 = v28 * 3 + 4
+103240 LET t = t + v28 / 7
+103250 IF t < 0 THEN 103260
+103260 LET v29 = 34
+103270 LET v29 = v29 * 3 + 8
+103280 LET t = t + v29 / 7
+103290 IF t < 0 THEN 103300
+103300 LET v30 = 38
+103310 LET v30 = v30 * 3 + 12
+103320 LET t = t + v30 / 7
+103330 IF t < 0 THEN 103340
+103340 LET v31 = 42
+103350 LET v31 = v31 * 3 + 3
+103360 LET t = t + v31 / 7
+103370 IF t < 0 THEN 103380
+103380 LET v32 = 46
+103390 LET v32 = v32 * 3 + 7
+103400 LET t = t + v32 / 7
+103410 IF t < 0 THEN 103420
+103420 LET v33 = 50
+103430 LET v33 = v33 * 3 + 11
+103440 LET t = t + v33 / 7
+103450 IF t < 0 THEN 103460
+103460 LET v34 = 54
+103470 LET v34 = v34 * 3 + 2
+103480 LET t = t + v34 / 7
+103490 IF t < 0 THEN 103500
+103500 LET v35 = 58
+103510 LET v35 = v35 * 3 + 6
+103520 LET t = t + v35 / 7
+103530 IF t < 0 THEN 103540
+103540 LET v36 = 62
+103550 LET v36 = v36 * 3 + 10
+103560 LET t = t + v36 / 7
+103570 IF t < 0 THEN 103580
+103580 LET v37 = 66
+103590 LET v37 = v37 * 3 + 1
+103600 LET t = t + v37 / 7
+103610 IF t < 0 THEN 103620
+103620 LET v38 = 70
+103630 LET v38 = v38 * 3 + 5
+103640 LET t = t + v38 / 7
+103650 IF t < 0 THEN 103660
+103660 LET v39 = 74
+103670 LET v39 = v39 * 3 + 9
+103680 LET t = t + v39 / 7
+103690 IF t < 0 THEN 103700
+103700 LET v40 = 78
+103710 LET v40 = v40 * 3 + 0
+103720 LET t = t + v40 / 7
+103730 IF t < 0 THEN 103740
+103740 LET v41 = 82
+103750 LET v41 = v41 * 3 + 4
+103760 LET t = t + v41 / 7
+103770 IF t < 0 THEN 103780
+103780 LET v42 = 86
+103790 LET v42 = v42 * 3 + 8
+103800 LET t = t + v42 / 7
+103810 IF t < 0 THEN 103820
+103820 LET v43 = 90
+103830 LET v43 = v43 * 3 + 12
+103840 LET t = t + v43 / 7
+103850 IF t < 0 THEN 103860
+103860 LET v44 = 94
+103870 LET v44 = v44 * 3 + 3
+103880 LET t = t + v44 / 7
+103890 IF t < 0 THEN 103900
+103900 LET v45 = 1
+103910 LET v45 = v45 * 3 + 7
+103920 LET t = t + v45 / 7
+103930 IF t < 0 THEN 103940
+103940 LET v46 = 5
+103950 LET v46 = v46 * 3 + 11
+103960 LET t = t + v46 / 7
+103970 IF t < 0 THEN 103980
+103980 LET v47 = 9
+103990 LET v47 = v47 * 3 + 2
+104000 LET t = t + v47 / 7
+104010 IF t < 0 THEN 104020
+104020 LET v48 = 13
+104030 LET v48 = v48 * 3 + 6
+104040 LET t = t + v48 / 7
+104050 IF t < 0 THEN 104060
+104060 LET v49 = 17
+104070 LET v49 = v49 * 3 + 10
+104080 LET t = t + v49 / 7
+104090 IF t < 0 THEN 104100
+104100 LET v0 = 21
+104110 LET v0 = v0 * 3 + 1
+104120 LET t = t + v0 / 7
+104130 IF t < 0 THEN 104140
+104140 LET v1 = 25
+104150 LET v1 = v1 * 3 + 5
+104160 LET t = t + v1 / 7
+104170 IF t < 0 THEN 104180
+104180 LET v2 = 29
+104190 LET v2 = v2 * 3 + 9
+104200 LET t = t + v2 / 7
+104210 IF t < 0 THEN 104220
+104220 LET v3 = 33
+104230 LET v3 = v3 * 3 + 0
+104240 LET t = t + v3 / 7
+104250 IF t < 0 THEN 104260
+104260 LET v4 = 37
+104270 LET v4 = v4 * 3 + 4
+104280 LET t = t + v4 / 7
+104290 IF t < 0 THEN 104300
+104300 LET v5 = 41
+104310 LET v5 = v5 * 3 + 8
+104320 LET t = t + v5 / 7
+104330 IF t < 0 THEN 104340
+104340 LET v6 = 45
+104350 LET v6 = v6 * 3 + 12
+104360 LET t = t + v6 / 7
+104370 IF t < 0 THEN 104380
+104380 LET v7 = 49
+104390 LET v7 = v7 * 3 + 3
+104400 LET t = t + v7 / 7
+104410 IF t < 0 THEN 104420
+104420 LET v8 = 53
+104430 LET v8 = v8 * 3 + 7
+104440 LET t = t + v8 / 7
+104450 IF t < 0 THEN 104460
+104460 LET v9 = 57
+104470 LET v9 = v9 * 3 + 11
+104480 LET t = t + v9 / 7
+104490 IF t < 0 THEN 104500
+104500 LET v10 = 61
+104510 LET v10 = v10 * 3 + 2
+104520 LET t = t + v10 / 7
+104530 IF t < 0 THEN 104540
+104540 LET v11 = 65
+104550 LET v11 = v11 * 3 + 6
+104560 LET t = t + v11 / 7
+104570 IF t < 0 THEN 104580
+104580 LET v12 = 69
+104590 LET v12 = v12 * 3 + 10
+104600 LET t = t + v12 / 7
+104610 IF t < 0 THEN 104620
+104620 LET v13 = 73
+104630 LET v13 = v13 * 3 + 1
+104640 LET t = t + v13 / 7
+104650 IF t < 0 THEN 104660
+104660 LET v14 = 77
+104670 LET v14 = v14 * 3 + 5
+104680 LET t = t + v14 / 7
+104690 IF t < 0 THEN 104700
+104700 LET v15 = 81
+104710 LET v15 = v15 * 3 + 9
+104720 LET t = t + v15 / 7
+104730 IF t < 0 THEN 104740
+104740 LET v16 = 85
+104750 LET v16 = v16 * 3 + 0
+104760 LET t = t + v16 / 7
+104770 IF t < 0 THEN 104780
+104780 LET v17 = 89
+104790 LET v17 = v17 * 3 + 4
+104800 LET t = t + v17 / 7
+104810 IF t < 0 THEN 104820
+104820 LET v18 = 93
+104830 LET v18 = v18 * 3 + 8
+104840 LET t = t + v18 / 7
+104850 IF t < 0 THEN 104860
+104860 LET v19 = 0
+104870 LET v19 = v19 * 3 + 12
+104880 LET t = t + v19 / 7
+104890 IF t < 0 THEN 104900
+104900 LET v20 = 4
+104910 LET v20 = v20 * 3 + 3
+104920 LET t = t + v20 / 7
+104930 IF t < 0 THEN 104940
+104940 LET v21 = 8
+104950 LET v21 = v21 * 3 + 7
+104960 LET t = t + v21 / 7
+104970 IF t < 0 THEN 104980
+104980 LET v22 = 12
+104990 LET v22 = v22 * 3 + 11
+105000 LET t = t + v22 / 7
+105010 IF t < 0 THEN 105020
+105020 LET v23 = 16
+105030 LET v23 = v23 * 3 + 2
+105040 LET t = t + v23 / 7
+105050 IF t < 0 THEN 105060
+105060 LET v24 = 20
+105070 LET v24 = v24 * 3 + 6
+105080 LET t = t + v24 / 7
+105090 IF t < 0 THEN 105100
+105100 LET v25 = 24
+105110 LET v25 = v25 * 3 + 10
+105120 LET t = t + v25 / 7
+105130 IF t < 0 THEN 105140
+105140 LET v26 = 28
+105150 LET v26 = v26 * 3 + 1
+105160 LET t = t + v26 / 7
+105170 IF t < 0 THEN 105180
+105180 LET v27 = 32
+105190 LET v27 = v27 * 3 + 5
+105200 LET t = t + v27 / 7
+105210 IF t < 0 THEN 105220
+105220 LET v28 = 36
+105230 LET v28 = v28 * 3 + 9
+105240 LET t = t + v28 / 7
+105250 IF t < 0 THEN 105260
+105260 LET v29 = 40
+105270 LET v29 = v29 * 3 + 0
+105280 LET t = t + v29 / 7
+105290 IF t < 0 THEN 105300
+105300 LET v30 = 44
+105310 LET v30 = v30 * 3 + 4
+105320 LET t = t + v30 / 7
+105330 IF t < 0 THEN 105340
+105340 LET v31 = 48
+105350 LET v31 = v31 * 3 + 8
+105360 LET t = t + v31 / 7
+105370 IF t < 0 THEN 105380
+105380 LET v32 = 52
+105390 LET v32 = v32 * 3 + 12
+105400 LET t = t + v32 / 7
+105410 IF t < 0 THEN 105420
+105420 LET v33 = 56
+105430 LET v33 = v33 * 3 + 3
+105440 LET t = t + v33 / 7
+105450 IF t < 0 THEN 105460
+105460 LET v34 = 60
+105470 LET v34 = v34 * 3 + 7
+105480 LET t = t + v34 / 7
+105490 IF t < 0 THEN 105500
+105500 LET v35 = 64
+105510 LET v35 = v35 * 3 + 11
+105520 LET t = t + v35 / 7
+105530 IF t < 0 THEN 105540
+105540 LET v36 = 68
+105550 LET v36 = v36 * 3 + 2
+105560 LET t = t + v36 / 7
+105570 IF t < 0 THEN 105580
+105580 LET v37 = 72
+105590 LET v37 = v37 * 3 + 6
+105600 LET t = t + v37 / 7
+105610 IF t < 0 THEN 105620
+105620 LET v38 = 76
+105630 LET v38 = v38 * 3 + 10
+105640 LET t = t + v38 / 7
+105650 IF t < 0 THEN 105660
+105660 LET v39 = 80
+105670 LET v39 = v39 * 3 + 1
+105680 LET t = t + v39 / 7
+105690 IF t < 0 THEN 105700
+105700 LET v40 = 84
+105710 LET v40 = v40 * 3 + 5
+105720 LET t = t + v40 / 7
+105730 IF t < 0 THEN 105740
+105740 LET v41 = 88
+105750 LET v41 = v41 * 3 + 9
+105760 LET t = t + v41 / 7
+105770 IF t < 0 THEN 105780
+105780 LET v42 = 92
+105790 LET v42 = v42 * 3 + 0
+105800 LET t = t + v42 / 7
+105810 IF t < 0 THEN 105820
+105820 LET v43 = 96
+105830 LET v43 = v43 * 3 + 4
+105840 LET t = t + v43 / 7
+105850 IF t < 0 THEN 105860
+105860 LET v44 = 3
+105870 LET v44 = v44 * 3 + 8
+105880 LET t = t + v44 / 7
+105890 IF t < 0 THEN 105900
+105900 LET v45 = 7
+105910 LET v45 = v45 * 3 + 12
+105920 LET t = t + v45 / 7
+105930 IF t < 0 THEN 105940
+105940 LET v46 = 11
+105950 LET v46 = v46 * 3 + 3
+105960 LET t = t + v46 / 7
+105970 IF t < 0 THEN 105980
+105980 LET v47 = 15
+105990 LET v47 = v47 * 3 + 7
+106000 LET t = t + v47 / 7
+106010 IF t < 0 THEN 106020
+106020 LET v48 = 19
+106030 LET v48 = v48 * 3 + 11
+106040 LET t = t + v48 / 7
+106050 IF t < 0 THEN 106060
+106060 LET v49 = 23
+106070 LET v49 = v49 * 3 + 2
+106080 LET t = t + v49 / 7
+106090 IF t < 0 THEN 106100
+106100 LET v0 = 27
+106110 LET v0 = v0 * 3 + 6
+106120 LET t = t + v0 / 7
+106130 IF t < 0 THEN 106140
+106140 LET v1 = 31
+106150 LET v1 = v1 * 3 + 10
+106160 LET t = t + v1 / 7
+106170 IF t < 0 THEN 106180
+106180 LET v2 = 35
+106190 LET v2 = v2 * 3 + 1
+106200 LET t = t + v2 / 7
+106210 IF t < 0 THEN 106220
+106220 LET v3 = 39
+106230 LET v3 = v3 * 3 + 5
+106240 LET t = t + v3 / 7
+106250 IF t < 0 THEN 106260
+106260 LET v4 = 43
+106270 LET v4 = v4 * 3 + 9
+106280 LET t = t + v4 / 7
+106290 IF t < 0 THEN 106300
+106300 LET v5 = 47
+106310 LET v5 = v5 * 3 + 0
+106320 LET t = t + v5 / 7
+106330 IF t < 0 THEN 106340
+106340 LET v6 = 51
+106350 LET v6 = v6 * 3 + 4
+106360 LET t = t + v6 / 7
+106370 IF t < 0 THEN 106380
+106380 LET v7 = 55
+106390 LET v7 = v7 * 3 + 8
+106400 LET t = t + v7 / 7
+106410 IF t < 0 THEN 106420
+106420 LET v8 = 59
+106430 LET v8 = v8 * 3 + 12
+106440 LET t = t + v8 / 7
+106450 IF t < 0 THEN 106460
+106460 LET v9 = 63
+106470 LET v9 = v9 * 3 + 3
+106480 LET t = t + v9 / 7
+106490 IF t < 0 THEN 106500
+106500 LET v10 = 67
+106510 LET v10 = v10 * 3 + 7
+106520 LET t = t + v10 / 7
+106530 IF t < 0 THEN 106540
+106540 LET v11 = 71
+106550 LET v11 = v11 * 3 + 11
+106560 LET t = t + v11 / 7
+106570 IF t < 0 THEN 106580
+106580 LET v12 = 75
+106590 LET v12 = v12 * 3 + 2
+106600 LET t = t + v12 / 7
+106610 IF t < 0 THEN 106620
+106620 LET v13 = 79
+106630 LET v13 = v13 * 3 + 6
+106640 LET t = t + v13 / 7
+106650 IF t < 0 THEN 106660
+106660 LET v14 = 83
+106670 LET v14 = v14 * 3 + 10
+106680 LET t = t + v14 / 7
+106690 IF t < 0 THEN 106700
+106700 LET v15 = 87
+106710 LET v15 = v15 * 3 + 1
+106720 LET t = t + v15 / 7
+106730 IF t < 0 THEN 106740
+106740 LET v16 = 91
+106750 LET v16 = v16 * 3 + 5
+106760 LET t = t + v16 / 7
+106770 IF t < 0 THEN 106780
+106780 LET v17 = 95
+106790 LET v17 = v17 * 3 + 9
+106800 LET t = t + v17 / 7
+106810 IF t < 0 THEN 106820
+106820 LET v18 = 2
+106830 LET v18 = v18 * 3 + 0
+106840 LET t = t + v18 / 7
+106850 IF t < 0 THEN 106860
+106860 LET v19 = 6
+106870 LET v19 = v19 * 3 + 4
+106880 LET t = t + v19 / 7
+106890 IF t < 0 THEN 106900
+106900 LET v20 = 10
+106910 LET v20 = v20 * 3 + 8
+106920 LET t = t + v20 / 7
+106930 IF t < 0 THEN 106940
+106940 LET v21 = 14
+106950 LET v21 = v21 * 3 + 12
+106960 LET t = t + v21 / 7
+106970 IF t < 0 THEN 106980
+106980 LET v22 = 18
+106990 LET v22 = v22 * 3 + 3
+107000 LET t = t + v22 / 7
+107010 IF t < 0 THEN 107020
+107020 LET v23 = 22
+107030 LET v23 = v23 * 3 + 7
+107040 LET t = t + v23 / 7
+107050 IF t < 0 THEN 107060
+107060 LET v24 = 26
+107070 LET v24 = v24 * 3 + 11
+107080 LET t = t + v24 / 7
+107090 IF t < 0 THEN 107100
+107100 LET v25 = 30
+107110 LET v25 = v25 * 3 + 2
+107120 LET t = t + v25 / 7
+107130 IF t < 0 THEN 107140
+107140 LET v26 = 34
+107150 LET v26 = v26 * 3 + 6
+107160 LET t = t + v26 / 7
+107170 IF t < 0 THEN 107180
+107180 LET v27 = 38
+107190 LET v27 = v27 * 3 + 10
+107200 LET t = t + v27 / 7
+107210 IF t < 0 THEN 107220
+107220 LET v28 = 42
+107230 LET v28 = v28 * 3 + 1
+107240 LET t = t + v28 / 7
+107250 IF t < 0 THEN 107260
+107260 LET v29 = 46
+107270 LET v29 = v29 * 3 + 5
+107280 LET t = t + v29 / 7
+107290 IF t < 0 THEN 107300
+107300 LET v30 = 50
+107310 LET v30 = v30 * 3 + 9
+107320 LET t = t + v30 / 7
+107330 IF t < 0 THEN 107340
+107340 LET v31 = 54
+107350 LET v31 = v31 * 3 + 0
+107360 LET t = t + v31 / 7
+107370 IF t < 0 THEN 107380
+107380 LET v32 = 58
+107390 LET v32 = v32 * 3 + 4
+107400 LET t = t + v32 / 7
+107410 IF t < 0 THEN 107420
+107420 LET v33 = 62
+107430 LET v33 = v33 * 3 + 8
+107440 LET t = t + v33 / 7
+107450 IF t < 0 THEN 107460
+107460 LET v34 = 66
+107470 LET v34 = v34 * 3 + 12
+107480 LET t = t + v34 / 7
+107490 IF t < 0 THEN 107500
+107500 LET v35 = 70
+107510 LET v35 = v35 * 3 + 3
+107520 LET t = t + v35 / 7
+107530 IF t < 0 THEN 107540
+107540 LET v36 = 74
+107550 LET v36 = v36 * 3 + 7
+107560 LET t = t + v36 / 7
+107570 IF t < 0 THEN 107580
+107580 LET v37 = 78
+107590 LET v37 = v37 * 3 + 11
+107600 LET t = t + v37 / 7
+107610 IF t < 0 THEN 107620
+107620 LET v38 = 82
+107630 LET v38 = v38 * 3 + 2
+107640 LET t = t + v38 / 7
+107650 IF t < 0 THEN 107660
+107660 LET v39 = 86
+107670 LET v39 = v39 * 3 + 6
+107680 LET t = t + v39 / 7
+107690 IF t < 0 THEN 107700
+107700 LET v40 = 90
+107710 LET v40 = v40 * 3 + 10
+107720 LET t = t + v40 / 7
+107730 IF t < 0 THEN 107740
+107740 LET v41 = 94
+107750 LET v41 = v41 * 3 + 1
+107760 LET t = t + v41 / 7
+107770 IF t < 0 THEN 107780
+107780 LET v42 = 1
+107790 LET v42 = v42 * 3 + 5
+107800 LET t = t + v42 / 7
+107810 IF t < 0 THEN 107820
+107820 LET v43 = 5
+107830 LET v43 = v43 * 3 + 9
+107840 LET t = t + v43 / 7
+107850 IF t < 0 THEN 107860
+107860 LET v44 = 9
+107870 LET v44 = v44 * 3 + 0
+107880 LET t = t + v44 / 7
+107890 IF t < 0 THEN 107900
+107900 LET v45 = 13
+107910 LET v45 = v45 * 3 + 4
+107920 LET t = t + v45 / 7
+107930 IF t < 0 THEN 107940
+107940 LET v46 = 17
+107950 LET v46 = v46 * 3 + 8
+107960 LET t = t + v46 / 7
+107970 IF t < 0 THEN 107980
+107980 LET v47 = 21
+107990 LET v47 = v47 * 3 + 12
+108000 LET t = t + v47 / 7
+108010 IF t < 0 THEN 108020
+108020 LET v48 = 25
+108030 LET v48 = v48 * 3 + 3
+108040 LET t = t + v48 / 7
+108050 IF t < 0 THEN 108060
+108060 LET v49 = 29
+108070 LET v49 = v49 * 3 + 7
+108080 LET t = t + v49 / 7
+108090 IF t < 0 THEN 108100
+108100 LET v0 = 33
+108110 LET v0 = v0 * 3 + 11
+108120 LET t = t + v0 / 7
+108130 IF t < 0 THEN 108140
+108140 LET v1 = 37
+108150 LET v1 = v1 * 3 + 2
+108160 LET t = t + v1 / 7
+108170 IF t < 0 THEN 108180
+108180 LET v2 = 41
+108190 LET v2 = v2 * 3 + 6
+108200 LET t = t + v2 / 7
+108210 IF t < 0 THEN 108220
+108220 LET v3 = 45
+108230 LET v3 = v3 * 3 + 10
+108240 LET t = t + v3 / 7
+108250 IF t < 0 THEN 108260
+108260 LET v4 = 49
+108270 LET v4 = v4 * 3 + 1
+108280 LET t = t + v4 / 7
+108290 IF t < 0 THEN 108300
+108300 LET v5 = 53
+108310 LET v5 = v5 * 3 + 5
+108320 LET t = t + v5 / 7
+108330 IF t < 0 THEN 108340
+108340 LET v6 = 57
+108350 LET v6 = v6 * 3 + 9
+108360 LET t = t + v6 / 7
+108370 IF t < 0 THEN 108380
+108380 LET v7 = 61
+108390 LET v7 = v7 * 3 + 0
+108400 LET t = t + v7 / 7
+108410 IF t < 0 THEN 108420
+108420 LET v8 = 65
+108430 LET v8 = v8 * 3 + 4
+108440 LET t = t + v8 / 7
+108450 IF t < 0 THEN 108460
+108460 LET v9 = 69
+108470 LET v9 = v9 * 3 + 8
+108480 LET t = t + v9 / 7
+108490 IF t < 0 THEN 108500
+108500 LET v10 = 73
+108510 LET v10 = v10 * 3 + 12
+108520 LET t = t + v10 / 7
+108530 IF t < 0 THEN 108540
+108540 LET v11 = 77
+108550 LET v11 = v11 * 3 + 3
+108560 LET t = t + v11 / 7
+108570 IF t < 0 THEN 108580
+108580 LET v12 = 81
+108590 LET v12 = v12 * 3 + 7
+108600 LET t = t + v12 / 7
+108610 IF t < 0 THEN 108620
+108620 LET v13 = 85
+108630 LET v13 = v13 * 3 + 11
+108640 LET t = t + v13 / 7
+108650 IF t < 0 THEN 108660
+108660 LET v14 = 89
+108670 LET v14 = v14 * 3 + 2
+108680 LET t = t + v14 / 7
+108690 IF t < 0 THEN 108700
+108700 LET v15 = 93
+108710 LET v15 = v15 * 3 + 6
+108720 LET t = t + v15 / 7
+108730 IF t < 0 THEN 108740
+108740 LET v16 = 0
+108750 LET v16 = v16 * 3 + 10
+108760 LET t = t + v16 / 7
+108770 IF t < 0 THEN 108780
+108780 LET v17 = 4
+108790 LET v17 = v17 * 3 + 1
+108800 LET t = t + v17 / 7
+108810 IF t < 0 THEN 108820
+108820 LET v18 = 8
+108830 LET v18 = v18 * 3 + 5
+108840 LET t = t + v18 / 7
+108850 IF t < 0 THEN 108860
+108860 LET v19 = 12
+108870 LET v19 = v19 * 3 + 9
+108880 LET t = t + v19 / 7
+108890 IF t < 0 THEN 108900
+108900 LET v20 = 16
+108910 LET v20 = v20 * 3 + 0
+108920 LET t = t + v20 / 7
+108930 IF t < 0 THEN 108940
+108940 LET v21 = 20
+108950 LET v21 = v21 * 3 + 4
+108960 LET t = t + v21 / 7
+108970 IF t < 0 THEN 108980
+108980 LET v22 = 24
+108990 LET v22 = v22 * 3 + 8
+109000 LET t = t + v22 / 7
+109010 IF t < 0 THEN 109020
+109020 LET v23 = 28
+109030 LET v23 = v23 * 3 + 12
+109040 LET t = t + v23 / 7
+109050 IF t < 0 THEN 109060
+109060 LET v24 = 32
+109070 LET v24 = v24 * 3 + 3
+109080 LET t = t + v24 / 7
+109090 IF t < 0 THEN 109100
+109100 LET v25 = 36
+109110 LET v25 = v25 * 3 + 7
+109120 LET t = t + v25 / 7
+109130 IF t < 0 THEN 109140
+109140 LET v26 = 40
+109150 LET v26 = v26 * 3 + 11
+109160 LET t = t + v26 / 7
+109170 IF t < 0 THEN 109180
+109180 LET v27 = 44
+109190 LET v27 = v27 * 3 + 2
+109200 LET t = t + v27 / 7
+109210 IF t < 0 THEN 109220
+109220 LET v28 = 48
+109230 LET v28 = v28 * 3 + 6
+109240 LET t = t + v28 / 7
+109250 IF t < 0 THEN 109260
+109260 LET v29 = 52
+109270 LET v29 = v29 * 3 + 10
+109280 LET t = t + v29 / 7
+109290 IF t < 0 THEN 109300
+109300 LET v30 = 56
+109310 LET v30 = v30 * 3 + 1
+109320 LET t = t + v30 / 7
+109330 IF t < 0 THEN 109340
+109340 LET v31 = 60
+109350 LET v31 = v31 * 3 + 5
+109360 LET t = t + v31 / 7
+109370 IF t < 0 THEN 109380
+109380 LET v32 = 64
+109390 LET v32 = v32 * 3 + 9
+109400 LET t = t + v32 / 7
+109410 IF t < 0 THEN 109420
+109420 LET v33 = 68
+109430 LET v33 = v33 * 3 + 0
+109440 LET t = t + v33 / 7
+109450 IF t < 0 THEN 109460
+109460 LET v34 = 72
+109470 LET v34 = v34 * 3 + 4
+109480 LET t = t + v34 / 7
+109490 IF t < 0 THEN 109500
+109500 LET v35 = 76
+109510 LET v35 = v35 * 3 + 8
+109520 LET t = t + v35 / 7
+109530 IF t < 0 THEN 109540
+109540 LET v36 = 80
+109550 LET v36 = v36 * 3 + 12
+109560 LET t = t + v36 / 7
+109570 IF t < 0 THEN 109580
+109580 LET v37 = 84
+109590 LET v37 = v37 * 3 + 3
+109600 LET t = t + v37 / 7
+109610 IF t < 0 THEN 109620
+109620 LET v38 = 88
+109630 LET v38 = v38 * 3 + 7
+109640 LET t = t + v38 / 7
+109650 IF t < 0 THEN 109660
+109660 LET v39 = 92
+109670 LET v39 = v39 * 3 + 11
+109680 LET t = t + v39 / 7
+109690 IF t < 0 THEN 109700
+109700 LET v40 = 96
+109710 LET v40 = v40 * 3 + 2
+109720 LET t = t + v40 / 7
+109730 IF t < 0 THEN 109740
+109740 LET v41 = 3
+109750 LET v41 = v41 * 3 + 6
+109760 LET t = t + v41 / 7
+109770 IF t < 0 THEN 109780
+109780 LET v42 = 7
+109790 LET v42 = v42 * 3 + 10
+109800 LET t = t + v42 / 7
+109810 IF t < 0 THEN 109820
+109820 LET v43 = 11
+109830 LET v43 = v43 * 3 + 1
+109840 LET t = t + v43 / 7
+109850 IF t < 0 THEN 109860
+109860 LET v44 = 15
+109870 LET v44 = v44 * 3 + 5
+109880 LET t = t + v44 / 7
+109890 IF t < 0 THEN 109900
+109900 LET v45 = 19
+109910 LET v45 = v45 * 3 + 9
+109920 LET t = t + v45 / 7
+109930 IF t < 0 THEN 109940
+109940 LET v46 = 23
+109950 LET v46 = v46 * 3 + 0
+109960 LET t = t + v46 / 7
+109970 IF t < 0 THEN 109980
+109980 LET v47 = 27
+109990 LET v47 = v47 * 3 + 4
+110000 LET t = t + v47 / 7
+110010 IF t < 0 THEN 110020
+110020 LET v48 = 31
+110030 LET v48 = v48 * 3 + 8
+110040 LET t = t + v48 / 7
+110050 IF t < 0 THEN 110060
+110060 LET v49 = 35
+110070 LET v49 = v49 * 3 + 12
+110080 LET t = t + v49 / 7
+110090 IF t < 0 THEN 110100
+110100 LET v0 = 39
+110110 LET v0 = v0 * 3 + 3
+110120 LET t = t + v0 / 7
+110130 IF t < 0 THEN 110140
+110140 LET v1 = 43
+110150 LET v1 = v1 * 3 + 7
+110160 LET t = t + v1 / 7
+110170 IF t < 0 THEN 110180
+110180 LET v2 = 47
+110190 LET v2 = v2 * 3 + 11
+110200 LET t = t + v2 / 7
+110210 IF t < 0 THEN 110220
+110220 LET v3 = 51
+110230 LET v3 = v3 * 3 + 2
+110240 LET t = t + v3 / 7
+110250 IF t < 0 THEN 110260
+110260 LET v4 = 55
+110270 LET v4 = v4 * 3 + 6
+110280 LET t = t + v4 / 7
+110290 IF t < 0 THEN 110300
+110300 LET v5 = 59
+110310 LET v5 = v5 * 3 + 10
+110320 LET t = t + v5 / 7
+110330 IF t < 0 THEN 110340
+110340 LET v6 = 63
+110350 LET v6 = v6 * 3 + 1
+110360 LET t = t + v6 / 7
+110370 IF t < 0 THEN 110380
+110380 LET v7 = 67
+110390 LET v7 = v7 * 3 + 5
+110400 LET t = t + v7 / 7
+110410 IF t < 0 THEN 110420
+110420 LET v8 = 71
+110430 LET v8 = v8 * 3 + 9
+110440 LET t = t + v8 / 7
+110450 IF t < 0 THEN 110460
+110460 LET v9 = 75
+110470 LET v9 = v9 * 3 + 0
+110480 LET t = t + v9 / 7
+110490 IF t < 0 THEN 110500
+110500 LET v10 = 79
+110510 LET v10 = v10 * 3 + 4
+110520 LET t = t + v10 / 7
+110530 IF t < 0 THEN 110540
+110540 LET v11 = 83
+110550 LET v11 = v11 * 3 + 8
+110560 LET t = t + v11 / 7
+110570 IF t < 0 THEN 110580
+110580 LET v12 = 87
+110590 LET v12 = v12 * 3 + 12
+110600 LET t = t + v12 / 7
+110610 IF t < 0 THEN 110620
+110620 LET v13 = 91
+110630 LET v13 = v13 * 3 + 3
+110640 LET t = t + v13 / 7
+110650 IF t < 0 THEN 110660
+110660 LET v14 = 95
+110670 LET v14 = v14 * 3 + 7
+110680 LET t = t + v14 / 7
+110690 IF t < 0 THEN 110700
+110700 LET v15 = 2
+110710 LET v15 = v15 * 3 + 11
+110720 LET t = t + v15 / 7
+110730 IF t < 0 THEN 110740
+110740 LET v16 = 6
+110750 LET v16 = v16 * 3 + 2
+110760 LET t = t + v16 / 7
+110770 IF t < 0 THEN 110780
+110780 LET v17 = 10
+110790 LET v17 = v17 * 3 + 6
+110800 LET t = t + v17 / 7
+110810 IF t < 0 THEN 110820
+110820 LET v18 = 14
+110830 LET v18 = v18 * 3 + 10
+110840 LET t = t + v18 / 7
+110850 IF t < 0 THEN 110860
+110860 LET v19 = 18
+110870 LET v19 = v19 * 3 + 1
+110880 LET t = t + v19 / 7
+110890 IF t < 0 THEN 110900
+110900 LET v20 = 22
+110910 LET v20 = v20 * 3 + 5
+110920 LET t = t + v20 / 7
+110930 IF t < 0 THEN 110940
+110940 LET v21 = 26
+110950 LET v21 = v21 * 3 + 9
+110960 LET t = t + v21 / 7
+110970 IF t < 0 THEN 110980
+110980 LET v22 = 30
+110990 LET v22 = v22 * 3 + 0
+111000 LET t = t + v22 / 7
+111010 IF t < 0 THEN 111020
+111020 LET v23 = 34
+111030 LET v23 = v23 * 3 + 4
+111040 LET t = t + v23 / 7
+111050 IF t < 0 THEN 111060
+111060 LET v24 = 38
+111070 LET v24 = v24 * 3 + 8
+111080 LET t = t + v24 / 7
+111090 IF t < 0 THEN 111100
+111100 LET v25 = 42
+111110 LET v25 = v25 * 3 + 12
+111120 LET t = t + v25 / 7
+111130 IF t < 0 THEN 111140
+111140 LET v26 = 46
+111150 LET v26 = v26 * 3 + 3
+111160 LET t = t + v26 / 7
+111170 IF t < 0 THEN 111180
+111180 LET v27 = 50
+111190 LET v27 = v27 * 3 + 7
+111200 LET t = t + v27 / 7
+111210 IF t < 0 THEN 111220
+111220 LET v28 = 54
+111230 LET v28 = v28 * 3 + 11
+111240 LET t = t + v28 / 7
+111250 IF t < 0 THEN 111260
+111260 LET v29 = 58
+111270 LET v29 = v29 * 3 + 2
+111280 LET t = t + v29 / 7
+111290 IF t < 0 THEN 111300
+111300 LET v30 = 62
+111310 LET v30 = v30 * 3 + 6
+111320 LET t = t + v30 / 7
+111330 IF t < 0 THEN 111340
+111340 LET v31 = 66
+111350 LET v31 = v31 * 3 + 10
+111360 LET t = t + v31 / 7
+111370 IF t < 0 THEN 111380
+111380 LET v32 = 70
+111390 LET v32 = v32 * 3 + 1
+111400 LET t = t + v32 / 7
+111410 IF t < 0 THEN 111420
+111420 LET v33 = 74
+111430 LET v33 = v33 * 3 + 5
+111440 LET t = t + v33 / 7
+111450 IF t < 0 THEN 111460
+111460 LET v34 = 78
+111470 LET v34 = v34 * 3 + 9
+111480 LET t = t + v34 / 7
+111490 IF t < 0 THEN 111500
+111500 LET v35 = 82
+111510 LET v35 = v35 * 3 + 0
+111520 LET t = t + v35 / 7
+111530 IF t < 0 THEN 111540
+111540 LET v36 = 86
+111550 LET v36 = v36 * 3 + 4
+111560 LET t = t + v36 / 7
+111570 IF t < 0 THEN 111580
+111580 LET v37 = 90
+111590 LET v37 = v37 * 3 + 8
+111600 LET t = t + v37 / 7
+111610 IF t < 0 THEN 111620
+111620 LET v38 = 94
+111630 LET v38 = v38 * 3 + 12
+111640 LET t = t + v38 / 7
+111650 IF t < 0 THEN 111660
+111660 LET v39 = 1
+111670 LET v39 = v39 * 3 + 3
+111680 LET t = t + v39 / 7
+111690 IF t < 0 THEN 111700
+111700 LET v40 = 5
+111710 LET v40 = v40 * 3 + 7
+111720 LET t = t + v40 / 7
+111730 IF t < 0 THEN 111740
+111740 LET v41 = 9
+111750 LET v41 = v41 * 3 + 11
+111760 LET t = t + v41 / 7
+111770 IF t < 0 THEN 111780
+111780 LET v42 = 13
+111790 LET v42 = v42 * 3 + 2
+111800 LET t = t + v42 / 7
+111810 IF t < 0 THEN 111820
+111820 LET v43 = 17
+111830 LET v43 = v43 * 3 + 6
+111840 LET t = t + v43 / 7
+111850 IF t < 0 THEN 111860
+111860 LET v44 = 21
+111870 LET v44 = v44 * 3 + 10
+111880 LET t = t + v44 / 7
+111890 IF t < 0 THEN 111900
+111900 LET v45 = 25
+111910 LET v45 = v45 * 3 + 1
+111920 LET t = t + v45 / 7
+111930 IF t < 0 THEN 111940
+111940 LET v46 = 29
+111950 LET v46 = v46 * 3 + 5
+111960 LET t = t + v46 / 7
+111970 IF t < 0 THEN 111980
+111980 LET v47 = 33
+111990 LET v47 = v47 * 3 + 9
+112000 LET t = t + v47 / 7
+112010 IF t < 0 THEN 112020
+112020 LET v48 = 37
+112030 LET v48 = v48 * 3 + 0
+112040 LET t = t + v48 / 7
+112050 IF t < 0 THEN 112060
+112060 LET v49 = 41
+112070 LET v49 = v49 * 3 + 4
+112080 LET t = t + v49 / 7
+112090 IF t < 0 THEN 112100
+112100 LET v0 = 45
+112110 LET v0 = v0 * 3 + 8
+112120 LET t = t + v0 / 7
+112130 IF t < 0 THEN 112140
+112140 LET v1 = 49
+112150 LET v1 = v1 * 3 + 12
+112160 LET t = t + v1 / 7
+112170 IF t < 0 THEN 112180
+112180 LET v2 = 53
+112190 LET v2 = v2 * 3 + 3
+112200 LET t = t + v2 / 7
+112210 IF t < 0 THEN 112220
+112220 LET v3 = 57
+112230 LET v3 = v3 * 3 + 7
+112240 LET t = t + v3 / 7
+112250 IF t < 0 THEN 112260
+112260 LET v4 = 61
+112270 LET v4 = v4 * 3 + 11
+112280 LET t = t + v4 / 7
+112290 IF t < 0 THEN 112300
+112300 LET v5 = 65
+112310 LET v5 = v5 * 3 + 2
+112320 LET t = t + v5 / 7
+112330 IF t < 0 THEN 112340
+112340 LET v6 = 69
+112350 LET v6 = v6 * 3 + 6
+112360 LET t = t + v6 / 7
+112370 IF t < 0 THEN 112380
+112380 LET v7 = 73
+112390 LET v7 = v7 * 3 + 10
+112400 LET t = t + v7 / 7
+112410 IF t < 0 THEN 112420
+112420 LET v8 = 77
+112430 LET v8 = v8 * 3 + 1
+112440 LET t = t + v8 / 7
+112450 IF t < 0 THEN 112460
+112460 LET v9 = 81
+112470 LET v9 = v9 * 3 + 5
+112480 LET t = t + v9 / 7
+112490 IF t < 0 THEN 112500
+112500 LET v10 = 85
+112510 LET v10 = v10 * 3 + 9
+112520 LET t = t + v10 / 7
+112530 IF t < 0 THEN 112540
+112540 LET v11 = 89
+112550 LET v11 = v11 * 3 + 0
+112560 LET t = t + v11 / 7
+112570 IF t < 0 THEN 112580
+112580 LET v12 = 93
+112590 LET v12 = v12 * 3 + 4
+112600 LET t = t + v12 / 7
+112610 IF t < 0 THEN 112620
+112620 LET v13 = 0
+112630 LET v13 = v13 * 3 + 8
+112640 LET t = t + v13 / 7
+112650 IF t < 0 THEN 112660
+112660 LET v14 = 4
+112670 LET v14 = v14 * 3 + 12
+112680 LET t = t + v14 / 7
+112690 IF t < 0 THEN 112700
+112700 LET v15 = 8
+112710 LET v15 = v15 * 3 + 3
+112720 LET t = t + v15 / 7
+112730 IF t < 0 THEN 112740
+112740 LET v16 = 12
+112750 LET v16 = v16 * 3 + 7
+112760 LET t = t + v16 / 7
+112770 IF t < 0 THEN 112780
+112780 LET v17 = 16
+112790 LET v17 = v17 * 3 + 11
+112800 LET t = t + v17 / 7
+112810 IF t < 0 THEN 112820
+112820 LET v18 = 20
+112830 LET v18 = v18 * 3 + 2
+112840 LET t = t + v18 / 7
+112850 IF t < 0 THEN 112860
+112860 LET v19 = 24
+112870 LET v19 = v19 * 3 + 6
+112880 LET t = t + v19 / 7
+112890 IF t < 0 THEN 112900
+112900 LET v20 = 28
+112910 LET v20 = v20 * 3 + 10
+112920 LET t = t + v20 / 7
+112930 IF t < 0 THEN 112940
+112940 LET v21 = 32
+112950 LET v21 = v21 * 3 + 1
+112960 LET t = t + v21 / 7
+112970 IF t < 0 THEN 112980
+112980 LET v22 = 36
+112990 LET v22 = v22 * 3 + 5
+113000 LET t = t + v22 / 7
+113010 IF t < 0 THEN 113020
+113020 LET v23 = 40
+113030 LET v23 = v23 * 3 + 9
+113040 LET t = t + v23 / 7
+113050 IF t < 0 THEN 113060
+113060 LET v24 = 44
+113070 LET v24 = v24 * 3 + 0
+113080 LET t = t + v24 / 7
+113090 IF t < 0 THEN 113100
+113100 LET v25 = 48
+113110 LET v25 = v25 * 3 + 4
+113120 LET t = t + v25 / 7
+113130 IF t < 0 THEN 113140
+113140 LET v26 = 52
+113150 LET v26 = v26 * 3 + 8
+113160 LET t = t + v26 / 7
+113170 IF t < 0 THEN 113180
+113180 LET v27 = 56
+113190 LET v27 = v27 * 3 + 12
+113200 LET t = t + v27 / 7
+113210 IF t < 0 THEN 113220
+113220 LET v28 = 60
+113230 LET v28 = v28 * 3 + 3
+113240 LET t = t + v28 / 7
+113250 IF t < 0 THEN 113260
+113260 LET v29 = 64
+113270 LET v29 = v29 * 3 + 7
+113280 LET t = t + v29 / 7
+113290 IF t < 0 THEN 113300
+113300 LET v30 = 68
+113310 LET v30 = v30 * 3 + 11
+113320 LET t = t + v30 / 7
+113330 IF t < 0 THEN 113340
+113340 LET v31 = 72
+113350 LET v31 = v31 * 3 + 2
+113360 LET t = t + v31 / 7
+113370 IF t < 0 THEN 113380
+113380 LET v32 = 76
+113390 LET v32 = v32 * 3 + 6
+113400 LET t = t + v32 / 7
+113410 IF t < 0 THEN 113420
+113420 LET v33 = 80
+113430 LET v33 = v33 * 3 + 10
+113440 LET t = t + v33 / 7
+113450 IF t < 0 THEN 113460
+113460 LET v34 = 84
+113470 LET v34 = v34 * 3 + 1
+113480 LET t = t + v34 / 7
+113490 IF t < 0 THEN 113500
+113500 LET v35 = 88
+113510 LET v35 = v35 * 3 + 5
+113520 LET t = t + v35 / 7
+113530 IF t < 0 THEN 113540
+113540 LET v36 = 92
+113550 LET v36 = v36 * 3 + 9
+113560 LET t = t + v36 / 7
+113570 IF t < 0 THEN 113580
+113580 LET v37 = 96
+113590 LET v37 = v37 * 3 + 0
+113600 LET t = t + v37 / 7
+113610 IF t < 0 THEN 113620
+113620 LET v38 = 3
+113630 LET v38 = v38 * 3 + 4
+113640 LET t = t + v38 / 7
+113650 IF t < 0 THEN 113660
+113660 LET v39 = 7
+113670 LET v39 = v39 * 3 + 8
+113680 LET t = t + v39 / 7
+113690 IF t < 0 THEN 113700
+113700 LET v40 = 11
+113710 LET v40 = v40 * 3 + 12
+113720 LET t = t + v40 / 7
+113730 IF t < 0 THEN 113740
+113740 LET v41 = 15
+113750 LET v41 = v41 * 3 + 3
+113760 LET t = t + v41 / 7
+113770 IF t < 0 THEN 113780
+113780 LET v42 = 19
+113790 LET v42 = v42 * 3 + 7
+113800 LET t = t + v42 / 7
+113810 IF t < 0 THEN 113820
+113820 LET v43 = 23
+113830 LET v43 = v43 * 3 + 11
+113840 LET t = t + v43 / 7
+113850 IF t < 0 THEN 113860
+113860 LET v44 = 27
+113870 LET v44 = v44 * 3 + 2
+113880 LET t = t + v44 / 7
+113890 IF t < 0 THEN 113900
+113900 LET v45 = 31
+113910 LET v45 = v45 * 3 + 6
+113920 LET t = t + v45 / 7
+113930 IF t < 0 THEN 113940
+113940 LET v46 = 35
+113950 LET v46 = v46 * 3 + 10
+113960 LET t = t + v46 / 7
+113970 IF t < 0 THEN 113980
+113980 LET v47 = 39
+113990 LET v47 = v47 * 3 + 1
+114000 LET t = t + v47 / 7
+114010 IF t < 0 THEN 114020
+114020 LET v48 = 43
+114030 LET v48 = v48 * 3 + 5
+114040 LET t = t + v48 / 7
+114050 IF t < 0 THEN 114060
+114060 LET v49 = 47
+114070 LET v49 = v49 * 3 + 9
+114080 LET t = t + v49 / 7
+114090 IF t < 0 THEN 114100
+114100 LET v0 = 51
+114110 LET v0 = v0 * 3 + 0
+114120 LET t = t + v0 / 7
+114130 IF t < 0 THEN 114140
+114140 LET v1 = 55
+114150 LET v1 = v1 * 3 + 4
+114160 LET t = t + v1 / 7
+114170 IF t < 0 THEN 114180
+114180 LET v2 = 59
+114190 LET v2 = v2 * 3 + 8
+114200 LET t = t + v2 / 7
+114210 IF t < 0 THEN 114220
+114220 LET v3 = 63
+114230 LET v3 = v3 * 3 + 12
+114240 LET t = t + v3 / 7
+114250 IF t < 0 THEN 114260
+114260 LET v4 = 67
+114270 LET v4 = v4 * 3 + 3
+114280 LET t = t + v4 / 7
+114290 IF t < 0 THEN 114300
+114300 LET v5 = 71
+114310 LET v5 = v5 * 3 + 7
+114320 LET t = t + v5 / 7
+114330 IF t < 0 THEN 114340
+114340 LET v6 = 75
+114350 LET v6 = v6 * 3 + 11
+114360 LET t = t + v6 / 7
+114370 IF t < 0 THEN 114380
+114380 LET v7 = 79
+114390 LET v7 = v7 * 3 + 2
+114400 LET t = t + v7 / 7
+114410 IF t < 0 THEN 114420
+114420 LET v8 = 83
+114430 LET v8 = v8 * 3 + 6
+114440 LET t = t + v8 / 7
+114450 IF t < 0 THEN 114460
+114460 LET v9 = 87
+114470 LET v9 = v9 * 3 + 10
+114480 LET t = t + v9 / 7
+114490 IF t < 0 THEN 114500
+114500 LET v10 = 91
+114510 LET v10 = v10 * 3 + 1
+114520 LET t = t + v10 / 7
+114530 IF t < 0 THEN 114540
+114540 LET v11 = 95
+114550 LET v11 = v11 * 3 + 5
+114560 LET t = t + v11 / 7
+114570 IF t < 0 THEN 114580
+114580 LET v12 = 2
+114590 LET v12 = v12 * 3 + 9
+114600 LET t = t + v12 / 7
+114610 IF t < 0 THEN 114620
+114620 LET v13 = 6
+114630 LET v13 = v13 * 3 + 0
+114640 LET t = t + v13 / 7
+114650 IF t < 0 THEN 114660
+114660 LET v14 = 10
+114670 LET v14 = v14 * 3 + 4
+114680 LET t = t + v14 / 7
+114690 IF t < 0 THEN 114700
+114700 LET v15 = 14
+114710 LET v15 = v15 * 3 + 8
+114720 LET t = t + v15 / 7
+114730 IF t < 0 THEN 114740
+114740 LET v16 = 18
+114750 LET v16 = v16 * 3 + 12
+114760 LET t = t + v16 / 7
+114770 IF t < 0 THEN 114780
+114780 LET v17 = 22
+114790 LET v17 = v17 * 3 + 3
+114800 LET t = t + v17 / 7
+114810 IF t < 0 THEN 114820
+114820 LET v18 = 26
+114830 LET v18 = v18 * 3 + 7
+114840 LET t = t + v18 / 7
+114850 IF t < 0 THEN 114860
+114860 LET v19 = 30
+114870 LET v19 = v19 * 3 + 11
+114880 LET t = t + v19 / 7
+114890 IF t < 0 THEN 114900
+114900 LET v20 = 34
+114910 LET v20 = v20 * 3 + 2
+114920 LET t = t + v20 / 7
+114930 IF t < 0 THEN 114940
+114940 LET v21 = 38
+114950 LET v21 = v21 * 3 + 6
+114960 LET t = t + v21 / 7
+114970 IF t < 0 THEN 114980
+114980 LET v22 = 42
+114990 LET v22 = v22 * 3 + 10
+115000 LET t = t + v22 / 7
+115010 IF t < 0 THEN 115020
+115020 LET v23 = 46
+115030 LET v23 = v23 * 3 + 1
+115040 LET t = t + v23 / 7
+115050 IF t < 0 THEN 115060
+115060 LET v24 = 50
+115070 LET v24 = v24 * 3 + 5
+115080 LET t = t + v24 / 7
+115090 IF t < 0 THEN 115100
+115100 LET v25 = 54
+115110 LET v25 = v25 * 3 + 9
+115120 LET t = t + v25 / 7
+115130 IF t < 0 THEN 115140
+115140 LET v26 = 58
+115150 LET v26 = v26 * 3 + 0
+115160 LET t = t + v26 / 7
+115170 IF t < 0 THEN 115180
+115180 LET v27 = 62
+115190 LET v27 = v27 * 3 + 4
+115200 LET t = t + v27 / 7
+115210 IF t < 0 THEN 115220
+115220 LET v28 = 66
+115230 LET v28 = v28 * 3 + 8
+115240 LET t = t + v28 / 7
+115250 IF t < 0 THEN 115260
+115260 LET v29 = 70
+115270 LET v29 = v29 * 3 + 12
+115280 LET t = t + v29 / 7
+115290 IF t < 0 THEN 115300
+115300 LET v30 = 74
+115310 LET v30 = v30 * 3 + 3
+115320 LET t = t + v30 / 7
+115330 IF t < 0 THEN 115340
+115340 LET v31 = 78
+115350 LET v31 = v31 * 3 + 7
+115360 LET t = t + v31 / 7
+115370 IF t < 0 THEN 115380
+115380 LET v32 = 82
+115390 LET v32 = v32 * 3 + 11
+115400 LET t = t + v32 / 7
+115410 IF t < 0 THEN 115420
+115420 LET v33 = 86
+115430 LET v33 = v33 * 3 + 2
+115440 LET t = t + v33 / 7
+115450 IF t < 0 THEN 115460
+115460 LET v34 = 90
+115470 LET v34 = v34 * 3 + 6
+115480 LET t = t + v34 / 7
+115490 IF t < 0 THEN 115500
+115500 LET v35 = 94
+115510 LET v35 = v35 * 3 + 10
+115520 LET t = t + v35 / 7
+115530 IF t < 0 THEN 115540
+115540 LET v36 = 1
+115550 LET v36 = v36 * 3 + 1
+115560 LET t = t + v36 / 7
+115570 IF t < 0 THEN 115580
+115580 LET v37 = 5
+115590 LET v37 = v37 * 3 + 5
+115600 LET t = t + v37 / 7
+115610 IF t < 0 THEN 115620
+115620 LET v38 = 9
+115630 LET v38 = v38 * 3 + 9
+115640 LET t = t + v38 / 7
+115650 IF t < 0 THEN 115660
+115660 LET v39 = 13
+115670 LET v39 = v39 * 3 + 0
+115680 LET t = t + v39 / 7
+115690 IF t < 0 THEN 115700
+115700 LET v40 = 17
+115710 LET v40 = v40 * 3 + 4
+115720 LET t = t + v40 / 7
+115730 IF t < 0 THEN 115740
+115740 LET v41 = 21
+115750 LET v41 = v41 * 3 + 8
+115760 LET t = t + v41 / 7
+115770 IF t < 0 THEN 115780
+115780 LET v42 = 25
+115790 LET v42 = v42 * 3 + 12
+115800 LET t = t + v42 / 7
+115810 IF t < 0 THEN 115820
+115820 LET v43 = 29
+115830 LET v43 = v43 * 3 + 3
+115840 LET t = t + v43 / 7
+115850 IF t < 0 THEN 115860
+115860 LET v44 = 33
+115870 LET v44 = v44 * 3 + 7
+115880 LET t = t + v44 / 7
+115890 IF t < 0 THEN 115900
+115900 LET v45 = 37
+115910 LET v45 = v45 * 3 + 11
+115920 LET t = t + v45 / 7
+115930 IF t < 0 THEN 115940
+115940 LET v46 = 41
+115950 LET v46 = v46 * 3 + 2
+115960 LET t = t + v46 / 7
+115970 IF t < 0 THEN 115980
+115980 LET v47 = 45
+115990 LET v47 = v47 * 3 + 6
+116000 LET t = t + v47 / 7
+116010 IF t < 0 THEN 116020
+116020 LET v48 = 49
+116030 LET v48 = v48 * 3 + 10
+116040 LET t = t + v48 / 7
+116050 IF t < 0 THEN 116060
+116060 LET v49 = 53
+116070 LET v49 = v49 * 3 + 1
+116080 LET t = t + v49 / 7
+116090 IF t < 0 THEN 116100
+116100 LET v0 = 57
+116110 LET v0 = v0 * 3 + 5
+116120 LET t = t + v0 / 7
+116130 IF t < 0 THEN 116140
+116140 LET v1 = 61
+116150 LET v1 = v1 * 3 + 9
+116160 LET t = t + v1 / 7
+116170 IF t < 0 THEN 116180
+116180 LET v2 = 65
+116190 LET v2 = v2 * 3 + 0
+116200 LET t = t + v2 / 7
+116210 IF t < 0 THEN 116220
+116220 LET v3 = 69
+116230 LET v3 = v3 * 3 + 4
+116240 LET t = t + v3 / 7
+116250 IF t < 0 THEN 116260
+116260 LET v4 = 73
+116270 LET v4 = v4 * 3 + 8
+116280 LET t = t + v4 / 7
+116290 IF t < 0 THEN 116300
+116300 LET v5 = 77
+116310 LET v5 = v5 * 3 + 12
+116320 LET t = t + v5 / 7
+116330 IF t < 0 THEN 116340
+116340 LET v6 = 81
+116350 LET v6 = v6 * 3 + 3
+116360 LET t = t + v6 / 7
+116370 IF t < 0 THEN 116380
+116380 LET v7 = 85
+116390 LET v7 = v7 * 3 + 7
+116400 LET t = t + v7 / 7
+116410 IF t < 0 THEN 116420
+116420 LET v8 = 89
+116430 LET v8 = v8 * 3 + 11
+116440 LET t = t + v8 / 7
+116450 IF t < 0 THEN 116460
+116460 LET v9 = 93
+116470 LET v9 = v9 * 3 + 2
+116480 LET t = t + v9 / 7
+116490 IF t < 0 THEN 116500
+116500 LET v10 = 0
+116510 LET v10 = v10 * 3 + 6
+116520 LET t = t + v10 / 7
+116530 IF t < 0 THEN 116540
+116540 LET v11 = 4
+116550 LET v11 = v11 * 3 + 10
+116560 LET t = t + v11 / 7
+116570 IF t < 0 THEN 116580
+116580 LET v12 = 8
+116590 LET v12 = v12 * 3 + 1
+116600 LET t = t + v12 / 7
+116610 IF t < 0 THEN 116620
+116620 LET v13 = 12
+116630 LET v13 = v13 * 3 + 5
+116640 LET t = t + v13 / 7
+116650 IF t < 0 THEN 116660
+116660 LET v14 = 16
+116670 LET v14 = v14 * 3 + 9
+116680 LET t = t + v14 / 7
+116690 IF t < 0 THEN 116700
+116700 LET v15 = 20
+116710 LET v15 = v15 * 3 + 0
+116720 LET t = t + v15 / 7
+116730 IF t < 0 THEN 116740
+116740 LET v16 = 24
+116750 LET v16 = v16 * 3 + 4
+116760 LET t = t + v16 / 7
+116770 IF t < 0 THEN 116780
+116780 LET v17 = 28
+116790 LET v17 = v17 * 3 + 8
+116800 LET t = t + v17 / 7
+116810 IF t < 0 THEN 116820
+116820 LET v18 = 32
+116830 LET v18 = v18 * 3 + 12
+116840 LET t = t + v18 / 7
+116850 IF t < 0 THEN 116860
+116860 LET v19 = 36
+116870 LET v19 = v19 * 3 + 3
+116880 LET t = t + v19 / 7
+116890 IF t < 0 THEN 116900
+116900 LET v20 = 40
+116910 LET v20 = v20 * 3 + 7
+116920 LET t = t + v20 / 7
+116930 IF t < 0 THEN 116940
+116940 LET v21 = 44
+116950 LET v21 = v21 * 3 + 11
+116960 LET t = t + v21 / 7
+116970 IF t < 0 THEN 116980
+116980 LET v22 = 48
+116990 LET v22 = v22 * 3 + 2
+117000 LET t = t + v22 / 7
+117010 IF t < 0 THEN 117020
+117020 LET v23 = 52
+117030 LET v23 = v23 * 3 + 6
+117040 LET t = t + v23 / 7
+117050 IF t < 0 THEN 117060
+117060 LET v24 = 56
+117070 LET v24 = v24 * 3 + 10
+117080 LET t = t + v24 / 7
+117090 IF t < 0 THEN 117100
+117100 LET v25 = 60
+117110 LET v25 = v25 * 3 + 1
+117120 LET t = t + v25 / 7
+117130 IF t < 0 THEN 117140
+117140 LET v26 = 64
+117150 LET v26 = v26 * 3 + 5
+117160 LET t = t + v26 / 7
+117170 IF t < 0 THEN 117180
+117180 LET v27 = 68
+117190 LET v27 = v27 * 3 + 9
+117200 LET t = t + v27 / 7
+117210 IF t < 0 THEN 117220
+117220 LET v28 = 72
+117230 LET v28 = v28 * 3 + 0
+117240 LET t = t + v28 / 7
+117250 IF t < 0 THEN 117260
+117260 LET v29 = 76
+117270 LET v29 = v29 * 3 + 4
+117280 LET t = t + v29 / 7
+117290 IF t < 0 THEN 117300
+117300 LET v30 = 80
+117310 LET v30 = v30 * 3 + 8
+117320 LET t = t + v30 / 7
+117330 IF t < 0 THEN 117340
+117340 LET v31 = 84
+117350 LET v31 = v31 * 3 + 12
+117360 LET t = t + v31 / 7
+117370 IF t < 0 THEN 117380
+117380 LET v32 = 88
+117390 LET v32 = v32 * 3 + 3
+117400 LET t = t + v32 / 7
+117410 IF t < 0 THEN 117420
+117420 LET v33 = 92
+117430 LET v33 = v33 * 3 + 7
+117440 LET t = t + v33 / 7
+117450 IF t < 0 THEN 117460
+117460 LET v34 = 96
+117470 LET v34 = v34 * 3 + 11
+117480 LET t = t + v34 / 7
+117490 IF t < 0 THEN 117500
+117500 LET v35 = 3
+117510 LET v35 = v35 * 3 + 2
+117520 LET t = t + v35 / 7
+117530 IF t < 0 THEN 117540
+117540 LET v36 = 7
+117550 LET v36 = v36 * 3 + 6
+117560 LET t = t + v36 / 7
+117570 IF t < 0 THEN 117580
+117580 LET v37 = 11
+117590 LET v37 = v37 * 3 + 10
+117600 LET t = t + v37 / 7
+117610 IF t < 0 THEN 117620
+117620 LET v38 = 15
+117630 LET v38 = v38 * 3 + 1
+117640 LET t = t + v38 / 7
+117650 IF t < 0 THEN 117660
+117660 LET v39 = 19
+117670 LET v39 = v39 * 3 + 5
+117680 LET t = t + v39 / 7
+117690 IF t < 0 THEN 117700
+117700 LET v40 = 23
+117710 LET v40 = v40 * 3 + 9
+117720 LET t = t + v40 / 7
+117730 IF t < 0 THEN 117740
+117740 LET v41 = 27
+117750 LET v41 = v41 * 3 + 0
+117760 LET t = t + v41 / 7
+117770 IF t < 0 THEN 117780
+117780 LET v42 = 31
+117790 LET v42 = v42 * 3 + 4
+117800 LET t = t + v42 / 7
+117810 IF t < 0 THEN 117820
+117820 LET v43 = 35
+117830 LET v43 = v43 * 3 + 8
+117840 LET t = t + v43 / 7
+117850 IF t < 0 THEN 117860
+117860 LET v44 = 39
+117870 LET v44 = v44 * 3 + 12
+117880 LET t = t + v44 / 7
+117890 IF t < 0 THEN 117900
+117900 LET v45 = 43
+117910 LET v45 = v45 * 3 + 3
+117920 LET t = t + v45 / 7
+117930 IF t < 0 THEN 117940
+117940 LET v46 = 47
+117950 LET v46 = v46 * 3 + 7
+117960 LET t = t + v46 / 7
+117970 IF t < 0 THEN 117980
+117980 LET v47 = 51
+117990 LET v47 = v47 * 3 + 11
+118000 LET t = t + v47 / 7
+118010 IF t < 0 THEN 118020
+118020 LET v48 = 55
+118030 LET v48 = v48 * 3 + 2
+118040 LET t = t + v48 / 7
+118050 IF t < 0 THEN 118060
+118060 LET v49 = 59
+118070 LET v49 = v49 * 3 + 6
+118080 LET t = t + v49 / 7
+118090 IF t < 0 THEN 118100
+118100 LET v0 = 63
+118110 LET v0 = v0 * 3 + 10
+118120 LET t = t + v0 / 7
+118130 IF t < 0 THEN 118140
+118140 LET v1 = 67
+118150 LET v1 = v1 * 3 + 1
+118160 LET t = t + v1 / 7
+118170 IF t < 0 THEN 118180
+118180 LET v2 = 71
+118190 LET v2 = v2 * 3 + 5
+118200 LET t = t + v2 / 7
+118210 IF t < 0 THEN 118220
+118220 LET v3 = 75
+118230 LET v3 = v3 * 3 + 9
+118240 LET t = t + v3 / 7
+118250 IF t < 0 THEN 118260
+118260 LET v4 = 79
+118270 LET v4 = v4 * 3 + 0
+118280 LET t = t + v4 / 7
+118290 IF t < 0 THEN 118300
+118300 LET v5 = 83
+118310 LET v5 = v5 * 3 + 4
+118320 LET t = t + v5 / 7
+118330 IF t < 0 THEN 118340
+118340 LET v6 = 87
+118350 LET v6 = v6 * 3 + 8
+118360 LET t = t + v6 / 7
+118370 IF t < 0 THEN 118380
+118380 LET v7 = 91
+118390 LET v7 = v7 * 3 + 12
+118400 LET t = t + v7 / 7
+118410 IF t < 0 THEN 118420
+118420 LET v8 = 95
+118430 LET v8 = v8 * 3 + 3
+118440 LET t = t + v8 / 7
+118450 IF t < 0 THEN 118460
+118460 LET v9 = 2
+118470 LET v9 = v9 * 3 + 7
+118480 LET t = t + v9 / 7
+118490 IF t < 0 THEN 118500
+118500 LET v10 = 6
+118510 LET v10 = v10 * 3 + 11
+118520 LET t = t + v10 / 7
+118530 IF t < 0 THEN 118540
+118540 LET v11 = 10
+118550 LET v11 = v11 * 3 + 2
+118560 LET t = t + v11 / 7
+118570 IF t < 0 THEN 118580
+118580 LET v12 = 14
+118590 LET v12 = v12 * 3 + 6
+118600 LET t = t + v12 / 7
+118610 IF t < 0 THEN 118620
+118620 LET v13 = 18
+118630 LET v13 = v13 * 3 + 10
+118640 LET t = t + v13 / 7
+118650 IF t < 0 THEN 118660
+118660 LET v14 = 22
+118670 LET v14 = v14 * 3 + 1
+118680 LET t = t + v14 / 7
+118690 IF t < 0 THEN 118700
+118700 LET v15 = 26
+118710 LET v15 = v15 * 3 + 5
+118720 LET t = t + v15 / 7
+118730 IF t < 0 THEN 118740
+118740 LET v16 = 30
+118750 LET v16 = v16 * 3 + 9
+118760 LET t = t + v16 / 7
+118770 IF t < 0 THEN 118780
+118780 LET v17 = 34
+118790 LET v17 = v17 * 3 + 0
+118800 LET t = t + v17 / 7
+118810 IF t < 0 THEN 118820
+118820 LET v18 = 38
+118830 LET v18 = v18 * 3 + 4
+118840 LET t = t + v18 / 7
+118850 IF t < 0 THEN 118860
+118860 LET v19 = 42
+118870 LET v19 = v19 * 3 + 8
+118880 LET t = t + v19 / 7
+118890 IF t < 0 THEN 118900
+118900 LET v20 = 46
+118910 LET v20 = v20 * 3 + 12
+118920 LET t = t + v20 / 7
+118930 IF t < 0 THEN 118940
+118940 LET v21 = 50
+118950 LET v21 = v21 * 3 + 3
+118960 LET t = t + v21 / 7
+118970 IF t < 0 THEN 118980
+118980 LET v22 = 54
+118990 LET v22 = v22 * 3 + 7
+119000 LET t = t + v22 / 7
+119010 IF t < 0 THEN 119020
+119020 LET v23 = 58
+119030 LET v23 = v23 * 3 + 11
+119040 LET t = t + v23 / 7
+119050 IF t < 0 THEN 119060
+119060 LET v24 = 62
+119070 LET v24 = v24 * 3 + 2
+119080 LET t = t + v24 / 7
+119090 IF t < 0 THEN 119100
+119100 LET v25 = 66
+119110 LET v25 = v25 * 3 + 6
+119120 LET t = t + v25 / 7
+119130 IF t < 0 THEN 119140
+119140 LET v26 = 70
+119150 LET v26 = v26 * 3 + 10
+119160 LET t = t + v26 / 7
+119170 IF t < 0 THEN 119180
+119180 LET v27 = 74
+119190 LET v27 = v27 * 3 + 1
+119200 LET t = t + v27 / 7
+119210 IF t < 0 THEN 119220
+119220 LET v28 = 78
+119230 LET v28 = v28 * 3 + 5
+119240 LET t = t + v28 / 7
+119250 IF t < 0 THEN 119260
+119260 LET v29 = 82
+119270 LET v29 = v29 * 3 + 9
+119280 LET t = t + v29 / 7
+119290 IF t < 0 THEN 119300
+119300 LET v30 = 86
+119310 LET v30 = v30 * 3 + 0
+119320 LET t = t + v30 / 7
+119330 IF t < 0 THEN 119340
+119340 LET v31 = 90
+119350 LET v31 = v31 * 3 + 4
+119360 LET t = t + v31 / 7
+119370 IF t < 0 THEN 119380
+119380 LET v32 = 94
+119390 LET v32 = v32 * 3 + 8
+119400 LET t = t + v32 / 7
+119410 IF t < 0 THEN 119420
+119420 LET v33 = 1
+119430 LET v33 = v33 * 3 + 12
+119440 LET t = t + v33 / 7
+119450 IF t < 0 THEN 119460
+119460 LET v34 = 5
+119470 LET v34 = v34 * 3 + 3
+119480 LET t = t + v34 / 7
+119490 IF t < 0 THEN 119500
+119500 LET v35 = 9
+119510 LET v35 = v35 * 3 + 7
+119520 LET t = t + v35 / 7
+119530 IF t < 0 THEN 119540
+119540 LET v36 = 13
+119550 LET v36 = v36 * 3 + 11
+119560 LET t = t + v36 / 7
+119570 IF t < 0 THEN 119580
+119580 LET v37 = 17
+119590 LET v37 = v37 * 3 + 2
+119600 LET t = t + v37 / 7
+119610 IF t < 0 THEN 119620
+119620 LET v38 = 21
+119630 LET v38 = v38 * 3 + 6
+119640 LET t = t + v38 / 7
+119650 IF t < 0 THEN 119660
+119660 LET v39 = 25
+119670 LET v39 = v39 * 3 + 10
+119680 LET t = t + v39 / 7
+119690 IF t < 0 THEN 119700
+119700 LET v40 = 29
+119710 LET v40 = v40 * 3 + 1
+119720 LET t = t + v40 / 7
+119730 IF t < 0 THEN 119740
+119740 LET v41 = 33
+119750 LET v41 = v41 * 3 + 5
+119760 LET t = t + v41 / 7
+119770 IF t < 0 THEN 119780
+119780 LET v42 = 37
+119790 LET v42 = v42 * 3 + 9
+119800 LET t = t + v42 / 7
+119810 IF t < 0 THEN 119820
+119820 LET v43 = 41
+119830 LET v43 = v43 * 3 + 0
+119840 LET t = t + v43 / 7
+119850 IF t < 0 THEN 119860
+119860 LET v44 = 45
+119870 LET v44 = v44 * 3 + 4
+119880 LET t = t + v44 / 7
+119890 IF t < 0 THEN 119900
+119900 LET v45 = 49
+119910 LET v45 = v45 * 3 + 8
+119920 LET t = t + v45 / 7
+119930 IF t < 0 THEN 119940
+119940 LET v46 = 53
+119950 LET v46 = v46 * 3 + 12
+119960 LET t = t + v46 / 7
+119970 IF t < 0 THEN 119980
+119980 LET v47 = 57
+119990 LET v47 = v47 * 3 + 3
+120000 LET t = t + v47 / 7
+120010 IF t < 0 THEN 120020
+120020 LET v48 = 61
+120030 LET v48 = v48 * 3 + 7
+120040 LET t = t + v48 / 7
+120050 IF t < 0 THEN 120060
+120060 LET v49 = 65
+120070 LET v49 = v49 * 3 + 11
+120080 LET t = t + v49 / 7
+120090 IF t < 0 THEN 120100
+120100 LET v0 = 69
+120110 LET v0 = v0 * 3 + 2
+120120 LET t = t + v0 / 7
+120130 IF t < 0 THEN 120140
+120140 LET v1 = 73
+120150 LET v1 = v1 * 3 + 6
+120160 LET t = t + v1 / 7
+120170 IF t < 0 THEN 120180
+120180 LET v2 = 77
+120190 LET v2 = v2 * 3 + 10
+120200 LET t = t + v2 / 7
+120210 IF t < 0 THEN 120220
+120220 LET v3 = 81
+120230 LET v3 = v3 * 3 + 1
+120240 LET t = t + v3 / 7
+120250 IF t < 0 THEN 120260
+120260 LET v4 = 85
+120270 LET v4 = v4 * 3 + 5
+120280 LET t = t + v4 / 7
+120290 IF t < 0 THEN 120300
+120300 LET v5 = 89
+120310 LET v5 = v5 * 3 + 9
+120320 LET t = t + v5 / 7
+120330 IF t < 0 THEN 120340
+120340 LET v6 = 93
+120350 LET v6 = v6 * 3 + 0
+120360 LET t = t + v6 / 7
+120370 IF t < 0 THEN 120380
+120380 LET v7 = 0
+120390 LET v7 = v7 * 3 + 4
+120400 LET t = t + v7 / 7
+120410 IF t < 0 THEN 120420
+120420 LET v8 = 4
+120430 LET v8 = v8 * 3 + 8
+120440 LET t = t + v8 / 7
+120450 IF t < 0 THEN 120460
+120460 LET v9 = 8
+120470 LET v9 = v9 * 3 + 12
+120480 LET t = t + v9 / 7
+120490 IF t < 0 THEN 120500
+120500 LET v10 = 12
+120510 LET v10 = v10 * 3 + 3
+120520 LET t = t + v10 / 7
+120530 IF t < 0 THEN 120540
+120540 LET v11 = 16
+120550 LET v11 = v11 * 3 + 7
+120560 LET t = t + v11 / 7
+120570 IF t < 0 THEN 120580
+120580 LET v12 = 20
+120590 LET v12 = v12 * 3 + 11
+120600 LET t = t + v12 / 7
+120610 IF t < 0 THEN 120620
+120620 LET v13 = 24
+120630 LET v13 = v13 * 3 + 2
+120640 LET t = t + v13 / 7
+120650 IF t < 0 THEN 120660
+120660 LET v14 = 28
+120670 LET v14 = v14 * 3 + 6
+120680 LET t = t + v14 / 7
+120690 IF t < 0 THEN 120700
+120700 LET v15 = 32
+120710 LET v15 = v15 * 3 + 10
+120720 LET t = t + v15 / 7
+120730 IF t < 0 THEN 120740
+120740 LET v16 = 36
+120750 LET v16 = v16 * 3 + 1
+120760 LET t = t + v16 / 7
+120770 IF t < 0 THEN 120780
+120780 LET v17 = 40
+120790 LET v17 = v17 * 3 + 5
+120800 LET t = t + v17 / 7
+120810 IF t < 0 THEN 120820
+120820 LET v18 = 44
+120830 LET v18 = v18 * 3 + 9
+120840 LET t = t + v18 / 7
+120850 IF t < 0 THEN 120860
+120860 LET v19 = 48
+120870 LET v19 = v19 * 3 + 0
+120880 LET t = t + v19 / 7
+120890 IF t < 0 THEN 120900
+120900 LET v20 = 52
+120910 LET v20 = v20 * 3 + 4
+120920 LET t = t + v20 / 7
+120930 IF t < 0 THEN 120940
+120940 LET v21 = 56
+120950 LET v21 = v21 * 3 + 8
+120960 LET t = t + v21 / 7
+120970 IF t < 0 THEN 120980
+120980 LET v22 = 60
+120990 LET v22 = v22 * 3 + 12
+121000 LET t = t + v22 / 7
+121010 IF t < 0 THEN 121020
+121020 LET v23 = 64
+121030 LET v23 = v23 * 3 + 3
+121040 LET t = t + v23 / 7
+121050 IF t < 0 THEN 121060
+121060 LET v24 = 68
+121070 LET v24 = v24 * 3 + 7
+121080 LET t = t + v24 / 7
+121090 IF t < 0 THEN 121100
+121100 LET v25 = 72
+121110 LET v25 = v25 * 3 + 11
+121120 LET t = t + v25 / 7
+121130 IF t < 0 THEN 121140
+121140 LET v26 = 76
+121150 LET v26 = v26 * 3 + 2
+121160 LET t = t + v26 / 7
+121170 IF t < 0 THEN 121180
+121180 LET v27 = 80
+121190 LET v27 = v27 * 3 + 6
+121200 LET t = t + v27 / 7
+121210 IF t < 0 THEN 121220
+121220 LET v28 = 84
+121230 LET v28 = v28 * 3 + 10
+121240 LET t = t + v28 / 7
+121250 IF t < 0 THEN 121260
+121260 LET v29 = 88
+121270 LET v29 = v29 * 3 + 1
+121280 LET t = t + v29 / 7
+121290 IF t < 0 THEN 121300
+121300 LET v30 = 92
+121310 LET v30 = v30 * 3 + 5
+121320 LET t = t + v30 / 7
+121330 IF t < 0 THEN 121340
+121340 LET v31 = 96
+121350 LET v31 = v31 * 3 + 9
+121360 LET t = t + v31 / 7
+121370 IF t < 0 THEN 121380
+121380 LET v32 = 3
+121390 LET v32 = v32 * 3 + 0
+121400 LET t = t + v32 / 7
+121410 IF t < 0 THEN 121420
+121420 LET v33 = 7
+121430 LET v33 = v33 * 3 + 4
+121440 LET t = t + v33 / 7
+121450 IF t < 0 THEN 121460
+121460 LET v34 = 11
+121470 LET v34 = v34 * 3 + 8
+121480 LET t = t + v34 / 7
+121490 IF t < 0 THEN 121500
+121500 LET v35 = 15
+121510 LET v35 = v35 * 3 + 12
+121520 LET t = t + v35 / 7
+121530 IF t < 0 THEN 121540
+121540 LET v36 = 19
+121550 LET v36 = v36 * 3 + 3
+121560 LET t = t + v36 / 7
+121570 IF t < 0 THEN 121580
+121580 LET v37 = 23
+121590 LET v37 = v37 * 3 + 7
+121600 LET t = t + v37 / 7
+121610 IF t < 0 THEN 121620
+121620 LET v38 = 27
+121630 LET v38 = v38 * 3 + 11
+121640 LET t = t + v38 / 7
+121650 IF t < 0 THEN 121660
+121660 LET v39 = 31
+121670 LET v39 = v39 * 3 + 2
+121680 LET t = t + v39 / 7
+121690 IF t < 0 THEN 121700
+121700 LET v40 = 35
+121710 LET v40 = v40 * 3 + 6
+121720 LET t = t + v40 / 7
+121730 IF t < 0 THEN 121740
+121740 LET v41 = 39
+121750 LET v41 = v41 * 3 + 10
+121760 LET t = t + v41 / 7
+121770 IF t < 0 THEN 121780
+121780 LET v42 = 43
+121790 LET v42 = v42 * 3 + 1
+121800 LET t = t + v42 / 7
+121810 IF t < 0 THEN 121820
+121820 LET v43 = 47
+121830 LET v43 = v43 * 3 + 5
+121840 LET t = t + v43 / 7
+121850 IF t < 0 THEN 121860
+121860 LET v44 = 51
+121870 LET v44 = v44 * 3 + 9
+121880 LET t = t + v44 / 7
+121890 IF t < 0 THEN 121900
+121900 LET v45 = 55
+121910 LET v45 = v45 * 3 + 0
+121920 LET t = t + v45 / 7
+121930 IF t < 0 THEN 121940
+121940 LET v46 = 59
+121950 LET v46 = v46 * 3 + 4
+121960 LET t = t + v46 / 7
+121970 IF t < 0 THEN 121980
+121980 LET v47 = 63
+121990 LET v47 = v47 * 3 + 8
+122000 LET t = t + v47 / 7
+122010 IF t < 0 THEN 122020
+122020 LET v48 = 67
+122030 LET v48 = v48 * 3 + 12
+122040 LET t = t + v48 / 7
+122050 IF t < 0 THEN 122060
+122060 LET v49 = 71
+122070 LET v49 = v49 * 3 + 3
+122080 LET t = t + v49 / 7
+122090 IF t < 0 THEN 122100
+122100 LET v0 = 75
+122110 LET v0 = v0 * 3 + 7
+122120 LET t = t + v0 / 7
+122130 IF t < 0 THEN 122140
+122140 LET v1 = 79
+122150 LET v1 = v1 * 3 + 11
+122160 LET t = t + v1 / 7
+122170 IF t < 0 THEN 122180
+122180 LET v2 = 83
+122190 LET v2 = v2 * 3 + 2
+122200 LET t = t + v2 / 7
+122210 IF t < 0 THEN 122220
+122220 LET v3 = 87
+122230 LET v3 = v3 * 3 + 6
+122240 LET t = t + v3 / 7
+122250 IF t < 0 THEN 122260
+122260 LET v4 = 91
+122270 LET v4 = v4 * 3 + 10
+122280 LET t = t + v4 / 7
+122290 IF t < 0 THEN 122300
+122300 LET v5 = 95
+122310 LET v5 = v5 * 3 + 1
+122320 LET t = t + v5 / 7
+122330 IF t < 0 THEN 122340
+122340 LET v6 = 2
+122350 LET v6 = v6 * 3 + 5
+122360 LET t = t + v6 / 7
+122370 IF t < 0 THEN 122380
+122380 LET v7 = 6
+122390 LET v7 = v7 * 3 + 9
+122400 LET t = t + v7 / 7
+122410 IF t < 0 THEN 122420
+122420 LET v8 = 10
+122430 LET v8 = v8 * 3 + 0
+122440 LET t = t + v8 / 7
+122450 IF t < 0 THEN 122460
+122460 LET v9 = 14
+122470 LET v9 = v9 * 3 + 4
+122480 LET t = t + v9 / 7
+122490 IF t < 0 THEN 122500
+122500 LET v10 = 18
+122510 LET v10 = v10 * 3 + 8
+122520 LET t = t + v10 / 7
+122530 IF t < 0 THEN 122540
+122540 LET v11 = 22
+122550 LET v11 = v11 * 3 + 12
+122560 LET t = t + v11 / 7
+122570 IF t < 0 THEN 122580
+122580 LET v12 = 26
+122590 LET v12 = v12 * 3 + 3
+122600 LET t = t + v12 / 7
+122610 IF t < 0 THEN 122620
+122620 LET v13 = 30
+122630 LET v13 = v13 * 3 + 7
+122640 LET t = t + v13 / 7
+122650 IF t < 0 THEN 122660
+122660 LET v14 = 34
+122670 LET v14 = v14 * 3 + 11
+122680 LET t = t + v14 / 7
+122690 IF t < 0 THEN 122700
+122700 LET v15 = 38
+122710 LET v15 = v15 * 3 + 2
+122720 LET t = t + v15 / 7
+122730 IF t < 0 THEN 122740
+122740 LET v16 = 42
+122750 LET v16 = v16 * 3 + 6
+122760 LET t = t + v16 / 7
+122770 IF t < 0 THEN 122780
+122780 LET v17 = 46
+122790 LET v17 = v17 * 3 + 10
+122800 LET t = t + v17 / 7
+122810 IF t < 0 THEN 122820
+122820 LET v18 = 50
+122830 LET v18 = v18 * 3 + 1
+122840 LET t = t + v18 / 7
+122850 IF t < 0 THEN 122860
+122860 LET v19 = 54
+122870 LET v19 = v19 * 3 + 5
+122880 LET t = t + v19 / 7
+122890 IF t < 0 THEN 122900
+122900 LET v20 = 58
+122910 LET v20 = v20 * 3 + 9
+122920 LET t = t + v20 / 7
+122930 IF t < 0 THEN 122940
+122940 LET v21 = 62
+122950 LET v21 = v21 * 3 + 0
+122960 LET t = t + v21 / 7
+122970 IF t < 0 THEN 122980
+122980 LET v22 = 66
+122990 LET v22 = v22 * 3 + 4
+123000 LET t = t + v22 / 7
+123010 IF t < 0 THEN 123020
+123020 LET v23 = 70
+123030 LET v23 = v23 * 3 + 8
+123040 LET t = t + v23 / 7
+123050 IF t < 0 THEN 123060
+123060 LET v24 = 74
+123070 LET v24 = v24 * 3 + 12
+123080 LET t = t + v24 / 7
+123090 IF t < 0 THEN 123100
+123100 LET v25 = 78
+123110 LET v25 = v25 * 3 + 3
+123120 LET t = t + v25 / 7
+123130 IF t < 0 THEN 123140
+123140 LET v26 = 82
+123150 LET v26 = v26 * 3 + 7
+123160 LET t = t + v26 / 7
+123170 IF t < 0 THEN 123180
+123180 LET v27 = 86
+123190 LET v27 = v27 * 3 + 11
+123200 LET t = t + v27 / 7
+123210 IF t < 0 THEN 123220
+123220 LET v28 = 90
+123230 LET v28 = v28 * 3 + 2
+123240 LET t = t + v28 / 7
+123250 IF t < 0 THEN 123260
+123260 LET v29 = 94
+123270 LET v29 = v29 * 3 + 6
+123280 LET t = t + v29 / 7
+123290 IF t < 0 THEN 123300
+123300 LET v30 = 1
+123310 LET v30 = v30 * 3 + 10
+123320 LET t = t + v30 / 7
+123330 IF t < 0 THEN 123340
+123340 LET v31 = 5
+123350 LET v31 = v31 * 3 + 1
+123360 LET t = t + v31 / 7
+123370 IF t < 0 THEN 123380
+123380 LET v32 = 9
+123390 LET v32 = v32 * 3 + 5
+123400 LET t = t + v32 / 7
+123410 IF t < 0 THEN 123420
+123420 LET v33 = 13
+123430 LET v33 = v33 * 3 + 9
+123440 LET t = t + v33 / 7
+123450 IF t < 0 THEN 123460
+123460 LET v34 = 17
+123470 LET v34 = v34 * 3 + 0
+123480 LET t = t + v34 / 7
+123490 IF t < 0 THEN 123500
+123500 LET v35 = 21
+123510 LET v35 = v35 * 3 + 4
+123520 LET t = t + v35 / 7
+123530 IF t < 0 THEN 123540
+123540 LET v36 = 25
+123550 LET v36 = v36 * 3 + 8
+123560 LET t = t + v36 / 7
+123570 IF t < 0 THEN 123580
+123580 LET v37 = 29
+123590 LET v37 = v37 * 3 + 12
+123600 LET t = t + v37 / 7
+123610 IF t < 0 THEN 123620
+123620 LET v38 = 33
+123630 LET v38 = v38 * 3 + 3
+123640 LET t = t + v38 / 7
+123650 IF t < 0 THEN 123660
+123660 LET v39 = 37
+123670 LET v39 = v39 * 3 + 7
+123680 LET t = t + v39 / 7
+123690 IF t < 0 THEN 123700
+123700 LET v40 = 41
+123710 LET v40 = v40 * 3 + 11
+123720 LET t = t + v40 / 7
+123730 IF t < 0 THEN 123740
+123740 LET v41 = 45
+123750 LET v41 = v41 * 3 + 2
+123760 LET t = t + v41 / 7
+123770 IF t < 0 THEN 123780
+123780 LET v42 = 49
+123790 LET v42 = v42 * 3 + 6
+123800 LET t = t + v42 / 7
+123810 IF t < 0 THEN 123820
+123820 LET v43 = 53
+123830 LET v43 = v43 * 3 + 10
+123840 LET t = t + v43 / 7
+123850 IF t < 0 THEN 123860
+123860 LET v44 = 57
+123870 LET v44 = v44 * 3 + 1
+123880 LET t = t + v44 / 7
+123890 IF t < 0 THEN 123900
+123900 LET v45 = 61
+123910 LET v45 = v45 * 3 + 5
+123920 LET t = t + v45 / 7
+123930 IF t < 0 THEN 123940
+123940 LET v46 = 65
+123950 LET v46 = v46 * 3 + 9
+123960 LET t = t + v46 / 7
+123970 IF t < 0 THEN 123980
+123980 LET v47 = 69
+123990 LET v47 = v47 * 3 + 0
+124000 LET t = t + v47 / 7
+124010 IF t < 0 THEN 124020
+124020 LET v48 = 73
+124030 LET v48 = v48 * 3 + 4
+124040 LET t = t + v48 / 7
+124050 IF t < 0 THEN 124060
+124060 LET v49 = 77
+124070 LET v49 = v49 * 3 + 8
+124080 LET t = t + v49 / 7
+124090 IF t < 0 THEN 124100
+124100 LET v0 = 81
+124110 LET v0 = v0 * 3 + 12
+124120 LET t = t + v0 / 7
+124130 IF t < 0 THEN 124140
+124140 LET v1 = 85
+124150 LET v1 = v1 * 3 + 3
+124160 LET t = t + v1 / 7
+124170 IF t < 0 THEN 124180
+124180 LET v2 = 89
+124190 LET v2 = v2 * 3 + 7
+124200 LET t = t + v2 / 7
+124210 IF t < 0 THEN 124220
+124220 LET v3 = 93
+124230 LET v3 = v3 * 3 + 11
+124240 LET t = t + v3 / 7
+124250 IF t < 0 THEN 124260
+124260 LET v4 = 0
+124270 LET v4 = v4 * 3 + 2
+124280 LET t = t + v4 / 7
+124290 IF t < 0 THEN 124300
+124300 LET v5 = 4
+124310 LET v5 = v5 * 3 + 6
+124320 LET t = t + v5 / 7
+124330 IF t < 0 THEN 124340
+124340 LET v6 = 8
+124350 LET v6 = v6 * 3 + 10
+124360 LET t = t + v6 / 7
+124370 IF t < 0 THEN 124380
+124380 LET v7 = 12
+124390 LET v7 = v7 * 3 + 1
+124400 LET t = t + v7 / 7
+124410 IF t < 0 THEN 124420
+124420 LET v8 = 16
+124430 LET v8 = v8 * 3 + 5
+124440 LET t = t + v8 / 7
+124450 IF t < 0 THEN 124460
+124460 LET v9 = 20
+124470 LET v9 = v9 * 3 + 9
+124480 LET t = t + v9 / 7
+124490 IF t < 0 THEN 124500
+124500 LET v10 = 24
+124510 LET v10 = v10 * 3 + 0
+124520 LET t = t + v10 / 7
+124530 IF t < 0 THEN 124540
+124540 LET v11 = 28
+124550 LET v11 = v11 * 3 + 4
+124560 LET t = t + v11 / 7
+124570 IF t < 0 THEN 124580
+124580 LET v12 = 32
+124590 LET v12 = v12 * 3 + 8
+124600 LET t = t + v12 / 7
+124610 IF t < 0 THEN 124620
+124620 LET v13 = 36
+124630 LET v13 = v13 * 3 + 12
+124640 LET t = t + v13 / 7
+124650 IF t < 0 THEN 124660
+124660 LET v14 = 40
+124670 LET v14 = v14 * 3 + 3
+124680 LET t = t + v14 / 7
+124690 IF t < 0 THEN 124700
+124700 LET v15 = 44
+124710 LET v15 = v15 * 3 + 7
+124720 LET t = t + v15 / 7
+124730 IF t < 0 THEN 124740
+124740 LET v16 = 48
+124750 LET v16 = v16 * 3 + 11
+124760 LET t = t + v16 / 7
+124770 IF t < 0 THEN 124780
+124780 LET v17 = 52
+124790 LET v17 = v17 * 3 + 2
+124800 LET t = t + v17 / 7
+124810 IF t < 0 THEN 124820
+124820 LET v18 = 56
+124830 LET v18 = v18 * 3 + 6
+124840 LET t = t + v18 / 7
+124850 IF t < 0 THEN 124860
+124860 LET v19 = 60
+124870 LET v19 = v19 * 3 + 10
+124880 LET t = t + v19 / 7
+124890 IF t < 0 THEN 124900
+124900 LET v20 = 64
+124910 LET v20 = v20 * 3 + 1
+124920 LET t = t + v20 / 7
+124930 IF t < 0 THEN 124940
+124940 LET v21 = 68
+124950 LET v21 = v21 * 3 + 5
+124960 LET t = t + v21 / 7
+124970 IF t < 0 THEN 124980
+124980 LET v22 = 72
+124990 LET v22 = v22 * 3 + 9
+125000 LET t = t + v22 / 7
+125010 IF t < 0 THEN 125020
+125020 LET v23 = 76
+125030 LET v23 = v23 * 3 + 0
+125040 LET t = t + v23 / 7
+125050 IF t < 0 THEN 125060
+125060 LET v24 = 80
+125070 LET v24 = v24 * 3 + 4
+125080 LET t = t + v24 / 7
+125090 IF t < 0 THEN 125100
+125100 LET v25 = 84
+125110 LET v25 = v25 * 3 + 8
+125120 LET t = t + v25 / 7
+125130 IF t < 0 THEN 125140
+125140 LET v26 = 88
+125150 LET v26 = v26 * 3 + 12
+125160 LET t = t + v26 / 7
+125170 IF t < 0 THEN 125180
+125180 LET v27 = 92
+125190 LET v27 = v27 * 3 + 3
+125200 LET t = t + v27 / 7
+125210 IF t < 0 THEN 125220
+125220 LET v28 = 96
+125230 LET v28 = v28 * 3 + 7
+125240 LET t = t + v28 / 7
+125250 IF t < 0 THEN 125260
+125260 LET v29 = 3
+125270 LET v29 = v29 * 3 + 11
+125280 LET t = t + v29 / 7
+125290 IF t < 0 THEN 125300
+125300 LET v30 = 7
+125310 LET v30 = v30 * 3 + 2
+125320 LET t = t + v30 / 7
+125330 IF t < 0 THEN 125340
+125340 LET v31 = 11
+125350 LET v31 = v31 * 3 + 6
+125360 LET t = t + v31 / 7
+125370 IF t < 0 THEN 125380
+125380 LET v32 = 15
+125390 LET v32 = v32 * 3 + 10
+125400 LET t = t + v32 / 7
+125410 IF t < 0 THEN 125420
+125420 LET v33 = 19
+125430 LET v33 = v33 * 3 + 1
+125440 LET t = t + v33 / 7
+125450 IF t < 0 THEN 125460
+125460 LET v34 = 23
+125470 LET v34 = v34 * 3 + 5
+125480 LET t = t + v34 / 7
+125490 IF t < 0 THEN 125500
+125500 LET v35 = 27
+125510 LET v35 = v35 * 3 + 9
+125520 LET t = t + v35 / 7
+125530 IF t < 0 THEN 125540
+125540 LET v36 = 31
+125550 LET v36 = v36 * 3 + 0
+125560 LET t = t + v36 / 7
+125570 IF t < 0 THEN 125580
+125580 LET v37 = 35
+125590 LET v37 = v37 * 3 + 4
+125600 LET t = t + v37 / 7
+125610 IF t < 0 THEN 125620
+125620 LET v38 = 39
+125630 LET v38 = v38 * 3 + 8
+125640 LET t = t + v38 / 7
+125650 IF t < 0 THEN 125660
+125660 LET v39 = 43
+125670 LET v39 = v39 * 3 + 12
+125680 LET t = t + v39 / 7
+125690 IF t < 0 THEN 125700
+125700 LET v40 = 47
+125710 LET v40 = v40 * 3 + 3
+125720 LET t = t + v40 / 7
+125730 IF t < 0 THEN 125740
+125740 LET v41 = 51
+125750 LET v41 = v41 * 3 + 7
+125760 LET t = t + v41 / 7
+125770 IF t < 0 THEN 125780
+125780 LET v42 = 55
+125790 LET v42 = v42 * 3 + 11
+125800 LET t = t + v42 / 7
+125810 IF t < 0 THEN 125820
+125820 LET v43 = 59
+125830 LET v43 = v43 * 3 + 2
+125840 LET t = t + v43 / 7
+125850 IF t < 0 THEN 125860
+125860 LET v44 = 63
+125870 LET v44 = v44 * 3 + 6
+125880 LET t = t + v44 / 7
+125890 IF t < 0 THEN 125900
+125900 LET v45 = 67
+125910 LET v45 = v45 * 3 + 10
+125920 LET t = t + v45 / 7
+125930 IF t < 0 THEN 125940
+125940 LET v46 = 71
+125950 LET v46 = v46 * 3 + 1
+125960 LET t = t + v46 / 7
+125970 IF t < 0 THEN 125980
+125980 LET v47 = 75
+125990 LET v47 = v47 * 3 + 5
+126000 LET t = t + v47 / 7
+126010 IF t < 0 THEN 126020
+126020 LET v48 = 79
+126030 LET v48 = v48 * 3 + 9
+126040 LET t = t + v48 / 7
+126050 IF t < 0 THEN 126060
+126060 LET v49 = 83
+126070 LET v49 = v49 * 3 + 0
+126080 LET t = t + v49 / 7
+126090 IF t < 0 THEN 126100
+126100 LET v0 = 87
+126110 LET v0 = v0 * 3 + 4
+126120 LET t = t + v0 / 7
+126130 IF t < 0 THEN 126140
+126140 LET v1 = 91
+126150 LET v1 = v1 * 3 + 8
+126160 LET t = t + v1 / 7
+126170 IF t < 0 THEN 126180
+126180 LET v2 = 95
+126190 LET v2 = v2 * 3 + 12
+126200 LET t = t + v2 / 7
+126210 IF t < 0 THEN 126220
+126220 LET v3 = 2
+126230 LET v3 = v3 * 3 + 3
+126240 LET t = t + v3 / 7
+126250 IF t < 0 THEN 126260
+126260 LET v4 = 6
+126270 LET v4 = v4 * 3 + 7
+126280 LET t = t + v4 / 7
+126290 IF t < 0 THEN 126300
+126300 LET v5 = 10
+126310 LET v5 = v5 * 3 + 11
+126320 LET t = t + v5 / 7
+126330 IF t < 0 THEN 126340
+126340 LET v6 = 14
+126350 LET v6 = v6 * 3 + 2
+126360 LET t = t + v6 / 7
+126370 IF t < 0 THEN 126380
+126380 LET v7 = 18
+126390 LET v7 = v7 * 3 + 6
+126400 LET t = t + v7 / 7
+126410 IF t < 0 THEN 126420
+126420 LET v8 = 22
+126430 LET v8 = v8 * 3 + 10
+126440 LET t = t + v8 / 7
+126450 IF t < 0 THEN 126460
+126460 LET v9 = 26
+126470 LET v9 = v9 * 3 + 1
+126480 LET t = t + v9 / 7
+126490 IF t < 0 THEN 126500
+126500 LET v10 = 30
+126510 LET v10 = v10 * 3 + 5
+126520 LET t = t + v10 / 7
+126530 IF t < 0 THEN 126540
+126540 LET v11 = 34
+126550 LET v11 = v11 * 3 + 9
+126560 LET t = t + v11 / 7
+126570 IF t < 0 THEN 126580
+126580 LET v12 = 38
+126590 LET v12 = v12 * 3 + 0
+126600 LET t = t + v12 / 7
+126610 IF t < 0 THEN 126620
+126620 LET v13 = 42
+126630 LET v13 = v13 * 3 + 4
+126640 LET t = t + v13 / 7
+126650 IF t < 0 THEN 126660
+126660 LET v14 = 46
+126670 LET v14 = v14 * 3 + 8
+126680 LET t = t + v14 / 7
+126690 IF t < 0 THEN 126700
+126700 LET v15 = 50
+126710 LET v15 = v15 * 3 + 12
+126720 LET t = t + v15 / 7
+126730 IF t < 0 THEN 126740
+126740 LET v16 = 54
+126750 LET v16 = v16 * 3 + 3
+126760 LET t = t + v16 / 7
+126770 IF t < 0 THEN 126780
+126780 LET v17 = 58
+126790 LET v17 = v17 * 3 + 7
+126800 LET t = t + v17 / 7
+126810 IF t < 0 THEN 126820
+126820 LET v18 = 62
+126830 LET v18 = v18 * 3 + 11
+126840 LET t = t + v18 / 7
+126850 IF t < 0 THEN 126860
+126860 LET v19 = 66
+126870 LET v19 = v19 * 3 + 2
+126880 LET t = t + v19 / 7
+126890 IF t < 0 THEN 126900
+126900 LET v20 = 70
+126910 LET v20 = v20 * 3 + 6
+126920 LET t = t + v20 / 7
+126930 IF t < 0 THEN 126940
+126940 LET v21 = 74
+126950 LET v21 = v21 * 3 + 10
+126960 LET t = t + v21 / 7
+126970 IF t < 0 THEN 126980
+126980 LET v22 = 78
+126990 LET v22 = v22 * 3 + 1
+127000 LET t = t + v22 / 7
+127010 IF t < 0 THEN 127020
+127020 LET v23 = 82
+127030 LET v23 = v23 * 3 + 5
+127040 LET t = t + v23 / 7
+127050 IF t < 0 THEN 127060
+127060 LET v24 = 86
+127070 LET v24 = v24 * 3 + 9
+127080 LET t = t + v24 / 7
+127090 IF t < 0 THEN 127100
+127100 LET v25 = 90
+127110 LET v25 = v25 * 3 + 0
+127120 LET t = t + v25 / 7
+127130 IF t < 0 THEN 127140
+127140 LET v26 = 94
+127150 LET v26 = v26 * 3 + 4
+127160 LET t = t + v26 / 7
+127170 IF t < 0 THEN 127180
+127180 LET v27 = 1
+127190 LET v27 = v27 * 3 + 8
+127200 LET t = t + v27 / 7
+127210 IF t < 0 THEN 127220
+127220 LET v28 = 5
+127230 LET v28 = v28 * 3 + 12
+127240 LET t = t + v28 / 7
+127250 IF t < 0 THEN 127260
+127260 LET v29 = 9
+127270 LET v29 = v29 * 3 + 3
+127280 LET t = t + v29 / 7
+127290 IF t < 0 THEN 127300
+127300 LET v30 = 13
+127310 LET v30 = v30 * 3 + 7
+127320 LET t = t + v30 / 7
+127330 IF t < 0 THEN 127340
+127340 LET v31 = 17
+127350 LET v31 = v31 * 3 + 11
+127360 LET t = t + v31 / 7
+127370 IF t < 0 THEN 127380
+127380 LET v32 = 21
+127390 LET v32 = v32 * 3 + 2
+127400 LET t = t + v32 / 7
+127410 IF t < 0 THEN 127420
+127420 LET v33 = 25
+127430 LET v33 = v33 * 3 + 6
+127440 LET t = t + v33 / 7
+127450 IF t < 0 THEN 127460
+127460 LET v34 = 29
+127470 LET v34 = v34 * 3 + 10
+127480 LET t = t + v34 / 7
+127490 IF t < 0 THEN 127500
+127500 LET v35 = 33
+127510 LET v35 = v35 * 3 + 1
+127520 LET t = t + v35 / 7
+127530 IF t < 0 THEN 127540
+127540 LET v36 = 37
+127550 LET v36 = v36 * 3 + 5
+127560 LET t = t + v36 / 7
+127570 IF t < 0 THEN 127580
+127580 LET v37 = 41
+127590 LET v37 = v37 * 3 + 9
+127600 LET t = t + v37 / 7
+127610 IF t < 0 THEN 127620
+127620 LET v38 = 45
+127630 LET v38 = v38 * 3 + 0
+127640 LET t = t + v38 / 7
+127650 IF t < 0 THEN 127660
+127660 LET v39 = 49
+127670 LET v39 = v39 * 3 + 4
+127680 LET t = t + v39 / 7
+127690 IF t < 0 THEN 127700
+127700 LET v40 = 53
+127710 LET v40 = v40 * 3 + 8
+127720 LET t = t + v40 / 7
+127730 IF t < 0 THEN 127740
+127740 LET v41 = 57
+127750 LET v41 = v41 * 3 + 12
+127760 LET t = t + v41 / 7
+127770 IF t < 0 THEN 127780
+127780 LET v42 = 61
+127790 LET v42 = v42 * 3 + 3
+127800 LET t = t + v42 / 7
+127810 IF t < 0 THEN 127820
+127820 LET v43 = 65
+127830 LET v43 = v43 * 3 + 7
+127840 LET t = t + v43 / 7
+127850 IF t < 0 THEN 127860
+127860 LET v44 = 69
+127870 LET v44 = v44 * 3 + 11
+127880 LET t = t + v44 / 7
+127890 IF t < 0 THEN 127900
+127900 LET v45 = 73
+127910 LET v45 = v45 * 3 + 2
+127920 LET t = t + v45 / 7
+127930 IF t < 0 THEN 127940
+127940 LET v46 = 77
+127950 LET v46 = v46 * 3 + 6
+127960 LET t = t + v46 / 7
+127970 IF t < 0 THEN 127980
+127980 LET v47 = 81
+127990 LET v47 = v47 * 3 + 10
+128000 LET t = t + v47 / 7
+128010 IF t < 0 THEN 128020
+128020 LET v48 = 85
+128030 LET v48 = v48 * 3 + 1
+128040 LET t = t + v48 / 7
+128050 IF t < 0 THEN 128060
+128060 LET v49 = 89
+128070 LET v49 = v49 * 3 + 5
+128080 LET t = t + v49 / 7
+128090 IF t < 0 THEN 128100
+128100 LET v0 = 93
+128110 LET v0 = v0 * 3 + 9
+128120 LET t = t + v0 / 7
+128130 IF t < 0 THEN 128140
+128140 LET v1 = 0
+128150 LET v1 = v1 * 3 + 0
+128160 LET t = t + v1 / 7
+128170 IF t < 0 THEN 128180
+128180 LET v2 = 4
+128190 LET v2 = v2 * 3 + 4
+128200 LET t = t + v2 / 7
+128210 IF t < 0 THEN 128220
+128220 LET v3 = 8
+128230 LET v3 = v3 * 3 + 8
+128240 LET t = t + v3 / 7
+128250 IF t < 0 THEN 128260
+128260 LET v4 = 12
+128270 LET v4 = v4 * 3 + 12
+128280 LET t = t + v4 / 7
+128290 IF t < 0 THEN 128300
+128300 LET v5 = 16
+128310 LET v5 = v5 * 3 + 3
+128320 LET t = t + v5 / 7
+128330 IF t < 0 THEN 128340
+128340 LET v6 = 20
+128350 LET v6 = v6 * 3 + 7
+128360 LET t = t + v6 / 7
+128370 IF t < 0 THEN 128380
+128380 LET v7 = 24
+128390 LET v7 = v7 * 3 + 11
+128400 LET t = t + v7 / 7
+128410 IF t < 0 THEN 128420
+128420 LET v8 = 28
+128430 LET v8 = v8 * 3 + 2
+128440 LET t = t + v8 / 7
+128450 IF t < 0 THEN 128460
+128460 LET v9 = 32
+128470 LET v9 = v9 * 3 + 6
+128480 LET t = t + v9 / 7
+128490 IF t < 0 THEN 128500
+128500 LET v10 = 36
+128510 LET v10 = v10 * 3 + 10
+128520 LET t = t + v10 / 7
+128530 IF t < 0 THEN 128540
+128540 LET v11 = 40
+128550 LET v11 = v11 * 3 + 1
+128560 LET t = t + v11 / 7
+128570 IF t < 0 THEN 128580
+128580 LET v12 = 44
+128590 LET v12 = v12 * 3 + 5
+128600 LET t = t + v12 / 7
+128610 IF t < 0 THEN 128620
+128620 LET v13 = 48
+128630 LET v13 = v13 * 3 + 9
+128640 LET t = t + v13 / 7
+128650 IF t < 0 THEN 128660
+128660 LET v14 = 52
+128670 LET v14 = v14 * 3 + 0
+128680 LET t = t + v14 / 7
+128690 IF t < 0 THEN 128700
+128700 LET v15 = 56
+128710 LET v15 = v15 * 3 + 4
+128720 LET t = t + v15 / 7
+128730 IF t < 0 THEN 128740
+128740 LET v16 = 60
+128750 LET v16 = v16 * 3 + 8
+128760 LET t = t + v16 / 7
+128770 IF t < 0 THEN 128780
+128780 LET v17 = 64
+128790 LET v17 = v17 * 3 + 12
+128800 LET t = t + v17 / 7
+128810 IF t < 0 THEN 128820
+128820 LET v18 = 68
+128830 LET v18 = v18 * 3 + 3
+128840 LET t = t + v18 / 7
+128850 IF t < 0 THEN 128860
+128860 LET v19 = 72
+128870 LET v19 = v19 * 3 + 7
+128880 LET t = t + v19 / 7
+128890 IF t < 0 THEN 128900
+128900 LET v20 = 76
+128910 LET v20 = v20 * 3 + 11
+128920 LET t = t + v20 / 7
+128930 IF t < 0 THEN 128940
+128940 LET v21 = 80
+128950 LET v21 = v21 * 3 + 2
+128960 LET t = t + v21 / 7
+128970 IF t < 0 THEN 128980
+128980 LET v22 = 84
+128990 LET v22 = v22 * 3 + 6
+129000 LET t = t + v22 / 7
+129010 IF t < 0 THEN 129020
+129020 LET v23 = 88
+129030 LET v23 = v23 * 3 + 10
+129040 LET t = t + v23 / 7
+129050 IF t < 0 THEN 129060
+129060 LET v24 = 92
+129070 LET v24 = v24 * 3 + 1
+129080 LET t = t + v24 / 7
+129090 IF t < 0 THEN 129100
+129100 LET v25 = 96
+129110 LET v25 = v25 * 3 + 5
+129120 LET t = t + v25 / 7
+129130 IF t < 0 THEN 129140
+129140 LET v26 = 3
+129150 LET v26 = v26 * 3 + 9
+129160 LET t = t + v26 / 7
+129170 IF t < 0 THEN 129180
+129180 LET v27 = 7
+129190 LET v27 = v27 * 3 + 0
+129200 LET t = t + v27 / 7
+129210 IF t < 0 THEN 129220
+129220 LET v28 = 11
+129230 LET v28 = v28 * 3 + 4
+129240 LET t = t + v28 / 7
+129250 IF t < 0 THEN 129260
+129260 LET v29 = 15
+129270 LET v29 = v29 * 3 + 8
+129280 LET t = t + v29 / 7
+129290 IF t < 0 THEN 129300
+129300 LET v30 = 19
+129310 LET v30 = v30 * 3 + 12
+129320 LET t = t + v30 / 7
+129330 IF t < 0 THEN 129340
+129340 LET v31 = 23
+129350 LET v31 = v31 * 3 + 3
+129360 LET t = t + v31 / 7
+129370 IF t < 0 THEN 129380
+129380 LET v32 = 27
+129390 LET v32 = v32 * 3 + 7
+129400 LET t = t + v32 / 7
+129410 IF t < 0 THEN 129420
+129420 LET v33 = 31
+129430 LET v33 = v33 * 3 + 11
+129440 LET t = t + v33 / 7
+129450 IF t < 0 THEN 129460
+129460 LET v34 = 35
+129470 LET v34 = v34 * 3 + 2
+129480 LET t = t + v34 / 7
+129490 IF t < 0 THEN 129500
+129500 LET v35 = 39
+129510 LET v35 = v35 * 3 + 6
+129520 LET t = t + v35 / 7
+129530 IF t < 0 THEN 129540
+129540 LET v36 = 43
+129550 LET v36 = v36 * 3 + 10
+129560 LET t = t + v36 / 7
+129570 IF t < 0 THEN 129580
+129580 LET v37 = 47
+129590 LET v37 = v37 * 3 + 1
+129600 LET t = t + v37 / 7
+129610 IF t < 0 THEN 129620
+129620 LET v38 = 51
+129630 LET v38 = v38 * 3 + 5
+129640 LET t = t + v38 / 7
+129650 IF t < 0 THEN 129660
+129660 LET v39 = 55
+129670 LET v39 = v39 * 3 + 9
+129680 LET t = t + v39 / 7
+129690 IF t < 0 THEN 129700
+129700 LET v40 = 59
+129710 LET v40 = v40 * 3 + 0
+129720 LET t = t + v40 / 7
+129730 IF t < 0 THEN 129740
+129740 LET v41 = 63
+129750 LET v41 = v41 * 3 + 4
+129760 LET t = t + v41 / 7
+129770 IF t < 0 THEN 129780
+129780 LET v42 = 67
+129790 LET v42 = v42 * 3 + 8
+129800 LET t = t + v42 / 7
+129810 IF t < 0 THEN 129820
+129820 LET v43 = 71
+129830 LET v43 = v43 * 3 + 12
+129840 LET t = t + v43 / 7
+129850 IF t < 0 THEN 129860
+129860 LET v44 = 75
+129870 LET v44 = v44 * 3 + 3
+129880 LET t = t + v44 / 7
+129890 IF t < 0 THEN 129900
+129900 LET v45 = 79
+129910 LET v45 = v45 * 3 + 7
+129920 LET t = t + v45 / 7
+129930 IF t < 0 THEN 129940
+129940 LET v46 = 83
+129950 LET v46 = v46 * 3 + 11
+129960 LET t = t + v46 / 7
+129970 IF t < 0 THEN 129980
+129980 LET v47 = 87
+129990 LET v47 = v47 * 3 + 2
+130000 LET t = t + v47 / 7
+130010 IF t < 0 THEN 130020
+130020 LET v48 = 91
+130030 LET v48 = v48 * 3 + 6
+130040 LET t = t + v48 / 7
+130050 IF t < 0 THEN 130060
+130060 LET v49 = 95
+130070 LET v49 = v49 * 3 + 10
+130080 LET t = t + v49 / 7
+130090 IF t < 0 THEN 130100
+130100 LET v0 = 2
+130110 LET v0 = v0 * 3 + 1
+130120 LET t = t + v0 / 7
+130130 IF t < 0 THEN 130140
+130140 LET v1 = 6
+130150 LET v1 = v1 * 3 + 5
+130160 LET t = t + v1 / 7
+130170 IF t < 0 THEN 130180
+130180 LET v2 = 10
+130190 LET v2 = v2 * 3 + 9
+130200 LET t = t + v2 / 7
+130210 IF t < 0 THEN 130220
+130220 LET v3 = 14
+130230 LET v3 = v3 * 3 + 0
+130240 LET t = t + v3 / 7
+130250 IF t < 0 THEN 130260
+130260 LET v4 = 18
+130270 LET v4 = v4 * 3 + 4
+130280 LET t = t + v4 / 7
+130290 IF t < 0 THEN 130300
+130300 LET v5 = 22
+130310 LET v5 = v5 * 3 + 8
+130320 LET t = t + v5 / 7
+130330 IF t < 0 THEN 130340
+130340 LET v6 = 26
+130350 LET v6 = v6 * 3 + 12
+130360 LET t = t + v6 / 7
+130370 IF t < 0 THEN 130380
+130380 LET v7 = 30
+130390 LET v7 = v7 * 3 + 3
+130400 LET t = t + v7 / 7
+130410 IF t < 0 THEN 130420
+130420 LET v8 = 34
+130430 LET v8 = v8 * 3 + 7
+130440 LET t = t + v8 / 7
+130450 IF t < 0 THEN 130460
+130460 LET v9 = 38
+130470 LET v9 = v9 * 3 + 11
+130480 LET t = t + v9 / 7
+130490 IF t < 0 THEN 130500
+130500 LET v10 = 42
+130510 LET v10 = v10 * 3 + 2
+130520 LET t = t + v10 / 7
+130530 IF t < 0 THEN 130540
+130540 LET v11 = 46
+130550 LET v11 = v11 * 3 + 6
+130560 LET t = t + v11 / 7
+130570 IF t < 0 THEN 130580
+130580 LET v12 = 50
+130590 LET v12 = v12 * 3 + 10
+130600 LET t = t + v12 / 7
+130610 IF t < 0 THEN 130620
+130620 LET v13 = 54
+130630 LET v13 = v13 * 3 + 1
+130640 LET t = t + v13 / 7
+130650 IF t < 0 THEN 130660
+130660 LET v14 = 58
+130670 LET v14 = v14 * 3 + 5
+130680 LET t = t + v14 / 7
+130690 IF t < 0 THEN 130700
+130700 LET v15 = 62
+130710 LET v15 = v15 * 3 + 9
+130720 LET t = t + v15 / 7
+130730 IF t < 0 THEN 130740
+130740 LET v16 = 66
+130750 LET v16 = v16 * 3 + 0
+130760 LET t = t + v16 / 7
+130770 IF t < 0 THEN 130780
+130780 LET v17 = 70
+130790 LET v17 = v17 * 3 + 4
+130800 LET t = t + v17 / 7
+130810 IF t < 0 THEN 130820
+130820 LET v18 = 74
+130830 LET v18 = v18 * 3 + 8
+130840 LET t = t + v18 / 7
+130850 IF t < 0 THEN 130860
+130860 LET v19 = 78
+130870 LET v19 = v19 * 3 + 12
+130880 LET t = t + v19 / 7
+130890 IF t < 0 THEN 130900
+130900 LET v20 = 82
+130910 LET v20 = v20 * 3 + 3
+130920 LET t = t + v20 / 7
+130930 IF t < 0 THEN 130940
+130940 LET v21 = 86
+130950 LET v21 = v21 * 3 + 7
+130960 LET t = t + v21 / 7
+130970 IF t < 0 THEN 130980
+130980 LET v22 = 90
+130990 LET v22 = v22 * 3 + 11
+131000 LET t = t + v22 / 7
+131010 IF t < 0 THEN 131020
+131020 LET v23 = 94
+131030 LET v23 = v23 * 3 + 2
+131040 LET t = t + v23 / 7
+131050 IF t < 0 THEN 131060
+131060 LET v24 = 1
+131070 LET v24 = v24 * 3 + 6
+131080 LET t = t + v24 / 7
+131090 IF t < 0 THEN 131100
+131100 LET v25 = 5
+131110 LET v25 = v25 * 3 + 10
+131120 LET t = t + v25 / 7
+131130 IF t < 0 THEN 131140
+131140 LET v26 = 9
+131150 LET v26 = v26 * 3 + 1
+131160 LET t = t + v26 / 7
+131170 IF t < 0 THEN 131180
+131180 LET v27 = 13
+131190 LET v27 = v27 * 3 + 5
+131200 LET t = t + v27 / 7
+131210 IF t < 0 THEN 131220
+131220 LET v28 = 17
+131230 LET v28 = v28 * 3 + 9
+131240 LET t = t + v28 / 7
+131250 IF t < 0 THEN 131260
+131260 LET v29 = 21
+131270 LET v29 = v29 * 3 + 0
+131280 LET t = t + v29 / 7
+131290 IF t < 0 THEN 131300
+131300 LET v30 = 25
+131310 LET v30 = v30 * 3 + 4
+131320 LET t = t + v30 / 7
+131330 IF t < 0 THEN 131340
+131340 LET v31 = 29
+131350 LET v31 = v31 * 3 + 8
+131360 LET t = t + v31 / 7
+131370 IF t < 0 THEN 131380
+131380 LET v32 = 33
+131390 LET v32 = v32 * 3 + 12
+131400 LET t = t + v32 / 7
+131410 IF t < 0 THEN 131420
+131420 LET v33 = 37
+131430 LET v33 = v33 * 3 + 3
+131440 LET t = t + v33 / 7
+131450 IF t < 0 THEN 131460
+131460 LET v34 = 41
+131470 LET v34 = v34 * 3 + 7
+131480 LET t = t + v34 / 7
+131490 IF t < 0 THEN 131500
+131500 LET v35 = 45
+131510 LET v35 = v35 * 3 + 11
+131520 LET t = t + v35 / 7
+131530 IF t < 0 THEN 131540
+131540 LET v36 = 49
+131550 LET v36 = v36 * 3 + 2
+131560 LET t = t + v36 / 7
+131570 IF t < 0 THEN 131580
+131580 LET v37 = 53
+131590 LET v37 = v37 * 3 + 6
+131600 LET t = t + v37 / 7
+131610 IF t < 0 THEN 131620
+131620 LET v38 = 57
+131630 LET v38 = v38 * 3 + 10
+131640 LET t = t + v38 / 7
+131650 IF t < 0 THEN 131660
+131660 LET v39 = 61
+131670 LET v39 = v39 * 3 + 1
+131680 LET t = t + v39 / 7
+131690 IF t < 0 THEN 131700
+131700 LET v40 = 65
+131710 LET v40 = v40 * 3 + 5
+131720 LET t = t + v40 / 7
+131730 IF t < 0 THEN 131740
+131740 LET v41 = 69
+131750 LET v41 = v41 * 3 + 9
+131760 LET t = t + v41 / 7
+131770 IF t < 0 THEN 131780
+131780 LET v42 = 73
+131790 LET v42 = v42 * 3 + 0
+131800 LET t = t + v42 / 7
+131810 IF t < 0 THEN 131820
+131820 LET v43 = 77
+131830 LET v43 = v43 * 3 + 4
+131840 LET t = t + v43 / 7
+131850 IF t < 0 THEN 131860
+131860 LET v44 = 81
+131870 LET v44 = v44 * 3 + 8
+131880 LET t = t + v44 / 7
+131890 IF t < 0 THEN 131900
+131900 LET v45 = 85
+131910 LET v45 = v45 * 3 + 12
+131920 LET t = t + v45 / 7
+131930 IF t < 0 THEN 131940
+131940 LET v46 = 89
+131950 LET v46 = v46 * 3 + 3
+131960 LET t = t + v46 / 7
+131970 IF t < 0 THEN 131980
+131980 LET v47 = 93
+131990 LET v47 = v47 * 3 + 7
+132000 LET t = t + v47 / 7
+132010 IF t < 0 THEN 132020
+132020 LET v48 = 0
+132030 LET v48 = v48 * 3 + 11
+132040 LET t = t + v48 / 7
+132050 IF t < 0 THEN 132060
+132060 LET v49 = 4
+132070 LET v49 = v49 * 3 + 2
+132080 LET t = t + v49 / 7
+132090 IF t < 0 THEN 132100
+132100 LET v0 = 8
+132110 LET v0 = v0 * 3 + 6
+132120 LET t = t + v0 / 7
+132130 IF t < 0 THEN 132140
+132140 LET v1 = 12
+132150 LET v1 = v1 * 3 + 10
+132160 LET t = t + v1 / 7
+132170 IF t < 0 THEN 132180
+132180 LET v2 = 16
+132190 LET v2 = v2 * 3 + 1
+132200 LET t = t + v2 / 7
+132210 IF t < 0 THEN 132220
+132220 LET v3 = 20
+132230 LET v3 = v3 * 3 + 5
+132240 LET t = t + v3 / 7
+132250 IF t < 0 THEN 132260
+132260 LET v4 = 24
+132270 LET v4 = v4 * 3 + 9
+132280 LET t = t + v4 / 7
+132290 IF t < 0 THEN 132300
+132300 LET v5 = 28
+132310 LET v5 = v5 * 3 + 0
+132320 LET t = t + v5 / 7
+132330 IF t < 0 THEN 132340
+132340 LET v6 = 32
+132350 LET v6 = v6 * 3 + 4
+132360 LET t = t + v6 / 7
+132370 IF t < 0 THEN 132380
+132380 LET v7 = 36
+132390 LET v7 = v7 * 3 + 8
+132400 LET t = t + v7 / 7
+132410 IF t < 0 THEN 132420
+132420 LET v8 = 40
+132430 LET v8 = v8 * 3 + 12
+132440 LET t = t + v8 / 7
+132450 IF t < 0 THEN 132460
+132460 LET v9 = 44
+132470 LET v9 = v9 * 3 + 3
+132480 LET t = t + v9 / 7
+132490 IF t < 0 THEN 132500
+132500 LET v10 = 48
+132510 LET v10 = v10 * 3 + 7
+132520 LET t = t + v10 / 7
+132530 IF t < 0 THEN 132540
+132540 LET v11 = 52
+132550 LET v11 = v11 * 3 + 11
+132560 LET t = t + v11 / 7
+132570 IF t < 0 THEN 132580
+132580 LET v12 = 56
+132590 LET v12 = v12 * 3 + 2
+132600 LET t = t + v12 / 7
+132610 IF t < 0 THEN 132620
+132620 LET v13 = 60
+132630 LET v13 = v13 * 3 + 6
+132640 LET t = t + v13 / 7
+132650 IF t < 0 THEN 132660
+132660 LET v14 = 64
+132670 LET v14 = v14 * 3 + 10
+132680 LET t = t + v14 / 7
+132690 IF t < 0 THEN 132700
+132700 LET v15 = 68
+132710 LET v15 = v15 * 3 + 1
+132720 LET t = t + v15 / 7
+132730 IF t < 0 THEN 132740
+132740 LET v16 = 72
+132750 LET v16 = v16 * 3 + 5
+132760 LET t = t + v16 / 7
+132770 IF t < 0 THEN 132780
+132780 LET v17 = 76
+132790 LET v17 = v17 * 3 + 9
+132800 LET t = t + v17 / 7
+132810 IF t < 0 THEN 132820
+132820 LET v18 = 80
+132830 LET v18 = v18 * 3 + 0
+132840 LET t = t + v18 / 7
+132850 IF t < 0 THEN 132860
+132860 LET v19 = 84
+132870 LET v19 = v19 * 3 + 4
+132880 LET t = t + v19 / 7
+132890 IF t < 0 THEN 132900
+132900 LET v20 = 88
+132910 LET v20 = v20 * 3 + 8
+132920 LET t = t + v20 / 7
+132930 IF t < 0 THEN 132940
+132940 LET v21 = 92
+132950 LET v21 = v21 * 3 + 12
+132960 LET t = t + v21 / 7
+132970 IF t < 0 THEN 132980
+132980 LET v22 = 96
+132990 LET v22 = v22 * 3 + 3
+133000 LET t = t + v22 / 7
+133010 IF t < 0 THEN 133020
+133020 LET v23 = 3
+133030 LET v23 = v23 * 3 + 7
+133040 LET t = t + v23 / 7
+133050 IF t < 0 THEN 133060
+133060 LET v24 = 7
+133070 LET v24 = v24 * 3 + 11
+133080 LET t = t + v24 / 7
+133090 IF t < 0 THEN 133100
+133100 LET v25 = 11
+133110 LET v25 = v25 * 3 + 2
+133120 LET t = t + v25 / 7
+133130 IF t < 0 THEN 133140
+133140 LET v26 = 15
+133150 LET v26 = v26 * 3 + 6
+133160 LET t = t + v26 / 7
+133170 IF t < 0 THEN 133180
+133180 LET v27 = 19
+133190 LET v27 = v27 * 3 + 10
+133200 LET t = t + v27 / 7
+133210 IF t < 0 THEN 133220
+133220 LET v28 = 23
+133230 LET v28 = v28 * 3 + 1
+133240 LET t = t + v28 / 7
+133250 IF t < 0 THEN 133260
+133260 LET v29 = 27
+133270 LET v29 = v29 * 3 + 5
+133280 LET t = t + v29 / 7
+133290 IF t < 0 THEN 133300
+133300 LET v30 = 31
+133310 LET v30 = v30 * 3 + 9
+133320 LET t = t + v30 / 7
+133330 IF t < 0 THEN 133340
+133340 LET v31 = 35
+133350 LET v31 = v31 * 3 + 0
+133360 LET t = t + v31 / 7
+133370 IF t < 0 THEN 133380
+133380 LET v32 = 39
+133390 LET v32 = v32 * 3 + 4
+133400 LET t = t + v32 / 7
+133410 IF t < 0 THEN 133420
+133420 LET v33 = 43
+133430 LET v33 = v33 * 3 + 8
+133440 LET t = t + v33 / 7
+133450 IF t < 0 THEN 133460
+133460 LET v34 = 47
+133470 LET v34 = v34 * 3 + 12
+133480 LET t = t + v34 / 7
+133490 IF t < 0 THEN 133500
+133500 LET v35 = 51
+133510 LET v35 = v35 * 3 + 3
+133520 LET t = t + v35 / 7
+133530 IF t < 0 THEN 133540
+133540 LET v36 = 55
+133550 LET v36 = v36 * 3 + 7
+133560 LET t = t + v36 / 7
+133570 IF t < 0 THEN 133580
+133580 LET v37 = 59
+133590 LET v37 = v37 * 3 + 11
+133600 LET t = t + v37 / 7
+133610 IF t < 0 THEN 133620
+133620 LET v38 = 63
+133630 LET v38 = v38 * 3 + 2
+133640 LET t = t + v38 / 7
+133650 IF t < 0 THEN 133660
+133660 LET v39 = 67
+133670 LET v39 = v39 * 3 + 6
+133680 LET t = t + v39 / 7
+133690 IF t < 0 THEN 133700
+133700 LET v40 = 71
+133710 LET v40 = v40 * 3 + 10
+133720 LET t = t + v40 / 7
+133730 IF t < 0 THEN 133740
+133740 LET v41 = 75
+133750 LET v41 = v41 * 3 + 1
+133760 LET t = t + v41 / 7
+133770 IF t < 0 THEN 133780
+133780 LET v42 = 79
+133790 LET v42 = v42 * 3 + 5
+133800 LET t = t + v42 / 7
+133810 IF t < 0 THEN 133820
+133820 LET v43 = 83
+133830 LET v43 = v43 * 3 + 9
+133840 LET t = t + v43 / 7
+133850 IF t < 0 THEN 133860
+133860 LET v44 = 87
+133870 LET v44 = v44 * 3 + 0
+133880 LET t = t + v44 / 7
+133890 IF t < 0 THEN 133900
+133900 LET v45 = 91
+133910 LET v45 = v45 * 3 + 4
+133920 LET t = t + v45 / 7
+133930 IF t < 0 THEN 133940
+133940 LET v46 = 95
+133950 LET v46 = v46 * 3 + 8
+133960 LET t = t + v46 / 7
+133970 IF t < 0 THEN 133980
+133980 LET v47 = 2
+133990 LET v47 = v47 * 3 + 12
+134000 LET t = t + v47 / 7
+134010 IF t < 0 THEN 134020
+134020 LET v48 = 6
+134030 LET v48 = v48 * 3 + 3
+134040 LET t = t + v48 / 7
+134050 IF t < 0 THEN 134060
+134060 LET v49 = 10
+134070 LET v49 = v49 * 3 + 7
+134080 LET t = t + v49 / 7
+134090 IF t < 0 THEN 134100
+134100 LET v0 = 14
+134110 LET v0 = v0 * 3 + 11
+134120 LET t = t + v0 / 7
+134130 IF t < 0 THEN 134140
+134140 LET v1 = 18
+134150 LET v1 = v1 * 3 + 2
+134160 LET t = t + v1 / 7
+134170 IF t < 0 THEN 134180
+134180 LET v2 = 22
+134190 LET v2 = v2 * 3 + 6
+134200 LET t = t + v2 / 7
+134210 IF t < 0 THEN 134220
+134220 LET v3 = 26
+134230 LET v3 = v3 * 3 + 10
+134240 LET t = t + v3 / 7
+134250 IF t < 0 THEN 134260
+134260 LET v4 = 30
+134270 LET v4 = v4 * 3 + 1
+134280 LET t = t + v4 / 7
+134290 IF t < 0 THEN 134300
+134300 LET v5 = 34
+134310 LET v5 = v5 * 3 + 5
+134320 LET t = t + v5 / 7
+134330 IF t < 0 THEN 134340
+134340 LET v6 = 38
+134350 LET v6 = v6 * 3 + 9
+134360 LET t = t + v6 / 7
+134370 IF t < 0 THEN 134380
+134380 LET v7 = 42
+134390 LET v7 = v7 * 3 + 0
+134400 LET t = t + v7 / 7
+134410 IF t < 0 THEN 134420
+134420 LET v8 = 46
+134430 LET v8 = v8 * 3 + 4
+134440 LET t = t + v8 / 7
+134450 IF t < 0 THEN 134460
+134460 LET v9 = 50
+134470 LET v9 = v9 * 3 + 8
+134480 LET t = t + v9 / 7
+134490 IF t < 0 THEN 134500
+134500 LET v10 = 54
+134510 LET v10 = v10 * 3 + 12
+134520 LET t = t + v10 / 7
+134530 IF t < 0 THEN 134540
+134540 LET v11 = 58
+134550 LET v11 = v11 * 3 + 3
+134560 LET t = t + v11 / 7
+134570 IF t < 0 THEN 134580
+134580 LET v12 = 62
+134590 LET v12 = v12 * 3 + 7
+134600 LET t = t + v12 / 7
+134610 IF t < 0 THEN 134620
+134620 LET v13 = 66
+134630 LET v13 = v13 * 3 + 11
+134640 LET t = t + v13 / 7
+134650 IF t < 0 THEN 134660
+134660 LET v14 = 70
+134670 LET v14 = v14 * 3 + 2
+134680 LET t = t + v14 / 7
+134690 IF t < 0 THEN 134700
+134700 LET v15 = 74
+134710 LET v15 = v15 * 3 + 6
+134720 LET t = t + v15 / 7
+134730 IF t < 0 THEN 134740
+134740 LET v16 = 78
+134750 LET v16 = v16 * 3 + 10
+134760 LET t = t + v16 / 7
+134770 IF t < 0 THEN 134780
+134780 LET v17 = 82
+134790 LET v17 = v17 * 3 + 1
+134800 LET t = t + v17 / 7
+134810 IF t < 0 THEN 134820
+134820 LET v18 = 86
+134830 LET v18 = v18 * 3 + 5
+134840 LET t = t + v18 / 7
+134850 IF t < 0 THEN 134860
+134860 LET v19 = 90
+134870 LET v19 = v19 * 3 + 9
+134880 LET t = t + v19 / 7
+134890 IF t < 0 THEN 134900
+134900 LET v20 = 94
+134910 LET v20 = v20 * 3 + 0
+134920 LET t = t + v20 / 7
+134930 IF t < 0 THEN 134940
+134940 LET v21 = 1
+134950 LET v21 = v21 * 3 + 4
+134960 LET t = t + v21 / 7
+134970 IF t < 0 THEN 134980
+134980 LET v22 = 5
+134990 LET v22 = v22 * 3 + 8
+135000 LET t = t + v22 / 7
+135010 IF t < 0 THEN 135020
+135020 LET v23 = 9
+135030 LET v23 = v23 * 3 + 12
+135040 LET t = t + v23 / 7
+135050 IF t < 0 THEN 135060
+135060 LET v24 = 13
+135070 LET v24 = v24 * 3 + 3
+135080 LET t = t + v24 / 7
+135090 IF t < 0 THEN 135100
+135100 LET v25 = 17
+135110 LET v25 = v25 * 3 + 7
+135120 LET t = t + v25 / 7
+135130 IF t < 0 THEN 135140
+135140 LET v26 = 21
+135150 LET v26 = v26 * 3 + 11
+135160 LET t = t + v26 / 7
+135170 IF t < 0 THEN 135180
+135180 LET v27 = 25
+135190 LET v27 = v27 * 3 + 2
+135200 LET t = t + v27 / 7
+135210 IF t < 0 THEN 135220
+135220 LET v28 = 29
+135230 LET v28 = v28 * 3 + 6
+135240 LET t = t + v28 / 7
+135250 IF t < 0 THEN 135260
+135260 LET v29 = 33
+135270 LET v29 = v29 * 3 + 10
+135280 LET t = t + v29 / 7
+135290 IF t < 0 THEN 135300
+135300 LET v30 = 37
+135310 LET v30 = v30 * 3 + 1
+135320 LET t = t + v30 / 7
+135330 IF t < 0 THEN 135340
+135340 LET v31 = 41
+135350 LET v31 = v31 * 3 + 5
+135360 LET t = t + v31 / 7
+135370 IF t < 0 THEN 135380
+135380 LET v32 = 45
+135390 LET v32 = v32 * 3 + 9
+135400 LET t = t + v32 / 7
+135410 IF t < 0 THEN 135420
+135420 LET v33 = 49
+135430 LET v33 = v33 * 3 + 0
+135440 LET t = t + v33 / 7
+135450 IF t < 0 THEN 135460
+135460 LET v34 = 53
+135470 LET v34 = v34 * 3 + 4
+135480 LET t = t + v34 / 7
+135490 IF t < 0 THEN 135500
+135500 LET v35 = 57
+135510 LET v35 = v35 * 3 + 8
+135520 LET t = t + v35 / 7
+135530 IF t < 0 THEN 135540
+135540 LET v36 = 61
+135550 LET v36 = v36 * 3 + 12
+135560 LET t = t + v36 / 7
+135570 IF t < 0 THEN 135580
+135580 LET v37 = 65
+135590 LET v37 = v37 * 3 + 3
+135600 LET t = t + v37 / 7
+135610 IF t < 0 THEN 135620
+135620 LET v38 = 69
+135630 LET v38 = v38 * 3 + 7
+135640 LET t = t + v38 / 7
+135650 IF t < 0 THEN 135660
+135660 LET v39 = 73
+135670 LET v39 = v39 * 3 + 11
+135680 LET t = t + v39 / 7
+135690 IF t < 0 THEN 135700
+135700 LET v40 = 77
+135710 LET v40 = v40 * 3 + 2
+135720 LET t = t + v40 / 7
+135730 IF t < 0 THEN 135740
+135740 LET v41 = 81
+135750 LET v41 = v41 * 3 + 6
+135760 LET t = t + v41 / 7
+135770 IF t < 0 THEN 135780
+135780 LET v42 = 85
+135790 LET v42 = v42 * 3 + 10
+135800 LET t = t + v42 / 7
+135810 IF t < 0 THEN 135820
+135820 LET v43 = 89
+135830 LET v43 = v43 * 3 + 1
+135840 LET t = t + v43 / 7
+135850 IF t < 0 THEN 135860
+135860 LET v44 = 93
+135870 LET v44 = v44 * 3 + 5
+135880 LET t = t + v44 / 7
+135890 IF t < 0 THEN 135900
+135900 LET v45 = 0
+135910 LET v45 = v45 * 3 + 9
+135920 LET t = t + v45 / 7
+135930 IF t < 0 THEN 135940
+135940 LET v46 = 4
+135950 LET v46 = v46 * 3 + 0
+135960 LET t = t + v46 / 7
+135970 IF t < 0 THEN 135980
+135980 LET v47 = 8
+135990 LET v47 = v47 * 3 + 4
+136000 LET t = t + v47 / 7
+136010 IF t < 0 THEN 136020
+136020 LET v48 = 12
+136030 LET v48 = v48 * 3 + 8
+136040 LET t = t + v48 / 7
+136050 IF t < 0 THEN 136060
+136060 LET v49 = 16
+136070 LET v49 = v49 * 3 + 12
+136080 LET t = t + v49 / 7
+136090 IF t < 0 THEN 136100
+136100 LET v0 = 20
+136110 LET v0 = v0 * 3 + 3
+136120 LET t = t + v0 / 7
+136130 IF t < 0 THEN 136140
+136140 LET v1 = 24
+136150 LET v1 = v1 * 3 + 7
+136160 LET t = t + v1 / 7
+136170 IF t < 0 THEN 136180
+136180 LET v2 = 28
+136190 LET v2 = v2 * 3 + 11
+136200 LET t = t + v2 / 7
+136210 IF t < 0 THEN 136220
+136220 LET v3 = 32
+136230 LET v3 = v3 * 3 + 2
+136240 LET t = t + v3 / 7
+136250 IF t < 0 THEN 136260
+136260 LET v4 = 36
+136270 LET v4 = v4 * 3 + 6
+136280 LET t = t + v4 / 7
+136290 IF t < 0 THEN 136300
+136300 LET v5 = 40
+136310 LET v5 = v5 * 3 + 10
+136320 LET t = t + v5 / 7
+136330 IF t < 0 THEN 136340
+136340 LET v6 = 44
+136350 LET v6 = v6 * 3 + 1
+136360 LET t = t + v6 / 7
+136370 IF t < 0 THEN 136380
+136380 LET v7 = 48
+136390 LET v7 = v7 * 3 + 5
+136400 LET t = t + v7 / 7
+136410 IF t < 0 THEN 136420
+136420 LET v8 = 52
+136430 LET v8 = v8 * 3 + 9
+136440 LET t = t + v8 / 7
+136450 IF t < 0 THEN 136460
+136460 LET v9 = 56
+136470 LET v9 = v9 * 3 + 0
+136480 LET t = t + v9 / 7
+136490 IF t < 0 THEN 136500
+136500 LET v10 = 60
+136510 LET v10 = v10 * 3 + 4
+136520 LET t = t + v10 / 7
+136530 IF t < 0 THEN 136540
+136540 LET v11 = 64
+136550 LET v11 = v11 * 3 + 8
+136560 LET t = t + v11 / 7
+136570 IF t < 0 THEN 136580
+136580 LET v12 = 68
+136590 LET v12 = v12 * 3 + 12
+136600 LET t = t + v12 / 7
+136610 IF t < 0 THEN 136620
+136620 LET v13 = 72
+136630 LET v13 = v13 * 3 + 3
+136640 LET t = t + v13 / 7
+136650 IF t < 0 THEN 136660
+136660 LET v14 = 76
+136670 LET v14 = v14 * 3 + 7
+136680 LET t = t + v14 / 7
+136690 IF t < 0 THEN 136700
+136700 LET v15 = 80
+136710 LET v15 = v15 * 3 + 11
+136720 LET t = t + v15 / 7
+136730 IF t < 0 THEN 136740
+136740 LET v16 = 84
+136750 LET v16 = v16 * 3 + 2
+136760 LET t = t + v16 / 7
+136770 IF t < 0 THEN 136780
+136780 LET v17 = 88
+136790 LET v17 = v17 * 3 + 6
+136800 LET t = t + v17 / 7
+136810 IF t < 0 THEN 136820
+136820 LET v18 = 92
+136830 LET v18 = v18 * 3 + 10
+136840 LET t = t + v18 / 7
+136850 IF t < 0 THEN 136860
+136860 LET v19 = 96
+136870 LET v19 = v19 * 3 + 1
+136880 LET t = t + v19 / 7
+136890 IF t < 0 THEN 136900
+136900 LET v20 = 3
+136910 LET v20 = v20 * 3 + 5
+136920 LET t = t + v20 / 7
+136930 IF t < 0 THEN 136940
+136940 LET v21 = 7
+136950 LET v21 = v21 * 3 + 9
+136960 LET t = t + v21 / 7
+136970 IF t < 0 THEN 136980
+136980 LET v22 = 11
+136990 LET v22 = v22 * 3 + 0
+137000 LET t = t + v22 / 7
+137010 IF t < 0 THEN 137020
+137020 LET v23 = 15
+137030 LET v23 = v23 * 3 + 4
+137040 LET t = t + v23 / 7
+137050 IF t < 0 THEN 137060
+137060 LET v24 = 19
+137070 LET v24 = v24 * 3 + 8
+137080 LET t = t + v24 / 7
+137090 IF t < 0 THEN 137100
+137100 LET v25 = 23
+137110 LET v25 = v25 * 3 + 12
+137120 LET t = t + v25 / 7
+137130 IF t < 0 THEN 137140
+137140 LET v26 = 27
+137150 LET v26 = v26 * 3 + 3
+137160 LET t = t + v26 / 7
+137170 IF t < 0 THEN 137180
+137180 LET v27 = 31
+137190 LET v27 = v27 * 3 + 7
+137200 LET t = t + v27 / 7
+137210 IF t < 0 THEN 137220
+137220 LET v28 = 35
+137230 LET v28 = v28 * 3 + 11
+137240 LET t = t + v28 / 7
+137250 IF t < 0 THEN 137260
+137260 LET v29 = 39
+137270 LET v29 = v29 * 3 + 2
+137280 LET t = t + v29 / 7
+137290 IF t < 0 THEN 137300
+137300 LET v30 = 43
+137310 LET v30 = v30 * 3 + 6
+137320 LET t = t + v30 / 7
+137330 IF t < 0 THEN 137340
+137340 LET v31 = 47
+137350 LET v31 = v31 * 3 + 10
+137360 LET t = t + v31 / 7
+137370 IF t < 0 THEN 137380
+137380 LET v32 = 51
+137390 LET v32 = v32 * 3 + 1
+137400 LET t = t + v32 / 7
+137410 IF t < 0 THEN 137420
+137420 LET v33 = 55
+137430 LET v33 = v33 * 3 + 5
+137440 LET t = t + v33 / 7
+137450 IF t < 0 THEN 137460
+137460 LET v34 = 59
+137470 LET v34 = v34 * 3 + 9
+137480 LET t = t + v34 / 7
+137490 IF t < 0 THEN 137500
+137500 LET v35 = 63
+137510 LET v35 = v35 * 3 + 0
+137520 LET t = t + v35 / 7
+137530 IF t < 0 THEN 137540
+137540 LET v36 = 67
+137550 LET v36 = v36 * 3 + 4
+137560 LET t = t + v36 / 7
+137570 IF t < 0 THEN 137580
+137580 LET v37 = 71
+137590 LET v37 = v37 * 3 + 8
+137600 LET t = t + v37 / 7
+137610 IF t < 0 THEN 137620
+137620 LET v38 = 75
+137630 LET v38 = v38 * 3 + 12
+137640 LET t = t + v38 / 7
+137650 IF t < 0 THEN 137660
+137660 LET v39 = 79
+137670 LET v39 = v39 * 3 + 3
+137680 LET t = t + v39 / 7
+137690 IF t < 0 THEN 137700
+137700 LET v40 = 83
+137710 LET v40 = v40 * 3 + 7
+137720 LET t = t + v40 / 7
+137730 IF t < 0 THEN 137740
+137740 LET v41 = 87
+137750 LET v41 = v41 * 3 + 11
+137760 LET t = t + v41 / 7
+137770 IF t < 0 THEN 137780
+137780 LET v42 = 91
+137790 LET v42 = v42 * 3 + 2
+137800 LET t = t + v42 / 7
+137810 IF t < 0 THEN 137820
+137820 LET v43 = 95
+137830 LET v43 = v43 * 3 + 6
+137840 LET t = t + v43 / 7
+137850 IF t < 0 THEN 137860
+137860 LET v44 = 2
+137870 LET v44 = v44 * 3 + 10
+137880 LET t = t + v44 / 7
+137890 IF t < 0 THEN 137900
+137900 LET v45 = 6
+137910 LET v45 = v45 * 3 + 1
+137920 LET t = t + v45 / 7
+137930 IF t < 0 THEN 137940
+137940 LET v46 = 10
+137950 LET v46 = v46 * 3 + 5
+137960 LET t = t + v46 / 7
+137970 IF t < 0 THEN 137980
+137980 LET v47 = 14
+137990 LET v47 = v47 * 3 + 9
+138000 LET t = t + v47 / 7
+138010 IF t < 0 THEN 138020
+138020 LET v48 = 18
+138030 LET v48 = v48 * 3 + 0
+138040 LET t = t + v48 / 7
+138050 IF t < 0 THEN 138060
+138060 LET v49 = 22
+138070 LET v49 = v49 * 3 + 4
+138080 LET t = t + v49 / 7
+138090 IF t < 0 THEN 138100
+138100 LET v0 = 26
+138110 LET v0 = v0 * 3 + 8
+138120 LET t = t + v0 / 7
+138130 IF t < 0 THEN 138140
+138140 LET v1 = 30
+138150 LET v1 = v1 * 3 + 12
+138160 LET t = t + v1 / 7
+138170 IF t < 0 THEN 138180
+138180 LET v2 = 34
+138190 LET v2 = v2 * 3 + 3
+138200 LET t = t + v2 / 7
+138210 IF t < 0 THEN 138220
+138220 LET v3 = 38
+138230 LET v3 = v3 * 3 + 7
+138240 LET t = t + v3 / 7
+138250 IF t < 0 THEN 138260
+138260 LET v4 = 42
+138270 LET v4 = v4 * 3 + 11
+138280 LET t = t + v4 / 7
+138290 IF t < 0 THEN 138300
+138300 LET v5 = 46
+138310 LET v5 = v5 * 3 + 2
+138320 LET t = t + v5 / 7
+138330 IF t < 0 THEN 138340
+138340 LET v6 = 50
+138350 LET v6 = v6 * 3 + 6
+138360 LET t = t + v6 / 7
+138370 IF t < 0 THEN 138380
+138380 LET v7 = 54
+138390 LET v7 = v7 * 3 + 10
+138400 LET t = t + v7 / 7
+138410 IF t < 0 THEN 138420
+138420 LET v8 = 58
+138430 LET v8 = v8 * 3 + 1
+138440 LET t = t + v8 / 7
+138450 IF t < 0 THEN 138460
+138460 LET v9 = 62
+138470 LET v9 = v9 * 3 + 5
+138480 LET t = t + v9 / 7
+138490 IF t < 0 THEN 138500
+138500 LET v10 = 66
+138510 LET v10 = v10 * 3 + 9
+138520 LET t = t + v10 / 7
+138530 IF t < 0 THEN 138540
+138540 LET v11 = 70
+138550 LET v11 = v11 * 3 + 0
+138560 LET t = t + v11 / 7
+138570 IF t < 0 THEN 138580
+138580 LET v12 = 74
+138590 LET v12 = v12 * 3 + 4
+138600 LET t = t + v12 / 7
+138610 IF t < 0 THEN 138620
+138620 LET v13 = 78
+138630 LET v13 = v13 * 3 + 8
+138640 LET t = t + v13 / 7
+138650 IF t < 0 THEN 138660
+138660 LET v14 = 82
+138670 LET v14 = v14 * 3 + 12
+138680 LET t = t + v14 / 7
+138690 IF t < 0 THEN 138700
+138700 LET v15 = 86
+138710 LET v15 = v15 * 3 + 3
+138720 LET t = t + v15 / 7
+138730 IF t < 0 THEN 138740
+138740 LET v16 = 90
+138750 LET v16 = v16 * 3 + 7
+138760 LET t = t + v16 / 7
+138770 IF t < 0 THEN 138780
+138780 LET v17 = 94
+138790 LET v17 = v17 * 3 + 11
+138800 LET t = t + v17 / 7
+138810 IF t < 0 THEN 138820
+138820 LET v18 = 1
+138830 LET v18 = v18 * 3 + 2
+138840 LET t = t + v18 / 7
+138850 IF t < 0 THEN 138860
+138860 LET v19 = 5
+138870 LET v19 = v19 * 3 + 6
+138880 LET t = t + v19 / 7
+138890 IF t < 0 THEN 138900
+138900 LET v20 = 9
+138910 LET v20 = v20 * 3 + 10
+138920 LET t = t + v20 / 7
+138930 IF t < 0 THEN 138940
+138940 LET v21 = 13
+138950 LET v21 = v21 * 3 + 1
+138960 LET t = t + v21 / 7
+138970 IF t < 0 THEN 138980
+138980 LET v22 = 17
+138990 LET v22 = v22 * 3 + 5
+139000 LET t = t + v22 / 7
+139010 IF t < 0 THEN 139020
+139020 LET v23 = 21
+139030 LET v23 = v23 * 3 + 9
+139040 LET t = t + v23 / 7
+139050 IF t < 0 THEN 139060
+139060 LET v24 = 25
+139070 LET v24 = v24 * 3 + 0
+139080 LET t = t + v24 / 7
+139090 IF t < 0 THEN 139100
+139100 LET v25 = 29
+139110 LET v25 = v25 * 3 + 4
+139120 LET t = t + v25 / 7
+139130 IF t < 0 THEN 139140
+139140 LET v26 = 33
+139150 LET v26 = v26 * 3 + 8
+139160 LET t = t + v26 / 7
+139170 IF t < 0 THEN 139180
+139180 LET v27 = 37
+139190 LET v27 = v27 * 3 + 12
+139200 LET t = t + v27 / 7
+139210 IF t < 0 THEN 139220
+139220 LET v28 = 41
+139230 LET v28 = v28 * 3 + 3
+139240 LET t = t + v28 / 7
+139250 IF t < 0 THEN 139260
+139260 LET v29 = 45
+139270 LET v29 = v29 * 3 + 7
+139280 LET t = t + v29 / 7
+139290 IF t < 0 THEN 139300
+139300 LET v30 = 49
+139310 LET v30 = v30 * 3 + 11
+139320 LET t = t + v30 / 7
+139330 IF t < 0 THEN 139340
+139340 LET v31 = 53
+139350 LET v31 = v31 * 3 + 2
+139360 LET t = t + v31 / 7
+139370 IF t < 0 THEN 139380
+139380 LET v32 = 57
+139390 LET v32 = v32 * 3 + 6
+139400 LET t = t + v32 / 7
+139410 IF t < 0 THEN 139420
+139420 LET v33 = 61
+139430 LET v33 = v33 * 3 + 10
+139440 LET t = t + v33 / 7
+139450 IF t < 0 THEN 139460
+139460 LET v34 = 65
+139470 LET v34 = v34 * 3 + 1
+139480 LET t = t + v34 / 7
+139490 IF t < 0 THEN 139500
+139500 LET v35 = 69
+139510 LET v35 = v35 * 3 + 5
+139520 LET t = t + v35 / 7
+139530 IF t < 0 THEN 139540
+139540 LET v36 = 73
+139550 LET v36 = v36 * 3 + 9
+139560 LET t = t + v36 / 7
+139570 IF t < 0 THEN 139580
+139580 LET v37 = 77
+139590 LET v37 = v37 * 3 + 0
+139600 LET t = t + v37 / 7
+139610 IF t < 0 THEN 139620
+139620 LET v38 = 81
+139630 LET v38 = v38 * 3 + 4
+139640 LET t = t + v38 / 7
+139650 IF t < 0 THEN 139660
+139660 LET v39 = 85
+139670 LET v39 = v39 * 3 + 8
+139680 LET t = t + v39 / 7
+139690 IF t < 0 THEN 139700
+139700 LET v40 = 89
+139710 LET v40 = v40 * 3 + 12
+139720 LET t = t + v40 / 7
+139730 IF t < 0 THEN 139740
+139740 LET v41 = 93
+139750 LET v41 = v41 * 3 + 3
+139760 LET t = t + v41 / 7
+139770 IF t < 0 THEN 139780
+139780 LET v42 = 0
+139790 LET v42 = v42 * 3 + 7
+139800 LET t = t + v42 / 7
+139810 IF t < 0 THEN 139820
+139820 LET v43 = 4
+139830 LET v43 = v43 * 3 + 11
+139840 LET t = t + v43 / 7
+139850 IF t < 0 THEN 139860
+139860 LET v44 = 8
+139870 LET v44 = v44 * 3 + 2
+139880 LET t = t + v44 / 7
+139890 IF t < 0 THEN 139900
+139900 LET v45 = 12
+139910 LET v45 = v45 * 3 + 6
+139920 LET t = t + v45 / 7
+139930 IF t < 0 THEN 139940
+139940 LET v46 = 16
+139950 LET v46 = v46 * 3 + 10
+139960 LET t = t + v46 / 7
+139970 IF t < 0 THEN 139980
+139980 LET v47 = 20
+139990 LET v47 = v47 * 3 + 1
+140000 LET t = t + v47 / 7
+140010 IF t < 0 THEN 140020
+140020 LET v48 = 24
+140030 LET v48 = v48 * 3 + 5
+140040 LET t = t + v48 / 7
+140050 IF t < 0 THEN 140060
+140060 LET v49 = 28
+140070 LET v49 = v49 * 3 + 9
+140080 LET t = t + v49 / 7
+140090 IF t < 0 THEN 140100
+140100 LET v0 = 32
+140110 LET v0 = v0 * 3 + 0
+140120 LET t = t + v0 / 7
+140130 IF t < 0 THEN 140140
+140140 LET v1 = 36
+140150 LET v1 = v1 * 3 + 4
+140160 LET t = t + v1 / 7
+140170 IF t < 0 THEN 140180
+140180 LET v2 = 40
+140190 LET v2 = v2 * 3 + 8
+140200 LET t = t + v2 / 7
+140210 IF t < 0 THEN 140220
+140220 LET v3 = 44
+140230 LET v3 = v3 * 3 + 12
+140240 LET t = t + v3 / 7
+140250 IF t < 0 THEN 140260
+140260 LET v4 = 48
+140270 LET v4 = v4 * 3 + 3
+140280 LET t = t + v4 / 7
+140290 IF t < 0 THEN 140300
+140300 LET v5 = 52
+140310 LET v5 = v5 * 3 + 7
+140320 LET t = t + v5 / 7
+140330 IF t < 0 THEN 140340
+140340 LET v6 = 56
+140350 LET v6 = v6 * 3 + 11
+140360 LET t = t + v6 / 7
+140370 IF t < 0 THEN 140380
+140380 LET v7 = 60
+140390 LET v7 = v7 * 3 + 2
+140400 LET t = t + v7 / 7
+140410 IF t < 0 THEN 140420
+140420 LET v8 = 64
+140430 LET v8 = v8 * 3 + 6
+140440 LET t = t + v8 / 7
+140450 IF t < 0 THEN 140460
+140460 LET v9 = 68
+140470 LET v9 = v9 * 3 + 10
+140480 LET t = t + v9 / 7
+140490 IF t < 0 THEN 140500
+140500 LET v10 = 72
+140510 LET v10 = v10 * 3 + 1
+140520 LET t = t + v10 / 7
+140530 IF t < 0 THEN 140540
+140540 LET v11 = 76
+140550 LET v11 = v11 * 3 + 5
+140560 LET t = t + v11 / 7
+140570 IF t < 0 THEN 140580
+140580 LET v12 = 80
+140590 LET v12 = v12 * 3 + 9
+140600 LET t = t + v12 / 7
+140610 IF t < 0 THEN 140620
+140620 LET v13 = 84
+140630 LET v13 = v13 * 3 + 0
+140640 LET t = t + v13 / 7
+140650 IF t < 0 THEN 140660
+140660 LET v14 = 88
+140670 LET v14 = v14 * 3 + 4
+140680 LET t = t + v14 / 7
+140690 IF t < 0 THEN 140700
+140700 LET v15 = 92
+140710 LET v15 = v15 * 3 + 8
+140720 LET t = t + v15 / 7
+140730 IF t < 0 THEN 140740
+140740 LET v16 = 96
+140750 LET v16 = v16 * 3 + 12
+140760 LET t = t + v16 / 7
+140770 IF t < 0 THEN 140780
+140780 LET v17 = 3
+140790 LET v17 = v17 * 3 + 3
+140800 LET t = t + v17 / 7
+140810 IF t < 0 THEN 140820
+140820 LET v18 = 7
+140830 LET v18 = v18 * 3 + 7
+140840 LET t = t + v18 / 7
+140850 IF t < 0 THEN 140860
+140860 LET v19 = 11
+140870 LET v19 = v19 * 3 + 11
+140880 LET t = t + v19 / 7
+140890 IF t < 0 THEN 140900
+140900 LET v20 = 15
+140910 LET v20 = v20 * 3 + 2
+140920 LET t = t + v20 / 7
+140930 IF t < 0 THEN 140940
+140940 LET v21 = 19
+140950 LET v21 = v21 * 3 + 6
+140960 LET t = t + v21 / 7
+140970 IF t < 0 THEN 140980
+140980 LET v22 = 23
+140990 LET v22 = v22 * 3 + 10
+141000 LET t = t + v22 / 7
+141010 IF t < 0 THEN 141020
+141020 LET v23 = 27
+141030 LET v23 = v23 * 3 + 1
+141040 LET t = t + v23 / 7
+141050 IF t < 0 THEN 141060
+141060 LET v24 = 31
+141070 LET v24 = v24 * 3 + 5
+141080 LET t = t + v24 / 7
+141090 IF t < 0 THEN 141100
+141100 LET v25 = 35
+141110 LET v25 = v25 * 3 + 9
+141120 LET t = t + v25 / 7
+141130 IF t < 0 THEN 141140
+141140 LET v26 = 39
+141150 LET v26 = v26 * 3 + 0
+141160 LET t = t + v26 / 7
+141170 IF t < 0 THEN 141180
+141180 LET v27 = 43
+141190 LET v27 = v27 * 3 + 4
+141200 LET t = t + v27 / 7
+141210 IF t < 0 THEN 141220
+141220 LET v28 = 47
+141230 LET v28 = v28 * 3 + 8
+141240 LET t = t + v28 / 7
+141250 IF t < 0 THEN 141260
+141260 LET v29 = 51
+141270 LET v29 = v29 * 3 + 12
+141280 LET t = t + v29 / 7
+141290 IF t < 0 THEN 141300
+141300 LET v30 = 55
+141310 LET v30 = v30 * 3 + 3
+141320 LET t = t + v30 / 7
+141330 IF t < 0 THEN 141340
+141340 LET v31 = 59
+141350 LET v31 = v31 * 3 + 7
+141360 LET t = t + v31 / 7
+141370 IF t < 0 THEN 141380
+141380 LET v32 = 63
+141390 LET v32 = v32 * 3 + 11
+141400 LET t = t + v32 / 7
+141410 IF t < 0 THEN 141420
+141420 LET v33 = 67
+141430 LET v33 = v33 * 3 + 2
+141440 LET t = t + v33 / 7
+141450 IF t < 0 THEN 141460
+141460 LET v34 = 71
+141470 LET v34 = v34 * 3 + 6
+141480 LET t = t + v34 / 7
+141490 IF t < 0 THEN 141500
+141500 LET v35 = 75
+141510 LET v35 = v35 * 3 + 10
+141520 LET t = t + v35 / 7
+141530 IF t < 0 THEN 141540
+141540 LET v36 = 79
+141550 LET v36 = v36 * 3 + 1
+141560 LET t = t + v36 / 7
+141570 IF t < 0 THEN 141580
+141580 LET v37 = 83
+141590 LET v37 = v37 * 3 + 5
+141600 LET t = t + v37 / 7
+141610 IF t < 0 THEN 141620
+141620 LET v38 = 87
+141630 LET v38 = v38 * 3 + 9
+141640 LET t = t + v38 / 7
+141650 IF t < 0 THEN 141660
+141660 LET v39 = 91
+141670 LET v39 = v39 * 3 + 0
+141680 LET t = t + v39 / 7
+141690 IF t < 0 THEN 141700
+141700 LET v40 = 95
+141710 LET v40 = v40 * 3 + 4
+141720 LET t = t + v40 / 7
+141730 IF t < 0 THEN 141740
+141740 LET v41 = 2
+141750 LET v41 = v41 * 3 + 8
+141760 LET t = t + v41 / 7
+141770 IF t < 0 THEN 141780
+141780 LET v42 = 6
+141790 LET v42 = v42 * 3 + 12
+141800 LET t = t + v42 / 7
+141810 IF t < 0 THEN 141820
+141820 LET v43 = 10
+141830 LET v43 = v43 * 3 + 3
+141840 LET t = t + v43 / 7
+141850 IF t < 0 THEN 141860
+141860 LET v44 = 14
+141870 LET v44 = v44 * 3 + 7
+141880 LET t = t + v44 / 7
+141890 IF t < 0 THEN 141900
+141900 LET v45 = 18
+141910 LET v45 = v45 * 3 + 11
+141920 LET t = t + v45 / 7
+141930 IF t < 0 THEN 141940
+141940 LET v46 = 22
+141950 LET v46 = v46 * 3 + 2
+141960 LET t = t + v46 / 7
+141970 IF t < 0 THEN 141980
+141980 LET v47 = 26
+141990 LET v47 = v47 * 3 + 6
+142000 LET t = t + v47 / 7
+142010 IF t < 0 THEN 142020
+142020 LET v48 = 30
+142030 LET v48 = v48 * 3 + 10
+142040 LET t = t + v48 / 7
+142050 IF t < 0 THEN 142060
+142060 LET v49 = 34
+142070 LET v49 = v49 * 3 + 1
+142080 LET t = t + v49 / 7
+142090 IF t < 0 THEN 142100
+142100 LET v0 = 38
+142110 LET v0 = v0 * 3 + 5
+142120 LET t = t + v0 / 7
+142130 IF t < 0 THEN 142140
+142140 LET v1 = 42
+142150 LET v1 = v1 * 3 + 9
+142160 LET t = t + v1 / 7
+142170 IF t < 0 THEN 142180
+142180 LET v2 = 46
+142190 LET v2 = v2 * 3 + 0
+142200 LET t = t + v2 / 7
+142210 IF t < 0 THEN 142220
+142220 LET v3 = 50
+142230 LET v3 = v3 * 3 + 4
+142240 LET t = t + v3 / 7
+142250 IF t < 0 THEN 142260
+142260 LET v4 = 54
+142270 LET v4 = v4 * 3 + 8
+142280 LET t = t + v4 / 7
+142290 IF t < 0 THEN 142300
+142300 LET v5 = 58
+142310 LET v5 = v5 * 3 + 12
+142320 LET t = t + v5 / 7
+142330 IF t < 0 THEN 142340
+142340 LET v6 = 62
+142350 LET v6 = v6 * 3 + 3
+142360 LET t = t + v6 / 7
+142370 IF t < 0 THEN 142380
+142380 LET v7 = 66
+142390 LET v7 = v7 * 3 + 7
+142400 LET t = t + v7 / 7
+142410 IF t < 0 THEN 142420
+142420 LET v8 = 70
+142430 LET v8 = v8 * 3 + 11
+142440 LET t = t + v8 / 7
+142450 IF t < 0 THEN 142460
+142460 LET v9 = 74
+142470 LET v9 = v9 * 3 + 2
+142480 LET t = t + v9 / 7
+142490 IF t < 0 THEN 142500
+142500 LET v10 = 78
+142510 LET v10 = v10 * 3 + 6
+142520 LET t = t + v10 / 7
+142530 IF t < 0 THEN 142540
+142540 LET v11 = 82
+142550 LET v11 = v11 * 3 + 10
+142560 LET t = t + v11 / 7
+142570 IF t < 0 THEN 142580
+142580 LET v12 = 86
+142590 LET v12 = v12 * 3 + 1
+142600 LET t = t + v12 / 7
+142610 IF t < 0 THEN 142620
+142620 LET v13 = 90
+142630 LET v13 = v13 * 3 + 5
+142640 LET t = t + v13 / 7
+142650 IF t < 0 THEN 142660
+142660 LET v14 = 94
+142670 LET v14 = v14 * 3 + 9
+142680 LET t = t + v14 / 7
+142690 IF t < 0 THEN 142700
+142700 LET v15 = 1
+142710 LET v15 = v15 * 3 + 0
+142720 LET t = t + v15 / 7
+142730 IF t < 0 THEN 142740
+142740 LET v16 = 5
+142750 LET v16 = v16 * 3 + 4
+142760 LET t = t + v16 / 7
+142770 IF t < 0 THEN 142780
+142780 LET v17 = 9
+142790 LET v17 = v17 * 3 + 8
+142800 LET t = t + v17 / 7
+142810 IF t < 0 THEN 142820
+142820 LET v18 = 13
+142830 LET v18 = v18 * 3 + 12
+142840 LET t = t + v18 / 7
+142850 IF t < 0 THEN 142860
+142860 LET v19 = 17
+142870 LET v19 = v19 * 3 + 3
+142880 LET t = t + v19 / 7
+142890 IF t < 0 THEN 142900
+142900 LET v20 = 21
+142910 LET v20 = v20 * 3 + 7
+142920 LET t = t + v20 / 7
+142930 IF t < 0 THEN 142940
+142940 LET v21 = 25
+142950 LET v21 = v21 * 3 + 11
+142960 LET t = t + v21 / 7
+142970 IF t < 0 THEN 142980
+142980 LET v22 = 29
+142990 LET v22 = v22 * 3 + 2
+143000 LET t = t + v22 / 7
+143010 IF t < 0 THEN 143020
+143020 LET v23 = 33
+143030 LET v23 = v23 * 3 + 6
+143040 LET t = t + v23 / 7
+143050 IF t < 0 THEN 143060
+143060 LET v24 = 37
+143070 LET v24 = v24 * 3 + 10
+143080 LET t = t + v24 / 7
+143090 IF t < 0 THEN 143100
+143100 LET v25 = 41
+143110 LET v25 = v25 * 3 + 1
+143120 LET t = t + v25 / 7
+143130 IF t < 0 THEN 143140
+143140 LET v26 = 45
+143150 LET v26 = v26 * 3 + 5
+143160 LET t = t + v26 / 7
+143170 IF t < 0 THEN 143180
+143180 LET v27 = 49
+143190 LET v27 = v27 * 3 + 9
+143200 LET t = t + v27 / 7
+143210 IF t < 0 THEN 143220
+143220 LET v28 = 53
+143230 LET v28 = v28 * 3 + 0
+143240 LET t = t + v28 / 7
+143250 IF t < 0 THEN 143260
+143260 LET v29 = 57
+143270 LET v29 = v29 * 3 + 4
+143280 LET t = t + v29 / 7
+143290 IF t < 0 THEN 143300
+143300 LET v30 = 61
+143310 LET v30 = v30 * 3 + 8
+143320 LET t = t + v30 / 7
+143330 IF t < 0 THEN 143340
+143340 LET v31 = 65
+143350 LET v31 = v31 * 3 + 12
+143360 LET t = t + v31 / 7
+143370 IF t < 0 THEN 143380
+143380 LET v32 = 69
+143390 LET v32 = v32 * 3 + 3
+143400 LET t = t + v32 / 7
+143410 IF t < 0 THEN 143420
+143420 LET v33 = 73
+143430 LET v33 = v33 * 3 + 7
+143440 LET t = t + v33 / 7
+143450 IF t < 0 THEN 143460
+143460 LET v34 = 77
+143470 LET v34 = v34 * 3 + 11
+143480 LET t = t + v34 / 7
+143490 IF t < 0 THEN 143500
+143500 LET v35 = 81
+143510 LET v35 = v35 * 3 + 2
+143520 LET t = t + v35 / 7
+143530 IF t < 0 THEN 143540
+143540 LET v36 = 85
+143550 LET v36 = v36 * 3 + 6
+143560 LET t = t + v36 / 7
+143570 IF t < 0 THEN 143580
+143580 LET v37 = 89
+143590 LET v37 = v37 * 3 + 10
+143600 LET t = t + v37 / 7
+143610 IF t < 0 THEN 143620
+143620 LET v38 = 93
+143630 LET v38 = v38 * 3 + 1
+143640 LET t = t + v38 / 7
+143650 IF t < 0 THEN 143660
+143660 LET v39 = 0
+143670 LET v39 = v39 * 3 + 5
+143680 LET t = t + v39 / 7
+143690 IF t < 0 THEN 143700
+143700 LET v40 = 4
+143710 LET v40 = v40 * 3 + 9
+143720 LET t = t + v40 / 7
+143730 IF t < 0 THEN 143740
+143740 LET v41 = 8
+143750 LET v41 = v41 * 3 + 0
+143760 LET t = t + v41 / 7
+143770 IF t < 0 THEN 143780
+143780 LET v42 = 12
+143790 LET v42 = v42 * 3 + 4
+143800 LET t = t + v42 / 7
+143810 IF t < 0 THEN 143820
+143820 LET v43 = 16
+143830 LET v43 = v43 * 3 + 8
+143840 LET t = t + v43 / 7
+143850 IF t < 0 THEN 143860
+143860 LET v44 = 20
+143870 LET v44 = v44 * 3 + 12
+143880 LET t = t + v44 / 7
+143890 IF t < 0 THEN 143900
+143900 LET v45 = 24
+143910 LET v45 = v45 * 3 + 3
+143920 LET t = t + v45 / 7
+143930 IF t < 0 THEN 143940
+143940 LET v46 = 28
+143950 LET v46 = v46 * 3 + 7
+143960 LET t = t + v46 / 7
+143970 IF t < 0 THEN 143980
+143980 LET v47 = 32
+143990 LET v47 = v47 * 3 + 11
+144000 LET t = t + v47 / 7
+144010 IF t < 0 THEN 144020
+144020 LET v48 = 36
+144030 LET v48 = v48 * 3 + 2
+144040 LET t = t + v48 / 7
+144050 IF t < 0 THEN 144060
+144060 LET v49 = 40
+144070 LET v49 = v49 * 3 + 6
+144080 LET t = t + v49 / 7
+144090 IF t < 0 THEN 144100
+144100 LET v0 = 44
+144110 LET v0 = v0 * 3 + 10
+144120 LET t = t + v0 / 7
+144130 IF t < 0 THEN 144140
+144140 LET v1 = 48
+144150 LET v1 = v1 * 3 + 1
+144160 LET t = t + v1 / 7
+144170 IF t < 0 THEN 144180
+144180 LET v2 = 52
+144190 LET v2 = v2 * 3 + 5
+144200 LET t = t + v2 / 7
+144210 IF t < 0 THEN 144220
+144220 LET v3 = 56
+144230 LET v3 = v3 * 3 + 9
+144240 LET t = t + v3 / 7
+144250 IF t < 0 THEN 144260
+144260 LET v4 = 60
+144270 LET v4 = v4 * 3 + 0
+144280 LET t = t + v4 / 7
+144290 IF t < 0 THEN 144300
+144300 LET v5 = 64
+144310 LET v5 = v5 * 3 + 4
+144320 LET t = t + v5 / 7
+144330 IF t < 0 THEN 144340
+144340 LET v6 = 68
+144350 LET v6 = v6 * 3 + 8
+144360 LET t = t + v6 / 7
+144370 IF t < 0 THEN 144380
+144380 LET v7 = 72
+144390 LET v7 = v7 * 3 + 12
+144400 LET t = t + v7 / 7
+144410 IF t < 0 THEN 144420
+144420 LET v8 = 76
+144430 LET v8 = v8 * 3 + 3
+144440 LET t = t + v8 / 7
+144450 IF t < 0 THEN 144460
+144460 LET v9 = 80
+144470 LET v9 = v9 * 3 + 7
+144480 LET t = t + v9 / 7
+144490 IF t < 0 THEN 144500
+144500 LET v10 = 84
+144510 LET v10 = v10 * 3 + 11
+144520 LET t = t + v10 / 7
+144530 IF t < 0 THEN 144540
+144540 LET v11 = 88
+144550 LET v11 = v11 * 3 + 2
+144560 LET t = t + v11 / 7
+144570 IF t < 0 THEN 144580
+144580 LET v12 = 92
+144590 LET v12 = v12 * 3 + 6
+144600 LET t = t + v12 / 7
+144610 IF t < 0 THEN 144620
+144620 LET v13 = 96
+144630 LET v13 = v13 * 3 + 10
+144640 LET t = t + v13 / 7
+144650 IF t < 0 THEN 144660
+144660 LET v14 = 3
+144670 LET v14 = v14 * 3 + 1
+144680 LET t = t + v14 / 7
+144690 IF t < 0 THEN 144700
+144700 LET v15 = 7
+144710 LET v15 = v15 * 3 + 5
+144720 LET t = t + v15 / 7
+144730 IF t < 0 THEN 144740
+144740 LET v16 = 11
+144750 LET v16 = v16 * 3 + 9
+144760 LET t = t + v16 / 7
+144770 IF t < 0 THEN 144780
+144780 LET v17 = 15
+144790 LET v17 = v17 * 3 + 0
+144800 LET t = t + v17 / 7
+144810 IF t < 0 THEN 144820
+144820 LET v18 = 19
+144830 LET v18 = v18 * 3 + 4
+144840 LET t = t + v18 / 7
+144850 IF t < 0 THEN 144860
+144860 LET v19 = 23
+144870 LET v19 = v19 * 3 + 8
+144880 LET t = t + v19 / 7
+144890 IF t < 0 THEN 144900
+144900 LET v20 = 27
+144910 LET v20 = v20 * 3 + 12
+144920 LET t = t + v20 / 7
+144930 IF t < 0 THEN 144940
+144940 LET v21 = 31
+144950 LET v21 = v21 * 3 + 3
+144960 LET t = t + v21 / 7
+144970 IF t < 0 THEN 144980
+144980 LET v22 = 35
+144990 LET v22 = v22 * 3 + 7
+145000 LET t = t + v22 / 7
+145010 IF t < 0 THEN 145020
+145020 LET v23 = 39
+145030 LET v23 = v23 * 3 + 11
+145040 LET t = t + v23 / 7
+145050 IF t < 0 THEN 145060
+145060 LET v24 = 43
+145070 LET v24 = v24 * 3 + 2
+145080 LET t = t + v24 / 7
+145090 IF t < 0 THEN 145100
+145100 LET v25 = 47
+145110 LET v25 = v25 * 3 + 6
+145120 LET t = t + v25 / 7
+145130 IF t < 0 THEN 145140
+145140 LET v26 = 51
+145150 LET v26 = v26 * 3 + 10
+145160 LET t = t + v26 / 7
+145170 IF t < 0 THEN 145180
+145180 LET v27 = 55
+145190 LET v27 = v27 * 3 + 1
+145200 LET t = t + v27 / 7
+145210 IF t < 0 THEN 145220
+145220 LET v28 = 59
+145230 LET v28 = v28 * 3 + 5
+145240 LET t = t + v28 / 7
+145250 IF t < 0 THEN 145260
+145260 LET v29 = 63
+145270 LET v29 = v29 * 3 + 9
+145280 LET t = t + v29 / 7
+145290 IF t < 0 THEN 145300
+145300 LET v30 = 67
+145310 LET v30 = v30 * 3 + 0
+145320 LET t = t + v30 / 7
+145330 IF t < 0 THEN 145340
+145340 LET v31 = 71
+145350 LET v31 = v31 * 3 + 4
+145360 LET t = t + v31 / 7
+145370 IF t < 0 THEN 145380
+145380 LET v32 = 75
+145390 LET v32 = v32 * 3 + 8
+145400 LET t = t + v32 / 7
+145410 IF t < 0 THEN 145420
+145420 LET v33 = 79
+145430 LET v33 = v33 * 3 + 12
+145440 LET t = t + v33 / 7
+145450 IF t < 0 THEN 145460
+145460 LET v34 = 83
+145470 LET v34 = v34 * 3 + 3
+145480 LET t = t + v34 / 7
+145490 IF t < 0 THEN 145500
+145500 LET v35 = 87
+145510 LET v35 = v35 * 3 + 7
+145520 LET t = t + v35 / 7
+145530 IF t < 0 THEN 145540
+145540 LET v36 = 91
+145550 LET v36 = v36 * 3 + 11
+145560 LET t = t + v36 / 7
+145570 IF t < 0 THEN 145580
+145580 LET v37 = 95
+145590 LET v37 = v37 * 3 + 2
+145600 LET t = t + v37 / 7
+145610 IF t < 0 THEN 145620
+145620 LET v38 = 2
+145630 LET v38 = v38 * 3 + 6
+145640 LET t = t + v38 / 7
+145650 IF t < 0 THEN 145660
+145660 LET v39 = 6
+145670 LET v39 = v39 * 3 + 10
+145680 LET t = t + v39 / 7
+145690 IF t < 0 THEN 145700
+145700 LET v40 = 10
+145710 LET v40 = v40 * 3 + 1
+145720 LET t = t + v40 / 7
+145730 IF t < 0 THEN 145740
+145740 LET v41 = 14
+145750 LET v41 = v41 * 3 + 5
+145760 LET t = t + v41 / 7
+145770 IF t < 0 THEN 145780
+145780 LET v42 = 18
+145790 LET v42 = v42 * 3 + 9
+145800 LET t = t + v42 / 7
+145810 IF t < 0 THEN 145820
+145820 LET v43 = 22
+145830 LET v43 = v43 * 3 + 0
+145840 LET t = t + v43 / 7
+145850 IF t < 0 THEN 145860
+145860 LET v44 = 26
+145870 LET v44 = v44 * 3 + 4
+145880 LET t = t + v44 / 7
+145890 IF t < 0 THEN 145900
+145900 LET v45 = 30
+145910 LET v45 = v45 * 3 + 8
+145920 LET t = t + v45 / 7
+145930 IF t < 0 THEN 145940
+145940 LET v46 = 34
+145950 LET v46 = v46 * 3 + 12
+145960 LET t = t + v46 / 7
+145970 IF t < 0 THEN 145980
+145980 LET v47 = 38
+145990 LET v47 = v47 * 3 + 3
+146000 LET t = t + v47 / 7
+146010 IF t < 0 THEN 146020
+146020 LET v48 = 42
+146030 LET v48 = v48 * 3 + 7
+146040 LET t = t + v48 / 7
+146050 IF t < 0 THEN 146060
+146060 LET v49 = 46
+146070 LET v49 = v49 * 3 + 11
+146080 LET t = t + v49 / 7
+146090 IF t < 0 THEN 146100
+146100 LET v0 = 50
+146110 LET v0 = v0 * 3 + 2
+146120 LET t = t + v0 / 7
+146130 IF t < 0 THEN 146140
+146140 LET v1 = 54
+146150 LET v1 = v1 * 3 + 6
+146160 LET t = t + v1 / 7
+146170 IF t < 0 THEN 146180
+146180 LET v2 = 58
+146190 LET v2 = v2 * 3 + 10
+146200 LET t = t + v2 / 7
+146210 IF t < 0 THEN 146220
+146220 LET v3 = 62
+146230 LET v3 = v3 * 3 + 1
+146240 LET t = t + v3 / 7
+146250 IF t < 0 THEN 146260
+146260 LET v4 = 66
+146270 LET v4 = v4 * 3 + 5
+146280 LET t = t + v4 / 7
+146290 IF t < 0 THEN 146300
+146300 LET v5 = 70
+146310 LET v5 = v5 * 3 + 9
+146320 LET t = t + v5 / 7
+146330 IF t < 0 THEN 146340
+146340 LET v6 = 74
+146350 LET v6 = v6 * 3 + 0
+146360 LET t = t + v6 / 7
+146370 IF t < 0 THEN 146380
+146380 LET v7 = 78
+146390 LET v7 = v7 * 3 + 4
+146400 LET t = t + v7 / 7
+146410 IF t < 0 THEN 146420
+146420 LET v8 = 82
+146430 LET v8 = v8 * 3 + 8
+146440 LET t = t + v8 / 7
+146450 IF t < 0 THEN 146460
+146460 LET v9 = 86
+146470 LET v9 = v9 * 3 + 12
+146480 LET t = t + v9 / 7
+146490 IF t < 0 THEN 146500
+146500 LET v10 = 90
+146510 LET v10 = v10 * 3 + 3
+146520 LET t = t + v10 / 7
+146530 IF t < 0 THEN 146540
+146540 LET v11 = 94
+146550 LET v11 = v11 * 3 + 7
+146560 LET t = t + v11 / 7
+146570 IF t < 0 THEN 146580
+146580 LET v12 = 1
+146590 LET v12 = v12 * 3 + 11
+146600 LET t = t + v12 / 7
+146610 IF t < 0 THEN 146620
+146620 LET v13 = 5
+146630 LET v13 = v13 * 3 + 2
+146640 LET t = t + v13 / 7
+146650 IF t < 0 THEN 146660
+146660 LET v14 = 9
+146670 LET v14 = v14 * 3 + 6
+146680 LET t = t + v14 / 7
+146690 IF t < 0 THEN 146700
+146700 LET v15 = 13
+146710 LET v15 = v15 * 3 + 10
+146720 LET t = t + v15 / 7
+146730 IF t < 0 THEN 146740
+146740 LET v16 = 17
+146750 LET v16 = v16 * 3 + 1
+146760 LET t = t + v16 / 7
+146770 IF t < 0 THEN 146780
+146780 LET v17 = 21
+146790 LET v17 = v17 * 3 + 5
+146800 LET t = t + v17 / 7
+146810 IF t < 0 THEN 146820
+146820 LET v18 = 25
+146830 LET v18 = v18 * 3 + 9
+146840 LET t = t + v18 / 7
+146850 IF t < 0 THEN 146860
+146860 LET v19 = 29
+146870 LET v19 = v19 * 3 + 0
+146880 LET t = t + v19 / 7
+146890 IF t < 0 THEN 146900
+146900 LET v20 = 33
+146910 LET v20 = v20 * 3 + 4
+146920 LET t = t + v20 / 7
+146930 IF t < 0 THEN 146940
+146940 LET v21 = 37
+146950 LET v21 = v21 * 3 + 8
+146960 LET t = t + v21 / 7
+146970 IF t < 0 THEN 146980
+146980 LET v22 = 41
+146990 LET v22 = v22 * 3 + 12
+147000 LET t = t + v22 / 7
+147010 IF t < 0 THEN 147020
+147020 LET v23 = 45
+147030 LET v23 = v23 * 3 + 3
+147040 LET t = t + v23 / 7
+147050 IF t < 0 THEN 147060
+147060 LET v24 = 49
+147070 LET v24 = v24 * 3 + 7
+147080 LET t = t + v24 / 7
+147090 IF t < 0 THEN 147100
+147100 LET v25 = 53
+147110 LET v25 = v25 * 3 + 11
+147120 LET t = t + v25 / 7
+147130 IF t < 0 THEN 147140
+147140 LET v26 = 57
+147150 LET v26 = v26 * 3 + 2
+147160 LET t = t + v26 / 7
+147170 IF t < 0 THEN 147180
+147180 LET v27 = 61
+147190 LET v27 = v27 * 3 + 6
+147200 LET t = t + v27 / 7
+147210 IF t < 0 THEN 147220
+147220 LET v28 = 65
+147230 LET v28 = v28 * 3 + 10
+147240 LET t = t + v28 / 7
+147250 IF t < 0 THEN 147260
+147260 LET v29 = 69
+147270 LET v29 = v29 * 3 + 1
+147280 LET t = t + v29 / 7
+147290 IF t < 0 THEN 147300
+147300 LET v30 = 73
+147310 LET v30 = v30 * 3 + 5
+147320 LET t = t + v30 / 7
+147330 IF t < 0 THEN 147340
+147340 LET v31 = 77
+147350 LET v31 = v31 * 3 + 9
+147360 LET t = t + v31 / 7
+147370 IF t < 0 THEN 147380
+147380 LET v32 = 81
+147390 LET v32 = v32 * 3 + 0
+147400 LET t = t + v32 / 7
+147410 IF t < 0 THEN 147420
+147420 LET v33 = 85
+147430 LET v33 = v33 * 3 + 4
+147440 LET t = t + v33 / 7
+147450 IF t < 0 THEN 147460
+147460 LET v34 = 89
+147470 LET v34 = v34 * 3 + 8
+147480 LET t = t + v34 / 7
+147490 IF t < 0 THEN 147500
+147500 LET v35 = 93
+147510 LET v35 = v35 * 3 + 12
+147520 LET t = t + v35 / 7
+147530 IF t < 0 THEN 147540
+147540 LET v36 = 0
+147550 LET v36 = v36 * 3 + 3
+147560 LET t = t + v36 / 7
+147570 IF t < 0 THEN 147580
+147580 LET v37 = 4
+147590 LET v37 = v37 * 3 + 7
+147600 LET t = t + v37 / 7
+147610 IF t < 0 THEN 147620
+147620 LET v38 = 8
+147630 LET v38 = v38 * 3 + 11
+147640 LET t = t + v38 / 7
+147650 IF t < 0 THEN 147660
+147660 LET v39 = 12
+147670 LET v39 = v39 * 3 + 2
+147680 LET t = t + v39 / 7
+147690 IF t < 0 THEN 147700
+147700 LET v40 = 16
+147710 LET v40 = v40 * 3 + 6
+147720 LET t = t + v40 / 7
+147730 IF t < 0 THEN 147740
+147740 LET v41 = 20
+147750 LET v41 = v41 * 3 + 10
+147760 LET t = t + v41 / 7
+147770 IF t < 0 THEN 147780
+147780 LET v42 = 24
+147790 LET v42 = v42 * 3 + 1
+147800 LET t = t + v42 / 7
+147810 IF t < 0 THEN 147820
+147820 LET v43 = 28
+147830 LET v43 = v43 * 3 + 5
+147840 LET t = t + v43 / 7
+147850 IF t < 0 THEN 147860
+147860 LET v44 = 32
+147870 LET v44 = v44 * 3 + 9
+147880 LET t = t + v44 / 7
+147890 IF t < 0 THEN 147900
+147900 LET v45 = 36
+147910 LET v45 = v45 * 3 + 0
+147920 LET t = t + v45 / 7
+147930 IF t < 0 THEN 147940
+147940 LET v46 = 40
+147950 LET v46 = v46 * 3 + 4
+147960 LET t = t + v46 / 7
+147970 IF t < 0 THEN 147980
+147980 LET v47 = 44
+147990 LET v47 = v47 * 3 + 8
+148000 LET t = t + v47 / 7
+148010 IF t < 0 THEN 148020
+148020 LET v48 = 48
+148030 LET v48 = v48 * 3 + 12
+148040 LET t = t + v48 / 7
+148050 IF t < 0 THEN 148060
+148060 LET v49 = 52
+148070 LET v49 = v49 * 3 + 3
+148080 LET t = t + v49 / 7
+148090 IF t < 0 THEN 148100
+148100 LET v0 = 56
+148110 LET v0 = v0 * 3 + 7
+148120 LET t = t + v0 / 7
+148130 IF t < 0 THEN 148140
+148140 LET v1 = 60
+148150 LET v1 = v1 * 3 + 11
+148160 LET t = t + v1 / 7
+148170 IF t < 0 THEN 148180
+148180 LET v2 = 64
+148190 LET v2 = v2 * 3 + 2
+148200 LET t = t + v2 / 7
+148210 IF t < 0 THEN 148220
+148220 LET v3 = 68
+148230 LET v3 = v3 * 3 + 6
+148240 LET t = t + v3 / 7
+148250 IF t < 0 THEN 148260
+148260 LET v4 = 72
+148270 LET v4 = v4 * 3 + 10
+148280 LET t = t + v4 / 7
+148290 IF t < 0 THEN 148300
+148300 LET v5 = 76
+148310 LET v5 = v5 * 3 + 1
+148320 LET t = t + v5 / 7
+148330 IF t < 0 THEN 148340
+148340 LET v6 = 80
+148350 LET v6 = v6 * 3 + 5
+148360 LET t = t + v6 / 7
+148370 IF t < 0 THEN 148380
+148380 LET v7 = 84
+148390 LET v7 = v7 * 3 + 9
+148400 LET t = t + v7 / 7
+148410 IF t < 0 THEN 148420
+148420 LET v8 = 88
+148430 LET v8 = v8 * 3 + 0
+148440 LET t = t + v8 / 7
+148450 IF t < 0 THEN 148460
+148460 LET v9 = 92
+148470 LET v9 = v9 * 3 + 4
+148480 LET t = t + v9 / 7
+148490 IF t < 0 THEN 148500
+148500 LET v10 = 96
+148510 LET v10 = v10 * 3 + 8
+148520 LET t = t + v10 / 7
+148530 IF t < 0 THEN 148540
+148540 LET v11 = 3
+148550 LET v11 = v11 * 3 + 12
+148560 LET t = t + v11 / 7
+148570 IF t < 0 THEN 148580
+148580 LET v12 = 7
+148590 LET v12 = v12 * 3 + 3
+148600 LET t = t + v12 / 7
+148610 IF t < 0 THEN 148620
+148620 LET v13 = 11
+148630 LET v13 = v13 * 3 + 7
+148640 LET t = t + v13 / 7
+148650 IF t < 0 THEN 148660
+148660 LET v14 = 15
+148670 LET v14 = v14 * 3 + 11
+148680 LET t = t + v14 / 7
+148690 IF t < 0 THEN 148700
+148700 LET v15 = 19
+148710 LET v15 = v15 * 3 + 2
+148720 LET t = t + v15 / 7
+148730 IF t < 0 THEN 148740
+148740 LET v16 = 23
+148750 LET v16 = v16 * 3 + 6
+148760 LET t = t + v16 / 7
+148770 IF t < 0 THEN 148780
+148780 LET v17 = 27
+148790 LET v17 = v17 * 3 + 10
+148800 LET t = t + v17 / 7
+148810 IF t < 0 THEN 148820
+148820 LET v18 = 31
+148830 LET v18 = v18 * 3 + 1
+148840 LET t = t + v18 / 7
+148850 IF t < 0 THEN 148860
+148860 LET v19 = 35
+148870 LET v19 = v19 * 3 + 5
+148880 LET t = t + v19 / 7
+148890 IF t < 0 THEN 148900
+148900 LET v20 = 39
+148910 LET v20 = v20 * 3 + 9
+148920 LET t = t + v20 / 7
+148930 IF t < 0 THEN 148940
+148940 LET v21 = 43
+148950 LET v21 = v21 * 3 + 0
+148960 LET t = t + v21 / 7
+148970 IF t < 0 THEN 148980
+148980 LET v22 = 47
+148990 LET v22 = v22 * 3 + 4
+149000 LET t = t + v22 / 7
+149010 IF t < 0 THEN 149020
+149020 LET v23 = 51
+149030 LET v23 = v23 * 3 + 8
+149040 LET t = t + v23 / 7
+149050 IF t < 0 THEN 149060
+149060 LET v24 = 55
+149070 LET v24 = v24 * 3 + 12
+149080 LET t = t + v24 / 7
+149090 IF t < 0 THEN 149100
+149100 LET v25 = 59
+149110 LET v25 = v25 * 3 + 3
+149120 LET t = t + v25 / 7
+149130 IF t < 0 THEN 149140
+149140 LET v26 = 63
+149150 LET v26 = v26 * 3 + 7
+149160 LET t = t + v26 / 7
+149170 IF t < 0 THEN 149180
+149180 LET v27 = 67
+149190 LET v27 = v27 * 3 + 11
+149200 LET t = t + v27 / 7
+149210 IF t < 0 THEN 149220
+149220 LET v28 = 71
+149230 LET v28 = v28 * 3 + 2
+149240 LET t = t + v28 / 7
+149250 IF t < 0 THEN 149260
+149260 LET v29 = 75
+149270 LET v29 = v29 * 3 + 6
+149280 LET t = t + v29 / 7
+149290 IF t < 0 THEN 149300
+149300 LET v30 = 79
+149310 LET v30 = v30 * 3 + 10
+149320 LET t = t + v30 / 7
+149330 IF t < 0 THEN 149340
+149340 LET v31 = 83
+149350 LET v31 = v31 * 3 + 1
+149360 LET t = t + v31 / 7
+149370 IF t < 0 THEN 149380
+149380 LET v32 = 87
+149390 LET v32 = v32 * 3 + 5
+149400 LET t = t + v32 / 7
+149410 IF t < 0 THEN 149420
+149420 LET v33 = 91
+149430 LET v33 = v33 * 3 + 9
+149440 LET t = t + v33 / 7
+149450 IF t < 0 THEN 149460
+149460 LET v34 = 95
+149470 LET v34 = v34 * 3 + 0
+149480 LET t = t + v34 / 7
+149490 IF t < 0 THEN 149500
+149500 LET v35 = 2
+149510 LET v35 = v35 * 3 + 4
+149520 LET t = t + v35 / 7
+149530 IF t < 0 THEN 149540
+149540 LET v36 = 6
+149550 LET v36 = v36 * 3 + 8
+149560 LET t = t + v36 / 7
+149570 IF t < 0 THEN 149580
+149580 LET v37 = 10
+149590 LET v37 = v37 * 3 + 12
+149600 LET t = t + v37 / 7
+149610 IF t < 0 THEN 149620
+149620 LET v38 = 14
+149630 LET v38 = v38 * 3 + 3
+149640 LET t = t + v38 / 7
+149650 IF t < 0 THEN 149660
+149660 LET v39 = 18
+149670 LET v39 = v39 * 3 + 7
+149680 LET t = t + v39 / 7
+149690 IF t < 0 THEN 149700
+149700 LET v40 = 22
+149710 LET v40 = v40 * 3 + 11
+149720 LET t = t + v40 / 7
+149730 IF t < 0 THEN 149740
+149740 LET v41 = 26
+149750 LET v41 = v41 * 3 + 2
+149760 LET t = t + v41 / 7
+149770 IF t < 0 THEN 149780
+149780 LET v42 = 30
+149790 LET v42 = v42 * 3 + 6
+149800 LET t = t + v42 / 7
+149810 IF t < 0 THEN 149820
+149820 LET v43 = 34
+149830 LET v43 = v43 * 3 + 10
+149840 LET t = t + v43 / 7
+149850 IF t < 0 THEN 149860
+149860 LET v44 = 38
+149870 LET v44 = v44 * 3 + 1
+149880 LET t = t + v44 / 7
+149890 IF t < 0 THEN 149900
+149900 LET v45 = 42
+149910 LET v45 = v45 * 3 + 5
+149920 LET t = t + v45 / 7
+149930 IF t < 0 THEN 149940
+149940 LET v46 = 46
+149950 LET v46 = v46 * 3 + 9
+149960 LET t = t + v46 / 7
+149970 IF t < 0 THEN 149980
+149980 LET v47 = 50
+149990 LET v47 = v47 * 3 + 0
+150000 LET t = t + v47 / 7
+150010 IF t < 0 THEN 150020
+150020 LET v48 = 54
+150030 LET v48 = v48 * 3 + 4
+150040 LET t = t + v48 / 7
+150050 IF t < 0 THEN 150060
+150060 LET v49 = 58
+150070 LET v49 = v49 * 3 + 8
+150080 LET t = t + v49 / 7
+150090 IF t < 0 THEN 150100
+150100 LET v0 = 62
+150110 LET v0 = v0 * 3 + 12
+150120 LET t = t + v0 / 7
+150130 IF t < 0 THEN 150140
+150140 LET v1 = 66
+150150 LET v1 = v1 * 3 + 3
+150160 LET t = t + v1 / 7
+150170 IF t < 0 THEN 150180
+150180 LET v2 = 70
+150190 LET v2 = v2 * 3 + 7
+150200 LET t = t + v2 / 7
+150210 IF t < 0 THEN 150220
+150220 LET v3 = 74
+150230 LET v3 = v3 * 3 + 11
+150240 LET t = t + v3 / 7
+150250 IF t < 0 THEN 150260
+150260 LET v4 = 78
+150270 LET v4 = v4 * 3 + 2
+150280 LET t = t + v4 / 7
+150290 IF t < 0 THEN 150300
+150300 LET v5 = 82
+150310 LET v5 = v5 * 3 + 6
+150320 LET t = t + v5 / 7
+150330 IF t < 0 THEN 150340
+150340 LET v6 = 86
+150350 LET v6 = v6 * 3 + 10
+150360 LET t = t + v6 / 7
+150370 IF t < 0 THEN 150380
+150380 LET v7 = 90
+150390 LET v7 = v7 * 3 + 1
+150400 LET t = t + v7 / 7
+150410 IF t < 0 THEN 150420
+150420 LET v8 = 94
+150430 LET v8 = v8 * 3 + 5
+150440 LET t = t + v8 / 7
+150450 IF t < 0 THEN 150460
+150460 LET v9 = 1
+150470 LET v9 = v9 * 3 + 9
+150480 LET t = t + v9 / 7
+150490 IF t < 0 THEN 150500
+150500 LET v10 = 5
+150510 LET v10 = v10 * 3 + 0
+150520 LET t = t + v10 / 7
+150530 IF t < 0 THEN 150540
+150540 LET v11 = 9
+150550 LET v11 = v11 * 3 + 4
+150560 LET t = t + v11 / 7
+150570 IF t < 0 THEN 150580
+150580 LET v12 = 13
+150590 LET v12 = v12 * 3 + 8
+150600 LET t = t + v12 / 7
+150610 IF t < 0 THEN 150620
+150620 LET v13 = 17
+150630 LET v13 = v13 * 3 + 12
+150640 LET t = t + v13 / 7
+150650 IF t < 0 THEN 150660
+150660 LET v14 = 21
+150670 LET v14 = v14 * 3 + 3
+150680 LET t = t + v14 / 7
+150690 IF t < 0 THEN 150700
+150700 LET v15 = 25
+150710 LET v15 = v15 * 3 + 7
+150720 LET t = t + v15 / 7
+150730 IF t < 0 THEN 150740
+150740 LET v16 = 29
+150750 LET v16 = v16 * 3 + 11
+150760 LET t = t + v16 / 7
+150770 IF t < 0 THEN 150780
+150780 LET v17 = 33
+150790 LET v17 = v17 * 3 + 2
+150800 LET t = t + v17 / 7
+150810 IF t < 0 THEN 150820
+150820 LET v18 = 37
+150830 LET v18 = v18 * 3 + 6
+150840 LET t = t + v18 / 7
+150850 IF t < 0 THEN 150860
+150860 LET v19 = 41
+150870 LET v19 = v19 * 3 + 10
+150880 LET t = t + v19 / 7
+150890 IF t < 0 THEN 150900
+150900 LET v20 = 45
+150910 LET v20 = v20 * 3 + 1
+150920 LET t = t + v20 / 7
+150930 IF t < 0 THEN 150940
+150940 LET v21 = 49
+150950 LET v21 = v21 * 3 + 5
+150960 LET t = t + v21 / 7
+150970 IF t < 0 THEN 150980
+150980 LET v22 = 53
+150990 LET v22 = v22 * 3 + 9
+151000 LET t = t + v22 / 7
+151010 IF t < 0 THEN 151020
+151020 LET v23 = 57
+151030 LET v23 = v23 * 3 + 0
+151040 LET t = t + v23 / 7
+151050 IF t < 0 THEN 151060
+151060 LET v24 = 61
+151070 LET v24 = v24 * 3 + 4
+151080 LET t = t + v24 / 7
+151090 IF t < 0 THEN 151100
+151100 LET v25 = 65
+151110 LET v25 = v25 * 3 + 8
+151120 LET t = t + v25 / 7
+151130 IF t < 0 THEN 151140
+151140 LET v26 = 69
+151150 LET v26 = v26 * 3 + 12
+151160 LET t = t + v26 / 7
+151170 IF t < 0 THEN 151180
+151180 LET v27 = 73
+151190 LET v27 = v27 * 3 + 3
+151200 LET t = t + v27 / 7
+151210 IF t < 0 THEN 151220
+151220 LET v28 = 77
+151230 LET v28 = v28 * 3 + 7
+151240 LET t = t + v28 / 7
+151250 IF t < 0 THEN 151260
+151260 LET v29 = 81
+151270 LET v29 = v29 * 3 + 11
+151280 LET t = t + v29 / 7
+151290 IF t < 0 THEN 151300
+151300 LET v30 = 85
+151310 LET v30 = v30 * 3 + 2
+151320 LET t = t + v30 / 7
+151330 IF t < 0 THEN 151340
+151340 LET v31 = 89
+151350 LET v31 = v31 * 3 + 6
+151360 LET t = t + v31 / 7
+151370 IF t < 0 THEN 151380
+151380 LET v32 = 93
+151390 LET v32 = v32 * 3 + 10
+151400 LET t = t + v32 / 7
+151410 IF t < 0 THEN 151420
+151420 LET v33 = 0
+151430 LET v33 = v33 * 3 + 1
+151440 LET t = t + v33 / 7
+151450 IF t < 0 THEN 151460
+151460 LET v34 = 4
+151470 LET v34 = v34 * 3 + 5
+151480 LET t = t + v34 / 7
+151490 IF t < 0 THEN 151500
+151500 LET v35 = 8
+151510 LET v35 = v35 * 3 + 9
+151520 LET t = t + v35 / 7
+151530 IF t < 0 THEN 151540
+151540 LET v36 = 12
+151550 LET v36 = v36 * 3 + 0
+151560 LET t = t + v36 / 7
+151570 IF t < 0 THEN 151580
+151580 LET v37 = 16
+151590 LET v37 = v37 * 3 + 4
+151600 LET t = t + v37 / 7
+151610 IF t < 0 THEN 151620
+151620 LET v38 = 20
+151630 LET v38 = v38 * 3 + 8
+151640 LET t = t + v38 / 7
+151650 IF t < 0 THEN 151660
+151660 LET v39 = 24
+151670 LET v39 = v39 * 3 + 12
+151680 LET t = t + v39 / 7
+151690 IF t < 0 THEN 151700
+151700 LET v40 = 28
+151710 LET v40 = v40 * 3 + 3
+151720 LET t = t + v40 / 7
+151730 IF t < 0 THEN 151740
+151740 LET v41 = 32
+151750 LET v41 = v41 * 3 + 7
+151760 LET t = t + v41 / 7
+151770 IF t < 0 THEN 151780
+151780 LET v42 = 36
+151790 LET v42 = v42 * 3 + 11
+151800 LET t = t + v42 / 7
+151810 IF t < 0 THEN 151820
+151820 LET v43 = 40
+151830 LET v43 = v43 * 3 + 2
+151840 LET t = t + v43 / 7
+151850 IF t < 0 THEN 151860
+151860 LET v44 = 44
+151870 LET v44 = v44 * 3 + 6
+151880 LET t = t + v44 / 7
+151890 IF t < 0 THEN 151900
+151900 LET v45 = 48
+151910 LET v45 = v45 * 3 + 10
+151920 LET t = t + v45 / 7
+151930 IF t < 0 THEN 151940
+151940 LET v46 = 52
+151950 LET v46 = v46 * 3 + 1
+151960 LET t = t + v46 / 7
+151970 IF t < 0 THEN 151980
+151980 LET v47 = 56
+151990 LET v47 = v47 * 3 + 5
+152000 LET t = t + v47 / 7
+152010 IF t < 0 THEN 152020
+152020 LET v48 = 60
+152030 LET v48 = v48 * 3 + 9
+152040 LET t = t + v48 / 7
+152050 IF t < 0 THEN 152060
+152060 LET v49 = 64
+152070 LET v49 = v49 * 3 + 0
+152080 LET t = t + v49 / 7
+152090 IF t < 0 THEN 152100
+152100 LET v0 = 68
+152110 LET v0 = v0 * 3 + 4
+152120 LET t = t + v0 / 7
+152130 IF t < 0 THEN 152140
+152140 LET v1 = 72
+152150 LET v1 = v1 * 3 + 8
+152160 LET t = t + v1 / 7
+152170 IF t < 0 THEN 152180
+152180 LET v2 = 76
+152190 LET v2 = v2 * 3 + 12
+152200 LET t = t + v2 / 7
+152210 IF t < 0 THEN 152220
+152220 LET v3 = 80
+152230 LET v3 = v3 * 3 + 3
+152240 LET t = t + v3 / 7
+152250 IF t < 0 THEN 152260
+152260 LET v4 = 84
+152270 LET v4 = v4 * 3 + 7
+152280 LET t = t + v4 / 7
+152290 IF t < 0 THEN 152300
+152300 LET v5 = 88
+152310 LET v5 = v5 * 3 + 11
+152320 LET t = t + v5 / 7
+152330 IF t < 0 THEN 152340
+152340 LET v6 = 92
+152350 LET v6 = v6 * 3 + 2
+152360 LET t = t + v6 / 7
+152370 IF t < 0 THEN 152380
+152380 LET v7 = 96
+152390 LET v7 = v7 * 3 + 6
+152400 LET t = t + v7 / 7
+152410 IF t < 0 THEN 152420
+152420 LET v8 = 3
+152430 LET v8 = v8 * 3 + 10
+152440 LET t = t + v8 / 7
+152450 IF t < 0 THEN 152460
+152460 LET v9 = 7
+152470 LET v9 = v9 * 3 + 1
+152480 LET t = t + v9 / 7
+152490 IF t < 0 THEN 152500
+152500 LET v10 = 11
+152510 LET v10 = v10 * 3 + 5
+152520 LET t = t + v10 / 7
+152530 IF t < 0 THEN 152540
+152540 LET v11 = 15
+152550 LET v11 = v11 * 3 + 9
+152560 LET t = t + v11 / 7
+152570 IF t < 0 THEN 152580
+152580 LET v12 = 19
+152590 LET v12 = v12 * 3 + 0
+152600 LET t = t + v12 / 7
+152610 IF t < 0 THEN 152620
+152620 LET v13 = 23
+152630 LET v13 = v13 * 3 + 4
+152640 LET t = t + v13 / 7
+152650 IF t < 0 THEN 152660
+152660 LET v14 = 27
+152670 LET v14 = v14 * 3 + 8
+152680 LET t = t + v14 / 7
+152690 IF t < 0 THEN 152700
+152700 LET v15 = 31
+152710 LET v15 = v15 * 3 + 12
+152720 LET t = t + v15 / 7
+152730 IF t < 0 THEN 152740
+152740 LET v16 = 35
+152750 LET v16 = v16 * 3 + 3
+152760 LET t = t + v16 / 7
+152770 IF t < 0 THEN 152780
+152780 LET v17 = 39
+152790 LET v17 = v17 * 3 + 7
+152800 LET t = t + v17 / 7
+152810 IF t < 0 THEN 152820
+152820 LET v18 = 43
+152830 LET v18 = v18 * 3 + 11
+152840 LET t = t + v18 / 7
+152850 IF t < 0 THEN 152860
+152860 LET v19 = 47
+152870 LET v19 = v19 * 3 + 2
+152880 LET t = t + v19 / 7
+152890 IF t < 0 THEN 152900
+152900 LET v20 = 51
+152910 LET v20 = v20 * 3 + 6
+152920 LET t = t + v20 / 7
+152930 IF t < 0 THEN 152940
+152940 LET v21 = 55
+152950 LET v21 = v21 * 3 + 10
+152960 LET t = t + v21 / 7
+152970 IF t < 0 THEN 152980
+152980 LET v22 = 59
+152990 LET v22 = v22 * 3 + 1
+153000 LET t = t + v22 / 7
+153010 IF t < 0 THEN 153020
+153020 LET v23 = 63
+153030 LET v23 = v23 * 3 + 5
+153040 LET t = t + v23 / 7
+153050 IF t < 0 THEN 153060
+153060 LET v24 = 67
+153070 LET v24 = v24 * 3 + 9
+153080 LET t = t + v24 / 7
+153090 IF t < 0 THEN 153100
+153100 LET v25 = 71
+153110 LET v25 = v25 * 3 + 0
+153120 LET t = t + v25 / 7
+153130 IF t < 0 THEN 153140
+153140 LET v26 = 75
+153150 LET v26 = v26 * 3 + 4
+153160 LET t = t + v26 / 7
+153170 IF t < 0 THEN 153180
+153180 LET v27 = 79
+153190 LET v27 = v27 * 3 + 8
+153200 LET t = t + v27 / 7
+153210 IF t < 0 THEN 153220
+153220 LET v28 = 83
+153230 LET v28 = v28 * 3 + 12
+153240 LET t = t + v28 / 7
+153250 IF t < 0 THEN 153260
+153260 LET v29 = 87
+153270 LET v29 = v29 * 3 + 3
+153280 LET t = t + v29 / 7
+153290 IF t < 0 THEN 153300
+153300 LET v30 = 91
+153310 LET v30 = v30 * 3 + 7
+153320 LET t = t + v30 / 7
+153330 IF t < 0 THEN 153340
+153340 LET v31 = 95
+153350 LET v31 = v31 * 3 + 11
+153360 LET t = t + v31 / 7
+153370 IF t < 0 THEN 153380
+153380 LET v32 = 2
+153390 LET v32 = v32 * 3 + 2
+153400 LET t = t + v32 / 7
+153410 IF t < 0 THEN 153420
+153420 LET v33 = 6
+153430 LET v33 = v33 * 3 + 6
+153440 LET t = t + v33 / 7
+153450 IF t < 0 THEN 153460
+153460 LET v34 = 10
+153470 LET v34 = v34 * 3 + 10
+153480 LET t = t + v34 / 7
+153490 IF t < 0 THEN 153500
+153500 LET v35 = 14
+153510 LET v35 = v35 * 3 + 1
+153520 LET t = t + v35 / 7
+153530 IF t < 0 THEN 153540
+153540 LET v36 = 18
+153550 LET v36 = v36 * 3 + 5
+153560 LET t = t + v36 / 7
+153570 IF t < 0 THEN 153580
+153580 LET v37 = 22
+153590 LET v37 = v37 * 3 + 9
+153600 LET t = t + v37 / 7
+153610 IF t < 0 THEN 153620
+153620 LET v38 = 26
+153630 LET v38 = v38 * 3 + 0
+153640 LET t = t + v38 / 7
+153650 IF t < 0 THEN 153660
+153660 LET v39 = 30
+153670 LET v39 = v39 * 3 + 4
+153680 LET t = t + v39 / 7
+153690 IF t < 0 THEN 153700
+153700 LET v40 = 34
+153710 LET v40 = v40 * 3 + 8
+153720 LET t = t + v40 / 7
+153730 IF t < 0 THEN 153740
+153740 LET v41 = 38
+153750 LET v41 = v41 * 3 + 12
+153760 LET t = t + v41 / 7
+153770 IF t < 0 THEN 153780
+153780 LET v42 = 42
+153790 LET v42 = v42 * 3 + 3
+153800 LET t = t + v42 / 7
+153810 IF t < 0 THEN 153820
+153820 LET v43 = 46
+153830 LET v43 = v43 * 3 + 7
+153840 LET t = t + v43 / 7
+153850 IF t < 0 THEN 153860
+153860 LET v44 = 50
+153870 LET v44 = v44 * 3 + 11
+153880 LET t = t + v44 / 7
+153890 IF t < 0 THEN 153900
+153900 LET v45 = 54
+153910 LET v45 = v45 * 3 + 2
+153920 LET t = t + v45 / 7
+153930 IF t < 0 THEN 153940
+153940 LET v46 = 58
+153950 LET v46 = v46 * 3 + 6
+153960 LET t = t + v46 / 7
+153970 IF t < 0 THEN 153980
+153980 LET v47 = 62
+153990 LET v47 = v47 * 3 + 10
+154000 LET t = t + v47 / 7
+154010 IF t < 0 THEN 154020
+154020 LET v48 = 66
+154030 LET v48 = v48 * 3 + 1
+154040 LET t = t + v48 / 7
+154050 IF t < 0 THEN 154060
+154060 LET v49 = 70
+154070 LET v49 = v49 * 3 + 5
+154080 LET t = t + v49 / 7
+154090 IF t < 0 THEN 154100
+154100 LET v0 = 74
+154110 LET v0 = v0 * 3 + 9
+154120 LET t = t + v0 / 7
+154130 IF t < 0 THEN 154140
+154140 LET v1 = 78
+154150 LET v1 = v1 * 3 + 0
+154160 LET t = t + v1 / 7
+154170 IF t < 0 THEN 154180
+154180 LET v2 = 82
+154190 LET v2 = v2 * 3 + 4
+154200 LET t = t + v2 / 7
+154210 IF t < 0 THEN 154220
+154220 LET v3 = 86
+154230 LET v3 = v3 * 3 + 8
+154240 LET t = t + v3 / 7
+154250 IF t < 0 THEN 154260
+154260 LET v4 = 90
+154270 LET v4 = v4 * 3 + 12
+154280 LET t = t + v4 / 7
+154290 IF t < 0 THEN 154300
+154300 LET v5 = 94
+154310 LET v5 = v5 * 3 + 3
+154320 LET t = t + v5 / 7
+154330 IF t < 0 THEN 154340
+154340 LET v6 = 1
+154350 LET v6 = v6 * 3 + 7
+154360 LET t = t + v6 / 7
+154370 IF t < 0 THEN 154380
+154380 LET v7 = 5
+154390 LET v7 = v7 * 3 + 11
+154400 LET t = t + v7 / 7
+154410 IF t < 0 THEN 154420
+154420 LET v8 = 9
+154430 LET v8 = v8 * 3 + 2
+154440 LET t = t + v8 / 7
+154450 IF t < 0 THEN 154460
+154460 LET v9 = 13
+154470 LET v9 = v9 * 3 + 6
+154480 LET t = t + v9 / 7
+154490 IF t < 0 THEN 154500
+154500 LET v10 = 17
+154510 LET v10 = v10 * 3 + 10
+154520 LET t = t + v10 / 7
+154530 IF t < 0 THEN 154540
+154540 LET v11 = 21
+154550 LET v11 = v11 * 3 + 1
+154560 LET t = t + v11 / 7
+154570 IF t < 0 THEN 154580
+154580 LET v12 = 25
+154590 LET v12 = v12 * 3 + 5
+154600 LET t = t + v12 / 7
+154610 IF t < 0 THEN 154620
+154620 LET v13 = 29
+154630 LET v13 = v13 * 3 + 9
+154640 LET t = t + v13 / 7
+154650 IF t < 0 THEN 154660
+154660 LET v14 = 33
+154670 LET v14 = v14 * 3 + 0
+154680 LET t = t + v14 / 7
+154690 IF t < 0 THEN 154700
+154700 LET v15 = 37
+154710 LET v15 = v15 * 3 + 4
+154720 LET t = t + v15 / 7
+154730 IF t < 0 THEN 154740
+154740 LET v16 = 41
+154750 LET v16 = v16 * 3 + 8
+154760 LET t = t + v16 / 7
+154770 IF t < 0 THEN 154780
+154780 LET v17 = 45
+154790 LET v17 = v17 * 3 + 12
+154800 LET t = t + v17 / 7
+154810 IF t < 0 THEN 154820
+154820 LET v18 = 49
+154830 LET v18 = v18 * 3 + 3
+154840 LET t = t + v18 / 7
+154850 IF t < 0 THEN 154860
+154860 LET v19 = 53
+154870 LET v19 = v19 * 3 + 7
+154880 LET t = t + v19 / 7
+154890 IF t < 0 THEN 154900
+154900 LET v20 = 57
+154910 LET v20 = v20 * 3 + 11
+154920 LET t = t + v20 / 7
+154930 IF t < 0 THEN 154940
+154940 LET v21 = 61
+154950 LET v21 = v21 * 3 + 2
+154960 LET t = t + v21 / 7
+154970 IF t < 0 THEN 154980
+154980 LET v22 = 65
+154990 LET v22 = v22 * 3 + 6
+155000 LET t = t + v22 / 7
+155010 IF t < 0 THEN 155020
+155020 LET v23 = 69
+155030 LET v23 = v23 * 3 + 10
+155040 LET t = t + v23 / 7
+155050 IF t < 0 THEN 155060
+155060 LET v24 = 73
+155070 LET v24 = v24 * 3 + 1
+155080 LET t = t + v24 / 7
+155090 IF t < 0 THEN 155100
+155100 LET v25 = 77
+155110 LET v25 = v25 * 3 + 5
+155120 LET t = t + v25 / 7
+155130 IF t < 0 THEN 155140
+155140 LET v26 = 81
+155150 LET v26 = v26 * 3 + 9
+155160 LET t = t + v26 / 7
+155170 IF t < 0 THEN 155180
+155180 LET v27 = 85
+155190 LET v27 = v27 * 3 + 0
+155200 LET t = t + v27 / 7
+155210 IF t < 0 THEN 155220
+155220 LET v28 = 89
+155230 LET v28 = v28 * 3 + 4
+155240 LET t = t + v28 / 7
+155250 IF t < 0 THEN 155260
+155260 LET v29 = 93
+155270 LET v29 = v29 * 3 + 8
+155280 LET t = t + v29 / 7
+155290 IF t < 0 THEN 155300
+155300 LET v30 = 0
+155310 LET v30 = v30 * 3 + 12
+155320 LET t = t + v30 / 7
+155330 IF t < 0 THEN 155340
+155340 LET v31 = 4
+155350 LET v31 = v31 * 3 + 3
+155360 LET t = t + v31 / 7
+155370 IF t < 0 THEN 155380
+155380 LET v32 = 8
+155390 LET v32 = v32 * 3 + 7
+155400 LET t = t + v32 / 7
+155410 IF t < 0 THEN 155420
+155420 LET v33 = 12
+155430 LET v33 = v33 * 3 + 11
+155440 LET t = t + v33 / 7
+155450 IF t < 0 THEN 155460
+155460 LET v34 = 16
+155470 LET v34 = v34 * 3 + 2
+155480 LET t = t + v34 / 7
+155490 IF t < 0 THEN 155500
+155500 LET v35 = 20
+155510 LET v35 = v35 * 3 + 6
+155520 LET t = t + v35 / 7
+155530 IF t < 0 THEN 155540
+155540 LET v36 = 24
+155550 LET v36 = v36 * 3 + 10
+155560 LET t = t + v36 / 7
+155570 IF t < 0 THEN 155580
+155580 LET v37 = 28
+155590 LET v37 = v37 * 3 + 1
+155600 LET t = t + v37 / 7
+155610 IF t < 0 THEN 155620
+155620 LET v38 = 32
+155630 LET v38 = v38 * 3 + 5
+155640 LET t = t + v38 / 7
+155650 IF t < 0 THEN 155660
+155660 LET v39 = 36
+155670 LET v39 = v39 * 3 + 9
+155680 LET t = t + v39 / 7
+155690 IF t < 0 THEN 155700
+155700 LET v40 = 40
+155710 LET v40 = v40 * 3 + 0
+155720 LET t = t + v40 / 7
+155730 IF t < 0 THEN 155740
+155740 LET v41 = 44
+155750 LET v41 = v41 * 3 + 4
+155760 LET t = t + v41 / 7
+155770 IF t < 0 THEN 155780
+155780 LET v42 = 48
+155790 LET v42 = v42 * 3 + 8
+155800 LET t = t + v42 / 7
+155810 IF t < 0 THEN 155820
+155820 LET v43 = 52
+155830 LET v43 = v43 * 3 + 12
+155840 LET t = t + v43 / 7
+155850 IF t < 0 THEN 155860
+155860 LET v44 = 56
+155870 LET v44 = v44 * 3 + 3
+155880 LET t = t + v44 / 7
+155890 IF t < 0 THEN 155900
+155900 LET v45 = 60
+155910 LET v45 = v45 * 3 + 7
+155920 LET t = t + v45 / 7
+155930 IF t < 0 THEN 155940
+155940 LET v46 = 64
+155950 LET v46 = v46 * 3 + 11
+155960 LET t = t + v46 / 7
+155970 IF t < 0 THEN 155980
+155980 LET v47 = 68
+155990 LET v47 = v47 * 3 + 2
+156000 LET t = t + v47 / 7
+156010 IF t < 0 THEN 156020
+156020 LET v48 = 72
+156030 LET v48 = v48 * 3 + 6
+156040 LET t = t + v48 / 7
+156050 IF t < 0 THEN 156060
+156060 LET v49 = 76
+156070 LET v49 = v49 * 3 + 10
+156080 LET t = t + v49 / 7
+156090 IF t < 0 THEN 156100
+156100 LET v0 = 80
+156110 LET v0 = v0 * 3 + 1
+156120 LET t = t + v0 / 7
+156130 IF t < 0 THEN 156140
+156140 LET v1 = 84
+156150 LET v1 = v1 * 3 + 5
+156160 LET t = t + v1 / 7
+156170 IF t < 0 THEN 156180
+156180 LET v2 = 88
+156190 LET v2 = v2 * 3 + 9
+156200 LET t = t + v2 / 7
+156210 IF t < 0 THEN 156220
+156220 LET v3 = 92
+156230 LET v3 = v3 * 3 + 0
+156240 LET t = t + v3 / 7
+156250 IF t < 0 THEN 156260
+156260 LET v4 = 96
+156270 LET v4 = v4 * 3 + 4
+156280 LET t = t + v4 / 7
+156290 IF t < 0 THEN 156300
+156300 LET v5 = 3
+156310 LET v5 = v5 * 3 + 8
+156320 LET t = t + v5 / 7
+156330 IF t < 0 THEN 156340
+156340 LET v6 = 7
+156350 LET v6 = v6 * 3 + 12
+156360 LET t = t + v6 / 7
+156370 IF t < 0 THEN 156380
+156380 LET v7 = 11
+156390 LET v7 = v7 * 3 + 3
+156400 LET t = t + v7 / 7
+156410 IF t < 0 THEN 156420
+156420 LET v8 = 15
+156430 LET v8 = v8 * 3 + 7
+156440 LET t = t + v8 / 7
+156450 IF t < 0 THEN 156460
+156460 LET v9 = 19
+156470 LET v9 = v9 * 3 + 11
+156480 LET t = t + v9 / 7
+156490 IF t < 0 THEN 156500
+156500 LET v10 = 23
+156510 LET v10 = v10 * 3 + 2
+156520 LET t = t + v10 / 7
+156530 IF t < 0 THEN 156540
+156540 LET v11 = 27
+156550 LET v11 = v11 * 3 + 6
+156560 LET t = t + v11 / 7
+156570 IF t < 0 THEN 156580
+156580 LET v12 = 31
+156590 LET v12 = v12 * 3 + 10
+156600 LET t = t + v12 / 7
+156610 IF t < 0 THEN 156620
+156620 LET v13 = 35
+156630 LET v13 = v13 * 3 + 1
+156640 LET t = t + v13 / 7
+156650 IF t < 0 THEN 156660
+156660 LET v14 = 39
+156670 LET v14 = v14 * 3 + 5
+156680 LET t = t + v14 / 7
+156690 IF t < 0 THEN 156700
+156700 LET v15 = 43
+156710 LET v15 = v15 * 3 + 9
+156720 LET t = t + v15 / 7
+156730 IF t < 0 THEN 156740
+156740 LET v16 = 47
+156750 LET v16 = v16 * 3 + 0
+156760 LET t = t + v16 / 7
+156770 IF t < 0 THEN 156780
+156780 LET v17 = 51
+156790 LET v17 = v17 * 3 + 4
+156800 LET t = t + v17 / 7
+156810 IF t < 0 THEN 156820
+156820 LET v18 = 55
+156830 LET v18 = v18 * 3 + 8
+156840 LET t = t + v18 / 7
+156850 IF t < 0 THEN 156860
+156860 LET v19 = 59
+156870 LET v19 = v19 * 3 + 12
+156880 LET t = t + v19 / 7
+156890 IF t < 0 THEN 156900
+156900 LET v20 = 63
+156910 LET v20 = v20 * 3 + 3
+156920 LET t = t + v20 / 7
+156930 IF t < 0 THEN 156940
+156940 LET v21 = 67
+156950 LET v21 = v21 * 3 + 7
+156960 LET t = t + v21 / 7
+156970 IF t < 0 THEN 156980
+156980 LET v22 = 71
+156990 LET v22 = v22 * 3 + 11
+157000 LET t = t + v22 / 7
+157010 IF t < 0 THEN 157020
+157020 LET v23 = 75
+157030 LET v23 = v23 * 3 + 2
+157040 LET t = t + v23 / 7
+157050 IF t < 0 THEN 157060
+157060 LET v24 = 79
+157070 LET v24 = v24 * 3 + 6
+157080 LET t = t + v24 / 7
+157090 IF t < 0 THEN 157100
+157100 LET v25 = 83
+157110 LET v25 = v25 * 3 + 10
+157120 LET t = t + v25 / 7
+157130 IF t < 0 THEN 157140
+157140 LET v26 = 87
+157150 LET v26 = v26 * 3 + 1
+157160 LET t = t + v26 / 7
+157170 IF t < 0 THEN 157180
+157180 LET v27 = 91
+157190 LET v27 = v27 * 3 + 5
+157200 LET t = t + v27 / 7
+157210 IF t < 0 THEN 157220
+157220 LET v28 = 95
+157230 LET v28 = v28 * 3 + 9
+157240 LET t = t + v28 / 7
+157250 IF t < 0 THEN 157260
+157260 LET v29 = 2
+157270 LET v29 = v29 * 3 + 0
+157280 LET t = t + v29 / 7
+157290 IF t < 0 THEN 157300
+157300 LET v30 = 6
+157310 LET v30 = v30 * 3 + 4
+157320 LET t = t + v30 / 7
+157330 IF t < 0 THEN 157340
+157340 LET v31 = 10
+157350 LET v31 = v31 * 3 + 8
+157360 LET t = t + v31 / 7
+157370 IF t < 0 THEN 157380
+157380 LET v32 = 14
+157390 LET v32 = v32 * 3 + 12
+157400 LET t = t + v32 / 7
+157410 IF t < 0 THEN 157420
+157420 LET v33 = 18
+157430 LET v33 = v33 * 3 + 3
+157440 LET t = t + v33 / 7
+157450 IF t < 0 THEN 157460
+157460 LET v34 = 22
+157470 LET v34 = v34 * 3 + 7
+157480 LET t = t + v34 / 7
+157490 IF t < 0 THEN 157500
+157500 LET v35 = 26
+157510 LET v35 = v35 * 3 + 11
+157520 LET t = t + v35 / 7
+157530 IF t < 0 THEN 157540
+157540 LET v36 = 30
+157550 LET v36 = v36 * 3 + 2
+157560 LET t = t + v36 / 7
+157570 IF t < 0 THEN 157580
+157580 LET v37 = 34
+157590 LET v37 = v37 * 3 + 6
+157600 LET t = t + v37 / 7
+157610 IF t < 0 THEN 157620
+157620 LET v38 = 38
+157630 LET v38 = v38 * 3 + 10
+157640 LET t = t + v38 / 7
+157650 IF t < 0 THEN 157660
+157660 LET v39 = 42
+157670 LET v39 = v39 * 3 + 1
+157680 LET t = t + v39 / 7
+157690 IF t < 0 THEN 157700
+157700 LET v40 = 46
+157710 LET v40 = v40 * 3 + 5
+157720 LET t = t + v40 / 7
+157730 IF t < 0 THEN 157740
+157740 LET v41 = 50
+157750 LET v41 = v41 * 3 + 9
+157760 LET t = t + v41 / 7
+157770 IF t < 0 THEN 157780
+157780 LET v42 = 54
+157790 LET v42 = v42 * 3 + 0
+157800 LET t = t + v42 / 7
+157810 IF t < 0 THEN 157820
+157820 LET v43 = 58
+157830 LET v43 = v43 * 3 + 4
+157840 LET t = t + v43 / 7
+157850 IF t < 0 THEN 157860
+157860 LET v44 = 62
+157870 LET v44 = v44 * 3 + 8
+157880 LET t = t + v44 / 7
+157890 IF t < 0 THEN 157900
+157900 LET v45 = 66
+157910 LET v45 = v45 * 3 + 12
+157920 LET t = t + v45 / 7
+157930 IF t < 0 THEN 157940
+157940 LET v46 = 70
+157950 LET v46 = v46 * 3 + 3
+157960 LET t = t + v46 / 7
+157970 IF t < 0 THEN 157980
+157980 LET v47 = 74
+157990 LET v47 = v47 * 3 + 7
+158000 LET t = t + v47 / 7
+158010 IF t < 0 THEN 158020
+158020 LET v48 = 78
+158030 LET v48 = v48 * 3 + 11
+158040 LET t = t + v48 / 7
+158050 IF t < 0 THEN 158060
+158060 LET v49 = 82
+158070 LET v49 = v49 * 3 + 2
+158080 LET t = t + v49 / 7
+158090 IF t < 0 THEN 158100
+158100 LET v0 = 86
+158110 LET v0 = v0 * 3 + 6
+158120 LET t = t + v0 / 7
+158130 IF t < 0 THEN 158140
+158140 LET v1 = 90
+158150 LET v1 = v1 * 3 + 10
+158160 LET t = t + v1 / 7
+158170 IF t < 0 THEN 158180
+158180 LET v2 = 94
+158190 LET v2 = v2 * 3 + 1
+158200 LET t = t + v2 / 7
+158210 IF t < 0 THEN 158220
+158220 LET v3 = 1
+158230 LET v3 = v3 * 3 + 5
+158240 LET t = t + v3 / 7
+158250 IF t < 0 THEN 158260
+158260 LET v4 = 5
+158270 LET v4 = v4 * 3 + 9
+158280 LET t = t + v4 / 7
+158290 IF t < 0 THEN 158300
+158300 LET v5 = 9
+158310 LET v5 = v5 * 3 + 0
+158320 LET t = t + v5 / 7
+158330 IF t < 0 THEN 158340
+158340 LET v6 = 13
+158350 LET v6 = v6 * 3 + 4
+158360 LET t = t + v6 / 7
+158370 IF t < 0 THEN 158380
+158380 LET v7 = 17
+158390 LET v7 = v7 * 3 + 8
+158400 LET t = t + v7 / 7
+158410 IF t < 0 THEN 158420
+158420 LET v8 = 21
+158430 LET v8 = v8 * 3 + 12
+158440 LET t = t + v8 / 7
+158450 IF t < 0 THEN 158460
+158460 LET v9 = 25
+158470 LET v9 = v9 * 3 + 3
+158480 LET t = t + v9 / 7
+158490 IF t < 0 THEN 158500
+158500 LET v10 = 29
+158510 LET v10 = v10 * 3 + 7
+158520 LET t = t + v10 / 7
+158530 IF t < 0 THEN 158540
+158540 LET v11 = 33
+158550 LET v11 = v11 * 3 + 11
+158560 LET t = t + v11 / 7
+158570 IF t < 0 THEN 158580
+158580 LET v12 = 37
+158590 LET v12 = v12 * 3 + 2
+158600 LET t = t + v12 / 7
+158610 IF t < 0 THEN 158620
+158620 LET v13 = 41
+158630 LET v13 = v13 * 3 + 6
+158640 LET t = t + v13 / 7
+158650 IF t < 0 THEN 158660
+158660 LET v14 = 45
+158670 LET v14 = v14 * 3 + 10
+158680 LET t = t + v14 / 7
+158690 IF t < 0 THEN 158700
+158700 LET v15 = 49
+158710 LET v15 = v15 * 3 + 1
+158720 LET t = t + v15 / 7
+158730 IF t < 0 THEN 158740
+158740 LET v16 = 53
+158750 LET v16 = v16 * 3 + 5
+158760 LET t = t + v16 / 7
+158770 IF t < 0 THEN 158780
+158780 LET v17 = 57
+158790 LET v17 = v17 * 3 + 9
+158800 LET t = t + v17 / 7
+158810 IF t < 0 THEN 158820
+158820 LET v18 = 61
+158830 LET v18 = v18 * 3 + 0
+158840 LET t = t + v18 / 7
+158850 IF t < 0 THEN 158860
+158860 LET v19 = 65
+158870 LET v19 = v19 * 3 + 4
+158880 LET t = t + v19 / 7
+158890 IF t < 0 THEN 158900
+158900 LET v20 = 69
+158910 LET v20 = v20 * 3 + 8
+158920 LET t = t + v20 / 7
+158930 IF t < 0 THEN 158940
+158940 LET v21 = 73
+158950 LET v21 = v21 * 3 + 12
+158960 LET t = t + v21 / 7
+158970 IF t < 0 THEN 158980
+158980 LET v22 = 77
+158990 LET v22 = v22 * 3 + 3
+159000 LET t = t + v22 / 7
+159010 IF t < 0 THEN 159020
+159020 LET v23 = 81
+159030 LET v23 = v23 * 3 + 7
+159040 LET t = t + v23 / 7
+159050 IF t < 0 THEN 159060
+159060 LET v24 = 85
+159070 LET v24 = v24 * 3 + 11
+159080 LET t = t + v24 / 7
+159090 IF t < 0 THEN 159100
+159100 LET v25 = 89
+159110 LET v25 = v25 * 3 + 2
+159120 LET t = t + v25 / 7
+159130 IF t < 0 THEN 159140
+159140 LET v26 = 93
+159150 LET v26 = v26 * 3 + 6
+159160 LET t = t + v26 / 7
+159170 IF t < 0 THEN 159180
+159180 LET v27 = 0
+159190 LET v27 = v27 * 3 + 10
+159200 LET t = t + v27 / 7
+159210 IF t < 0 THEN 159220
+159220 LET v28 = 4
+159230 LET v28 = v28 * 3 + 1
+159240 LET t = t + v28 / 7
+159250 IF t < 0 THEN 159260
+159260 LET v29 = 8
+159270 LET v29 = v29 * 3 + 5
+159280 LET t = t + v29 / 7
+159290 IF t < 0 THEN 159300
+159300 LET v30 = 12
+159310 LET v30 = v30 * 3 + 9
+159320 LET t = t + v30 / 7
+159330 IF t < 0 THEN 159340
+159340 LET v31 = 16
+159350 LET v31 = v31 * 3 + 0
+159360 LET t = t + v31 / 7
+159370 IF t < 0 THEN 159380
+159380 LET v32 = 20
+159390 LET v32 = v32 * 3 + 4
+159400 LET t = t + v32 / 7
+159410 IF t < 0 THEN 159420
+159420 LET v33 = 24
+159430 LET v33 = v33 * 3 + 8
+159440 LET t = t + v33 / 7
+159450 IF t < 0 THEN 159460
+159460 LET v34 = 28
+159470 LET v34 = v34 * 3 + 12
+159480 LET t = t + v34 / 7
+159490 IF t < 0 THEN 159500
+159500 LET v35 = 32
+159510 LET v35 = v35 * 3 + 3
+159520 LET t = t + v35 / 7
+159530 IF t < 0 THEN 159540
+159540 LET v36 = 36
+159550 LET v36 = v36 * 3 + 7
+159560 LET t = t + v36 / 7
+159570 IF t < 0 THEN 159580
+159580 LET v37 = 40
+159590 LET v37 = v37 * 3 + 11
+159600 LET t = t + v37 / 7
+159610 IF t < 0 THEN 159620
+159620 LET v38 = 44
+159630 LET v38 = v38 * 3 + 2
+159640 LET t = t + v38 / 7
+159650 IF t < 0 THEN 159660
+159660 LET v39 = 48
+159670 LET v39 = v39 * 3 + 6
+159680 LET t = t + v39 / 7
+159690 IF t < 0 THEN 159700
+159700 LET v40 = 52
+159710 LET v40 = v40 * 3 + 10
+159720 LET t = t + v40 / 7
+159730 IF t < 0 THEN 159740
+159740 LET v41 = 56
+159750 LET v41 = v41 * 3 + 1
+159760 LET t = t + v41 / 7
+159770 IF t < 0 THEN 159780
+159780 LET v42 = 60
+159790 LET v42 = v42 * 3 + 5
+159800 LET t = t + v42 / 7
+159810 IF t < 0 THEN 159820
+159820 LET v43 = 64
+159830 LET v43 = v43 * 3 + 9
+159840 LET t = t + v43 / 7
+159850 IF t < 0 THEN 159860
+159860 LET v44 = 68
+159870 LET v44 = v44 * 3 + 0
+159880 LET t = t + v44 / 7
+159890 IF t < 0 THEN 159900
+159900 LET v45 = 72
+159910 LET v45 = v45 * 3 + 4
+159920 LET t = t + v45 / 7
+159930 IF t < 0 THEN 159940
+159940 LET v46 = 76
+159950 LET v46 = v46 * 3 + 8
+159960 LET t = t + v46 / 7
+159970 IF t < 0 THEN 159980
+159980 LET v47 = 80
+159990 LET v47 = v47 * 3 + 12
+160000 LET t = t + v47 / 7
+160010 IF t < 0 THEN 160020
+160020 LET v48 = 84
+160030 LET v48 = v48 * 3 + 3
+160040 LET t = t + v48 / 7
+160050 IF t < 0 THEN 160060
+160060 LET v49 = 88
+160070 LET v49 = v49 * 3 + 7
+160080 LET t = t + v49 / 7
+160090 IF t < 0 THEN 160100
+160100 LET v0 = 92
+160110 LET v0 = v0 * 3 + 11
+160120 LET t = t + v0 / 7
+160130 IF t < 0 THEN 160140
+160140 LET v1 = 96
+160150 LET v1 = v1 * 3 + 2
+160160 LET t = t + v1 / 7
+160170 IF t < 0 THEN 160180
+160180 LET v2 = 3
+160190 LET v2 = v2 * 3 + 6
+160200 LET t = t + v2 / 7
+160210 IF t < 0 THEN 160220
+160220 LET v3 = 7
+160230 LET v3 = v3 * 3 + 10
+160240 LET t = t + v3 / 7
+160250 IF t < 0 THEN 160260
+160260 LET v4 = 11
+160270 LET v4 = v4 * 3 + 1
+160280 LET t = t + v4 / 7
+160290 IF t < 0 THEN 160300
+160300 LET v5 = 15
+160310 LET v5 = v5 * 3 + 5
+160320 LET t = t + v5 / 7
+160330 IF t < 0 THEN 160340
+160340 LET v6 = 19
+160350 LET v6 = v6 * 3 + 9
+160360 LET t = t + v6 / 7
+160370 IF t < 0 THEN 160380
+160380 LET v7 = 23
+160390 LET v7 = v7 * 3 + 0
+160400 LET t = t + v7 / 7
+160410 IF t < 0 THEN 160420
+160420 LET v8 = 27
+160430 LET v8 = v8 * 3 + 4
+160440 LET t = t + v8 / 7
+160450 IF t < 0 THEN 160460
+160460 LET v9 = 31
+160470 LET v9 = v9 * 3 + 8
+160480 LET t = t + v9 / 7
+160490 IF t < 0 THEN 160500
+160500 LET v10 = 35
+160510 LET v10 = v10 * 3 + 12
+160520 LET t = t + v10 / 7
+160530 IF t < 0 THEN 160540
+160540 LET v11 = 39
+160550 LET v11 = v11 * 3 + 3
+160560 LET t = t + v11 / 7
+160570 IF t < 0 THEN 160580
+160580 LET v12 = 43
+160590 LET v12 = v12 * 3 + 7
+160600 LET t = t + v12 / 7
+160610 IF t < 0 THEN 160620
+160620 LET v13 = 47
+160630 LET v13 = v13 * 3 + 11
+160640 LET t = t + v13 / 7
+160650 IF t < 0 THEN 160660
+160660 LET v14 = 51
+160670 LET v14 = v14 * 3 + 2
+160680 LET t = t + v14 / 7
+160690 IF t < 0 THEN 160700
+160700 LET v15 = 55
+160710 LET v15 = v15 * 3 + 6
+160720 LET t = t + v15 / 7
+160730 IF t < 0 THEN 160740
+160740 LET v16 = 59
+160750 LET v16 = v16 * 3 + 10
+160760 LET t = t + v16 / 7
+160770 IF t < 0 THEN 160780
+160780 LET v17 = 63
+160790 LET v17 = v17 * 3 + 1
+160800 LET t = t + v17 / 7
+160810 IF t < 0 THEN 160820
+160820 LET v18 = 67
+160830 LET v18 = v18 * 3 + 5
+160840 LET t = t + v18 / 7
+160850 IF t < 0 THEN 160860
+160860 LET v19 = 71
+160870 LET v19 = v19 * 3 + 9
+160880 LET t = t + v19 / 7
+160890 IF t < 0 THEN 160900
+160900 LET v20 = 75
+160910 LET v20 = v20 * 3 + 0
+160920 LET t = t + v20 / 7
+160930 IF t < 0 THEN 160940
+160940 LET v21 = 79
+160950 LET v21 = v21 * 3 + 4
+160960 LET t = t + v21 / 7
+160970 IF t < 0 THEN 160980
+160980 LET v22 = 83
+160990 LET v22 = v22 * 3 + 8
+161000 LET t = t + v22 / 7
+161010 IF t < 0 THEN 161020
+161020 LET v23 = 87
+161030 LET v23 = v23 * 3 + 12
+161040 LET t = t + v23 / 7
+161050 IF t < 0 THEN 161060
+161060 LET v24 = 91
+161070 LET v24 = v24 * 3 + 3
+161080 LET t = t + v24 / 7
+161090 IF t < 0 THEN 161100
+161100 LET v25 = 95
+161110 LET v25 = v25 * 3 + 7
+161120 LET t = t + v25 / 7
+161130 IF t < 0 THEN 161140
+161140 LET v26 = 2
+161150 LET v26 = v26 * 3 + 11
+161160 LET t = t + v26 / 7
+161170 IF t < 0 THEN 161180
+161180 LET v27 = 6
+161190 LET v27 = v27 * 3 + 2
+161200 LET t = t + v27 / 7
+161210 IF t < 0 THEN 161220
+161220 LET v28 = 10
+161230 LET v28 = v28 * 3 + 6
+161240 LET t = t + v28 / 7
+161250 IF t < 0 THEN 161260
+161260 LET v29 = 14
+161270 LET v29 = v29 * 3 + 10
+161280 LET t = t + v29 / 7
+161290 IF t < 0 THEN 161300
+161300 LET v30 = 18
+161310 LET v30 = v30 * 3 + 1
+161320 LET t = t + v30 / 7
+161330 IF t < 0 THEN 161340
+161340 LET v31 = 22
+161350 LET v31 = v31 * 3 + 5
+161360 LET t = t + v31 / 7
+161370 IF t < 0 THEN 161380
+161380 LET v32 = 26
+161390 LET v32 = v32 * 3 + 9
+161400 LET t = t + v32 / 7
+161410 IF t < 0 THEN 161420
+161420 LET v33 = 30
+161430 LET v33 = v33 * 3 + 0
+161440 LET t = t + v33 / 7
+161450 IF t < 0 THEN 161460
+161460 LET v34 = 34
+161470 LET v34 = v34 * 3 + 4
+161480 LET t = t + v34 / 7
+161490 IF t < 0 THEN 161500
+161500 LET v35 = 38
+161510 LET v35 = v35 * 3 + 8
+161520 LET t = t + v35 / 7
+161530 IF t < 0 THEN 161540
+161540 LET v36 = 42
+161550 LET v36 = v36 * 3 + 12
+161560 LET t = t + v36 / 7
+161570 IF t < 0 THEN 161580
+161580 LET v37 = 46
+161590 LET v37 = v37 * 3 + 3
+161600 LET t = t + v37 / 7
+161610 IF t < 0 THEN 161620
+161620 LET v38 = 50
+161630 LET v38 = v38 * 3 + 7
+161640 LET t = t + v38 / 7
+161650 IF t < 0 THEN 161660
+161660 LET v39 = 54
+161670 LET v39 = v39 * 3 + 11
+161680 LET t = t + v39 / 7
+161690 IF t < 0 THEN 161700
+161700 LET v40 = 58
+161710 LET v40 = v40 * 3 + 2
+161720 LET t = t + v40 / 7
+161730 IF t < 0 THEN 161740
+161740 LET v41 = 62
+161750 LET v41 = v41 * 3 + 6
+161760 LET t = t + v41 / 7
+161770 IF t < 0 THEN 161780
+161780 LET v42 = 66
+161790 LET v42 = v42 * 3 + 10
+161800 LET t = t + v42 / 7
+161810 IF t < 0 THEN 161820
+161820 LET v43 = 70
+161830 LET v43 = v43 * 3 + 1
+161840 LET t = t + v43 / 7
+161850 IF t < 0 THEN 161860
+161860 LET v44 = 74
+161870 LET v44 = v44 * 3 + 5
+161880 LET t = t + v44 / 7
+161890 IF t < 0 THEN 161900
+161900 LET v45 = 78
+161910 LET v45 = v45 * 3 + 9
+161920 LET t = t + v45 / 7
+161930 IF t < 0 THEN 161940
+161940 LET v46 = 82
+161950 LET v46 = v46 * 3 + 0
+161960 LET t = t + v46 / 7
+161970 IF t < 0 THEN 161980
+161980 LET v47 = 86
+161990 LET v47 = v47 * 3 + 4
+162000 LET t = t + v47 / 7
+162010 IF t < 0 THEN 162020
+162020 LET v48 = 90
+162030 LET v48 = v48 * 3 + 8
+162040 LET t = t + v48 / 7
+162050 IF t < 0 THEN 162060
+162060 LET v49 = 94
+162070 LET v49 = v49 * 3 + 12
+162080 LET t = t + v49 / 7
+162090 IF t < 0 THEN 162100
+162100 LET v0 = 1
+162110 LET v0 = v0 * 3 + 3
+162120 LET t = t + v0 / 7
+162130 IF t < 0 THEN 162140
+162140 LET v1 = 5
+162150 LET v1 = v1 * 3 + 7
+162160 LET t = t + v1 / 7
+162170 IF t < 0 THEN 162180
+162180 LET v2 = 9
+162190 LET v2 = v2 * 3 + 11
+162200 LET t = t + v2 / 7
+162210 IF t < 0 THEN 162220
+162220 LET v3 = 13
+162230 LET v3 = v3 * 3 + 2
+162240 LET t = t + v3 / 7
+162250 IF t < 0 THEN 162260
+162260 LET v4 = 17
+162270 LET v4 = v4 * 3 + 6
+162280 LET t = t + v4 / 7
+162290 IF t < 0 THEN 162300
+162300 LET v5 = 21
+162310 LET v5 = v5 * 3 + 10
+162320 LET t = t + v5 / 7
+162330 IF t < 0 THEN 162340
+162340 LET v6 = 25
+162350 LET v6 = v6 * 3 + 1
+162360 LET t = t + v6 / 7
+162370 IF t < 0 THEN 162380
+162380 LET v7 = 29
+162390 LET v7 = v7 * 3 + 5
+162400 LET t = t + v7 / 7
+162410 IF t < 0 THEN 162420
+162420 LET v8 = 33
+162430 LET v8 = v8 * 3 + 9
+162440 LET t = t + v8 / 7
+162450 IF t < 0 THEN 162460
+162460 LET v9 = 37
+162470 LET v9 = v9 * 3 + 0
+162480 LET t = t + v9 / 7
+162490 IF t < 0 THEN 162500
+162500 LET v10 = 41
+162510 LET v10 = v10 * 3 + 4
+162520 LET t = t + v10 / 7
+162530 IF t < 0 THEN 162540
+162540 LET v11 = 45
+162550 LET v11 = v11 * 3 + 8
+162560 LET t = t + v11 / 7
+162570 IF t < 0 THEN 162580
+162580 LET v12 = 49
+162590 LET v12 = v12 * 3 + 12
+162600 LET t = t + v12 / 7
+162610 IF t < 0 THEN 162620
+162620 LET v13 = 53
+162630 LET v13 = v13 * 3 + 3
+162640 LET t = t + v13 / 7
+162650 IF t < 0 THEN 162660
+162660 LET v14 = 57
+162670 LET v14 = v14 * 3 + 7
+162680 LET t = t + v14 / 7
+162690 IF t < 0 THEN 162700
+162700 LET v15 = 61
+162710 LET v15 = v15 * 3 + 11
+162720 LET t = t + v15 / 7
+162730 IF t < 0 THEN 162740
+162740 LET v16 = 65
+162750 LET v16 = v16 * 3 + 2
+162760 LET t = t + v16 / 7
+162770 IF t < 0 THEN 162780
+162780 LET v17 = 69
+162790 LET v17 = v17 * 3 + 6
+162800 LET t = t + v17 / 7
+162810 IF t < 0 THEN 162820
+162820 LET v18 = 73
+162830 LET v18 = v18 * 3 + 10
+162840 LET t = t + v18 / 7
+162850 IF t < 0 THEN 162860
+162860 LET v19 = 77
+162870 LET v19 = v19 * 3 + 1
+162880 LET t = t + v19 / 7
+162890 IF t < 0 THEN 162900
+162900 LET v20 = 81
+162910 LET v20 = v20 * 3 + 5
+162920 LET t = t + v20 / 7
+162930 IF t < 0 THEN 162940
+162940 LET v21 = 85
+162950 LET v21 = v21 * 3 + 9
+162960 LET t = t + v21 / 7
+162970 IF t < 0 THEN 162980
+162980 LET v22 = 89
+162990 LET v22 = v22 * 3 + 0
+163000 LET t = t + v22 / 7
+163010 IF t < 0 THEN 163020
+163020 LET v23 = 93
+163030 LET v23 = v23 * 3 + 4
+163040 LET t = t + v23 / 7
+163050 IF t < 0 THEN 163060
+163060 LET v24 = 0
+163070 LET v24 = v24 * 3 + 8
+163080 LET t = t + v24 / 7
+163090 IF t < 0 THEN 163100
+163100 LET v25 = 4
+163110 LET v25 = v25 * 3 + 12
+163120 LET t = t + v25 / 7
+163130 IF t < 0 THEN 163140
+163140 LET v26 = 8
+163150 LET v26 = v26 * 3 + 3
+163160 LET t = t + v26 / 7
+163170 IF t < 0 THEN 163180
+163180 LET v27 = 12
+163190 LET v27 = v27 * 3 + 7
+163200 LET t = t + v27 / 7
+163210 IF t < 0 THEN 163220
+163220 LET v28 = 16
+163230 LET v28 = v28 * 3 + 11
+163240 LET t = t + v28 / 7
+163250 IF t < 0 THEN 163260
+163260 LET v29 = 20
+163270 LET v29 = v29 * 3 + 2
+163280 LET t = t + v29 / 7
+163290 IF t < 0 THEN 163300
+163300 LET v30 = 24
+163310 LET v30 = v30 * 3 + 6
+163320 LET t = t + v30 / 7
+163330 IF t < 0 THEN 163340
+163340 LET v31 = 28
+163350 LET v31 = v31 * 3 + 10
+163360 LET t = t + v31 / 7
+163370 IF t < 0 THEN 163380
+163380 LET v32 = 32
+163390 LET v32 = v32 * 3 + 1
+163400 LET t = t + v32 / 7
+163410 IF t < 0 THEN 163420
+163420 LET v33 = 36
+163430 LET v33 = v33 * 3 + 5
+163440 LET t = t + v33 / 7
+163450 IF t < 0 THEN 163460
+163460 LET v34 = 40
+163470 LET v34 = v34 * 3 + 9
+163480 LET t = t + v34 / 7
+163490 IF t < 0 THEN 163500
+163500 LET v35 = 44
+163510 LET v35 = v35 * 3 + 0
+163520 LET t = t + v35 / 7
+163530 IF t < 0 THEN 163540
+163540 LET v36 = 48
+163550 LET v36 = v36 * 3 + 4
+163560 LET t = t + v36 / 7
+163570 IF t < 0 THEN 163580
+163580 LET v37 = 52
+163590 LET v37 = v37 * 3 + 8
+163600 LET t = t + v37 / 7
+163610 IF t < 0 THEN 163620
+163620 LET v38 = 56
+163630 LET v38 = v38 * 3 + 12
+163640 LET t = t + v38 / 7
+163650 IF t < 0 THEN 163660
+163660 LET v39 = 60
+163670 LET v39 = v39 * 3 + 3
+163680 LET t = t + v39 / 7
+163690 IF t < 0 THEN 163700
+163700 LET v40 = 64
+163710 LET v40 = v40 * 3 + 7
+163720 LET t = t + v40 / 7
+163730 IF t < 0 THEN 163740
+163740 LET v41 = 68
+163750 LET v41 = v41 * 3 + 11
+163760 LET t = t + v41 / 7
+163770 IF t < 0 THEN 163780
+163780 LET v42 = 72
+163790 LET v42 = v42 * 3 + 2
+163800 LET t = t + v42 / 7
+163810 IF t < 0 THEN 163820
+163820 LET v43 = 76
+163830 LET v43 = v43 * 3 + 6
+163840 LET t = t + v43 / 7
+163850 IF t < 0 THEN 163860
+163860 LET v44 = 80
+163870 LET v44 = v44 * 3 + 10
+163880 LET t = t + v44 / 7
+163890 IF t < 0 THEN 163900
+163900 LET v45 = 84
+163910 LET v45 = v45 * 3 + 1
+163920 LET t = t + v45 / 7
+163930 IF t < 0 THEN 163940
+163940 LET v46 = 88
+163950 LET v46 = v46 * 3 + 5
+163960 LET t = t + v46 / 7
+163970 IF t < 0 THEN 163980
+163980 LET v47 = 92
+163990 LET v47 = v47 * 3 + 9
+164000 LET t = t + v47 / 7
+164010 IF t < 0 THEN 164020
+164020 LET v48 = 96
+164030 LET v48 = v48 * 3 + 0
+164040 LET t = t + v48 / 7
+164050 IF t < 0 THEN 164060
+164060 LET v49 = 3
+164070 LET v49 = v49 * 3 + 4
+164080 LET t = t + v49 / 7
+164090 IF t < 0 THEN 164100
+164100 LET v0 = 7
+164110 LET v0 = v0 * 3 + 8
+164120 LET t = t + v0 / 7
+164130 IF t < 0 THEN 164140
+164140 LET v1 = 11
+164150 LET v1 = v1 * 3 + 12
+164160 LET t = t + v1 / 7
+164170 IF t < 0 THEN 164180
+164180 LET v2 = 15
+164190 LET v2 = v2 * 3 + 3
+164200 LET t = t + v2 / 7
+164210 IF t < 0 THEN 164220
+164220 LET v3 = 19
+164230 LET v3 = v3 * 3 + 7
+164240 LET t = t + v3 / 7
+164250 IF t < 0 THEN 164260
+164260 LET v4 = 23
+164270 LET v4 = v4 * 3 + 11
+164280 LET t = t + v4 / 7
+164290 IF t < 0 THEN 164300
+164300 LET v5 = 27
+164310 LET v5 = v5 * 3 + 2
+164320 LET t = t + v5 / 7
+164330 IF t < 0 THEN 164340
+164340 LET v6 = 31
+164350 LET v6 = v6 * 3 + 6
+164360 LET t = t + v6 / 7
+164370 IF t < 0 THEN 164380
+164380 LET v7 = 35
+164390 LET v7 = v7 * 3 + 10
+164400 LET t = t + v7 / 7
+164410 IF t < 0 THEN 164420
+164420 LET v8 = 39
+164430 LET v8 = v8 * 3 + 1
+164440 LET t = t + v8 / 7
+164450 IF t < 0 THEN 164460
+164460 LET v9 = 43
+164470 LET v9 = v9 * 3 + 5
+164480 LET t = t + v9 / 7
+164490 IF t < 0 THEN 164500
+164500 LET v10 = 47
+164510 LET v10 = v10 * 3 + 9
+164520 LET t = t + v10 / 7
+164530 IF t < 0 THEN 164540
+164540 LET v11 = 51
+164550 LET v11 = v11 * 3 + 0
+164560 LET t = t + v11 / 7
+164570 IF t < 0 THEN 164580
+164580 LET v12 = 55
+164590 LET v12 = v12 * 3 + 4
+164600 LET t = t + v12 / 7
+164610 IF t < 0 THEN 164620
+164620 LET v13 = 59
+164630 LET v13 = v13 * 3 + 8
+164640 LET t = t + v13 / 7
+164650 IF t < 0 THEN 164660
+164660 LET v14 = 63
+164670 LET v14 = v14 * 3 + 12
+164680 LET t = t + v14 / 7
+164690 IF t < 0 THEN 164700
+164700 LET v15 = 67
+164710 LET v15 = v15 * 3 + 3
+164720 LET t = t + v15 / 7
+164730 IF t < 0 THEN 164740
+164740 LET v16 = 71
+164750 LET v16 = v16 * 3 + 7
+164760 LET t = t + v16 / 7
+164770 IF t < 0 THEN 164780
+164780 LET v17 = 75
+164790 LET v17 = v17 * 3 + 11
+164800 LET t = t + v17 / 7
+164810 IF t < 0 THEN 164820
+164820 LET v18 = 79
+164830 LET v18 = v18 * 3 + 2
+164840 LET t = t + v18 / 7
+164850 IF t < 0 THEN 164860
+164860 LET v19 = 83
+164870 LET v19 = v19 * 3 + 6
+164880 LET t = t + v19 / 7
+164890 IF t < 0 THEN 164900
+164900 LET v20 = 87
+164910 LET v20 = v20 * 3 + 10
+164920 LET t = t + v20 / 7
+164930 IF t < 0 THEN 164940
+164940 LET v21 = 91
+164950 LET v21 = v21 * 3 + 1
+164960 LET t = t + v21 / 7
+164970 IF t < 0 THEN 164980
+164980 LET v22 = 95
+164990 LET v22 = v22 * 3 + 5
+165000 LET t = t + v22 / 7
+165010 IF t < 0 THEN 165020
+165020 LET v23 = 2
+165030 LET v23 = v23 * 3 + 9
+165040 LET t = t + v23 / 7
+165050 IF t < 0 THEN 165060
+165060 LET v24 = 6
+165070 LET v24 = v24 * 3 + 0
+165080 LET t = t + v24 / 7
+165090 IF t < 0 THEN 165100
+165100 LET v25 = 10
+165110 LET v25 = v25 * 3 + 4
+165120 LET t = t + v25 / 7
+165130 IF t < 0 THEN 165140
+165140 LET v26 = 14
+165150 LET v26 = v26 * 3 + 8
+165160 LET t = t + v26 / 7
+165170 IF t < 0 THEN 165180
+165180 LET v27 = 18
+165190 LET v27 = v27 * 3 + 12
+165200 LET t = t + v27 / 7
+165210 IF t < 0 THEN 165220
+165220 LET v28 = 22
+165230 LET v28 = v28 * 3 + 3
+165240 LET t = t + v28 / 7
+165250 IF t < 0 THEN 165260
+165260 LET v29 = 26
+165270 LET v29 = v29 * 3 + 7
+165280 LET t = t + v29 / 7
+165290 IF t < 0 THEN 165300
+165300 LET v30 = 30
+165310 LET v30 = v30 * 3 + 11
+165320 LET t = t + v30 / 7
+165330 IF t < 0 THEN 165340
+165340 LET v31 = 34
+165350 LET v31 = v31 * 3 + 2
+165360 LET t = t + v31 / 7
+165370 IF t < 0 THEN 165380
+165380 LET v32 = 38
+165390 LET v32 = v32 * 3 + 6
+165400 LET t = t + v32 / 7
+165410 IF t < 0 THEN 165420
+165420 LET v33 = 42
+165430 LET v33 = v33 * 3 + 10
+165440 LET t = t + v33 / 7
+165450 IF t < 0 THEN 165460
+165460 LET v34 = 46
+165470 LET v34 = v34 * 3 + 1
+165480 LET t = t + v34 / 7
+165490 IF t < 0 THEN 165500
+165500 LET v35 = 50
+165510 LET v35 = v35 * 3 + 5
+165520 LET t = t + v35 / 7
+165530 IF t < 0 THEN 165540
+165540 LET v36 = 54
+165550 LET v36 = v36 * 3 + 9
+165560 LET t = t + v36 / 7
+165570 IF t < 0 THEN 165580
+165580 LET v37 = 58
+165590 LET v37 = v37 * 3 + 0
+165600 LET t = t + v37 / 7
+165610 IF t < 0 THEN 165620
+165620 LET v38 = 62
+165630 LET v38 = v38 * 3 + 4
+165640 LET t = t + v38 / 7
+165650 IF t < 0 THEN 165660
+165660 LET v39 = 66
+165670 LET v39 = v39 * 3 + 8
+165680 LET t = t + v39 / 7
+165690 IF t < 0 THEN 165700
+165700 LET v40 = 70
+165710 LET v40 = v40 * 3 + 12
+165720 LET t = t + v40 / 7
+165730 IF t < 0 THEN 165740
+165740 LET v41 = 74
+165750 LET v41 = v41 * 3 + 3
+165760 LET t = t + v41 / 7
+165770 IF t < 0 THEN 165780
+165780 LET v42 = 78
+165790 LET v42 = v42 * 3 + 7
+165800 LET t = t + v42 / 7
+165810 IF t < 0 THEN 165820
+165820 LET v43 = 82
+165830 LET v43 = v43 * 3 + 11
+165840 LET t = t + v43 / 7
+165850 IF t < 0 THEN 165860
+165860 LET v44 = 86
+165870 LET v44 = v44 * 3 + 2
+165880 LET t = t + v44 / 7
+165890 IF t < 0 THEN 165900
+165900 LET v45 = 90
+165910 LET v45 = v45 * 3 + 6
+165920 LET t = t + v45 / 7
+165930 IF t < 0 THEN 165940
+165940 LET v46 = 94
+165950 LET v46 = v46 * 3 + 10
+165960 LET t = t + v46 / 7
+165970 IF t < 0 THEN 165980
+165980 LET v47 = 1
+165990 LET v47 = v47 * 3 + 1
+166000 LET t = t + v47 / 7
+166010 IF t < 0 THEN 166020
+166020 LET v48 = 5
+166030 LET v48 = v48 * 3 + 5
+166040 LET t = t + v48 / 7
+166050 IF t < 0 THEN 166060
+166060 LET v49 = 9
+166070 LET v49 = v49 * 3 + 9
+166080 LET t = t + v49 / 7
+166090 IF t < 0 THEN 166100
+166100 LET v0 = 13
+166110 LET v0 = v0 * 3 + 0
+166120 LET t = t + v0 / 7
+166130 IF t < 0 THEN 166140
+166140 LET v1 = 17
+166150 LET v1 = v1 * 3 + 4
+166160 LET t = t + v1 / 7
+166170 IF t < 0 THEN 166180
+166180 LET v2 = 21
+166190 LET v2 = v2 * 3 + 8
+166200 LET t = t + v2 / 7
+166210 IF t < 0 THEN 166220
+166220 LET v3 = 25
+166230 LET v3 = v3 * 3 + 12
+166240 LET t = t + v3 / 7
+166250 IF t < 0 THEN 166260
+166260 LET v4 = 29
+166270 LET v4 = v4 * 3 + 3
+166280 LET t = t + v4 / 7
+166290 IF t < 0 THEN 166300
+166300 LET v5 = 33
+166310 LET v5 = v5 * 3 + 7
+166320 LET t = t + v5 / 7
+166330 IF t < 0 THEN 166340
+166340 LET v6 = 37
+166350 LET v6 = v6 * 3 + 11
+166360 LET t = t + v6 / 7
+166370 IF t < 0 THEN 166380
+166380 LET v7 = 41
+166390 LET v7 = v7 * 3 + 2
+166400 LET t = t + v7 / 7
+166410 IF t < 0 THEN 166420
+166420 LET v8 = 45
+166430 LET v8 = v8 * 3 + 6
+166440 LET t = t + v8 / 7
+166450 IF t < 0 THEN 166460
+166460 LET v9 = 49
+166470 LET v9 = v9 * 3 + 10
+166480 LET t = t + v9 / 7
+166490 IF t < 0 THEN 166500
+166500 LET v10 = 53
+166510 LET v10 = v10 * 3 + 1
+166520 LET t = t + v10 / 7
+166530 IF t < 0 THEN 166540
+166540 LET v11 = 57
+166550 LET v11 = v11 * 3 + 5
+166560 LET t = t + v11 / 7
+166570 IF t < 0 THEN 166580
+166580 LET v12 = 61
+166590 LET v12 = v12 * 3 + 9
+166600 LET t = t + v12 / 7
+166610 IF t < 0 THEN 166620
+166620 LET v13 = 65
+166630 LET v13 = v13 * 3 + 0
+166640 LET t = t + v13 / 7
+166650 IF t < 0 THEN 166660
+166660 LET v14 = 69
+166670 LET v14 = v14 * 3 + 4
+166680 LET t = t + v14 / 7
+166690 IF t < 0 THEN 166700
+166700 LET v15 = 73
+166710 LET v15 = v15 * 3 + 8
+166720 LET t = t + v15 / 7
+166730 IF t < 0 THEN 166740
+166740 LET v16 = 77
+166750 LET v16 = v16 * 3 + 12
+166760 LET t = t + v16 / 7
+166770 IF t < 0 THEN 166780
+166780 LET v17 = 81
+166790 LET v17 = v17 * 3 + 3
+166800 LET t = t + v17 / 7
+166810 IF t < 0 THEN 166820
+166820 LET v18 = 85
+166830 LET v18 = v18 * 3 + 7
+166840 LET t = t + v18 / 7
+166850 IF t < 0 THEN 166860
+166860 LET v19 = 89
+166870 LET v19 = v19 * 3 + 11
+166880 LET t = t + v19 / 7
+166890 IF t < 0 THEN 166900
+166900 LET v20 = 93
+166910 LET v20 = v20 * 3 + 2
+166920 LET t = t + v20 / 7
+166930 IF t < 0 THEN 166940
+166940 LET v21 = 0
+166950 LET v21 = v21 * 3 + 6
+166960 LET t = t + v21 / 7
+166970 IF t < 0 THEN 166980
+166980 LET v22 = 4
+166990 LET v22 = v22 * 3 + 10
+167000 LET t = t + v22 / 7
+167010 IF t < 0 THEN 167020
+167020 LET v23 = 8
+167030 LET v23 = v23 * 3 + 1
+167040 LET t = t + v23 / 7
+167050 IF t < 0 THEN 167060
+167060 LET v24 = 12
+167070 LET v24 = v24 * 3 + 5
+167080 LET t = t + v24 / 7
+167090 IF t < 0 THEN 167100
+167100 LET v25 = 16
+167110 LET v25 = v25 * 3 + 9
+167120 LET t = t + v25 / 7
+167130 IF t < 0 THEN 167140
+167140 LET v26 = 20
+167150 LET v26 = v26 * 3 + 0
+167160 LET t = t + v26 / 7
+167170 IF t < 0 THEN 167180
+167180 LET v27 = 24
+167190 LET v27 = v27 * 3 + 4
+167200 LET t = t + v27 / 7
+167210 IF t < 0 THEN 167220
+167220 LET v28 = 28
+167230 LET v28 = v28 * 3 + 8
+167240 LET t = t + v28 / 7
+167250 IF t < 0 THEN 167260
+167260 LET v29 = 32
+167270 LET v29 = v29 * 3 + 12
+167280 LET t = t + v29 / 7
+167290 IF t < 0 THEN 167300
+167300 LET v30 = 36
+167310 LET v30 = v30 * 3 + 3
+167320 LET t = t + v30 / 7
+167330 IF t < 0 THEN 167340
+167340 LET v31 = 40
+167350 LET v31 = v31 * 3 + 7
+167360 LET t = t + v31 / 7
+167370 IF t < 0 THEN 167380
+167380 LET v32 = 44
+167390 LET v32 = v32 * 3 + 11
+167400 LET t = t + v32 / 7
+167410 IF t < 0 THEN 167420
+167420 LET v33 = 48
+167430 LET v33 = v33 * 3 + 2
+167440 LET t = t + v33 / 7
+167450 IF t < 0 THEN 167460
+167460 LET v34 = 52
+167470 LET v34 = v34 * 3 + 6
+167480 LET t = t + v34 / 7
+167490 IF t < 0 THEN 167500
+167500 LET v35 = 56
+167510 LET v35 = v35 * 3 + 10
+167520 LET t = t + v35 / 7
+167530 IF t < 0 THEN 167540
+167540 LET v36 = 60
+167550 LET v36 = v36 * 3 + 1
+167560 LET t = t + v36 / 7
+167570 IF t < 0 THEN 167580
+167580 LET v37 = 64
+167590 LET v37 = v37 * 3 + 5
+167600 LET t = t + v37 / 7
+167610 IF t < 0 THEN 167620
+167620 LET v38 = 68
+167630 LET v38 = v38 * 3 + 9
+167640 LET t = t + v38 / 7
+167650 IF t < 0 THEN 167660
+167660 LET v39 = 72
+167670 LET v39 = v39 * 3 + 0
+167680 LET t = t + v39 / 7
+167690 IF t < 0 THEN 167700
+167700 LET v40 = 76
+167710 LET v40 = v40 * 3 + 4
+167720 LET t = t + v40 / 7
+167730 IF t < 0 THEN 167740
+167740 LET v41 = 80
+167750 LET v41 = v41 * 3 + 8
+167760 LET t = t + v41 / 7
+167770 IF t < 0 THEN 167780
+167780 LET v42 = 84
+167790 LET v42 = v42 * 3 + 12
+167800 LET t = t + v42 / 7
+167810 IF t < 0 THEN 167820
+167820 LET v43 = 88
+167830 LET v43 = v43 * 3 + 3
+167840 LET t = t + v43 / 7
+167850 IF t < 0 THEN 167860
+167860 LET v44 = 92
+167870 LET v44 = v44 * 3 + 7
+167880 LET t = t + v44 / 7
+167890 IF t < 0 THEN 167900
+167900 LET v45 = 96
+167910 LET v45 = v45 * 3 + 11
+167920 LET t = t + v45 / 7
+167930 IF t < 0 THEN 167940
+167940 LET v46 = 3
+167950 LET v46 = v46 * 3 + 2
+167960 LET t = t + v46 / 7
+167970 IF t < 0 THEN 167980
+167980 LET v47 = 7
+167990 LET v47 = v47 * 3 + 6
+168000 LET t = t + v47 / 7
+168010 IF t < 0 THEN 168020
+168020 LET v48 = 11
+168030 LET v48 = v48 * 3 + 10
+168040 LET t = t + v48 / 7
+168050 IF t < 0 THEN 168060
+168060 LET v49 = 15
+168070 LET v49 = v49 * 3 + 1
+168080 LET t = t + v49 / 7
+168090 IF t < 0 THEN 168100
+168100 LET v0 = 19
+168110 LET v0 = v0 * 3 + 5
+168120 LET t = t + v0 / 7
+168130 IF t < 0 THEN 168140
+168140 LET v1 = 23
+168150 LET v1 = v1 * 3 + 9
+168160 LET t = t + v1 / 7
+168170 IF t < 0 THEN 168180
+168180 LET v2 = 27
+168190 LET v2 = v2 * 3 + 0
+168200 LET t = t + v2 / 7
+168210 IF t < 0 THEN 168220
+168220 LET v3 = 31
+168230 LET v3 = v3 * 3 + 4
+168240 LET t = t + v3 / 7
+168250 IF t < 0 THEN 168260
+168260 LET v4 = 35
+168270 LET v4 = v4 * 3 + 8
+168280 LET t = t + v4 / 7
+168290 IF t < 0 THEN 168300
+168300 LET v5 = 39
+168310 LET v5 = v5 * 3 + 12
+168320 LET t = t + v5 / 7
+168330 IF t < 0 THEN 168340
+168340 LET v6 = 43
+168350 LET v6 = v6 * 3 + 3
+168360 LET t = t + v6 / 7
+168370 IF t < 0 THEN 168380
+168380 LET v7 = 47
+168390 LET v7 = v7 * 3 + 7
+168400 LET t = t + v7 / 7
+168410 IF t < 0 THEN 168420
+168420 LET v8 = 51
+168430 LET v8 = v8 * 3 + 11
+168440 LET t = t + v8 / 7
+168450 IF t < 0 THEN 168460
+168460 LET v9 = 55
+168470 LET v9 = v9 * 3 + 2
+168480 LET t = t + v9 / 7
+168490 IF t < 0 THEN 168500
+168500 LET v10 = 59
+168510 LET v10 = v10 * 3 + 6
+168520 LET t = t + v10 / 7
+168530 IF t < 0 THEN 168540
+168540 LET v11 = 63
+168550 LET v11 = v11 * 3 + 10
+168560 LET t = t + v11 / 7
+168570 IF t < 0 THEN 168580
+168580 LET v12 = 67
+168590 LET v12 = v12 * 3 + 1
+168600 LET t = t + v12 / 7
+168610 IF t < 0 THEN 168620
+168620 LET v13 = 71
+168630 LET v13 = v13 * 3 + 5
+168640 LET t = t + v13 / 7
+168650 IF t < 0 THEN 168660
+168660 LET v14 = 75
+168670 LET v14 = v14 * 3 + 9
+168680 LET t = t + v14 / 7
+168690 IF t < 0 THEN 168700
+168700 LET v15 = 79
+168710 LET v15 = v15 * 3 + 0
+168720 LET t = t + v15 / 7
+168730 IF t < 0 THEN 168740
+168740 LET v16 = 83
+168750 LET v16 = v16 * 3 + 4
+168760 LET t = t + v16 / 7
+168770 IF t < 0 THEN 168780
+168780 LET v17 = 87
+168790 LET v17 = v17 * 3 + 8
+168800 LET t = t + v17 / 7
+168810 IF t < 0 THEN 168820
+168820 LET v18 = 91
+168830 LET v18 = v18 * 3 + 12
+168840 LET t = t + v18 / 7
+168850 IF t < 0 THEN 168860
+168860 LET v19 = 95
+168870 LET v19 = v19 * 3 + 3
+168880 LET t = t + v19 / 7
+168890 IF t < 0 THEN 168900
+168900 LET v20 = 2
+168910 LET v20 = v20 * 3 + 7
+168920 LET t = t + v20 / 7
+168930 IF t < 0 THEN 168940
+168940 LET v21 = 6
+168950 LET v21 = v21 * 3 + 11
+168960 LET t = t + v21 / 7
+168970 IF t < 0 THEN 168980
+168980 LET v22 = 10
+168990 LET v22 = v22 * 3 + 2
+169000 LET t = t + v22 / 7
+169010 IF t < 0 THEN 169020
+169020 LET v23 = 14
+169030 LET v23 = v23 * 3 + 6
+169040 LET t = t + v23 / 7
+169050 IF t < 0 THEN 169060
+169060 LET v24 = 18
+169070 LET v24 = v24 * 3 + 10
+169080 LET t = t + v24 / 7
+169090 IF t < 0 THEN 169100
+169100 LET v25 = 22
+169110 LET v25 = v25 * 3 + 1
+169120 LET t = t + v25 / 7
+169130 IF t < 0 THEN 169140
+169140 LET v26 = 26
+169150 LET v26 = v26 * 3 + 5
+169160 LET t = t + v26 / 7
+169170 IF t < 0 THEN 169180
+169180 LET v27 = 30
+169190 LET v27 = v27 * 3 + 9
+169200 LET t = t + v27 / 7
+169210 IF t < 0 THEN 169220
+169220 LET v28 = 34
+169230 LET v28 = v28 * 3 + 0
+169240 LET t = t + v28 / 7
+169250 IF t < 0 THEN 169260
+169260 LET v29 = 38
+169270 LET v29 = v29 * 3 + 4
+169280 LET t = t + v29 / 7
+169290 IF t < 0 THEN 169300
+169300 LET v30 = 42
+169310 LET v30 = v30 * 3 + 8
+169320 LET t = t + v30 / 7
+169330 IF t < 0 THEN 169340
+169340 LET v31 = 46
+169350 LET v31 = v31 * 3 + 12
+169360 LET t = t + v31 / 7
+169370 IF t < 0 THEN 169380
+169380 LET v32 = 50
+169390 LET v32 = v32 * 3 + 3
+169400 LET t = t + v32 / 7
+169410 IF t < 0 THEN 169420
+169420 LET v33 = 54
+169430 LET v33 = v33 * 3 + 7
+169440 LET t = t + v33 / 7
+169450 IF t < 0 THEN 169460
+169460 LET v34 = 58
+169470 LET v34 = v34 * 3 + 11
+169480 LET t = t + v34 / 7
+169490 IF t < 0 THEN 169500
+169500 LET v35 = 62
+169510 LET v35 = v35 * 3 + 2
+169520 LET t = t + v35 / 7
+169530 IF t < 0 THEN 169540
+169540 LET v36 = 66
+169550 LET v36 = v36 * 3 + 6
+169560 LET t = t + v36 / 7
+169570 IF t < 0 THEN 169580
+169580 LET v37 = 70
+169590 LET v37 = v37 * 3 + 10
+169600 LET t = t + v37 / 7
+169610 IF t < 0 THEN 169620
+169620 LET v38 = 74
+169630 LET v38 = v38 * 3 + 1
+169640 LET t = t + v38 / 7
+169650 IF t < 0 THEN 169660
+169660 LET v39 = 78
+169670 LET v39 = v39 * 3 + 5
+169680 LET t = t + v39 / 7
+169690 IF t < 0 THEN 169700
+169700 LET v40 = 82
+169710 LET v40 = v40 * 3 + 9
+169720 LET t = t + v40 / 7
+169730 IF t < 0 THEN 169740
+169740 LET v41 = 86
+169750 LET v41 = v41 * 3 + 0
+169760 LET t = t + v41 / 7
+169770 IF t < 0 THEN 169780
+169780 LET v42 = 90
+169790 LET v42 = v42 * 3 + 4
+169800 LET t = t + v42 / 7
+169810 IF t < 0 THEN 169820
+169820 LET v43 = 94
+169830 LET v43 = v43 * 3 + 8
+169840 LET t = t + v43 / 7
+169850 IF t < 0 THEN 169860
+169860 LET v44 = 1
+169870 LET v44 = v44 * 3 + 12
+169880 LET t = t + v44 / 7
+169890 IF t < 0 THEN 169900
+169900 LET v45 = 5
+169910 LET v45 = v45 * 3 + 3
+169920 LET t = t + v45 / 7
+169930 IF t < 0 THEN 169940
+169940 LET v46 = 9
+169950 LET v46 = v46 * 3 + 7
+169960 LET t = t + v46 / 7
+169970 IF t < 0 THEN 169980
+169980 LET v47 = 13
+169990 LET v47 = v47 * 3 + 11
+170000 LET t = t + v47 / 7
+170010 IF t < 0 THEN 170020
+170020 LET v48 = 17
+170030 LET v48 = v48 * 3 + 2
+170040 LET t = t + v48 / 7
+170050 IF t < 0 THEN 170060
+170060 LET v49 = 21
+170070 LET v49 = v49 * 3 + 6
+170080 LET t = t + v49 / 7
+170090 IF t < 0 THEN 170100
+170100 LET v0 = 25
+170110 LET v0 = v0 * 3 + 10
+170120 LET t = t + v0 / 7
+170130 IF t < 0 THEN 170140
+170140 LET v1 = 29
+170150 LET v1 = v1 * 3 + 1
+170160 LET t = t + v1 / 7
+170170 IF t < 0 THEN 170180
+170180 LET v2 = 33
+170190 LET v2 = v2 * 3 + 5
+170200 LET t = t + v2 / 7
+170210 IF t < 0 THEN 170220
+170220 LET v3 = 37
+170230 LET v3 = v3 * 3 + 9
+170240 LET t = t + v3 / 7
+170250 IF t < 0 THEN 170260
+170260 LET v4 = 41
+170270 LET v4 = v4 * 3 + 0
+170280 LET t = t + v4 / 7
+170290 IF t < 0 THEN 170300
+170300 LET v5 = 45
+170310 LET v5 = v5 * 3 + 4
+170320 LET t = t + v5 / 7
+170330 IF t < 0 THEN 170340
+170340 LET v6 = 49
+170350 LET v6 = v6 * 3 + 8
+170360 LET t = t + v6 / 7
+170370 IF t < 0 THEN 170380
+170380 LET v7 = 53
+170390 LET v7 = v7 * 3 + 12
+170400 LET t = t + v7 / 7
+170410 IF t < 0 THEN 170420
+170420 LET v8 = 57
+170430 LET v8 = v8 * 3 + 3
+170440 LET t = t + v8 / 7
+170450 IF t < 0 THEN 170460
+170460 LET v9 = 61
+170470 LET v9 = v9 * 3 + 7
+170480 LET t = t + v9 / 7
+170490 IF t < 0 THEN 170500
+170500 LET v10 = 65
+170510 LET v10 = v10 * 3 + 11
+170520 LET t = t + v10 / 7
+170530 IF t < 0 THEN 170540
+170540 LET v11 = 69
+170550 LET v11 = v11 * 3 + 2
+170560 LET t = t + v11 / 7
+170570 IF t < 0 THEN 170580
+170580 LET v12 = 73
+170590 LET v12 = v12 * 3 + 6
+170600 LET t = t + v12 / 7
+170610 IF t < 0 THEN 170620
+170620 LET v13 = 77
+170630 LET v13 = v13 * 3 + 10
+170640 LET t = t + v13 / 7
+170650 IF t < 0 THEN 170660
+170660 LET v14 = 81
+170670 LET v14 = v14 * 3 + 1
+170680 LET t = t + v14 / 7
+170690 IF t < 0 THEN 170700
+170700 LET v15 = 85
+170710 LET v15 = v15 * 3 + 5
+170720 LET t = t + v15 / 7
+170730 IF t < 0 THEN 170740
+170740 LET v16 = 89
+170750 LET v16 = v16 * 3 + 9
+170760 LET t = t + v16 / 7
+170770 IF t < 0 THEN 170780
+170780 LET v17 = 93
+170790 LET v17 = v17 * 3 + 0
+170800 LET t = t + v17 / 7
+170810 IF t < 0 THEN 170820
+170820 LET v18 = 0
+170830 LET v18 = v18 * 3 + 4
+170840 LET t = t + v18 / 7
+170850 IF t < 0 THEN 170860
+170860 LET v19 = 4
+170870 LET v19 = v19 * 3 + 8
+170880 LET t = t + v19 / 7
+170890 IF t < 0 THEN 170900
+170900 LET v20 = 8
+170910 LET v20 = v20 * 3 + 12
+170920 LET t = t + v20 / 7
+170930 IF t < 0 THEN 170940
+170940 LET v21 = 12
+170950 LET v21 = v21 * 3 + 3
+170960 LET t = t + v21 / 7
+170970 IF t < 0 THEN 170980
+170980 LET v22 = 16
+170990 LET v22 = v22 * 3 + 7
+171000 LET t = t + v22 / 7
+171010 IF t < 0 THEN 171020
+171020 LET v23 = 20
+171030 LET v23 = v23 * 3 + 11
+171040 LET t = t + v23 / 7
+171050 IF t < 0 THEN 171060
+171060 LET v24 = 24
+171070 LET v24 = v24 * 3 + 2
+171080 LET t = t + v24 / 7
+171090 IF t < 0 THEN 171100
+171100 LET v25 = 28
+171110 LET v25 = v25 * 3 + 6
+171120 LET t = t + v25 / 7
+171130 IF t < 0 THEN 171140
+171140 LET v26 = 32
+171150 LET v26 = v26 * 3 + 10
+171160 LET t = t + v26 / 7
+171170 IF t < 0 THEN 171180
+171180 LET v27 = 36
+171190 LET v27 = v27 * 3 + 1
+171200 LET t = t + v27 / 7
+171210 IF t < 0 THEN 171220
+171220 LET v28 = 40
+171230 LET v28 = v28 * 3 + 5
+171240 LET t = t + v28 / 7
+171250 IF t < 0 THEN 171260
+171260 LET v29 = 44
+171270 LET v29 = v29 * 3 + 9
+171280 LET t = t + v29 / 7
+171290 IF t < 0 THEN 171300
+171300 LET v30 = 48
+171310 LET v30 = v30 * 3 + 0
+171320 LET t = t + v30 / 7
+171330 IF t < 0 THEN 171340
+171340 LET v31 = 52
+171350 LET v31 = v31 * 3 + 4
+171360 LET t = t + v31 / 7
+171370 IF t < 0 THEN 171380
+171380 LET v32 = 56
+171390 LET v32 = v32 * 3 + 8
+171400 LET t = t + v32 / 7
+171410 IF t < 0 THEN 171420
+171420 LET v33 = 60
+171430 LET v33 = v33 * 3 + 12
+171440 LET t = t + v33 / 7
+171450 IF t < 0 THEN 171460
+171460 LET v34 = 64
+171470 LET v34 = v34 * 3 + 3
+171480 LET t = t + v34 / 7
+171490 IF t < 0 THEN 171500
+171500 LET v35 = 68
+171510 LET v35 = v35 * 3 + 7
+171520 LET t = t + v35 / 7
+171530 IF t < 0 THEN 171540
+171540 LET v36 = 72
+171550 LET v36 = v36 * 3 + 11
+171560 LET t = t + v36 / 7
+171570 IF t < 0 THEN 171580
+171580 LET v37 = 76
+171590 LET v37 = v37 * 3 + 2
+171600 LET t = t + v37 / 7
+171610 IF t < 0 THEN 171620
+171620 LET v38 = 80
+171630 LET v38 = v38 * 3 + 6
+171640 LET t = t + v38 / 7
+171650 IF t < 0 THEN 171660
+171660 LET v39 = 84
+171670 LET v39 = v39 * 3 + 10
+171680 LET t = t + v39 / 7
+171690 IF t < 0 THEN 171700
+171700 LET v40 = 88
+171710 LET v40 = v40 * 3 + 1
+171720 LET t = t + v40 / 7
+171730 IF t < 0 THEN 171740
+171740 LET v41 = 92
+171750 LET v41 = v41 * 3 + 5
+171760 LET t = t + v41 / 7
+171770 IF t < 0 THEN 171780
+171780 LET v42 = 96
+171790 LET v42 = v42 * 3 + 9
+171800 LET t = t + v42 / 7
+171810 IF t < 0 THEN 171820
+171820 LET v43 = 3
+171830 LET v43 = v43 * 3 + 0
+171840 LET t = t + v43 / 7
+171850 IF t < 0 THEN 171860
+171860 LET v44 = 7
+171870 LET v44 = v44 * 3 + 4
+171880 LET t = t + v44 / 7
+171890 IF t < 0 THEN 171900
+171900 LET v45 = 11
+171910 LET v45 = v45 * 3 + 8
+171920 LET t = t + v45 / 7
+171930 IF t < 0 THEN 171940
+171940 LET v46 = 15
+171950 LET v46 = v46 * 3 + 12
+171960 LET t = t + v46 / 7
+171970 IF t < 0 THEN 171980
+171980 LET v47 = 19
+171990 LET v47 = v47 * 3 + 3
+172000 LET t = t + v47 / 7
+172010 IF t < 0 THEN 172020
+172020 LET v48 = 23
+172030 LET v48 = v48 * 3 + 7
+172040 LET t = t + v48 / 7
+172050 IF t < 0 THEN 172060
+172060 LET v49 = 27
+172070 LET v49 = v49 * 3 + 11
+172080 LET t = t + v49 / 7
+172090 IF t < 0 THEN 172100
+172100 LET v0 = 31
+172110 LET v0 = v0 * 3 + 2
+172120 LET t = t + v0 / 7
+172130 IF t < 0 THEN 172140
+172140 LET v1 = 35
+172150 LET v1 = v1 * 3 + 6
+172160 LET t = t + v1 / 7
+172170 IF t < 0 THEN 172180
+172180 LET v2 = 39
+172190 LET v2 = v2 * 3 + 10
+172200 LET t = t + v2 / 7
+172210 IF t < 0 THEN 172220
+172220 LET v3 = 43
+172230 LET v3 = v3 * 3 + 1
+172240 LET t = t + v3 / 7
+172250 IF t < 0 THEN 172260
+172260 LET v4 = 47
+172270 LET v4 = v4 * 3 + 5
+172280 LET t = t + v4 / 7
+172290 IF t < 0 THEN 172300
+172300 LET v5 = 51
+172310 LET v5 = v5 * 3 + 9
+172320 LET t = t + v5 / 7
+172330 IF t < 0 THEN 172340
+172340 LET v6 = 55
+172350 LET v6 = v6 * 3 + 0
+172360 LET t = t + v6 / 7
+172370 IF t < 0 THEN 172380
+172380 LET v7 = 59
+172390 LET v7 = v7 * 3 + 4
+172400 LET t = t + v7 / 7
+172410 IF t < 0 THEN 172420
+172420 LET v8 = 63
+172430 LET v8 = v8 * 3 + 8
+172440 LET t = t + v8 / 7
+172450 IF t < 0 THEN 172460
+172460 LET v9 = 67
+172470 LET v9 = v9 * 3 + 12
+172480 LET t = t + v9 / 7
+172490 IF t < 0 THEN 172500
+172500 LET v10 = 71
+172510 LET v10 = v10 * 3 + 3
+172520 LET t = t + v10 / 7
+172530 IF t < 0 THEN 172540
+172540 LET v11 = 75
+172550 LET v11 = v11 * 3 + 7
+172560 LET t = t + v11 / 7
+172570 IF t < 0 THEN 172580
+172580 LET v12 = 79
+172590 LET v12 = v12 * 3 + 11
+172600 LET t = t + v12 / 7
+172610 IF t < 0 THEN 172620
+172620 LET v13 = 83
+172630 LET v13 = v13 * 3 + 2
+172640 LET t = t + v13 / 7
+172650 IF t < 0 THEN 172660
+172660 LET v14 = 87
+172670 LET v14 = v14 * 3 + 6
+172680 LET t = t + v14 / 7
+172690 IF t < 0 THEN 172700
+172700 LET v15 = 91
+172710 LET v15 = v15 * 3 + 10
+172720 LET t = t + v15 / 7
+172730 IF t < 0 THEN 172740
+172740 LET v16 = 95
+172750 LET v16 = v16 * 3 + 1
+172760 LET t = t + v16 / 7
+172770 IF t < 0 THEN 172780
+172780 LET v17 = 2
+172790 LET v17 = v17 * 3 + 5
+172800 LET t = t + v17 / 7
+172810 IF t < 0 THEN 172820
+172820 LET v18 = 6
+172830 LET v18 = v18 * 3 + 9
+172840 LET t = t + v18 / 7
+172850 IF t < 0 THEN 172860
+172860 LET v19 = 10
+172870 LET v19 = v19 * 3 + 0
+172880 LET t = t + v19 / 7
+172890 IF t < 0 THEN 172900
+172900 LET v20 = 14
+172910 LET v20 = v20 * 3 + 4
+172920 LET t = t + v20 / 7
+172930 IF t < 0 THEN 172940
+172940 LET v21 = 18
+172950 LET v21 = v21 * 3 + 8
+172960 LET t = t + v21 / 7
+172970 IF t < 0 THEN 172980
+172980 LET v22 = 22
+172990 LET v22 = v22 * 3 + 12
+173000 LET t = t + v22 / 7
+173010 IF t < 0 THEN 173020
+173020 LET v23 = 26
+173030 LET v23 = v23 * 3 + 3
+173040 LET t = t + v23 / 7
+173050 IF t < 0 THEN 173060
+173060 LET v24 = 30
+173070 LET v24 = v24 * 3 + 7
+173080 LET t = t + v24 / 7
+173090 IF t < 0 THEN 173100
+173100 LET v25 = 34
+173110 LET v25 = v25 * 3 + 11
+173120 LET t = t + v25 / 7
+173130 IF t < 0 THEN 173140
+173140 LET v26 = 38
+173150 LET v26 = v26 * 3 + 2
+173160 LET t = t + v26 / 7
+173170 IF t < 0 THEN 173180
+173180 LET v27 = 42
+173190 LET v27 = v27 * 3 + 6
+173200 LET t = t + v27 / 7
+173210 IF t < 0 THEN 173220
+173220 LET v28 = 46
+173230 LET v28 = v28 * 3 + 10
+173240 LET t = t + v28 / 7
+173250 IF t < 0 THEN 173260
+173260 LET v29 = 50
+173270 LET v29 = v29 * 3 + 1
+173280 LET t = t + v29 / 7
+173290 IF t < 0 THEN 173300
+173300 LET v30 = 54
+173310 LET v30 = v30 * 3 + 5
+173320 LET t = t + v30 / 7
+173330 IF t < 0 THEN 173340
+173340 LET v31 = 58
+173350 LET v31 = v31 * 3 + 9
+173360 LET t = t + v31 / 7
+173370 IF t < 0 THEN 173380
+173380 LET v32 = 62
+173390 LET v32 = v32 * 3 + 0
+173400 LET t = t + v32 / 7
+173410 IF t < 0 THEN 173420
+173420 LET v33 = 66
+173430 LET v33 = v33 * 3 + 4
+173440 LET t = t + v33 / 7
+173450 IF t < 0 THEN 173460
+173460 LET v34 = 70
+173470 LET v34 = v34 * 3 + 8
+173480 LET t = t + v34 / 7
+173490 IF t < 0 THEN 173500
+173500 LET v35 = 74
+173510 LET v35 = v35 * 3 + 12
+173520 LET t = t + v35 / 7
+173530 IF t < 0 THEN 173540
+173540 LET v36 = 78
+173550 LET v36 = v36 * 3 + 3
+173560 LET t = t + v36 / 7
+173570 IF t < 0 THEN 173580
+173580 LET v37 = 82
+173590 LET v37 = v37 * 3 + 7
+173600 LET t = t + v37 / 7
+173610 IF t < 0 THEN 173620
+173620 LET v38 = 86
+173630 LET v38 = v38 * 3 + 11
+173640 LET t = t + v38 / 7
+173650 IF t < 0 THEN 173660
+173660 LET v39 = 90
+173670 LET v39 = v39 * 3 + 2
+173680 LET t = t + v39 / 7
+173690 IF t < 0 THEN 173700
+173700 LET v40 = 94
+173710 LET v40 = v40 * 3 + 6
+173720 LET t = t + v40 / 7
+173730 IF t < 0 THEN 173740
+173740 LET v41 = 1
+173750 LET v41 = v41 * 3 + 10
+173760 LET t = t + v41 / 7
+173770 IF t < 0 THEN 173780
+173780 LET v42 = 5
+173790 LET v42 = v42 * 3 + 1
+173800 LET t = t + v42 / 7
+173810 IF t < 0 THEN 173820
+173820 LET v43 = 9
+173830 LET v43 = v43 * 3 + 5
+173840 LET t = t + v43 / 7
+173850 IF t < 0 THEN 173860
+173860 LET v44 = 13
+173870 LET v44 = v44 * 3 + 9
+173880 LET t = t + v44 / 7
+173890 IF t < 0 THEN 173900
+173900 LET v45 = 17
+173910 LET v45 = v45 * 3 + 0
+173920 LET t = t + v45 / 7
+173930 IF t < 0 THEN 173940
+173940 LET v46 = 21
+173950 LET v46 = v46 * 3 + 4
+173960 LET t = t + v46 / 7
+173970 IF t < 0 THEN 173980
+173980 LET v47 = 25
+173990 LET v47 = v47 * 3 + 8
+174000 LET t = t + v47 / 7
+174010 IF t < 0 THEN 174020
+174020 LET v48 = 29
+174030 LET v48 = v48 * 3 + 12
+174040 LET t = t + v48 / 7
+174050 IF t < 0 THEN 174060
+174060 LET v49 = 33
+174070 LET v49 = v49 * 3 + 3
+174080 LET t = t + v49 / 7
+174090 IF t < 0 THEN 174100
+174100 LET v0 = 37
+174110 LET v0 = v0 * 3 + 7
+174120 LET t = t + v0 / 7
+174130 IF t < 0 THEN 174140
+174140 LET v1 = 41
+174150 LET v1 = v1 * 3 + 11
+174160 LET t = t + v1 / 7
+174170 IF t < 0 THEN 174180
+174180 LET v2 = 45
+174190 LET v2 = v2 * 3 + 2
+174200 LET t = t + v2 / 7
+174210 IF t < 0 THEN 174220
+174220 LET v3 = 49
+174230 LET v3 = v3 * 3 + 6
+174240 LET t = t + v3 / 7
+174250 IF t < 0 THEN 174260
+174260 LET v4 = 53
+174270 LET v4 = v4 * 3 + 10
+174280 LET t = t + v4 / 7
+174290 IF t < 0 THEN 174300
+174300 LET v5 = 57
+174310 LET v5 = v5 * 3 + 1
+174320 LET t = t + v5 / 7
+174330 IF t < 0 THEN 174340
+174340 LET v6 = 61
+174350 LET v6 = v6 * 3 + 5
+174360 LET t = t + v6 / 7
+174370 IF t < 0 THEN 174380
+174380 LET v7 = 65
+174390 LET v7 = v7 * 3 + 9
+174400 LET t = t + v7 / 7
+174410 IF t < 0 THEN 174420
+174420 LET v8 = 69
+174430 LET v8 = v8 * 3 + 0
+174440 LET t = t + v8 / 7
+174450 IF t < 0 THEN 174460
+174460 LET v9 = 73
+174470 LET v9 = v9 * 3 + 4
+174480 LET t = t + v9 / 7
+174490 IF t < 0 THEN 174500
+174500 LET v10 = 77
+174510 LET v10 = v10 * 3 + 8
+174520 LET t = t + v10 / 7
+174530 IF t < 0 THEN 174540
+174540 LET v11 = 81
+174550 LET v11 = v11 * 3 + 12
+174560 LET t = t + v11 / 7
+174570 IF t < 0 THEN 174580
+174580 LET v12 = 85
+174590 LET v12 = v12 * 3 + 3
+174600 LET t = t + v12 / 7
+174610 IF t < 0 THEN 174620
+174620 LET v13 = 89
+174630 LET v13 = v13 * 3 + 7
+174640 LET t = t + v13 / 7
+174650 IF t < 0 THEN 174660
+174660 LET v14 = 93
+174670 LET v14 = v14 * 3 + 11
+174680 LET t = t + v14 / 7
+174690 IF t < 0 THEN 174700
+174700 LET v15 = 0
+174710 LET v15 = v15 * 3 + 2
+174720 LET t = t + v15 / 7
+174730 IF t < 0 THEN 174740
+174740 LET v16 = 4
+174750 LET v16 = v16 * 3 + 6
+174760 LET t = t + v16 / 7
+174770 IF t < 0 THEN 174780
+174780 LET v17 = 8
+174790 LET v17 = v17 * 3 + 10
+174800 LET t = t + v17 / 7
+174810 IF t < 0 THEN 174820
+174820 LET v18 = 12
+174830 LET v18 = v18 * 3 + 1
+174840 LET t = t + v18 / 7
+174850 IF t < 0 THEN 174860
+174860 LET v19 = 16
+174870 LET v19 = v19 * 3 + 5
+174880 LET t = t + v19 / 7
+174890 IF t < 0 THEN 174900
+174900 LET v20 = 20
+174910 LET v20 = v20 * 3 + 9
+174920 LET t = t + v20 / 7
+174930 IF t < 0 THEN 174940
+174940 LET v21 = 24
+174950 LET v21 = v21 * 3 + 0
+174960 LET t = t + v21 / 7
+174970 IF t < 0 THEN 174980
+174980 LET v22 = 28
+174990 LET v22 = v22 * 3 + 4
+175000 LET t = t + v22 / 7
+175010 IF t < 0 THEN 175020
+175020 LET v23 = 32
+175030 LET v23 = v23 * 3 + 8
+175040 LET t = t + v23 / 7
+175050 IF t < 0 THEN 175060
+175060 LET v24 = 36
+175070 LET v24 = v24 * 3 + 12
+175080 LET t = t + v24 / 7
+175090 IF t < 0 THEN 175100
+175100 LET v25 = 40
+175110 LET v25 = v25 * 3 + 3
+175120 LET t = t + v25 / 7
+175130 IF t < 0 THEN 175140
+175140 LET v26 = 44
+175150 LET v26 = v26 * 3 + 7
+175160 LET t = t + v26 / 7
+175170 IF t < 0 THEN 175180
+175180 LET v27 = 48
+175190 LET v27 = v27 * 3 + 11
+175200 LET t = t + v27 / 7
+175210 IF t < 0 THEN 175220
+175220 LET v28 = 52
+175230 LET v28 = v28 * 3 + 2
+175240 LET t = t + v28 / 7
+175250 IF t < 0 THEN 175260
+175260 LET v29 = 56
+175270 LET v29 = v29 * 3 + 6
+175280 LET t = t + v29 / 7
+175290 IF t < 0 THEN 175300
+175300 LET v30 = 60
+175310 LET v30 = v30 * 3 + 10
+175320 LET t = t + v30 / 7
+175330 IF t < 0 THEN 175340
+175340 LET v31 = 64
+175350 LET v31 = v31 * 3 + 1
+175360 LET t = t + v31 / 7
+175370 IF t < 0 THEN 175380
+175380 LET v32 = 68
+175390 LET v32 = v32 * 3 + 5
+175400 LET t = t + v32 / 7
+175410 IF t < 0 THEN 175420
+175420 LET v33 = 72
+175430 LET v33 = v33 * 3 + 9
+175440 LET t = t + v33 / 7
+175450 IF t < 0 THEN 175460
+175460 LET v34 = 76
+175470 LET v34 = v34 * 3 + 0
+175480 LET t = t + v34 / 7
+175490 IF t < 0 THEN 175500
+175500 LET v35 = 80
+175510 LET v35 = v35 * 3 + 4
+175520 LET t = t + v35 / 7
+175530 IF t < 0 THEN 175540
+175540 LET v36 = 84
+175550 LET v36 = v36 * 3 + 8
+175560 LET t = t + v36 / 7
+175570 IF t < 0 THEN 175580
+175580 LET v37 = 88
+175590 LET v37 = v37 * 3 + 12
+175600 LET t = t + v37 / 7
+175610 IF t < 0 THEN 175620
+175620 LET v38 = 92
+175630 LET v38 = v38 * 3 + 3
+175640 LET t = t + v38 / 7
+175650 IF t < 0 THEN 175660
+175660 LET v39 = 96
+175670 LET v39 = v39 * 3 + 7
+175680 LET t = t + v39 / 7
+175690 IF t < 0 THEN 175700
+175700 LET v40 = 3
+175710 LET v40 = v40 * 3 + 11
+175720 LET t = t + v40 / 7
+175730 IF t < 0 THEN 175740
+175740 LET v41 = 7
+175750 LET v41 = v41 * 3 + 2
+175760 LET t = t + v41 / 7
+175770 IF t < 0 THEN 175780
+175780 LET v42 = 11
+175790 LET v42 = v42 * 3 + 6
+175800 LET t = t + v42 / 7
+175810 IF t < 0 THEN 175820
+175820 LET v43 = 15
+175830 LET v43 = v43 * 3 + 10
+175840 LET t = t + v43 / 7
+175850 IF t < 0 THEN 175860
+175860 LET v44 = 19
+175870 LET v44 = v44 * 3 + 1
+175880 LET t = t + v44 / 7
+175890 IF t < 0 THEN 175900
+175900 LET v45 = 23
+175910 LET v45 = v45 * 3 + 5
+175920 LET t = t + v45 / 7
+175930 IF t < 0 THEN 175940
+175940 LET v46 = 27
+175950 LET v46 = v46 * 3 + 9
+175960 LET t = t + v46 / 7
+175970 IF t < 0 THEN 175980
+175980 LET v47 = 31
+175990 LET v47 = v47 * 3 + 0
+176000 LET t = t + v47 / 7
+176010 IF t < 0 THEN 176020
+176020 LET v48 = 35
+176030 LET v48 = v48 * 3 + 4
+176040 LET t = t + v48 / 7
+176050 IF t < 0 THEN 176060
+176060 LET v49 = 39
+176070 LET v49 = v49 * 3 + 8
+176080 LET t = t + v49 / 7
+176090 IF t < 0 THEN 176100
+176100 LET v0 = 43
+176110 LET v0 = v0 * 3 + 12
+176120 LET t = t + v0 / 7
+176130 IF t < 0 THEN 176140
+176140 LET v1 = 47
+176150 LET v1 = v1 * 3 + 3
+176160 LET t = t + v1 / 7
+176170 IF t < 0 THEN 176180
+176180 LET v2 = 51
+176190 LET v2 = v2 * 3 + 7
+176200 LET t = t + v2 / 7
+176210 IF t < 0 THEN 176220
+176220 LET v3 = 55
+176230 LET v3 = v3 * 3 + 11
+176240 LET t = t + v3 / 7
+176250 IF t < 0 THEN 176260
+176260 LET v4 = 59
+176270 LET v4 = v4 * 3 + 2
+176280 LET t = t + v4 / 7
+176290 IF t < 0 THEN 176300
+176300 LET v5 = 63
+176310 LET v5 = v5 * 3 + 6
+176320 LET t = t + v5 / 7
+176330 IF t < 0 THEN 176340
+176340 LET v6 = 67
+176350 LET v6 = v6 * 3 + 10
+176360 LET t = t + v6 / 7
+176370 IF t < 0 THEN 176380
+176380 LET v7 = 71
+176390 LET v7 = v7 * 3 + 1
+176400 LET t = t + v7 / 7
+176410 IF t < 0 THEN 176420
+176420 LET v8 = 75
+176430 LET v8 = v8 * 3 + 5
+176440 LET t = t + v8 / 7
+176450 IF t < 0 THEN 176460
+176460 LET v9 = 79
+176470 LET v9 = v9 * 3 + 9
+176480 LET t = t + v9 / 7
+176490 IF t < 0 THEN 176500
+176500 LET v10 = 83
+176510 LET v10 = v10 * 3 + 0
+176520 LET t = t + v10 / 7
+176530 IF t < 0 THEN 176540
+176540 LET v11 = 87
+176550 LET v11 = v11 * 3 + 4
+176560 LET t = t + v11 / 7
+176570 IF t < 0 THEN 176580
+176580 LET v12 = 91
+176590 LET v12 = v12 * 3 + 8
+176600 LET t = t + v12 / 7
+176610 IF t < 0 THEN 176620
+176620 LET v13 = 95
+176630 LET v13 = v13 * 3 + 12
+176640 LET t = t + v13 / 7
+176650 IF t < 0 THEN 176660
+176660 LET v14 = 2
+176670 LET v14 = v14 * 3 + 3
+176680 LET t = t + v14 / 7
+176690 IF t < 0 THEN 176700
+176700 LET v15 = 6
+176710 LET v15 = v15 * 3 + 7
+176720 LET t = t + v15 / 7
+176730 IF t < 0 THEN 176740
+176740 LET v16 = 10
+176750 LET v16 = v16 * 3 + 11
+176760 LET t = t + v16 / 7
+176770 IF t < 0 THEN 176780
+176780 LET v17 = 14
+176790 LET v17 = v17 * 3 + 2
+176800 LET t = t + v17 / 7
+176810 IF t < 0 THEN 176820
+176820 LET v18 = 18
+176830 LET v18 = v18 * 3 + 6
+176840 LET t = t + v18 / 7
+176850 IF t < 0 THEN 176860
+176860 LET v19 = 22
+176870 LET v19 = v19 * 3 + 10
+176880 LET t = t + v19 / 7
+176890 IF t < 0 THEN 176900
+176900 LET v20 = 26
+176910 LET v20 = v20 * 3 + 1
+176920 LET t = t + v20 / 7
+176930 IF t < 0 THEN 176940
+176940 LET v21 = 30
+176950 LET v21 = v21 * 3 + 5
+176960 LET t = t + v21 / 7
+176970 IF t < 0 THEN 176980
+176980 LET v22 = 34
+176990 LET v22 = v22 * 3 + 9
+177000 LET t = t + v22 / 7
+177010 IF t < 0 THEN 177020
+177020 LET v23 = 38
+177030 LET v23 = v23 * 3 + 0
+177040 LET t = t + v23 / 7
+177050 IF t < 0 THEN 177060
+177060 LET v24 = 42
+177070 LET v24 = v24 * 3 + 4
+177080 LET t = t + v24 / 7
+177090 IF t < 0 THEN 177100
+177100 LET v25 = 46
+177110 LET v25 = v25 * 3 + 8
+177120 LET t = t + v25 / 7
+177130 IF t < 0 THEN 177140
+177140 LET v26 = 50
+177150 LET v26 = v26 * 3 + 12
+177160 LET t = t + v26 / 7
+177170 IF t < 0 THEN 177180
+177180 LET v27 = 54
+177190 LET v27 = v27 * 3 + 3
+177200 LET t = t + v27 / 7
+177210 IF t < 0 THEN 177220
+177220 LET v28 = 58
+177230 LET v28 = v28 * 3 + 7
+177240 LET t = t + v28 / 7
+177250 IF t < 0 THEN 177260
+177260 LET v29 = 62
+177270 LET v29 = v29 * 3 + 11
+177280 LET t = t + v29 / 7
+177290 IF t < 0 THEN 177300
+177300 LET v30 = 66
+177310 LET v30 = v30 * 3 + 2
+177320 LET t = t + v30 / 7
+177330 IF t < 0 THEN 177340
+177340 LET v31 = 70
+177350 LET v31 = v31 * 3 + 6
+177360 LET t = t + v31 / 7
+177370 IF t < 0 THEN 177380
+177380 LET v32 = 74
+177390 LET v32 = v32 * 3 + 10
+177400 LET t = t + v32 / 7
+177410 IF t < 0 THEN 177420
+177420 LET v33 = 78
+177430 LET v33 = v33 * 3 + 1
+177440 LET t = t + v33 / 7
+177450 IF t < 0 THEN 177460
+177460 LET v34 = 82
+177470 LET v34 = v34 * 3 + 5
+177480 LET t = t + v34 / 7
+177490 IF t < 0 THEN 177500
+177500 LET v35 = 86
+177510 LET v35 = v35 * 3 + 9
+177520 LET t = t + v35 / 7
+177530 IF t < 0 THEN 177540
+177540 LET v36 = 90
+177550 LET v36 = v36 * 3 + 0
+177560 LET t = t + v36 / 7
+177570 IF t < 0 THEN 177580
+177580 LET v37 = 94
+177590 LET v37 = v37 * 3 + 4
+177600 LET t = t + v37 / 7
+177610 IF t < 0 THEN 177620
+177620 LET v38 = 1
+177630 LET v38 = v38 * 3 + 8
+177640 LET t = t + v38 / 7
+177650 IF t < 0 THEN 177660
+177660 LET v39 = 5
+177670 LET v39 = v39 * 3 + 12
+177680 LET t = t + v39 / 7
+177690 IF t < 0 THEN 177700
+177700 LET v40 = 9
+177710 LET v40 = v40 * 3 + 3
+177720 LET t = t + v40 / 7
+177730 IF t < 0 THEN 177740
+177740 LET v41 = 13
+177750 LET v41 = v41 * 3 + 7
+177760 LET t = t + v41 / 7
+177770 IF t < 0 THEN 177780
+177780 LET v42 = 17
+177790 LET v42 = v42 * 3 + 11
+177800 LET t = t + v42 / 7
+177810 IF t < 0 THEN 177820
+177820 LET v43 = 21
+177830 LET v43 = v43 * 3 + 2
+177840 LET t = t + v43 / 7
+177850 IF t < 0 THEN 177860
+177860 LET v44 = 25
+177870 LET v44 = v44 * 3 + 6
+177880 LET t = t + v44 / 7
+177890 IF t < 0 THEN 177900
+177900 LET v45 = 29
+177910 LET v45 = v45 * 3 + 10
+177920 LET t = t + v45 / 7
+177930 IF t < 0 THEN 177940
+177940 LET v46 = 33
+177950 LET v46 = v46 * 3 + 1
+177960 LET t = t + v46 / 7
+177970 IF t < 0 THEN 177980
+177980 LET v47 = 37
+177990 LET v47 = v47 * 3 + 5
+178000 LET t = t + v47 / 7
+178010 IF t < 0 THEN 178020
+178020 LET v48 = 41
+178030 LET v48 = v48 * 3 + 9
+178040 LET t = t + v48 / 7
+178050 IF t < 0 THEN 178060
+178060 LET v49 = 45
+178070 LET v49 = v49 * 3 + 0
+178080 LET t = t + v49 / 7
+178090 IF t < 0 THEN 178100
+178100 LET v0 = 49
+178110 LET v0 = v0 * 3 + 4
+178120 LET t = t + v0 / 7
+178130 IF t < 0 THEN 178140
+178140 LET v1 = 53
+178150 LET v1 = v1 * 3 + 8
+178160 LET t = t + v1 / 7
+178170 IF t < 0 THEN 178180
+178180 LET v2 = 57
+178190 LET v2 = v2 * 3 + 12
+178200 LET t = t + v2 / 7
+178210 IF t < 0 THEN 178220
+178220 LET v3 = 61
+178230 LET v3 = v3 * 3 + 3
+178240 LET t = t + v3 / 7
+178250 IF t < 0 THEN 178260
+178260 LET v4 = 65
+178270 LET v4 = v4 * 3 + 7
+178280 LET t = t + v4 / 7
+178290 IF t < 0 THEN 178300
+178300 LET v5 = 69
+178310 LET v5 = v5 * 3 + 11
+178320 LET t = t + v5 / 7
+178330 IF t < 0 THEN 178340
+178340 LET v6 = 73
+178350 LET v6 = v6 * 3 + 2
+178360 LET t = t + v6 / 7
+178370 IF t < 0 THEN 178380
+178380 LET v7 = 77
+178390 LET v7 = v7 * 3 + 6
+178400 LET t = t + v7 / 7
+178410 IF t < 0 THEN 178420
+178420 LET v8 = 81
+178430 LET v8 = v8 * 3 + 10
+178440 LET t = t + v8 / 7
+178450 IF t < 0 THEN 178460
+178460 LET v9 = 85
+178470 LET v9 = v9 * 3 + 1
+178480 LET t = t + v9 / 7
+178490 IF t < 0 THEN 178500
+178500 LET v10 = 89
+178510 LET v10 = v10 * 3 + 5
+178520 LET t = t + v10 / 7
+178530 IF t < 0 THEN 178540
+178540 LET v11 = 93
+178550 LET v11 = v11 * 3 + 9
+178560 LET t = t + v11 / 7
+178570 IF t < 0 THEN 178580
+178580 LET v12 = 0
+178590 LET v12 = v12 * 3 + 0
+178600 LET t = t + v12 / 7
+178610 IF t < 0 THEN 178620
+178620 LET v13 = 4
+178630 LET v13 = v13 * 3 + 4
+178640 LET t = t + v13 / 7
+178650 IF t < 0 THEN 178660
+178660 LET v14 = 8
+178670 LET v14 = v14 * 3 + 8
+178680 LET t = t + v14 / 7
+178690 IF t < 0 THEN 178700
+178700 LET v15 = 12
+178710 LET v15 = v15 * 3 + 12
+178720 LET t = t + v15 / 7
+178730 IF t < 0 THEN 178740
+178740 LET v16 = 16
+178750 LET v16 = v16 * 3 + 3
+178760 LET t = t + v16 / 7
+178770 IF t < 0 THEN 178780
+178780 LET v17 = 20
+178790 LET v17 = v17 * 3 + 7
+178800 LET t = t + v17 / 7
+178810 IF t < 0 THEN 178820
+178820 LET v18 = 24
+178830 LET v18 = v18 * 3 + 11
+178840 LET t = t + v18 / 7
+178850 IF t < 0 THEN 178860
+178860 LET v19 = 28
+178870 LET v19 = v19 * 3 + 2
+178880 LET t = t + v19 / 7
+178890 IF t < 0 THEN 178900
+178900 LET v20 = 32
+178910 LET v20 = v20 * 3 + 6
+178920 LET t = t + v20 / 7
+178930 IF t < 0 THEN 178940
+178940 LET v21 = 36
+178950 LET v21 = v21 * 3 + 10
+178960 LET t = t + v21 / 7
+178970 IF t < 0 THEN 178980
+178980 LET v22 = 40
+178990 LET v22 = v22 * 3 + 1
+179000 LET t = t + v22 / 7
+179010 IF t < 0 THEN 179020
+179020 LET v23 = 44
+179030 LET v23 = v23 * 3 + 5
+179040 LET t = t + v23 / 7
+179050 IF t < 0 THEN 179060
+179060 LET v24 = 48
+179070 LET v24 = v24 * 3 + 9
+179080 LET t = t + v24 / 7
+179090 IF t < 0 THEN 179100
+179100 LET v25 = 52
+179110 LET v25 = v25 * 3 + 0
+179120 LET t = t + v25 / 7
+179130 IF t < 0 THEN 179140
+179140 LET v26 = 56
+179150 LET v26 = v26 * 3 + 4
+179160 LET t = t + v26 / 7
+179170 IF t < 0 THEN 179180
+179180 LET v27 = 60
+179190 LET v27 = v27 * 3 + 8
+179200 LET t = t + v27 / 7
+179210 IF t < 0 THEN 179220
+179220 LET v28 = 64
+179230 LET v28 = v28 * 3 + 12
+179240 LET t = t + v28 / 7
+179250 IF t < 0 THEN 179260
+179260 LET v29 = 68
+179270 LET v29 = v29 * 3 + 3
+179280 LET t = t + v29 / 7
+179290 IF t < 0 THEN 179300
+179300 LET v30 = 72
+179310 LET v30 = v30 * 3 + 7
+179320 LET t = t + v30 / 7
+179330 IF t < 0 THEN 179340
+179340 LET v31 = 76
+179350 LET v31 = v31 * 3 + 11
+179360 LET t = t + v31 / 7
+179370 IF t < 0 THEN 179380
+179380 LET v32 = 80
+179390 LET v32 = v32 * 3 + 2
+179400 LET t = t + v32 / 7
+179410 IF t < 0 THEN 179420
+179420 LET v33 = 84
+179430 LET v33 = v33 * 3 + 6
+179440 LET t = t + v33 / 7
+179450 IF t < 0 THEN 179460
+179460 LET v34 = 88
+179470 LET v34 = v34 * 3 + 10
+179480 LET t = t + v34 / 7
+179490 IF t < 0 THEN 179500
+179500 LET v35 = 92
+179510 LET v35 = v35 * 3 + 1
+179520 LET t = t + v35 / 7
+179530 IF t < 0 THEN 179540
+179540 LET v36 = 96
+179550 LET v36 = v36 * 3 + 5
+179560 LET t = t + v36 / 7
+179570 IF t < 0 THEN 179580
+179580 LET v37 = 3
+179590 LET v37 = v37 * 3 + 9
+179600 LET t = t + v37 / 7
+179610 IF t < 0 THEN 179620
+179620 LET v38 = 7
+179630 LET v38 = v38 * 3 + 0
+179640 LET t = t + v38 / 7
+179650 IF t < 0 THEN 179660
+179660 LET v39 = 11
+179670 LET v39 = v39 * 3 + 4
+179680 LET t = t + v39 / 7
+179690 IF t < 0 THEN 179700
+179700 LET v40 = 15
+179710 LET v40 = v40 * 3 + 8
+179720 LET t = t + v40 / 7
+179730 IF t < 0 THEN 179740
+179740 LET v41 = 19
+179750 LET v41 = v41 * 3 + 12
+179760 LET t = t + v41 / 7
+179770 IF t < 0 THEN 179780
+179780 LET v42 = 23
+179790 LET v42 = v42 * 3 + 3
+179800 LET t = t + v42 / 7
+179810 IF t < 0 THEN 179820
+179820 LET v43 = 27
+179830 LET v43 = v43 * 3 + 7
+179840 LET t = t + v43 / 7
+179850 IF t < 0 THEN 179860
+179860 LET v44 = 31
+179870 LET v44 = v44 * 3 + 11
+179880 LET t = t + v44 / 7
+179890 IF t < 0 THEN 179900
+179900 LET v45 = 35
+179910 LET v45 = v45 * 3 + 2
+179920 LET t = t + v45 / 7
+179930 IF t < 0 THEN 179940
+179940 LET v46 = 39
+179950 LET v46 = v46 * 3 + 6
+179960 LET t = t + v46 / 7
+179970 IF t < 0 THEN 179980
+179980 LET v47 = 43
+179990 LET v47 = v47 * 3 + 10
+180000 LET t = t + v47 / 7
+180010 IF t < 0 THEN 180020
+180020 LET v48 = 47
+180030 LET v48 = v48 * 3 + 1
+180040 LET t = t + v48 / 7
+180050 IF t < 0 THEN 180060
+180060 LET v49 = 51
+180070 LET v49 = v49 * 3 + 5
+180080 LET t = t + v49 / 7
+180090 IF t < 0 THEN 180100
+180100 LET v0 = 55
+180110 LET v0 = v0 * 3 + 9
+180120 LET t = t + v0 / 7
+180130 IF t < 0 THEN 180140
+180140 LET v1 = 59
+180150 LET v1 = v1 * 3 + 0
+180160 LET t = t + v1 / 7
+180170 IF t < 0 THEN 180180
+180180 LET v2 = 63
+180190 LET v2 = v2 * 3 + 4
+180200 LET t = t + v2 / 7
+180210 IF t < 0 THEN 180220
+180220 LET v3 = 67
+180230 LET v3 = v3 * 3 + 8
+180240 LET t = t + v3 / 7
+180250 IF t < 0 THEN 180260
+180260 LET v4 = 71
+180270 LET v4 = v4 * 3 + 12
+180280 LET t = t + v4 / 7
+180290 IF t < 0 THEN 180300
+180300 LET v5 = 75
+180310 LET v5 = v5 * 3 + 3
+180320 LET t = t + v5 / 7
+180330 IF t < 0 THEN 180340
+180340 LET v6 = 79
+180350 LET v6 = v6 * 3 + 7
+180360 LET t = t + v6 / 7
+180370 IF t < 0 THEN 180380
+180380 LET v7 = 83
+180390 LET v7 = v7 * 3 + 11
+180400 LET t = t + v7 / 7
+180410 IF t < 0 THEN 180420
+180420 LET v8 = 87
+180430 LET v8 = v8 * 3 + 2
+180440 LET t = t + v8 / 7
+180450 IF t < 0 THEN 180460
+180460 LET v9 = 91
+180470 LET v9 = v9 * 3 + 6
+180480 LET t = t + v9 / 7
+180490 IF t < 0 THEN 180500
+180500 LET v10 = 95
+180510 LET v10 = v10 * 3 + 10
+180520 LET t = t + v10 / 7
+180530 IF t < 0 THEN 180540
+180540 LET v11 = 2
+180550 LET v11 = v11 * 3 + 1
+180560 LET t = t + v11 / 7
+180570 IF t < 0 THEN 180580
+180580 LET v12 = 6
+180590 LET v12 = v12 * 3 + 5
+180600 LET t = t + v12 / 7
+180610 IF t < 0 THEN 180620
+180620 LET v13 = 10
+180630 LET v13 = v13 * 3 + 9
+180640 LET t = t + v13 / 7
+180650 IF t < 0 THEN 180660
+180660 LET v14 = 14
+180670 LET v14 = v14 * 3 + 0
+180680 LET t = t + v14 / 7
+180690 IF t < 0 THEN 180700
+180700 LET v15 = 18
+180710 LET v15 = v15 * 3 + 4
+180720 LET t = t + v15 / 7
+180730 IF t < 0 THEN 180740
+180740 LET v16 = 22
+180750 LET v16 = v16 * 3 + 8
+180760 LET t = t + v16 / 7
+180770 IF t < 0 THEN 180780
+180780 LET v17 = 26
+180790 LET v17 = v17 * 3 + 12
+180800 LET t = t + v17 / 7
+180810 IF t < 0 THEN 180820
+180820 LET v18 = 30
+180830 LET v18 = v18 * 3 + 3
+180840 LET t = t + v18 / 7
+180850 IF t < 0 THEN 180860
+180860 LET v19 = 34
+180870 LET v19 = v19 * 3 + 7
+180880 LET t = t + v19 / 7
+180890 IF t < 0 THEN 180900
+180900 LET v20 = 38
+180910 LET v20 = v20 * 3 + 11
+180920 LET t = t + v20 / 7
+180930 IF t < 0 THEN 180940
+180940 LET v21 = 42
+180950 LET v21 = v21 * 3 + 2
+180960 LET t = t + v21 / 7
+180970 IF t < 0 THEN 180980
+180980 LET v22 = 46
+180990 LET v22 = v22 * 3 + 6
+181000 LET t = t + v22 / 7
+181010 IF t < 0 THEN 181020
+181020 LET v23 = 50
+181030 LET v23 = v23 * 3 + 10
+181040 LET t = t + v23 / 7
+181050 IF t < 0 THEN 181060
+181060 LET v24 = 54
+181070 LET v24 = v24 * 3 + 1
+181080 LET t = t + v24 / 7
+181090 IF t < 0 THEN 181100
+181100 LET v25 = 58
+181110 LET v25 = v25 * 3 + 5
+181120 LET t = t + v25 / 7
+181130 IF t < 0 THEN 181140
+181140 LET v26 = 62
+181150 LET v26 = v26 * 3 + 9
+181160 LET t = t + v26 / 7
+181170 IF t < 0 THEN 181180
+181180 LET v27 = 66
+181190 LET v27 = v27 * 3 + 0
+181200 LET t = t + v27 / 7
+181210 IF t < 0 THEN 181220
+181220 LET v28 = 70
+181230 LET v28 = v28 * 3 + 4
+181240 LET t = t + v28 / 7
+181250 IF t < 0 THEN 181260
+181260 LET v29 = 74
+181270 LET v29 = v29 * 3 + 8
+181280 LET t = t + v29 / 7
+181290 IF t < 0 THEN 181300
+181300 LET v30 = 78
+181310 LET v30 = v30 * 3 + 12
+181320 LET t = t + v30 / 7
+181330 IF t < 0 THEN 181340
+181340 LET v31 = 82
+181350 LET v31 = v31 * 3 + 3
+181360 LET t = t + v31 / 7
+181370 IF t < 0 THEN 181380
+181380 LET v32 = 86
+181390 LET v32 = v32 * 3 + 7
+181400 LET t = t + v32 / 7
+181410 IF t < 0 THEN 181420
+181420 LET v33 = 90
+181430 LET v33 = v33 * 3 + 11
+181440 LET t = t + v33 / 7
+181450 IF t < 0 THEN 181460
+181460 LET v34 = 94
+181470 LET v34 = v34 * 3 + 2
+181480 LET t = t + v34 / 7
+181490 IF t < 0 THEN 181500
+181500 LET v35 = 1
+181510 LET v35 = v35 * 3 + 6
+181520 LET t = t + v35 / 7
+181530 IF t < 0 THEN 181540
+181540 LET v36 = 5
+181550 LET v36 = v36 * 3 + 10
+181560 LET t = t + v36 / 7
+181570 IF t < 0 THEN 181580
+181580 LET v37 = 9
+181590 LET v37 = v37 * 3 + 1
+181600 LET t = t + v37 / 7
+181610 IF t < 0 THEN 181620
+181620 LET v38 = 13
+181630 LET v38 = v38 * 3 + 5
+181640 LET t = t + v38 / 7
+181650 IF t < 0 THEN 181660
+181660 LET v39 = 17
+181670 LET v39 = v39 * 3 + 9
+181680 LET t = t + v39 / 7
+181690 IF t < 0 THEN 181700
+181700 LET v40 = 21
+181710 LET v40 = v40 * 3 + 0
+181720 LET t = t + v40 / 7
+181730 IF t < 0 THEN 181740
+181740 LET v41 = 25
+181750 LET v41 = v41 * 3 + 4
+181760 LET t = t + v41 / 7
+181770 IF t < 0 THEN 181780
+181780 LET v42 = 29
+181790 LET v42 = v42 * 3 + 8
+181800 LET t = t + v42 / 7
+181810 IF t < 0 THEN 181820
+181820 LET v43 = 33
+181830 LET v43 = v43 * 3 + 12
+181840 LET t = t + v43 / 7
+181850 IF t < 0 THEN 181860
+181860 LET v44 = 37
+181870 LET v44 = v44 * 3 + 3
+181880 LET t = t + v44 / 7
+181890 IF t < 0 THEN 181900
+181900 LET v45 = 41
+181910 LET v45 = v45 * 3 + 7
+181920 LET t = t + v45 / 7
+181930 IF t < 0 THEN 181940
+181940 LET v46 = 45
+181950 LET v46 = v46 * 3 + 11
+181960 LET t = t + v46 / 7
+181970 IF t < 0 THEN 181980
+181980 LET v47 = 49
+181990 LET v47 = v47 * 3 + 2
+182000 LET t = t + v47 / 7
+182010 IF t < 0 THEN 182020
+182020 LET v48 = 53
+182030 LET v48 = v48 * 3 + 6
+182040 LET t = t + v48 / 7
+182050 IF t < 0 THEN 182060
+182060 LET v49 = 57
+182070 LET v49 = v49 * 3 + 10
+182080 LET t = t + v49 / 7
+182090 IF t < 0 THEN 182100
+182100 LET v0 = 61
+182110 LET v0 = v0 * 3 + 1
+182120 LET t = t + v0 / 7
+182130 IF t < 0 THEN 182140
+182140 LET v1 = 65
+182150 LET v1 = v1 * 3 + 5
+182160 LET t = t + v1 / 7
+182170 IF t < 0 THEN 182180
+182180 LET v2 = 69
+182190 LET v2 = v2 * 3 + 9
+182200 LET t = t + v2 / 7
+182210 IF t < 0 THEN 182220
+182220 LET v3 = 73
+182230 LET v3 = v3 * 3 + 0
+182240 LET t = t + v3 / 7
+182250 IF t < 0 THEN 182260
+182260 LET v4 = 77
+182270 LET v4 = v4 * 3 + 4
+182280 LET t = t + v4 / 7
+182290 IF t < 0 THEN 182300
+182300 LET v5 = 81
+182310 LET v5 = v5 * 3 + 8
+182320 LET t = t + v5 / 7
+182330 IF t < 0 THEN 182340
+182340 LET v6 = 85
+182350 LET v6 = v6 * 3 + 12
+182360 LET t = t + v6 / 7
+182370 IF t < 0 THEN 182380
+182380 LET v7 = 89
+182390 LET v7 = v7 * 3 + 3
+182400 LET t = t + v7 / 7
+182410 IF t < 0 THEN 182420
+182420 LET v8 = 93
+182430 LET v8 = v8 * 3 + 7
+182440 LET t = t + v8 / 7
+182450 IF t < 0 THEN 182460
+182460 LET v9 = 0
+182470 LET v9 = v9 * 3 + 11
+182480 LET t = t + v9 / 7
+182490 IF t < 0 THEN 182500
+182500 LET v10 = 4
+182510 LET v10 = v10 * 3 + 2
+182520 LET t = t + v10 / 7
+182530 IF t < 0 THEN 182540
+182540 LET v11 = 8
+182550 LET v11 = v11 * 3 + 6
+182560 LET t = t + v11 / 7
+182570 IF t < 0 THEN 182580
+182580 LET v12 = 12
+182590 LET v12 = v12 * 3 + 10
+182600 LET t = t + v12 / 7
+182610 IF t < 0 THEN 182620
+182620 LET v13 = 16
+182630 LET v13 = v13 * 3 + 1
+182640 LET t = t + v13 / 7
+182650 IF t < 0 THEN 182660
+182660 LET v14 = 20
+182670 LET v14 = v14 * 3 + 5
+182680 LET t = t + v14 / 7
+182690 IF t < 0 THEN 182700
+182700 LET v15 = 24
+182710 LET v15 = v15 * 3 + 9
+182720 LET t = t + v15 / 7
+182730 IF t < 0 THEN 182740
+182740 LET v16 = 28
+182750 LET v16 = v16 * 3 + 0
+182760 LET t = t + v16 / 7
+182770 IF t < 0 THEN 182780
+182780 LET v17 = 32
+182790 LET v17 = v17 * 3 + 4
+182800 LET t = t + v17 / 7
+182810 IF t < 0 THEN 182820
+182820 LET v18 = 36
+182830 LET v18 = v18 * 3 + 8
+182840 LET t = t + v18 / 7
+182850 IF t < 0 THEN 182860
+182860 LET v19 = 40
+182870 LET v19 = v19 * 3 + 12
+182880 LET t = t + v19 / 7
+182890 IF t < 0 THEN 182900
+182900 LET v20 = 44
+182910 LET v20 = v20 * 3 + 3
+182920 LET t = t + v20 / 7
+182930 IF t < 0 THEN 182940
+182940 LET v21 = 48
+182950 LET v21 = v21 * 3 + 7
+182960 LET t = t + v21 / 7
+182970 IF t < 0 THEN 182980
+182980 LET v22 = 52
+182990 LET v22 = v22 * 3 + 11
+183000 LET t = t + v22 / 7
+183010 IF t < 0 THEN 183020
+183020 LET v23 = 56
+183030 LET v23 = v23 * 3 + 2
+183040 LET t = t + v23 / 7
+183050 IF t < 0 THEN 183060
+183060 LET v24 = 60
+183070 LET v24 = v24 * 3 + 6
+183080 LET t = t + v24 / 7
+183090 IF t < 0 THEN 183100
+183100 LET v25 = 64
+183110 LET v25 = v25 * 3 + 10
+183120 LET t = t + v25 / 7
+183130 IF t < 0 THEN 183140
+183140 LET v26 = 68
+183150 LET v26 = v26 * 3 + 1
+183160 LET t = t + v26 / 7
+183170 IF t < 0 THEN 183180
+183180 LET v27 = 72
+183190 LET v27 = v27 * 3 + 5
+183200 LET t = t + v27 / 7
+183210 IF t < 0 THEN 183220
+183220 LET v28 = 76
+183230 LET v28 = v28 * 3 + 9
+183240 LET t = t + v28 / 7
+183250 IF t < 0 THEN 183260
+183260 LET v29 = 80
+183270 LET v29 = v29 * 3 + 0
+183280 LET t = t + v29 / 7
+183290 IF t < 0 THEN 183300
+183300 LET v30 = 84
+183310 LET v30 = v30 * 3 + 4
+183320 LET t = t + v30 / 7
+183330 IF t < 0 THEN 183340
+183340 LET v31 = 88
+183350 LET v31 = v31 * 3 + 8
+183360 LET t = t + v31 / 7
+183370 IF t < 0 THEN 183380
+183380 LET v32 = 92
+183390 LET v32 = v32 * 3 + 12
+183400 LET t = t + v32 / 7
+183410 IF t < 0 THEN 183420
+183420 LET v33 = 96
+183430 LET v33 = v33 * 3 + 3
+183440 LET t = t + v33 / 7
+183450 IF t < 0 THEN 183460
+183460 LET v34 = 3
+183470 LET v34 = v34 * 3 + 7
+183480 LET t = t + v34 / 7
+183490 IF t < 0 THEN 183500
+183500 LET v35 = 7
+183510 LET v35 = v35 * 3 + 11
+183520 LET t = t + v35 / 7
+183530 IF t < 0 THEN 183540
+183540 LET v36 = 11
+183550 LET v36 = v36 * 3 + 2
+183560 LET t = t + v36 / 7
+183570 IF t < 0 THEN 183580
+183580 LET v37 = 15
+183590 LET v37 = v37 * 3 + 6
+183600 LET t = t + v37 / 7
+183610 IF t < 0 THEN 183620
+183620 LET v38 = 19
+183630 LET v38 = v38 * 3 + 10
+183640 LET t = t + v38 / 7
+183650 IF t < 0 THEN 183660
+183660 LET v39 = 23
+183670 LET v39 = v39 * 3 + 1
+183680 LET t = t + v39 / 7
+183690 IF t < 0 THEN 183700
+183700 LET v40 = 27
+183710 LET v40 = v40 * 3 + 5
+183720 LET t = t + v40 / 7
+183730 IF t < 0 THEN 183740
+183740 LET v41 = 31
+183750 LET v41 = v41 * 3 + 9
+183760 LET t = t + v41 / 7
+183770 IF t < 0 THEN 183780
+183780 LET v42 = 35
+183790 LET v42 = v42 * 3 + 0
+183800 LET t = t + v42 / 7
+183810 IF t < 0 THEN 183820
+183820 LET v43 = 39
+183830 LET v43 = v43 * 3 + 4
+183840 LET t = t + v43 / 7
+183850 IF t < 0 THEN 183860
+183860 LET v44 = 43
+183870 LET v44 = v44 * 3 + 8
+183880 LET t = t + v44 / 7
+183890 IF t < 0 THEN 183900
+183900 LET v45 = 47
+183910 LET v45 = v45 * 3 + 12
+183920 LET t = t + v45 / 7
+183930 IF t < 0 THEN 183940
+183940 LET v46 = 51
+183950 LET v46 = v46 * 3 + 3
+183960 LET t = t + v46 / 7
+183970 IF t < 0 THEN 183980
+183980 LET v47 = 55
+183990 LET v47 = v47 * 3 + 7
+184000 LET t = t + v47 / 7
+184010 IF t < 0 THEN 184020
+184020 LET v48 = 59
+184030 LET v48 = v48 * 3 + 11
+184040 LET t = t + v48 / 7
+184050 IF t < 0 THEN 184060
+184060 LET v49 = 63
+184070 LET v49 = v49 * 3 + 2
+184080 LET t = t + v49 / 7
+184090 IF t < 0 THEN 184100
+184100 LET v0 = 67
+184110 LET v0 = v0 * 3 + 6
+184120 LET t = t + v0 / 7
+184130 IF t < 0 THEN 184140
+184140 LET v1 = 71
+184150 LET v1 = v1 * 3 + 10
+184160 LET t = t + v1 / 7
+184170 IF t < 0 THEN 184180
+184180 LET v2 = 75
+184190 LET v2 = v2 * 3 + 1
+184200 LET t = t + v2 / 7
+184210 IF t < 0 THEN 184220
+184220 LET v3 = 79
+184230 LET v3 = v3 * 3 + 5
+184240 LET t = t + v3 / 7
+184250 IF t < 0 THEN 184260
+184260 LET v4 = 83
+184270 LET v4 = v4 * 3 + 9
+184280 LET t = t + v4 / 7
+184290 IF t < 0 THEN 184300
+184300 LET v5 = 87
+184310 LET v5 = v5 * 3 + 0
+184320 LET t = t + v5 / 7
+184330 IF t < 0 THEN 184340
+184340 LET v6 = 91
+184350 LET v6 = v6 * 3 + 4
+184360 LET t = t + v6 / 7
+184370 IF t < 0 THEN 184380
+184380 LET v7 = 95
+184390 LET v7 = v7 * 3 + 8
+184400 LET t = t + v7 / 7
+184410 IF t < 0 THEN 184420
+184420 LET v8 = 2
+184430 LET v8 = v8 * 3 + 12
+184440 LET t = t + v8 / 7
+184450 IF t < 0 THEN 184460
+184460 LET v9 = 6
+184470 LET v9 = v9 * 3 + 3
+184480 LET t = t + v9 / 7
+184490 IF t < 0 THEN 184500
+184500 LET v10 = 10
+184510 LET v10 = v10 * 3 + 7
+184520 LET t = t + v10 / 7
+184530 IF t < 0 THEN 184540
+184540 LET v11 = 14
+184550 LET v11 = v11 * 3 + 11
+184560 LET t = t + v11 / 7
+184570 IF t < 0 THEN 184580
+184580 LET v12 = 18
+184590 LET v12 = v12 * 3 + 2
+184600 LET t = t + v12 / 7
+184610 IF t < 0 THEN 184620
+184620 LET v13 = 22
+184630 LET v13 = v13 * 3 + 6
+184640 LET t = t + v13 / 7
+184650 IF t < 0 THEN 184660
+184660 LET v14 = 26
+184670 LET v14 = v14 * 3 + 10
+184680 LET t = t + v14 / 7
+184690 IF t < 0 THEN 184700
+184700 LET v15 = 30
+184710 LET v15 = v15 * 3 + 1
+184720 LET t = t + v15 / 7
+184730 IF t < 0 THEN 184740
+184740 LET v16 = 34
+184750 LET v16 = v16 * 3 + 5
+184760 LET t = t + v16 / 7
+184770 IF t < 0 THEN 184780
+184780 LET v17 = 38
+184790 LET v17 = v17 * 3 + 9
+184800 LET t = t + v17 / 7
+184810 IF t < 0 THEN 184820
+184820 LET v18 = 42
+184830 LET v18 = v18 * 3 + 0
+184840 LET t = t + v18 / 7
+184850 IF t < 0 THEN 184860
+184860 LET v19 = 46
+184870 LET v19 = v19 * 3 + 4
+184880 LET t = t + v19 / 7
+184890 IF t < 0 THEN 184900
+184900 LET v20 = 50
+184910 LET v20 = v20 * 3 + 8
+184920 LET t = t + v20 / 7
+184930 IF t < 0 THEN 184940
+184940 LET v21 = 54
+184950 LET v21 = v21 * 3 + 12
+184960 LET t = t + v21 / 7
+184970 IF t < 0 THEN 184980
+184980 LET v22 = 58
+184990 LET v22 = v22 * 3 + 3
+185000 LET t = t + v22 / 7
+185010 IF t < 0 THEN 185020
+185020 LET v23 = 62
+185030 LET v23 = v23 * 3 + 7
+185040 LET t = t + v23 / 7
+185050 IF t < 0 THEN 185060
+185060 LET v24 = 66
+185070 LET v24 = v24 * 3 + 11
+185080 LET t = t + v24 / 7
+185090 IF t < 0 THEN 185100
+185100 LET v25 = 70
+185110 LET v25 = v25 * 3 + 2
+185120 LET t = t + v25 / 7
+185130 IF t < 0 THEN 185140
+185140 LET v26 = 74
+185150 LET v26 = v26 * 3 + 6
+185160 LET t = t + v26 / 7
+185170 IF t < 0 THEN 185180
+185180 LET v27 = 78
+185190 LET v27 = v27 * 3 + 10
+185200 LET t = t + v27 / 7
+185210 IF t < 0 THEN 185220
+185220 LET v28 = 82
+185230 LET v28 = v28 * 3 + 1
+185240 LET t = t + v28 / 7
+185250 IF t < 0 THEN 185260
+185260 LET v29 = 86
+185270 LET v29 = v29 * 3 + 5
+185280 LET t = t + v29 / 7
+185290 IF t < 0 THEN 185300
+185300 LET v30 = 90
+185310 LET v30 = v30 * 3 + 9
+185320 LET t = t + v30 / 7
+185330 IF t < 0 THEN 185340
+185340 LET v31 = 94
+185350 LET v31 = v31 * 3 + 0
+185360 LET t = t + v31 / 7
+185370 IF t < 0 THEN 185380
+185380 LET v32 = 1
+185390 LET v32 = v32 * 3 + 4
+185400 LET t = t + v32 / 7
+185410 IF t < 0 THEN 185420
+185420 LET v33 = 5
+185430 LET v33 = v33 * 3 + 8
+185440 LET t = t + v33 / 7
+185450 IF t < 0 THEN 185460
+185460 LET v34 = 9
+185470 LET v34 = v34 * 3 + 12
+185480 LET t = t + v34 / 7
+185490 IF t < 0 THEN 185500
+185500 LET v35 = 13
+185510 LET v35 = v35 * 3 + 3
+185520 LET t = t + v35 / 7
+185530 IF t < 0 THEN 185540
+185540 LET v36 = 17
+185550 LET v36 = v36 * 3 + 7
+185560 LET t = t + v36 / 7
+185570 IF t < 0 THEN 185580
+185580 LET v37 = 21
+185590 LET v37 = v37 * 3 + 11
+185600 LET t = t + v37 / 7
+185610 IF t < 0 THEN 185620
+185620 LET v38 = 25
+185630 LET v38 = v38 * 3 + 2
+185640 LET t = t + v38 / 7
+185650 IF t < 0 THEN 185660
+185660 LET v39 = 29
+185670 LET v39 = v39 * 3 + 6
+185680 LET t = t + v39 / 7
+185690 IF t < 0 THEN 185700
+185700 LET v40 = 33
+185710 LET v40 = v40 * 3 + 10
+185720 LET t = t + v40 / 7
+185730 IF t < 0 THEN 185740
+185740 LET v41 = 37
+185750 LET v41 = v41 * 3 + 1
+185760 LET t = t + v41 / 7
+185770 IF t < 0 THEN 185780
+185780 LET v42 = 41
+185790 LET v42 = v42 * 3 + 5
+185800 LET t = t + v42 / 7
+185810 IF t < 0 THEN 185820
+185820 LET v43 = 45
+185830 LET v43 = v43 * 3 + 9
+185840 LET t = t + v43 / 7
+185850 IF t < 0 THEN 185860
+185860 LET v44 = 49
+185870 LET v44 = v44 * 3 + 0
+185880 LET t = t + v44 / 7
+185890 IF t < 0 THEN 185900
+185900 LET v45 = 53
+185910 LET v45 = v45 * 3 + 4
+185920 LET t = t + v45 / 7
+185930 IF t < 0 THEN 185940
+185940 LET v46 = 57
+185950 LET v46 = v46 * 3 + 8
+185960 LET t = t + v46 / 7
+185970 IF t < 0 THEN 185980
+185980 LET v47 = 61
+185990 LET v47 = v47 * 3 + 12
+186000 LET t = t + v47 / 7
+186010 IF t < 0 THEN 186020
+186020 LET v48 = 65
+186030 LET v48 = v48 * 3 + 3
+186040 LET t = t + v48 / 7
+186050 IF t < 0 THEN 186060
+186060 LET v49 = 69
+186070 LET v49 = v49 * 3 + 7
+186080 LET t = t + v49 / 7
+186090 IF t < 0 THEN 186100
+186100 LET v0 = 73
+186110 LET v0 = v0 * 3 + 11
+186120 LET t = t + v0 / 7
+186130 IF t < 0 THEN 186140
+186140 LET v1 = 77
+186150 LET v1 = v1 * 3 + 2
+186160 LET t = t + v1 / 7
+186170 IF t < 0 THEN 186180
+186180 LET v2 = 81
+186190 LET v2 = v2 * 3 + 6
+186200 LET t = t + v2 / 7
+186210 IF t < 0 THEN 186220
+186220 LET v3 = 85
+186230 LET v3 = v3 * 3 + 10
+186240 LET t = t + v3 / 7
+186250 IF t < 0 THEN 186260
+186260 LET v4 = 89
+186270 LET v4 = v4 * 3 + 1
+186280 LET t = t + v4 / 7
+186290 IF t < 0 THEN 186300
+186300 LET v5 = 93
+186310 LET v5 = v5 * 3 + 5
+186320 LET t = t + v5 / 7
+186330 IF t < 0 THEN 186340
+186340 LET v6 = 0
+186350 LET v6 = v6 * 3 + 9
+186360 LET t = t + v6 / 7
+186370 IF t < 0 THEN 186380
+186380 LET v7 = 4
+186390 LET v7 = v7 * 3 + 0
+186400 LET t = t + v7 / 7
+186410 IF t < 0 THEN 186420
+186420 LET v8 = 8
+186430 LET v8 = v8 * 3 + 4
+186440 LET t = t + v8 / 7
+186450 IF t < 0 THEN 186460
+186460 LET v9 = 12
+186470 LET v9 = v9 * 3 + 8
+186480 LET t = t + v9 / 7
+186490 IF t < 0 THEN 186500
+186500 LET v10 = 16
+186510 LET v10 = v10 * 3 + 12
+186520 LET t = t + v10 / 7
+186530 IF t < 0 THEN 186540
+186540 LET v11 = 20
+186550 LET v11 = v11 * 3 + 3
+186560 LET t = t + v11 / 7
+186570 IF t < 0 THEN 186580
+186580 LET v12 = 24
+186590 LET v12 = v12 * 3 + 7
+186600 LET t = t + v12 / 7
+186610 IF t < 0 THEN 186620
+186620 LET v13 = 28
+186630 LET v13 = v13 * 3 + 11
+186640 LET t = t + v13 / 7
+186650 IF t < 0 THEN 186660
+186660 LET v14 = 32
+186670 LET v14 = v14 * 3 + 2
+186680 LET t = t + v14 / 7
+186690 IF t < 0 THEN 186700
+186700 LET v15 = 36
+186710 LET v15 = v15 * 3 + 6
+186720 LET t = t + v15 / 7
+186730 IF t < 0 THEN 186740
+186740 LET v16 = 40
+186750 LET v16 = v16 * 3 + 10
+186760 LET t = t + v16 / 7
+186770 IF t < 0 THEN 186780
+186780 LET v17 = 44
+186790 LET v17 = v17 * 3 + 1
+186800 LET t = t + v17 / 7
+186810 IF t < 0 THEN 186820
+186820 LET v18 = 48
+186830 LET v18 = v18 * 3 + 5
+186840 LET t = t + v18 / 7
+186850 IF t < 0 THEN 186860
+186860 LET v19 = 52
+186870 LET v19 = v19 * 3 + 9
+186880 LET t = t + v19 / 7
+186890 IF t < 0 THEN 186900
+186900 LET v20 = 56
+186910 LET v20 = v20 * 3 + 0
+186920 LET t = t + v20 / 7
+186930 IF t < 0 THEN 186940
+186940 LET v21 = 60
+186950 LET v21 = v21 * 3 + 4
+186960 LET t = t + v21 / 7
+186970 IF t < 0 THEN 186980
+186980 LET v22 = 64
+186990 LET v22 = v22 * 3 + 8
+187000 LET t = t + v22 / 7
+187010 IF t < 0 THEN 187020
+187020 LET v23 = 68
+187030 LET v23 = v23 * 3 + 12
+187040 LET t = t + v23 / 7
+187050 IF t < 0 THEN 187060
+187060 LET v24 = 72
+187070 LET v24 = v24 * 3 + 3
+187080 LET t = t + v24 / 7
+187090 IF t < 0 THEN 187100
+187100 LET v25 = 76
+187110 LET v25 = v25 * 3 + 7
+187120 LET t = t + v25 / 7
+187130 IF t < 0 THEN 187140
+187140 LET v26 = 80
+187150 LET v26 = v26 * 3 + 11
+187160 LET t = t + v26 / 7
+187170 IF t < 0 THEN 187180
+187180 LET v27 = 84
+187190 LET v27 = v27 * 3 + 2
+187200 LET t = t + v27 / 7
+187210 IF t < 0 THEN 187220
+187220 LET v28 = 88
+187230 LET v28 = v28 * 3 + 6
+187240 LET t = t + v28 / 7
+187250 IF t < 0 THEN 187260
+187260 LET v29 = 92
+187270 LET v29 = v29 * 3 + 10
+187280 LET t = t + v29 / 7
+187290 IF t < 0 THEN 187300
+187300 LET v30 = 96
+187310 LET v30 = v30 * 3 + 1
+187320 LET t = t + v30 / 7
+187330 IF t < 0 THEN 187340
+187340 LET v31 = 3
+187350 LET v31 = v31 * 3 + 5
+187360 LET t = t + v31 / 7
+187370 IF t < 0 THEN 187380
+187380 LET v32 = 7
+187390 LET v32 = v32 * 3 + 9
+187400 LET t = t + v32 / 7
+187410 IF t < 0 THEN 187420
+187420 LET v33 = 11
+187430 LET v33 = v33 * 3 + 0
+187440 LET t = t + v33 / 7
+187450 IF t < 0 THEN 187460
+187460 LET v34 = 15
+187470 LET v34 = v34 * 3 + 4
+187480 LET t = t + v34 / 7
+187490 IF t < 0 THEN 187500
+187500 LET v35 = 19
+187510 LET v35 = v35 * 3 + 8
+187520 LET t = t + v35 / 7
+187530 IF t < 0 THEN 187540
+187540 LET v36 = 23
+187550 LET v36 = v36 * 3 + 12
+187560 LET t = t + v36 / 7
+187570 IF t < 0 THEN 187580
+187580 LET v37 = 27
+187590 LET v37 = v37 * 3 + 3
+187600 LET t = t + v37 / 7
+187610 IF t < 0 THEN 187620
+187620 LET v38 = 31
+187630 LET v38 = v38 * 3 + 7
+187640 LET t = t + v38 / 7
+187650 IF t < 0 THEN 187660
+187660 LET v39 = 35
+187670 LET v39 = v39 * 3 + 11
+187680 LET t = t + v39 / 7
+187690 IF t < 0 THEN 187700
+187700 LET v40 = 39
+187710 LET v40 = v40 * 3 + 2
+187720 LET t = t + v40 / 7
+187730 IF t < 0 THEN 187740
+187740 LET v41 = 43
+187750 LET v41 = v41 * 3 + 6
+187760 LET t = t + v41 / 7
+187770 IF t < 0 THEN 187780
+187780 LET v42 = 47
+187790 LET v42 = v42 * 3 + 10
+187800 LET t = t + v42 / 7
+187810 IF t < 0 THEN 187820
+187820 LET v43 = 51
+187830 LET v43 = v43 * 3 + 1
+187840 LET t = t + v43 / 7
+187850 IF t < 0 THEN 187860
+187860 LET v44 = 55
+187870 LET v44 = v44 * 3 + 5
+187880 LET t = t + v44 / 7
+187890 IF t < 0 THEN 187900
+187900 LET v45 = 59
+187910 LET v45 = v45 * 3 + 9
+187920 LET t = t + v45 / 7
+187930 IF t < 0 THEN 187940
+187940 LET v46 = 63
+187950 LET v46 = v46 * 3 + 0
+187960 LET t = t + v46 / 7
+187970 IF t < 0 THEN 187980
+187980 LET v47 = 67
+187990 LET v47 = v47 * 3 + 4
+188000 LET t = t + v47 / 7
+188010 IF t < 0 THEN 188020
+188020 LET v48 = 71
+188030 LET v48 = v48 * 3 + 8
+188040 LET t = t + v48 / 7
+188050 IF t < 0 THEN 188060
+188060 LET v49 = 75
+188070 LET v49 = v49 * 3 + 12
+188080 LET t = t + v49 / 7
+188090 IF t < 0 THEN 188100
+188100 LET v0 = 79
+188110 LET v0 = v0 * 3 + 3
+188120 LET t = t + v0 / 7
+188130 IF t < 0 THEN 188140
+188140 LET v1 = 83
+188150 LET v1 = v1 * 3 + 7
+188160 LET t = t + v1 / 7
+188170 IF t < 0 THEN 188180
+188180 LET v2 = 87
+188190 LET v2 = v2 * 3 + 11
+188200 LET t = t + v2 / 7
+188210 IF t < 0 THEN 188220
+188220 LET v3 = 91
+188230 LET v3 = v3 * 3 + 2
+188240 LET t = t + v3 / 7
+188250 IF t < 0 THEN 188260
+188260 LET v4 = 95
+188270 LET v4 = v4 * 3 + 6
+188280 LET t = t + v4 / 7
+188290 IF t < 0 THEN 188300
+188300 LET v5 = 2
+188310 LET v5 = v5 * 3 + 10
+188320 LET t = t + v5 / 7
+188330 IF t < 0 THEN 188340
+188340 LET v6 = 6
+188350 LET v6 = v6 * 3 + 1
+188360 LET t = t + v6 / 7
+188370 IF t < 0 THEN 188380
+188380 LET v7 = 10
+188390 LET v7 = v7 * 3 + 5
+188400 LET t = t + v7 / 7
+188410 IF t < 0 THEN 188420
+188420 LET v8 = 14
+188430 LET v8 = v8 * 3 + 9
+188440 LET t = t + v8 / 7
+188450 IF t < 0 THEN 188460
+188460 LET v9 = 18
+188470 LET v9 = v9 * 3 + 0
+188480 LET t = t + v9 / 7
+188490 IF t < 0 THEN 188500
+188500 LET v10 = 22
+188510 LET v10 = v10 * 3 + 4
+188520 LET t = t + v10 / 7
+188530 IF t < 0 THEN 188540
+188540 LET v11 = 26
+188550 LET v11 = v11 * 3 + 8
+188560 LET t = t + v11 / 7
+188570 IF t < 0 THEN 188580
+188580 LET v12 = 30
+188590 LET v12 = v12 * 3 + 12
+188600 LET t = t + v12 / 7
+188610 IF t < 0 THEN 188620
+188620 LET v13 = 34
+188630 LET v13 = v13 * 3 + 3
+188640 LET t = t + v13 / 7
+188650 IF t < 0 THEN 188660
+188660 LET v14 = 38
+188670 LET v14 = v14 * 3 + 7
+188680 LET t = t + v14 / 7
+188690 IF t < 0 THEN 188700
+188700 LET v15 = 42
+188710 LET v15 = v15 * 3 + 11
+188720 LET t = t + v15 / 7
+188730 IF t < 0 THEN 188740
+188740 LET v16 = 46
+188750 LET v16 = v16 * 3 + 2
+188760 LET t = t + v16 / 7
+188770 IF t < 0 THEN 188780
+188780 LET v17 = 50
+188790 LET v17 = v17 * 3 + 6
+188800 LET t = t + v17 / 7
+188810 IF t < 0 THEN 188820
+188820 LET v18 = 54
+188830 LET v18 = v18 * 3 + 10
+188840 LET t = t + v18 / 7
+188850 IF t < 0 THEN 188860
+188860 LET v19 = 58
+188870 LET v19 = v19 * 3 + 1
+188880 LET t = t + v19 / 7
+188890 IF t < 0 THEN 188900
+188900 LET v20 = 62
+188910 LET v20 = v20 * 3 + 5
+188920 LET t = t + v20 / 7
+188930 IF t < 0 THEN 188940
+188940 LET v21 = 66
+188950 LET v21 = v21 * 3 + 9
+188960 LET t = t + v21 / 7
+188970 IF t < 0 THEN 188980
+188980 LET v22 = 70
+188990 LET v22 = v22 * 3 + 0
+189000 LET t = t + v22 / 7
+189010 IF t < 0 THEN 189020
+189020 LET v23 = 74
+189030 LET v23 = v23 * 3 + 4
+189040 LET t = t + v23 / 7
+189050 IF t < 0 THEN 189060
+189060 LET v24 = 78
+189070 LET v24 = v24 * 3 + 8
+189080 LET t = t + v24 / 7
+189090 IF t < 0 THEN 189100
+189100 LET v25 = 82
+189110 LET v25 = v25 * 3 + 12
+189120 LET t = t + v25 / 7
+189130 IF t < 0 THEN 189140
+189140 LET v26 = 86
+189150 LET v26 = v26 * 3 + 3
+189160 LET t = t + v26 / 7
+189170 IF t < 0 THEN 189180
+189180 LET v27 = 90
+189190 LET v27 = v27 * 3 + 7
+189200 LET t = t + v27 / 7
+189210 IF t < 0 THEN 189220
+189220 LET v28 = 94
+189230 LET v28 = v28 * 3 + 11
+189240 LET t = t + v28 / 7
+189250 IF t < 0 THEN 189260
+189260 LET v29 = 1
+189270 LET v29 = v29 * 3 + 2
+189280 LET t = t + v29 / 7
+189290 IF t < 0 THEN 189300
+189300 LET v30 = 5
+189310 LET v30 = v30 * 3 + 6
+189320 LET t = t + v30 / 7
+189330 IF t < 0 THEN 189340
+189340 LET v31 = 9
+189350 LET v31 = v31 * 3 + 10
+189360 LET t = t + v31 / 7
+189370 IF t < 0 THEN 189380
+189380 LET v32 = 13
+189390 LET v32 = v32 * 3 + 1
+189400 LET t = t + v32 / 7
+189410 IF t < 0 THEN 189420
+189420 LET v33 = 17
+189430 LET v33 = v33 * 3 + 5
+189440 LET t = t + v33 / 7
+189450 IF t < 0 THEN 189460
+189460 LET v34 = 21
+189470 LET v34 = v34 * 3 + 9
+189480 LET t = t + v34 / 7
+189490 IF t < 0 THEN 189500
+189500 LET v35 = 25
+189510 LET v35 = v35 * 3 + 0
+189520 LET t = t + v35 / 7
+189530 IF t < 0 THEN 189540
+189540 LET v36 = 29
+189550 LET v36 = v36 * 3 + 4
+189560 LET t = t + v36 / 7
+189570 IF t < 0 THEN 189580
+189580 LET v37 = 33
+189590 LET v37 = v37 * 3 + 8
+189600 LET t = t + v37 / 7
+189610 IF t < 0 THEN 189620
+189620 LET v38 = 37
+189630 LET v38 = v38 * 3 + 12
+189640 LET t = t + v38 / 7
+189650 IF t < 0 THEN 189660
+189660 LET v39 = 41
+189670 LET v39 = v39 * 3 + 3
+189680 LET t = t + v39 / 7
+189690 IF t < 0 THEN 189700
+189700 LET v40 = 45
+189710 LET v40 = v40 * 3 + 7
+189720 LET t = t + v40 / 7
+189730 IF t < 0 THEN 189740
+189740 LET v41 = 49
+189750 LET v41 = v41 * 3 + 11
+189760 LET t = t + v41 / 7
+189770 IF t < 0 THEN 189780
+189780 LET v42 = 53
+189790 LET v42 = v42 * 3 + 2
+189800 LET t = t + v42 / 7
+189810 IF t < 0 THEN 189820
+189820 LET v43 = 57
+189830 LET v43 = v43 * 3 + 6
+189840 LET t = t + v43 / 7
+189850 IF t < 0 THEN 189860
+189860 LET v44 = 61
+189870 LET v44 = v44 * 3 + 10
+189880 LET t = t + v44 / 7
+189890 IF t < 0 THEN 189900
+189900 LET v45 = 65
+189910 LET v45 = v45 * 3 + 1
+189920 LET t = t + v45 / 7
+189930 IF t < 0 THEN 189940
+189940 LET v46 = 69
+189950 LET v46 = v46 * 3 + 5
+189960 LET t = t + v46 / 7
+189970 IF t < 0 THEN 189980
+189980 LET v47 = 73
+189990 LET v47 = v47 * 3 + 9
+190000 LET t = t + v47 / 7
+190010 IF t < 0 THEN 190020
+190020 LET v48 = 77
+190030 LET v48 = v48 * 3 + 0
+190040 LET t = t + v48 / 7
+190050 IF t < 0 THEN 190060
+190060 LET v49 = 81
+190070 LET v49 = v49 * 3 + 4
+190080 LET t = t + v49 / 7
+190090 IF t < 0 THEN 190100
+190100 LET v0 = 85
+190110 LET v0 = v0 * 3 + 8
+190120 LET t = t + v0 / 7
+190130 IF t < 0 THEN 190140
+190140 LET v1 = 89
+190150 LET v1 = v1 * 3 + 12
+190160 LET t = t + v1 / 7
+190170 IF t < 0 THEN 190180
+190180 LET v2 = 93
+190190 LET v2 = v2 * 3 + 3
+190200 LET t = t + v2 / 7
+190210 IF t < 0 THEN 190220
+190220 LET v3 = 0
+190230 LET v3 = v3 * 3 + 7
+190240 LET t = t + v3 / 7
+190250 IF t < 0 THEN 190260
+190260 LET v4 = 4
+190270 LET v4 = v4 * 3 + 11
+190280 LET t = t + v4 / 7
+190290 IF t < 0 THEN 190300
+190300 LET v5 = 8
+190310 LET v5 = v5 * 3 + 2
+190320 LET t = t + v5 / 7
+190330 IF t < 0 THEN 190340
+190340 LET v6 = 12
+190350 LET v6 = v6 * 3 + 6
+190360 LET t = t + v6 / 7
+190370 IF t < 0 THEN 190380
+190380 LET v7 = 16
+190390 LET v7 = v7 * 3 + 10
+190400 LET t = t + v7 / 7
+190410 IF t < 0 THEN 190420
+190420 LET v8 = 20
+190430 LET v8 = v8 * 3 + 1
+190440 LET t = t + v8 / 7
+190450 IF t < 0 THEN 190460
+190460 LET v9 = 24
+190470 LET v9 = v9 * 3 + 5
+190480 LET t = t + v9 / 7
+190490 IF t < 0 THEN 190500
+190500 LET v10 = 28
+190510 LET v10 = v10 * 3 + 9
+190520 LET t = t + v10 / 7
+190530 IF t < 0 THEN 190540
+190540 LET v11 = 32
+190550 LET v11 = v11 * 3 + 0
+190560 LET t = t + v11 / 7
+190570 IF t < 0 THEN 190580
+190580 LET v12 = 36
+190590 LET v12 = v12 * 3 + 4
+190600 LET t = t + v12 / 7
+190610 IF t < 0 THEN 190620
+190620 LET v13 = 40
+190630 LET v13 = v13 * 3 + 8
+190640 LET t = t + v13 / 7
+190650 IF t < 0 THEN 190660
+190660 LET v14 = 44
+190670 LET v14 = v14 * 3 + 12
+190680 LET t = t + v14 / 7
+190690 IF t < 0 THEN 190700
+190700 LET v15 = 48
+190710 LET v15 = v15 * 3 + 3
+190720 LET t = t + v15 / 7
+190730 IF t < 0 THEN 190740
+190740 LET v16 = 52
+190750 LET v16 = v16 * 3 + 7
+190760 LET t = t + v16 / 7
+190770 IF t < 0 THEN 190780
+190780 LET v17 = 56
+190790 LET v17 = v17 * 3 + 11
+190800 LET t = t + v17 / 7
+190810 IF t < 0 THEN 190820
+190820 LET v18 = 60
+190830 LET v18 = v18 * 3 + 2
+190840 LET t = t + v18 / 7
+190850 IF t < 0 THEN 190860
+190860 LET v19 = 64
+190870 LET v19 = v19 * 3 + 6
+190880 LET t = t + v19 / 7
+190890 IF t < 0 THEN 190900
+190900 LET v20 = 68
+190910 LET v20 = v20 * 3 + 10
+190920 LET t = t + v20 / 7
+190930 IF t < 0 THEN 190940
+190940 LET v21 = 72
+190950 LET v21 = v21 * 3 + 1
+190960 LET t = t + v21 / 7
+190970 IF t < 0 THEN 190980
+190980 LET v22 = 76
+190990 LET v22 = v22 * 3 + 5
+191000 LET t = t + v22 / 7
+191010 IF t < 0 THEN 191020
+191020 LET v23 = 80
+191030 LET v23 = v23 * 3 + 9
+191040 LET t = t + v23 / 7
+191050 IF t < 0 THEN 191060
+191060 LET v24 = 84
+191070 LET v24 = v24 * 3 + 0
+191080 LET t = t + v24 / 7
+191090 IF t < 0 THEN 191100
+191100 LET v25 = 88
+191110 LET v25 = v25 * 3 + 4
+191120 LET t = t + v25 / 7
+191130 IF t < 0 THEN 191140
+191140 LET v26 = 92
+191150 LET v26 = v26 * 3 + 8
+191160 LET t = t + v26 / 7
+191170 IF t < 0 THEN 191180
+191180 LET v27 = 96
+191190 LET v27 = v27 * 3 + 12
+191200 LET t = t + v27 / 7
+191210 IF t < 0 THEN 191220
+191220 LET v28 = 3
+191230 LET v28 = v28 * 3 + 3
+191240 LET t = t + v28 / 7
+191250 IF t < 0 THEN 191260
+191260 LET v29 = 7
+191270 LET v29 = v29 * 3 + 7
+191280 LET t = t + v29 / 7
+191290 IF t < 0 THEN 191300
+191300 LET v30 = 11
+191310 LET v30 = v30 * 3 + 11
+191320 LET t = t + v30 / 7
+191330 IF t < 0 THEN 191340
+191340 LET v31 = 15
+191350 LET v31 = v31 * 3 + 2
+191360 LET t = t + v31 / 7
+191370 IF t < 0 THEN 191380
+191380 LET v32 = 19
+191390 LET v32 = v32 * 3 + 6
+191400 LET t = t + v32 / 7
+191410 IF t < 0 THEN 191420
+191420 LET v33 = 23
+191430 LET v33 = v33 * 3 + 10
+191440 LET t = t + v33 / 7
+191450 IF t < 0 THEN 191460
+191460 LET v34 = 27
+191470 LET v34 = v34 * 3 + 1
+191480 LET t = t + v34 / 7
+191490 IF t < 0 THEN 191500
+191500 LET v35 = 31
+191510 LET v35 = v35 * 3 + 5
+191520 LET t = t + v35 / 7
+191530 IF t < 0 THEN 191540
+191540 LET v36 = 35
+191550 LET v36 = v36 * 3 + 9
+191560 LET t = t + v36 / 7
+191570 IF t < 0 THEN 191580
+191580 LET v37 = 39
+191590 LET v37 = v37 * 3 + 0
+191600 LET t = t + v37 / 7
+191610 IF t < 0 THEN 191620
+191620 LET v38 = 43
+191630 LET v38 = v38 * 3 + 4
+191640 LET t = t + v38 / 7
+191650 IF t < 0 THEN 191660
+191660 LET v39 = 47
+191670 LET v39 = v39 * 3 + 8
+191680 LET t = t + v39 / 7
+191690 IF t < 0 THEN 191700
+191700 LET v40 = 51
+191710 LET v40 = v40 * 3 + 12
+191720 LET t = t + v40 / 7
+191730 IF t < 0 THEN 191740
+191740 LET v41 = 55
+191750 LET v41 = v41 * 3 + 3
+191760 LET t = t + v41 / 7
+191770 IF t < 0 THEN 191780
+191780 LET v42 = 59
+191790 LET v42 = v42 * 3 + 7
+191800 LET t = t + v42 / 7
+191810 IF t < 0 THEN 191820
+191820 LET v43 = 63
+191830 LET v43 = v43 * 3 + 11
+191840 LET t = t + v43 / 7
+191850 IF t < 0 THEN 191860
+191860 LET v44 = 67
+191870 LET v44 = v44 * 3 + 2
+191880 LET t = t + v44 / 7
+191890 IF t < 0 THEN 191900
+191900 LET v45 = 71
+191910 LET v45 = v45 * 3 + 6
+191920 LET t = t + v45 / 7
+191930 IF t < 0 THEN 191940
+191940 LET v46 = 75
+191950 LET v46 = v46 * 3 + 10
+191960 LET t = t + v46 / 7
+191970 IF t < 0 THEN 191980
+191980 LET v47 = 79
+191990 LET v47 = v47 * 3 + 1
+192000 LET t = t + v47 / 7
+192010 IF t < 0 THEN 192020
+192020 LET v48 = 83
+192030 LET v48 = v48 * 3 + 5
+192040 LET t = t + v48 / 7
+192050 IF t < 0 THEN 192060
+192060 LET v49 = 87
+192070 LET v49 = v49 * 3 + 9
+192080 LET t = t + v49 / 7
+192090 IF t < 0 THEN 192100
+192100 LET v0 = 91
+192110 LET v0 = v0 * 3 + 0
+192120 LET t = t + v0 / 7
+192130 IF t < 0 THEN 192140
+192140 LET v1 = 95
+192150 LET v1 = v1 * 3 + 4
+192160 LET t = t + v1 / 7
+192170 IF t < 0 THEN 192180
+192180 LET v2 = 2
+192190 LET v2 = v2 * 3 + 8
+192200 LET t = t + v2 / 7
+192210 IF t < 0 THEN 192220
+192220 LET v3 = 6
+192230 LET v3 = v3 * 3 + 12
+192240 LET t = t + v3 / 7
+192250 IF t < 0 THEN 192260
+192260 LET v4 = 10
+192270 LET v4 = v4 * 3 + 3
+192280 LET t = t + v4 / 7
+192290 IF t < 0 THEN 192300
+192300 LET v5 = 14
+192310 LET v5 = v5 * 3 + 7
+192320 LET t = t + v5 / 7
+192330 IF t < 0 THEN 192340
+192340 LET v6 = 18
+192350 LET v6 = v6 * 3 + 11
+192360 LET t = t + v6 / 7
+192370 IF t < 0 THEN 192380
+192380 LET v7 = 22
+192390 LET v7 = v7 * 3 + 2
+192400 LET t = t + v7 / 7
+192410 IF t < 0 THEN 192420
+192420 LET v8 = 26
+192430 LET v8 = v8 * 3 + 6
+192440 LET t = t + v8 / 7
+192450 IF t < 0 THEN 192460
+192460 LET v9 = 30
+192470 LET v9 = v9 * 3 + 10
+192480 LET t = t + v9 / 7
+192490 IF t < 0 THEN 192500
+192500 LET v10 = 34
+192510 LET v10 = v10 * 3 + 1
+192520 LET t = t + v10 / 7
+192530 IF t < 0 THEN 192540
+192540 LET v11 = 38
+192550 LET v11 = v11 * 3 + 5
+192560 LET t = t + v11 / 7
+192570 IF t < 0 THEN 192580
+192580 LET v12 = 42
+192590 LET v12 = v12 * 3 + 9
+192600 LET t = t + v12 / 7
+192610 IF t < 0 THEN 192620
+192620 LET v13 = 46
+192630 LET v13 = v13 * 3 + 0
+192640 LET t = t + v13 / 7
+192650 IF t < 0 THEN 192660
+192660 LET v14 = 50
+192670 LET v14 = v14 * 3 + 4
+192680 LET t = t + v14 / 7
+192690 IF t < 0 THEN 192700
+192700 LET v15 = 54
+192710 LET v15 = v15 * 3 + 8
+192720 LET t = t + v15 / 7
+192730 IF t < 0 THEN 192740
+192740 LET v16 = 58
+192750 LET v16 = v16 * 3 + 12
+192760 LET t = t + v16 / 7
+192770 IF t < 0 THEN 192780
+192780 LET v17 = 62
+192790 LET v17 = v17 * 3 + 3
+192800 LET t = t + v17 / 7
+192810 IF t < 0 THEN 192820
+192820 LET v18 = 66
+192830 LET v18 = v18 * 3 + 7
+192840 LET t = t + v18 / 7
+192850 IF t < 0 THEN 192860
+192860 LET v19 = 70
+192870 LET v19 = v19 * 3 + 11
+192880 LET t = t + v19 / 7
+192890 IF t < 0 THEN 192900
+192900 LET v20 = 74
+192910 LET v20 = v20 * 3 + 2
+192920 LET t = t + v20 / 7
+192930 IF t < 0 THEN 192940
+192940 LET v21 = 78
+192950 LET v21 = v21 * 3 + 6
+192960 LET t = t + v21 / 7
+192970 IF t < 0 THEN 192980
+192980 LET v22 = 82
+192990 LET v22 = v22 * 3 + 10
+193000 LET t = t + v22 / 7
+193010 IF t < 0 THEN 193020
+193020 LET v23 = 86
+193030 LET v23 = v23 * 3 + 1
+193040 LET t = t + v23 / 7
+193050 IF t < 0 THEN 193060
+193060 LET v24 = 90
+193070 LET v24 = v24 * 3 + 5
+193080 LET t = t + v24 / 7
+193090 IF t < 0 THEN 193100
+193100 LET v25 = 94
+193110 LET v25 = v25 * 3 + 9
+193120 LET t = t + v25 / 7
+193130 IF t < 0 THEN 193140
+193140 LET v26 = 1
+193150 LET v26 = v26 * 3 + 0
+193160 LET t = t + v26 / 7
+193170 IF t < 0 THEN 193180
+193180 LET v27 = 5
+193190 LET v27 = v27 * 3 + 4
+193200 LET t = t + v27 / 7
+193210 IF t < 0 THEN 193220
+193220 LET v28 = 9
+193230 LET v28 = v28 * 3 + 8
+193240 LET t = t + v28 / 7
+193250 IF t < 0 THEN 193260
+193260 LET v29 = 13
+193270 LET v29 = v29 * 3 + 12
+193280 LET t = t + v29 / 7
+193290 IF t < 0 THEN 193300
+193300 LET v30 = 17
+193310 LET v30 = v30 * 3 + 3
+193320 LET t = t + v30 / 7
+193330 IF t < 0 THEN 193340
+193340 LET v31 = 21
+193350 LET v31 = v31 * 3 + 7
+193360 LET t = t + v31 / 7
+193370 IF t < 0 THEN 193380
+193380 LET v32 = 25
+193390 LET v32 = v32 * 3 + 11
+193400 LET t = t + v32 / 7
+193410 IF t < 0 THEN 193420
+193420 LET v33 = 29
+193430 LET v33 = v33 * 3 + 2
+193440 LET t = t + v33 / 7
+193450 IF t < 0 THEN 193460
+193460 LET v34 = 33
+193470 LET v34 = v34 * 3 + 6
+193480 LET t = t + v34 / 7
+193490 IF t < 0 THEN 193500
+193500 LET v35 = 37
+193510 LET v35 = v35 * 3 + 10
+193520 LET t = t + v35 / 7
+193530 IF t < 0 THEN 193540
+193540 LET v36 = 41
+193550 LET v36 = v36 * 3 + 1
+193560 LET t = t + v36 / 7
+193570 IF t < 0 THEN 193580
+193580 LET v37 = 45
+193590 LET v37 = v37 * 3 + 5
+193600 LET t = t + v37 / 7
+193610 IF t < 0 THEN 193620
+193620 LET v38 = 49
+193630 LET v38 = v38 * 3 + 9
+193640 LET t = t + v38 / 7
+193650 IF t < 0 THEN 193660
+193660 LET v39 = 53
+193670 LET v39 = v39 * 3 + 0
+193680 LET t = t + v39 / 7
+193690 IF t < 0 THEN 193700
+193700 LET v40 = 57
+193710 LET v40 = v40 * 3 + 4
+193720 LET t = t + v40 / 7
+193730 IF t < 0 THEN 193740
+193740 LET v41 = 61
+193750 LET v41 = v41 * 3 + 8
+193760 LET t = t + v41 / 7
+193770 IF t < 0 THEN 193780
+193780 LET v42 = 65
+193790 LET v42 = v42 * 3 + 12
+193800 LET t = t + v42 / 7
+193810 IF t < 0 THEN 193820
+193820 LET v43 = 69
+193830 LET v43 = v43 * 3 + 3
+193840 LET t = t + v43 / 7
+193850 IF t < 0 THEN 193860
+193860 LET v44 = 73
+193870 LET v44 = v44 * 3 + 7
+193880 LET t = t + v44 / 7
+193890 IF t < 0 THEN 193900
+193900 LET v45 = 77
+193910 LET v45 = v45 * 3 + 11
+193920 LET t = t + v45 / 7
+193930 IF t < 0 THEN 193940
+193940 LET v46 = 81
+193950 LET v46 = v46 * 3 + 2
+193960 LET t = t + v46 / 7
+193970 IF t < 0 THEN 193980
+193980 LET v47 = 85
+193990 LET v47 = v47 * 3 + 6
+194000 LET t = t + v47 / 7
+194010 IF t < 0 THEN 194020
+194020 LET v48 = 89
+194030 LET v48 = v48 * 3 + 10
+194040 LET t = t + v48 / 7
+194050 IF t < 0 THEN 194060
+194060 LET v49 = 93
+194070 LET v49 = v49 * 3 + 1
+194080 LET t = t + v49 / 7
+194090 IF t < 0 THEN 194100
+194100 LET v0 = 0
+194110 LET v0 = v0 * 3 + 5
+194120 LET t = t + v0 / 7
+194130 IF t < 0 THEN 194140
+194140 LET v1 = 4
+194150 LET v1 = v1 * 3 + 9
+194160 LET t = t + v1 / 7
+194170 IF t < 0 THEN 194180
+194180 LET v2 = 8
+194190 LET v2 = v2 * 3 + 0
+194200 LET t = t + v2 / 7
+194210 IF t < 0 THEN 194220
+194220 LET v3 = 12
+194230 LET v3 = v3 * 3 + 4
+194240 LET t = t + v3 / 7
+194250 IF t < 0 THEN 194260
+194260 LET v4 = 16
+194270 LET v4 = v4 * 3 + 8
+194280 LET t = t + v4 / 7
+194290 IF t < 0 THEN 194300
+194300 LET v5 = 20
+194310 LET v5 = v5 * 3 + 12
+194320 LET t = t + v5 / 7
+194330 IF t < 0 THEN 194340
+194340 LET v6 = 24
+194350 LET v6 = v6 * 3 + 3
+194360 LET t = t + v6 / 7
+194370 IF t < 0 THEN 194380
+194380 LET v7 = 28
+194390 LET v7 = v7 * 3 + 7
+194400 LET t = t + v7 / 7
+194410 IF t < 0 THEN 194420
+194420 LET v8 = 32
+194430 LET v8 = v8 * 3 + 11
+194440 LET t = t + v8 / 7
+194450 IF t < 0 THEN 194460
+194460 LET v9 = 36
+194470 LET v9 = v9 * 3 + 2
+194480 LET t = t + v9 / 7
+194490 IF t < 0 THEN 194500
+194500 LET v10 = 40
+194510 LET v10 = v10 * 3 + 6
+194520 LET t = t + v10 / 7
+194530 IF t < 0 THEN 194540
+194540 LET v11 = 44
+194550 LET v11 = v11 * 3 + 10
+194560 LET t = t + v11 / 7
+194570 IF t < 0 THEN 194580
+194580 LET v12 = 48
+194590 LET v12 = v12 * 3 + 1
+194600 LET t = t + v12 / 7
+194610 IF t < 0 THEN 194620
+194620 LET v13 = 52
+194630 LET v13 = v13 * 3 + 5
+194640 LET t = t + v13 / 7
+194650 IF t < 0 THEN 194660
+194660 LET v14 = 56
+194670 LET v14 = v14 * 3 + 9
+194680 LET t = t + v14 / 7
+194690 IF t < 0 THEN 194700
+194700 LET v15 = 60
+194710 LET v15 = v15 * 3 + 0
+194720 LET t = t + v15 / 7
+194730 IF t < 0 THEN 194740
+194740 LET v16 = 64
+194750 LET v16 = v16 * 3 + 4
+194760 LET t = t + v16 / 7
+194770 IF t < 0 THEN 194780
+194780 LET v17 = 68
+194790 LET v17 = v17 * 3 + 8
+194800 LET t = t + v17 / 7
+194810 IF t < 0 THEN 194820
+194820 LET v18 = 72
+194830 LET v18 = v18 * 3 + 12
+194840 LET t = t + v18 / 7
+194850 IF t < 0 THEN 194860
+194860 LET v19 = 76
+194870 LET v19 = v19 * 3 + 3
+194880 LET t = t + v19 / 7
+194890 IF t < 0 THEN 194900
+194900 LET v20 = 80
+194910 LET v20 = v20 * 3 + 7
+194920 LET t = t + v20 / 7
+194930 IF t < 0 THEN 194940
+194940 LET v21 = 84
+194950 LET v21 = v21 * 3 + 11
+194960 LET t = t + v21 / 7
+194970 IF t < 0 THEN 194980
+194980 LET v22 = 88
+194990 LET v22 = v22 * 3 + 2
+195000 LET t = t + v22 / 7
+195010 IF t < 0 THEN 195020
+195020 LET v23 = 92
+195030 LET v23 = v23 * 3 + 6
+195040 LET t = t + v23 / 7
+195050 IF t < 0 THEN 195060
+195060 LET v24 = 96
+195070 LET v24 = v24 * 3 + 10
+195080 LET t = t + v24 / 7
+195090 IF t < 0 THEN 195100
+195100 LET v25 = 3
+195110 LET v25 = v25 * 3 + 1
+195120 LET t = t + v25 / 7
+195130 IF t < 0 THEN 195140
+195140 LET v26 = 7
+195150 LET v26 = v26 * 3 + 5
+195160 LET t = t + v26 / 7
+195170 IF t < 0 THEN 195180
+195180 LET v27 = 11
+195190 LET v27 = v27 * 3 + 9
+195200 LET t = t + v27 / 7
+195210 IF t < 0 THEN 195220
+195220 LET v28 = 15
+195230 LET v28 = v28 * 3 + 0
+195240 LET t = t + v28 / 7
+195250 IF t < 0 THEN 195260
+195260 LET v29 = 19
+195270 LET v29 = v29 * 3 + 4
+195280 LET t = t + v29 / 7
+195290 IF t < 0 THEN 195300
+195300 LET v30 = 23
+195310 LET v30 = v30 * 3 + 8
+195320 LET t = t + v30 / 7
+195330 IF t < 0 THEN 195340
+195340 LET v31 = 27
+195350 LET v31 = v31 * 3 + 12
+195360 LET t = t + v31 / 7
+195370 IF t < 0 THEN 195380
+195380 LET v32 = 31
+195390 LET v32 = v32 * 3 + 3
+195400 LET t = t + v32 / 7
+195410 IF t < 0 THEN 195420
+195420 LET v33 = 35
+195430 LET v33 = v33 * 3 + 7
+195440 LET t = t + v33 / 7
+195450 IF t < 0 THEN 195460
+195460 LET v34 = 39
+195470 LET v34 = v34 * 3 + 11
+195480 LET t = t + v34 / 7
+195490 IF t < 0 THEN 195500
+195500 LET v35 = 43
+195510 LET v35 = v35 * 3 + 2
+195520 LET t = t + v35 / 7
+195530 IF t < 0 THEN 195540
+195540 LET v36 = 47
+195550 LET v36 = v36 * 3 + 6
+195560 LET t = t + v36 / 7
+195570 IF t < 0 THEN 195580
+195580 LET v37 = 51
+195590 LET v37 = v37 * 3 + 10
+195600 LET t = t + v37 / 7
+195610 IF t < 0 THEN 195620
+195620 LET v38 = 55
+195630 LET v38 = v38 * 3 + 1
+195640 LET t = t + v38 / 7
+195650 IF t < 0 THEN 195660
+195660 LET v39 = 59
+195670 LET v39 = v39 * 3 + 5
+195680 LET t = t + v39 / 7
+195690 IF t < 0 THEN 195700
+195700 LET v40 = 63
+195710 LET v40 = v40 * 3 + 9
+195720 LET t = t + v40 / 7
+195730 IF t < 0 THEN 195740
+195740 LET v41 = 67
+195750 LET v41 = v41 * 3 + 0
+195760 LET t = t + v41 / 7
+195770 IF t < 0 THEN 195780
+195780 LET v42 = 71
+195790 LET v42 = v42 * 3 + 4
+195800 LET t = t + v42 / 7
+195810 IF t < 0 THEN 195820
+195820 LET v43 = 75
+195830 LET v43 = v43 * 3 + 8
+195840 LET t = t + v43 / 7
+195850 IF t < 0 THEN 195860
+195860 LET v44 = 79
+195870 LET v44 = v44 * 3 + 12
+195880 LET t = t + v44 / 7
+195890 IF t < 0 THEN 195900
+195900 LET v45 = 83
+195910 LET v45 = v45 * 3 + 3
+195920 LET t = t + v45 / 7
+195930 IF t < 0 THEN 195940
+195940 LET v46 = 87
+195950 LET v46 = v46 * 3 + 7
+195960 LET t = t + v46 / 7
+195970 IF t < 0 THEN 195980
+195980 LET v47 = 91
+195990 LET v47 = v47 * 3 + 11
+196000 LET t = t + v47 / 7
+196010 IF t < 0 THEN 196020
+196020 LET v48 = 95
+196030 LET v48 = v48 * 3 + 2
+196040 LET t = t + v48 / 7
+196050 IF t < 0 THEN 196060
+196060 LET v49 = 2
+196070 LET v49 = v49 * 3 + 6
+196080 LET t = t + v49 / 7
+196090 IF t < 0 THEN 196100
+196100 LET v0 = 6
+196110 LET v0 = v0 * 3 + 10
+196120 LET t = t + v0 / 7
+196130 IF t < 0 THEN 196140
+196140 LET v1 = 10
+196150 LET v1 = v1 * 3 + 1
+196160 LET t = t + v1 / 7
+196170 IF t < 0 THEN 196180
+196180 LET v2 = 14
+196190 LET v2 = v2 * 3 + 5
+196200 LET t = t + v2 / 7
+196210 IF t < 0 THEN 196220
+196220 LET v3 = 18
+196230 LET v3 = v3 * 3 + 9
+196240 LET t = t + v3 / 7
+196250 IF t < 0 THEN 196260
+196260 LET v4 = 22
+196270 LET v4 = v4 * 3 + 0
+196280 LET t = t + v4 / 7
+196290 IF t < 0 THEN 196300
+196300 LET v5 = 26
+196310 LET v5 = v5 * 3 + 4
+196320 LET t = t + v5 / 7
+196330 IF t < 0 THEN 196340
+196340 LET v6 = 30
+196350 LET v6 = v6 * 3 + 8
+196360 LET t = t + v6 / 7
+196370 IF t < 0 THEN 196380
+196380 LET v7 = 34
+196390 LET v7 = v7 * 3 + 12
+196400 LET t = t + v7 / 7
+196410 IF t < 0 THEN 196420
+196420 LET v8 = 38
+196430 LET v8 = v8 * 3 + 3
+196440 LET t = t + v8 / 7
+196450 IF t < 0 THEN 196460
+196460 LET v9 = 42
+196470 LET v9 = v9 * 3 + 7
+196480 LET t = t + v9 / 7
+196490 IF t < 0 THEN 196500
+196500 LET v10 = 46
+196510 LET v10 = v10 * 3 + 11
+196520 LET t = t + v10 / 7
+196530 IF t < 0 THEN 196540
+196540 LET v11 = 50
+196550 LET v11 = v11 * 3 + 2
+196560 LET t = t + v11 / 7
+196570 IF t < 0 THEN 196580
+196580 LET v12 = 54
+196590 LET v12 = v12 * 3 + 6
+196600 LET t = t + v12 / 7
+196610 IF t < 0 THEN 196620
+196620 LET v13 = 58
+196630 LET v13 = v13 * 3 + 10
+196640 LET t = t + v13 / 7
+196650 IF t < 0 THEN 196660
+196660 LET v14 = 62
+196670 LET v14 = v14 * 3 + 1
+196680 LET t = t + v14 / 7
+196690 IF t < 0 THEN 196700
+196700 LET v15 = 66
+196710 LET v15 = v15 * 3 + 5
+196720 LET t = t + v15 / 7
+196730 IF t < 0 THEN 196740
+196740 LET v16 = 70
+196750 LET v16 = v16 * 3 + 9
+196760 LET t = t + v16 / 7
+196770 IF t < 0 THEN 196780
+196780 LET v17 = 74
+196790 LET v17 = v17 * 3 + 0
+196800 LET t = t + v17 / 7
+196810 IF t < 0 THEN 196820
+196820 LET v18 = 78
+196830 LET v18 = v18 * 3 + 4
+196840 LET t = t + v18 / 7
+196850 IF t < 0 THEN 196860
+196860 LET v19 = 82
+196870 LET v19 = v19 * 3 + 8
+196880 LET t = t + v19 / 7
+196890 IF t < 0 THEN 196900
+196900 LET v20 = 86
+196910 LET v20 = v20 * 3 + 12
+196920 LET t = t + v20 / 7
+196930 IF t < 0 THEN 196940
+196940 LET v21 = 90
+196950 LET v21 = v21 * 3 + 3
+196960 LET t = t + v21 / 7
+196970 IF t < 0 THEN 196980
+196980 LET v22 = 94
+196990 LET v22 = v22 * 3 + 7
+197000 LET t = t + v22 / 7
+197010 IF t < 0 THEN 197020
+197020 LET v23 = 1
+197030 LET v23 = v23 * 3 + 11
+197040 LET t = t + v23 / 7
+197050 IF t < 0 THEN 197060
+197060 LET v24 = 5
+197070 LET v24 = v24 * 3 + 2
+197080 LET t = t + v24 / 7
+197090 IF t < 0 THEN 197100
+197100 LET v25 = 9
+197110 LET v25 = v25 * 3 + 6
+197120 LET t = t + v25 / 7
+197130 IF t < 0 THEN 197140
+197140 LET v26 = 13
+197150 LET v26 = v26 * 3 + 10
+197160 LET t = t + v26 / 7
+197170 IF t < 0 THEN 197180
+197180 LET v27 = 17
+197190 LET v27 = v27 * 3 + 1
+197200 LET t = t + v27 / 7
+197210 IF t < 0 THEN 197220
+197220 LET v28 = 21
+197230 LET v28 = v28 * 3 + 5
+197240 LET t = t + v28 / 7
+197250 IF t < 0 THEN 197260
+197260 LET v29 = 25
+197270 LET v29 = v29 * 3 + 9
+197280 LET t = t + v29 / 7
+197290 IF t < 0 THEN 197300
+197300 LET v30 = 29
+197310 LET v30 = v30 * 3 + 0
+197320 LET t = t + v30 / 7
+197330 IF t < 0 THEN 197340
+197340 LET v31 = 33
+197350 LET v31 = v31 * 3 + 4
+197360 LET t = t + v31 / 7
+197370 IF t < 0 THEN 197380
+197380 LET v32 = 37
+197390 LET v32 = v32 * 3 + 8
+197400 LET t = t + v32 / 7
+197410 IF t < 0 THEN 197420
+197420 LET v33 = 41
+197430 LET v33 = v33 * 3 + 12
+197440 LET t = t + v33 / 7
+197450 IF t < 0 THEN 197460
+197460 LET v34 = 45
+197470 LET v34 = v34 * 3 + 3
+197480 LET t = t + v34 / 7
+197490 IF t < 0 THEN 197500
+197500 LET v35 = 49
+197510 LET v35 = v35 * 3 + 7
+197520 LET t = t + v35 / 7
+197530 IF t < 0 THEN 197540
+197540 LET v36 = 53
+197550 LET v36 = v36 * 3 + 11
+197560 LET t = t + v36 / 7
+197570 IF t < 0 THEN 197580
+197580 LET v37 = 57
+197590 LET v37 = v37 * 3 + 2
+197600 LET t = t + v37 / 7
+197610 IF t < 0 THEN 197620
+197620 LET v38 = 61
+197630 LET v38 = v38 * 3 + 6
+197640 LET t = t + v38 / 7
+197650 IF t < 0 THEN 197660
+197660 LET v39 = 65
+197670 LET v39 = v39 * 3 + 10
+197680 LET t = t + v39 / 7
+197690 IF t < 0 THEN 197700
+197700 LET v40 = 69
+197710 LET v40 = v40 * 3 + 1
+197720 LET t = t + v40 / 7
+197730 IF t < 0 THEN 197740
+197740 LET v41 = 73
+197750 LET v41 = v41 * 3 + 5
+197760 LET t = t + v41 / 7
+197770 IF t < 0 THEN 197780
+197780 LET v42 = 77
+197790 LET v42 = v42 * 3 + 9
+197800 LET t = t + v42 / 7
+197810 IF t < 0 THEN 197820
+197820 LET v43 = 81
+197830 LET v43 = v43 * 3 + 0
+197840 LET t = t + v43 / 7
+197850 IF t < 0 THEN 197860
+197860 LET v44 = 85
+197870 LET v44 = v44 * 3 + 4
+197880 LET t = t + v44 / 7
+197890 IF t < 0 THEN 197900
+197900 LET v45 = 89
+197910 LET v45 = v45 * 3 + 8
+197920 LET t = t + v45 / 7
+197930 IF t < 0 THEN 197940
+197940 LET v46 = 93
+197950 LET v46 = v46 * 3 + 12
+197960 LET t = t + v46 / 7
+197970 IF t < 0 THEN 197980
+197980 LET v47 = 0
+197990 LET v47 = v47 * 3 + 3
+198000 LET t = t + v47 / 7
+198010 IF t < 0 THEN 198020
+198020 LET v48 = 4
+198030 LET v48 = v48 * 3 + 7
+198040 LET t = t + v48 / 7
+198050 IF t < 0 THEN 198060
+198060 LET v49 = 8
+198070 LET v49 = v49 * 3 + 11
+198080 LET t = t + v49 / 7
+198090 IF t < 0 THEN 198100
+198100 LET v0 = 12
+198110 LET v0 = v0 * 3 + 2
+198120 LET t = t + v0 / 7
+198130 IF t < 0 THEN 198140
+198140 LET v1 = 16
+198150 LET v1 = v1 * 3 + 6
+198160 LET t = t + v1 / 7
+198170 IF t < 0 THEN 198180
+198180 LET v2 = 20
+198190 LET v2 = v2 * 3 + 10
+198200 LET t = t + v2 / 7
+198210 IF t < 0 THEN 198220
+198220 LET v3 = 24
+198230 LET v3 = v3 * 3 + 1
+198240 LET t = t + v3 / 7
+198250 IF t < 0 THEN 198260
+198260 LET v4 = 28
+198270 LET v4 = v4 * 3 + 5
+198280 LET t = t + v4 / 7
+198290 IF t < 0 THEN 198300
+198300 LET v5 = 32
+198310 LET v5 = v5 * 3 + 9
+198320 LET t = t + v5 / 7
+198330 IF t < 0 THEN 198340
+198340 LET v6 = 36
+198350 LET v6 = v6 * 3 + 0
+198360 LET t = t + v6 / 7
+198370 IF t < 0 THEN 198380
+198380 LET v7 = 40
+198390 LET v7 = v7 * 3 + 4
+198400 LET t = t + v7 / 7
+198410 IF t < 0 THEN 198420
+198420 LET v8 = 44
+198430 LET v8 = v8 * 3 + 8
+198440 LET t = t + v8 / 7
+198450 IF t < 0 THEN 198460
+198460 LET v9 = 48
+198470 LET v9 = v9 * 3 + 12
+198480 LET t = t + v9 / 7
+198490 IF t < 0 THEN 198500
+198500 LET v10 = 52
+198510 LET v10 = v10 * 3 + 3
+198520 LET t = t + v10 / 7
+198530 IF t < 0 THEN 198540
+198540 LET v11 = 56
+198550 LET v11 = v11 * 3 + 7
+198560 LET t = t + v11 / 7
+198570 IF t < 0 THEN 198580
+198580 LET v12 = 60
+198590 LET v12 = v12 * 3 + 11
+198600 LET t = t + v12 / 7
+198610 IF t < 0 THEN 198620
+198620 LET v13 = 64
+198630 LET v13 = v13 * 3 + 2
+198640 LET t = t + v13 / 7
+198650 IF t < 0 THEN 198660
+198660 LET v14 = 68
+198670 LET v14 = v14 * 3 + 6
+198680 LET t = t + v14 / 7
+198690 IF t < 0 THEN 198700
+198700 LET v15 = 72
+198710 LET v15 = v15 * 3 + 10
+198720 LET t = t + v15 / 7
+198730 IF t < 0 THEN 198740
+198740 LET v16 = 76
+198750 LET v16 = v16 * 3 + 1
+198760 LET t = t + v16 / 7
+198770 IF t < 0 THEN 198780
+198780 LET v17 = 80
+198790 LET v17 = v17 * 3 + 5
+198800 LET t = t + v17 / 7
+198810 IF t < 0 THEN 198820
+198820 LET v18 = 84
+198830 LET v18 = v18 * 3 + 9
+198840 LET t = t + v18 / 7
+198850 IF t < 0 THEN 198860
+198860 LET v19 = 88
+198870 LET v19 = v19 * 3 + 0
+198880 LET t = t + v19 / 7
+198890 IF t < 0 THEN 198900
+198900 LET v20 = 92
+198910 LET v20 = v20 * 3 + 4
+198920 LET t = t + v20 / 7
+198930 IF t < 0 THEN 198940
+198940 LET v21 = 96
+198950 LET v21 = v21 * 3 + 8
+198960 LET t = t + v21 / 7
+198970 IF t < 0 THEN 198980
+198980 LET v22 = 3
+198990 LET v22 = v22 * 3 + 12
+199000 LET t = t + v22 / 7
+199010 IF t < 0 THEN 199020
+199020 LET v23 = 7
+199030 LET v23 = v23 * 3 + 3
+199040 LET t = t + v23 / 7
+199050 IF t < 0 THEN 199060
+199060 LET v24 = 11
+199070 LET v24 = v24 * 3 + 7
+199080 LET t = t + v24 / 7
+199090 IF t < 0 THEN 199100
+199100 LET v25 = 15
+199110 LET v25 = v25 * 3 + 11
+199120 LET t = t + v25 / 7
+199130 IF t < 0 THEN 199140
+199140 LET v26 = 19
+199150 LET v26 = v26 * 3 + 2
+199160 LET t = t + v26 / 7
+199170 IF t < 0 THEN 199180
+199180 LET v27 = 23
+199190 LET v27 = v27 * 3 + 6
+199200 LET t = t + v27 / 7
+199210 IF t < 0 THEN 199220
+199220 LET v28 = 27
+199230 LET v28 = v28 * 3 + 10
+199240 LET t = t + v28 / 7
+199250 IF t < 0 THEN 199260
+199260 LET v29 = 31
+199270 LET v29 = v29 * 3 + 1
+199280 LET t = t + v29 / 7
+199290 IF t < 0 THEN 199300
+199300 LET v30 = 35
+199310 LET v30 = v30 * 3 + 5
+199320 LET t = t + v30 / 7
+199330 IF t < 0 THEN 199340
+199340 LET v31 = 39
+199350 LET v31 = v31 * 3 + 9
+199360 LET t = t + v31 / 7
+199370 IF t < 0 THEN 199380
+199380 LET v32 = 43
+199390 LET v32 = v32 * 3 + 0
+199400 LET t = t + v32 / 7
+199410 IF t < 0 THEN 199420
+199420 LET v33 = 47
+199430 LET v33 = v33 * 3 + 4
+199440 LET t = t + v33 / 7
+199450 IF t < 0 THEN 199460
+199460 LET v34 = 51
+199470 LET v34 = v34 * 3 + 8
+199480 LET t = t + v34 / 7
+199490 IF t < 0 THEN 199500
+199500 LET v35 = 55
+199510 LET v35 = v35 * 3 + 12
+199520 LET t = t + v35 / 7
+199530 IF t < 0 THEN 199540
+199540 LET v36 = 59
+199550 LET v36 = v36 * 3 + 3
+199560 LET t = t + v36 / 7
+199570 IF t < 0 THEN 199580
+199580 LET v37 = 63
+199590 LET v37 = v37 * 3 + 7
+199600 LET t = t + v37 / 7
+199610 IF t < 0 THEN 199620
+199620 LET v38 = 67
+199630 LET v38 = v38 * 3 + 11
+199640 LET t = t + v38 / 7
+199650 IF t < 0 THEN 199660
+199660 LET v39 = 71
+199670 LET v39 = v39 * 3 + 2
+199680 LET t = t + v39 / 7
+199690 IF t < 0 THEN 199700
+199700 LET v40 = 75
+199710 LET v40 = v40 * 3 + 6
+199720 LET t = t + v40 / 7
+199730 IF t < 0 THEN 199740
+199740 LET v41 = 79
+199750 LET v41 = v41 * 3 + 10
+199760 LET t = t + v41 / 7
+199770 IF t < 0 THEN 199780
+199780 LET v42 = 83
+199790 LET v42 = v42 * 3 + 1
+199800 LET t = t + v42 / 7
+199810 IF t < 0 THEN 199820
+199820 LET v43 = 87
+199830 LET v43 = v43 * 3 + 5
+199840 LET t = t + v43 / 7
+199850 IF t < 0 THEN 199860
+199860 LET v44 = 91
+199870 LET v44 = v44 * 3 + 9
+199880 LET t = t + v44 / 7
+199890 IF t < 0 THEN 199900
+199900 LET v45 = 95
+199910 LET v45 = v45 * 3 + 0
+199920 LET t = t + v45 / 7
+199930 IF t < 0 THEN 199940
+199940 LET v46 = 2
+199950 LET v46 = v46 * 3 + 4
+199960 LET t = t + v46 / 7
+199970 IF t < 0 THEN 199980
+199980 LET v47 = 6
+199990 LET v47 = v47 * 3 + 8
+200000 LET t = t + v47 / 7
+200010 IF t < 0 THEN 200020
+200020 LET v48 = 10
+200030 LET v48 = v48 * 3 + 12
+200040 LET t = t + v48 / 7
+200050 IF t < 0 THEN 200060
+200060 LET v49 = 14
+200070 LET v49 = v49 * 3 + 3
+200080 LET t = t + v49 / 7
+200090 IF t < 0 THEN 200100
+200100 LET p = p + 1
+200110 IF p < 20 THEN 100
+200120 PRINT "total", t
+200130 END
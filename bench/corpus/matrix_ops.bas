@@ -0,0 +1,26 @@
+10 REM Matrix workload: products and transposes of 240 x 240 matrices, then an inverse
+20 LET n = 240
+30 DIM a(n, n), b(n, n)
+40 LET i = 1
+50 LET j = 1
+60 LET a(i, j) = 1 / (i + j)
+70 LET b(i, j) = (i + 2 * j) / n
+80 LET j = j + 1
+90 IF j < n + 1 THEN 60
+100 LET a(i, i) = 2
+110 LET i = i + 1
+120 IF i < n + 1 THEN 50
+130 LET k = 0
+140 LET t = 0
+150 MAT c = a * b
+160 MAT b = TRN(c)
+170 b() = b() * (n / SUM(b()))
+180 LET t = t + DOT(b(), a())
+190 LET k = k + 1
+200 IF k < 200 THEN 150
+210 MAT d = INV(a)
+220 MAT e = d * a
+230 PRINT "corner", b(1, 1), b(n, n)
+240 PRINT "identity", SUM(e())
+250 PRINT "total", t
+260 END
@@ -0,0 +1,7 @@
+10 REM PRINT-heavy output: a table of squares and cubes, one line each
+20 LET n = 100000
+30 LET i = 0
+40 LET i = i + 1
+50 PRINT "row", i, i * i, i * i * i / 1000
+60 IF i < n THEN 40
+70 END
@@ -0,0 +1,4009 @@
+477001442 GOTO 64000202
+1766005309 GOTO 680002050
+1670005021 GOTO 883002659
+939002827 LET t = t + 4
+1423004280 GOTO 1679005047
+1571004724 GOTO 661001993
+1203003620 GOTO 626001888
+207000631 LET t = t + 3
+1408004234 LET t = t + 14
+1332004007 GOTO 1675005035
+272000826 LET t = t + 0
+1909005738 GOTO 1778005344
+1487004471 LET t = t + 8
+509001537 LET t = t + 16
+288000874 LET t = t + 16
+540001631 GOTO 945002845
+745002246 GOTO 1226003688
+1878005644 LET t = t + 8
+1135003415 LET t = t + 13
+918002765 GOTO 153000469
+140000430 LET t = t + 4
+1876005638 LET t = t + 6
+1893005690 GOTO 1754005272
+152000466 LET t = t + 16
+1706005128 LET t = t + 6
+1447004352 GOTO 267000811
+1549004658 GOTO 112000346
+768002314 LET t = t + 3
+1685005066 GOTO 1563004699
+1379004147 LET t = t + 2
+873002630 GOTO 1506004528
+1255003775 LET t = t + 14
+1695005095 LET t = t + 12
+293000890 GOTO 845002545
+1353004069 LET t = t + 10
+1081003254 GOTO 1561004693
+591001784 GOTO 115000355
+430001301 GOTO 1914005752
+928002794 LET t = t + 10
+1466004409 GOTO 535001615
+1805005426 GOTO 988002974
+834002512 LET t = t + 1
+1015003056 GOTO 18000064
+450001361 GOTO 650001960
+206000628 LET t = t + 2
+1288003875 GOTO 997003001
+312000946 LET t = t + 6
+1243003739 LET t = t + 2
+1745005245 LET t = t + 11
+1012003046 LET t = t + 9
+1807005432 GOTO 404001222
+363001099 LET t = t + 6
+1582004756 LET t = t + 1
+1011003044 GOTO 1603004819
+1713005149 LET t = t + 13
+1895005695 LET t = t + 8
+1462004397 GOTO 545001645
+793002390 GOTO 652001966
+905002726 GOTO 1371004123
+1070003221 GOTO 1709005137
+1425004285 LET t = t + 14
+1540004631 GOTO 575001735
+340001031 GOTO 547001651
+869002618 GOTO 437001321
+447001351 LET t = t + 5
+404001222 LET t = t + 13
+1352004066 LET t = t + 9
+1730005200 LET t = t + 13
+1843005539 LET t = t + 7
+264000803 GOTO 1525004585
+1749005257 LET t = t + 15
+1306003929 GOTO 1753005269
+657001981 LET t = t + 11
+684002063 GOTO 1956005878
+213000649 LET t = t + 9
+1413004250 GOTO 823002479
+701002114 GOTO 763002299
+170000521 GOTO 814002452
+1296003898 LET t = t + 4
+1236003718 LET t = t + 12
+1063003200 GOTO 1850005560
+801002413 LET t = t + 2
+656001979 GOTO 933002809
+1888005674 LET t = t + 1
+1363004099 LET t = t + 3
+276000838 LET t = t + 4
+1978005945 GOTO 657001981
+1996005998 LET t = t + 7
+1255003776 GOTO 1875005635
+263000799 LET t = t + 8
+464001402 LET t = t + 5
+634001913 GOTO 1931005803
+403001219 LET t = t + 12
+1631004904 GOTO 813002449
+271000823 LET t = t + 16
+1594004793 GOTO 1702005116
+336001019 GOTO 893002689
+1740005231 GOTO 1207003631
+1688005074 LET t = t + 5
+1642004937 GOTO 1048003154
+340001030 LET t = t + 0
+1848005555 GOTO 795002395
+1293003890 GOTO 1112003346
+1388004175 GOTO 242000736
+988002974 LET t = t + 2
+1639004928 GOTO 1838005524
+191000583 LET t = t + 4
+1485004466 GOTO 234000712
+1567004711 LET t = t + 3
+511001544 GOTO 1217003661
+1852005566 LET t = t + 16
+737002221 LET t = t + 6
+933002810 GOTO 1293003889
+44000142 LET t = t + 10
+827002492 GOTO 361001093
+649001957 LET t = t + 3
+221000673 LET t = t + 0
+47000151 LET t = t + 13
+162000496 LET t = t + 9
+349001058 GOTO 1683005059
+586001769 GOTO 1587004771
+198000605 GOTO 1767005311
+1794005393 GOTO 1063003199
+1881005653 LET t = t + 11
+1441004334 GOTO 921002773
+99000308 GOTO 1687005071
+479001448 GOTO 1779005347
+1497004502 GOTO 1518004564
+636001919 GOTO 1937005821
+1790005381 GOTO 1105003325
+1659004987 LET t = t + 10
+1883005660 GOTO 1276003838
+94000293 GOTO 1653004969
+1476004438 LET t = t + 14
+70000221 GOTO 354001072
+1838005525 GOTO 699002107
+1665005006 GOTO 1840005530
+1034003113 GOTO 939002827
+485001466 GOTO 1476004438
+990002981 GOTO 341001033
+64000202 LET t = t + 13
+1206003629 GOTO 783002359
+680002051 GOTO 1116003358
+604001823 GOTO 1797005401
+1889005677 LET t = t + 2
+1755005275 LET t = t + 4
+1808005435 GOTO 824002482
+409001238 GOTO 1388004174
+222000676 LET t = t + 1
+209000638 GOTO 190000580
+778002344 LET t = t + 13
+544001642 LET t = t + 0
+589001778 GOTO 961002893
+1912005747 GOTO 929002797
+1026003088 LET t = t + 6
+1554004673 GOTO 644001942
+1118003365 GOTO 1032003106
+1851005564 GOTO 1901005713
+1862005596 LET t = t + 9
+287000872 GOTO 1143003439
+1753005270 GOTO 1320003970
+763002299 LET t = t + 15
+510001540 LET t = t + 0
+1595004795 LET t = t + 14
+1560004690 LET t = t + 13
+1448004355 GOTO 789002377
+149000458 GOTO 719002167
+1936005819 GOTO 1895005695
+1553004669 LET t = t + 6
+1127003392 GOTO 1621004873
+1394004193 GOTO 430001300
+697002101 LET t = t + 0
+1265003805 LET t = t + 7
+886002668 LET t = t + 2
+633001909 LET t = t + 4
+848002555 GOTO 315000955
+1421004274 GOTO 1228003694
+471001424 GOTO 1059003187
+1651004963 LET t = t + 2
+1441004333 LET t = t + 13
+882002657 GOTO 44000142
+974002933 GOTO 187000571
+612001847 GOTO 1857005581
+1102003316 LET t = t + 14
+1018003065 GOTO 1242003736
+364001103 GOTO 1566004708
+1236003719 GOTO 1426004288
+1735005215 LET t = t + 1
+396001198 LET t = t + 5
+1898005704 LET t = t + 11
+583001760 GOTO 1255003775
+1112003347 GOTO 254000772
+1330004000 LET t = t + 4
+1918005764 LET t = t + 14
+512001547 GOTO 1355004075
+1132003407 GOTO 48000154
+736002218 LET t = t + 5
+1380004151 GOTO 392001186
+931002803 LET t = t + 13
+1976005938 LET t = t + 4
+672002027 GOTO 1432004306
+326000989 GOTO 934002812
+853002570 GOTO 282000856
+1747005252 GOTO 647001951
+333001009 LET t = t + 10
+486001469 GOTO 725002185
+980002950 LET t = t + 11
+1320003971 GOTO 1635004915
+1539004628 GOTO 116000358
+1122003376 LET t = t + 0
+1647004952 GOTO 438001324
+1172003526 LET t = t + 16
+1274003833 GOTO 476001438
+986002968 LET t = t + 0
+1323003979 LET t = t + 14
+424001283 GOTO 1941005833
+140000431 GOTO 1301003913
+5 GOTO 1923005779
+1505004525 LET t = t + 9
+835002515 LET t = t + 2
+196000598 LET t = t + 9
+1360004091 GOTO 247000751
+1165003506 GOTO 1656004978
+772002326 LET t = t + 7
+1490004481 GOTO 980002950
+1273003830 GOTO 28000094
+1999006007 LET t = t + 10
+1365004105 LET t = t + 5
+789002377 LET t = t + 7
+1384004163 GOTO 259000787
+1983005960 GOTO 1555004675
+511001543 LET t = t + 1
+1588004775 GOTO 1035003115
+195000596 GOTO 1825005485
+422001277 GOTO 1295003895
+637001921 LET t = t + 8
+863002599 LET t = t + 13
+248000754 LET t = t + 10
+284000862 LET t = t + 12
+723002180 GOTO 1417004261
+1492004487 GOTO 239000727
+1045003145 LET t = t + 8
+1580004750 LET t = t + 16
+642001936 LET t = t + 13
+1698005105 GOTO 583001759
+1968005915 GOTO 615001855
+606001828 LET t = t + 11
+1330004001 GOTO 1428004294
+899002707 LET t = t + 15
+1755005276 GOTO 1601004813
+240000731 GOTO 850002560
+564001702 LET t = t + 3
+801002414 GOTO 1085003265
+83000259 LET t = t + 15
+979002947 LET t = t + 10
+738002225 GOTO 1765005305
+1623004880 GOTO 800002410
+981002954 GOTO 1571004723
+425001286 GOTO 701002113
+1014003053 GOTO 1861005593
+1471004424 GOTO 1712005146
+1428004294 LET t = t + 0
+530001601 GOTO 592001786
+998003004 LET t = t + 12
+64000203 GOTO 1927005791
+1402004216 LET t = t + 8
+973002930 GOTO 874002632
+443001340 GOTO 1660004990
+769002318 GOTO 665002005
+24000082 LET t = t + 7
+1095003296 GOTO 235000715
+930002800 LET t = t + 12
+1272003826 LET t = t + 14
+1824005483 GOTO 1803005419
+1037003122 GOTO 1944005842
+354001072 LET t = t + 14
+1810005441 GOTO 642001936
+536001618 LET t = t + 9
+1084003262 LET t = t + 13
+90000281 GOTO 1072003226
+401001213 LET t = t + 10
+1432004306 LET t = t + 4
+1828005494 LET t = t + 9
+505001525 LET t = t + 12
+493001489 LET t = t + 0
+1287003872 GOTO 154000472
+703002119 LET t = t + 6
+523001580 GOTO 637001921
+875002636 GOTO 484001462
+1229003697 LET t = t + 5
+133000409 LET t = t + 14
+854002572 LET t = t + 4
+851002564 GOTO 863002599
+397001202 GOTO 564001702
+435001315 LET t = t + 10
+711002143 LET t = t + 14
+972002927 GOTO 1926005788
+1564004702 LET t = t + 0
+1035003115 LET t = t + 15
+1833005509 LET t = t + 14
+1925005786 GOTO 994002992
+1306003928 LET t = t + 14
+998003005 GOTO 1433004309
+1212003646 LET t = t + 5
+1085003265 LET t = t + 14
+878002645 GOTO 1663004999
+135000415 LET t = t + 16
+275000835 LET t = t + 3
+1082003256 LET t = t + 11
+1989005978 GOTO 1490004480
+590001780 LET t = t + 12
+1263003800 GOTO 1466004408
+825002486 GOTO 638001924
+1205003626 GOTO 807002431
+615001856 GOTO 1338004024
+1469004418 GOTO 1219003667
+1846005549 GOTO 1743005239
+455001375 LET t = t + 13
+1284003863 GOTO 137000421
+96000298 LET t = t + 11
+323000979 LET t = t + 0
+1671005024 GOTO 582001756
+1009003038 GOTO 1359004087
+1953005869 LET t = t + 15
+1207003631 LET t = t + 0
+1013003050 GOTO 1544004642
+1256003779 GOTO 500001510
+1743005239 LET t = t + 9
+1377004142 GOTO 1031003103
+41000134 GOTO 720002170
+1039003128 GOTO 422001276
+1765005306 GOTO 1310003940
+1356004079 GOTO 1552004666
+1231003704 GOTO 958002884
+3000020 GOTO 53000169
+1218003664 LET t = t + 11
+847002552 GOTO 1716005158
+1244003743 GOTO 1154003472
+1678005044 LET t = t + 12
+1109003337 LET t = t + 4
+1935005815 LET t = t + 14
+830002501 GOTO 89000277
+1761005294 GOTO 1175003535
+1054003173 GOTO 1104003322
+531001604 GOTO 903002719
+428001295 GOTO 32000106
+622001876 LET t = t + 10
+1971005923 LET t = t + 16
+558001684 LET t = t + 14
+1620004871 GOTO 794002392
+1296003899 GOTO 588001774
+1007003031 LET t = t + 4
+1932005806 LET t = t + 11
+1148003455 GOTO 938002824
+1155003475 LET t = t + 16
+788002375 GOTO 775002335
+685002066 GOTO 1669005017
+571001724 GOTO 1249003757
+1517004561 LET t = t + 4
+1277003842 GOTO 579001747
+568001715 GOTO 327000991
+1970005921 GOTO 228000694
+1027003092 GOTO 969002917
+1496004498 LET t = t + 0
+525001586 GOTO 1696005098
+1451004364 GOTO 1896005698
+746002249 GOTO 306000928
+1195003595 LET t = t + 5
+642001937 GOTO 444001342
+258000784 LET t = t + 3
+1740005230 LET t = t + 6
+130000400 LET t = t + 11
+1866005609 GOTO 1885005665
+1070003220 LET t = t + 16
+1805005425 LET t = t + 3
+1383004159 LET t = t + 6
+334001012 LET t = t + 11
+384001163 GOTO 1392004186
+110000341 GOTO 520001570
+1684005063 GOTO 313000949
+720002171 GOTO 528001594
+348001054 LET t = t + 8
+1959005888 GOTO 634001912
+782002356 LET t = t + 0
+1577004742 GOTO 1760005290
+407001231 LET t = t + 16
+1005003026 GOTO 275000835
+1842005536 LET t = t + 6
+813002449 LET t = t + 14
+1465004406 GOTO 697002101
+263000800 GOTO 1015003055
+1661004993 LET t = t + 12
+1028003094 LET t = t + 8
+1499004508 GOTO 411001243
+1855005575 LET t = t + 2
+1216003659 GOTO 541001633
+1712005147 GOTO 1176003538
+338001024 LET t = t + 15
+297000902 GOTO 858002584
+855002575 LET t = t + 5
+548001654 LET t = t + 4
+1200003611 GOTO 1166003508
+1328003994 LET t = t + 2
+93000290 GOTO 1996005998
+1461004393 LET t = t + 16
+338001025 GOTO 1863005599
+1150003460 LET t = t + 11
+1242003736 LET t = t + 1
+1997006001 LET t = t + 8
+690002080 LET t = t + 10
+469001418 GOTO 402001216
+360001091 GOTO 1874005632
+2100000002 PRINT "total", t
+42000137 GOTO 233000709
+1901005713 LET t = t + 14
+1186003569 GOTO 174000532
+400001210 LET t = t + 9
+1145003446 GOTO 946002848
+1239003727 LET t = t + 15
+793002389 LET t = t + 11
+1637004922 GOTO 1343004039
+1440004330 LET t = t + 12
+1509004538 GOTO 688002074
+151000463 LET t = t + 15
+1750005261 GOTO 76000238
+1424004283 GOTO 1965005905
+1507004532 GOTO 1181003553
+650001960 LET t = t + 4
+67000211 LET t = t + 16
+1138003425 GOTO 1957005881
+1294003893 GOTO 145000445
+1786005368 LET t = t + 1
+544001643 GOTO 1919005767
+1299003907 LET t = t + 7
+897002701 LET t = t + 13
+1455004375 LET t = t + 10
+1995005995 LET t = t + 6
+1099003308 GOTO 986002968
+749002257 LET t = t + 1
+670002021 GOTO 431001303
+1123003380 GOTO 1824005482
+2 REM visited out of order through GOTO
+1276003839 GOTO 856002578
+1558004684 LET t = t + 11
+53000169 LET t = t + 2
+658001984 LET t = t + 12
+1207003632 GOTO 897002701
+1614004852 LET t = t + 16
+1525004585 LET t = t + 12
+164000503 GOTO 1917005761
+806002429 GOTO 894002692
+128000395 GOTO 630001900
+365001106 GOTO 225000685
+1727005191 LET t = t + 10
+1104003323 GOTO 679002047
+1795005395 LET t = t + 10
+1648004954 LET t = t + 16
+1768005314 LET t = t + 0
+1753005269 LET t = t + 2
+1226003688 LET t = t + 2
+675002036 GOTO 1607004831
+621001873 LET t = t + 9
+385001165 LET t = t + 11
+253000769 LET t = t + 15
+872002626 LET t = t + 5
+792002387 GOTO 469001417
+1442004336 LET t = t + 14
+440001331 GOTO 960002890
+858002584 LET t = t + 8
+56000178 LET t = t + 5
+1478004445 GOTO 175000535
+12000046 LET t = t + 12
+1890005680 LET t = t + 3
+118000364 LET t = t + 16
+975002935 LET t = t + 6
+101000314 GOTO 1124003382
+664002003 GOTO 600001810
+212000646 LET t = t + 8
+859002588 GOTO 913002749
+1726005189 GOTO 1335004015
+1617004862 GOTO 736002218
+1931005803 LET t = t + 10
+1609004838 GOTO 512001546
+724002183 GOTO 69000217
+1541004634 GOTO 41000133
+1869005617 LET t = t + 16
+302000917 GOTO 1193003589
+936002818 LET t = t + 1
+4000022 LET t = t + 4
+1517004562 GOTO 966002908
+261000794 GOTO 738002224
+1186003568 LET t = t + 13
+1573004729 LET t = t + 9
+167000511 LET t = t + 14
+1342004036 LET t = t + 16
+1787005371 LET t = t + 2
+1963005900 GOTO 1981005953
+107000331 LET t = t + 5
+1346004048 LET t = t + 3
+151000464 GOTO 312000946
+1249003757 LET t = t + 8
+1395004195 LET t = t + 1
+1798005405 GOTO 770002320
+1560004691 GOTO 822002476
+398001204 LET t = t + 7
+1650004960 LET t = t + 1
+1094003292 LET t = t + 6
+856002579 GOTO 1664005002
+659001987 LET t = t + 13
+1433004309 LET t = t + 5
+844002542 LET t = t + 11
+526001589 GOTO 164000502
+1154003472 LET t = t + 15
+66000209 GOTO 1081003253
+674002032 LET t = t + 11
+619001867 LET t = t + 7
+1897005702 GOTO 114000352
+452001367 GOTO 1389004177
+350001061 GOTO 1464004402
+37000121 LET t = t + 3
+796002398 LET t = t + 14
+434001313 GOTO 22000076
+38000125 GOTO 558001684
+1443004340 GOTO 445001345
+192000587 GOTO 374001132
+1193003590 GOTO 202000616
+1064003203 GOTO 772002326
+1652004967 GOTO 389001177
+748002254 LET t = t + 0
+391001184 GOTO 928002794
+356001079 GOTO 602001816
+1565004705 LET t = t + 1
+289000878 GOTO 60000190
+1952005866 LET t = t + 14
+953002869 LET t = t + 1
+355001076 GOTO 1287003871
+292000886 LET t = t + 3
+1716005159 GOTO 1705005125
+790002380 LET t = t + 8
+1180003551 GOTO 1903005719
+159000487 LET t = t + 6
+1266003809 GOTO 1402004216
+329000997 LET t = t + 6
+1473004429 LET t = t + 11
+597001802 GOTO 1527004591
+105000326 GOTO 872002626
+675002035 LET t = t + 12
+1606004829 GOTO 1160003490
+1976005939 GOTO 1974005932
+925002785 LET t = t + 7
+942002836 LET t = t + 7
+1422004277 GOTO 1220003670
+749002258 GOTO 892002686
+961002893 LET t = t + 9
+1426004288 LET t = t + 15
+1871005623 LET t = t + 1
+1142003437 GOTO 735002215
+1737005221 LET t = t + 3
+1991005984 GOTO 127000391
+1812005447 GOTO 12000046
+1501004514 GOTO 835002515
+1754005272 LET t = t + 3
+1153003469 LET t = t + 14
+744002242 LET t = t + 13
+567001712 GOTO 628001894
+85000265 LET t = t + 0
+1677005041 LET t = t + 11
+215000656 GOTO 1162003496
+754002272 LET t = t + 6
+1101003314 GOTO 1125003385
+1068003215 GOTO 765002305
+1483004460 GOTO 1197003601
+1265003806 GOTO 534001612
+1375004136 GOTO 488001474
+557001681 LET t = t + 13
+124000382 LET t = t + 5
+458001384 LET t = t + 16
+992002987 GOTO 1632004906
+609001838 GOTO 1093003289
+1262003796 LET t = t + 4
+1856005578 LET t = t + 3
+935002816 GOTO 683002059
+1252003767 GOTO 1951005863
+1619004868 GOTO 1540004630
+208000635 GOTO 581001753
+8000035 GOTO 623001879
+1113003350 GOTO 830002500
+795002396 GOTO 337001021
+1396004198 LET t = t + 2
+156000478 LET t = t + 3
+27000092 GOTO 381001153
+782002357 GOTO 1021003073
+1904005723 GOTO 1647004951
+764002302 LET t = t + 16
+393001189 LET t = t + 2
+1703005120 GOTO 1946005848
+1081003253 LET t = t + 10
+394001192 LET t = t + 3
+1321003973 LET t = t + 12
+486001468 LET t = t + 10
+1319003968 GOTO 1189003577
+1234003713 GOTO 226000688
+624001883 GOTO 481001453
+766002308 LET t = t + 1
+1046003149 GOTO 1770005320
+570001720 LET t = t + 9
+1202003617 GOTO 619001867
+1411004244 GOTO 726002188
+1999006008 GOTO 751002263
+1950005860 LET t = t + 12
+139000428 GOTO 978002944
+63000200 GOTO 104000322
+788002374 LET t = t + 6
+402001217 GOTO 1314003952
+351001063 LET t = t + 11
+1682005056 LET t = t + 16
+1393004190 GOTO 1448004354
+910002741 GOTO 325000985
+1614004853 GOTO 1348004054
+823002480 GOTO 646001948
+909002737 LET t = t + 8
+587001771 LET t = t + 9
+775002335 LET t = t + 10
+1666005009 GOTO 1589004777
+682002056 LET t = t + 2
+1108003334 LET t = t + 3
+166000508 LET t = t + 13
+1503004520 GOTO 700002110
+1364004103 GOTO 1271003823
+840002530 LET t = t + 7
+82000256 LET t = t + 14
+38000124 LET t = t + 4
+1566004709 GOTO 614001852
+1344004042 LET t = t + 1
+1276003838 LET t = t + 1
+1403004219 LET t = t + 9
+1578004744 LET t = t + 14
+1857005582 GOTO 660001990
+1868005614 LET t = t + 15
+953002870 GOTO 1257003781
+163000499 LET t = t + 10
+1954005873 GOTO 1477004441
+1690005080 LET t = t + 7
+512001546 LET t = t + 2
+299000908 GOTO 345001045
+1269003817 LET t = t + 11
+586001768 LET t = t + 8
+631001903 LET t = t + 2
+294000893 GOTO 911002743
+776002339 GOTO 290000880
+554001672 LET t = t + 10
+1277003841 LET t = t + 2
+914002752 LET t = t + 13
+11000044 GOTO 197000601
+1487004472 GOTO 332001006
+416001259 GOTO 258000784
+519001567 LET t = t + 9
+1353004070 GOTO 667002011
+1251003764 GOTO 1261003793
+1643004939 LET t = t + 11
+1238003725 GOTO 443001339
+644001943 GOTO 1303003919
+668002015 GOTO 1049003157
+259000788 GOTO 1250003760
+1601004814 GOTO 357001081
+1133003409 LET t = t + 11
+1707005131 LET t = t + 7
+1187003571 LET t = t + 14
+46000149 GOTO 449001357
+330001000 LET t = t + 7
+696002098 LET t = t + 16
+1151003463 LET t = t + 12
+1611004844 GOTO 591001783
+1184003562 LET t = t + 11
+89000278 GOTO 1859005587
+1484004462 LET t = t + 5
+566001708 LET t = t + 5
+1439004328 GOTO 268000814
+1657004981 LET t = t + 8
+963002900 GOTO 1424004282
+540001630 LET t = t + 13
+683002060 GOTO 1412004246
+128000394 LET t = t + 9
+98000305 GOTO 1710005140
+155000475 LET t = t + 2
+876002638 LET t = t + 9
+300000911 GOTO 35000115
+1262003797 GOTO 439001327
+1355004075 LET t = t + 12
+570001721 GOTO 1492004486
+850002561 GOTO 972002926
+1932005807 GOTO 1699005107
+255000775 LET t = t + 0
+1715005156 GOTO 786002368
+1052003167 GOTO 1717005161
+1465004405 LET t = t + 3
+467001411 LET t = t + 8
+45000145 LET t = t + 11
+1637004921 LET t = t + 5
+1295003896 GOTO 151000463
+217000662 GOTO 1551004663
+853002569 LET t = t + 3
+560001690 LET t = t + 16
+1751005263 LET t = t + 0
+1938005825 GOTO 1098003304
+732002206 LET t = t + 1
+1885005665 LET t = t + 15
+129000398 GOTO 1837005521
+1043003139 LET t = t + 6
+1251003763 LET t = t + 10
+251000764 GOTO 1413004249
+763002300 GOTO 479001447
+1225003686 GOTO 810002440
+1656004978 LET t = t + 7
+584001763 GOTO 548001654
+731002204 GOTO 55000175
+39000127 LET t = t + 5
+171000523 LET t = t + 1
+1392004186 LET t = t + 15
+1654004973 GOTO 326000988
+637001922 GOTO 1334004012
+607001832 GOTO 1784005362
+858002585 GOTO 546001648
+1665005005 LET t = t + 16
+967002911 LET t = t + 15
+566001709 GOTO 1292003886
+840002531 GOTO 1591004783
+1435004316 GOTO 1061003193
+774002333 GOTO 1695005095
+1317003962 GOTO 612001846
+1064003202 LET t = t + 10
+936002819 GOTO 1183003559
+1847005552 GOTO 1190003580
+1024003083 GOTO 317000961
+1783005359 LET t = t + 15
+1585004766 GOTO 383001159
+1611004843 LET t = t + 13
+569001717 LET t = t + 8
+510001541 GOTO 125000385
+34000113 GOTO 985002965
+421001274 GOTO 84000262
+278000845 GOTO 350001060
+1225003685 LET t = t + 1
+634001912 LET t = t + 5
+437001321 LET t = t + 12
+1919005768 GOTO 891002683
+1523004579 LET t = t + 10
+322000977 GOTO 248000754
+1135003416 GOTO 1272003826
+1416004258 LET t = t + 5
+580001751 GOTO 1723005179
+938002825 GOTO 1377004141
+1680005050 LET t = t + 14
+1053003170 GOTO 595001795
+333001010 GOTO 1997006001
+984002963 GOTO 1395004195
+1634004912 LET t = t + 2
+304000923 GOTO 750002260
+487001471 LET t = t + 11
+560001691 GOTO 707002131
+1829005498 GOTO 1719005167
+143000440 GOTO 440001330
+1077003242 GOTO 491001483
+1431004303 LET t = t + 3
+1827005491 LET t = t + 8
+1077003241 LET t = t + 6
+1822005476 LET t = t + 3
+236000719 GOTO 408001234
+1259003788 GOTO 1451004363
+598001805 GOTO 1916005758
+142000437 GOTO 320000970
+101000313 LET t = t + 16
+1564004703 GOTO 1812005446
+493001490 GOTO 585001765
+1157003482 GOTO 308000934
+1981005953 LET t = t + 9
+460001390 LET t = t + 1
+1988005974 LET t = t + 16
+1839005528 GOTO 722002176
+947002852 GOTO 815002455
+1782005356 LET t = t + 14
+239000727 LET t = t + 1
+304000922 LET t = t + 15
+1511004543 LET t = t + 15
+1990005981 GOTO 1772005326
+1407004232 GOTO 1514004552
+919002767 LET t = t + 1
+1801005414 GOTO 1789005377
+368001115 GOTO 152000466
+1250003761 GOTO 1323003979
+26000088 LET t = t + 9
+665002006 GOTO 1468004414
+846002549 GOTO 927002791
+1873005630 GOTO 1140003430
+1175003536 GOTO 539001627
+358001085 GOTO 1239003727
+1097003301 LET t = t + 9
+1449004357 LET t = t + 4
+299000907 LET t = t + 10
+733002209 LET t = t + 2
+1412004246 LET t = t + 1
+1415004255 LET t = t + 4
+1062003197 GOTO 1930005800
+137000422 GOTO 1582004756
+1591004784 GOTO 1613004849
+1420004271 GOTO 14000052
+1925005785 LET t = t + 4
+649001958 GOTO 1073003229
+552001667 GOTO 1539004627
+1162003496 LET t = t + 6
+1721005174 GOTO 1994005992
+408001234 LET t = t + 0
+1876005639 GOTO 1262003796
+172000526 LET t = t + 2
+1675005035 LET t = t + 9
+1464004402 LET t = t + 2
+550001660 LET t = t + 6
+28000095 GOTO 269000817
+95000295 LET t = t + 10
+802002416 LET t = t + 3
+767002311 LET t = t + 2
+1892005687 GOTO 747002251
+630001900 LET t = t + 1
+1223003680 GOTO 788002374
+695002095 LET t = t + 15
+1515004556 GOTO 1588004774
+95000296 GOTO 562001696
+119000368 GOTO 467001411
+875002635 LET t = t + 8
+1242003737 GOTO 1397004201
+235000715 LET t = t + 14
+1322003976 LET t = t + 13
+1007003032 GOTO 943002839
+77000242 GOTO 1614004852
+974002932 LET t = t + 5
+561001693 LET t = t + 0
+1534004613 GOTO 1164003502
+1488004474 LET t = t + 9
+678002044 LET t = t + 15
+1899005707 LET t = t + 12
+1587004772 GOTO 578001744
+541001633 LET t = t + 14
+1360004090 LET t = t + 0
+997003002 GOTO 1099003307
+1369004117 LET t = t + 9
+1869005618 GOTO 574001732
+1279003848 GOTO 936002818
+1581004754 GOTO 324000982
+583001759 LET t = t + 5
+888002674 LET t = t + 4
+1042003137 GOTO 590001780
+1482004457 GOTO 30000100
+1020003070 LET t = t + 0
+1872005626 LET t = t + 2
+1036003119 GOTO 1674005032
+1602004816 LET t = t + 4
+591001783 LET t = t + 13
+1946005848 LET t = t + 8
+1416004259 GOTO 1337004021
+842002537 GOTO 818002464
+1736005219 GOTO 1263003799
+1342004037 GOTO 1253003769
+1336004019 GOTO 1349004057
+1254003772 LET t = t + 13
+1903005720 GOTO 92000286
+1653004970 GOTO 914002752
+1128003395 GOTO 343001039
+396001199 GOTO 1214003652
+484001463 GOTO 1513004549
+462001397 GOTO 1813005449
+598001804 LET t = t + 3
+1947005852 GOTO 1133003409
+17000062 GOTO 1793005389
+1712005146 LET t = t + 12
+130000401 GOTO 1398004204
+1185003566 GOTO 416001258
+1769005317 LET t = t + 1
+1724005182 LET t = t + 7
+107000332 GOTO 742002236
+1543004640 GOTO 1289003877
+392001186 LET t = t + 1
+262000797 GOTO 1777005341
+618001864 LET t = t + 6
+942002837 GOTO 1648004954
+227000691 LET t = t + 6
+1937005821 LET t = t + 16
+849002558 GOTO 1821005473
+1435004315 LET t = t + 7
+756002279 GOTO 1976005938
+500001510 LET t = t + 7
+867002612 GOTO 873002629
+1076003239 GOTO 1232003706
+1693005090 GOTO 386001168
+214000653 GOTO 403001219
+1890005681 GOTO 1455004375
+735002216 GOTO 651001963
+331001004 GOTO 244000742
+582001756 LET t = t + 4
+837002521 LET t = t + 4
+1237003722 GOTO 1312003946
+590001781 GOTO 1003003019
+202000616 LET t = t + 15
+1221003674 GOTO 369001117
+1867005612 GOTO 88000274
+218000664 LET t = t + 14
+714002153 GOTO 362001096
+1384004162 LET t = t + 7
+1542004636 LET t = t + 12
+1144003442 LET t = t + 5
+1291003884 GOTO 1509004537
+182000556 LET t = t + 12
+220000671 GOTO 62000196
+1105003325 LET t = t + 0
+779002348 GOTO 1054003172
+659001988 GOTO 695002095
+1600004811 GOTO 774002332
+1192003586 LET t = t + 2
+518001565 GOTO 90000280
+1268003814 LET t = t + 10
+1003003020 GOTO 94000292
+520001570 LET t = t + 10
+1333004010 GOTO 1744005242
+611001844 GOTO 334001012
+321000974 GOTO 108000334
+1117003362 GOTO 1868005614
+439001327 LET t = t + 14
+1377004141 LET t = t + 0
+388001174 LET t = t + 14
+212000647 GOTO 17000061
+1960005891 GOTO 1047003151
+1756005278 LET t = t + 5
+704002123 GOTO 645001945
+1048003154 LET t = t + 11
+296000898 LET t = t + 7
+1512004547 GOTO 1150003460
+932002807 GOTO 768002314
+1693005089 LET t = t + 10
+534001613 GOTO 1182003556
+944002842 LET t = t + 9
+1854005573 GOTO 9000037
+1349004057 LET t = t + 6
+1523004580 GOTO 209000637
+918002764 LET t = t + 0
+869002617 LET t = t + 2
+1738005224 LET t = t + 4
+691002084 GOTO 348001054
+741002234 GOTO 1089003277
+270000820 LET t = t + 15
+647001952 GOTO 868002614
+955002875 LET t = t + 3
+332001007 GOTO 538001624
+529001598 GOTO 1814005452
+205000626 GOTO 1768005314
+25000086 GOTO 801002413
+1641004933 LET t = t + 9
+1521004574 GOTO 782002356
+420001270 LET t = t + 12
+827002491 LET t = t + 11
+145000445 LET t = t + 9
+977002941 LET t = t + 8
+236000718 LET t = t + 15
+30000100 LET t = t + 13
+238000725 GOTO 442001336
+281000854 GOTO 643001939
+1515004555 LET t = t + 2
+1454004372 LET t = t + 9
+1345004045 LET t = t + 2
+976002939 GOTO 1524004582
+1708005135 GOTO 728002194
+622001877 GOTO 1456004378
+1200003610 LET t = t + 10
+441001333 LET t = t + 16
+1238003724 LET t = t + 14
+1522004576 LET t = t + 9
+3000019 LET t = t + 3
+1446004348 LET t = t + 1
+922002777 GOTO 580001750
+1458004384 LET t = t + 13
+397001201 LET t = t + 6
+1490004480 LET t = t + 11
+87000271 LET t = t + 2
+766002309 GOTO 727002191
+651001963 LET t = t + 5
+588001774 LET t = t + 10
+1009003037 LET t = t + 6
+374001132 LET t = t + 0
+765002305 LET t = t + 0
+1170003520 LET t = t + 14
+408001235 GOTO 1833005509
+1576004739 GOTO 21000073
+1583004759 LET t = t + 2
+790002381 GOTO 1573004729
+501001513 LET t = t + 8
+1994005992 LET t = t + 5
+577001742 GOTO 798002404
+1777005341 LET t = t + 9
+789002378 GOTO 204000622
+1954005872 LET t = t + 16
+753002269 LET t = t + 5
+1443004339 LET t = t + 15
+104000322 LET t = t + 2
+106000329 GOTO 1180003550
+958002884 LET t = t + 6
+612001846 LET t = t + 0
+224000683 GOTO 122000376
+1874005632 LET t = t + 4
+926002789 GOTO 1546004648
+1176003538 LET t = t + 3
+948002855 GOTO 641001933
+1072003227 GOTO 737002221
+879002647 LET t = t + 12
+1481004454 GOTO 1725005185
+138000424 LET t = t + 2
+1121003374 GOTO 1759005287
+1678005045 GOTO 513001549
+1179003548 GOTO 171000523
+833002510 GOTO 840002530
+939002828 GOTO 1378004144
+1675005036 GOTO 58000184
+1381004153 LET t = t + 4
+818002465 GOTO 740002230
+956002879 GOTO 816002458
+1189003577 LET t = t + 16
+1832005507 GOTO 331001003
+395001195 LET t = t + 4
+947002851 LET t = t + 12
+1340004030 LET t = t + 14
+1185003565 LET t = t + 12
+1955005876 GOTO 1269003817
+1760005291 GOTO 1467004411
+707002131 LET t = t + 10
+1038003124 LET t = t + 1
+1485004465 LET t = t + 6
+181000554 GOTO 418001264
+817002461 LET t = t + 1
+520001571 GOTO 1845005545
+320000971 GOTO 185000565
+459001387 LET t = t + 0
+691002083 LET t = t + 11
+15000056 GOTO 1493004489
+1781005353 LET t = t + 13
+557001682 GOTO 1856005578
+614001852 LET t = t + 2
+1025003086 GOTO 674002032
+577001741 LET t = t + 16
+1673005029 LET t = t + 7
+18000064 LET t = t + 1
+111000344 GOTO 1876005638
+403001220 GOTO 198000604
+1188003575 GOTO 709002137
+604001822 LET t = t + 9
+289000877 LET t = t + 0
+581001753 LET t = t + 3
+1979005948 GOTO 384001162
+1823005479 LET t = t + 4
+478001444 LET t = t + 2
+832002507 GOTO 34000112
+1967005911 LET t = t + 12
+1324003983 GOTO 50000160
+1996005999 GOTO 278000844
+1092003287 GOTO 1691005083
+243000739 LET t = t + 5
+41000133 LET t = t + 7
+1702005117 GOTO 1554004672
+1895005696 GOTO 1889005677
+317000961 LET t = t + 11
+524001583 GOTO 1403004219
+984002962 LET t = t + 15
+815002456 GOTO 1419004267
+114000353 GOTO 1698005104
+686002069 GOTO 270000820
+295000895 LET t = t + 6
+274000833 GOTO 1128003394
+405001225 LET t = t + 14
+1086003269 GOTO 128000394
+1351004063 LET t = t + 8
+1140003431 GOTO 955002875
+1092003286 LET t = t + 4
+592001786 LET t = t + 14
+916002758 LET t = t + 15
+1391004184 GOTO 1383004159
+1095003295 LET t = t + 7
+405001226 GOTO 806002428
+726002188 LET t = t + 12
+144000443 GOTO 1920005770
+252000767 GOTO 1569004717
+1942005836 LET t = t + 4
+563001699 LET t = t + 2
+593001789 LET t = t + 15
+614001853 GOTO 1208003634
+1683005060 GOTO 458001384
+303000919 LET t = t + 14
+1101003313 LET t = t + 13
+1908005734 LET t = t + 4
+1308003935 GOTO 1545004645
+1091003284 GOTO 1491004483
+470001420 LET t = t + 11
+574001732 LET t = t + 13
+319000968 GOTO 1807005431
+714002152 LET t = t + 0
+1518004565 GOTO 1790005380
+353001069 LET t = t + 13
+940002831 GOTO 820002470
+1210003641 GOTO 1441004333
+1861005594 GOTO 1955005875
+1492004486 LET t = t + 13
+891002684 GOTO 1877005641
+343001040 GOTO 1365004105
+537001621 LET t = t + 10
+933002809 LET t = t + 15
+838002525 GOTO 1279003847
+266000808 LET t = t + 11
+1618004864 LET t = t + 3
+324000983 GOTO 1530004600
+273000830 GOTO 1370004120
+342001037 GOTO 199000607
+1679005047 LET t = t + 13
+1877005641 LET t = t + 7
+1211003643 LET t = t + 4
+1782005357 GOTO 1449004357
+336001018 LET t = t + 13
+1711005144 GOTO 318000964
+626001888 LET t = t + 14
+1470004420 LET t = t + 8
+1184003563 GOTO 74000232
+774002332 LET t = t + 9
+1717005161 LET t = t + 0
+1545004646 GOTO 673002029
+481001454 GOTO 224000682
+1699005107 LET t = t + 16
+1288003874 LET t = t + 13
+366001108 LET t = t + 9
+920002770 LET t = t + 2
+228000694 LET t = t + 7
+1147003451 LET t = t + 8
+86000268 LET t = t + 1
+1853005569 LET t = t + 0
+1378004144 LET t = t + 1
+1457004381 LET t = t + 12
+919002768 GOTO 1079003247
+1291003883 LET t = t + 16
+1042003136 LET t = t + 5
+1164003503 GOTO 423001279
+1774005332 LET t = t + 6
+1264003802 LET t = t + 6
+356001078 LET t = t + 16
+270000821 GOTO 1411004243
+1798005404 LET t = t + 13
+451001363 LET t = t + 9
+65000205 LET t = t + 14
+1039003127 LET t = t + 2
+409001237 LET t = t + 1
+1336004018 LET t = t + 10
+1620004870 LET t = t + 5
+809002437 LET t = t + 10
+14000053 GOTO 1042003136
+1548004655 GOTO 236000718
+564001703 GOTO 441001333
+992002986 LET t = t + 6
+821002474 GOTO 1210003640
+877002641 LET t = t + 10
+1176003539 GOTO 1706005128
+1153003470 GOTO 1865005605
+1397004201 LET t = t + 3
+693002090 GOTO 495001495
+863002600 GOTO 941002833
+855002576 GOTO 1594004792
+996002998 LET t = t + 10
+752002267 GOTO 1168003514
+225000685 LET t = t + 4
+810002441 GOTO 1434004312
+118000365 GOTO 1736005218
+914002753 GOTO 1612004846
+692002086 LET t = t + 12
+709002138 GOTO 1682005056
+210000640 LET t = t + 6
+211000644 GOTO 1499004507
+1456004379 GOTO 214000652
+729002197 LET t = t + 15
+1846005548 LET t = t + 10
+1455004376 GOTO 1999006007
+1763005300 GOTO 1599004807
+950002861 GOTO 1408004234
+1628004895 GOTO 691002083
+298000904 LET t = t + 9
+207000632 GOTO 792002386
+384001162 LET t = t + 10
+966002909 GOTO 1452004366
+862002597 GOTO 1609004837
+414001253 GOTO 420001270
+1887005672 GOTO 1637004921
+23000080 GOTO 976002938
+1373004129 LET t = t + 13
+1565004706 GOTO 147000451
+1942005837 GOTO 1227003691
+881002653 LET t = t + 14
+1819005467 LET t = t + 0
+885002665 LET t = t + 1
+492001487 GOTO 287000871
+787002371 LET t = t + 5
+1398004204 LET t = t + 4
+610001841 GOTO 1430004300
+1125003385 LET t = t + 3
+402001216 LET t = t + 11
+1642004936 LET t = t + 10
+559001687 LET t = t + 15
+1691005084 GOTO 649001957
+1993005990 GOTO 1964005902
+1821005474 GOTO 1299003907
+1297003901 LET t = t + 5
+372001127 GOTO 1259003787
+169000517 LET t = t + 16
+1224003682 LET t = t + 0
+1382004156 LET t = t + 5
+124000383 GOTO 693002089
+1508004534 LET t = t + 12
+1098003304 LET t = t + 10
+822002476 LET t = t + 6
+1780005350 LET t = t + 12
+1758005284 LET t = t + 7
+730002200 LET t = t + 16
+343001039 LET t = t + 3
+1040003130 LET t = t + 3
+1713005150 GOTO 509001537
+407001232 GOTO 1703005119
+166000509 GOTO 508001534
+499001508 GOTO 1012003046
+1065003206 GOTO 1110003340
+1709005137 LET t = t + 9
+431001304 GOTO 1820005470
+748002255 GOTO 19000067
+661001994 GOTO 1799005407
+1087003271 LET t = t + 16
+1305003926 GOTO 1739005227
+1406004228 LET t = t + 12
+702002117 GOTO 1537004621
+376001139 GOTO 1318003964
+698002105 GOTO 1884005662
+530001600 LET t = t + 3
+1201003614 GOTO 1409004237
+324000982 LET t = t + 1
+73000229 LET t = t + 5
+640001930 LET t = t + 11
+1687005071 LET t = t + 4
+108000334 LET t = t + 6
+1204003623 GOTO 1324003982
+1348004055 GOTO 46000148
+1570004720 LET t = t + 6
+1149003457 LET t = t + 10
+1585004765 LET t = t + 4
+1299003908 GOTO 121000373
+581001754 GOTO 1028003094
+362001096 LET t = t + 5
+1552004666 LET t = t + 5
+916002759 GOTO 1137003421
+1502004517 GOTO 793002389
+1437004322 GOTO 1791005383
+1268003815 GOTO 1350004060
+1327003991 LET t = t + 1
+551001663 LET t = t + 7
+620001871 GOTO 1204003622
+1984005963 GOTO 1342004036
+1872005627 GOTO 274000832
+84000263 GOTO 1010003040
+1422004276 LET t = t + 11
+372001126 LET t = t + 15
+1337004021 LET t = t + 11
+1800005410 LET t = t + 15
+1670005020 LET t = t + 4
+687002071 LET t = t + 7
+253000770 GOTO 1427004291
+278000844 LET t = t + 6
+1021003073 LET t = t + 1
+1519004567 LET t = t + 6
+1789005378 GOTO 1619004867
+490001480 LET t = t + 14
+217000661 LET t = t + 13
+406001229 GOTO 473001429
+643001939 LET t = t + 14
+982002957 GOTO 1086003268
+412001247 GOTO 1057003181
+1830005500 LET t = t + 11
+350001060 LET t = t + 10
+335001015 LET t = t + 12
+391001183 LET t = t + 0
+753002270 GOTO 179000547
+143000439 LET t = t + 7
+1430004300 LET t = t + 2
+1006003028 LET t = t + 3
+90000280 LET t = t + 5
+755002275 LET t = t + 7
+923002779 LET t = t + 5
+1814005452 LET t = t + 12
+1147003452 GOTO 1606004828
+491001483 LET t = t + 15
+1094003293 GOTO 1431004303
+937002822 GOTO 1715005155
+280000850 LET t = t + 8
+1655004975 LET t = t + 6
+331001003 LET t = t + 8
+1700005111 GOTO 497001501
+1667005011 LET t = t + 1
+902002716 LET t = t + 1
+1010003041 GOTO 342001036
+941002833 LET t = t + 6
+657001982 GOTO 1910005740
+1786005369 GOTO 1152003466
+1000003011 GOTO 1080003250
+54000173 GOTO 888002674
+645001946 GOTO 1559004687
+1493004489 LET t = t + 14
+1161003493 LET t = t + 5
+113000349 LET t = t + 11
+1088003274 LET t = t + 0
+1012003047 GOTO 277000841
+1338004024 LET t = t + 12
+1150003461 GOTO 1393004189
+1813005449 LET t = t + 11
+131000404 GOTO 1163003499
+1933005810 GOTO 1970005920
+1556004679 GOTO 1832005506
+1430004301 GOTO 1870005620
+1004003023 GOTO 999003007
+1886005669 GOTO 1748005254
+399001207 LET t = t + 8
+1887005671 LET t = t + 0
+1959005887 LET t = t + 4
+87000272 GOTO 1256003778
+911002744 GOTO 1041003133
+1546004648 LET t = t + 16
+551001664 GOTO 834002512
+255000776 GOTO 952002866
+1577004741 LET t = t + 13
+377001141 LET t = t + 3
+1215003656 GOTO 10000040
+791002384 GOTO 1280003850
+16000058 LET t = t + 16
+905002725 LET t = t + 4
+313000949 LET t = t + 7
+747002252 GOTO 629001897
+653001969 LET t = t + 7
+269000818 GOTO 419001267
+1339004027 LET t = t + 13
+218000665 GOTO 573001729
+1812005446 LET t = t + 10
+1369004118 GOTO 855002575
+205000625 LET t = t + 1
+1958005885 GOTO 463001399
+1083003260 GOTO 954002872
+223000679 LET t = t + 2
+141000434 GOTO 1891005683
+1527004592 GOTO 451001363
+592001787 GOTO 1670005020
+125000385 LET t = t + 6
+1038003125 GOTO 1893005689
+178000545 GOTO 532001606
+1522004577 GOTO 869002617
+1310003941 GOTO 1786005368
+1849005558 GOTO 959002887
+917002762 GOTO 1697005101
+712002146 LET t = t + 15
+1923005779 LET t = t + 2
+603001820 GOTO 1929005797
+1267003811 LET t = t + 9
+1146003449 GOTO 1498004504
+878002644 LET t = t + 11
+1748005254 LET t = t + 14
+465001405 LET t = t + 6
+1001003014 GOTO 25000085
+481001453 LET t = t + 5
+189000577 LET t = t + 2
+1148003454 LET t = t + 9
+1679005048 GOTO 1096003298
+249000758 GOTO 1007003031
+1328003995 GOTO 1826005488
+1155003476 GOTO 1111003343
+979002948 GOTO 1668005014
+731002203 LET t = t + 0
+1056003179 GOTO 1879005647
+136000418 LET t = t + 0
+33000109 LET t = t + 16
+1544004643 GOTO 1640004930
+1705005125 LET t = t + 5
+1351004064 GOTO 73000229
+247000751 LET t = t + 9
+928002795 GOTO 1045003145
+1840005531 GOTO 1685005065
+307000932 GOTO 1459004387
+780002351 GOTO 146000448
+436001319 GOTO 1583004759
+903002720 GOTO 232000706
+1529004597 LET t = t + 16
+934002813 GOTO 45000145
+1414004252 LET t = t + 3
+1044003142 LET t = t + 7
+488001474 LET t = t + 12
+154000473 GOTO 1469004417
+1734005212 LET t = t + 0
+617001861 LET t = t + 5
+1151003464 GOTO 366001108
+1804005422 LET t = t + 2
+230000701 GOTO 1246003748
+1852005567 GOTO 899002707
+375001135 LET t = t + 1
+1759005287 LET t = t + 8
+1051003163 LET t = t + 14
+197000601 LET t = t + 10
+1423004279 LET t = t + 12
+150000461 GOTO 249000757
+1458004385 GOTO 1734005212
+1154003473 GOTO 1023003079
+1902005716 LET t = t + 15
+1254003773 GOTO 1082003256
+1641004934 GOTO 184000562
+241000733 LET t = t + 3
+1965005905 LET t = t + 10
+358001084 LET t = t + 1
+1362004097 GOTO 1368004114
+961002894 GOTO 117000361
+495001495 LET t = t + 2
+890002681 GOTO 1450004360
+1702005116 LET t = t + 2
+1591004783 LET t = t + 10
+1722005177 GOTO 1794005392
+1400004210 LET t = t + 6
+1331004004 GOTO 492001486
+506001529 GOTO 1487004471
+1610004840 LET t = t + 12
+254000773 GOTO 59000187
+671002023 LET t = t + 8
+62000196 LET t = t + 11
+836002518 LET t = t + 3
+1364004102 LET t = t + 4
+1491004483 LET t = t + 12
+717002161 LET t = t + 3
+1858005585 GOTO 829002497
+1569004717 LET t = t + 5
+1107003331 LET t = t + 2
+473001429 LET t = t + 14
+417001261 LET t = t + 9
+852002566 LET t = t + 2
+1924005782 LET t = t + 3
+1053003169 LET t = t + 16
+556001679 GOTO 260000790
+232000707 GOTO 1243003739
+1278003844 LET t = t + 3
+542001636 LET t = t + 15
+1166003509 GOTO 1005003025
+688002074 LET t = t + 8
+1574004732 LET t = t + 10
+740002231 GOTO 1340004030
+1220003670 LET t = t + 13
+413001249 LET t = t + 5
+179000547 LET t = t + 9
+752002266 LET t = t + 4
+127000391 LET t = t + 8
+378001144 LET t = t + 4
+1000003010 LET t = t + 14
+1754005273 GOTO 917002761
+716002158 LET t = t + 2
+1539004627 LET t = t + 9
+799002408 GOTO 1074003232
+794002392 LET t = t + 12
+1079003247 LET t = t + 8
+432001306 LET t = t + 7
+1029003098 GOTO 16000058
+456001379 GOTO 1165003505
+1475004435 LET t = t + 13
+339001028 GOTO 456001378
+762002297 GOTO 134000412
+305000925 LET t = t + 16
+1343004040 GOTO 1386004168
+196000599 GOTO 896002698
+687002072 GOTO 749002257
+446001348 LET t = t + 4
+899002708 GOTO 339001027
+443001339 LET t = t + 1
+208000634 LET t = t + 4
+954002873 GOTO 531001603
+1339004028 GOTO 1676005038
+644001942 LET t = t + 15
+313000950 GOTO 1229003697
+877002642 GOTO 351001063
+5000025 LET t = t + 5
+1661004994 GOTO 188000574
+1780005351 GOTO 177000541
+1188003574 LET t = t + 15
+1182003557 GOTO 1198003604
+318000964 LET t = t + 12
+445001345 LET t = t + 3
+1747005251 LET t = t + 13
+952002866 LET t = t + 0
+689002078 GOTO 861002593
+1604004822 LET t = t + 6
+1201003613 LET t = t + 11
+515001556 GOTO 712002146
+1325003986 GOTO 1322003976
+2000016 LET t = t + 2
+607001831 LET t = t + 12
+77000241 LET t = t + 9
+1509004537 LET t = t + 13
+575001736 GOTO 608001834
+1404004222 LET t = t + 10
+1746005249 GOTO 1763005299
+1524004583 GOTO 1701005113
+1801005413 LET t = t + 16
+290000880 LET t = t + 1
+1111003344 GOTO 540001630
+890002680 LET t = t + 6
+1109003338 GOTO 1887005671
+1864005602 LET t = t + 11
+1916005758 LET t = t + 12
+1817005462 GOTO 71000223
+1429004297 LET t = t + 1
+750002260 LET t = t + 2
+1347004052 GOTO 577001741
+1395004196 GOTO 1144003442
+741002233 LET t = t + 10
+1608004835 GOTO 1480004450
+228000695 GOTO 1626004888
+126000389 GOTO 1179003547
+173000529 LET t = t + 3
+613001849 LET t = t + 1
+624001882 LET t = t + 12
+1930005800 LET t = t + 9
+73000230 GOTO 1078003244
+1285003866 GOTO 962002896
+973002929 LET t = t + 4
+320000970 LET t = t + 14
+1939005827 LET t = t + 1
+1412004247 GOTO 1145003445
+1114003352 LET t = t + 9
+1252003766 LET t = t + 11
+1091003283 LET t = t + 3
+1301003914 GOTO 1924005782
+1195003596 GOTO 544001642
+1269003818 GOTO 827002491
+1361004093 LET t = t + 1
+476001438 LET t = t + 0
+580001750 LET t = t + 2
+81000254 GOTO 696002098
+175000535 LET t = t + 5
+1810005440 LET t = t + 8
+1719005167 LET t = t + 2
+334001013 GOTO 1366004108
+1708005134 LET t = t + 8
+61000194 GOTO 1878005644
+1145003445 LET t = t + 6
+1859005587 LET t = t + 6
+811002443 LET t = t + 12
+671002024 GOTO 1752005266
+726002189 GOTO 1013003049
+1023003079 LET t = t + 3
+1030003100 LET t = t + 10
+1663005000 GOTO 390001180
+1909005737 LET t = t + 5
+1749005258 GOTO 1977005941
+1733005210 GOTO 1629004897
+1427004292 GOTO 1985005965
+370001121 GOTO 889002677
+31000103 LET t = t + 14
+1771005323 LET t = t + 3
+1662004996 LET t = t + 13
+1271003824 GOTO 572001726
+1016003059 GOTO 1661004993
+19000067 LET t = t + 2
+275000836 GOTO 1390004180
+906002729 GOTO 942002836
+83000260 GOTO 307000931
+966002908 LET t = t + 14
+849002557 LET t = t + 16
+505001526 GOTO 1336004018
+648001954 LET t = t + 2
+1752005266 LET t = t + 1
+1474004433 GOTO 836002518
+1047003151 LET t = t + 10
+876002639 GOTO 1209003637
+525001585 LET t = t + 15
+1973005930 GOTO 1548004654
+61000193 LET t = t + 10
+1547004652 GOTO 731002203
+1927005791 LET t = t + 6
+1229003698 GOTO 785002365
+658001985 GOTO 8000034
+629001897 LET t = t + 0
+259000787 LET t = t + 4
+371001124 GOTO 723002179
+519001568 GOTO 1173003529
+864002602 LET t = t + 14
+653001970 GOTO 143000439
+1656004979 GOTO 446001348
+1167003512 GOTO 1888005674
+1826005488 LET t = t + 7
+1723005180 GOTO 1517004561
+174000532 LET t = t + 4
+386001169 GOTO 1391004183
+180000550 LET t = t + 10
+1191003583 LET t = t + 1
+655001976 GOTO 83000259
+1683005059 LET t = t + 0
+1500004511 GOTO 1094003292
+1878005645 GOTO 1325003985
+138000425 GOTO 1038003124
+1916005759 GOTO 743002239
+615001855 LET t = t + 3
+1386004168 LET t = t + 9
+943002840 GOTO 887002671
+421001273 LET t = t + 13
+1071003224 GOTO 1550004660
+777002342 GOTO 1001003013
+576001739 GOTO 75000235
+1213003649 LET t = t + 6
+883002660 GOTO 1600004810
+1884005663 GOTO 799002407
+1741005233 LET t = t + 7
+1803005420 GOTO 410001240
+1356004078 LET t = t + 13
+927002791 LET t = t + 9
+874002633 GOTO 1194003592
+1562004697 GOTO 949002857
+1714005153 GOTO 1595004795
+1381004154 GOTO 139000427
+1463004400 GOTO 620001870
+975002936 GOTO 468001414
+779002347 LET t = t + 14
+584001762 LET t = t + 6
+1930005801 GOTO 1708005134
+45000146 GOTO 1755005275
+295000896 GOTO 1092003286
+1698005104 LET t = t + 15
+1941005834 GOTO 1758005284
+171000524 GOTO 1894005692
+689002077 LET t = t + 9
+516001558 LET t = t + 6
+1112003346 LET t = t + 7
+1061003193 LET t = t + 7
+989002977 LET t = t + 3
+1526004589 GOTO 110000340
+1248003754 LET t = t + 7
+891002683 LET t = t + 7
+1131003404 GOTO 1304003922
+932002806 LET t = t + 14
+547001652 GOTO 1501004513
+456001378 LET t = t + 14
+1799005408 GOTO 1100003310
+1470004421 GOTO 825002485
+1476004439 GOTO 648001954
+935002815 LET t = t + 0
+1735005216 GOTO 1043003139
+582001757 GOTO 659001987
+1621004874 GOTO 487001471
+48000155 GOTO 904002722
+1506004529 GOTO 7000031
+1689005077 LET t = t + 6
+1271003823 LET t = t + 13
+459001388 GOTO 376001138
+1399004208 GOTO 1121003373
+1103003320 GOTO 859002587
+881002654 GOTO 787002371
+182000557 GOTO 757002281
+964002902 LET t = t + 12
+1397004202 GOTO 1536004618
+1516004558 LET t = t + 3
+53000170 GOTO 1122003376
+121000374 GOTO 739002227
+1237003721 LET t = t + 13
+1771005324 GOTO 186000568
+226000689 GOTO 569001717
+999003008 GOTO 758002284
+346001049 GOTO 1720005170
+626001889 GOTO 1788005374
+1411004243 LET t = t + 0
+1359004088 GOTO 316000958
+1701005113 LET t = t + 1
+1849005557 LET t = t + 13
+1327003992 GOTO 1827005491
+718002165 GOTO 882002656
+1181003554 GOTO 1907005731
+1218003665 GOTO 1251003763
+47000152 GOTO 1617004861
+1968005914 LET t = t + 13
+1612004847 GOTO 1131003403
+1366004109 GOTO 241000733
+836002519 GOTO 1174003532
+1280003851 GOTO 593001789
+1376004138 LET t = t + 16
+997003001 LET t = t + 11
+1756005279 GOTO 417001261
+84000262 LET t = t + 16
+1900005711 GOTO 150000460
+1303003920 GOTO 1883005659
+435001316 GOTO 367001111
+353001070 GOTO 414001252
+1927005792 GOTO 1091003283
+71000223 LET t = t + 3
+941002834 GOTO 1960005890
+1467004412 GOTO 549001657
+1543004639 LET t = t + 13
+1843005540 GOTO 991002983
+129000397 LET t = t + 10
+465001406 GOTO 781002353
+20000070 LET t = t + 3
+804002422 LET t = t + 5
+1419004268 GOTO 1006003028
+1929005798 GOTO 159000487
+373001129 LET t = t + 16
+633001910 GOTO 1331004003
+1080003251 GOTO 1713005149
+1928005795 GOTO 1330004000
+706002128 LET t = t + 9
+1622004876 LET t = t + 7
+1221003673 LET t = t + 14
+1561004694 GOTO 1311003943
+56000179 GOTO 916002758
+265000805 LET t = t + 10
+694002093 GOTO 1186003568
+1871005624 GOTO 1801005413
+1217003661 LET t = t + 10
+1761005293 LET t = t + 10
+46000148 LET t = t + 12
+494001493 GOTO 968002914
+345001045 LET t = t + 5
+1923005780 GOTO 1222003676
+417001262 GOTO 1689005077
+1676005039 GOTO 515001555
+576001738 LET t = t + 15
+1579004748 GOTO 1410004240
+1533004610 GOTO 622001876
+593001790 GOTO 238000724
+1216003658 LET t = t + 9
+386001168 LET t = t + 12
+595001796 GOTO 1225003685
+1512004546 LET t = t + 16
+80000250 LET t = t + 12
+892002687 GOTO 31000103
+1159003488 GOTO 237000721
+1130003401 GOTO 79000247
+784002363 GOTO 1115003355
+1504004522 LET t = t + 8
+773002329 LET t = t + 8
+1723005179 LET t = t + 6
+1987005971 LET t = t + 15
+1293003889 LET t = t + 1
+1113003349 LET t = t + 8
+1608004834 LET t = t + 10
+1975005935 LET t = t + 3
+1199003608 GOTO 1553004669
+1542004637 GOTO 1590004780
+1125003386 GOTO 915002755
+1951005863 LET t = t + 13
+201000613 LET t = t + 14
+1625004885 LET t = t + 10
+1981005954 GOTO 1352004066
+1399004207 LET t = t + 5
+1107003332 GOTO 1317003961
+698002104 LET t = t + 1
+190000581 GOTO 1804005422
+1816005458 LET t = t + 14
+1429004298 GOTO 724002182
+859002587 LET t = t + 9
+52000167 GOTO 1215003655
+480001451 GOTO 1961005893
+1738005225 GOTO 36000118
+1248003755 GOTO 86000268
+884002662 LET t = t + 0
+751002264 GOTO 1118003364
+536001619 GOTO 1738005224
+23000079 LET t = t + 6
+1181003553 LET t = t + 8
+1784005362 LET t = t + 16
+816002458 LET t = t + 0
+807002432 GOTO 1567004711
+148000454 LET t = t + 12
+797002402 GOTO 1238003724
+1239003728 GOTO 10
+1463004399 LET t = t + 1
+1326003989 GOTO 1727005191
+423001279 LET t = t + 15
+74000233 GOTO 1024003082
+348001055 GOTO 300000910
+925002786 GOTO 1694005092
+1563004700 GOTO 1237003721
+126000388 LET t = t + 7
+21000073 LET t = t + 4
+1902005717 GOTO 195000595
+967002912 GOTO 1823005479
+1498004505 GOTO 1780005350
+1651004964 GOTO 39000127
+496001499 GOTO 1529004597
+254000772 LET t = t + 16
+845002545 LET t = t + 12
+1894005693 GOTO 231000703
+579001748 GOTO 1932005806
+1532004607 GOTO 1004003022
+180000551 GOTO 1628004894
+1161003494 GOTO 304000922
+909002738 GOTO 1381004153
+1772005327 GOTO 776002338
+811002444 GOTO 1129003397
+246000748 LET t = t + 8
+901002714 GOTO 1240003730
+1907005732 GOTO 1737005221
+97000302 GOTO 191000583
+499001507 LET t = t + 6
+1418004265 GOTO 413001249
+1297003902 GOTO 1358004084
+553001670 GOTO 1461004393
+1065003205 LET t = t + 11
+422001276 LET t = t + 14
+831002504 GOTO 721002173
+800002411 GOTO 1990005980
+184000562 LET t = t + 14
+1434004312 LET t = t + 6
+688002075 GOTO 983002959
+123000380 GOTO 271000823
+1247003752 GOTO 87000271
+1368004115 GOTO 1560004690
+603001819 LET t = t + 8
+1921005773 LET t = t + 0
+987002972 GOTO 405001225
+89000277 LET t = t + 4
+1457004382 GOTO 519001567
+803002419 LET t = t + 4
+1945005846 GOTO 67000211
+1998006005 GOTO 718002164
+600001811 GOTO 253000769
+732002207 GOTO 1221003673
+1538004624 LET t = t + 8
+1263003799 LET t = t + 5
+489001478 GOTO 631001903
+1704005123 GOTO 1945005845
+1830005501 GOTO 107000331
+387001171 LET t = t + 13
+262000796 LET t = t + 7
+1104003322 LET t = t + 16
+1626004888 LET t = t + 11
+172000527 GOTO 1270003820
+1362004096 LET t = t + 2
+1219003667 LET t = t + 12
+1727005192 GOTO 363001099
+1210003640 LET t = t + 3
+1817005461 LET t = t + 15
+1764005303 GOTO 1488004474
+1096003299 GOTO 333001009
+27000091 LET t = t + 10
+431001303 LET t = t + 6
+1321003974 GOTO 1290003880
+15000055 LET t = t + 15
+502001517 GOTO 285000865
+92000287 GOTO 1369004117
+448001354 LET t = t + 6
+148000455 GOTO 1643004939
+1315003956 GOTO 1922005776
+330001001 GOTO 109000337
+1646004948 LET t = t + 14
+517001562 GOTO 655001975
+1791005383 LET t = t + 6
+1553004670 GOTO 1562004696
+1001003013 LET t = t + 15
+1313003950 GOTO 1654004972
+1772005326 LET t = t + 4
+1882005657 GOTO 172000526
+1240003731 GOTO 668002014
+943002839 LET t = t + 8
+795002395 LET t = t + 13
+1489004477 LET t = t + 10
+558001685 GOTO 1787005371
+7000032 GOTO 552001666
+1521004573 LET t = t + 8
+1768005315 GOTO 1842005536
+268000815 GOTO 1200003610
+949002858 GOTO 1543004639
+316000959 GOTO 356001078
+485001465 LET t = t + 9
+639001927 LET t = t + 10
+531001603 LET t = t + 4
+681002053 LET t = t + 1
+302000916 LET t = t + 13
+1527004591 LET t = t + 14
+620001870 LET t = t + 8
+746002248 LET t = t + 15
+1820005470 LET t = t + 1
+398001205 GOTO 428001294
+572001726 LET t = t + 11
+1732005207 GOTO 155000475
+546001649 GOTO 791002383
+276000839 GOTO 1657004981
+1122003377 GOTO 685002065
+1947005851 LET t = t + 9
+1629004898 GOTO 1662004996
+200000611 GOTO 1636004918
+667002012 GOTO 358001084
+1886005668 LET t = t + 16
+896002699 GOTO 953002869
+1126003388 LET t = t + 4
+699002108 GOTO 759002287
+1462004396 LET t = t + 0
+1593004790 GOTO 1783005359
+1279003847 LET t = t + 4
+1777005342 GOTO 373001129
+1213003650 GOTO 1510004540
+321000973 LET t = t + 15
+1157003481 LET t = t + 1
+1617004861 LET t = t + 2
+310000941 GOTO 1798005404
+1163003499 LET t = t + 7
+1318003965 GOTO 1881005653
+1720005170 LET t = t + 3
+1826005489 GOTO 1618004864
+1912005746 LET t = t + 8
+463001399 LET t = t + 4
+1957005882 GOTO 1416004258
+37000122 GOTO 63000199
+1961005893 LET t = t + 6
+1799005407 LET t = t + 14
+65000206 GOTO 370001120
+1311003944 GOTO 425001285
+300000910 LET t = t + 11
+555001676 GOTO 178000544
+116000359 GOTO 1578004744
+643001940 GOTO 940002830
+638001925 GOTO 1052003166
+26000089 GOTO 1869005617
+1390004181 GOTO 120000370
+1396004199 GOTO 1327003991
+1175003535 LET t = t + 2
+528001594 LET t = t + 1
+761002294 GOTO 1030003100
+1934005812 LET t = t + 13
+1586004768 LET t = t + 5
+1855005576 GOTO 99000307
+632001906 LET t = t + 3
+357001082 GOTO 295000895
+1842005537 GOTO 102000316
+1480004451 GOTO 1363004099
+418001265 GOTO 460001390
+1314003953 GOTO 1852005566
+1298003904 LET t = t + 6
+1304003923 GOTO 140000430
+1956005878 LET t = t + 1
+1621004873 LET t = t + 6
+352001066 LET t = t + 12
+1691005083 LET t = t + 8
+1865005605 LET t = t + 12
+1190003581 GOTO 753002269
+1825005485 LET t = t + 6
+1407004231 LET t = t + 13
+351001064 GOTO 176000538
+930002801 GOTO 974002932
+625001885 LET t = t + 13
+1862005597 GOTO 407001231
+1197003602 GOTO 1275003835
+1304003922 LET t = t + 12
+1554004672 LET t = t + 7
+1759005288 GOTO 1565004705
+1751005264 GOTO 948002854
+1103003319 LET t = t + 15
+123000379 LET t = t + 4
+861002594 GOTO 291000883
+989002978 GOTO 1993005989
+1586004769 GOTO 1943005839
+509001538 GOTO 15000055
+68000214 LET t = t + 0
+1068003214 LET t = t + 14
+922002776 LET t = t + 4
+216000658 LET t = t + 12
+867002611 LET t = t + 0
+1519004568 GOTO 1418004264
+556001678 LET t = t + 12
+1052003166 LET t = t + 15
+1654004972 LET t = t + 5
+175000536 GOTO 596001798
+1995005996 GOTO 1245003745
+1722005176 LET t = t + 5
+1863005600 GOTO 427001291
+1071003223 LET t = t + 0
+1090003280 LET t = t + 2
+1386004169 GOTO 909002737
+471001423 LET t = t + 12
+565001706 GOTO 981002953
+1310003940 LET t = t + 1
+1572004726 LET t = t + 8
+762002296 LET t = t + 14
+1033003110 GOTO 733002209
+158000485 GOTO 1184003562
+559001688 GOTO 516001558
+847002551 LET t = t + 14
+438001324 LET t = t + 13
+1944005843 GOTO 1170003520
+86000269 GOTO 70000220
+60000190 LET t = t + 9
+1000014 GOTO 1921005773
+885002666 GOTO 100000310
+385001166 GOTO 1457004381
+1129003397 LET t = t + 7
+55000175 LET t = t + 4
+1856005579 GOTO 584001762
+993002989 LET t = t + 7
+991002984 GOTO 1987005971
+978002944 LET t = t + 9
+871002623 LET t = t + 4
+1400004211 GOTO 372001126
+1388004174 LET t = t + 11
+1896005698 LET t = t + 9
+1208003634 LET t = t + 1
+681002054 GOTO 1605004825
+1692005087 GOTO 1500004510
+198000604 LET t = t + 11
+437001322 GOTO 1446004348
+121000373 LET t = t + 2
+1329003998 GOTO 752002266
+1610004841 GOTO 1983005959
+1209003638 GOTO 1414004252
+1828005495 GOTO 1940005830
+701002113 LET t = t + 4
+387001172 GOTO 1103003319
+601001813 LET t = t + 6
+830002500 LET t = t + 14
+874002632 LET t = t + 7
+328000994 LET t = t + 5
+543001640 GOTO 303000919
+1806005429 GOTO 586001768
+202000617 GOTO 149000457
+1863005599 LET t = t + 10
+1893005689 LET t = t + 6
+177000541 LET t = t + 7
+335001016 GOTO 4000022
+1531004604 GOTO 77000241
+1913005749 LET t = t + 9
+1603004819 LET t = t + 5
+325000985 LET t = t + 2
+808002434 LET t = t + 9
+1158003484 LET t = t + 2
+158000484 LET t = t + 5
+1557004681 LET t = t + 10
+1827005492 GOTO 1658004984
+448001355 GOTO 1384004162
+40000131 GOTO 1260003790
+1948005855 GOTO 1677005041
+964002903 GOTO 1265003805
+1688005075 GOTO 522001576
+1413004249 LET t = t + 2
+1425004286 GOTO 561001693
+955002876 GOTO 819002467
+713002150 GOTO 344001042
+234000712 LET t = t + 13
+497001502 GOTO 804002422
+627001892 GOTO 264000802
+1658004985 GOTO 1065003205
+1437004321 LET t = t + 9
+1627004892 GOTO 1252003766
+504001522 LET t = t + 11
+1540004630 LET t = t + 10
+474001432 LET t = t + 15
+954002872 LET t = t + 2
+1392004187 GOTO 91000283
+1259003787 LET t = t + 1
+912002747 GOTO 385001165
+149000457 LET t = t + 13
+597001801 LET t = t + 2
+1951005864 GOTO 1002003016
+1292003887 GOTO 1453004369
+285000865 LET t = t + 13
+113000350 GOTO 257000781
+52000166 LET t = t + 1
+389001177 LET t = t + 15
+59000187 LET t = t + 8
+1762005297 GOTO 284000862
+432001307 GOTO 1968005914
+720002170 LET t = t + 6
+1578004745 GOTO 885002665
+472001426 LET t = t + 13
+1174003533 GOTO 805002425
+482001456 LET t = t + 6
+1915005756 GOTO 1360004090
+20000071 GOTO 1196003598
+226000688 LET t = t + 5
+1835005516 GOTO 984002962
+453001370 GOTO 1442004336
+856002578 LET t = t + 6
+1880005651 GOTO 206000628
+1724005183 GOTO 1399004207
+229000697 LET t = t + 8
+1257003782 GOTO 1344004042
+1057003182 GOTO 1872005626
+1824005482 LET t = t + 5
+80000251 GOTO 1681005053
+814002452 LET t = t + 15
+1373004130 GOTO 1060003190
+1569004718 GOTO 944002842
+308000935 GOTO 1984005962
+1568004715 GOTO 533001609
+1334004012 LET t = t + 8
+1130003400 LET t = t + 8
+718002164 LET t = t + 4
+1285003865 LET t = t + 10
+1146003448 LET t = t + 7
+327000991 LET t = t + 4
+552001666 LET t = t + 8
+475001436 GOTO 663001999
+1333004009 LET t = t + 7
+429001298 GOTO 890002680
+745002245 LET t = t + 14
+1825005486 GOTO 784002362
+1467004411 LET t = t + 5
+574001733 GOTO 379001147
+894002692 LET t = t + 10
+969002917 LET t = t + 0
+1448004354 LET t = t + 3
+605001826 GOTO 779002347
+1615004856 GOTO 1308003934
+825002485 LET t = t + 9
+623001879 LET t = t + 11
+861002593 LET t = t + 11
+281000853 LET t = t + 9
+1436004319 GOTO 1726005188
+370001120 LET t = t + 13
+183000560 GOTO 1908005734
+628001895 GOTO 517001561
+1567004712 GOTO 1858005584
+1674005032 LET t = t + 8
+51000163 LET t = t + 0
+1556004678 LET t = t + 9
+497001501 LET t = t + 4
+450001360 LET t = t + 8
+1919005767 LET t = t + 15
+828002495 GOTO 1673005029
+1734005213 GOTO 294000892
+662001997 GOTO 1109003337
+1232003707 GOTO 1283003859
+743002239 LET t = t + 12
+1056003178 LET t = t + 2
+181000553 LET t = t + 11
+1710005141 GOTO 129000397
+641001934 GOTO 924002782
+1464004403 GOTO 1692005086
+960002891 GOTO 1014003052
+1257003781 LET t = t + 16
+826002489 GOTO 477001441
+223000680 GOTO 1300003910
+1116003359 GOTO 106000328
+920002771 GOTO 1532004606
+1372004126 LET t = t + 12
+1645004946 GOTO 130000400
+206000629 GOTO 1244003742
+1603004820 GOTO 1465004405
+225000686 GOTO 715002155
+252000766 LET t = t + 14
+1049003157 LET t = t + 12
+1378004145 GOTO 1429004297
+1962005897 GOTO 1580004750
+952002867 GOTO 133000409
+1344004043 GOTO 499001507
+1041003133 LET t = t + 4
+1800005411 GOTO 1521004573
+667002011 LET t = t + 4
+1975005936 GOTO 744002242
+1063003199 LET t = t + 9
+1960005890 LET t = t + 5
+24000083 GOTO 1533004609
+870002621 GOTO 1864005602
+1228003695 GOTO 54000172
+418001264 LET t = t + 10
+1582004757 GOTO 551001663
+1341004034 GOTO 1936005818
+708002135 GOTO 196000598
+837002522 GOTO 1000003010
+1797005402 GOTO 1953005869
+532001607 GOTO 1954005872
+673002030 GOTO 844002542
+1904005722 LET t = t + 0
+1944005842 LET t = t + 6
+185000565 LET t = t + 15
+1790005380 LET t = t + 5
+1118003364 LET t = t + 13
+157000481 LET t = t + 4
+7000031 LET t = t + 7
+819002468 GOTO 967002911
+1022003077 GOTO 1070003220
+447001352 GOTO 399001207
+549001658 GOTO 778002344
+55000176 GOTO 839002527
+1697005101 LET t = t + 14
+1447004351 LET t = t + 2
+1813005450 GOTO 26000088
+599001808 GOTO 1805005425
+912002746 LET t = t + 11
+1177003541 LET t = t + 4
+1915005755 LET t = t + 11
+843002540 GOTO 705002125
+1338004025 GOTO 1871005623
+1922005776 LET t = t + 1
+199000607 LET t = t + 12
+1172003527 GOTO 266000808
+1714005152 LET t = t + 14
+962002897 GOTO 761002293
+474001433 GOTO 132000406
+273000829 LET t = t + 1
+613001850 GOTO 1387004171
+523001579 LET t = t + 13
+1486004468 LET t = t + 7
+1024003082 LET t = t + 4
+1555004675 LET t = t + 8
+517001561 LET t = t + 7
+1235003715 LET t = t + 11
+186000569 GOTO 1051003163
+1137003421 LET t = t + 15
+1860005591 GOTO 1422004276
+750002261 GOTO 501001513
+1370004121 GOTO 746002248
+760002291 GOTO 170000520
+969002918 GOTO 557001681
+1558004685 GOTO 1027003091
+532001606 LET t = t + 5
+1308003934 LET t = t + 16
+1231003703 LET t = t + 7
+1704005122 LET t = t + 4
+1837005521 LET t = t + 1
+721002174 GOTO 434001312
+1596004799 GOTO 901002713
+430001300 LET t = t + 5
+898002704 LET t = t + 14
+439001328 GOTO 672002026
+729002198 GOTO 480001450
+498001504 LET t = t + 5
+503001520 GOTO 1586004768
+629001898 GOTO 1018003064
+700002110 LET t = t + 3
+1278003845 GOTO 838002524
+1616004858 LET t = t + 1
+908002735 GOTO 1986005968
+913002749 LET t = t + 12
+803002420 GOTO 1055003175
+288000875 GOTO 13000049
+1725005186 GOTO 780002350
+1680005051 GOTO 353001069
+13000050 GOTO 474001432
+1206003628 LET t = t + 16
+1857005581 LET t = t + 4
+865002606 GOTO 741002233
+1929005797 LET t = t + 8
+1469004417 LET t = t + 7
+1479004448 GOTO 42000136
+69000217 LET t = t + 1
+1174003532 LET t = t + 1
+1905005726 GOTO 1447004351
+1579004747 LET t = t + 15
+1737005222 GOTO 52000166
+316000958 LET t = t + 10
+1368004114 LET t = t + 8
+1627004891 LET t = t + 12
+990002980 LET t = t + 4
+755002276 GOTO 848002554
+264000802 LET t = t + 9
+815002455 LET t = t + 16
+851002563 LET t = t + 1
+81000253 LET t = t + 13
+1066003208 LET t = t + 12
+1767005311 LET t = t + 16
+761002293 LET t = t + 13
+1669005017 LET t = t + 3
+1067003212 GOTO 368001114
+829002498 GOTO 979002947
+1699005108 GOTO 1075003235
+1851005563 LET t = t + 15
+214000652 LET t = t + 10
+1601004813 LET t = t + 3
+1507004531 LET t = t + 11
+1985005965 LET t = t + 13
+1196003598 LET t = t + 6
+1537004622 GOTO 1728005194
+870002620 LET t = t + 3
+139000427 LET t = t + 3
+413001250 GOTO 597001801
+1032003106 LET t = t + 12
+1417004261 LET t = t + 6
+1917005762 GOTO 503001519
+1632004907 GOTO 803002419
+904002723 GOTO 606001828
+1371004124 GOTO 1882005656
+1575004736 GOTO 860002590
+1302003916 LET t = t + 10
+1214003652 LET t = t + 7
+1933005809 LET t = t + 12
+1105003326 GOTO 1688005074
+1934005813 GOTO 1542004636
+367001111 LET t = t + 10
+841002534 GOTO 796002398
+1570004721 GOTO 156000478
+311000943 LET t = t + 5
+656001978 LET t = t + 10
+1073003229 LET t = t + 2
+533001609 LET t = t + 6
+1514004552 LET t = t + 1
+646001948 LET t = t + 0
+1602004817 GOTO 393001189
+491001484 GOTO 1860005590
+247000752 GOTO 1202003616
+1544004642 LET t = t + 14
+434001312 LET t = t + 9
+241000734 GOTO 598001804
+344001043 GOTO 1828005494
+850002560 LET t = t + 0
+1350004060 LET t = t + 7
+1298003905 GOTO 211000643
+832002506 LET t = t + 16
+1575004735 LET t = t + 11
+361001093 LET t = t + 4
+1822005477 GOTO 280000850
+980002951 GOTO 1234003712
+1796005398 LET t = t + 11
+257000782 GOTO 1579004747
+555001675 LET t = t + 11
+799002407 LET t = t + 0
+1209003637 LET t = t + 2
+669002018 GOTO 124000382
+907002731 LET t = t + 6
+945002846 GOTO 251000763
+269000817 LET t = t + 14
+578001745 GOTO 297000901
+1270003820 LET t = t + 12
+176000538 LET t = t + 6
+1040003131 GOTO 3000019
+1335004016 GOTO 93000289
+995002996 GOTO 854002572
+33000110 GOTO 131000403
+573001730 GOTO 1819005467
+1845005545 LET t = t + 9
+484001462 LET t = t + 8
+1217003662 GOTO 1849005557
+1477004442 GOTO 676002038
+1398004205 GOTO 336001018
+965002906 GOTO 1435004315
+6000028 LET t = t + 6
+1689005078 GOTO 1979005947
+987002971 LET t = t + 1
+996002999 GOTO 1191003583
+103000319 LET t = t + 1
+292000887 GOTO 713002149
+290000881 GOTO 1212003646
+959002888 GOTO 1649004957
+234000713 GOTO 1774005332
+1008003034 LET t = t + 5
+1473004430 GOTO 1958005884
+1789005377 LET t = t + 4
+900002711 GOTO 1806005428
+982002956 LET t = t + 13
+132000407 GOTO 1357004081
+926002788 LET t = t + 8
+1230003701 GOTO 767002311
+1623004879 LET t = t + 8
+929002798 GOTO 1309003937
+1559004687 LET t = t + 12
+860002590 LET t = t + 10
+1324003982 LET t = t + 15
+1880005650 LET t = t + 10
+715002156 GOTO 910002740
+176000539 GOTO 1816005458
+165000506 GOTO 975002935
+963002899 LET t = t + 11
+1290003880 LET t = t + 15
+298000905 GOTO 1068003214
+539001627 LET t = t + 12
+572001727 GOTO 281000853
+1034003112 LET t = t + 14
+1169003518 GOTO 1749005257
+1483004459 LET t = t + 4
+1424004282 LET t = t + 13
+1681005054 GOTO 68000214
+127000392 GOTO 809002437
+674002033 GOTO 1745005245
+102000316 LET t = t + 0
+433001309 LET t = t + 8
+1502004516 LET t = t + 6
+608001835 GOTO 1364004102
+500001511 GOTO 1230003700
+513001550 GOTO 1328003994
+1149003458 GOTO 1123003379
+960002890 LET t = t + 8
+235000716 GOTO 322000976
+441001334 GOTO 1667005011
+147000451 LET t = t + 11
+549001657 LET t = t + 5
+978002945 GOTO 878002644
+1992005987 GOTO 1693005089
+1757005281 LET t = t + 6
+94000292 LET t = t + 9
+1832005506 LET t = t + 13
+1690005081 GOTO 1056003178
+628001894 LET t = t + 16
+1047003152 GOTO 1077003241
+1250003760 LET t = t + 9
+88000275 GOTO 877002641
+359001087 LET t = t + 2
+1877005642 GOTO 1939005827
+91000283 LET t = t + 6
+141000433 LET t = t + 5
+1159003487 LET t = t + 3
+1082003257 GOTO 1138003424
+1224003683 GOTO 136000418
+839002528 GOTO 832002506
+764002303 GOTO 1161003493
+1911005743 LET t = t + 7
+703002120 GOTO 1516004558
+1227003692 GOTO 66000208
+1374004133 GOTO 400001210
+1312003946 LET t = t + 3
+381001153 LET t = t + 7
+808002435 GOTO 995002995
+1137003422 GOTO 862002596
+426001288 LET t = t + 1
+467001412 GOTO 111000343
+654001972 LET t = t + 8
+1168003515 GOTO 65000205
+1966005908 LET t = t + 11
+1193003589 LET t = t + 3
+164000502 LET t = t + 11
+1098003305 GOTO 766002308
+1478004444 LET t = t + 16
+1179003547 LET t = t + 6
+1649004957 LET t = t + 0
+266000809 GOTO 1577004741
+2100000001 IF p < 200 THEN 5
+527001592 GOTO 1915005755
+533001610 GOTO 1634004912
+1451004363 LET t = t + 6
+1051003164 GOTO 907002731
+685002065 LET t = t + 5
+377001142 GOTO 123000379
+469001417 LET t = t + 10
+1303003919 LET t = t + 11
+618001865 GOTO 119000367
+865002605 LET t = t + 15
+1550004661 GOTO 812002446
+962002896 LET t = t + 10
+1914005752 LET t = t + 10
+36000119 GOTO 302000916
+1535004615 LET t = t + 5
+601001814 GOTO 616001858
+838002524 LET t = t + 5
+1450004361 GOTO 1866005608
+1897005701 LET t = t + 10
+1171003523 LET t = t + 15
+1640004930 LET t = t + 8
+188000575 GOTO 293000889
+177000542 GOTO 56000178
+488001475 GOTO 576001738
+296000899 GOTO 118000364
+155000476 GOTO 161000493
+426001289 GOTO 977002941
+487001472 GOTO 879002647
+291000884 GOTO 1928005794
+1132003406 LET t = t + 10
+1861005593 LET t = t + 8
+1937005822 GOTO 1385004165
+669002017 LET t = t + 6
+1376004139 GOTO 797002401
+1600004810 LET t = t + 2
+461001394 GOTO 1401004213
+1910005741 GOTO 459001387
+1948005854 LET t = t + 10
+498001505 GOTO 1236003718
+1393004189 LET t = t + 16
+194000593 GOTO 790002380
+1044003143 GOTO 1169003517
+1097003302 GOTO 881002653
+115000356 GOTO 1302003916
+1709005138 GOTO 1485004465
+1059003188 GOTO 230000700
+773002330 GOTO 478001444
+179000548 GOTO 1836005518
+1049003158 GOTO 163000499
+1596004798 LET t = t + 15
+368001114 LET t = t + 11
+1669005018 GOTO 1802005416
+1432004307 GOTO 1714005152
+940002830 LET t = t + 5
+1744005243 GOTO 421001273
+414001252 LET t = t + 6
+328000995 GOTO 1071003223
+734002212 LET t = t + 3
+652001966 LET t = t + 6
+314000952 LET t = t + 8
+59000188 GOTO 1132003406
+1067003211 LET t = t + 13
+137000421 LET t = t + 1
+976002938 LET t = t + 7
+1045003146 GOTO 1120003370
+142000436 LET t = t + 6
+1870005621 GOTO 906002728
+1189003578 GOTO 396001198
+36000118 LET t = t + 2
+1844005542 LET t = t + 8
+1598004805 GOTO 627001891
+444001343 GOTO 607001831
+1922005777 GOTO 1436004318
+1850005560 LET t = t + 14
+727002192 GOTO 1631004903
+1286003869 GOTO 1722005176
+1249003758 GOTO 1855005575
+1124003382 LET t = t + 2
+852002567 GOTO 330001000
+184000563 GOTO 189000577
+1938005824 LET t = t + 0
+1427004291 LET t = t + 16
+915002756 GOTO 553001669
+617001862 GOTO 1376004138
+921002773 LET t = t + 3
+1357004082 GOTO 1064003202
+1911005744 GOTO 1808005434
+666002008 LET t = t + 3
+623001880 GOTO 1037003121
+1774005333 GOTO 1044003142
+454001372 LET t = t + 12
+702002116 LET t = t + 5
+1468004415 GOTO 1119003367
+938002824 LET t = t + 3
+616001858 LET t = t + 4
+361001094 GOTO 1650004960
+3 LET p = 0
+388001175 GOTO 555001675
+401001214 GOTO 1925005785
+291000883 LET t = t + 2
+425001285 LET t = t + 0
+1589004777 LET t = t + 8
+1664005002 LET t = t + 15
+301000914 GOTO 621001873
+112000346 LET t = t + 10
+1844005543 GOTO 613001849
+812002446 LET t = t + 13
+724002182 LET t = t + 10
+917002761 LET t = t + 16
+900002710 LET t = t + 16
+524001582 LET t = t + 14
+153000469 LET t = t + 0
+22000077 GOTO 1394004192
+831002503 LET t = t + 15
+306000928 LET t = t + 0
+1203003619 LET t = t + 13
+641001933 LET t = t + 12
+1088003275 GOTO 755002275
+713002149 LET t = t + 16
+1318003964 LET t = t + 9
+204000622 LET t = t + 0
+934002812 LET t = t + 16
+896002698 LET t = t + 12
+1815005456 GOTO 1445004345
+1590004781 GOTO 1313003949
+115000355 LET t = t + 13
+1584004763 GOTO 212000646
+1503004519 LET t = t + 7
+1226003689 GOTO 1873005629
+1563004699 LET t = t + 16
+100000311 GOTO 734002212
+190000580 LET t = t + 3
+1717005162 GOTO 762002296
+1215003655 LET t = t + 8
+436001318 LET t = t + 11
+1347004051 LET t = t + 4
+1191003584 GOTO 1029003097
+739002228 GOTO 305000925
+75000235 LET t = t + 7
+1814005453 GOTO 1009003037
+627001891 LET t = t + 15
+332001006 LET t = t + 9
+768002315 GOTO 1776005338
+1004003022 LET t = t + 1
+1230003700 LET t = t + 6
+394001193 GOTO 398001204
+1860005590 LET t = t + 7
+79000248 GOTO 169000517
+1687005072 GOTO 436001318
+631001904 GOTO 1142003436
+751002263 LET t = t + 3
+1658004984 LET t = t + 9
+18000065 GOTO 617001861
+310000940 LET t = t + 4
+416001258 LET t = t + 8
+51000164 GOTO 662001996
+1144003443 GOTO 1615004855
+1795005396 GOTO 670002020
+1818005464 LET t = t + 16
+1256003778 LET t = t + 15
+1607004831 LET t = t + 9
+889002678 GOTO 1316003958
+824002483 GOTO 604001822
+1584004762 LET t = t + 3
+135000416 GOTO 1296003898
+818002464 LET t = t + 2
+11 GOTO 875002635
+1300003910 LET t = t + 8
+1055003176 GOTO 380001150
+1498004504 LET t = t + 2
+470001421 GOTO 589001777
+759002287 LET t = t + 11
+1552004667 GOTO 51000163
+1834005512 LET t = t + 15
+1449004358 GOTO 43000139
+1758005285 GOTO 886002668
+1894005692 LET t = t + 7
+489001477 LET t = t + 13
+1453004369 LET t = t + 8
+1775005335 LET t = t + 7
+1612004846 LET t = t + 14
+527001591 LET t = t + 0
+677002042 GOTO 1130003400
+245000745 LET t = t + 7
+1624004882 LET t = t + 9
+1537004621 LET t = t + 7
+1956005879 GOTO 1107003331
+419001268 GOTO 867002611
+242000737 GOTO 563001699
+1461004394 GOTO 1729005197
+1787005372 GOTO 180000550
+1818005465 GOTO 359001087
+1006003029 GOTO 1918005764
+1672005026 LET t = t + 6
+1136003419 GOTO 771002323
+1029003097 LET t = t + 9
+1725005185 LET t = t + 8
+462001396 LET t = t + 3
+715002155 LET t = t + 1
+85000266 GOTO 965002905
+1272003827 GOTO 78000244
+1718005165 GOTO 245000745
+1644004942 LET t = t + 12
+68000215 GOTO 1892005686
+1167003511 LET t = t + 11
+1635004915 LET t = t + 3
+783002360 GOTO 1326003988
+322000976 LET t = t + 16
+1978005944 LET t = t + 6
+411001243 LET t = t + 3
+345001046 GOTO 1462004396
+721002173 LET t = t + 7
+1439004327 LET t = t + 11
+1301003913 LET t = t + 9
+911002743 LET t = t + 10
+1638004925 GOTO 219000667
+1080003250 LET t = t + 9
+389001178 GOTO 1512004546
+1241003733 LET t = t + 0
+1100003311 GOTO 1156003478
+483001460 GOTO 1380004150
+1459004388 GOTO 990002980
+1246003749 GOTO 426001288
+1962005896 LET t = t + 7
+1592004786 LET t = t + 11
+1387004171 LET t = t + 10
+1496004499 GOTO 1581004753
+1232003706 LET t = t + 8
+1089003277 LET t = t + 1
+1087003272 GOTO 1282003856
+274000832 LET t = t + 2
+383001160 GOTO 310000940
+1896005699 GOTO 1764005302
+1106003328 LET t = t + 1
+1282003857 GOTO 1288003874
+192000586 LET t = t + 5
+1505004526 GOTO 1473004429
+309000938 GOTO 1016003058
+1158003485 GOTO 1585004765
+1845005546 GOTO 1690005080
+1390004180 LET t = t + 13
+277000842 GOTO 1707005131
+1731005204 GOTO 1508004534
+1401004214 GOTO 1233003709
+1433004310 GOTO 135000415
+58000184 LET t = t + 7
+145000446 GOTO 554001672
+785002365 LET t = t + 3
+608001834 LET t = t + 13
+1452004367 GOTO 594001792
+1322003977 GOTO 1008003034
+1017003061 LET t = t + 14
+1156003478 LET t = t + 0
+160000491 GOTO 817002461
+10 LET t = t + 0
+1202003616 LET t = t + 12
+829002497 LET t = t + 13
+1781005354 GOTO 1880005650
+105000325 LET t = t + 3
+219000668 GOTO 401001213
+562001697 GOTO 1992005986
+399001208 GOTO 415001255
+1234003712 LET t = t + 10
+972002926 LET t = t + 3
+959002887 LET t = t + 7
+1315003955 LET t = t + 6
+1666005008 LET t = t + 0
+216000659 GOTO 1564004702
+1997006002 GOTO 1482004456
+1349004058 GOTO 5000025
+66000208 LET t = t + 15
+1572004727 GOTO 1155003475
+661001993 LET t = t + 15
+1555004676 GOTO 511001543
+347001052 GOTO 1995005995
+1793005390 GOTO 470001420
+440001330 LET t = t + 15
+258000785 GOTO 964002902
+1031003103 LET t = t + 11
+1337004022 GOTO 360001090
+898002705 GOTO 669002017
+147000452 GOTO 937002821
+116000358 LET t = t + 14
+1992005986 LET t = t + 3
+786002368 LET t = t + 4
+96000299 GOTO 1458004384
+717002162 GOTO 1135003415
+1703005119 LET t = t + 3
+13000049 LET t = t + 13
+473001430 GOTO 1502004516
+1468004414 LET t = t + 6
+1808005434 LET t = t + 6
+1002003017 GOTO 1598004804
+554001673 GOTO 702002116
+100000310 LET t = t + 15
+1788005375 GOTO 1126003388
+864002603 GOTO 412001246
+1442004337 GOTO 1439004327
+1050003161 GOTO 681002053
+727002191 LET t = t + 13
+9000037 LET t = t + 9
+1969005917 LET t = t + 14
+1589004778 GOTO 493001489
+287000871 LET t = t + 15
+1963005899 LET t = t + 8
+986002969 GOTO 1535004615
+957002882 GOTO 309000937
+1116003358 LET t = t + 11
+1404004223 GOTO 570001720
+423001280 GOTO 853002569
+420001271 GOTO 1520004570
+119000367 LET t = t + 0
+239000728 GOTO 1899005707
+11000043 LET t = t + 11
+1510004541 GOTO 1700005110
+545001645 LET t = t + 1
+1841005534 GOTO 922002776
+1126003389 GOTO 1620004870
+1283003859 LET t = t + 8
+1969005918 GOTO 1646004948
+468001414 LET t = t + 9
+1518004564 LET t = t + 5
+1964005903 GOTO 1379004147
+1273003829 LET t = t + 15
+1885005666 GOTO 1724005182
+1365004106 GOTO 1972005926
+1633004910 GOTO 1982005956
+1358004085 GOTO 1773005329
+25000085 LET t = t + 8
+449001357 LET t = t + 7
+1138003424 LET t = t + 16
+1535004616 GOTO 1782005356
+1093003289 LET t = t + 5
+588001775 GOTO 215000655
+722002176 LET t = t + 8
+1267003812 GOTO 2100000000
+30000101 GOTO 686002068
+1673005030 GOTO 1645004945
+1833005510 GOTO 1733005209
+428001294 LET t = t + 3
+606001829 GOTO 216000658
+1816005459 GOTO 38000124
+49000158 GOTO 514001552
+108000335 GOTO 1470004420
+705002125 LET t = t + 8
+72000226 LET t = t + 4
+1694005092 LET t = t + 11
+723002179 LET t = t + 9
+1987005972 GOTO 1083003259
+968002914 LET t = t + 16
+1847005551 LET t = t + 11
+1139003427 LET t = t + 0
+1143003440 GOTO 1810005440
+1630004900 LET t = t + 15
+1802005417 GOTO 194000592
+366001109 GOTO 273000829
+670002020 LET t = t + 7
+1632004906 LET t = t + 0
+1597004801 LET t = t + 16
+1119003368 GOTO 1494004492
+1859005588 GOTO 105000325
+21000074 GOTO 1117003361
+1016003058 LET t = t + 13
+442001336 LET t = t + 0
+1613004850 GOTO 1211003643
+1460004390 LET t = t + 15
+306000929 GOTO 482001456
+1372004127 GOTO 1633004909
+111000343 LET t = t + 9
+19000068 GOTO 1504004522
+285000866 GOTO 207000631
+819002467 LET t = t + 3
+106000328 LET t = t + 4
+1142003436 LET t = t + 3
+204000623 GOTO 1642004936
+1590004780 LET t = t + 9
+1355004076 GOTO 1627004891
+684002062 LET t = t + 4
+1456004378 LET t = t + 11
+839002527 LET t = t + 6
+742002237 GOTO 905002725
+1657004982 GOTO 957002881
+1506004528 LET t = t + 10
+1352004067 GOTO 1266003808
+31000104 GOTO 1264003802
+1283003860 GOTO 424001282
+872002627 GOTO 1254003772
+1961005894 GOTO 507001531
+991002983 LET t = t + 5
+673002029 LET t = t + 10
+1538004625 GOTO 837002521
+1192003587 GOTO 489001477
+1073003230 GOTO 387001171
+1769005318 GOTO 526001588
+1967005912 GOTO 1747005251
+1928005794 LET t = t + 7
+315000956 GOTO 352001066
+529001597 LET t = t + 2
+1408004235 GOTO 20000070
+4000023 GOTO 970002920
+1841005533 LET t = t + 5
+1243003740 GOTO 1680005050
+308000934 LET t = t + 2
+1134003412 LET t = t + 12
+1085003266 GOTO 1354004072
+1972005926 LET t = t + 0
+1791005384 GOTO 1067003211
+646001949 GOTO 884002662
+740002230 LET t = t + 9
+319000967 LET t = t + 13
+187000572 GOTO 1235003715
+215000655 LET t = t + 11
+1628004894 LET t = t + 13
+1662004997 GOTO 525001585
+1920005771 GOTO 1471004423
+1663004999 LET t = t + 14
+1316003958 LET t = t + 7
+406001228 LET t = t + 15
+1446004349 GOTO 1420004270
+163000500 GOTO 1329003997
+1005003025 LET t = t + 2
+1438004324 LET t = t + 10
+170000520 LET t = t + 0
+665002005 LET t = t + 2
+29000097 LET t = t + 12
+994002993 GOTO 923002779
+739002227 LET t = t + 8
+951002863 LET t = t + 16
+1991005983 LET t = t + 2
+1253003769 LET t = t + 12
+1354004073 GOTO 1644004942
+146000448 LET t = t + 10
+1222003676 LET t = t + 15
+1445004345 LET t = t + 0
+567001711 LET t = t + 6
+194000592 LET t = t + 7
+339001027 LET t = t + 16
+466001408 LET t = t + 7
+635001916 GOTO 1623004879
+1037003121 LET t = t + 0
+1258003785 GOTO 1231003703
+1460004391 GOTO 982002956
+1261003794 GOTO 101000313
+1152003467 GOTO 671002023
+835002516 GOTO 1187003571
+1284003862 LET t = t + 9
+109000337 LET t = t + 7
+897002702 GOTO 465001405
+787002372 GOTO 1113003349
+784002362 LET t = t + 2
+1752005267 GOTO 1437004321
+1409004238 GOTO 833002509
+1681005053 LET t = t + 15
+282000857 GOTO 1149003457
+117000362 GOTO 229000697
+929002797 LET t = t + 11
+1367004111 LET t = t + 7
+1655004976 GOTO 1297003901
+1403004220 GOTO 329000997
+971002924 GOTO 530001600
+1010003040 LET t = t + 7
+1739005227 LET t = t + 5
+39000128 GOTO 1963005899
+1979005947 LET t = t + 7
+1387004172 GOTO 227000691
+1035003116 GOTO 843002539
+522001577 GOTO 448001354
+1514004553 GOTO 898002704
+1027003091 LET t = t + 7
+1244003742 LET t = t + 3
+770002321 GOTO 208000634
+1227003691 LET t = t + 3
+415001256 GOTO 349001057
+54000172 LET t = t + 3
+542001637 GOTO 173000529
+2000017 GOTO 1053003169
+635001915 LET t = t + 6
+1115003355 LET t = t + 10
+516001559 GOTO 684002062
+1164003502 LET t = t + 8
+248000755 GOTO 148000454
+1078003245 GOTO 760002290
+160000490 LET t = t + 7
+1631004903 LET t = t + 16
+1173003529 LET t = t + 0
+809002438 GOTO 1549004657
+619001868 GOTO 918002764
+1629004897 LET t = t + 14
+706002129 GOTO 1847005551
+1707005132 GOTO 880002650
+250000761 GOTO 1284003862
+419001267 LET t = t + 11
+904002722 LET t = t + 3
+1645004945 LET t = t + 13
+1165003505 LET t = t + 9
+1868005615 GOTO 587001771
+475001435 LET t = t + 16
+159000488 GOTO 1592004786
+1219003668 GOTO 1167003511
+1547004651 LET t = t + 0
+1700005110 LET t = t + 0
+395001196 GOTO 1785005365
+411001244 GOTO 276000838
+1966005909 GOTO 1362004096
+1958005884 LET t = t + 3
+1466004408 LET t = t + 4
+58000185 GOTO 1897005701
+1453004370 GOTO 640001930
+736002219 GOTO 95000295
+466001409 GOTO 599001807
+309000937 LET t = t + 3
+363001100 GOTO 808002434
+798002404 LET t = t + 16
+1729005197 LET t = t + 12
+1415004256 GOTO 1757005281
+1883005659 LET t = t + 13
+1060003191 GOTO 1835005515
+1625004886 GOTO 1844005542
+1474004432 LET t = t + 12
+1609004837 LET t = t + 11
+602001817 GOTO 1151003463
+1309003938 GOTO 1404004222
+1536004618 LET t = t + 6
+494001492 LET t = t + 1
+921002774 GOTO 1862005596
+1305003925 LET t = t + 13
+1194003593 GOTO 689002077
+518001564 LET t = t + 8
+337001022 GOTO 1652004966
+923002780 GOTO 1730005200
+828002494 LET t = t + 12
+1668005015 GOTO 1373004129
+323000980 GOTO 1641004933
+971002923 LET t = t + 2
+347001051 LET t = t + 7
+280000851 GOTO 1678005044
+1865005606 GOTO 1935005815
+380001150 LET t = t + 6
+514001552 LET t = t + 4
+968002915 GOTO 1356004078
+220000670 LET t = t + 16
+136000419 GOTO 1495004495
+392001187 GOTO 265000805
+1426004289 GOTO 1604004822
+599001807 LET t = t + 4
+233000709 LET t = t + 12
+283000860 GOTO 144000442
+796002399 GOTO 1489004477
+697002102 GOTO 1046003148
+1120003370 LET t = t + 15
+1748005255 GOTO 849002557
+1504004523 GOTO 687002071
+569001718 GOTO 1147003451
+513001549 LET t = t + 3
+173000530 GOTO 1938005824
+785002366 GOTO 677002041
+1685005065 LET t = t + 2
+880002651 GOTO 1912005746
+1783005360 GOTO 142000436
+125000386 GOTO 542001636
+882002656 LET t = t + 15
+279000848 GOTO 1286003868
+1660004991 GOTO 157000481
+844002543 GOTO 1479004447
+1875005636 GOTO 49000157
+188000574 LET t = t + 1
+1593004789 LET t = t + 12
+1062003196 LET t = t + 8
+1945005845 LET t = t + 7
+1939005828 GOTO 498001504
+1809005438 GOTO 1474004432
+1166003508 LET t = t + 10
+249000757 LET t = t + 11
+1889005678 GOTO 1382004156
+1245003745 LET t = t + 4
+1650004961 GOTO 1425004285
+286000869 GOTO 29000097
+1019003067 LET t = t + 16
+824002482 LET t = t + 8
+1619004867 LET t = t + 4
+786002369 GOTO 1375004135
+210000641 GOTO 1829005497
+144000442 LET t = t + 8
+2100000000 LET p = p + 1
+1119003367 LET t = t + 14
+807002431 LET t = t + 8
+1821005473 LET t = t + 2
+1343004039 LET t = t + 0
+1111003343 LET t = t + 6
+1726005188 LET t = t + 9
+845002546 GOTO 866002608
+1133003410 GOTO 201000613
+1211003644 GOTO 536001618
+359001088 GOTO 1095003295
+696002099 GOTO 256000778
+233000710 GOTO 220000670
+575001735 LET t = t + 14
+492001486 LET t = t + 16
+1275003836 GOTO 1900005710
+229000698 GOTO 951002863
+1561004693 LET t = t + 14
+1117003361 LET t = t + 12
+1204003622 LET t = t + 14
+1994005993 GOTO 1608004834
+1385004166 GOTO 1101003313
+460001391 GOTO 1025003085
+174000533 GOTO 963002899
+1866005608 LET t = t + 13
+1294003892 LET t = t + 2
+1471004423 LET t = t + 9
+725002185 LET t = t + 11
+209000637 LET t = t + 5
+404001223 GOTO 296000898
+901002713 LET t = t + 0
+820002470 LET t = t + 4
+1058003185 GOTO 851002563
+846002548 LET t = t + 13
+183000559 LET t = t + 13
+1571004723 LET t = t + 7
+805002426 GOTO 1159003487
+568001714 LET t = t + 7
+410001241 GOTO 1711005143
+906002728 LET t = t + 5
+1639004927 LET t = t + 7
+848002554 LET t = t + 15
+1329003997 LET t = t + 3
+1247003751 LET t = t + 6
+1075003235 LET t = t + 4
+49000157 LET t = t + 15
+1728005194 LET t = t + 11
+1160003490 LET t = t + 4
+908002734 LET t = t + 7
+895002695 LET t = t + 11
+553001669 LET t = t + 9
+442001337 GOTO 1341004033
+1778005345 GOTO 1172003526
+1076003238 LET t = t + 5
+1811005443 LET t = t + 9
+1048003155 GOTO 1339004027
+792002386 LET t = t + 10
+477001441 LET t = t + 1
+1730005201 GOTO 1848005554
+1300003911 GOTO 1158003484
+1524004582 LET t = t + 11
+433001310 GOTO 1795005395
+594001792 LET t = t + 16
+616001859 GOTO 391001183
+663002000 GOTO 1097003301
+1131003403 LET t = t + 9
+381001154 GOTO 1178003544
+1450004360 LET t = t + 5
+1900005710 LET t = t + 13
+1428004295 GOTO 1962005896
+1941005833 LET t = t + 3
+1972005927 GOTO 1756005278
+231000703 LET t = t + 10
+445001346 GOTO 1971005923
+578001744 LET t = t + 0
+1419004267 LET t = t + 8
+1779005347 LET t = t + 11
+561001694 GOTO 632001906
+1573004730 GOTO 1278003844
+219000667 LET t = t + 15
+760002290 LET t = t + 12
+1736005218 LET t = t + 2
+382001156 LET t = t + 8
+1541004633 LET t = t + 11
+1289003877 LET t = t + 14
+1588004774 LET t = t + 7
+312000947 GOTO 1818005464
+60000191 GOTO 1851005563
+770002320 LET t = t + 5
+1580004751 GOTO 565001705
+1616004859 GOTO 1721005173
+325000986 GOTO 23000079
+10000041 GOTO 601001813
+1096003298 LET t = t + 8
+1964005902 LET t = t + 9
+354001073 GOTO 992002986
+1072003226 LET t = t + 1
+246000749 GOTO 1934005812
+1019003068 GOTO 1811005443
+1592004787 GOTO 773002329
+1020003071 GOTO 81000253
+1715005155 LET t = t + 15
+1640004931 GOTO 618001864
+1840005530 LET t = t + 4
+537001622 GOTO 1267003811
+1287003871 LET t = t + 12
+1316003959 GOTO 902002716
+1046003148 LET t = t + 9
+1785005365 LET t = t + 0
+1850005561 GOTO 895002695
+82000257 GOTO 1406004228
+267000812 GOTO 1568004714
+699002107 LET t = t + 2
+1636004919 GOTO 246000748
+1074003232 LET t = t + 3
+893002689 LET t = t + 9
+232000706 LET t = t + 11
+1340004031 GOTO 1959005887
+1480004450 LET t = t + 1
+427001291 LET t = t + 2
+1057003181 LET t = t + 3
+1977005942 GOTO 490001480
+237000722 GOTO 1718005164
+1545004645 LET t = t + 15
+1636004918 LET t = t + 4
+547001651 LET t = t + 3
+625001886 GOTO 1624004882
+722002177 GOTO 1305003925
+1100003310 LET t = t + 12
+1686005069 GOTO 409001237
+728002194 LET t = t + 14
+538001624 LET t = t + 11
+1061003194 GOTO 1942005836
+1931005804 GOTO 1611004843
+1108003335 GOTO 347001051
+1332004006 LET t = t + 6
+103000320 GOTO 1224003682
+1649004958 GOTO 1906005728
+161000493 LET t = t + 8
+1494004492 LET t = t + 15
+805002425 LET t = t + 6
+820002471 GOTO 371001123
+1599004808 GOTO 870002620
+508001534 LET t = t + 15
+1562004696 LET t = t + 15
+958002885 GOTO 1062003196
+1534004612 LET t = t + 4
+1910005740 LET t = t + 6
+927002792 GOTO 610001840
+1917005761 LET t = t + 13
+446001349 GOTO 1396004198
+937002821 LET t = t + 2
+1528004595 GOTO 483001459
+1472004427 GOTO 1481004453
+109000338 GOTO 1841005533
+1160003491 GOTO 33000109
+676002038 LET t = t + 13
+43000140 GOTO 1139003427
+1078003244 LET t = t + 7
+1901005714 GOTO 1273003829
+390001181 GOTO 537001621
+197000602 GOTO 1597004801
+1838005524 LET t = t + 2
+133000410 GOTO 1904005722
+1990005980 LET t = t + 1
+1289003878 GOTO 1277003841
+1528004594 LET t = t + 15
+314000953 GOTO 311000943
+535001615 LET t = t + 8
+178000544 LET t = t + 8
+868002615 GOTO 559001687
+1955005875 LET t = t + 0
+571001723 LET t = t + 10
+1643004940 GOTO 1218003664
+1706005129 GOTO 1809005437
+1949005857 LET t = t + 11
+1274003832 LET t = t + 16
+887002671 LET t = t + 3
+892002686 LET t = t + 8
+1811005444 GOTO 764002302
+585001765 LET t = t + 7
+1472004426 LET t = t + 10
+301000913 LET t = t + 12
+977002942 GOTO 518001564
+690002081 GOTO 605001825
+508001535 GOTO 138000424
+69000218 GOTO 1519004567
+1434004313 GOTO 1911005743
+468001415 GOTO 1315003955
+1921005774 GOTO 181000553
+120000370 LET t = t + 1
+1867005611 LET t = t + 14
+1773005329 LET t = t + 5
+1983005959 LET t = t + 11
+1597004802 GOTO 1523004579
+42000136 LET t = t + 8
+1998006004 LET t = t + 9
+879002648 GOTO 1195003595
+1281003854 GOTO 1998006004
+1363004100 GOTO 1610004840
+1409004237 LET t = t + 15
+267000811 LET t = t + 12
+1452004366 LET t = t + 7
+1831005504 GOTO 1268003814
+677002041 LET t = t + 14
+1891005683 LET t = t + 4
+1906005729 GOTO 876002638
+1106003329 GOTO 1000013
+1136003418 LET t = t + 14
+237000721 LET t = t + 16
+710002141 GOTO 1108003334
+495001496 GOTO 1834005512
+1410004241 GOTO 298000904
+596001798 LET t = t + 1
+1440004331 GOTO 165000505
+152000467 GOTO 560001690
+1908005735 GOTO 811002443
+1341004033 LET t = t + 15
+1182003556 LET t = t + 9
+1530004600 LET t = t + 0
+1489004478 GOTO 1538004624
+1313003949 LET t = t + 4
+1559004688 GOTO 47000151
+798002405 GOTO 454001372
+245000746 GOTO 682002056
+1326003988 LET t = t + 0
+373001130 GOTO 97000301
+329000998 GOTO 72000226
+1950005861 GOTO 1966005908
+775002336 GOTO 1294003892
+1913005750 GOTO 1088003274
+268000814 LET t = t + 13
+662001996 LET t = t + 16
+515001555 LET t = t + 5
+886002669 GOTO 639001927
+482001457 GOTO 272000826
+1533004609 LET t = t + 3
+337001021 LET t = t + 14
+1647004951 LET t = t + 15
+70000220 LET t = t + 2
+1258003784 LET t = t + 0
+1375004135 LET t = t + 15
+261000793 LET t = t + 6
+32000106 LET t = t + 15
+1124003383 GOTO 703002119
+1083003259 LET t = t + 12
+1551004663 LET t = t + 4
+122000377 GOTO 1989005977
+1898005705 GOTO 1084003262
+1615004855 LET t = t + 0
+1420004270 LET t = t + 9
+1697005102 GOTO 1496004498
+1366004108 LET t = t + 6
+1354004072 LET t = t + 11
+1797005401 LET t = t + 12
+150000460 LET t = t + 14
+1807005431 LET t = t + 5
+541001634 GOTO 1731005203
+1307003932 GOTO 1593004789
+502001516 LET t = t + 9
+1401004213 LET t = t + 7
+1809005437 LET t = t + 7
+380001151 GOTO 103000319
+1003003019 LET t = t + 0
+1228003694 LET t = t + 4
+1261003793 LET t = t + 3
+293000889 LET t = t + 4
+1882005656 LET t = t + 12
+814002453 GOTO 222000676
+1214003653 GOTO 1497004501
+1686005068 LET t = t + 3
+1599004807 LET t = t + 1
+1233003709 LET t = t + 9
+1421004273 LET t = t + 10
+88000274 LET t = t + 3
+1785005366 GOTO 1011003043
+780002350 LET t = t + 15
+1513004550 GOTO 1136003418
+1021003074 GOTO 485001465
+478001445 GOTO 218000664
+1587004771 LET t = t + 6
+452001366 LET t = t + 10
+880002650 LET t = t + 13
+1102003317 GOTO 710002140
+1391004183 LET t = t + 14
+1223003679 LET t = t + 16
+1905005725 LET t = t + 1
+833002509 LET t = t + 0
+376001138 LET t = t + 2
+1743005240 GOTO 82000256
+67000212 GOTO 328000994
+461001393 LET t = t + 2
+1141003434 GOTO 1980005950
+1417004262 GOTO 1069003217
+93000289 LET t = t + 8
+1177003542 GOTO 85000265
+317000962 GOTO 1206003628
+457001381 LET t = t + 15
+79000247 LET t = t + 11
+1114003353 GOTO 1319003967
+369001118 GOTO 1039003127
+1002003016 LET t = t + 16
+1694005093 GOTO 1281003853
+791002383 LET t = t + 9
+1445004346 GOTO 925002785
+1394004192 LET t = t + 0
+1742005236 LET t = t + 8
+1084003263 GOTO 1146003448
+1079003248 GOTO 452001366
+1607004832 GOTO 543001639
+1924005783 GOTO 708002134
+1980005951 GOTO 1541004633
+1389004178 GOTO 1347004051
+153000470 GOTO 831002503
+34000112 LET t = t + 0
+514001553 GOTO 1274003832
+1993005989 LET t = t + 4
+1127003391 LET t = t + 5
+647001951 LET t = t + 1
+364001102 LET t = t + 7
+390001180 LET t = t + 16
+1566004708 LET t = t + 2
+1696005098 LET t = t + 13
+866002609 GOTO 566001708
+1183003560 GOTO 1704005122
+1874005633 GOTO 292000886
+1317003961 LET t = t + 8
+946002849 GOTO 321000973
+286000868 LET t = t + 14
+771002323 LET t = t + 6
+412001246 LET t = t + 4
+1022003076 LET t = t + 2
+743002240 GOTO 203000619
+781002354 GOTO 1771005323
+1802005416 LET t = t + 0
+379001148 GOTO 340001030
+1605004825 LET t = t + 7
+1190003580 LET t = t + 0
+1314003952 LET t = t + 5
+1888005675 GOTO 1507004531
+841002533 LET t = t + 8
+99000307 LET t = t + 14
+985002965 LET t = t + 16
+1222003677 GOTO 457001381
+29000098 GOTO 993002989
+1090003281 GOTO 658001984
+654001973 GOTO 603001819
+92000286 LET t = t + 7
+1311003943 LET t = t + 2
+429001297 LET t = t + 4
+1940005831 GOTO 1575004735
+888002675 GOTO 1050003160
+1281003853 LET t = t + 6
+1576004738 LET t = t + 12
+1870005620 LET t = t + 0
+1594004792 LET t = t + 13
+1026003089 GOTO 841002533
+1784005363 GOTO 706002128
+48000154 LET t = t + 14
+707002132 GOTO 323000979
+652001967 GOTO 1890005680
+944002843 GOTO 1854005572
+1036003118 LET t = t + 16
+1187003572 GOTO 299000907
+463001400 GOTO 1557004681
+1819005468 GOTO 397001201
+1531004603 LET t = t + 1
+1444004343 GOTO 429001297
+1982005956 LET t = t + 10
+1358004084 LET t = t + 15
+1831005503 LET t = t + 12
+1705005126 GOTO 1511004543
+1676005038 LET t = t + 10
+1495004495 LET t = t + 16
+104000323 GOTO 1684005062
+1233003710 GOTO 1625004885
+1792005387 GOTO 1969005917
+1000013 LET t = t + 1
+602001816 LET t = t + 7
+507001532 GOTO 1796005398
+305000926 GOTO 1463004399
+1646004949 GOTO 1686005068
+1406004229 GOTO 950002860
+1793005389 LET t = t + 8
+632001907 GOTO 1201003613
+282000856 LET t = t + 10
+1719005168 GOTO 1188003574
+1918005765 GOTO 435001315
+1171003524 GOTO 1740005230
+1143003439 LET t = t + 4
+821002473 LET t = t + 5
+203000620 GOTO 1407004231
+1804005423 GOTO 1762005296
+630001901 GOTO 1444004342
+1839005527 LET t = t + 3
+1050003160 LET t = t + 13
+1292003886 LET t = t + 0
+1178003545 GOTO 1572004726
+735002215 LET t = t + 4
+222000677 GOTO 1020003070
+1940005830 LET t = t + 2
+400001211 GOTO 864002602
+983002960 GOTO 769002317
+1477004441 LET t = t + 15
+734002213 GOTO 675002035
+747002251 LET t = t + 16
+1418004264 LET t = t + 7
+71000224 GOTO 263000799
+1367004112 GOTO 1800005410
+1383004160 GOTO 729002197
+507001531 LET t = t + 14
+1059003187 LET t = t + 5
+802002417 GOTO 27000091
+521001573 LET t = t + 11
+873002629 LET t = t + 6
+1513004549 LET t = t + 0
+804002423 GOTO 447001351
+1008003035 GOTO 1361004093
+951002864 GOTO 690002080
+1980005950 LET t = t + 8
+1031003104 GOTO 802002416
+344001042 LET t = t + 4
+1280003850 LET t = t + 5
+355001075 LET t = t + 15
+1982005957 GOTO 1127003391
+1970005920 LET t = t + 15
+871002624 GOTO 919002767
+40000130 LET t = t + 6
+1695005096 GOTO 852002566
+765002306 GOTO 182000556
+496001498 LET t = t + 3
+1075003236 GOTO 1967005911
+985002966 GOTO 1478004444
+1741005234 GOTO 930002800
+610001840 LET t = t + 15
+548001655 GOTO 1556004678
+1286003868 LET t = t + 11
+621001874 GOTO 1830005500
+224000682 LET t = t + 3
+371001123 LET t = t + 14
+757002282 GOTO 1443004339
+686002068 LET t = t + 6
+1720005171 GOTO 1732005206
+1410004240 LET t = t + 16
+754002273 GOTO 1102003316
+1054003172 LET t = t + 0
+1220003671 GOTO 1574004732
+945002845 LET t = t + 10
+1622004877 GOTO 821002473
+1926005788 LET t = t + 5
+1854005572 LET t = t + 1
+1806005428 LET t = t + 4
+1634004913 GOTO 1558004684
+1581004753 LET t = t + 0
+186000568 LET t = t + 16
+797002401 LET t = t + 15
+860002591 GOTO 461001393
+1025003085 LET t = t + 5
+213000650 GOTO 1531004603
+857002582 GOTO 1750005260
+573001729 LET t = t + 12
+693002089 LET t = t + 13
+35000115 LET t = t + 1
+438001325 GOTO 529001597
+546001648 LET t = t + 2
+341001033 LET t = t + 1
+924002782 LET t = t + 6
+1345004046 GOTO 453001369
+600001810 LET t = t + 5
+738002224 LET t = t + 7
+983002959 LET t = t + 14
+946002848 LET t = t + 11
+415001255 LET t = t + 7
+1499004507 LET t = t + 3
+711002144 GOTO 375001135
+1235003716 GOTO 900002710
+806002428 LET t = t + 7
+1906005728 LET t = t + 2
+854002573 GOTO 1991005983
+1943005840 GOTO 748002254
+884002663 GOTO 1484004462
+303000920 GOTO 126000388
+1043003140 GOTO 664002002
+1546004649 GOTO 521001573
+382001157 GOTO 777002341
+1152003466 LET t = t + 13
+1891005684 GOTO 1351004063
+1121003373 LET t = t + 16
+1198003605 GOTO 378001144
+1444004342 LET t = t + 16
+1848005554 LET t = t + 12
+480001450 LET t = t + 4
+1246003748 LET t = t + 5
+1957005881 LET t = t + 2
+783002359 LET t = t + 1
+733002210 GOTO 717002161
+526001588 LET t = t + 16
+72000227 GOTO 568001714
+454001373 GOTO 1978005944
+1205003625 LET t = t + 15
+949002857 LET t = t + 14
+563001700 GOTO 462001396
+230000700 LET t = t + 9
+1017003062 GOTO 635001915
+794002393 GOTO 1775005335
+742002236 LET t = t + 11
+1648004955 GOTO 987002971
+1402004217 GOTO 335001015
+1873005629 LET t = t + 3
+1899005708 GOTO 364001102
+476001439 GOTO 1374004132
+692002087 GOTO 1472004426
+1331004003 LET t = t + 5
+242000736 LET t = t + 4
+1346004049 GOTO 754002272
+17000061 LET t = t + 0
+758002285 GOTO 1975005935
+283000859 LET t = t + 11
+1668005014 LET t = t + 2
+1710005140 LET t = t + 10
+1765005305 LET t = t + 14
+375001136 GOTO 301000913
+999003007 LET t = t + 13
+193000589 LET t = t + 6
+341001034 GOTO 1815005455
+1551004664 GOTO 1902005716
+817002462 GOTO 1503004519
+1760005290 LET t = t + 9
+457001382 GOTO 1258003784
+1884005662 LET t = t + 14
+1183003559 LET t = t + 10
+257000781 LET t = t + 2
+1454004373 GOTO 213000649
+1241003734 GOTO 1602004816
+1671005023 LET t = t + 5
+1881005654 GOTO 261000793
+1055003175 LET t = t + 1
+458001385 GOTO 377001141
+1750005260 LET t = t + 16
+1030003101 GOTO 653001969
+910002740 LET t = t + 9
+1493004490 GOTO 96000298
+260000791 GOTO 183000559
+648001955 GOTO 1213003649
+1633004909 LET t = t + 1
+716002159 GOTO 338001024
+1716005158 LET t = t + 16
+1757005282 GOTO 1639004927
+1550004660 LET t = t + 3
+1405004225 LET t = t + 11
+694002092 LET t = t + 14
+501001514 GOTO 382001156
+1728005195 GOTO 1177003541
+776002338 LET t = t + 11
+704002122 LET t = t + 7
+1208003635 GOTO 1576004738
+1667005012 GOTO 567001711
+1837005522 GOTO 1522004576
+227000692 GOTO 1666005008
+131000403 LET t = t + 12
+120000371 GOTO 289000877
+379001147 LET t = t + 5
+1438004325 GOTO 654001972
+1013003049 LET t = t + 10
+924002783 GOTO 698002104
+1266003808 LET t = t + 8
+342001036 LET t = t + 2
+1015003055 LET t = t + 12
+1635004916 GOTO 243000739
+826002488 LET t = t + 10
+1613004849 LET t = t + 15
+479001447 LET t = t + 3
+1011003043 LET t = t + 8
+102000317 GOTO 1483004459
+1099003307 LET t = t + 11
+272000827 GOTO 989002977
+444001342 LET t = t + 2
+1914005753 GOTO 1058003184
+1953005870 GOTO 1630004900
+1350004061 GOTO 756002278
+1879005648 GOTO 1742005236
+1794005392 LET t = t + 9
+672002026 LET t = t + 9
+1672005027 GOTO 1846005548
+1253003770 GOTO 217000661
+887002672 GOTO 1534004612
+1986005969 GOTO 1671005023
+1907005731 LET t = t + 3
+1359004087 LET t = t + 16
+1711005143 LET t = t + 11
+453001369 LET t = t + 11
+251000763 LET t = t + 13
+709002137 LET t = t + 12
+156000479 GOTO 1087003271
+307000931 LET t = t + 1
+902002717 GOTO 524001582
+1989005977 LET t = t + 0
+1864005603 GOTO 1090003280
+8000034 LET t = t + 8
+1583004760 GOTO 432001306
+777002341 LET t = t + 12
+1482004456 LET t = t + 3
+1389004177 LET t = t + 12
+565001705 LET t = t + 4
+1936005818 LET t = t + 15
+365001105 LET t = t + 8
+1526004588 LET t = t + 13
+326000988 LET t = t + 3
+1475004436 GOTO 223000679
+1788005374 LET t = t + 3
+1529004598 GOTO 319000967
+1290003881 GOTO 394001192
+1488004475 GOTO 240000730
+1820005471 GOTO 314000952
+5000026 GOTO 1988005974
+1574004733 GOTO 464001402
+191000584 GOTO 1761005293
+651001964 GOTO 1106003328
+737002222 GOTO 908002734
+645001945 LET t = t + 16
+535001616 GOTO 692002086
+10000040 LET t = t + 10
+1032003107 GOTO 1307003931
+449001358 GOTO 279000847
+1530004601 GOTO 947002851
+1196003599 GOTO 857002581
+1773005330 GOTO 1405004225
+1163003500 GOTO 1298003904
+639001928 GOTO 1659004987
+695002096 GOTO 1475004435
+1568004714 LET t = t + 4
+44000143 GOTO 193000589
+1952005867 GOTO 162000496
+4 LET t = 0
+970002921 GOTO 167000511
+1405004226 GOTO 98000304
+994002992 LET t = t + 8
+1732005206 LET t = t + 15
+265000806 GOTO 1367004111
+948002854 LET t = t + 13
+35000116 GOTO 745002245
+231000704 GOTO 1306003928
+965002905 LET t = t + 13
+889002677 LET t = t + 5
+57000182 GOTO 716002158
+767002312 GOTO 1933005809
+1325003985 LET t = t + 16
+866002608 LET t = t + 16
+894002693 GOTO 1905005725
+1674005033 GOTO 1157003481
+327000992 GOTO 636001918
+957002881 LET t = t + 5
+1986005968 LET t = t + 14
+664002002 LET t = t + 1
+1595004796 GOTO 388001174
+360001090 LET t = t + 3
+1776005339 GOTO 973002929
+284000863 GOTO 998003004
+91000284 GOTO 283000859
+352001067 GOTO 1346004048
+1335004015 LET t = t + 9
+199000608 GOTO 1843005539
+1701005114 GOTO 1460004390
+1240003730 LET t = t + 16
+1436004318 LET t = t + 8
+1744005242 LET t = t + 10
+1139003428 GOTO 1332004006
+78000244 LET t = t + 10
+506001528 LET t = t + 13
+1796005399 GOTO 433001309
+744002243 GOTO 1372004126
+1520004570 LET t = t + 7
+294000892 LET t = t + 5
+1018003064 LET t = t + 15
+260000790 LET t = t + 5
+1481004453 LET t = t + 2
+504001523 GOTO 1665005005
+1173003530 GOTO 1017003061
+1770005320 LET t = t + 2
+74000232 LET t = t + 6
+1875005635 LET t = t + 5
+756002278 LET t = t + 8
+1598004804 LET t = t + 0
+1380004150 LET t = t + 3
+78000245 GOTO 1651004963
+683002059 LET t = t + 3
+611001843 LET t = t + 16
+1060003190 LET t = t + 6
+1696005099 GOTO 1192003586
+1823005480 GOTO 502001516
+1984005962 LET t = t + 12
+110000340 LET t = t + 8
+1520004571 GOTO 1616004858
+1319003967 LET t = t + 10
+1660004990 LET t = t + 11
+903002719 LET t = t + 2
+1664005003 GOTO 346001048
+1370004120 LET t = t + 10
+250000760 LET t = t + 12
+464001403 GOTO 1034003112
+12000047 GOTO 1205003625
+369001117 LET t = t + 12
+315000955 LET t = t + 9
+195000595 LET t = t + 8
+1605004826 GOTO 1622004876
+823002479 LET t = t + 7
+895002696 GOTO 1114003352
+57000181 LET t = t + 6
+1935005816 GOTO 1886005668
+1066003209 GOTO 450001360
+221000674 GOTO 1241003733
+187000571 LET t = t + 0
+1120003371 GOTO 1867005611
+521001574 GOTO 1454004372
+1778005344 LET t = t + 10
+146000449 GOTO 711002143
+451001364 GOTO 406001228
+1309003937 LET t = t + 0
+1357004081 LET t = t + 14
+1170003521 GOTO 158000484
+1198003604 LET t = t + 8
+2100000003 END
+539001628 GOTO 1141003433
+913002750 GOTO 704002122
+1836005518 LET t = t + 0
+1041003134 GOTO 486001468
+185000566 GOTO 455001375
+562001696 LET t = t + 1
+43000139 LET t = t + 9
+816002459 GOTO 714002152
+1074003233 GOTO 1321003973
+545001646 GOTO 221000673
+1729005198 GOTO 1440004330
+810002440 LET t = t + 11
+427001292 GOTO 1947005851
+543001639 LET t = t + 16
+719002168 GOTO 395001195
+679002048 GOTO 1741005233
+134000413 GOTO 1735005215
+988002975 GOTO 505001525
+1180003550 LET t = t + 7
+1920005770 LET t = t + 16
+1134003413 GOTO 1822005476
+1511004544 GOTO 956002878
+244000742 LET t = t + 6
+663001999 LET t = t + 0
+134000412 LET t = t + 15
+383001159 LET t = t + 9
+1549004657 LET t = t + 2
+812002447 GOTO 1019003067
+1093003290 GOTO 1333004009
+1089003278 GOTO 996002998
+1853005570 GOTO 141000433
+1606004828 LET t = t + 8
+640001931 GOTO 113000349
+1604004823 GOTO 1216003658
+1162003497 GOTO 1353004069
+712002147 GOTO 475001435
+638001924 LET t = t + 9
+1815005455 LET t = t + 13
+201000614 GOTO 678002044
+362001097 GOTO 160000490
+1775005336 GOTO 166000508
+950002860 LET t = t + 15
+1086003268 LET t = t + 15
+594001793 GOTO 288000874
+1129003398 GOTO 1948005854
+1767005312 GOTO 365001105
+1548004654 LET t = t + 1
+1644004943 GOTO 828002494
+1946005849 GOTO 1199003607
+1495004496 GOTO 935002815
+378001145 GOTO 255000775
+778002345 GOTO 286000868
+1624004883 GOTO 1438004324
+678002045 GOTO 262000796
+771002324 GOTO 730002200
+1653004969 LET t = t + 4
+728002195 GOTO 1040003130
+700002111 GOTO 1148003454
+1069003217 LET t = t + 15
+1618004865 GOTO 1185003565
+1792005386 LET t = t + 7
+154000472 LET t = t + 1
+256000778 LET t = t + 1
+981002953 LET t = t + 12
+679002047 LET t = t + 16
+1532004606 LET t = t + 2
+757002281 LET t = t + 9
+822002477 GOTO 472001426
+1557004682 GOTO 1026003088
+1626004889 GOTO 926002788
+589001777 LET t = t + 11
+203000619 LET t = t + 16
+1141003433 LET t = t + 2
+1971005924 GOTO 1033003109
+1739005228 GOTO 1291003883
+1733005209 LET t = t + 16
+162000497 GOTO 931002803
+50000160 LET t = t + 16
+719002167 LET t = t + 5
+1323003980 GOTO 842002536
+311000944 GOTO 24000082
+857002581 LET t = t + 7
+238000724 LET t = t + 0
+883002659 LET t = t + 16
+682002057 GOTO 846002548
+1943005839 LET t = t + 5
+1525004586 GOTO 1839005527
+189000578 GOTO 471001423
+193000590 GOTO 920002770
+1361004094 GOTO 168000514
+1382004157 GOTO 1076003238
+1659004988 GOTO 865002605
+211000643 LET t = t + 7
+161000494 GOTO 1022003076
+587001772 GOTO 1792005386
+595001795 LET t = t + 0
+279000847 LET t = t + 7
+1764005302 LET t = t + 13
+16000059 GOTO 37000121
+1770005321 GOTO 1036003118
+1374004132 LET t = t + 14
+708002134 LET t = t + 11
+528001595 GOTO 1526004588
+1245003746 GOTO 1638004924
+1682005057 GOTO 1746005248
+32000107 GOTO 506001528
+244000743 GOTO 496001498
+357001081 LET t = t + 0
+842002536 LET t = t + 9
+490001481 GOTO 633001909
+1779005348 GOTO 624001882
+1307003931 LET t = t + 15
+374001133 GOTO 656001978
+605001825 LET t = t + 10
+1128003394 LET t = t + 6
+1282003856 LET t = t + 7
+1746005248 LET t = t + 12
+75000236 GOTO 1247003751
+769002317 LET t = t + 4
+410001240 LET t = t + 2
+9000038 GOTO 571001723
+14000052 LET t = t + 14
+609001837 LET t = t + 14
+1491004484 GOTO 1913005749
+1385004165 LET t = t + 8
+1069003218 GOTO 550001660
+1973005929 LET t = t + 1
+1536004619 GOTO 523001579
+650001961 GOTO 200000610
+114000352 LET t = t + 12
+6000029 GOTO 1596004798
+243000740 GOTO 1584004762
+169000518 GOTO 210000640
+1516004559 GOTO 6000028
+1033003109 LET t = t + 13
+813002450 GOTO 527001591
+1431004304 GOTO 932002806
+168000515 GOTO 826002488
+1379004148 GOTO 355001075
+1652004966 LET t = t + 3
+1312003947 GOTO 1570004720
+1270003821 GOTO 871002623
+271000824 GOTO 205000625
+585001766 GOTO 1547004651
+1484004463 GOTO 1817005461
+200000610 LET t = t + 13
+122000376 LET t = t + 3
+1892005686 LET t = t + 5
+680002050 LET t = t + 0
+1500004510 LET t = t + 4
+1510004540 LET t = t + 14
+1985005966 GOTO 1505004525
+256000779 GOTO 1248003754
+843002539 LET t = t + 10
+907002732 GOTO 40000130
+167000512 GOTO 1153003469
+1974005932 LET t = t + 2
+63000199 LET t = t + 12
+868002614 LET t = t + 1
+62000197 GOTO 694002092
+538001625 GOTO 1486004468
+1501004513 LET t = t + 5
+800002410 LET t = t + 1
+1721005173 LET t = t + 4
+1692005086 LET t = t + 9
+168000514 LET t = t + 15
+1178003544 LET t = t + 5
+534001612 LET t = t + 7
+277000841 LET t = t + 5
+1630004901 GOTO 1973005929
+1169003517 LET t = t + 13
+995002995 LET t = t + 9
+834002513 GOTO 1950005860
+1334004013 GOTO 504001522
+1199003607 LET t = t + 9
+165000505 LET t = t + 12
+1776005338 LET t = t + 8
+318000965 GOTO 192000586
+1414004253 GOTO 1066003208
+676002039 GOTO 1171003523
+522001576 LET t = t + 12
+1766005308 LET t = t + 15
+1949005858 GOTO 1421004273
+157000482 GOTO 1655004975
+1348004054 LET t = t + 5
+1903005719 LET t = t + 16
+668002014 LET t = t + 5
+970002920 LET t = t + 1
+660001990 LET t = t + 14
+97000301 LET t = t + 12
+579001747 LET t = t + 1
+76000239 GOTO 494001492
+705002126 GOTO 971002923
+1763005299 LET t = t + 12
+1742005237 GOTO 1672005026
+636001918 LET t = t + 7
+1260003790 LET t = t + 2
+1718005164 LET t = t + 1
+1731005203 LET t = t + 14
+297000901 LET t = t + 8
+1508004535 GOTO 847002551
+367001112 GOTO 732002206
+1123003379 LET t = t + 1
+50000161 GOTO 611001843
+22000076 LET t = t + 5
+1302003917 GOTO 80000250
+112000347 GOTO 1400004210
+349001057 LET t = t + 9
+772002327 GOTO 1134003412
+1140003430 LET t = t + 1
+1320003970 LET t = t + 11
+132000406 LET t = t + 13
+117000361 LET t = t + 15
+1212003647 GOTO 11000043
+956002878 LET t = t + 4
+660001991 GOTO 1345004045
+725002186 GOTO 1769005317
+1836005519 GOTO 510001540
+781002353 LET t = t + 16
+28000094 LET t = t + 11
+424001282 LET t = t + 16
+1194003592 LET t = t + 4
+1858005584 LET t = t + 5
+1977005941 LET t = t + 5
+758002284 LET t = t + 10
+483001459 LET t = t + 7
+346001048 LET t = t + 6
+503001519 LET t = t + 10
+1058003184 LET t = t + 4
+1371004123 LET t = t + 11
+393001190 GOTO 1751005263
+893002690 GOTO 1853005569
+1264003803 GOTO 1949005857
+1762005296 LET t = t + 11
+1965005906 GOTO 1952005866
+666002009 GOTO 1909005737
+98000304 LET t = t + 13
+1638004924 LET t = t + 6
+1974005933 GOTO 1898005704
+1459004387 LET t = t + 14
+1275003835 LET t = t + 0
+710002140 LET t = t + 13
+1115003356 GOTO 1831005503
+1197003601 LET t = t + 7
+1 REM Sparse numbering: 2000 lines spread over two billion numbers,
+1295003895 LET t = t + 3
+1023003080 GOTO 1515004555
+1479004447 LET t = t + 0
+76000238 LET t = t + 8
+1028003095 GOTO 625001885
+915002755 LET t = t + 14
+455001376 GOTO 556001678
+931002804 GOTO 57000181
+1486004469 GOTO 61000193
+1829005497 LET t = t + 10
+1835005515 LET t = t + 16
+655001975 LET t = t + 9
+1879005647 LET t = t + 9
+240000730 LET t = t + 2
+1168003514 LET t = t + 12
+1014003052 LET t = t + 11
+472001427 GOTO 466001408
+1745005246 GOTO 250000760
+1110003341 GOTO 1203003619
+1684005062 LET t = t + 1
+862002596 LET t = t + 12
+1926005789 GOTO 912002746
+993002990 GOTO 2000016
+1494004493 GOTO 609001837
+1156003479 GOTO 1415004255
+1260003791 GOTO 1285003865
+1110003340 LET t = t + 5
+759002288 GOTO 1223003679
+596001799 GOTO 252000766
+1497004501 LET t = t + 1
+550001661 GOTO 1766005308
+1834005513 GOTO 666002008
+1988005975 GOTO 1423004279
+1677005042 GOTO 1528004594
+1803005419 LET t = t + 1
+730002201 GOTO 1781005353
@@ -0,0 +1,21 @@
+10 REM Structured loops: nested FOR/NEXT with STEP, and WHILE/WEND
+20 LET s = 0
+30 FOR i = 1 TO 3000
+40 FOR j = i TO 1 STEP -1
+50 LET s = s + j / i
+60 NEXT j
+70 NEXT i
+80 PRINT "triangle", s
+90 LET t = 0
+100 FOR k = 0 TO 1 STEP 0.000001
+110 LET t = t + k
+120 NEXT k
+130 PRINT "steps", t
+140 LET n = 1000000
+150 LET c = 0
+160 WHILE n > 1
+170 LET n = n - n / 100000 - 1
+180 LET c = c + 1
+190 WEND
+200 PRINT "countdown", c
+210 END
@@ -0,0 +1,876 @@
+/*
+ * File: microbench.cpp
+ * --------------------
+ * Microbenchmarks for the components of the interpreter: the lexer,
+ * the parser, the line table of Program, the evaluators together
+ * with EvalState, the vector kernels of simd.h at every level the
+ * processor supports and the matrix kernels of matrix.h on one thread
+ * and on all of them.  The program is headless; it links every module of
+ * src except Basic.cpp and never opens the graphics window.  Results
+ * are written as JSON or CSV, one record per benchmark, so they can
+ * be collected for every commit and compared.
+ *
+ * Usage: microbench [--format json|csv] [--filter text] [--label text]
+ *                   [--min-time seconds] [--repeats n] [--max-lines n]
+ *                   [--list]
+ *
+ *   --format    json (the default) or csv
+ *   --filter    runs only the benchmarks whose name contains text
+ *   --label     is copied into every record, eg the commit measured
+ *   --min-time  is the time each repeat runs for, 0.2 s by default
+ *   --repeats   is the number of repeats, 5 by default
+ *   --max-lines is the largest program of the Program benchmarks,
+ *               1000000 by default
+ *   --list      prints the benchmark names and exits
+ *
+ * Each repeat runs a benchmark often enough to take at least the
+ * minimum time; the record holds the median and the fastest repeat
+ * in nanoseconds per operation.  Benchmarks that handle many items
+ * in one operation, such as a whole program of lines, also report the
+ * number of items per operation and the items handled per second.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "lexer.h"
+#include "parser.h"
+#include "program.h"
+#include "evalstate.h"
+#include "postfix.h"
+#include "arena.h"
+#include "simd.h"
+#include "matrix.h"
+#include "error.h"
+using namespace std;
+
+#if defined(__unix__) || defined(__APPLE__)
+#  define BENCH_MONOTONIC
+#  include <time.h>
+#else
+#  include <ctime>
+#endif
+
+/*
+ * Constants
+ * ---------
+ * CALIBRATION_LIMIT -- Largest number of operations in one timed batch
+ * ARENA_BATCH       -- Number of parses after which the arena is cleared
+ * SAMPLE_LINES      -- Number of lines of the lexer and parser program
+ * VECTOR_LENGTH     -- Number of elements of the vector kernel operands
+ * MATRIX_ORDER      -- Number of rows and columns of the matrix operands
+ */
+
+static const long CALIBRATION_LIMIT = 1L << 30;
+static const int ARENA_BATCH = 1024;
+static const int SAMPLE_LINES = 2000;
+static const int VECTOR_LENGTH = 4096;
+static const int MATRIX_ORDER = 256;
+
+/* Timing */
+
+static double now() {
+#ifdef BENCH_MONOTONIC
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ts.tv_sec + ts.tv_nsec * 1e-9;
+#else
+   return (double) clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+/*
+ * Class: BenchContext
+ * -------------------
+ * Passed to every benchmark function.  The clock runs from the start
+ * of the batch; pause and resume exclude setup work that must be
+ * repeated inside the batch, such as rebuilding a program to remove
+ * its lines again.
+ */
+
+class BenchContext {
+
+public:
+
+   BenchContext() {
+      elapsed = 0;
+      started = 0;
+   }
+
+   void start() {
+      elapsed = 0;
+      started = now();
+   }
+
+   void pause() {
+      elapsed += now() - started;
+   }
+
+   void resume() {
+      started = now();
+   }
+
+   double stop() {
+      pause();
+      return elapsed;
+   }
+
+private:
+
+   double elapsed;
+   double started;
+
+};
+
+/*
+ * Type: BenchFn
+ * -------------
+ * A benchmark function runs n operations and returns a value computed
+ * from their results, which keeps the compiler from removing them.
+ */
+
+typedef double (*BenchFn)(BenchContext & ctx, long n, void *data);
+
+struct Benchmark {
+   string name;
+   BenchFn fn;
+   void *data;
+   double itemsPerOp;
+};
+
+struct BenchResult {
+   string name;
+   long iterations;
+   int repeats;
+   double nsPerOp;
+   double minNsPerOp;
+   double itemsPerOp;
+};
+
+static volatile double benchSink;
+
+/* Synthetic input */
+
+/*
+ * Function: makeExpression
+ * Usage: string text = makeExpression(nTerms, seed);
+ * --------------------------------------------------
+ * Returns an expression of nTerms terms, alternating variables and
+ * constants, joined by all four operators, with every fourth pair of
+ * terms in parentheses.  The variables are v0 to v7.
+ */
+
+static string makeExpression(int nTerms, int seed) {
+   static const char OPS[] = { '+', '*', '-', '/' };
+   ostringstream out;
+   for (int i = 0; i < nTerms; i++) {
+      bool open = (i % 4 == 0 && i + 1 < nTerms);
+      if (i > 0) out << ' ' << OPS[(i + seed) % 4] << ' ';
+      if (open) out << '(';
+      if (i % 2 == 0) {
+         out << 'v' << ((i + seed) % 8);
+      } else {
+         out << (i * 7 + seed) % 100 + 1;
+      }
+      if (i % 4 == 1) out << ')';
+   }
+   return out.str();
+}
+
+/*
+ * Function: makeProgramLines
+ * Usage: vector<string> lines = makeProgramLines(n);
+ * --------------------------------------------------
+ * Returns n numbered lines cycling through every kind of statement,
+ * the way a typical program mixes them.
+ */
+
+static vector<string> makeProgramLines(int n) {
+   vector<string> lines;
+   for (int i = 0; i < n; i++) {
+      ostringstream out;
+      out << (i + 1) * 10 << ' ';
+      switch (i % 6) {
+      case 0: out << "LET v" << i % 8 << " = " << makeExpression(5, i); break;
+      case 1: out << "PRINT \"total is\", " << makeExpression(3, i); break;
+      case 2: out << "IF " << makeExpression(3, i) << " > 100 THEN 10"; break;
+      case 3: out << "total = total + " << makeExpression(7, i); break;
+      case 4: out << "REM keep the running total in total"; break;
+      case 5: out << "GOTO " << (i / 2 + 1) * 10; break;
+      }
+      lines.push_back(out.str());
+   }
+   return lines;
+}
+
+/*
+ * Function: makeLineNumbers
+ * Usage: vector<int> numbers = makeLineNumbers(n, sparse);
+ * --------------------------------------------------------
+ * Returns n distinct line numbers.  Dense numbers are 10, 20, 30 and
+ * so on in order; sparse numbers are spread over a range a thousand
+ * times larger and come in a scrambled order.
+ */
+
+static vector<int> makeLineNumbers(int n, bool sparse) {
+   vector<int> numbers(n);
+   for (int i = 0; i < n; i++) {
+      numbers[i] = sparse ? i * 1000 + (i * 7919) % 1000 : (i + 1) * 10;
+   }
+   if (sparse) {
+      unsigned int state = 12345;
+      for (int i = n - 1; i > 0; i--) {
+         state = state * 1103515245u + 12345u;
+         swap(numbers[i], numbers[(state >> 8) % (i + 1)]);
+      }
+   }
+   return numbers;
+}
+
+/* Lexer benchmarks */
+
+struct LexerData {
+   string text;
+};
+
+static double benchLexer(BenchContext & ctx, long n, void *data) {
+   const string & text = ((LexerData *) data)->text;
+   Lexer lexer;
+   double sum = 0;
+   ctx.start();
+   for (long i = 0; i < n; i++) {
+      const char *cp = text.data();
+      const char *end = cp + text.size();
+      while (cp < end) {
+         const char *eol = (const char *) memchr(cp, '\n', end - cp);
+         if (eol == NULL) eol = end;
+         lexer.setInput(cp, eol);
+         while (true) {
+            Token token = lexer.nextToken();
+            if (token.kind == END_TOKEN) break;
+            sum += token.length + token.keyword;
+         }
+         cp = eol + 1;
+      }
+   }
+   ctx.stop();
+   return sum;
+}
+
+/* Parser benchmarks */
+
+struct ParseData {
+   vector<string> lines;
+};
+
+static double benchParseStatement(BenchContext & ctx, long n, void *data) {
+   const vector<string> & lines = ((ParseData *) data)->lines;
+   Arena arena;
+   Lexer lexer;
+   double sum = 0;
+   int nLines = lines.size();
+   ctx.start();
+   for (long i = 0; i < n; i++) {
+      const string & line = lines[i % nLines];
+      lexer.setInput(line);
+      sum += lexer.nextToken().number;
+      sum += (parseStatement(lexer, arena) != NULL);
+      if (i % ARENA_BATCH == ARENA_BATCH - 1) arena.clear();
+   }
+   ctx.stop();
+   return sum;
+}
+
+struct ExpressionData {
+   string text;
+};
+
+static double benchReadE(BenchContext & ctx, long n, void *data) {
+   const string & text = ((ExpressionData *) data)->text;
+   Arena arena;
+   Lexer lexer;
+   double sum = 0;
+   ctx.start();
+   for (long i = 0; i < n; i++) {
+      lexer.setInput(text);
+      sum += (readE(lexer, arena) != NULL);
+      if (i % ARENA_BATCH == ARENA_BATCH - 1) arena.clear();
+   }
+   ctx.stop();
+   return sum;
+}
+
+/* Program benchmarks */
+
+struct ProgramData {
+   vector<int> numbers;
+   Program program;
+};
+
+static void fillProgram(Program & program, const vector<int> & numbers) {
+   for (size_t i = 0; i < numbers.size(); i++) {
+      program.addSourceLine(numbers[i], "PRINT 1");
+   }
+}
+
+static double benchAddLines(BenchContext & ctx, long n, void *data) {
+   ProgramData *pd = (ProgramData *) data;
+   double sum = 0;
+   ctx.start();
+   for (long i = 0; i < n; i++) {
+      fillProgram(pd->program, pd->numbers);
+      sum += pd->program.getFirstLineNumber();
+      ctx.pause();
+      pd->program.clear();
+      ctx.resume();
+   }
+   ctx.stop();
+   return sum;
+}
+
+static double benchRemoveLines(BenchContext & ctx, long n, void *data) {
+   ProgramData *pd = (ProgramData *) data;
+   double sum = 0;
+   ctx.start();
+   for (long i = 0; i < n; i++) {
+      ctx.pause();
+      fillProgram(pd->program, pd->numbers);
+      ctx.resume();
+      for (size_t k = 0; k < pd->numbers.size(); k++) {
+         pd->program.removeSourceLine(pd->numbers[k]);
+      }
+      sum += pd->program.getFirstLineNumber();
+   }
+   ctx.stop();
+   pd->program.clear();
+   return sum;
+}
+
+static double benchNextLine(BenchContext & ctx, long n, void *data) {
+   ProgramData *pd = (ProgramData *) data;
+   fillProgram(pd->program, pd->numbers);
+   double sum = 0;
+   ctx.start();
+   for (long i = 0; i < n; i++) {
+      int line = pd->program.getFirstLineNumber();
+      while (line != -1) {
+         sum += line;
+         line = pd->program.getNextLineNumber(line);
+      }
+   }
+   ctx.stop();
+   pd->program.clear();
+   return sum;
+}
+
+/* Evaluator benchmarks */
+
+struct EvalData {
+   Arena arena;
+   Expression *exp;
+   PostfixCode code;
+   EvalState state;
+   vector<int> slots;
+};
+
+static double benchTreeEval(BenchContext & ctx, long n, void *data) {
+   EvalData *ed = (EvalData *) data;
+   double sum = 0;
+   ctx.start();
+   for (long i = 0; i < n; i++) {
+      sum += ed->exp->eval(ed->state);
+   }
+   ctx.stop();
+   return sum;
+}
+
+static double benchPostfixEval(BenchContext & ctx, long n, void *data) {
+   EvalData *ed = (EvalData *) data;
+   double sum = 0;
+   ctx.start();
+   for (long i = 0; i < n; i++) {
+      sum += evalPostfix(ed->code, ed->state);
+   }
+   ctx.stop();
+   return sum;
+}
+
+static double benchStateLookup(BenchContext & ctx, long n, void *data) {
+   EvalData *ed = (EvalData *) data;
+   const vector<int> & slots = ed->slots;
+   int mask = slots.size() - 1;
+   double sum = 0;
+   ctx.start();
+   for (long i = 0; i < n; i++) {
+      int slot = slots[i & mask];
+      if (ed->state.isDefined(slot)) sum += ed->state.getValue(slot);
+   }
+   ctx.stop();
+   return sum;
+}
+
+static double benchStateStore(BenchContext & ctx, long n, void *data) {
+   EvalData *ed = (EvalData *) data;
+   const vector<int> & slots = ed->slots;
+   int mask = slots.size() - 1;
+   ctx.start();
+   for (long i = 0; i < n; i++) {
+      ed->state.setValue(slots[i & mask], (double) i);
+   }
+   ctx.stop();
+   return ed->state.getValue(slots[0]);
+}
+
+struct InternData {
+   vector<string> names;
+};
+
+static double benchIntern(BenchContext & ctx, long n, void *data) {
+   const vector<string> & names = ((InternData *) data)->names;
+   int mask = names.size() - 1;
+   double sum = 0;
+   ctx.start();
+   for (long i = 0; i < n; i++) {
+      const string & name = names[i & mask];
+      sum += getVariableSlot(name.data(), name.size());
+   }
+   ctx.stop();
+   return sum;
+}
+
+/* Vector kernel benchmarks */
+
+/*
+ * Implementation notes: vector kernels
+ * ------------------------------------
+ * The level is shared by the whole process, so each benchmark sets
+ * its own before it starts the clock.  The operands are arrays of an
+ * EvalState, aligned as the arrays of a program are, and fit in the
+ * second level cache, which measures the kernels rather than memory.
+ */
+
+struct SimdData {
+   SimdLevel level;
+   EvalState state;
+   double *x, *y, *dst;
+};
+
+static double benchCombine(BenchContext & ctx, long n, void *data) {
+   SimdData *vd = (SimdData *) data;
+   setSimdLevel(vd->level);
+   ctx.start();
+   for (long i = 0; i < n; i++) {
+      combineVectors(ARRAY_ADD, vd->dst, vd->x, vd->y, VECTOR_LENGTH);
+   }
+   ctx.stop();
+   return vd->dst[0];
+}
+
+static double benchSum(BenchContext & ctx, long n, void *data) {
+   SimdData *vd = (SimdData *) data;
+   setSimdLevel(vd->level);
+   double sum = 0;
+   ctx.start();
+   for (long i = 0; i < n; i++) {
+      sum += sumVector(vd->x, VECTOR_LENGTH);
+   }
+   ctx.stop();
+   return sum;
+}
+
+static double benchDot(BenchContext & ctx, long n, void *data) {
+   SimdData *vd = (SimdData *) data;
+   setSimdLevel(vd->level);
+   double sum = 0;
+   ctx.start();
+   for (long i = 0; i < n; i++) {
+      sum += dotVectors(vd->x, vd->y, VECTOR_LENGTH);
+   }
+   ctx.stop();
+   return sum;
+}
+
+/* Matrix kernel benchmarks */
+
+/*
+ * Implementation notes: matrix kernels
+ * ------------------------------------
+ * Like the level of the vector kernels, the thread count is shared
+ * by the whole process and set by each benchmark before it starts the
+ * clock; every matrix benchmark runs at the best level there is.  The
+ * product is timed at an order large enough to be split over threads
+ * and counts MATRIX_ORDER cubed multiply-adds per operation.
+ */
+
+struct MatrixData {
+   int nThreads;
+   EvalState state;
+   double *a, *b, *c;
+};
+
+static void setMatrixContext(MatrixData *md) {
+   setSimdLevel(getSupportedSimdLevel());
+   setMatrixThreadCount(md->nThreads);
+}
+
+static double benchMatrixMultiply(BenchContext & ctx, long n, void *data) {
+   MatrixData *md = (MatrixData *) data;
+   setMatrixContext(md);
+   ctx.start();
+   for (long i = 0; i < n; i++) {
+      multiplyMatrices(md->c, md->a, md->b, MATRIX_ORDER, MATRIX_ORDER,
+                       MATRIX_ORDER);
+   }
+   ctx.stop();
+   return md->c[0];
+}
+
+static double benchMatrixTranspose(BenchContext & ctx, long n, void *data) {
+   MatrixData *md = (MatrixData *) data;
+   setMatrixContext(md);
+   ctx.start();
+   for (long i = 0; i < n; i++) {
+      transposeMatrix(md->c, md->a, MATRIX_ORDER, MATRIX_ORDER);
+   }
+   ctx.stop();
+   return md->c[1];
+}
+
+static double benchMatrixInvert(BenchContext & ctx, long n, void *data) {
+   MatrixData *md = (MatrixData *) data;
+   setMatrixContext(md);
+   double sum = 0;
+   ctx.start();
+   for (long i = 0; i < n; i++) {
+      sum += invertMatrix(md->c, md->a, MATRIX_ORDER);
+   }
+   ctx.stop();
+   return sum + md->c[0];
+}
+
+/* Registration */
+
+/*
+ * Implementation notes: addBenchmarks
+ * -----------------------------------
+ * The data of every benchmark is built here, once, and deliberately
+ * never freed, since it lives until the program exits.  The Program
+ * benchmarks run at every power of ten from 1000 lines up to
+ * maxLines, with dense and with sparse numbering.
+ */
+
+static void addBenchmark(vector<Benchmark> & list, const string & name,
+                         BenchFn fn, void *data, double itemsPerOp) {
+   Benchmark bench;
+   bench.name = name;
+   bench.fn = fn;
+   bench.data = data;
+   bench.itemsPerOp = itemsPerOp;
+   list.push_back(bench);
+}
+
+static EvalData *makeEvalData(int nTerms) {
+   EvalData *ed = new EvalData;
+   for (int i = 0; i < 8; i++) {
+      ed->state.setValue(getVariableSlot("v" + integerToString(i)), i + 1.5);
+   }
+   string text = makeExpression(nTerms, 1);
+   Lexer lexer(text);
+   ed->exp = readE(lexer, ed->arena);
+   ed->code = compilePostfix(ed->exp, ed->arena);
+   for (int i = 0; i < 64; i++) {
+      int slot = getVariableSlot("bench" + integerToString(i));
+      ed->state.setValue(slot, i);
+      ed->slots.push_back(slot);
+   }
+   return ed;
+}
+
+static vector<Benchmark> makeBenchmarks(int maxLines) {
+   vector<Benchmark> list;
+   LexerData *ld = new LexerData;
+   vector<string> lines = makeProgramLines(SAMPLE_LINES);
+   for (size_t i = 0; i < lines.size(); i++) {
+      ld->text += lines[i] + "\n";
+   }
+   addBenchmark(list, "lexer/program_bytes", benchLexer, ld, ld->text.size());
+   ParseData *pd = new ParseData;
+   pd->lines = lines;
+   addBenchmark(list, "parser/parseStatement", benchParseStatement, pd, 1);
+   int sizes[] = { 4, 16, 64, 256 };
+   for (int i = 0; i < 4; i++) {
+      ExpressionData *xd = new ExpressionData;
+      xd->text = makeExpression(sizes[i], 0);
+      addBenchmark(list, "parser/readE/terms_" + integerToString(sizes[i]),
+                   benchReadE, xd, sizes[i]);
+   }
+   for (int n = 1000; n <= maxLines; n *= 10) {
+      for (int sparse = 0; sparse < 2; sparse++) {
+         string suffix = string(sparse ? "sparse_" : "dense_") + integerToString(n);
+         ProgramData *add = new ProgramData;
+         add->numbers = makeLineNumbers(n, sparse != 0);
+         addBenchmark(list, "program/addSourceLine/" + suffix, benchAddLines, add, n);
+         ProgramData *remove = new ProgramData;
+         remove->numbers = add->numbers;
+         addBenchmark(list, "program/removeSourceLine/" + suffix,
+                      benchRemoveLines, remove, n);
+         ProgramData *next = new ProgramData;
+         next->numbers = add->numbers;
+         addBenchmark(list, "program/getNextLineNumber/" + suffix,
+                      benchNextLine, next, n);
+      }
+      if (n > maxLines / 10) break;
+   }
+   for (int i = 0; i < 3; i++) {
+      EvalData *ed = makeEvalData(sizes[i]);
+      string suffix = "/terms_" + integerToString(sizes[i]);
+      addBenchmark(list, "eval/tree" + suffix, benchTreeEval, ed, sizes[i]);
+      addBenchmark(list, "eval/postfix" + suffix, benchPostfixEval, ed, sizes[i]);
+   }
+   EvalData *sd = makeEvalData(4);
+   addBenchmark(list, "evalstate/lookup", benchStateLookup, sd, 1);
+   addBenchmark(list, "evalstate/store", benchStateStore, sd, 1);
+   InternData *id = new InternData;
+   for (int i = 0; i < 64; i++) {
+      id->names.push_back("bench" + integerToString(i));
+   }
+   addBenchmark(list, "evalstate/getVariableSlot", benchIntern, id, 1);
+   for (int level = SIMD_SCALAR; level <= getSupportedSimdLevel(); level++) {
+      SimdData *vd = new SimdData;
+      vd->level = (SimdLevel) level;
+      double **blocks[] = { &vd->x, &vd->y, &vd->dst };
+      for (int k = 0; k < 3; k++) {
+         int slot = getVariableSlot("simd" + integerToString(k));
+         vd->state.dimArray(slot, 1, VECTOR_LENGTH, 1);
+         *blocks[k] = vd->state.getDimensionedArray(slot).data;
+      }
+      for (int i = 0; i < VECTOR_LENGTH; i++) {
+         vd->x[i] = i * 0.5;
+         vd->y[i] = 1.0 / (i + 1);
+      }
+      string prefix = string("simd/") + simdLevelName(vd->level) + "/";
+      string suffix = "_" + integerToString(VECTOR_LENGTH);
+      addBenchmark(list, prefix + "add" + suffix, benchCombine, vd, VECTOR_LENGTH);
+      addBenchmark(list, prefix + "sum" + suffix, benchSum, vd, VECTOR_LENGTH);
+      addBenchmark(list, prefix + "dot" + suffix, benchDot, vd, VECTOR_LENGTH);
+   }
+   int threadCounts[] = { 1, getMatrixThreadCount() };
+   for (int t = 0; t < 2; t++) {
+      if (t > 0 && threadCounts[t] == 1) break;
+      MatrixData *md = new MatrixData;
+      md->nThreads = threadCounts[t];
+      double **blocks[] = { &md->a, &md->b, &md->c };
+      for (int k = 0; k < 3; k++) {
+         int slot = getVariableSlot("matrix" + integerToString(k));
+         md->state.dimArray(slot, 2, MATRIX_ORDER, MATRIX_ORDER);
+         *blocks[k] = md->state.getDimensionedArray(slot).data;
+      }
+      for (int i = 0; i < MATRIX_ORDER * MATRIX_ORDER; i++) {
+         md->a[i] = (i % 7) - 3 + ((i % (MATRIX_ORDER + 1) == 0) ? MATRIX_ORDER : 0);
+         md->b[i] = 1.0 / (i % 13 + 1);
+      }
+      string prefix = "matrix/threads_" + integerToString(md->nThreads) + "/";
+      string suffix = "_" + integerToString(MATRIX_ORDER);
+      double cube = (double) MATRIX_ORDER * MATRIX_ORDER * MATRIX_ORDER;
+      addBenchmark(list, prefix + "mul" + suffix, benchMatrixMultiply, md, cube);
+      addBenchmark(list, prefix + "trn" + suffix, benchMatrixTranspose, md,
+                   MATRIX_ORDER * MATRIX_ORDER);
+      addBenchmark(list, prefix + "inv" + suffix, benchMatrixInvert, md, cube);
+   }
+   return list;
+}
+
+/* Running */
+
+/*
+ * Implementation notes: runBenchmark
+ * ----------------------------------
+ * The number of operations per repeat is found by doubling from one
+ * until a batch takes a tenth of the minimum time, then scaling up to
+ * the minimum time.  A benchmark whose single operation already takes
+ * longer, such as building a million-line program, runs once per
+ * repeat.
+ */
+
+static BenchResult runBenchmark(const Benchmark & bench, double minTime,
+                                int repeats) {
+   BenchContext ctx;
+   long n = 1;
+   double elapsed = 0;
+   while (n < CALIBRATION_LIMIT) {
+      benchSink = benchSink + bench.fn(ctx, n, bench.data);
+      elapsed = ctx.stop();
+      if (elapsed >= minTime / 10) break;
+      n *= 2;
+   }
+   if (elapsed < minTime && elapsed > 0) {
+      double scaled = n * (minTime / elapsed);
+      n = (scaled < CALIBRATION_LIMIT) ? (long) scaled : CALIBRATION_LIMIT;
+   }
+   vector<double> times;
+   for (int r = 0; r < repeats; r++) {
+      benchSink = benchSink + bench.fn(ctx, n, bench.data);
+      times.push_back(ctx.stop() * 1e9 / n);
+   }
+   sort(times.begin(), times.end());
+   BenchResult result;
+   result.name = bench.name;
+   result.iterations = n;
+   result.repeats = repeats;
+   result.nsPerOp = times[times.size() / 2];
+   result.minNsPerOp = times[0];
+   result.itemsPerOp = bench.itemsPerOp;
+   return result;
+}
+
+/* Output */
+
+static string formatDouble(double value) {
+   char buffer[64];
+   sprintf(buffer, "%.6g", value);
+   return buffer;
+}
+
+static string quoteJson(const string & str) {
+   string quoted = "\"";
+   for (size_t i = 0; i < str.size(); i++) {
+      char ch = str[i];
+      if (ch == '"' || ch == '\\') {
+         quoted += '\\';
+         quoted += ch;
+      } else if ((unsigned char) ch < 0x20) {
+         char buffer[8];
+         sprintf(buffer, "\\u%04x", ch);
+         quoted += buffer;
+      } else {
+         quoted += ch;
+      }
+   }
+   return quoted + "\"";
+}
+
+static string quoteCsv(const string & str) {
+   if (str.find_first_of(",\"\n") == string::npos) return str;
+   string quoted = "\"";
+   for (size_t i = 0; i < str.size(); i++) {
+      if (str[i] == '"') quoted += '"';
+      quoted += str[i];
+   }
+   return quoted + "\"";
+}
+
+static double itemsPerSecond(const BenchResult & result) {
+   return result.itemsPerOp * 1e9 / result.nsPerOp;
+}
+
+static void writeJsonHeader(const string & label) {
+   cout << "{\"suite\": \"microbench\", \"label\": " << quoteJson(label)
+        << ", \"results\": [";
+}
+
+static void writeJsonRecord(const BenchResult & result, bool first) {
+   cout << (first ? "\n" : ",\n")
+        << "  {\"name\": " << quoteJson(result.name)
+        << ", \"iterations\": " << result.iterations
+        << ", \"repeats\": " << result.repeats
+        << ", \"ns_per_op\": " << formatDouble(result.nsPerOp)
+        << ", \"min_ns_per_op\": " << formatDouble(result.minNsPerOp)
+        << ", \"items_per_op\": " << formatDouble(result.itemsPerOp)
+        << ", \"items_per_second\": " << formatDouble(itemsPerSecond(result))
+        << "}";
+   cout.flush();
+}
+
+static void writeJsonFooter() {
+   cout << "\n]}" << endl;
+}
+
+static void writeCsvHeader() {
+   cout << "label,name,iterations,repeats,ns_per_op,min_ns_per_op,"
+        << "items_per_op,items_per_second" << endl;
+}
+
+static void writeCsvRecord(const BenchResult & result, const string & label) {
+   cout << quoteCsv(label) << ',' << quoteCsv(result.name) << ','
+        << result.iterations << ',' << result.repeats << ','
+        << formatDouble(result.nsPerOp) << ','
+        << formatDouble(result.minNsPerOp) << ','
+        << formatDouble(result.itemsPerOp) << ','
+        << formatDouble(itemsPerSecond(result)) << endl;
+}
+
+static void printUsage() {
+   cerr << "Usage: microbench [--format json|csv] [--filter text] [--label text]" << endl;
+   cerr << "                  [--min-time seconds] [--repeats n] [--max-lines n]" << endl;
+   cerr << "                  [--list]" << endl;
+}
+
+/* Main program */
+
+int main(int argc, char *argv[]) {
+   string format = "json";
+   string filter = "";
+   string label = "";
+   double minTime = 0.2;
+   int repeats = 5;
+   int maxLines = 1000000;
+   bool list = false;
+   for (int i = 1; i < argc; i++) {
+      string arg = argv[i];
+      bool hasValue = i + 1 < argc;
+      if (arg == "--format" && hasValue) {
+         format = argv[++i];
+      } else if (arg == "--filter" && hasValue) {
+         filter = argv[++i];
+      } else if (arg == "--label" && hasValue) {
+         label = argv[++i];
+      } else if (arg == "--min-time" && hasValue) {
+         minTime = atof(argv[++i]);
+      } else if (arg == "--repeats" && hasValue) {
+         repeats = atoi(argv[++i]);
+      } else if (arg == "--max-lines" && hasValue) {
+         maxLines = atoi(argv[++i]);
+      } else if (arg == "--list") {
+         list = true;
+      } else {
+         printUsage();
+         return 2;
+      }
+   }
+   if ((format != "json" && format != "csv") || minTime <= 0
+       || repeats < 1 || maxLines < 1000) {
+      printUsage();
+      return 2;
+   }
+   try {
+      vector<Benchmark> benchmarks = makeBenchmarks(maxLines);
+      if (format == "json" && !list) writeJsonHeader(label);
+      if (format == "csv" && !list) writeCsvHeader();
+      bool first = true;
+      for (size_t i = 0; i < benchmarks.size(); i++) {
+         const Benchmark & bench = benchmarks[i];
+         if (bench.name.find(filter) == string::npos) continue;
+         if (list) {
+            cout << bench.name << endl;
+            continue;
+         }
+         BenchResult result = runBenchmark(bench, minTime, repeats);
+         if (format == "json") {
+            writeJsonRecord(result, first);
+         } else {
+            writeCsvRecord(result, label);
+         }
+         first = false;
+      }
+      if (format == "json" && !list) writeJsonFooter();
+   } catch (ErrorException & ex) {
+      cerr << "Error: " << ex.getMessage() << endl;
+      return 1;
+   }
+   return 0;
+}
@@ -10,8 +10,19 @@
  * The following commands are accepted by the interpreter:
  *
  * SAVE - Saves the current program to a text file
+ * SAVE IMAGE - Saves the current program, compiled, as a program image
  * OLD - Loads a previous program from a text file
- * RUN - Runs the stored program
+ * RUN - Runs the stored program (compiled to bytecode)
+ * RUN TREE - Runs the stored program on the reference tree-walking engine
+ * RUN JIT - Runs the stored program, compiling hot loops to native code
+ * RUN FAST - Runs the stored program without updating the debugger;
+ * FAST may be combined with TREE or JIT (eg, RUN TREE FAST)
+ * RUN IMAGE - Runs a program image without loading or parsing any source;
+ * IMAGE may be combined with JIT and FAST (eg, RUN IMAGE JIT FAST)
+ * FLUSH LINE|BLOCK|NEVER - Sets when PRINT output is written out
+ * PROFILE - Runs the stored program and prints the lines it spent the
+ * most time in; PROFILE CSV and PROFILE FOLDED also save the profile
+ * of every line, as CSV or as folded stacks for flame graph tools
  * DEBUG - Runs the stored program line by line
  * LIST - Lists the stored program (w optional limits)
  * CLEAR - Deletes the stored program
@@ -33,6 +44,27 @@
  * <, and > to compare exp1 and exp2. If condition holds, executes line n.
  * If not, program executes the next stored line.
  * END - [Usage: END]: Halts program execution.
+ * DIM - [Usage: DIM A(n), B(n, m)]: Creates arrays of one or two 
+ * dimensions with every element zero. Elements are read and assigned 
+ * as A(i) and B(i, j), counting from 1.
+ * A() = ... - [Usage: A() = B() op C(), A() = B() op k, A() = k op B(),
+ * A() = B() or A() = k]: Assigns to a whole array element by element,
+ * where op is +, -, * or /. SUM(A()) and DOT(A(), B()) give the sum of
+ * the elements of A and the dot product of A and B.
+ * MAT - [Usage: MAT C = A * B, MAT C = TRN(A), MAT C = INV(A), 
+ * MAT C = A + B, MAT C = A - B or MAT C = A]: Assigns to a whole 
+ * matrix: the matrix product, transpose or inverse of two-dimensional
+ * arrays, or their sum, difference or copy. C takes the shape of the
+ * result.
+ * FOR - [Usage: FOR var = exp1 TO exp2 STEP exp3]: Runs the lines up to
+ * the matching NEXT with var counting from exp1 to exp2 by exp3, or by
+ * 1 without STEP. The limit and step are evaluated once, and the loop
+ * is skipped if exp1 is already past exp2.
+ * NEXT - [Usage: NEXT var or NEXT]: Closes the innermost FOR loop, whose
+ * counter var must be if it is named.
+ * WHILE - [Usage: WHILE exp1 op exp2]: Runs the lines up to the matching
+ * WEND as long as the condition, written as in IF, holds.
+ * WEND - [Usage: WEND]: Closes the innermost WHILE loop.
  *
  * -------------------------------------------------------------------
  * == FEATURES ==
@@ -57,21 +89,46 @@
  * - A print() function in program.cpp to show program structure in console.
  * - Typing in an already existing line number with a blank expression
  * removes that line from the program.
+ * - Starting the interpreter with --headless makes every RUN behave as
+ * RUN FAST; only DEBUG updates the graphical debugger.
+ * - "basic run [--tree | --jit] file" runs a program in batch mode:
+ * headless, INPUT values read from standard input, and an exit status
+ * of 0 on success, 1 on a program error and 2 for bad arguments.
+ * - "basic run [--jit] --inputs sets [--threads n] file" runs the
+ * program once per line of sets on all processors, in line order.
+ * - Program images are mapped read-only, so processes running the same
+ * image share its memory.
+ * - Whole-array assignments, SUM and DOT run on SSE2 or AVX vector
+ * kernels, chosen for the processor when the interpreter starts.
+ * - MAT products are cache-blocked and spread over all processors
+ * when the matrices are large.
+ * - FOR/NEXT and WHILE/WEND loops are paired when the program is linked,
+ * and NEXT steps and tests its counter in a single VM instruction that
+ * the JIT turns into a few machine instructions.
  *
  */
 
 #include <cctype>
+#include <cstdlib>
 #include <iostream>
 #include <string>
 #include <fstream>
+#include <vector>
 
 #include "parser.h"
 #include "program.h"
 #include "statement.h"
+#include "bytecode.h"
+#include "vm.h"
+#include "image.h"
+#include "runner.h"
+#include "output.h"
+#include "display.h"
+#include "profiler.h"
 
 #include "graphics.h"
 #include "console.h"
-#include "tokenscanner.h"
+#include "lexer.h"
 #include "simpio.h"
 #include "strlib.h"
 #include "filelib.h"
@@ -93,20 +150,42 @@ static const int WINDOW_WIDTH = 800;
 static const int WINDOW_HEIGHT = 300;
 static const string BG_FILE = "bg.jpg";
 
+/* Exit status of a batch run (see runBatch) */
+static const int BATCH_OK = 0;
+static const int BATCH_PROGRAM_ERROR = 1;
+static const int BATCH_USAGE_ERROR = 2;
+
+/* Number of lines in the table printed by PROFILE */
+static const int PROFILE_LINES = 20;
+
 /* Function prototypes */
 
+int runBatch(int argc, char *argv[]);
+void printUsage();
 void genGraphics();
 void saveFile(Program & program);
+void saveImage(Program & program);
 void loadFile(Program & program, EvalState & state);
+string readWholeFile(ifstream & infile);
+void loadProgramText(string & text, Program & program, EvalState & state,
+                     bool allowCommands);
 void processLine(string line, Program & program, EvalState & state);
-void processCode(int lineNum, string line, 
-				 TokenScanner & scanner, Program & program);
-void processCommand(TokenScanner & scanner, 
+int getLineNumber(const Token & token);
+void processCode(int lineNum, string line, Lexer & lexer, 
+				 Program & program, Display *display);
+void processCommand(Lexer & lexer, 
 					Program & program, EvalState & state);
-void findListLimits(TokenScanner & scanner, int & start, int & end);
+void findListLimits(Lexer & lexer, int & start, int & end);
+void setOutputPolicy(Lexer & lexer);
 void listProgram(Program & program, int index, int end);
-void clearGraphics();
+void clearGraphics(EvalState & state);
+void processRun(Lexer & lexer, Program & program, EvalState & state);
+void processProfile(Lexer & lexer, Program & program, EvalState & state);
 void run(Program & program, EvalState & state);
+void runHeadless(Program & program, EvalState & state);
+void runCompiled(Program & program, EvalState & state, bool useJit);
+void runImage(EvalState & state, bool useJit);
+void runCode(const CodeView & view, EvalState & state, bool useJit);
 void debug(Program & program, EvalState & state);
 void reloadCurrentLineGraphics();
 void printHelpMsg();
@@ -116,24 +195,146 @@ void printFeatures();
 
 
 /* Main program */
-int main() {
-   string title = "BASIC Interpreter | Win32";
-   Win32::SetConsoleTitle(title.c_str());
-
+int main(int argc, char *argv[]) {
+   if (argc > 1 && string(argv[1]) == "run") {
+      return runBatch(argc, argv);
+   }
    EvalState state;
    Program program;
+   Display display(&getWindowSink());
+   state.setDisplay(&display);
+   for (int i = 1; i < argc; i++) {
+      if (string(argv[i]) == "--headless") {
+         state.setHeadless(true);
+      } else {
+         printUsage();
+         return BATCH_USAGE_ERROR;
+      }
+   }
+   string title = "BASIC Interpreter | Win32";
+   Win32::SetConsoleTitle(title.c_str());
    genGraphics();
    cout << "An Awesome BASIC Interpreter! -- Type HELP for help" << endl << endl;
    while (true) {
       try {
          processLine(getLine("=> "), program, state);
       } catch (ErrorException & ex) {
+          flushOutput();
           cerr << "Error: " << ex.getMessage() << endl;
       }
    }
    return 0;
 }
 
+/*
+ * Function: runBatch
+ * Usage: return runBatch(argc, argv);
+ * ---------------------------------------------------
+ * Implements "basic run [--tree | --jit] file": loads the
+ * program in file and runs it headless, without a window or
+ * a prompt, on the VM unless an engine is given. INPUT
+ * reads its values, separated by spaces or newlines, from
+ * standard input and PRINT writes to standard output, so
+ * the interpreter can sit in a pipeline. Errors go to
+ * standard error, and the exit status is BATCH_OK,
+ * BATCH_PROGRAM_ERROR if the program fails to parse or
+ * run, or BATCH_USAGE_ERROR if the arguments are wrong or
+ * a file cannot be read. Every line of the file must be
+ * numbered; commands are only accepted by OLD.
+ *
+ * With "--inputs sets", the program is compiled once and
+ * run for every line of the file sets, each line holding
+ * the INPUT values of one run, by the batch runner (see
+ * runner.h) on "--threads n" threads, by default one per
+ * processor. The outputs appear in the order of the lines.
+ */
+int runBatch(int argc, char *argv[]) {
+   string filename = "";
+   string inputsFile = "";
+   int nThreads = getDefaultThreadCount();
+   bool tree = false;
+   bool jit = false;
+   for (int i = 2; i < argc; i++) {
+      string arg = argv[i];
+      if (arg == "--tree") {
+         tree = true;
+      } else if (arg == "--jit") {
+         jit = true;
+      } else if (arg == "--inputs" && i + 1 < argc) {
+         inputsFile = argv[++i];
+      } else if (arg == "--threads" && i + 1 < argc) {
+         nThreads = atoi(argv[++i]);
+         if (nThreads < 1) {
+            printUsage();
+            return BATCH_USAGE_ERROR;
+         }
+      } else if (filename == "" && arg != "" && arg[0] != '-') {
+         filename = arg;
+      } else {
+         printUsage();
+         return BATCH_USAGE_ERROR;
+      }
+   }
+   if (filename == "" || (tree && jit) || (tree && inputsFile != "")) {
+      printUsage();
+      return BATCH_USAGE_ERROR;
+   }
+   ifstream infile(filename.c_str());
+   if (infile.fail()) {
+      cerr << "basic: cannot open " << filename << endl;
+      return BATCH_USAGE_ERROR;
+   }
+   string text = readWholeFile(infile);
+   infile.close();
+   vector<string> inputSets;
+   if (inputsFile != "") {
+      ifstream sets(inputsFile.c_str());
+      if (sets.fail()) {
+         cerr << "basic: cannot open " << inputsFile << endl;
+         return BATCH_USAGE_ERROR;
+      }
+      string line;
+      while (getline(sets, line)) {
+         inputSets.push_back(line);
+      }
+   }
+   EvalState state;
+   Program program;
+   state.setHeadless(true);
+   state.setInput(&cin);
+   try {
+      loadProgramText(text, program, state, false);
+      if (inputsFile != "") {
+         program.link();
+         Bytecode bc;
+         compileProgram(program, bc);
+         int failures = runInputSets(getCodeView(bc), inputSets, jit, nThreads);
+         return (failures == 0) ? BATCH_OK : BATCH_PROGRAM_ERROR;
+      } else if (tree) {
+         run(program, state);
+      } else {
+         runCompiled(program, state, jit);
+      }
+   } catch (ErrorException & ex) {
+      flushOutput();
+      cerr << "Error: " << ex.getMessage() << endl;
+      return BATCH_PROGRAM_ERROR;
+   }
+   return BATCH_OK;
+}
+
+/*
+ * Function: printUsage
+ * Usage: printUsage();
+ * ---------------------------------------------------
+ * Prints the command-line syntax to standard error.
+ */
+void printUsage() {
+   cerr << "Usage: basic [--headless]" << endl;
+   cerr << "       basic run [--tree | --jit] file" << endl;
+   cerr << "       basic run [--jit] --inputs sets [--threads n] file" << endl;
+}
+
 /*
  * Function: genGraphics
  * Usage: genGraphics();
@@ -171,36 +372,45 @@ void genGraphics() {
  * is a command or a line of code. Processes input accordingly.  
  */
 void processLine(string line, Program & program, EvalState & state) {
-   TokenScanner scanner;
-   scanner.ignoreWhitespace();
-   scanner.scanNumbers();
-   scanner.setInput(line);
-   string firstTerm = scanner.nextToken();
-   if (scanner.getTokenType(firstTerm) == NUMBER) {
-	   int lineNum = stringToInteger(firstTerm);
-	   processCode(lineNum, line, scanner, program);
+   Lexer lexer(line);
+   if (lexer.peekToken().kind == NUMBER_TOKEN) {
+	   int lineNum = getLineNumber(lexer.nextToken());
+	   processCode(lineNum, line, lexer, program, state.getDisplay());
    } else {
-	   scanner.saveToken(firstTerm);
-	   processCommand(scanner, program, state);
+	   processCommand(lexer, program, state);
    }
 }
 
+/*
+ * Function: getLineNumber
+ * Usage: int lineNum = getLineNumber(token);
+ * -----------------------------------------
+ * Returns the line number written as token, which must be a
+ * number token. A number that is not a plain integer is
+ * reported as an illegal integer.
+ */
+int getLineNumber(const Token & token) {
+   if (token.isInteger()) return (int) token.number;
+   return stringToInteger(token.getText());
+}
+
 /*
  * Function: processCode
- * Usage: processCode(lineNum, line, scanner, program);
+ * Usage: processCode(lineNum, line, lexer, program, display);
  * ------------------------------------------------------
  * Receives a single line of code, and stores it in both a 
  * string and a parsed executable form. Storage is according 
- * to number at the beginning of the line.
+ * to number at the beginning of the line. The new statement
+ * is described on display, if any.
  * If line only has a number, and if some code is already
  * stored corresponding to that number, the corresponding code 
  * is deleted from storage.
  */
-void processCode(int lineNum, string line, 
-				 TokenScanner & scanner, Program & program){
-	if (scanner.hasMoreTokens()){
+void processCode(int lineNum, string line, Lexer & lexer, 
+				 Program & program, Display *display){
+	if (lexer.hasMoreTokens()){
+	  Statement *stmt = parseStatement(lexer, program.getArena(), display);
 	  program.addSourceLine(lineNum, line);
-	  Statement *stmt = parseStatement(scanner);
 	  program.setParsedStatement(lineNum, stmt);
 	} else {
 	  program.removeSourceLine(lineNum);
@@ -209,36 +419,68 @@ void processCode(int lineNum, string line,
 
 /*
  * Function: processCommand
- * Usage: processCommand(firstTerm, program, state);
- * ------------------------------------------------------
+ * Usage: processCommand(lexer, program, state);
+ * --------------------------------------------------
  * Receives a single command and checks its validity.
  * If valid, carries out the corresponding operation (as 
- * defined in documentation intro).
+ * defined in documentation intro). The command is chosen
+ * by the keyword the lexer found, in any case.
  */
-void processCommand(TokenScanner & scanner, 
+void processCommand(Lexer & lexer, 
 					Program & program, EvalState & state){
-   string firstTerm = toUpperCase(scanner.nextToken());
-   if(firstTerm == "SAVE") {
-	   saveFile(program);
-   } else if(firstTerm == "OLD") {
+   Token firstTerm = lexer.nextToken();
+   switch (firstTerm.keyword) {
+   case SAVE_KW:
+	   if (!lexer.hasMoreTokens()) {
+		   saveFile(program);
+	   } else if (lexer.nextToken().keyword == IMAGE_KW) {
+		   saveImage(program);
+	   } else {
+		   error("SAVE can only be followed by IMAGE");
+	   }
+	   break;
+   case OLD_KW:
 	   loadFile(program, state);
-   } else if(firstTerm == "RUN") {
-	   run(program, state);
-   } else if(firstTerm == "DEBUG") {
-	  debug(program, state);
-   } else if(firstTerm == "LIST") {
+	   break;
+   case RUN_KW:
+	   processRun(lexer, program, state);
+	   break;
+   case DEBUG_KW: {
+	  bool headless = state.isHeadless();
+	  state.setHeadless(false);
+	  try {
+		  debug(program, state);
+	  } catch (...) {
+		  state.setHeadless(headless);
+		  throw;
+	  }
+	  state.setHeadless(headless);
+	  break;
+   }
+   case PROFILE_KW:
+	   processProfile(lexer, program, state);
+	   break;
+   case FLUSH_KW:
+	   setOutputPolicy(lexer);
+	   break;
+   case LIST_KW: {
 	   int start, end;
-	   findListLimits(scanner, start, end);
+	   findListLimits(lexer, start, end);
 	   listProgram(program, start, end);
-   } else if(firstTerm == "CLEAR") {
-	   clearGraphics();
+	   break;
+   }
+   case CLEAR_KW:
+	   clearGraphics(state);
 	   program.clear();
-   } else if(firstTerm == "HELP") {
+	   break;
+   case HELP_KW:
 	   printHelpMsg();
-   } else if(firstTerm == "QUIT") {
+	   break;
+   case QUIT_KW:
 	   exit(0);
-   } else {
-	   error("Invalid beginning: " + firstTerm + ". Type HELP for help.");
+   default:
+	   error("Invalid beginning: " + toUpperCase(firstTerm.getText()) 
+			 + ". Type HELP for help.");
    }
 }
 
@@ -261,6 +503,22 @@ void saveFile(Program & program){
 	outfile.close();
 }
 
+/*
+ * Function: saveImage
+ * Usage: saveImage(program);
+ * --------------------------------------------------------
+ * Compiles the program and saves it as a program image (see
+ * image.h) under a file name entered by the user. RUN IMAGE
+ * runs the image later without parsing the program again.
+ */
+void saveImage(Program & program){
+	program.link();
+	Bytecode bc;
+	compileProgram(program, bc);
+	writeImage(bc, getLine("Choose image filename: "));
+	cout << "Image saved." << endl;
+}
+
 /*
  * Function: loadFile
  * Usage: loadFile(program, state);
@@ -272,30 +530,101 @@ void saveFile(Program & program){
 void loadFile(Program & program, EvalState & state){
    ifstream infile;
    promptUserForFile(infile, "Enter filename containing code: ");
-   clearGraphics();
-   while(!infile.eof()){
-	   string str;
-	   getline (infile, str);
-	   if (str != "") processLine(str, program, state);
-   }
-   cout << "Program loaded -- Type LIST to view." << endl;
+   clearGraphics(state);
+   string text = readWholeFile(infile);
    infile.close();
+   loadProgramText(text, program, state, true);
+   cout << "Program loaded -- Type LIST to view." << endl;
 }
 
+/*
+ * Function: readWholeFile
+ * Usage: string text = readWholeFile(infile);
+ * --------------------------------------------------
+ * Reads the rest of an open file with a single read.
+ */
+string readWholeFile(ifstream & infile){
+   infile.seekg(0, ios::end);
+   streamoff size = infile.tellg();
+   infile.seekg(0, ios::beg);
+   if (size <= 0) return "";
+   string text((size_t) size, '\0');
+   infile.read(&text[0], size);
+   text.resize((size_t) infile.gcount());
+   return text;
+}
+
+/*
+ * Function: loadProgramText
+ * Usage: loadProgramText(text, program, state, allowCommands);
+ * --------------------------------------------------
+ * Bulk loader behind OLD. Numbered lines are parsed with a
+ * single lexer and collected in a batch, without drawing,
+ * and the batch is sorted and stored in one pass (see
+ * Program::addSourceLines). The result is the same as
+ * entering the lines one by one: the last of several lines
+ * with the same number wins and a bare number removes its
+ * line. A line that is not numbered is a command if
+ * allowCommands is true: the batch before it is stored first
+ * and the command is then processed as if typed. Otherwise,
+ * as in batch mode, where a command such as OLD or QUIT would
+ * read the INPUT data or end the process, it is an error. If a
+ * line fails to parse, the lines before it are kept and the
+ * error is reported.
+ */
+void loadProgramText(string & text, Program & program, EvalState & state,
+                     bool allowCommands){
+   Lexer lexer;
+   vector<SourceLine> batch;
+   try {
+	   size_t start = 0;
+	   while (start < text.size()) {
+		   size_t end = text.find('\n', start);
+		   if (end == string::npos) end = text.size();
+		   size_t length = end - start;
+		   if (length > 0 && text[end - 1] == '\r') length--;
+		   string line = text.substr(start, length);
+		   start = end + 1;
+		   if (line == "") continue;
+		   lexer.setInput(line);
+		   if (lexer.peekToken().kind == NUMBER_TOKEN) {
+			   SourceLine src;
+			   src.lineNumber = getLineNumber(lexer.nextToken());
+			   src.text = line;
+			   src.stmt = NULL;
+			   if (lexer.hasMoreTokens()) {
+				   src.stmt = parseStatement(lexer, program.getArena());
+			   }
+			   batch.push_back(src);
+		   } else if (allowCommands) {
+			   program.addSourceLines(batch);
+			   processLine(line, program, state);
+		   } else {
+			   error("Line without a number: " + line);
+		   }
+	   }
+   } catch (...) {
+	   program.addSourceLines(batch);
+	   throw;
+   }
+   program.addSourceLines(batch);
+}
+
+
 /*
  * Function: findListLimits
- * Usage:  findListLimits(scanner, start, end);
+ * Usage:  findListLimits(lexer, start, end);
  * ------------------------------------------------
  * Finds and returns start and end limits for listing stored 
  * program. If user has not given any limits, then start and 
  * end are desginated as NULL, and the entire program is listed.
  */
-void findListLimits(TokenScanner & scanner, int & start, int & end){
+void findListLimits(Lexer & lexer, int & start, int & end){
    start = NULL;
    end = NULL;
-   if(scanner.hasMoreTokens()) start = stringToInteger(scanner.nextToken());
-   scanner.nextToken();
-   if(scanner.hasMoreTokens()) end = stringToInteger(scanner.nextToken());
+   if(lexer.hasMoreTokens()) start = stringToInteger(lexer.nextToken().getText());
+   lexer.nextToken();
+   if(lexer.hasMoreTokens()) end = stringToInteger(lexer.nextToken().getText());
 }
 
 /*
@@ -305,7 +634,11 @@ void findListLimits(TokenScanner & scanner, int & start, int & end){
  * Receives a stored program and prints it out line-by-line.
  */
 void listProgram(Program & program, int index, int end){
-	if (index == NULL) index = program.getFirstLineNumber();
+	if (index == NULL) {
+		index = program.getFirstLineNumber();
+	} else {
+		index = program.getNextLineNumber(index - 1);
+	}
 	if (end == NULL) {
 		while (index != -1){
 			cout << program.getSourceLine(index) << endl;
@@ -322,16 +655,139 @@ void listProgram(Program & program, int index, int end){
 
 /*
  * Function: clearGraphics
- * Usage: clearGraphics();
+ * Usage: clearGraphics(state);
  * --------------------------------------------------------
  * Draws a white rectangle the size of the window and calls
  * genGraphics to give an effect of graphics reset.
- * Also, Statement objects detect the current color as "#FFFFFF"
- * (white) and begin printing graphics from initial points.
+ * Also resets the display of state, so statements begin
+ * printing graphics from initial points.
  */
-void clearGraphics(){
+void clearGraphics(EvalState & state){
    drawImage(BG_FILE, 0, 0);
    genGraphics();
+   if (state.getDisplay() != NULL) state.getDisplay()->reset();
+}
+
+/*
+ * Function: processRun
+ * Usage: processRun(lexer, program, state);
+ * ----------------------------------------------------
+ * Reads the options following RUN and runs the program on the
+ * selected engine: TREE for the tree-walking engine, JIT for
+ * the VM with native loops, otherwise the plain VM. IMAGE runs
+ * a program image on the VM instead of the stored program. FAST
+ * makes the run headless, so no statement touches the graphics
+ * window. The headless setting of state is restored afterwards.
+ */
+void processRun(Lexer & lexer, Program & program, EvalState & state){
+	Keyword engine = NO_KEYWORD;
+	bool fast = false;
+	bool image = false;
+	while (lexer.hasMoreTokens()) {
+		Token option = lexer.nextToken();
+		if (option.keyword == FAST_KW) {
+			fast = true;
+		} else if (option.keyword == IMAGE_KW) {
+			image = true;
+		} else if (option.keyword == TREE_KW || option.keyword == JIT_KW) {
+			engine = option.keyword;
+		} else {
+			error("Invalid RUN option: " + toUpperCase(option.getText()));
+		}
+	}
+	if (image && engine == TREE_KW) {
+		error("RUN IMAGE cannot be combined with TREE");
+	}
+	bool headless = state.isHeadless();
+	if (fast) state.setHeadless(true);
+	try {
+		if (image) {
+			runImage(state, engine == JIT_KW);
+		} else if (engine == TREE_KW) {
+			run(program, state);
+		} else {
+			runCompiled(program, state, engine == JIT_KW);
+		}
+	} catch (...) {
+		state.setHeadless(headless);
+		throw;
+	}
+	state.setHeadless(headless);
+}
+
+/*
+ * Function: processProfile
+ * Usage: processProfile(lexer, program, state);
+ * ----------------------------------------------------
+ * Runs the stored program under the profiler, headless and on
+ * the tree-walking engine, the only one that still knows which
+ * line it is executing. Prints the lines that took the most time
+ * once the run is over, or has stopped on an error. CSV or
+ * FOLDED then saves the profile of every line to a file chosen
+ * by the user. RUN itself never profiles, so it pays nothing.
+ */
+void processProfile(Lexer & lexer, Program & program, EvalState & state){
+	Keyword format = NO_KEYWORD;
+	if (lexer.hasMoreTokens()) {
+		format = lexer.nextToken().keyword;
+		if (format != CSV_KW && format != FOLDED_KW) {
+			error("PROFILE can only be followed by CSV or FOLDED");
+		}
+	}
+	if (lexer.hasMoreTokens()) {
+		error("Extraneous token " + lexer.nextToken().getText());
+	}
+	program.link();
+	Profiler profiler;
+	bool headless = state.isHeadless();
+	state.setHeadless(true);
+	try {
+		profiler.run(program, state);
+	} catch (...) {
+		state.setHeadless(headless);
+		endOutputLine();
+		flushOutput();
+		profiler.printReport(cout, PROFILE_LINES);
+		throw;
+	}
+	state.setHeadless(headless);
+	endOutputLine();
+	flushOutput();
+	profiler.printReport(cout, PROFILE_LINES);
+	if (format == NO_KEYWORD) return;
+	ofstream outfile;
+	if (format == CSV_KW) {
+		promptUserForFile(outfile, "Choose filename (w extension .csv): ");
+		profiler.writeCsv(outfile);
+	} else {
+		promptUserForFile(outfile, "Choose filename (w extension .folded): ");
+		profiler.writeFolded(outfile);
+	}
+	outfile.close();
+}
+
+/*
+ * Function: setOutputPolicy
+ * Usage: setOutputPolicy(lexer);
+ * ----------------------------------------------------
+ * Reads the policy following FLUSH: LINE writes PRINT output
+ * after every line, BLOCK whenever the output buffer fills and
+ * NEVER only before INPUT, at the end of a run and at exit.
+ */
+void setOutputPolicy(Lexer & lexer){
+	Keyword policy = lexer.nextToken().keyword;
+	if (policy == LINE_KW) {
+		setFlushPolicy(FLUSH_LINE);
+	} else if (policy == BLOCK_KW) {
+		setFlushPolicy(FLUSH_BLOCK);
+	} else if (policy == NEVER_KW) {
+		setFlushPolicy(FLUSH_NEVER);
+	} else {
+		error("FLUSH needs to be followed by LINE, BLOCK or NEVER");
+	}
+	if (lexer.hasMoreTokens()) {
+		error("Extraneous token " + lexer.nextToken().getText());
+	}
 }
 
 /*
@@ -341,32 +797,111 @@ void clearGraphics(){
  * Receives a stored program and executes its statements 
  * by line order. Reloads graphics showing current line if
  * it reaches end of screen.
- * If an IF or GOTO command disrupts execution order with 
- * a given line number, the statement corresponding to that 
- * given number is executed. Normal line order execution 
- * resumes thereafter.
+ * The program is linked first, so each statement is followed
+ * by its linked successor unless an IF, GOTO or END statement
+ * redirects execution to another statement (or halts it), and
+ * the hidden variables of loops start out cleared.
+ * A headless state is run by runHeadless instead.
  */
 void run(Program & program, EvalState & state){
+	program.link();
+	program.clearHiddenVariables(state);
+	if (state.isHeadless()) {
+		runHeadless(program, state);
+		return;
+	}
 	reloadCurrentLineGraphics();
 	double order = getStringWidth("Current Line: ") + 5;
 	drawString("START -> ", order + 5, (WINDOW_HEIGHT-5));
 	order += getStringWidth("START -> ") + 5;
-	int index = program.getFirstLineNumber();
-	while(index != -1){
-		drawString(integerToString(index) + " -> ", order, (WINDOW_HEIGHT-5));
+	Statement *stmt = program.getFirstStatement();
+	while(stmt != NULL){
+		drawString(integerToString(stmt->getLineNumber()) + " -> ", 
+			order, (WINDOW_HEIGHT-5));
 		order += 30;
-		program.getParsedStatement(index)->execute(state);
-		if(state.getNextLine() != NULL) {
-			index = state.getNextLine();
-		} else {
-			index = program.getNextLineNumber(index);
-		}
+		state.setNextStatement(stmt->getSuccessor());
+		stmt->execute(state);
+		stmt = state.getNextStatement();
 		if (order > WINDOW_WIDTH) {
 			reloadCurrentLineGraphics();
 			order = getStringWidth("Current Line: ") + 5; 
 		}
 	}
-	cout << endl;
+	endOutputLine();
+	flushOutput();
+	drawString("END!", order + 5, (getWindowHeight()-5));
+}
+
+/*
+ * Function: runHeadless
+ * Usage:  runHeadless(program, state);
+ * ----------------------------------------------------
+ * The loop of run without the current line display. The
+ * program must already be linked and state headless.
+ */
+void runHeadless(Program & program, EvalState & state){
+	Statement *stmt = program.getFirstStatement();
+	while(stmt != NULL){
+		state.setNextStatement(stmt->getSuccessor());
+		stmt->execute(state);
+		stmt = state.getNextStatement();
+	}
+	endOutputLine();
+	flushOutput();
+}
+
+/*
+ * Function: runCompiled
+ * Usage:  runCompiled(program, state, useJit);
+ * ----------------------------------------------------
+ * Compiles the stored program into a flat bytecode array and
+ * executes it on the stack VM. The statements themselves draw
+ * nothing while the VM runs, so the current line display only
+ * marks the start and end of execution. run remains available
+ * as the reference engine (RUN TREE). With useJit (RUN JIT),
+ * hot loops are compiled to native code where supported.
+ */
+void runCompiled(Program & program, EvalState & state, bool useJit){
+	program.link();
+	Bytecode bc;
+	compileProgram(program, bc);
+	runCode(getCodeView(bc), state, useJit);
+}
+
+/*
+ * Function: runImage
+ * Usage:  runImage(state, useJit);
+ * ----------------------------------------------------
+ * Maps the program image entered by the user and runs it in
+ * place on the stack VM. The stored program is not touched.
+ */
+void runImage(EvalState & state, bool useJit){
+	ProgramImage image(getLine("Enter image filename: "));
+	runCode(image.getView(), state, useJit);
+}
+
+/*
+ * Function: runCode
+ * Usage:  runCode(view, state, useJit);
+ * ----------------------------------------------------
+ * Runs compiled code on the stack VM, marking the start and
+ * end of execution on the current line display. A headless
+ * run draws nothing at all.
+ */
+void runCode(const CodeView & view, EvalState & state, bool useJit){
+	if (state.isHeadless()) {
+		runBytecode(view, state, useJit);
+		endOutputLine();
+		flushOutput();
+		return;
+	}
+	reloadCurrentLineGraphics();
+	double order = getStringWidth("Current Line: ") + 5;
+	drawString("START -> (compiled) -> ", order + 5, (WINDOW_HEIGHT-5));
+	order += getStringWidth("START -> (compiled) -> ") + 5;
+	runBytecode(view, state, useJit);
+	endOutputLine();
+	flushOutput();
 	drawString("END!", order + 5, (getWindowHeight()-5));
 }
 
@@ -382,27 +917,29 @@ void run(Program & program, EvalState & state){
  * execution, see documentation for run.
  */
 void debug(Program & program, EvalState & state){
+	program.link();
+	program.clearHiddenVariables(state);
 	reloadCurrentLineGraphics();
 	double order = getStringWidth("Current Line: ") + 5;
 	drawString("START -> ", order + 5, (WINDOW_HEIGHT-5));
 	order += getStringWidth("START -> ") + 5;
-	int index = program.getFirstLineNumber();
-	while(index != -1){
-		drawString(integerToString(index) + " -> ", order, (getWindowHeight()-5));
+	Statement *stmt = program.getFirstStatement();
+	while(stmt != NULL){
+		drawString(integerToString(stmt->getLineNumber()) + " -> ", 
+			order, (getWindowHeight()-5));
 		order += 30;
-		program.getParsedStatement(index)->execute(state);
-		if(state.getNextLine() != NULL) {
-			index = state.getNextLine();
-		} else {
-			index = program.getNextLineNumber(index);
-		}
+		state.setNextStatement(stmt->getSuccessor());
+		stmt->execute(state);
+		stmt = state.getNextStatement();
+		flushOutput();
 		waitForClick();
 		if (order > WINDOW_WIDTH) {
 			reloadCurrentLineGraphics();
 			order = getStringWidth("Current Line: ") + 5; 
 		}
 	}
-	cout << endl;
+	endOutputLine();
+	flushOutput();
 	drawString("END!", order + 5, (getWindowHeight()-2));
 }
 
@@ -447,8 +984,15 @@ void printHelpMsg(){
 void printCmds(){
 	cout << "The following commands are accepted by the interpreter:" << endl;
 	cout << "SAVE - Saves the current program to a text file" << endl;
+	cout << "SAVE IMAGE - Saves the current program, compiled, as a program image" << endl;
 	cout << "OLD - Loads a previous program from a text file" << endl;
-	cout << "RUN - Runs the stored program" << endl;
+	cout << "RUN - Runs the stored program (compiled to bytecode)" << endl;
+	cout << "RUN TREE - Runs the stored program on the reference tree-walking engine" << endl;
+	cout << "RUN JIT - Runs the stored program, compiling hot loops to native code" << endl;
+	cout << "RUN FAST - Runs the stored program without updating the debugger" << endl;
+	cout << "RUN IMAGE - Runs a program image without parsing any source" << endl;
+	cout << "FLUSH LINE|BLOCK|NEVER - Sets when PRINT output is written out" << endl;
+	cout << "PROFILE [CSV|FOLDED] - Runs the stored program and shows where the time goes" << endl;
 	cout << "DEBUG - Runs the stored program line by line" << endl;
 	cout << "LIST - Lists the stored program" << endl;
 	cout << "CLEAR - Deletes the stored program" << endl;
@@ -485,6 +1029,29 @@ void printStmts(){
 	cout << " not, program executes the next stored line." << endl;
 	cout << "END - [Usage: END]" << endl;
 	cout << "	Halts program execution" << endl;
+	cout << "DIM - [Usage: DIM A(n), B(n, m)]" << endl;
+	cout << "	Creates arrays of one or two dimensions with every element zero.";
+	cout << " Elements are read and assigned as A(i) and B(i, j), counting from 1." << endl;
+	cout << "A() = ... - [Usage: A() = B() op C(), B() op k, k op B(), B() or k]" << endl;
+	cout << "	Assigns to a whole array element by element, where op is +, -, *";
+	cout << " or /. SUM(A()) and DOT(A(), B()) give the sum of the elements of A";
+	cout << " and the dot product of A and B." << endl;
+	cout << "MAT - [Usage: MAT C = A * B, TRN(A), INV(A), A + B, A - B or A]" << endl;
+	cout << "	Assigns to a whole matrix the matrix product, transpose or inverse";
+	cout << " of two-dimensional arrays, or their sum, difference or copy. C takes";
+	cout << " the shape of the result." << endl;
+	cout << "FOR - [Usage: FOR var = exp1 TO exp2 STEP exp3]" << endl;
+	cout << "	Runs the lines up to the matching NEXT with var counting from exp1";
+	cout << " to exp2 by exp3, or by 1 without STEP. The loop is skipped if exp1";
+	cout << " is already past exp2." << endl;
+	cout << "NEXT - [Usage: NEXT var or NEXT]" << endl;
+	cout << "	Closes the innermost FOR loop, whose counter var must be if it is";
+	cout << " named." << endl;
+	cout << "WHILE - [Usage: WHILE exp1 op exp2]" << endl;
+	cout << "	Runs the lines up to the matching WEND as long as the condition,";
+	cout << " written as in IF, holds." << endl;
+	cout << "WEND - [Usage: WEND]" << endl;
+	cout << "	Closes the innermost WHILE loop." << endl;
 	cout << "--------------------------------------------" << endl << endl;
 }
 
@@ -516,5 +1083,16 @@ void printFeatures(){
  cout << "- A print() function in program.cpp to show program structure in console.";
  cout << "- Typing in an already existing line number with a blank expression removes ";
  cout << "that line from the program." << endl;
+ cout << "- Starting the interpreter with --headless makes every RUN behave as RUN FAST." << endl;
+ cout << "- Program images are mapped read-only, so processes running the same";
+ cout << " image share its memory." << endl;
+ cout << "- Whole-array assignments, SUM and DOT run on SSE2 or AVX vector";
+ cout << " kernels, chosen for the processor when the interpreter starts." << endl;
+ cout << "- MAT products are cache-blocked and spread over all processors";
+ cout << " when the matrices are large." << endl;
+ cout << "- FOR/NEXT and WHILE/WEND loops are paired when the program is linked,";
+ cout << " and the JIT compiles each NEXT to a few machine instructions." << endl;
+ cout << "- \"basic run [--tree | --jit] file\" runs a program in batch mode, reading";
+ cout << " INPUT values from standard input; --inputs runs it over many input sets." << endl;
  cout << "--------------------------------------------" << endl << endl;
 }
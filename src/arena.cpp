@@ -0,0 +1,141 @@
+/*
+ * File: arena.cpp
+ * ---------------
+ * Implements the arena.h interface.
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include "arena.h"
+using namespace std;
+
+/*
+ * Constants
+ * ---------
+ * CHUNK_SIZE -- Usable size of an ordinary chunk
+ * ALIGNMENT  -- Every allocation is rounded up to a multiple of this
+ */
+
+static const size_t CHUNK_SIZE = 1 << 16;
+static const size_t ALIGNMENT = 8;
+
+/*
+ * Implementation notes: chunks
+ * ----------------------------
+ * Each chunk is a single malloc block holding its Chunk header
+ * followed by the memory handed out.  The chunks form a list with the
+ * newest one first; allocation bumps next toward limit within that
+ * chunk.  A request too large for an ordinary chunk gets a chunk of
+ * its own.
+ */
+
+Arena::Arena() {
+   chunks = NULL;
+   next = NULL;
+   limit = NULL;
+   used = 0;
+}
+
+Arena::~Arena() {
+   while (chunks != NULL) {
+      Chunk *chunk = chunks;
+      chunks = chunk->next;
+      free(chunk);
+   }
+}
+
+void *Arena::allocate(size_t size) {
+   size = (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+   used += size;
+   if (size > (size_t) (limit - next)) return allocateSlow(size);
+   void *ptr = next;
+   next += size;
+   return ptr;
+}
+
+void *Arena::allocateSlow(size_t size) {
+   size_t capacity = (size > CHUNK_SIZE) ? size : CHUNK_SIZE;
+   size_t header = (sizeof(Chunk) + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+   Chunk *chunk = (Chunk *) malloc(header + capacity);
+   if (chunk == NULL) throw bad_alloc();
+   chunk->next = chunks;
+   chunk->size = capacity;
+   chunks = chunk;
+   next = (char *) chunk + header;
+   limit = next + capacity;
+   void *ptr = next;
+   next += size;
+   return ptr;
+}
+
+const char *Arena::copyString(const string & text) {
+   char *str = (char *) allocate(text.size() + 1);
+   memcpy(str, text.c_str(), text.size() + 1);
+   return str;
+}
+
+/*
+ * Implementation notes: clear
+ * ---------------------------
+ * The newest chunk is kept so that a program that is cleared and
+ * loaded again does not go back to malloc for its first lines.
+ */
+
+void Arena::clear() {
+   if (chunks == NULL) return;
+   while (chunks->next != NULL) {
+      Chunk *chunk = chunks->next;
+      chunks->next = chunk->next;
+      free(chunk);
+   }
+   size_t header = (sizeof(Chunk) + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+   next = (char *) chunks + header;
+   limit = next + chunks->size;
+   used = 0;
+}
+
+/*
+ * Implementation notes: getMark, release
+ * --------------------------------------
+ * A mark records the newest chunk and the bump pointer within it.
+ * Releasing frees the chunks pushed in front of that chunk since and
+ * moves the pointer back; if the arena had no chunk at the mark, it
+ * ends up with none.
+ */
+
+Arena::Mark Arena::getMark() const {
+   Mark mark;
+   mark.chunk = chunks;
+   mark.next = next;
+   mark.used = used;
+   return mark;
+}
+
+void Arena::release(const Mark & mark) {
+   while (chunks != mark.chunk) {
+      Chunk *chunk = chunks;
+      chunks = chunk->next;
+      free(chunk);
+   }
+   next = mark.next;
+   limit = NULL;
+   if (chunks != NULL) {
+      size_t header = (sizeof(Chunk) + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+      limit = (char *) chunks + header + chunks->size;
+   }
+   used = mark.used;
+}
+
+void Arena::swap(Arena & other) {
+   std::swap(chunks, other.chunks);
+   std::swap(next, other.next);
+   std::swap(limit, other.limit);
+   std::swap(used, other.used);
+}
+
+size_t Arena::getBytesUsed() const {
+   return used;
+}
@@ -0,0 +1,157 @@
+/*
+ * File: arena.h
+ * -------------
+ * This interface exports the Arena class, a bump-pointer allocator
+ * for the nodes of a parsed program.  Statements and expressions are
+ * carved one after another out of large chunks, so the nodes of a
+ * line sit next to each other in memory, and the whole program is
+ * released at once by clearing its arena instead of node by node.
+ */
+
+#ifndef _arena_h
+#define _arena_h
+
+#include <cstddef>
+#include <string>
+
+/*
+ * Class: Arena
+ * ------------
+ * Hands out memory that stays valid until the arena is cleared or
+ * destroyed.  Objects placed in an arena are never destroyed
+ * individually, and their destructors do not run, so they must not
+ * own any other storage; strings and arrays they need are allocated
+ * from the same arena.
+ *
+ * Nothing allocated from an arena can be given back on its own; only
+ * the most recent allocations can, by releasing back to a mark.  An
+ * owner that keeps dropping objects, such as a Program whose lines
+ * are edited, has to copy what it still needs into a fresh arena
+ * from time to time and swap it in.
+ */
+
+class Arena {
+
+public:
+
+/*
+ * Constructor: Arena
+ * Usage: Arena arena;
+ * -------------------
+ * Creates an empty arena.  No memory is allocated until it is used.
+ */
+
+   Arena();
+
+/*
+ * Destructor: ~Arena
+ * Usage: usually implicit
+ * -----------------------
+ * Frees every chunk of the arena.
+ */
+
+   ~Arena();
+
+/*
+ * Method: allocate
+ * Usage: void *ptr = arena.allocate(size);
+ * ----------------------------------------
+ * Returns size bytes of memory aligned for any scalar type.
+ */
+
+   void *allocate(size_t size);
+
+/*
+ * Methods: copyString, allocateArray
+ * Usage: const char *str = arena.copyString(text);
+ *        Expression **array = arena.allocateArray<Expression *>(n);
+ * --------------------------------------------------------------
+ * Convenience forms of allocate: copyString returns a null-terminated
+ * copy of text and allocateArray returns uninitialized room for n
+ * objects of type T.
+ */
+
+   const char *copyString(const std::string & text);
+
+   template <typename T>
+   T *allocateArray(int n) {
+      return (T *) allocate(n * sizeof(T));
+   }
+
+/*
+ * Method: clear
+ * Usage: arena.clear();
+ * ---------------------
+ * Releases everything allocated from the arena at once.  The first
+ * chunk is kept for reuse.
+ */
+
+   void clear();
+
+/*
+ * Type: Mark
+ * ----------
+ * A position in an arena, as returned by getMark.
+ */
+
+   struct Mark {
+      void *chunk;
+      char *next;
+      size_t used;
+   };
+
+/*
+ * Methods: getMark, release
+ * Usage: Arena::Mark mark = arena.getMark();
+ *        arena.release(mark);
+ * ----------------------------------------
+ * getMark returns the current position of the arena, and release
+ * gives back everything allocated since mark was taken, freeing the
+ * chunks added since.  The arena must not have been cleared or
+ * released to an earlier mark in between.
+ */
+
+   Mark getMark() const;
+   void release(const Mark & mark);
+
+/*
+ * Method: swap
+ * Usage: arena.swap(other);
+ * -------------------------
+ * Exchanges the contents of two arenas in constant time.
+ */
+
+   void swap(Arena & other);
+
+/*
+ * Method: getBytesUsed
+ * Usage: size_t bytes = arena.getBytesUsed();
+ * -------------------------------------------
+ * Returns the number of bytes handed out since the arena was last
+ * cleared.
+ */
+
+   size_t getBytesUsed() const;
+
+private:
+
+   struct Chunk {
+      Chunk *next;
+      size_t size;
+   };
+
+   Chunk *chunks;
+   char *next;
+   char *limit;
+   size_t used;
+
+   void *allocateSlow(size_t size);
+
+/* Prevent copying */
+
+   Arena(const Arena &);
+   Arena & operator=(const Arena &);
+
+};
+
+#endif
@@ -0,0 +1,181 @@
+/*
+ * File: arrays.cpp
+ * ----------------
+ * Implements the arrays.h interface.
+ */
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include "arrays.h"
+#include "matrix.h"
+#include "error.h"
+#include "strlib.h"
+using namespace std;
+
+/*
+ * Implementation notes: dimensionArray
+ * ------------------------------------
+ * An extent outside the range of int, NaN included, is mapped to 0 or
+ * to one more than MAX_ARRAY_SIZE before it is converted, so that
+ * EvalState::dimArray reports it instead of the conversion failing.
+ */
+
+static int toExtent(double value) {
+   if (value > MAX_ARRAY_SIZE) return MAX_ARRAY_SIZE + 1;
+   if (!(value >= 1)) return 0;
+   return (int) value;
+}
+
+void dimensionArray(EvalState & state, int slot, int rank, double rows,
+                    double cols) {
+   state.dimArray(slot, rank, toExtent(rows), toExtent(cols));
+}
+
+/*
+ * Implementation notes: shapes
+ * ----------------------------
+ * The operands are read before the target is shaped, since shaping a
+ * target that is not yet in the table of arrays may move the entries
+ * of the table.  The blocks holding the elements never move, and a
+ * target that has the shape of its operands, as it does whenever it
+ * is one of them, keeps its block.
+ */
+
+static void checkSameShape(const ArrayValue & x, const ArrayValue & y,
+                           int xSlot, int ySlot) {
+   if (x.rank != y.rank || x.rows != y.rows || x.cols != y.cols) {
+      error("Arrays " + getVariableName(xSlot) + " and "
+            + getVariableName(ySlot) + " have different shapes");
+   }
+}
+
+void copyArray(EvalState & state, int dst, int src) {
+   ArrayValue x = state.getDimensionedArray(src);
+   ArrayValue & target = state.shapeArray(dst, x.rank, x.rows, x.cols);
+   if (target.data != x.data) {
+      memcpy(target.data, x.data, x.size * sizeof(double));
+   }
+}
+
+void fillArray(EvalState & state, int dst, double k) {
+   ArrayValue & target = state.getDimensionedArray(dst);
+   fillVector(target.data, k, target.size);
+}
+
+void combineArrays(EvalState & state, ArrayOp op, int dst, int x, int y) {
+   ArrayValue lhs = state.getDimensionedArray(x);
+   ArrayValue rhs = state.getDimensionedArray(y);
+   checkSameShape(lhs, rhs, x, y);
+   ArrayValue & target = state.shapeArray(dst, lhs.rank, lhs.rows, lhs.cols);
+   combineVectors(op, target.data, lhs.data, rhs.data, lhs.size);
+}
+
+void combineArrayScalar(EvalState & state, ArrayOp op, int dst, int x,
+                        double k) {
+   ArrayValue lhs = state.getDimensionedArray(x);
+   ArrayValue & target = state.shapeArray(dst, lhs.rank, lhs.rows, lhs.cols);
+   combineVectorScalar(op, target.data, lhs.data, k, lhs.size);
+}
+
+void combineScalarArray(EvalState & state, ArrayOp op, int dst, double k,
+                        int x) {
+   ArrayValue rhs = state.getDimensionedArray(x);
+   ArrayValue & target = state.shapeArray(dst, rhs.rank, rhs.rows, rhs.cols);
+   combineScalarVector(op, target.data, k, rhs.data, rhs.size);
+}
+
+double sumArray(EvalState & state, int x) {
+   ArrayValue & array = state.getDimensionedArray(x);
+   return sumVector(array.data, array.size);
+}
+
+double dotArrays(EvalState & state, int x, int y) {
+   ArrayValue & lhs = state.getDimensionedArray(x);
+   ArrayValue & rhs = state.getDimensionedArray(y);
+   checkSameShape(lhs, rhs, x, y);
+   return dotVectors(lhs.data, rhs.data, lhs.size);
+}
+
+/*
+ * Implementation notes: matrices
+ * ------------------------------
+ * The matrix kernels must not write over their operands, so a result
+ * whose target is one of its operands is computed into a scratch
+ * block and copied over the target afterwards.  An inverse always
+ * is, so that a singular matrix leaves its target as it was.  The
+ * size of a result is checked before any block is allocated for it.
+ */
+
+static ArrayValue getMatrix(EvalState & state, int slot) {
+   ArrayValue array = state.getDimensionedArray(slot);
+   if (array.rank != 2) {
+      error("MAT needs a matrix, but array " + getVariableName(slot)
+            + " has 1 dimension");
+   }
+   return array;
+}
+
+static void checkResultSize(int dst, int rows, int cols) {
+   if ((double) rows * cols > MAX_ARRAY_SIZE) {
+      error("Array " + getVariableName(dst) + " is too large");
+   }
+}
+
+void multiplyArrays(EvalState & state, int dst, int x, int y) {
+   ArrayValue lhs = getMatrix(state, x);
+   ArrayValue rhs = getMatrix(state, y);
+   if (lhs.cols != rhs.rows) {
+      error("Arrays " + getVariableName(x) + " and " + getVariableName(y)
+            + " cannot be multiplied: " + integerToString(lhs.cols)
+            + " columns against " + integerToString(rhs.rows) + " rows");
+   }
+   checkResultSize(dst, lhs.rows, rhs.cols);
+   if (dst != x && dst != y) {
+      ArrayValue & target = state.shapeArray(dst, 2, lhs.rows, rhs.cols);
+      multiplyMatrices(target.data, lhs.data, rhs.data, lhs.rows, lhs.cols,
+                       rhs.cols);
+      return;
+   }
+   vector<double> product((size_t) lhs.rows * rhs.cols);
+   multiplyMatrices(&product[0], lhs.data, rhs.data, lhs.rows, lhs.cols,
+                    rhs.cols);
+   ArrayValue & target = state.shapeArray(dst, 2, lhs.rows, rhs.cols);
+   memcpy(target.data, &product[0], target.size * sizeof(double));
+}
+
+void transposeArray(EvalState & state, int dst, int x) {
+   ArrayValue src = getMatrix(state, x);
+   if (dst != x) {
+      ArrayValue & target = state.shapeArray(dst, 2, src.cols, src.rows);
+      transposeMatrix(target.data, src.data, src.rows, src.cols);
+      return;
+   }
+   vector<double> transpose(src.size);
+   transposeMatrix(&transpose[0], src.data, src.rows, src.cols);
+   ArrayValue & target = state.shapeArray(dst, 2, src.cols, src.rows);
+   memcpy(target.data, &transpose[0], target.size * sizeof(double));
+}
+
+void invertArray(EvalState & state, int dst, int x) {
+   ArrayValue src = getMatrix(state, x);
+   if (src.rows != src.cols) {
+      error("Array " + getVariableName(x) + " is not square");
+   }
+   vector<double> inverse(src.size);
+   if (!invertMatrix(&inverse[0], src.data, src.rows)) {
+      error("Array " + getVariableName(x) + " is singular");
+   }
+   ArrayValue & target = state.shapeArray(dst, 2, src.rows, src.cols);
+   memcpy(target.data, &inverse[0], target.size * sizeof(double));
+}
+
+string arrayOpToString(ArrayOp op) {
+   switch (op) {
+   case ARRAY_ADD: return "+";
+   case ARRAY_SUB: return "-";
+   case ARRAY_MUL: return "*";
+   case ARRAY_DIV: return "/";
+   }
+   return "?";
+}
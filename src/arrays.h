@@ -0,0 +1,108 @@
+/*
+ * File: arrays.h
+ * --------------
+ * This interface exports the array operations of BASIC: DIM, the
+ * assignments A() = B(), A() = k, A() = B() op C(), A() = B() op k and
+ * A() = k op B(), the functions SUM and DOT, and the matrix products,
+ * transposes and inverses of MAT.  Arrays are named by their slot and
+ * live in an EvalState; the arithmetic itself is done by the vector
+ * kernels of simd.h and the matrix kernels of matrix.h.  The tree-walking engine and the
+ * VM both call these functions, so they behave identically.
+ */
+
+#ifndef _arrays_h
+#define _arrays_h
+
+#include "evalstate.h"
+#include "simd.h"
+
+/*
+ * Function: dimensionArray
+ * Usage: dimensionArray(state, slot, 1, n, 1);
+ * --------------------------------------------
+ * Dimensions the array in slot as DIM does, with extents that are the
+ * values of the expressions in the statement.  The extents are
+ * truncated to whole numbers; see EvalState::dimArray for the errors.
+ */
+
+void dimensionArray(EvalState & state, int slot, int rank, double rows,
+                    double cols);
+
+/*
+ * Function: copyArray
+ * Usage: copyArray(state, dst, src);
+ * ----------------------------------
+ * Makes the array dst a copy of the array src, giving it the shape
+ * of src.  Raises an error if src has not been dimensioned.
+ */
+
+void copyArray(EvalState & state, int dst, int src);
+
+/*
+ * Function: fillArray
+ * Usage: fillArray(state, dst, k);
+ * --------------------------------
+ * Sets every element of the array dst, which must have been
+ * dimensioned, to k.
+ */
+
+void fillArray(EvalState & state, int dst, double k);
+
+/*
+ * Functions: combineArrays, combineArrayScalar, combineScalarArray
+ * Usage: combineArrays(state, ARRAY_ADD, dst, x, y);
+ *        combineArrayScalar(state, ARRAY_MUL, dst, x, k);
+ *        combineScalarArray(state, ARRAY_SUB, dst, k, x);
+ * ----------------------------------------------------------------
+ * Set each element of the array dst to the result of op applied to
+ * the elements in the same place of the arrays x and y, to the
+ * element of x and k, or to k and the element of x.  x and y must
+ * have the same shape, and dst takes that shape; dst may be x or y.
+ */
+
+void combineArrays(EvalState & state, ArrayOp op, int dst, int x, int y);
+void combineArrayScalar(EvalState & state, ArrayOp op, int dst, int x,
+                        double k);
+void combineScalarArray(EvalState & state, ArrayOp op, int dst, double k,
+                        int x);
+
+/*
+ * Functions: sumArray, dotArrays
+ * Usage: double sum = sumArray(state, x);
+ *        double dot = dotArrays(state, x, y);
+ * -------------------------------------------
+ * Return the sum of the elements of the array x and the sum of the
+ * products of the elements in the same place of x and y, which must
+ * have the same shape.  See sumVector for the order of the additions.
+ */
+
+double sumArray(EvalState & state, int x);
+double dotArrays(EvalState & state, int x, int y);
+
+/*
+ * Functions: multiplyArrays, transposeArray, invertArray
+ * Usage: multiplyArrays(state, dst, x, y);
+ *        transposeArray(state, dst, x);
+ *        invertArray(state, dst, x);
+ * ------------------------------------------------------
+ * Set the array dst to the matrix product of x and y, to the
+ * transpose of x, or to the inverse of x, giving it the shape of the
+ * result.  The operands must be two-dimensional; x must have as many
+ * columns as y has rows for a product, and must be square and not
+ * singular for an inverse.  dst may be x or y.
+ */
+
+void multiplyArrays(EvalState & state, int dst, int x, int y);
+void transposeArray(EvalState & state, int dst, int x);
+void invertArray(EvalState & state, int dst, int x);
+
+/*
+ * Function: arrayOpToString
+ * Usage: string str = arrayOpToString(op);
+ * ----------------------------------------
+ * Returns the operator that spells op.
+ */
+
+std::string arrayOpToString(ArrayOp op);
+
+#endif
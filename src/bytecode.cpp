@@ -0,0 +1,328 @@
+/*
+ * File: bytecode.cpp
+ * ------------------
+ * Implements the bytecode.h interface.
+ */
+
+#include <cstring>
+#include <string>
+#include "bytecode.h"
+#include "program.h"
+#include "error.h"
+#include "strlib.h"
+using namespace std;
+
+/*
+ * Implementation notes: instruction tables
+ * ----------------------------------------
+ * These tables describe the instruction set documented in bytecode.h.
+ */
+
+int getInstructionLength(int op) {
+   switch (op) {
+   case OP_CONST: case OP_LOAD: case OP_STORE:
+   case OP_JUMP: case OP_JUMP_EQ: case OP_JUMP_LT: case OP_JUMP_GT:
+   case OP_PRINT_STR: case OP_INPUT:
+   case OP_DIM1: case OP_DIM2: case OP_LOAD_ELEM1: case OP_LOAD_ELEM2:
+   case OP_STORE_ELEM1: case OP_STORE_ELEM2:
+   case OP_ARRAY_FILL: case OP_ARRAY_SUM: case OP_CLEAR:
+      return 2;
+   case OP_ARRAY_COPY: case OP_ARRAY_DOT:
+   case OP_MAT_TRN: case OP_MAT_INV:
+      return 3;
+   case OP_ARRAY_SCALAR: case OP_SCALAR_ARRAY: case OP_MAT_MUL:
+      return 4;
+   case OP_ARRAY_OP: case OP_FOR_ENTER: case OP_FOR_NEXT:
+      return 5;
+   default:
+      return 1;
+   }
+}
+
+int getStackEffect(int op) {
+   switch (op) {
+   case OP_CONST: case OP_LOAD: case OP_DUP:
+   case OP_ARRAY_SUM: case OP_ARRAY_DOT:
+      return 1;
+   case OP_STORE: case OP_PRINT_NUM:
+   case OP_ADD: case OP_SUB: case OP_MUL: case OP_DIV:
+   case OP_DIM1: case OP_LOAD_ELEM2:
+   case OP_ARRAY_FILL: case OP_ARRAY_SCALAR: case OP_SCALAR_ARRAY:
+      return -1;
+   case OP_JUMP_EQ: case OP_JUMP_LT: case OP_JUMP_GT:
+   case OP_DIM2: case OP_STORE_ELEM1:
+      return -2;
+   case OP_STORE_ELEM2:
+      return -3;
+   default:
+      return 0;
+   }
+}
+
+int getSlotOperandCount(int op) {
+   switch (op) {
+   case OP_LOAD: case OP_STORE: case OP_INPUT:
+   case OP_DIM1: case OP_DIM2: case OP_LOAD_ELEM1: case OP_LOAD_ELEM2:
+   case OP_STORE_ELEM1: case OP_STORE_ELEM2:
+   case OP_ARRAY_FILL: case OP_ARRAY_SUM: case OP_CLEAR:
+      return 1;
+   case OP_ARRAY_COPY: case OP_ARRAY_DOT:
+   case OP_ARRAY_SCALAR: case OP_SCALAR_ARRAY:
+   case OP_MAT_TRN: case OP_MAT_INV:
+      return 2;
+   case OP_ARRAY_OP: case OP_MAT_MUL:
+   case OP_FOR_ENTER: case OP_FOR_NEXT:
+      return 3;
+   default:
+      return 0;
+   }
+}
+
+int getJumpOperand(int op) {
+   switch (op) {
+   case OP_JUMP: case OP_JUMP_EQ: case OP_JUMP_LT: case OP_JUMP_GT:
+      return 1;
+   case OP_FOR_ENTER: case OP_FOR_NEXT:
+      return 4;
+   default:
+      return 0;
+   }
+}
+
+/*
+ * Implementation: Compiler
+ * ------------------------
+ * Starts with an empty bytecode object.
+ */
+
+Compiler::Compiler(Bytecode & bc) : bc(bc) {
+   bc.code.clear();
+   bc.constants.clear();
+   bc.stringOffsets.clear();
+   bc.stringOffsets.add(0);
+   bc.stringData.clear();
+   bc.maxStack = 0;
+   depth = 0;
+}
+
+/*
+ * Implementation notes: compileProgram
+ * ------------------------------------
+ * Follows the linked statement chain, recording the address of each
+ * line before asking its statement to compile itself.  Since lines
+ * are laid out in execution order, falling through from one line to
+ * the next needs no instruction.  The final OP_HALT is recorded as
+ * the address of PROGRAM_END.  The code starts by clearing the
+ * hidden variables of the program, so that a state reused from an
+ * earlier run cannot make a NEXT look as if its FOR had run.
+ */
+
+void Compiler::compileProgram(Program & program) {
+   const vector<int> & hidden = program.getHiddenVariables();
+   for (size_t i = 0; i < hidden.size(); i++) {
+      emit(OP_CLEAR, hidden[i]);
+   }
+   Statement *stmt = program.getFirstStatement();
+   while (stmt != NULL) {
+      lineAddr.put(stmt->getLineNumber(), bc.code.size());
+      stmt->compile(*this);
+      stmt = stmt->getSuccessor();
+   }
+   lineAddr.put(PROGRAM_END, bc.code.size());
+   emit(OP_HALT);
+   resolveJumps();
+}
+
+/*
+ * Implementation notes: compileExp
+ * --------------------------------
+ * Emits a postorder walk of the expression tree.  The assignment
+ * operator is handled as in CompoundExp::eval: the right operand is
+ * stored into the variable and its value is left on the stack.  The
+ * postfix compiler has already rejected any whole array used as a
+ * number, so the check below only guards against a statement that
+ * was not optimized.
+ */
+
+void Compiler::compileExp(Expression *exp) {
+   switch (exp->getType()) {
+   case CONSTANT:
+      emit(OP_CONST, constantIndex(((ConstantExp *) exp)->getValue()));
+      return;
+   case IDENTIFIER:
+      emit(OP_LOAD, ((IdentifierExp *) exp)->getSlot());
+      return;
+   case ARRAY: {
+      ArrayExp *aexp = (ArrayExp *) exp;
+      int nSubscripts = aexp->getSubscriptCount();
+      if (nSubscripts == 0) {
+         error("Whole array " + aexp->toString() + " cannot be used as a number");
+      }
+      for (int i = 0; i < nSubscripts; i++) {
+         compileExp(aexp->getSubscript(i));
+      }
+      emit((nSubscripts == 1) ? OP_LOAD_ELEM1 : OP_LOAD_ELEM2, aexp->getSlot());
+      return;
+   }
+   case REDUCTION: {
+      ReductionExp *rexp = (ReductionExp *) exp;
+      if (rexp->isDot()) {
+         emit(OP_ARRAY_DOT, rexp->getSlot(), rexp->getRhsSlot());
+      } else {
+         emit(OP_ARRAY_SUM, rexp->getSlot());
+      }
+      return;
+   }
+   case COMPOUND:
+      break;
+   }
+   CompoundExp *cexp = (CompoundExp *) exp;
+   Operator op = cexp->getOperator();
+   if (op == ASSIGN_OP) {
+      if (cexp->getLHS()->getType() != IDENTIFIER) {
+         error("Illegal variable in assignment");
+      }
+      compileExp(cexp->getRHS());
+      emit(OP_DUP);
+      emit(OP_STORE, ((IdentifierExp *) cexp->getLHS())->getSlot());
+      return;
+   }
+   compileExp(cexp->getLHS());
+   compileExp(cexp->getRHS());
+   switch (op) {
+   case PLUS_OP: emit(OP_ADD); break;
+   case MINUS_OP: emit(OP_SUB); break;
+   case TIMES_OP: emit(OP_MUL); break;
+   case DIVIDE_OP: emit(OP_DIV); break;
+   default: error("Illegal operator in expression");
+   }
+}
+
+void Compiler::emit(Opcode op) {
+   bc.code.add(op);
+   adjustDepth(op);
+}
+
+void Compiler::emit(Opcode op, int arg) {
+   bc.code.add(op);
+   bc.code.add(arg);
+   adjustDepth(op);
+}
+
+void Compiler::emit(Opcode op, int arg1, int arg2, int arg3, int arg4) {
+   int args[] = { arg1, arg2, arg3, arg4 };
+   bc.code.add(op);
+   for (int i = 1; i < getInstructionLength(op); i++) {
+      bc.code.add(args[i - 1]);
+   }
+   adjustDepth(op);
+}
+
+/*
+ * Implementation notes: emitJump
+ * ------------------------------
+ * The address, which is always the last operand, is left as zero and
+ * remembered in fixups until every line has an address.
+ */
+
+void Compiler::emitJump(Opcode op, int lineNum) {
+   Fixup fix;
+   fix.lineNum = lineNum;
+   emit(op, 0);
+   fix.pos = bc.code.size() - 1;
+   fixups.add(fix);
+}
+
+void Compiler::emitJump(Opcode op, int slot1, int slot2, int slot3,
+                        int lineNum) {
+   Fixup fix;
+   fix.lineNum = lineNum;
+   emit(op, slot1, slot2, slot3, 0);
+   fix.pos = bc.code.size() - 1;
+   fixups.add(fix);
+}
+
+/*
+ * Implementation notes: constantIndex
+ * -----------------------------------
+ * The pool maps each constant to its index, so a program with many
+ * constants compiles in O(n log n) time.  It is keyed by the bits of
+ * the constant rather than by its value: == would merge the -0 the
+ * optimizer can fold with 0, and a NaN, which compares false against
+ * everything, would break the ordering of the map.
+ */
+
+int Compiler::constantIndex(double value) {
+   unsigned long long bits;
+   memcpy(&bits, &value, sizeof bits);
+   if (!constantPool.containsKey(bits)) {
+      constantPool.put(bits, bc.constants.size());
+      bc.constants.add(value);
+   }
+   return constantPool.get(bits);
+}
+
+int Compiler::stringIndex(string str) {
+   bc.stringData += str;
+   bc.stringOffsets.add(bc.stringData.size());
+   return bc.stringOffsets.size() - 2;
+}
+
+/*
+ * Implementation notes: adjustDepth
+ * ---------------------------------
+ * Tracks the stack depth at the current point of emission so that
+ * the VM can allocate its value stack once, before running.
+ */
+
+void Compiler::adjustDepth(Opcode op) {
+   depth += getStackEffect(op);
+   if (depth > bc.maxStack) bc.maxStack = depth;
+}
+
+/*
+ * Implementation notes: resolveJumps
+ * ----------------------------------
+ * Patches every jump with the address of its target line.  Program::link
+ * has already rejected missing targets, so the error below only guards
+ * against compiling a program that was not linked.
+ */
+
+void Compiler::resolveJumps() {
+   foreach (Fixup fix in fixups) {
+      if (!lineAddr.containsKey(fix.lineNum)) {
+         error("Invalid line number: " + integerToString(fix.lineNum));
+      }
+      bc.code[fix.pos] = lineAddr.get(fix.lineNum);
+   }
+}
+
+/*
+ * Implementation: getCodeView
+ * ---------------------------
+ * Empty pools give NULL pointers, which are never dereferenced.
+ */
+
+CodeView getCodeView(Bytecode & bc) {
+   CodeView view;
+   view.code = (bc.code.isEmpty()) ? NULL : &bc.code[0];
+   view.codeLength = bc.code.size();
+   view.constants = (bc.constants.isEmpty()) ? NULL : &bc.constants[0];
+   view.constantCount = bc.constants.size();
+   view.stringOffsets = (bc.stringOffsets.isEmpty()) ? NULL : &bc.stringOffsets[0];
+   view.stringData = bc.stringData.data();
+   view.stringCount = bc.stringOffsets.size() - 1;
+   view.maxStack = bc.maxStack;
+   return view;
+}
+
+/*
+ * Implementation: compileProgram
+ * ------------------------------
+ * Convenience wrapper around the Compiler class.
+ */
+
+void compileProgram(Program & program, Bytecode & bc) {
+   Compiler compiler(bc);
+   compiler.compileProgram(program);
+}
@@ -0,0 +1,282 @@
+/*
+ * File: bytecode.h
+ * ----------------
+ * This interface exports the flat bytecode representation of a
+ * BASIC program together with the Compiler class that lowers a
+ * stored Program (every Statement and its Expression trees) into
+ * that representation.  The bytecode is executed by the stack
+ * machine exported by vm.h.
+ */
+
+#ifndef _bytecode_h
+#define _bytecode_h
+
+#include <string>
+#include "exp.h"
+#include "map.h"
+#include "vector.h"
+
+class Program;
+
+/*
+ * Constant: PROGRAM_END
+ * ---------------------
+ * The line number that Compiler::emitJump takes for a jump past the
+ * last line of the program, to the final OP_HALT.
+ */
+
+static const int PROGRAM_END = -1;
+
+/*
+ * Type: Opcode
+ * ------------
+ * The instruction set of the stack machine.  Each instruction is
+ * stored in the code array as its opcode followed by its integer
+ * operands, as noted below; most have one operand or none.
+ *
+ *  OP_CONST k             -- pushes constants[k]
+ *  OP_LOAD v              -- pushes the value of variable v
+ *  OP_STORE v             -- pops a value into variable v
+ *  OP_DUP                 -- duplicates the top of the stack
+ *  OP_ADD .. OP_DIV       -- pops two values and pushes the result
+ *  OP_JUMP a              -- continues execution at address a
+ *  OP_JUMP_EQ a           -- pops two values, jumps to a if they are equal
+ *  OP_JUMP_LT a           -- pops two values, jumps to a if lhs < rhs
+ *  OP_JUMP_GT a           -- pops two values, jumps to a if lhs > rhs
+ *  OP_PRINT_STR s         -- sends PRINT string s to the output
+ *  OP_PRINT_NUM           -- pops a value and sends it to cout
+ *  OP_PRINT_END           -- ends the current PRINT line
+ *  OP_INPUT v             -- reads variable v from the user
+ *  OP_DIM1 v              -- pops n and dimensions array v as v(n)
+ *  OP_DIM2 v              -- pops m and n and dimensions v as v(n, m)
+ *  OP_LOAD_ELEM1 v        -- pops i and pushes v(i)
+ *  OP_LOAD_ELEM2 v        -- pops j and i and pushes v(i, j)
+ *  OP_STORE_ELEM1 v       -- pops a value and i and stores it in v(i)
+ *  OP_STORE_ELEM2 v       -- pops a value, j and i, stores it in v(i, j)
+ *  OP_ARRAY_COPY d x      -- sets array d to a copy of array x
+ *  OP_ARRAY_FILL d        -- pops k and sets every element of d to k
+ *  OP_ARRAY_OP d x y op   -- sets d to x op y, element by element
+ *  OP_ARRAY_SCALAR d x op -- pops k and sets d to x op k
+ *  OP_SCALAR_ARRAY d x op -- pops k and sets d to k op x
+ *  OP_ARRAY_SUM x         -- pushes the sum of the elements of x
+ *  OP_ARRAY_DOT x y       -- pushes the dot product of x and y
+ *  OP_MAT_MUL d x y       -- sets d to the matrix product of x and y
+ *  OP_MAT_TRN d x         -- sets d to the transpose of x
+ *  OP_MAT_INV d x         -- sets d to the inverse of x
+ *  OP_FOR_ENTER v l s a   -- jumps to a unless the loop on v runs once
+ *  OP_FOR_NEXT v l s a    -- adds s to v, jumps to a if the loop runs on
+ *  OP_CLEAR v             -- marks variable v undefined
+ *  OP_HALT                -- stops execution
+ *
+ * The op operand of the whole-array instructions is an ArrayOp (see
+ * simd.h).  Array instructions keep their array slots in front of any
+ * other operand.  The FOR instructions take the slots of the counter
+ * v and of the hidden variables holding the limit l and the step s,
+ * and test the counter against the limit as isLoopRunning does.
+ * A program starts with an OP_CLEAR for each of those hidden
+ * variables (see Program::getHiddenVariables).
+ */
+
+enum Opcode {
+   OP_CONST, OP_LOAD, OP_STORE, OP_DUP,
+   OP_ADD, OP_SUB, OP_MUL, OP_DIV,
+   OP_JUMP, OP_JUMP_EQ, OP_JUMP_LT, OP_JUMP_GT,
+   OP_PRINT_STR, OP_PRINT_NUM, OP_PRINT_END, OP_INPUT,
+   OP_DIM1, OP_DIM2, OP_LOAD_ELEM1, OP_LOAD_ELEM2,
+   OP_STORE_ELEM1, OP_STORE_ELEM2,
+   OP_ARRAY_COPY, OP_ARRAY_FILL, OP_ARRAY_OP, OP_ARRAY_SCALAR,
+   OP_SCALAR_ARRAY, OP_ARRAY_SUM, OP_ARRAY_DOT,
+   OP_MAT_MUL, OP_MAT_TRN, OP_MAT_INV,
+   OP_FOR_ENTER, OP_FOR_NEXT, OP_CLEAR,
+   OP_HALT
+};
+
+/*
+ * Functions: getInstructionLength, getStackEffect, getSlotOperandCount,
+ *            getJumpOperand
+ * Usage: pc += getInstructionLength(op);
+ *        depth += getStackEffect(op);
+ *        int nSlots = getSlotOperandCount(op);
+ *        int target = code[pc + getJumpOperand(op)];
+ * --------------------------------------------------------------------
+ * Return the number of code words occupied by an instruction with
+ * the given opcode (the opcode plus its operands), the net change in
+ * stack depth caused by executing it, the number of its operands,
+ * counted from the first, that are variable or array slots, and the
+ * position within the instruction of the operand holding a jump
+ * address, or 0 for an instruction that never jumps.  Tools that walk
+ * the code array, such as the JIT and the image loader, rely on these
+ * tables, so every new opcode must be added to all four.
+ */
+
+int getInstructionLength(int op);
+int getStackEffect(int op);
+int getSlotOperandCount(int op);
+int getJumpOperand(int op);
+
+/*
+ * Function: isLoopRunning
+ * Usage: if (isLoopRunning(value, limit, step)) . . .
+ * ---------------------------------------------------
+ * Returns true if a FOR loop whose counter has reached value goes on
+ * with another pass: the counter must not have passed the limit in
+ * the direction of the step, so a step of 0 or NaN counts up.  FOR
+ * and NEXT apply this test in both engines and in native code.
+ */
+
+inline bool isLoopRunning(double value, double limit, double step) {
+   return (step < 0) ? value >= limit : value <= limit;
+}
+
+/*
+ * Type: Bytecode
+ * --------------
+ * Holds a compiled program: the instruction array, the pools of
+ * constants and PRINT strings it refers to and the deepest value
+ * stack any instruction needs.  The operand of OP_LOAD, OP_STORE and
+ * OP_INPUT, like the array operands, is the slot (see evalstate.h)
+ * itself.  The PRINT
+ * strings are stored back to back in stringData; string s occupies
+ * the characters from stringOffsets[s] up to stringOffsets[s + 1].
+ */
+
+struct Bytecode {
+   Vector<int> code;
+   Vector<double> constants;
+   Vector<int> stringOffsets;
+   std::string stringData;
+   int maxStack;
+};
+
+/*
+ * Type: CodeView
+ * --------------
+ * A read-only view of a compiled program as plain arrays, which is
+ * all the VM and the JIT need.  A view either points into a Bytecode
+ * object or into a program image mapped from disk (see image.h), so
+ * an image runs without being copied.
+ */
+
+struct CodeView {
+   const int *code;
+   int codeLength;
+   const double *constants;
+   int constantCount;
+   const int *stringOffsets;
+   const char *stringData;
+   int stringCount;
+   int maxStack;
+};
+
+/*
+ * Function: getCodeView
+ * Usage: CodeView view = getCodeView(bc);
+ * ---------------------------------------
+ * Returns a view of bc, valid until bc changes.
+ */
+
+CodeView getCodeView(Bytecode & bc);
+
+/*
+ * Class: Compiler
+ * ---------------
+ * This class lowers a Program into a Bytecode object.  The compiler
+ * walks the program in line order and asks each Statement to emit
+ * its own instructions through the public methods below.  Jumps to
+ * line numbers are patched once every line has an address.
+ */
+
+class Compiler {
+
+public:
+
+/*
+ * Constructor: Compiler
+ * Usage: Compiler compiler(bc);
+ * -----------------------------
+ * Creates a compiler that emits its output into bc.
+ */
+
+   Compiler(Bytecode & bc);
+
+/*
+ * Method: compileProgram
+ * Usage: compiler.compileProgram(program);
+ * ----------------------------------------
+ * Compiles every line of the program, in order, followed by a final
+ * OP_HALT, and resolves all jump targets.  The program must already
+ * be linked, which guarantees that every target line exists.
+ */
+
+   void compileProgram(Program & program);
+
+/*
+ * Method: compileExp
+ * Usage: compiler.compileExp(exp);
+ * --------------------------------
+ * Emits the instructions that leave the value of exp on the stack.
+ */
+
+   void compileExp(Expression *exp);
+
+/*
+ * Methods: emit, emitJump
+ * Usage: compiler.emit(OP_ADD);
+ *        compiler.emit(OP_STORE, slot);
+ *        compiler.emit(OP_ARRAY_OP, dst, x, y, ARRAY_ADD);
+ *        compiler.emitJump(OP_JUMP, next);
+ *        compiler.emitJump(OP_FOR_NEXT, v, l, s, next);
+ * ------------------------------------------------------
+ * Appends an instruction to the code array.  The form with several
+ * arguments writes as many of them as the instruction has operands.
+ * emitJump takes the target as the line number written in the
+ * source, or PROGRAM_END for the final OP_HALT, after the slots of a
+ * FOR instruction; the address is filled in at the end of
+ * compileProgram.
+ */
+
+   void emit(Opcode op);
+   void emit(Opcode op, int arg);
+   void emit(Opcode op, int arg1, int arg2, int arg3 = 0, int arg4 = 0);
+   void emitJump(Opcode op, int lineNum);
+   void emitJump(Opcode op, int slot1, int slot2, int slot3, int lineNum);
+
+/*
+ * Methods: constantIndex, stringIndex
+ * Usage: int k = compiler.constantIndex(value);
+ * ---------------------------------------------
+ * Return the operand that refers to the given constant or PRINT
+ * string, adding it to the pool on first use.
+ */
+
+   int constantIndex(double value);
+   int stringIndex(std::string str);
+
+private:
+
+   struct Fixup {
+      int pos;
+      int lineNum;
+   };
+
+   Bytecode & bc;
+   Map<int,int> lineAddr;
+   Map<unsigned long long,int> constantPool;
+   Vector<Fixup> fixups;
+   int depth;
+
+   void adjustDepth(Opcode op);
+   void resolveJumps();
+
+};
+
+/*
+ * Function: compileProgram
+ * Usage: compileProgram(program, bc);
+ * -----------------------------------
+ * Convenience wrapper that compiles program into bc.
+ */
+
+void compileProgram(Program & program, Bytecode & bc);
+
+#endif
@@ -0,0 +1,135 @@
+/*
+ * File: display.cpp
+ * -----------------
+ * Implements the display.h interface.
+ */
+
+#include <string>
+#include "display.h"
+#include "graphics.h"
+using namespace std;
+
+/*
+ * Constants
+ * ---------
+ * COLUMN_WIDTH  -- Width of a column, half the window
+ * COLUMN_HEIGHT -- Height of a column, the window less its borders
+ * INIT_HEIGHT   -- Y-coordinate above the first line of a column
+ * PRINT_HEIGHT  -- Y-coordinate past which a column is full
+ * LINE_HEIGHT   -- Distance between two lines of a column
+ * TEXT_COLOR    -- Color of all text in the columns
+ * BG_FILE       -- Background image painted over a full column
+ */
+
+static const double COLUMN_WIDTH = 400;
+static const double COLUMN_HEIGHT = 220;
+static const int INIT_HEIGHT = 55;
+static const int PRINT_HEIGHT = COLUMN_HEIGHT + 25;
+static const int LINE_HEIGHT = 15;
+static const string TEXT_COLOR = "#fbcc62";
+static const string BG_FILE = "bg.jpg";
+
+/* The graphics window sink */
+
+GraphicsSink::~GraphicsSink() {
+   /* Empty */
+}
+
+namespace {
+
+class WindowSink : public GraphicsSink {
+
+public:
+
+   virtual void setColor(const string & color) {
+      ::setColor(color);
+   }
+
+   virtual void drawString(const string & str, double x, double y) {
+      ::drawString(str, x, y);
+   }
+
+   virtual void drawImage(const string & filename, double x, double y,
+                          double width, double height) {
+      ::drawImage(filename, x, y, width, height);
+   }
+
+   virtual double getWidth() {
+      return getWindowWidth();
+   }
+
+};
+
+}
+
+GraphicsSink & getWindowSink() {
+   static WindowSink sink;
+   return sink;
+}
+
+/* Implementation of the Display class */
+
+Display::Display(GraphicsSink *sink) {
+   this->sink = sink;
+   orderB = 0;
+   orderA = 0;
+}
+
+void Display::setSink(GraphicsSink *sink) {
+   this->sink = sink;
+}
+
+GraphicsSink *Display::getSink() {
+   return sink;
+}
+
+void Display::reset() {
+   orderB = 0;
+   orderA = 0;
+   if (sink != NULL) sink->setColor(TEXT_COLOR);
+}
+
+/*
+ * Implementation notes: startBefore, startAfter
+ * ---------------------------------------------
+ * A column that has run past PRINT_HEIGHT is painted over and starts
+ * again at INIT_HEIGHT; the first line of a statement is always one
+ * line below the previous position.
+ */
+
+void Display::startBefore() {
+   if (orderB > PRINT_HEIGHT) {
+      if (sink != NULL) sink->drawImage(BG_FILE, 0, 45, COLUMN_WIDTH, COLUMN_HEIGHT);
+      orderB = 0;
+   }
+   if (orderB == 0) orderB = INIT_HEIGHT;
+   orderB += LINE_HEIGHT;
+}
+
+void Display::stepBefore() {
+   orderB += LINE_HEIGHT;
+}
+
+void Display::drawBefore(const string & text) {
+   if (sink != NULL) sink->drawString(text, 20, orderB);
+}
+
+void Display::startAfter() {
+   if (orderA > PRINT_HEIGHT) {
+      if (sink != NULL) {
+         sink->drawImage(BG_FILE, sink->getWidth() / 2 + 10, 45,
+                         COLUMN_WIDTH, COLUMN_HEIGHT);
+      }
+      orderA = 0;
+   }
+   if (orderA == 0) orderA = INIT_HEIGHT;
+   orderA += LINE_HEIGHT;
+}
+
+void Display::stepAfter() {
+   orderA += LINE_HEIGHT;
+}
+
+void Display::drawAfter(const string & text) {
+   if (sink != NULL) sink->drawString(text, sink->getWidth() / 2 + 20, orderA);
+}
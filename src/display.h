@@ -0,0 +1,149 @@
+/*
+ * File: display.h
+ * ---------------
+ * This interface exports the two classes through which statements
+ * draw on the graphical debugger.  A GraphicsSink is the surface the
+ * drawing goes to, and a Display keeps the positions of the 'Before
+ * Execution' and 'After Execution' columns on one sink.  Every
+ * interpreter instance owns its own Display, which it hands to the
+ * parser and to its EvalState, so instances share no drawing state
+ * and each can draw on a sink of its own, or on none at all.
+ */
+
+#ifndef _display_h
+#define _display_h
+
+#include <string>
+
+/*
+ * Class: GraphicsSink
+ * -------------------
+ * The abstract drawing surface behind a Display.  Subclasses forward
+ * the calls to a window, record them, or drop them.
+ */
+
+class GraphicsSink {
+
+public:
+
+   virtual ~GraphicsSink();
+
+/*
+ * Methods: setColor, drawString, drawImage
+ * Usage: sink.setColor(color);
+ *        sink.drawString(str, x, y);
+ *        sink.drawImage(filename, x, y, width, height);
+ * -----------------------------------------------------
+ * Draw on the surface, with the meaning of the functions of the same
+ * names in graphics.h.
+ */
+
+   virtual void setColor(const std::string & color) = 0;
+   virtual void drawString(const std::string & str, double x, double y) = 0;
+   virtual void drawImage(const std::string & filename, double x, double y,
+                          double width, double height) = 0;
+
+/*
+ * Method: getWidth
+ * Usage: double width = sink.getWidth();
+ * --------------------------------------
+ * Returns the width of the surface in pixels.
+ */
+
+   virtual double getWidth() = 0;
+
+};
+
+/*
+ * Function: getWindowSink
+ * Usage: Display display(&getWindowSink());
+ * -----------------------------------------
+ * Returns the sink that draws on the graphics window of graphics.h.
+ * The sink itself has no state, but the window is a single resource,
+ * so only one thread at a time should draw on it.
+ */
+
+GraphicsSink & getWindowSink();
+
+/*
+ * Class: Display
+ * --------------
+ * The layout of the two columns of the graphical debugger.  Each
+ * column is written from top to bottom, one line every 15 pixels;
+ * when a column is full, it is painted over with the background and
+ * starts again at the top.
+ */
+
+class Display {
+
+public:
+
+/*
+ * Constructor: Display
+ * Usage: Display display(&sink);
+ * ------------------------------
+ * Creates a display with both columns empty that draws on sink.  The
+ * sink is not owned by the display.
+ */
+
+   Display(GraphicsSink *sink);
+
+/*
+ * Methods: setSink, getSink
+ * Usage: display.setSink(&sink);
+ *        GraphicsSink *sink = display.getSink();
+ * ----------------------------------------------
+ * Set and return the sink the display draws on.
+ */
+
+   void setSink(GraphicsSink *sink);
+   GraphicsSink *getSink();
+
+/*
+ * Method: reset
+ * Usage: display.reset();
+ * -----------------------
+ * Starts both columns again at the top and sets the drawing color of
+ * the sink, as after a fresh window has been drawn.
+ */
+
+   void reset();
+
+/*
+ * Methods: startBefore, stepBefore, drawBefore
+ * Usage: display.startBefore();
+ *        display.stepBefore();
+ *        display.drawBefore(text);
+ * ------------------------------------
+ * Write to the 'Before Execution' column.  startBefore moves to the
+ * line for a new statement, clearing the column first if it is full.
+ * stepBefore moves down one line within the current statement, and
+ * drawBefore draws text on the current line.
+ */
+
+   void startBefore();
+   void stepBefore();
+   void drawBefore(const std::string & text);
+
+/*
+ * Methods: startAfter, stepAfter, drawAfter
+ * Usage: display.startAfter();
+ *        display.stepAfter();
+ *        display.drawAfter(text);
+ * -----------------------------------
+ * The same operations on the 'After Execution' column.
+ */
+
+   void startAfter();
+   void stepAfter();
+   void drawAfter(const std::string & text);
+
+private:
+
+   GraphicsSink *sink;
+   int orderB;             /* Y-coordinate in the Before Execution column */
+   int orderA;             /* Y-coordinate in the After Execution column  */
+
+};
+
+#endif
@@ -5,36 +5,297 @@
  * table for keeping track of the value of identifiers.
  */
 
+#include <cstdlib>
+#include <cstring>
+#include <deque>
 #include <string>
+#include <vector>
 #include "evalstate.h"
+#include "output.h"
+#include "error.h"
+#include "strlib.h"
 using namespace std;
 
+#if defined(__unix__) || defined(__APPLE__)
+#  define SLOT_TABLE_LOCK
+#  include <pthread.h>
+#endif
+
+/*
+ * Implementation notes: variable slots
+ * ------------------------------------
+ * The table of slots is shared by the whole interpreter.  slotNames
+ * holds each name once, at the index of its slot, and slotHash is an
+ * open-addressing hash table of slot numbers, indexed by an FNV-1a
+ * hash of the name and probed linearly, with -1 marking an empty
+ * entry.  A lookup hashes the characters where they lie, so the
+ * parser can look up a name straight out of the source line without
+ * making a string of it first.  The table is kept at most half full
+ * and is doubled and refilled when it would grow past that.
+ *
+ * Interpreters in different threads may parse at the same time, so
+ * every access to the table holds slotLock.  The names are kept in a
+ * deque, which never moves its elements as it grows, so a reference
+ * returned by getVariableName stays valid after the lock is released.
+ */
+
+static const int INITIAL_HASH_SIZE = 64;
+
+static deque<string> slotNames;
+static vector<unsigned int> slotHashes;
+static vector<int> slotHash;
+
+#ifdef SLOT_TABLE_LOCK
+static pthread_mutex_t slotLock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+namespace {
+
+class SlotTableLock {
+public:
+   SlotTableLock() {
+#ifdef SLOT_TABLE_LOCK
+      pthread_mutex_lock(&slotLock);
+#endif
+   }
+   ~SlotTableLock() {
+#ifdef SLOT_TABLE_LOCK
+      pthread_mutex_unlock(&slotLock);
+#endif
+   }
+};
+
+}
+
+static unsigned int hashName(const char *text, int length) {
+   unsigned int hash = 2166136261u;
+   for (int i = 0; i < length; i++) {
+      hash = (hash ^ (unsigned char) text[i]) * 16777619u;
+   }
+   return hash;
+}
+
+static void insertSlot(int slot) {
+   unsigned int mask = slotHash.size() - 1;
+   unsigned int index = slotHashes[slot] & mask;
+   while (slotHash[index] != -1) {
+      index = (index + 1) & mask;
+   }
+   slotHash[index] = slot;
+}
+
+static void growHash() {
+   int size = (slotHash.empty()) ? INITIAL_HASH_SIZE : 2 * slotHash.size();
+   slotHash.assign(size, -1);
+   for (int slot = 0; slot < (int) slotNames.size(); slot++) {
+      insertSlot(slot);
+   }
+}
+
+int getVariableSlot(const char *text, int length) {
+   unsigned int hash = hashName(text, length);
+   SlotTableLock lock;
+   if (!slotHash.empty()) {
+      unsigned int mask = slotHash.size() - 1;
+      unsigned int index = hash & mask;
+      while (slotHash[index] != -1) {
+         int slot = slotHash[index];
+         const string & name = slotNames[slot];
+         if (slotHashes[slot] == hash && (int) name.size() == length
+             && name.compare(0, length, text, length) == 0) {
+            return slot;
+         }
+         index = (index + 1) & mask;
+      }
+   }
+   int slot = slotNames.size();
+   slotNames.push_back(string(text, length));
+   slotHashes.push_back(hash);
+   if (2 * slotNames.size() > slotHash.size()) {
+      growHash();
+   } else {
+      insertSlot(slot);
+   }
+   return slot;
+}
+
+int getVariableSlot(const string & name) {
+   return getVariableSlot(name.data(), name.size());
+}
+
+const string & getVariableName(int slot) {
+   SlotTableLock lock;
+   if (slot < 0 || slot >= (int) slotNames.size()) {
+      error("getVariableName: Slot " + integerToString(slot) + " out of range");
+   }
+   return slotNames[slot];
+}
+
+int getVariableCount() {
+   SlotTableLock lock;
+   return slotNames.size();
+}
+
+/*
+ * Functions: allocateAligned, freeAligned
+ * Usage: double *data = allocateAligned(size);
+ *        freeAligned(data);
+ * --------------------------------------------
+ * Allocate and free a block of size doubles aligned to
+ * ARRAY_ALIGNMENT bytes.
+ */
+
+static double *allocateAligned(int size) {
+   size_t bytes = size * sizeof(double);
+#ifdef _WIN32
+   void *block = _aligned_malloc(bytes, ARRAY_ALIGNMENT);
+   if (block == NULL) error("Out of memory for array");
+#else
+   void *block = NULL;
+   if (posix_memalign(&block, ARRAY_ALIGNMENT, bytes) != 0) {
+      error("Out of memory for array");
+   }
+#endif
+   return (double *) block;
+}
+
+static void freeAligned(double *data) {
+#ifdef _WIN32
+   _aligned_free(data);
+#else
+   free(data);
+#endif
+}
+
 /* Implementation of the EvalState class */
 
 EvalState::EvalState() {
-   /* Empty */
+   nextStmt = NULL;
+   output = NULL;
+   input = NULL;
+   display = NULL;
+   headless = false;
 }
 
 EvalState::~EvalState() {
-   /* Empty */
+   for (size_t i = 0; i < arrays.size(); i++) {
+      freeAligned(arrays[i].data);
+   }
+}
+
+void EvalState::reserve(int nSlots) {
+   if (nSlots <= (int) values.size()) return;
+   values.resize(nSlots, 0);
+   definedBits.resize((nSlots + 31) / 32, 0);
+}
+
+double *EvalState::getValueArray() {
+   return (values.empty()) ? NULL : &values[0];
+}
+
+unsigned int *EvalState::getDefinedBitmap() {
+   return (definedBits.empty()) ? NULL : &definedBits[0];
+}
+
+/*
+ * Implementation notes: arrays
+ * ----------------------------
+ * The table of arrays grows on demand, like the table of values, and
+ * an entry with rank 0 is an array that has not been dimensioned.
+ * The storage of an array is replaced only once the new block has
+ * been allocated, so an array is never left without storage.
+ */
+
+void EvalState::dimArray(int slot, int rank, int rows, int cols) {
+   const string & name = getVariableName(slot);
+   if (rows < 1 || cols < 1) {
+      error("Array " + name + " needs extents of at least 1");
+   }
+   if ((double) rows * cols > MAX_ARRAY_SIZE) {
+      error("Array " + name + " is too large");
+   }
+   int size = rows * cols;
+   double *data = allocateAligned(size);
+   memset(data, 0, size * sizeof(double));
+   if (slot >= (int) arrays.size()) {
+      ArrayValue empty = { NULL, 0, 0, 0, 0 };
+      arrays.resize(slot + 1, empty);
+   }
+   ArrayValue & array = arrays[slot];
+   freeAligned(array.data);
+   array.data = data;
+   array.rank = rank;
+   array.rows = rows;
+   array.cols = cols;
+   array.size = size;
+}
+
+ArrayValue & EvalState::shapeArray(int slot, int rank, int rows, int cols) {
+   ArrayValue *array = getArray(slot);
+   if (array == NULL || array->rank != rank || array->rows != rows
+       || array->cols != cols) {
+      dimArray(slot, rank, rows, cols);
+   }
+   return arrays[slot];
+}
+
+ArrayValue & EvalState::getDimensionedArray(int slot) {
+   ArrayValue *array = getArray(slot);
+   if (array == NULL) error("Array " + getVariableName(slot) + " is not dimensioned");
+   return *array;
+}
+
+/*
+ * Implementation notes: elementError
+ * ----------------------------------
+ * Called by getElement, which has found that it cannot return the
+ * element, to raise the error that says why.
+ */
+
+void EvalState::elementError(int slot, int count, double i, double j) {
+   ArrayValue & array = getDimensionedArray(slot);
+   const string & name = getVariableName(slot);
+   if (array.rank != count) {
+      error("Array " + name + " has " + integerToString(array.rank)
+            + ((array.rank == 1) ? " dimension" : " dimensions"));
+   }
+   string subscripts = realToString(i);
+   if (count == 2) subscripts += ", " + realToString(j);
+   error("Subscript out of range: " + name + "(" + subscripts + ")");
+}
+
+void EvalState::setHeadless(bool flag) {
+   headless = flag;
+}
+
+void EvalState::setDisplay(Display *display) {
+   this->display = display;
+}
+
+Display *EvalState::getDisplay() {
+   return display;
+}
+
+void EvalState::setOutput(OutputBuffer *output) {
+   this->output = output;
 }
 
-void EvalState::setValue(string var, double value) {
-   symbolTable.put(var, value);
+OutputBuffer & EvalState::getOutput() {
+   return (output == NULL) ? getConsoleOutput() : *output;
 }
 
-double EvalState::getValue(string var) {
-   return symbolTable.get(var);
+void EvalState::setInput(istream *input) {
+   this->input = input;
 }
 
-void EvalState::setNextLine(string lineNum) {
-	nextLine = (lineNum != "NULL") ? stringToInteger(lineNum) : NULL;
+istream *EvalState::getInput() {
+   return input;
 }
 
-int EvalState::getNextLine() {
-   return nextLine;
+void EvalState::setNextStatement(Statement *stmt) {
+   nextStmt = stmt;
 }
 
-bool EvalState::isDefined(string var) {
-   return symbolTable.containsKey(var);
+Statement *EvalState::getNextStatement() {
+   return nextStmt;
 }
@@ -9,19 +9,96 @@
 #ifndef _evalstate_h
 #define _evalstate_h
 
+#include <iosfwd>
 #include <string>
-#include "map.h"
+#include <vector>
 #include "strlib.h"
 
+class Statement;
+class OutputBuffer;
+class Display;
+
+/*
+ * Function: getVariableSlot
+ * Usage: int slot = getVariableSlot(name);
+ *        int slot = getVariableSlot(text, length);
+ * ------------------------------------------------
+ * Returns the slot number of the variable with the given name, which
+ * may also be given as length characters starting at text.  Slots
+ * are small dense integers handed out in order of first use, so the
+ * parser resolves every variable to its slot once and the evaluator
+ * never has to look a name up at run time.  The same name always maps
+ * to the same slot in every EvalState.  The table of names interns
+ * each distinct name once; statements, expressions, the debugger and
+ * program images keep only slots.  The table is shared by every
+ * interpreter in the process and may be used from any thread.
+ */
+
+int getVariableSlot(const std::string & name);
+int getVariableSlot(const char *text, int length);
+
+/*
+ * Function: getVariableName
+ * Usage: string name = getVariableName(slot);
+ * -------------------------------------------
+ * Returns the name of the variable assigned to slot.  Names are never
+ * removed or moved, so the reference stays valid for the life of the
+ * process.
+ */
+
+const std::string & getVariableName(int slot);
+
+/*
+ * Function: getVariableCount
+ * Usage: int n = getVariableCount();
+ * ----------------------------------
+ * Returns the number of slots assigned so far.
+ */
+
+int getVariableCount();
+
+/*
+ * Type: ArrayValue
+ * ----------------
+ * An array created by DIM.  Arrays have one or two dimensions, as in
+ * Dartmouth BASIC, and subscripts start at 1.  The rows * cols
+ * elements are stored row by row in a single block aligned to
+ * ARRAY_ALIGNMENT bytes, so the vector kernels of simd.h read them
+ * with full-width loads; a one-dimensional array has cols equal to 1.
+ * An array that has not been dimensioned has rank 0 and no data.
+ */
+
+struct ArrayValue {
+   double *data;
+   int rank;
+   int rows;
+   int cols;
+   int size;
+};
+
+/*
+ * Constants
+ * ---------
+ * ARRAY_ALIGNMENT -- Alignment in bytes of the elements of every array
+ * MAX_ARRAY_SIZE  -- Largest number of elements DIM accepts
+ */
+
+static const int ARRAY_ALIGNMENT = 64;
+static const int MAX_ARRAY_SIZE = 1 << 27;
+
 /*
  * Class: EvalState
  * ----------------
  * This class is passed by reference through the recursive levels
  * of the evaluator and contains information from the evaluation
  * environment that the evaluator may need to know. This class
- * contains a symbol table that maps variable names into their 
- * values. In addition, this class keeps track of disruptions in 
- * execution order by IF and GOTO statements.
+ * contains a symbol table that holds the value of each variable
+ * in a contiguous array indexed by slot, together with a bitmap
+ * recording which slots have been assigned, and the arrays created
+ * by DIM, also indexed by slot.  A name may stand for both a variable
+ * and an array.  In addition, this class keeps track of disruptions
+ * in execution order by IF and GOTO statements.  A state owns the
+ * storage of its arrays and cannot be copied.
  */
 
 class EvalState {
@@ -48,52 +125,267 @@ public:
 
 /*
  * Method: setValue
- * Usage: state.setValue(var, value);
- * ----------------------------------
- * Sets the value associated with the specified var.
+ * Usage: state.setValue(slot, value);
+ * -----------------------------------
+ * Sets the value of the variable in the specified slot.
  */
 
-   void setValue(std::string var, double value);
+   void setValue(int slot, double value);
 
 /*
  * Method: getValue
- * Usage: int value = state.getValue(var);
- * ---------------------------------------
- * Returns the value associated with the specified variable.
+ * Usage: double value = state.getValue(slot);
+ * -------------------------------------------
+ * Returns the value of the variable in the specified slot, which
+ * must be defined.
  */
 
-   double getValue(std::string var);
+   double getValue(int slot);
 
 /*
  * Method: isDefined
- * Usage: if (state.isDefined(var)) . . .
- * --------------------------------------
- * Returns true if the specified variable is defined.
+ * Usage: if (state.isDefined(slot)) . . .
+ * ---------------------------------------
+ * Returns true if the variable in the specified slot is defined.
+ */
+
+   bool isDefined(int slot);
+
+/*
+ * Method: clearValue
+ * Usage: state.clearValue(slot);
+ * ------------------------------
+ * Marks the variable in the specified slot as undefined.
+ */
+
+   void clearValue(int slot);
+
+/*
+ * Method: reserve
+ * Usage: state.reserve(getVariableCount());
+ * -----------------------------------------
+ * Makes room for nSlots variables, so that setValue does not need
+ * to grow the arrays while a program is running.
+ */
+
+   void reserve(int nSlots);
+
+/*
+ * Methods: getValueArray, getDefinedBitmap
+ * Usage: double *values = state.getValueArray();
+ * ----------------------------------------------
+ * Return the raw storage behind the slots, for native code generated
+ * by the JIT.  Bit (slot % 32) of word (slot / 32) of the bitmap is
+ * set when the slot is defined.  The pointers remain valid until the
+ * arrays grow, which cannot happen while a program is running once
+ * reserve(getVariableCount()) has been called.
+ */
+
+   double *getValueArray();
+   unsigned int *getDefinedBitmap();
+
+/*
+ * Method: dimArray
+ * Usage: state.dimArray(slot, 1, n, 1);
+ *        state.dimArray(slot, 2, rows, cols);
+ * -------------------------------------------
+ * Gives the array in slot the specified rank and extents, with every
+ * element set to zero.  An array dimensioned again, such as by a DIM
+ * that runs a second time, is replaced.  Raises an error unless the
+ * extents are at least 1 and the size at most MAX_ARRAY_SIZE.
+ */
+
+   void dimArray(int slot, int rank, int rows, int cols);
+
+/*
+ * Method: shapeArray
+ * Usage: ArrayValue & dst = state.shapeArray(slot, rank, rows, cols);
+ * -------------------------------------------------------------------
+ * Makes the array in slot the target of a whole-array assignment with
+ * a result of the given shape and returns it.  An array that already
+ * has this shape keeps its storage, so the result may be computed in
+ * place; any other is dimensioned anew.
  */
 
-   bool isDefined(std::string var);
+   ArrayValue & shapeArray(int slot, int rank, int rows, int cols);
 
 /*
- * Method: setNextLine
- * Usage: state.setNextLine(string lineNum);
- * ------------------------------------------
- * Sets the index of the next line to be executed.
+ * Methods: getArray, getDimensionedArray
+ * Usage: ArrayValue *array = state.getArray(slot);
+ *        ArrayValue & array = state.getDimensionedArray(slot);
+ * ------------------------------------------------------------
+ * Return the array in slot.  getArray returns NULL if it has not been
+ * dimensioned, and getDimensionedArray raises an error.
  */
-   void setNextLine(string lineNum);
+
+   ArrayValue *getArray(int slot);
+   ArrayValue & getDimensionedArray(int slot);
 
 /*
- * Method: getNextLine
- * Usage: state.getNextLine();
+ * Method: getElement
+ * Usage: double *element = state.getElement(slot, i);
+ *        double *element = state.getElement(slot, i, j);
+ * ------------------------------------------------------
+ * Returns the address of element i, or of element (i, j), of the
+ * array in slot.  Subscripts are truncated to whole numbers.  Raises
+ * an error if the array has not been dimensioned, has the other rank
+ * or does not contain the element.  The address stays valid until
+ * the array is dimensioned again.
+ */
+
+   double *getElement(int slot, double i);
+   double *getElement(int slot, double i, double j);
+
+/*
+ * Methods: setHeadless, isHeadless
+ * Usage: state.setHeadless(true);
+ *        if (state.isHeadless()) . . .
+ * ------------------------------------
+ * Controls whether statements update the graphical debugger as they
+ * execute.  A headless state skips every graphics call and never
+ * formats the strings the debugger would display.  States start out
+ * with graphics enabled, but a state without a display (see below)
+ * is always headless.
+ */
+
+   void setHeadless(bool flag);
+   bool isHeadless();
+
+/*
+ * Methods: setDisplay, getDisplay
+ * Usage: state.setDisplay(&display);
+ *        state.getDisplay()->startAfter();
  * ----------------------------------------
- * Returns the index of the next line to be executed.
+ * Set and return the display (see display.h) on which statements
+ * show their effects while they execute, or NULL, the initial
+ * setting, for none.  The display is not owned by the state.
+ */
+
+   void setDisplay(Display *display);
+   Display *getDisplay();
+
+/*
+ * Methods: setOutput, getOutput
+ * Usage: state.setOutput(&buffer);
+ *        state.getOutput().writeNumber(value);
+ * --------------------------------------------
+ * Set and return the buffer that PRINT writes to.  States start out
+ * writing to the console buffer (see output.h); setOutput(NULL)
+ * returns to it.  The buffer is not owned by the state.  The console
+ * buffer is not locked, so states that run at the same time, as in
+ * a batch runner, must each be given a buffer of their own.
+ */
+
+   void setOutput(OutputBuffer *output);
+   OutputBuffer & getOutput();
+
+/*
+ * Methods: setInput, getInput
+ * Usage: state.setInput(&stream);
+ *        double value = readInput(name, state.getInput());
+ * --------------------------------------------------------
+ * Set and return the stream from which INPUT reads its values, or
+ * NULL, the initial setting, to prompt the user instead.  The stream
+ * is not owned by the state.
+ */
+
+   void setInput(std::istream *input);
+   std::istream *getInput();
+
+/*
+ * Method: setNextStatement
+ * Usage: state.setNextStatement(stmt);
+ * ------------------------------------
+ * Sets the statement to be executed next.  The run loop sets this
+ * to the linked successor before executing each statement, so only
+ * statements that disrupt execution order (IF, GOTO, END and the
+ * loops) need to call it.  NULL halts execution.
  */
-   int getNextLine();
+   void setNextStatement(Statement *stmt);
+
+/*
+ * Method: getNextStatement
+ * Usage: Statement *stmt = state.getNextStatement();
+ * --------------------------------------------------
+ * Returns the statement to be executed next.
+ */
+   Statement *getNextStatement();
 
 private:
 
-   Map<std::string,double> symbolTable;
-   int nextLine;
+   std::vector<double> values;
+   std::vector<unsigned int> definedBits;
+   std::vector<ArrayValue> arrays;
+   Statement *nextStmt;
+   OutputBuffer *output;
+   std::istream *input;
+   Display *display;
+   bool headless;
+
+   void elementError(int slot, int count, double i, double j);
+
+   EvalState(const EvalState & src);
+   EvalState & operator=(const EvalState & src);
 
 };
 
+/*
+ * Implementation notes: slot access
+ * ---------------------------------
+ * The slot accessors run on every variable reference, and
+ * getElement on every reference to an array element, so they are
+ * defined inline here rather than in evalstate.cpp.  Slots beyond
+ * the end of the arrays are simply undefined; setValue grows the
+ * arrays on demand.  getElement checks a subscript as a double, so
+ * that a huge or NaN subscript fails the check instead of overflowing
+ * the conversion to int.
+ */
+
+inline bool EvalState::isDefined(int slot) {
+   return slot < (int) values.size()
+       && ((definedBits[slot >> 5] >> (slot & 31)) & 1) != 0;
+}
+
+inline double EvalState::getValue(int slot) {
+   return values[slot];
+}
+
+inline bool EvalState::isHeadless() {
+   return headless || display == NULL;
+}
+
+inline void EvalState::setValue(int slot, double value) {
+   if (slot >= (int) values.size()) reserve(slot + 1);
+   values[slot] = value;
+   definedBits[slot >> 5] |= 1u << (slot & 31);
+}
+
+inline void EvalState::clearValue(int slot) {
+   if (slot < (int) values.size()) {
+      definedBits[slot >> 5] &= ~(1u << (slot & 31));
+   }
+}
+
+inline ArrayValue *EvalState::getArray(int slot) {
+   if (slot >= (int) arrays.size() || arrays[slot].rank == 0) return NULL;
+   return &arrays[slot];
+}
+
+inline double *EvalState::getElement(int slot, double i) {
+   ArrayValue *array = getArray(slot);
+   if (array == NULL || array->rank != 1 || !(i >= 1 && i < array->rows + 1)) {
+      elementError(slot, 1, i, 0);
+   }
+   return array->data + ((int) i - 1);
+}
+
+inline double *EvalState::getElement(int slot, double i, double j) {
+   ArrayValue *array = getArray(slot);
+   if (array == NULL || array->rank != 2 || !(i >= 1 && i < array->rows + 1)
+       || !(j >= 1 && j < array->cols + 1)) {
+      elementError(slot, 2, i, j);
+   }
+   return array->data + ((int) i - 1) * array->cols + ((int) j - 1);
+}
+
 #endif
@@ -6,14 +6,73 @@
 
 #include <string>
 #include "exp.h"
+#include "arrays.h"
 #include "error.h"
 #include "strlib.h"
 using namespace std;
 
+/*
+ * Implementation notes: stringToOperator, operatorToString
+ * --------------------------------------------------------
+ * The two functions translate between tokens and the Operator type
+ * and are only called while parsing and displaying expressions.
+ */
+
+Operator stringToOperator(string token) {
+   if (token == "+") return PLUS_OP;
+   if (token == "-") return MINUS_OP;
+   if (token == "*") return TIMES_OP;
+   if (token == "/") return DIVIDE_OP;
+   if (token == "=") return ASSIGN_OP;
+   if (token == "<") return LESS_OP;
+   if (token == ">") return GREATER_OP;
+   return INVALID_OP;
+}
+
+string operatorToString(Operator op) {
+   switch (op) {
+   case PLUS_OP: return "+";
+   case MINUS_OP: return "-";
+   case TIMES_OP: return "*";
+   case DIVIDE_OP: return "/";
+   case ASSIGN_OP: case EQUAL_OP: return "=";
+   case LESS_OP: return "<";
+   case GREATER_OP: return ">";
+   default: return "?";
+   }
+}
+
+/*
+ * Function: applyOperator
+ * Usage: double result = applyOperator(op, lhs, rhs);
+ * ---------------------------------------------------
+ * Applies an arithmetic or comparison operator to two values.
+ * Comparisons yield 1 when they hold and 0 otherwise.  The
+ * specialized node classes below pass op as a template argument,
+ * which lets the compiler reduce the switch to a single operation.
+ */
+
+static inline double applyOperator(Operator op, double lhs, double rhs) {
+   switch (op) {
+   case PLUS_OP: return lhs + rhs;
+   case MINUS_OP: return lhs - rhs;
+   case TIMES_OP: return lhs * rhs;
+   case DIVIDE_OP: return lhs / rhs;
+   case EQUAL_OP: return (lhs == rhs) ? 1 : 0;
+   case LESS_OP: return (lhs < rhs) ? 1 : 0;
+   case GREATER_OP: return (lhs > rhs) ? 1 : 0;
+   default: break;
+   }
+   error("Illegal operator in expression");
+   return 0;
+}
+
 /*
  * Implementation notes: the Expression class
  * ------------------------------------------
- * Declares no instance variables and needs no code.
+ * Declares no instance variables.  Memory comes from the arena passed
+ * to new; the placement form of delete is called only if a
+ * constructor throws, and the storage then simply stays in the arena.
  */
 
 Expression::Expression() {
@@ -24,6 +83,18 @@ Expression::~Expression() {
    /* Empty */
 }
 
+void *Expression::operator new(size_t size, Arena & arena) {
+   return arena.allocate(size);
+}
+
+void Expression::operator delete(void *ptr, Arena & arena) {
+   /* Empty */
+}
+
+void Expression::operator delete(void *ptr) {
+   /* Empty */
+}
+
 /*
  * Implementation notes: the ConstantExp subclass
  * ----------------------------------------------
@@ -55,22 +126,23 @@ double ConstantExp::getValue() {
 /*
  * Implementation notes: the IdentifierExp subclass
  * ------------------------------------------------
- * eclares a single instance variable that stores the name of 
- * the variable. The implementation of eval must look up this
- * variable in the evaluation state.
+ * Declares a single instance variable that stores the slot the
+ * variable was resolved to. The implementation of eval looks up the
+ * slot in the evaluation state; the name is recovered from the slot
+ * table, which owns it, only for display and error messages.
  */
 
-IdentifierExp::IdentifierExp(string name) {
-   this->name = name;
+IdentifierExp::IdentifierExp(int slot) {
+   this->slot = slot;
 }
 
 double IdentifierExp::eval(EvalState & state) {
-   if (!state.isDefined(name)) error(name + " is undefined");
-   return state.getValue(name);
+   if (!state.isDefined(slot)) error(getVariableName(slot) + " is undefined");
+   return state.getValue(slot);
 }
 
 string IdentifierExp::toString() {
-   return name;
+   return getVariableName(slot);
 }
 
 ExpressionType IdentifierExp::getType() {
@@ -78,7 +150,11 @@ ExpressionType IdentifierExp::getType() {
 }
 
 string IdentifierExp::getName() {
-   return name;
+   return getVariableName(slot);
+}
+
+int IdentifierExp::getSlot() {
+   return slot;
 }
 
 /*
@@ -90,14 +166,15 @@ string IdentifierExp::getName() {
  */
 
 CompoundExp::CompoundExp(string op, Expression *lhs, Expression *rhs) {
-   this->op = op;
+   this->op = stringToOperator(op);
    this->lhs = lhs;
    this->rhs = rhs;
 }
 
-CompoundExp::~CompoundExp() {
-   delete lhs;
-   delete rhs;
+CompoundExp::CompoundExp(Operator op, Expression *lhs, Expression *rhs) {
+   this->op = op;
+   this->lhs = lhs;
+   this->rhs = rhs;
 }
 
 /*
@@ -109,26 +186,22 @@ CompoundExp::~CompoundExp() {
  */
 
 double CompoundExp::eval(EvalState & state) {
-   if (op == "=") {
+   if (op == ASSIGN_OP) {
       if (lhs->getType() != IDENTIFIER) {
          error("Illegal variable in assignment");
       }
       double val = rhs->eval(state);
-      state.setValue(((IdentifierExp *) lhs)->getName(), val);
+      state.setValue(((IdentifierExp *) lhs)->getSlot(), val);
       return val;
    }
    double left = lhs->eval(state);
    double right = rhs->eval(state);
-   if (op == "+") return left + right;
-   if (op == "-") return left - right;
-   if (op == "*") return left * right;
-   if (op == "/") return left / right;
-   error("Illegal operator in expression");
-   return 0;
+   return applyOperator(op, left, right);
 }
 
 string CompoundExp::toString() {
-   return '(' + lhs->toString() + ' ' + op + ' ' + rhs->toString() + ')';
+   return '(' + lhs->toString() + ' ' + operatorToString(op) + ' ' 
+              + rhs->toString() + ')';
 }
 
 ExpressionType CompoundExp::getType() {
@@ -136,6 +209,10 @@ ExpressionType CompoundExp::getType() {
 }
 
 string CompoundExp::getOp() {
+   return operatorToString(op);
+}
+
+Operator CompoundExp::getOperator() {
    return op;
 }
 
@@ -146,3 +223,204 @@ Expression *CompoundExp::getLHS() {
 Expression *CompoundExp::getRHS() {
    return rhs;
 }
+
+/*
+ * Implementation notes: the ArrayExp subclass
+ * -------------------------------------------
+ * Declares instance variables for the slot of the array and its
+ * subscripts.  The implementation of eval evaluates the subscripts
+ * from left to right and lets the EvalState check them.
+ */
+
+ArrayExp::ArrayExp(int slot, int nSubscripts, Expression **subscripts) {
+   this->slot = slot;
+   this->nSubscripts = nSubscripts;
+   this->subscripts = subscripts;
+}
+
+double ArrayExp::eval(EvalState & state) {
+   switch (nSubscripts) {
+   case 1:
+      return *state.getElement(slot, subscripts[0]->eval(state));
+   case 2: {
+      double i = subscripts[0]->eval(state);
+      double j = subscripts[1]->eval(state);
+      return *state.getElement(slot, i, j);
+   }
+   default:
+      error("Whole array " + toString() + " cannot be used as a number");
+      return 0;
+   }
+}
+
+string ArrayExp::toString() {
+   string str = getVariableName(slot) + '(';
+   for (int i = 0; i < nSubscripts; i++) {
+      if (i > 0) str += ", ";
+      str += subscripts[i]->toString();
+   }
+   return str + ')';
+}
+
+ExpressionType ArrayExp::getType() {
+   return ARRAY;
+}
+
+int ArrayExp::getSlot() {
+   return slot;
+}
+
+int ArrayExp::getSubscriptCount() {
+   return nSubscripts;
+}
+
+Expression *ArrayExp::getSubscript(int index) {
+   return subscripts[index];
+}
+
+bool ArrayExp::isWholeArray() {
+   return nSubscripts == 0;
+}
+
+/*
+ * Implementation notes: the ReductionExp subclass
+ * -----------------------------------------------
+ * Declares the slots of its one or two arrays; a negative rhsSlot
+ * marks SUM.  The work is done by the functions of arrays.h.
+ */
+
+ReductionExp::ReductionExp(int slot) {
+   this->slot = slot;
+   this->rhsSlot = -1;
+}
+
+ReductionExp::ReductionExp(int slot, int rhsSlot) {
+   this->slot = slot;
+   this->rhsSlot = rhsSlot;
+}
+
+double ReductionExp::eval(EvalState & state) {
+   if (rhsSlot < 0) return sumArray(state, slot);
+   return dotArrays(state, slot, rhsSlot);
+}
+
+string ReductionExp::toString() {
+   if (rhsSlot < 0) return "SUM(" + getVariableName(slot) + "())";
+   return "DOT(" + getVariableName(slot) + "(), " + getVariableName(rhsSlot)
+          + "())";
+}
+
+ExpressionType ReductionExp::getType() {
+   return REDUCTION;
+}
+
+bool ReductionExp::isDot() {
+   return rhsSlot >= 0;
+}
+
+int ReductionExp::getSlot() {
+   return slot;
+}
+
+int ReductionExp::getRhsSlot() {
+   return rhsSlot;
+}
+
+/*
+ * Implementation notes: specialized compound nodes
+ * ------------------------------------------------
+ * Each of these templates handles one shape of operands for one
+ * operator.  The operand slots and constant values are copied out of
+ * the child nodes when the node is built, so eval reads them directly
+ * without any virtual calls.  The children are still owned (and
+ * displayed) by the CompoundExp base class.
+ */
+
+static void undefinedError(Expression *exp) {
+   error(((IdentifierExp *) exp)->getName() + " is undefined");
+}
+
+template <Operator OP>
+class VarConstExp : public CompoundExp {
+public:
+   VarConstExp(Expression *lhs, Expression *rhs) : CompoundExp(OP, lhs, rhs) {
+      slot = ((IdentifierExp *) lhs)->getSlot();
+      value = ((ConstantExp *) rhs)->getValue();
+   }
+   virtual double eval(EvalState & state) {
+      if (!state.isDefined(slot)) undefinedError(getLHS());
+      return applyOperator(OP, state.getValue(slot), value);
+   }
+private:
+   int slot;
+   double value;
+};
+
+template <Operator OP>
+class ConstVarExp : public CompoundExp {
+public:
+   ConstVarExp(Expression *lhs, Expression *rhs) : CompoundExp(OP, lhs, rhs) {
+      value = ((ConstantExp *) lhs)->getValue();
+      slot = ((IdentifierExp *) rhs)->getSlot();
+   }
+   virtual double eval(EvalState & state) {
+      if (!state.isDefined(slot)) undefinedError(getRHS());
+      return applyOperator(OP, value, state.getValue(slot));
+   }
+private:
+   double value;
+   int slot;
+};
+
+template <Operator OP>
+class VarVarExp : public CompoundExp {
+public:
+   VarVarExp(Expression *lhs, Expression *rhs) : CompoundExp(OP, lhs, rhs) {
+      lhsSlot = ((IdentifierExp *) lhs)->getSlot();
+      rhsSlot = ((IdentifierExp *) rhs)->getSlot();
+   }
+   virtual double eval(EvalState & state) {
+      if (!state.isDefined(lhsSlot)) undefinedError(getLHS());
+      if (!state.isDefined(rhsSlot)) undefinedError(getRHS());
+      return applyOperator(OP, state.getValue(lhsSlot), state.getValue(rhsSlot));
+   }
+private:
+   int lhsSlot, rhsSlot;
+};
+
+template <Operator OP>
+static Expression *specialize(Expression *lhs, Expression *rhs, Arena & arena) {
+   ExpressionType lhsType = lhs->getType();
+   ExpressionType rhsType = rhs->getType();
+   if (lhsType == IDENTIFIER && rhsType == CONSTANT) {
+      return new (arena) VarConstExp<OP>(lhs, rhs);
+   }
+   if (lhsType == CONSTANT && rhsType == IDENTIFIER) {
+      return new (arena) ConstVarExp<OP>(lhs, rhs);
+   }
+   if (lhsType == IDENTIFIER && rhsType == IDENTIFIER) {
+      return new (arena) VarVarExp<OP>(lhs, rhs);
+   }
+   return new (arena) CompoundExp(OP, lhs, rhs);
+}
+
+/*
+ * Implementation notes: newCompoundExp
+ * ------------------------------------
+ * Dispatches on the operator once, at construction, so that every
+ * specialized node has its operator fixed at compile time.
+ */
+
+Expression *newCompoundExp(Operator op, Expression *lhs, Expression *rhs,
+                           Arena & arena) {
+   switch (op) {
+   case PLUS_OP: return specialize<PLUS_OP>(lhs, rhs, arena);
+   case MINUS_OP: return specialize<MINUS_OP>(lhs, rhs, arena);
+   case TIMES_OP: return specialize<TIMES_OP>(lhs, rhs, arena);
+   case DIVIDE_OP: return specialize<DIVIDE_OP>(lhs, rhs, arena);
+   case EQUAL_OP: return specialize<EQUAL_OP>(lhs, rhs, arena);
+   case LESS_OP: return specialize<LESS_OP>(lhs, rhs, arena);
+   case GREATER_OP: return specialize<GREATER_OP>(lhs, rhs, arena);
+   default: return new (arena) CompoundExp(op, lhs, rhs);
+   }
+}
@@ -9,16 +9,54 @@
 #ifndef _exp_h
 #define _exp_h
 
+#include <cstddef>
+#include "arena.h"
 #include "evalstate.h"
 
 /*
  * Type: ExpressionType
  * --------------------
- * This enumerated type is used to differentiate the three different
- * expression types: CONSTANT, IDENTIFIER, and COMPOUND.
+ * This enumerated type is used to differentiate the different
+ * expression types: CONSTANT, IDENTIFIER, COMPOUND, ARRAY and
+ * REDUCTION.
  */
 
-enum ExpressionType { CONSTANT, IDENTIFIER, COMPOUND };
+enum ExpressionType { CONSTANT, IDENTIFIER, COMPOUND, ARRAY, REDUCTION };
+
+/*
+ * Type: Operator
+ * --------------
+ * This enumerated type identifies the operator of a compound
+ * expression or of an IF condition.  Operators are converted from
+ * their token once, when the program is parsed, so that evaluation
+ * never has to compare strings.  INVALID_OP stands for any token
+ * that is not a recognized operator.
+ */
+
+enum Operator {
+   PLUS_OP, MINUS_OP, TIMES_OP, DIVIDE_OP, ASSIGN_OP,
+   EQUAL_OP, LESS_OP, GREATER_OP, INVALID_OP
+};
+
+/*
+ * Function: stringToOperator
+ * Usage: Operator op = stringToOperator(token);
+ * ---------------------------------------------
+ * Returns the operator named by token, or INVALID_OP.  The token "="
+ * is returned as ASSIGN_OP; callers parsing a condition treat it as
+ * EQUAL_OP.
+ */
+
+Operator stringToOperator(std::string token);
+
+/*
+ * Function: operatorToString
+ * Usage: string str = operatorToString(op);
+ * -----------------------------------------
+ * Returns the token that spells op.
+ */
+
+std::string operatorToString(Operator op);
 
 /*
  * Class: Expression
@@ -26,12 +64,14 @@ enum ExpressionType { CONSTANT, IDENTIFIER, COMPOUND };
  * This class is used to represent a node in an expression tree.
  * Expression is an example of an abstract class, which defines
  * the structure and behavior of a set of classes but has no
- * objects of its own.  Any object must be one of the three
+ * objects of its own.  Any object must be one of the five
  * concrete subclasses of Expression:
  *
  *  1. ConstantExp   -- an integer constant
  *  2. IdentifierExp -- a string representing an identifier
  *  3. CompoundExp   -- two expressions combined by an operator
+ *  4. ArrayExp      -- an array element or a whole array
+ *  5. ReductionExp  -- SUM or DOT over whole arrays
  *
  * The Expression class defines the interface common to all
  * Expression objects; each subclass provides its own specific
@@ -41,6 +81,11 @@ enum ExpressionType { CONSTANT, IDENTIFIER, COMPOUND };
  * class is marked with the designation = 0 on the prototype line.
  * This notation is used in C++ to indicate that this method is
  * purely virtual and will always be supplied by the subclass.
+ *
+ * Every expression lives in an Arena (see arena.h), normally the one
+ * of the program it belongs to, and is freed together with it.  Since
+ * no node is ever deleted on its own, nodes may be shared between
+ * trees.
  */
 
 class Expression {
@@ -58,15 +103,26 @@ public:
 
 /*
  * Destructor: ~Expression
- * Usage: delete exp;
- * ------------------
- * The destructor deallocates the storage for this expression.
- * It must be declared virtual to ensure that the correct subclass
- * destructor is called when deleting an expression.
+ * -----------------------
+ * Expressions are released with their arena, so the destructor is
+ * never run; it is declared virtual only because the class is
+ * polymorphic.
  */
 
    virtual ~Expression();
 
+/*
+ * Operators: new, delete
+ * Usage: Expression *exp = new (arena) ConstantExp(value);
+ * --------------------------------------------------------
+ * Allocates an expression from the given arena.  There is no form
+ * of new without an arena, and delete releases no memory.
+ */
+
+   static void *operator new(size_t size, Arena & arena);
+   static void operator delete(void *ptr, Arena & arena);
+   static void operator delete(void *ptr);
+
 /*
  * Method: eval
  * Usage: int value = exp->eval(state);
@@ -91,7 +147,7 @@ public:
  * Usage: ExpressionType type = exp->getType();
  * --------------------------------------------
  * Returns the type of the expression, which must be one of the constants
- * CONSTANT, IDENTIFIER, or COMPOUND.
+ * CONSTANT, IDENTIFIER, COMPOUND, ARRAY or REDUCTION.
  */
 
    virtual ExpressionType getType() = 0;
@@ -110,8 +166,8 @@ public:
 
 /*
  * Constructor: ConstantExp
- * Usage: Expression *exp = new ConstantExp(value);
- * ------------------------------------------------
+ * Usage: Expression *exp = new (arena) ConstantExp(value);
+ * --------------------------------------------------------
  * The constructor initializes a new integer constant expression
  * to the given value.
  */
@@ -157,13 +213,13 @@ public:
 
 /*
  * Constructor: IdentifierExp
- * Usage: Expression *exp = new IdentifierExp(name);
- * -------------------------------------------------
+ * Usage: Expression *exp = new (arena) IdentifierExp(slot);
+ * ---------------------------------------------------------
  * The constructor initializes a new identifier expression
- * for the variable named by name.
+ * for the variable in slot (see getVariableSlot).
  */
 
-   IdentifierExp(std::string name);
+   IdentifierExp(int slot);
 
 /*
  * Prototypes for the virtual methods
@@ -180,15 +236,25 @@ public:
  * Method: getName
  * Usage: string name = ((IdentifierExp *) exp)->getName();
  * --------------------------------------------------------
- * Returns the name field of the identifier node and can be applied only
- * to an object known to be an IdentifierExp.
+ * Returns the name of the identifier, as recorded in the slot table,
+ * and can be applied only to an object known to be an IdentifierExp.
  */
 
    std::string getName();
 
+/*
+ * Method: getSlot
+ * Usage: int slot = ((IdentifierExp *) exp)->getSlot();
+ * -----------------------------------------------------
+ * Returns the variable slot of the identifier node and can be applied
+ * only to an object known to be an IdentifierExp.
+ */
+
+   int getSlot();
+
 private:
 
-   std::string name;
+   int slot;
 
 };
 
@@ -205,14 +271,15 @@ public:
 
 /*
  * Constructor: CompoundExp
- * Usage: Expression *exp = new CompoundExp(op, lhs, rhs);
- * -------------------------------------------------------
+ * Usage: Expression *exp = new (arena) CompoundExp(op, lhs, rhs);
+ * ---------------------------------------------------------------
  * The constructor initializes a new compound expression
  * which is composed of the operator (op) and the left and
  * right subexpression (lhs and rhs).
  */
 
    CompoundExp(std::string op, Expression *lhs, Expression *rhs);
+   CompoundExp(Operator op, Expression *lhs, Expression *rhs);
 
 /*
  * Prototypes for the virtual methods
@@ -221,14 +288,14 @@ public:
  * base class and don't require additional documentation.
  */
 
-   virtual ~CompoundExp();
    virtual double eval(EvalState & state);
    virtual std::string toString();
    virtual ExpressionType getType();
 
 /*
- * Methods: getOp, getLHS, getRHS
+ * Methods: getOp, getOperator, getLHS, getRHS
  * Usage: string op = ((CompoundExp *) exp)->getOp();
+ *        Operator op = ((CompoundExp *) exp)->getOperator();
  *        Expression *lhs = ((CompoundExp *) exp)->getLHS();
  *        Expression *rhs = ((CompoundExp *) exp)->getRHS();
  * ---------------------------------------------------------
@@ -237,14 +304,148 @@ public:
  */
 
    std::string getOp();
+   Operator getOperator();
    Expression *getLHS();
    Expression *getRHS();
 
 private:
 
-   std::string op;
+   Operator op;
    Expression *lhs, *rhs;
 
 };
 
+/*
+ * Class: ArrayExp
+ * ---------------
+ * This subclass represents a reference to an array: an element, such
+ * as A(I) or A(I, J), or the whole array, written A().  A whole array
+ * has no subscripts and stands for no single value; it may only
+ * appear in a whole-array assignment (see ArrayLetStmt), and eval
+ * raises an error for it.
+ */
+
+class ArrayExp : public Expression {
+
+public:
+
+/*
+ * Constructor: ArrayExp
+ * Usage: Expression *exp = new (arena) ArrayExp(slot, nSubscripts, subscripts);
+ * -----------------------------------------------------------------------------
+ * The constructor initializes a reference to the array in slot with
+ * nSubscripts subscripts, which must be 0, 1 or 2.  The subscripts
+ * array must live in the same arena as the node.
+ */
+
+   ArrayExp(int slot, int nSubscripts, Expression **subscripts);
+
+/*
+ * Prototypes for the virtual methods
+ * ----------------------------------
+ * These methods have the same prototypes as those in the Expression
+ * base class and don't require additional documentation.
+ */
+
+   virtual double eval(EvalState & state);
+   virtual std::string toString();
+   virtual ExpressionType getType();
+
+/*
+ * Methods: getSlot, getSubscriptCount, getSubscript, isWholeArray
+ * Usage: int slot = ((ArrayExp *) exp)->getSlot();
+ *        int n = ((ArrayExp *) exp)->getSubscriptCount();
+ *        Expression *i = ((ArrayExp *) exp)->getSubscript(0);
+ *        if (((ArrayExp *) exp)->isWholeArray()) ...
+ * -------------------------------------------------------------
+ * These methods return the components of an array node and can be
+ * applied only to an object known to be an ArrayExp.
+ */
+
+   int getSlot();
+   int getSubscriptCount();
+   Expression *getSubscript(int index);
+   bool isWholeArray();
+
+private:
+
+   int slot;
+   int nSubscripts;
+   Expression **subscripts;
+
+};
+
+/*
+ * Class: ReductionExp
+ * -------------------
+ * This subclass represents SUM(A()), the sum of the elements of an
+ * array, or DOT(A(), B()), the sum of the products of the elements
+ * in the same place of two arrays of the same shape.
+ */
+
+class ReductionExp : public Expression {
+
+public:
+
+/*
+ * Constructor: ReductionExp
+ * Usage: Expression *exp = new (arena) ReductionExp(slot);
+ *        Expression *exp = new (arena) ReductionExp(slot, rhsSlot);
+ * -----------------------------------------------------------------
+ * The constructor initializes SUM over the array in slot or DOT over
+ * the arrays in slot and rhsSlot.
+ */
+
+   ReductionExp(int slot);
+   ReductionExp(int slot, int rhsSlot);
+
+/*
+ * Prototypes for the virtual methods
+ * ----------------------------------
+ * These methods have the same prototypes as those in the Expression
+ * base class and don't require additional documentation.
+ */
+
+   virtual double eval(EvalState & state);
+   virtual std::string toString();
+   virtual ExpressionType getType();
+
+/*
+ * Methods: isDot, getSlot, getRhsSlot
+ * Usage: if (((ReductionExp *) exp)->isDot()) ...
+ *        int slot = ((ReductionExp *) exp)->getSlot();
+ *        int rhsSlot = ((ReductionExp *) exp)->getRhsSlot();
+ * ---------------------------------------------------------
+ * These methods return the components of a reduction node and can be
+ * applied only to an object known to be a ReductionExp.  getRhsSlot
+ * returns -1 for SUM.
+ */
+
+   bool isDot();
+   int getSlot();
+   int getRhsSlot();
+
+private:
+
+   int slot;
+   int rhsSlot;
+
+};
+
+/*
+ * Function: newCompoundExp
+ * Usage: Expression *exp = newCompoundExp(op, lhs, rhs, arena);
+ * -------------------------------------------------------------
+ * Creates a compound expression in arena, choosing a specialized subclass of
+ * CompoundExp when the operands allow it.  An arithmetic or
+ * comparison operator applied to a variable and a constant, a
+ * constant and a variable, or two variables gets a node whose eval
+ * reads the operands directly instead of evaluating them as child
+ * expressions.  The result behaves exactly like a CompoundExp, so
+ * getType, toString and the accessors above work on it unchanged.
+ */
+
+Expression *newCompoundExp(Operator op, Expression *lhs, Expression *rhs,
+                           Arena & arena);
+
 #endif
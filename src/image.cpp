@@ -0,0 +1,428 @@
+/*
+ * File: image.cpp
+ * ---------------
+ * Implements the image.h interface.
+ */
+
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "image.h"
+#include "evalstate.h"
+#include "error.h"
+#include "simd.h"
+#include "strlib.h"
+#include "vector.h"
+using namespace std;
+
+#if defined(_WIN32)
+#  define IMAGE_WIN32
+#  ifndef WIN32_LEAN_AND_MEAN
+#  define WIN32_LEAN_AND_MEAN
+#  endif
+#  include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#  define IMAGE_POSIX
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+/*
+ * Implementation notes: file layout
+ * ---------------------------------
+ * An image starts with the header below, written in the byte order
+ * of the machine that produced it.  The sections follow in a fixed
+ * order, each starting at an offset derived from the counts in the
+ * header alone:
+ *
+ *   header, padded to a multiple of 8 bytes
+ *   constants         constantCount doubles
+ *   code              codeLength ints
+ *   string offsets    stringCount + 1 ints
+ *   slot offsets      slotCount + 1 ints
+ *   string data       stringBytes characters
+ *   slot names        slotBytes characters
+ *
+ * Putting the doubles first keeps them aligned in the mapping.  The
+ * checksum is the 32-bit FNV-1a hash of everything after the header.
+ */
+
+static const char IMAGE_MAGIC[8] = { 'B', 'A', 'S', 'I', 'C', 'I', 'M', 'G' };
+static const unsigned int IMAGE_VERSION = 5;
+static const unsigned int BYTE_ORDER_MARK = 0x01020304;
+
+struct ImageHeader {
+   char magic[8];
+   unsigned int version;
+   unsigned int byteOrder;
+   unsigned int checksum;
+   int maxStack;
+   int codeLength;
+   int constantCount;
+   int stringCount;
+   int stringBytes;
+   int slotCount;
+   int slotBytes;
+};
+
+struct ImageLayout {
+   size_t constants;
+   size_t code;
+   size_t stringOffsets;
+   size_t slotOffsets;
+   size_t stringData;
+   size_t slotData;
+   size_t end;
+};
+
+static ImageLayout layoutImage(const ImageHeader & header) {
+   ImageLayout layout;
+   layout.constants = (sizeof(ImageHeader) + 7) & ~(size_t) 7;
+   layout.code = layout.constants + header.constantCount * sizeof(double);
+   layout.stringOffsets = layout.code + header.codeLength * sizeof(int);
+   layout.slotOffsets = layout.stringOffsets
+                      + (header.stringCount + 1) * sizeof(int);
+   layout.stringData = layout.slotOffsets + (header.slotCount + 1) * sizeof(int);
+   layout.slotData = layout.stringData + header.stringBytes;
+   layout.end = layout.slotData + header.slotBytes;
+   return layout;
+}
+
+static unsigned int checksum(const char *data, size_t length) {
+   unsigned int hash = 2166136261u;
+   for (size_t i = 0; i < length; i++) {
+      hash ^= (unsigned char) data[i];
+      hash *= 16777619u;
+   }
+   return hash;
+}
+
+static void appendBytes(string & out, const void *data, size_t length) {
+   if (length > 0) out.append((const char *) data, length);
+}
+
+/*
+ * Implementation notes: writeImage
+ * --------------------------------
+ * The image is assembled in memory and written with a single call.
+ * The slot names are those of the whole slot table, which covers
+ * every variable the program refers to.
+ */
+
+void writeImage(Bytecode & bc, string filename) {
+   int slotCount = getVariableCount();
+   string slotData;
+   Vector<int> slotOffsets;
+   slotOffsets.add(0);
+   for (int i = 0; i < slotCount; i++) {
+      slotData += getVariableName(i);
+      slotOffsets.add(slotData.size());
+   }
+   ImageHeader header;
+   memset(&header, 0, sizeof header);
+   memcpy(header.magic, IMAGE_MAGIC, sizeof header.magic);
+   header.version = IMAGE_VERSION;
+   header.byteOrder = BYTE_ORDER_MARK;
+   header.maxStack = bc.maxStack;
+   header.codeLength = bc.code.size();
+   header.constantCount = bc.constants.size();
+   header.stringCount = bc.stringOffsets.size() - 1;
+   header.stringBytes = bc.stringData.size();
+   header.slotCount = slotCount;
+   header.slotBytes = slotData.size();
+   ImageLayout layout = layoutImage(header);
+   CodeView view = getCodeView(bc);
+   string out(layout.constants, '\0');
+   appendBytes(out, view.constants, header.constantCount * sizeof(double));
+   appendBytes(out, view.code, header.codeLength * sizeof(int));
+   appendBytes(out, view.stringOffsets, (header.stringCount + 1) * sizeof(int));
+   appendBytes(out, &slotOffsets[0], (slotCount + 1) * sizeof(int));
+   appendBytes(out, bc.stringData.data(), header.stringBytes);
+   appendBytes(out, slotData.data(), header.slotBytes);
+   header.checksum = checksum(out.data() + layout.constants,
+                              out.size() - layout.constants);
+   memcpy(&out[0], &header, sizeof header);
+   ofstream outfile(filename.c_str(), ios::out | ios::binary | ios::trunc);
+   if (outfile.fail()) error("Can't write image " + filename);
+   outfile.write(out.data(), out.size());
+   outfile.close();
+   if (outfile.fail()) error("Can't write image " + filename);
+}
+
+/*
+ * Implementation notes: ProgramImage
+ * ----------------------------------
+ * The constructor maps the file, checks it and binds its slots.  If
+ * any step fails the mapping is released before the error propagates,
+ * since the destructor does not run for a half-built object.
+ */
+
+ProgramImage::ProgramImage(string filename) {
+   base = NULL;
+   size = 0;
+   mapping = NULL;
+   mapFile(filename);
+   try {
+      checkImage();
+   } catch (...) {
+      unmapFile();
+      throw;
+   }
+}
+
+ProgramImage::~ProgramImage() {
+   unmapFile();
+}
+
+const CodeView & ProgramImage::getView() const {
+   return view;
+}
+
+/*
+ * Implementation notes: mapFile, unmapFile
+ * ----------------------------------------
+ * The file is mapped read-only and shared, so every process running
+ * the same image uses the same physical pages.  On platforms without
+ * a mapping call the file is read into a buffer of doubles, which
+ * gives the constant pool the alignment a mapping would.
+ */
+
+void ProgramImage::mapFile(string filename) {
+#if defined(IMAGE_POSIX)
+   int fd = open(filename.c_str(), O_RDONLY);
+   if (fd < 0) error("Can't open image " + filename);
+   struct stat info;
+   if (fstat(fd, &info) < 0 || info.st_size <= 0) {
+      close(fd);
+      error(filename + " is not a program image");
+   }
+   size = (size_t) info.st_size;
+   void *addr = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+   close(fd);
+   if (addr == MAP_FAILED) error("Can't map image " + filename);
+   mapping = addr;
+   base = (const char *) addr;
+#elif defined(IMAGE_WIN32)
+   HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                             NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+   if (file == INVALID_HANDLE_VALUE) error("Can't open image " + filename);
+   LARGE_INTEGER fileSize;
+   if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0) {
+      CloseHandle(file);
+      error(filename + " is not a program image");
+   }
+   size = (size_t) fileSize.QuadPart;
+   HANDLE section = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+   CloseHandle(file);
+   if (section == NULL) error("Can't map image " + filename);
+   void *addr = MapViewOfFile(section, FILE_MAP_READ, 0, 0, 0);
+   CloseHandle(section);
+   if (addr == NULL) error("Can't map image " + filename);
+   mapping = addr;
+   base = (const char *) addr;
+#else
+   ifstream infile(filename.c_str(), ios::in | ios::binary);
+   if (infile.fail()) error("Can't open image " + filename);
+   infile.seekg(0, ios::end);
+   streamoff fileSize = infile.tellg();
+   infile.seekg(0, ios::beg);
+   if (fileSize <= 0) error(filename + " is not a program image");
+   size = (size_t) fileSize;
+   buffer.resize((size + sizeof(double) - 1) / sizeof(double));
+   infile.read((char *) &buffer[0], size);
+   if ((size_t) infile.gcount() != size) error("Can't read image " + filename);
+   base = (const char *) &buffer[0];
+#endif
+}
+
+void ProgramImage::unmapFile() {
+#if defined(IMAGE_POSIX)
+   if (mapping != NULL) munmap(mapping, size);
+#elif defined(IMAGE_WIN32)
+   if (mapping != NULL) UnmapViewOfFile(mapping);
+#else
+   buffer.clear();
+#endif
+   mapping = NULL;
+   base = NULL;
+}
+
+/*
+ * Implementation notes: checkImage
+ * --------------------------------
+ * An image is trusted no further than its checksum: the VM does not
+ * check operands or stack bounds, so the code is walked once here.
+ * Every instruction must be a known opcode whose operands name an
+ * existing constant, string, slot or instruction, or an ArrayOp.  The
+ * compiler keeps the stack depth a function of the address alone, so
+ * the walk can track it linearly; no instruction may pop more values
+ * than are on the stack or push beyond maxStack, and every jump must
+ * arrive with the depth its target expects.  The last instruction
+ * must be OP_HALT.
+ */
+
+static int getStackInputs(int op) {
+   switch (op) {
+   case OP_STORE_ELEM2:
+      return 3;
+   case OP_ADD: case OP_SUB: case OP_MUL: case OP_DIV:
+   case OP_JUMP_EQ: case OP_JUMP_LT: case OP_JUMP_GT:
+   case OP_DIM2: case OP_LOAD_ELEM2: case OP_STORE_ELEM1:
+      return 2;
+   case OP_STORE: case OP_DUP: case OP_PRINT_NUM:
+   case OP_DIM1: case OP_LOAD_ELEM1:
+   case OP_ARRAY_FILL: case OP_ARRAY_SCALAR: case OP_SCALAR_ARRAY:
+      return 1;
+   default:
+      return 0;
+   }
+}
+
+static void checkOffsets(const int *offsets, int count, int bytes) {
+   if (offsets[0] != 0 || offsets[count] != bytes) {
+      error("Corrupt string table in program image");
+   }
+   for (int i = 0; i < count; i++) {
+      if (offsets[i] > offsets[i + 1]) {
+         error("Corrupt string table in program image");
+      }
+   }
+}
+
+void ProgramImage::checkImage() {
+   ImageHeader header;
+   if (size < sizeof header) error("File is not a program image");
+   memcpy(&header, base, sizeof header);
+   if (memcmp(header.magic, IMAGE_MAGIC, sizeof header.magic) != 0) {
+      error("File is not a program image");
+   }
+   if (header.byteOrder != BYTE_ORDER_MARK) {
+      error("Program image was written on a machine with another byte order");
+   }
+   if (header.version != IMAGE_VERSION) {
+      error("Program image has version " + integerToString(header.version)
+            + "; expected " + integerToString(IMAGE_VERSION));
+   }
+   int counts[] = { header.codeLength, header.constantCount, header.stringCount,
+                    header.stringBytes, header.slotCount, header.slotBytes };
+   for (int i = 0; i < 6; i++) {
+      if (counts[i] < 0 || (size_t) counts[i] > size) {
+         error("Corrupt program image header");
+      }
+   }
+   if (header.maxStack < 0 || header.maxStack > header.codeLength) {
+      error("Corrupt program image header");
+   }
+   ImageLayout layout = layoutImage(header);
+   if (layout.end != size) error("Program image is truncated or corrupt");
+   if (checksum(base + layout.constants, size - layout.constants)
+       != header.checksum) {
+      error("Program image checksum mismatch");
+   }
+   view.code = (const int *) (base + layout.code);
+   view.codeLength = header.codeLength;
+   view.constants = (const double *) (base + layout.constants);
+   view.constantCount = header.constantCount;
+   view.stringOffsets = (const int *) (base + layout.stringOffsets);
+   view.stringData = base + layout.stringData;
+   view.stringCount = header.stringCount;
+   view.maxStack = header.maxStack;
+   const int *slotOffsets = (const int *) (base + layout.slotOffsets);
+   checkOffsets(view.stringOffsets, view.stringCount, header.stringBytes);
+   checkOffsets(slotOffsets, header.slotCount, header.slotBytes);
+   const int *code = view.code;
+   std::vector<int> depthAt(view.codeLength, -1);
+   Vector<int> jumps;
+   int depth = 0;
+   int last = -1;
+   for (int pc = 0; pc < view.codeLength; pc += getInstructionLength(code[pc])) {
+      int op = code[pc];
+      if (op < OP_CONST || op > OP_HALT
+          || pc + getInstructionLength(op) > view.codeLength) {
+         error("Illegal instruction in program image");
+      }
+      depthAt[pc] = depth;
+      int nSlots = getSlotOperandCount(op);
+      for (int i = 1; i <= nSlots; i++) {
+         if (code[pc + i] < 0 || code[pc + i] >= header.slotCount) {
+            error("Illegal operand in program image");
+         }
+      }
+      int jump = getJumpOperand(op);
+      if (nSlots > 0 && jump == 0 && nSlots + 1 < getInstructionLength(op)) {
+         int arrayOp = code[pc + nSlots + 1];
+         if (arrayOp < ARRAY_ADD || arrayOp > ARRAY_DIV) {
+            error("Illegal operand in program image");
+         }
+      }
+      int limit = -1;
+      switch (op) {
+      case OP_CONST:
+         limit = view.constantCount;
+         break;
+      case OP_PRINT_STR:
+         limit = view.stringCount;
+         break;
+      }
+      if (limit >= 0 && (code[pc + 1] < 0 || code[pc + 1] >= limit)) {
+         error("Illegal operand in program image");
+      }
+      if (jump > 0) {
+         if (code[pc + jump] < 0 || code[pc + jump] >= view.codeLength) {
+            error("Illegal operand in program image");
+         }
+         jumps.add(pc);
+      }
+      if (depth < getStackInputs(op)) error("Stack underflow in program image");
+      depth += getStackEffect(op);
+      if (depth > view.maxStack) error("Stack overflow in program image");
+      last = pc;
+   }
+   if (last < 0 || code[last] != OP_HALT) {
+      error("Program image does not end with HALT");
+   }
+   foreach (int pc in jumps) {
+      int target = code[pc + getJumpOperand(code[pc])];
+      if (depthAt[target] != depthAt[pc] + getStackEffect(code[pc])) {
+         error("Illegal jump in program image");
+      }
+   }
+   bindSlots(slotOffsets, base + layout.slotData, header.slotCount);
+}
+
+/*
+ * Implementation notes: bindSlots
+ * -------------------------------
+ * Registers the variable names of the image in slot order.  In a
+ * fresh interpreter each name gets the slot it had when the image was
+ * written and the mapped code runs as it is.  If the slot table
+ * already numbers some name differently, the code is copied once and
+ * its slot operands are rewritten.
+ */
+
+void ProgramImage::bindSlots(const int *slotOffsets, const char *slotData,
+                             int slotCount) {
+   Vector<int> slots;
+   bool identity = true;
+   for (int i = 0; i < slotCount; i++) {
+      int slot = getVariableSlot(slotData + slotOffsets[i],
+                                 slotOffsets[i + 1] - slotOffsets[i]);
+      slots.add(slot);
+      if (slot != i) identity = false;
+   }
+   if (identity) return;
+   relocated.resize(view.codeLength);
+   for (int pc = 0; pc < view.codeLength; pc++) {
+      relocated[pc] = view.code[pc];
+   }
+   for (int pc = 0; pc < view.codeLength; pc += getInstructionLength(relocated[pc])) {
+      int nSlots = getSlotOperandCount(relocated[pc]);
+      for (int i = 1; i <= nSlots; i++) {
+         relocated[pc + i] = slots[relocated[pc + i]];
+      }
+   }
+   view.code = &relocated[0];
+}
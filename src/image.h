@@ -0,0 +1,99 @@
+/*
+ * File: image.h
+ * -------------
+ * This interface exports the precompiled program image: a binary file
+ * holding a compiled program (its bytecode, with every jump already
+ * resolved to an address, the constant pool, the PRINT strings and the
+ * names of its variable slots) that can be run without parsing any
+ * source text.
+ *
+ * An image is mapped into memory read-only and executed in place, so
+ * any number of interpreter processes running the same image share a
+ * single copy of its pages.  Every image carries a version number, a
+ * byte-order marker and a checksum, and is fully checked before it
+ * runs.
+ */
+
+#ifndef _image_h
+#define _image_h
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "bytecode.h"
+
+/*
+ * Function: writeImage
+ * Usage: writeImage(bc, filename);
+ * --------------------------------
+ * Writes the compiled program bc to the named file as an image.
+ * The image records the name of every variable slot, so that it can
+ * be run by a process whose slots are numbered differently.
+ */
+
+void writeImage(Bytecode & bc, std::string filename);
+
+/*
+ * Class: ProgramImage
+ * -------------------
+ * A program image mapped from disk.  The mapping stays in place for
+ * as long as the object exists.
+ */
+
+class ProgramImage {
+
+public:
+
+/*
+ * Constructor: ProgramImage
+ * Usage: ProgramImage image(filename);
+ * ------------------------------------
+ * Maps the named image and checks it.  Calls error if the file
+ * cannot be read, was written by another version or on a machine
+ * with a different byte order, fails its checksum or contains code
+ * the VM could not run safely.  The variable names of the image are
+ * registered with the slot table (see evalstate.h).
+ */
+
+   ProgramImage(std::string filename);
+
+/*
+ * Destructor: ~ProgramImage
+ * Usage: usually implicit
+ * -----------------------
+ * Unmaps the image.
+ */
+
+   ~ProgramImage();
+
+/*
+ * Method: getView
+ * Usage: runBytecode(image.getView(), state);
+ * -------------------------------------------
+ * Returns a view of the program, valid as long as the image exists.
+ */
+
+   const CodeView & getView() const;
+
+private:
+
+   const char *base;
+   size_t size;
+   void *mapping;
+   std::vector<double> buffer;
+   std::vector<int> relocated;
+   CodeView view;
+
+   void mapFile(std::string filename);
+   void unmapFile();
+   void checkImage();
+   void bindSlots(const int *slotOffsets, const char *slotData, int slotCount);
+
+/* Prevent copying */
+
+   ProgramImage(const ProgramImage &);
+   ProgramImage & operator=(const ProgramImage &);
+
+};
+
+#endif
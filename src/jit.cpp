@@ -0,0 +1,558 @@
+/*
+ * File: jit.cpp
+ * -------------
+ * Implements the jit.h interface.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include "jit.h"
+#include "output.h"
+using namespace std;
+
+#if defined(__x86_64__) && defined(__linux__)
+#define JIT_X86_64
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+/*
+ * Constants
+ * ---------
+ * HOT_LOOP_THRESHOLD -- Number of times a backward jump must be taken
+ *                       before its loop is compiled
+ * MAX_REGISTER_DEPTH -- Deepest value stack the code generator keeps
+ *                       in xmm0..xmm13; xmm14 and xmm15 are unused
+ * SPILL_AREA         -- Bytes of native stack used to save the live
+ *                       registers around helper calls
+ */
+
+static const int HOT_LOOP_THRESHOLD = 100;
+static const int MAX_REGISTER_DEPTH = 14;
+static const int SPILL_AREA = 8 * MAX_REGISTER_DEPTH + 8;
+
+/*
+ * Implementation: Jit
+ * -------------------
+ * The per-address tables are indexed by the bytecode address of the
+ * loop header, so finding the native code for a loop costs one index.
+ */
+
+Jit::Jit(const CodeView & view, EvalState & state, double *stack)
+      : view(view), state(state) {
+   ctx.constants = view.constants;
+   ctx.stack = stack;
+   ctx.view = &view;
+   ctx.depth = 0;
+   ctx.output = &state.getOutput();
+   hits.resize(view.codeLength, 0);
+   loops.resize(view.codeLength, NULL);
+   failed.resize(view.codeLength, false);
+}
+
+Jit::~Jit() {
+#ifdef JIT_X86_64
+   for (size_t i = 0; i < pages.size(); i++) {
+      munmap(pages[i], pageSizes[i]);
+   }
+#endif
+}
+
+bool Jit::isSupported() {
+#ifdef JIT_X86_64
+   return true;
+#else
+   return false;
+#endif
+}
+
+int Jit::runLoop(int header, int end, int & depth) {
+   NativeLoop loop = loops[header];
+   if (loop == NULL) {
+      if (failed[header] || ++hits[header] < HOT_LOOP_THRESHOLD) return -1;
+      loop = compileLoop(header, end);
+      if (loop == NULL) {
+         failed[header] = true;
+         return -1;
+      }
+      loops[header] = loop;
+   }
+   ctx.depth = 0;
+   int addr = loop(state.getValueArray(), state.getDefinedBitmap(), &ctx);
+   depth = ctx.depth;
+   return addr;
+}
+
+#ifndef JIT_X86_64
+
+Jit::NativeLoop Jit::compileLoop(int, int) {
+   return NULL;
+}
+
+#else
+
+/*
+ * Implementation notes: native helpers
+ * ------------------------------------
+ * PRINT is too involved to generate inline, so native code calls these
+ * functions instead.  They must not throw: the generated frames carry
+ * no unwind information.
+ */
+
+static void printString(JitContext *ctx, int index) {
+   const int *offsets = ctx->view->stringOffsets;
+   ctx->output->write(ctx->view->stringData + offsets[index],
+                      offsets[index + 1] - offsets[index]);
+}
+
+static void printNumber(JitContext *ctx, double value) {
+   ctx->output->writeNumber(value);
+}
+
+static void printEnd(JitContext *ctx) {
+   ctx->output->endLine();
+}
+
+/*
+ * Class: Assembler
+ * ----------------
+ * A minimal x86-64 encoder covering the handful of instruction forms
+ * the code generator needs.  Register numbers follow the hardware
+ * encoding (rax = 0, rsp = 4, rbx = 3, r13 = 13, ...), and every memory
+ * operand is [base + disp32].
+ */
+
+enum { RAX = 0, RSP = 4, RBX = 3, R13 = 13, R14 = 14, R15 = 15 };
+
+class Assembler {
+
+public:
+
+   vector<unsigned char> bytes;
+
+   int size() {
+      return bytes.size();
+   }
+
+   void byte(int b) {
+      bytes.push_back((unsigned char) b);
+   }
+
+   void dword(int value) {
+      for (int i = 0; i < 4; i++) {
+         byte((value >> (8 * i)) & 0xFF);
+      }
+   }
+
+   void qword(const void *ptr) {
+      unsigned long long value = (unsigned long long) (size_t) ptr;
+      for (int i = 0; i < 8; i++) {
+         byte((int) ((value >> (8 * i)) & 0xFF));
+      }
+   }
+
+   void patch(int pos, int target) {
+      int rel = target - (pos + 4);
+      for (int i = 0; i < 4; i++) {
+         bytes[pos + i] = (unsigned char) ((rel >> (8 * i)) & 0xFF);
+      }
+   }
+
+/*
+ * SSE2 scalar-double instructions: prefix 0F opcode with either a
+ * register or a [base + disp32] operand.
+ */
+
+   void sseReg(int prefix, int opcode, int reg, int rm) {
+      byte(prefix);
+      rex(reg, rm);
+      byte(0x0F);
+      byte(opcode);
+      byte(0xC0 | ((reg & 7) << 3) | (rm & 7));
+   }
+
+   void sseMem(int prefix, int opcode, int reg, int base, int disp) {
+      byte(prefix);
+      rex(reg, base);
+      byte(0x0F);
+      byte(opcode);
+      byte(0x80 | ((reg & 7) << 3) | (base & 7));
+      if ((base & 7) == RSP) byte(0x24);
+      dword(disp);
+   }
+
+   void load(int xmm, int base, int disp) {
+      sseMem(0xF2, 0x10, xmm, base, disp);
+   }
+
+   void store(int xmm, int base, int disp) {
+      sseMem(0xF2, 0x11, xmm, base, disp);
+   }
+
+   void move(int dst, int src) {
+      if (dst != src) sseReg(0xF2, 0x10, dst, src);
+   }
+
+   void compare(int lhs, int rhs) {
+      sseReg(0x66, 0x2E, lhs, rhs);
+   }
+
+/*
+ * Jumps with 32-bit displacements.  Each returns the position of the
+ * displacement so that the caller can patch it later.
+ */
+
+   int jump() {
+      byte(0xE9);
+      dword(0);
+      return size() - 4;
+   }
+
+   int jumpIf(int cc) {
+      byte(0x0F);
+      byte(0x80 | cc);
+      dword(0);
+      return size() - 4;
+   }
+
+   void call(const void *fn) {
+      byte(0x48); byte(0xB8); qword(fn);         /* mov rax, fn */
+      byte(0xFF); byte(0xD0);                    /* call rax    */
+   }
+
+private:
+
+   void rex(int reg, int rm) {
+      int bits = ((reg >> 3) << 2) | (rm >> 3);
+      if (bits != 0) byte(0x40 | bits);
+   }
+
+};
+
+/* Condition codes for jumpIf */
+
+enum { CC_AE = 0x3, CC_E = 0x4, CC_A = 0x7, CC_P = 0xA };
+
+/*
+ * Types: Exit, Label
+ * ------------------
+ * Jumps whose displacement is patched once the code is laid out: an
+ * Exit leaves the loop for the VM at addr with depth live values, and
+ * a Label targets the native code of the bytecode address addr.
+ */
+
+struct Exit {
+   int pos;
+   int addr;
+   int depth;
+};
+
+struct Label {
+   int pos;
+   int addr;
+};
+
+/*
+ * Function: addBranch
+ * Usage: addBranch(pos, target, header, end, depthAt, labels, exits);
+ * -------------------------------------------------------------------
+ * Records the jump whose displacement is at pos as a label if target
+ * starts an instruction of the loop at an empty stack, or as an exit
+ * to target otherwise.
+ */
+
+static void addBranch(int pos, int target, int header, int end,
+                      const vector<int> & depthAt, vector<Label> & labels,
+                      vector<Exit> & exits) {
+   if (target >= header && target < end && depthAt[target - header] == 0) {
+      Label label = { pos, target };
+      labels.push_back(label);
+   } else {
+      Exit exit = { pos, target, 0 };
+      exits.push_back(exit);
+   }
+}
+
+/*
+ * Function: emitDefinedTest
+ * Usage: emitDefinedTest(a, slot, addr, d, defined, exits);
+ * ---------------------------------------------------------
+ * Emits a test of the defined bit of slot that leaves through an exit
+ * to addr, with d live registers, if the slot is undefined, unless
+ * the slot is listed in defined.  The slot is then added to defined.
+ */
+
+static void emitDefinedTest(Assembler & a, int slot, int addr, int d,
+                            vector<int> & defined, vector<Exit> & exits) {
+   if (find(defined.begin(), defined.end(), slot) != defined.end()) return;
+   a.byte(0x41); a.byte(0xF7); a.byte(0x87);     /* test [r15+..], bit */
+   a.dword(4 * (slot >> 5));
+   a.dword(1 << (slot & 31));
+   Exit exit = { a.jumpIf(CC_E), addr, d };
+   exits.push_back(exit);
+   defined.push_back(slot);
+}
+
+/*
+ * Function: emitLoopTest
+ * Usage: emitLoopTest(a, d, limit, step, running);
+ * ------------------------------------------------
+ * Emits the test of isLoopRunning for the FOR counter in xmm(d) and
+ * the limit and step in the given slots, using xmm(d + 1) and
+ * xmm(d + 2) as scratch.  The two jumps taken when the loop runs on
+ * are left unpatched, with their positions in running.  A NaN on
+ * either side of a comparison sets the carry flag, so it ends the
+ * loop, and a NaN step takes the upward test, as in isLoopRunning.
+ */
+
+static void emitLoopTest(Assembler & a, int d, int limit, int step,
+                         int running[2]) {
+   a.load(d + 1, RBX, 8 * limit);
+   a.sseReg(0x66, 0x57, d + 2, d + 2);             /* xorpd: 0.0     */
+   a.sseMem(0x66, 0x2E, d + 2, RBX, 8 * step);     /* ucomisd step   */
+   int downward = a.jumpIf(CC_A);
+   a.compare(d + 1, d);
+   running[0] = a.jumpIf(CC_AE);
+   int done = a.jump();
+   a.patch(downward, a.size());
+   a.compare(d, d + 1);
+   running[1] = a.jumpIf(CC_AE);
+   a.patch(done, a.size());
+}
+
+/*
+ * Implementation notes: compileLoop
+ * ---------------------------------
+ * The loop occupies the addresses [header, end).  The VM value stack
+ * is mapped onto registers: at stack depth d the top of the stack is
+ * xmm(d - 1).  Since the depth before every instruction is known when
+ * compiling, each instruction turns into a fixed register operation.
+ * Throughout the loop rbx holds the value array, r15 the defined
+ * bitmap, r13 the JitContext and r14 the constant pool.
+ *
+ * Each read tests the defined bit of its variable where it happens: if
+ * the variable is undefined, the native code leaves through an exit
+ * stub at the reading instruction with the live registers spilled, and
+ * the VM reports the error.  A variable read only on a path that never
+ * runs therefore costs nothing.  Within a stretch of code that no jump
+ * enters, a variable already tested or stored is not tested again,
+ * since no instruction in a loop ever clears a slot.
+ *
+ * OP_FOR_NEXT steps the counter in its slot and compares it with the
+ * limit in registers, so the control of a FOR loop is a handful of
+ * instructions per pass and never calls back into the VM.  It tests
+ * its counter, limit and step like any other read, so a NEXT reached
+ * without its FOR leaves for the VM, which reports the error.
+ *
+ * Jumps within the loop become native jumps.  Jumps out of the loop,
+ * falling off its end and any instruction without a native translation
+ * (INPUT, HALT and anything added later) leave through an exit stub
+ * that spills the live registers to the VM stack and returns the
+ * address at which the VM resumes.  A loop that works on arrays would
+ * leave on every iteration, so it is not compiled at all and stays in
+ * the VM, which calls the vector kernels for the whole-array work.
+ */
+
+Jit::NativeLoop Jit::compileLoop(int header, int end) {
+   const int *code = view.code;
+   int length = end - header;
+   vector<int> depthAt(length + 1, -1);
+   vector<bool> isTarget(length + 1, false);
+   int depth = 0;
+   int addr = header;
+   while (addr < end) {
+      depthAt[addr - header] = depth;
+      int op = code[addr];
+      if (op >= OP_DIM1 && op <= OP_MAT_INV) return NULL;
+      if (getJumpOperand(op) > 0) {
+         int target = code[addr + getJumpOperand(op)];
+         if (target >= header && target < end) isTarget[target - header] = true;
+      }
+      if ((op == OP_FOR_ENTER || op == OP_FOR_NEXT)
+          && depth + 3 > MAX_REGISTER_DEPTH) {
+         return NULL;
+      }
+      depth += getStackEffect(op);
+      if (depth > MAX_REGISTER_DEPTH) return NULL;
+      addr += getInstructionLength(op);
+   }
+   if (addr != end) return NULL;
+
+   vector<Exit> exits;
+   vector<Label> labels;
+   vector<int> nativeAt(length, -1);
+   Assembler a;
+
+   /* Prologue */
+   a.byte(0x53);                                 /* push rbx          */
+   a.byte(0x41); a.byte(0x55);                   /* push r13          */
+   a.byte(0x41); a.byte(0x56);                   /* push r14          */
+   a.byte(0x41); a.byte(0x57);                   /* push r15          */
+   a.byte(0x48); a.byte(0x81); a.byte(0xEC);     /* sub rsp, SPILL    */
+   a.dword(SPILL_AREA);
+   a.byte(0x48); a.byte(0x89); a.byte(0xFB);     /* mov rbx, rdi      */
+   a.byte(0x49); a.byte(0x89); a.byte(0xF7);     /* mov r15, rsi      */
+   a.byte(0x49); a.byte(0x89); a.byte(0xD5);     /* mov r13, rdx      */
+   a.byte(0x4D); a.byte(0x8B); a.byte(0x75);     /* mov r14, [r13+..] */
+   a.byte(offsetof(JitContext, constants));
+
+   /* Body */
+   vector<int> defined;
+   for (addr = header; addr < end; addr += getInstructionLength(code[addr])) {
+      int d = depthAt[addr - header];
+      int op = code[addr];
+      int arg = (getInstructionLength(op) > 1) ? code[addr + 1] : 0;
+      nativeAt[addr - header] = a.size();
+      if (addr == header || isTarget[addr - header]) defined.clear();
+      int branch = -1;
+      switch (op) {
+      case OP_CONST:
+         a.load(d, R14, 8 * arg);
+         break;
+      case OP_LOAD:
+         emitDefinedTest(a, arg, addr, d, defined, exits);
+         a.load(d, RBX, 8 * arg);
+         break;
+      case OP_STORE:
+         a.store(d - 1, RBX, 8 * arg);
+         a.byte(0x41); a.byte(0x81); a.byte(0x8F);  /* or [r15+..], bit */
+         a.dword(4 * (arg >> 5));
+         a.dword(1 << (arg & 31));
+         defined.push_back(arg);
+         break;
+      case OP_DUP:
+         a.move(d, d - 1);
+         break;
+      case OP_ADD:
+         a.sseReg(0xF2, 0x58, d - 2, d - 1);
+         break;
+      case OP_SUB:
+         a.sseReg(0xF2, 0x5C, d - 2, d - 1);
+         break;
+      case OP_MUL:
+         a.sseReg(0xF2, 0x59, d - 2, d - 1);
+         break;
+      case OP_DIV:
+         a.sseReg(0xF2, 0x5E, d - 2, d - 1);
+         break;
+      case OP_JUMP:
+         branch = a.jump();
+         break;
+      case OP_JUMP_EQ:
+         a.compare(d - 2, d - 1);
+         a.byte(0x70 | CC_P); a.byte(6);            /* unordered: skip */
+         branch = a.jumpIf(CC_E);
+         break;
+      case OP_JUMP_LT:
+         a.compare(d - 1, d - 2);
+         branch = a.jumpIf(CC_A);
+         break;
+      case OP_JUMP_GT:
+         a.compare(d - 2, d - 1);
+         branch = a.jumpIf(CC_A);
+         break;
+      case OP_FOR_ENTER: {
+         int running[2];
+         a.load(d, RBX, 8 * arg);
+         emitLoopTest(a, d, code[addr + 2], code[addr + 3], running);
+         branch = a.jump();
+         a.patch(running[0], a.size());
+         a.patch(running[1], a.size());
+         break;
+      }
+      case OP_FOR_NEXT: {
+         int running[2];
+         for (int i = 1; i <= 3; i++) {
+            emitDefinedTest(a, code[addr + i], addr, d, defined, exits);
+         }
+         a.load(d, RBX, 8 * arg);
+         a.sseMem(0xF2, 0x58, d, RBX, 8 * code[addr + 3]);  /* addsd */
+         a.store(d, RBX, 8 * arg);
+         emitLoopTest(a, d, code[addr + 2], code[addr + 3], running);
+         int target = code[addr + 4];
+         addBranch(running[0], target, header, end, depthAt, labels, exits);
+         addBranch(running[1], target, header, end, depthAt, labels, exits);
+         break;
+      }
+      case OP_PRINT_STR:
+      case OP_PRINT_NUM:
+      case OP_PRINT_END: {
+         int live = (op == OP_PRINT_NUM) ? d - 1 : d;
+         for (int i = 0; i < live; i++) a.store(i, RSP, 8 * i);
+         a.byte(0x4C); a.byte(0x89); a.byte(0xEF);     /* mov rdi, r13 */
+         if (op == OP_PRINT_STR) {
+            a.byte(0xBE); a.dword(arg);                /* mov esi, arg */
+            a.call((const void *) printString);
+         } else if (op == OP_PRINT_NUM) {
+            a.move(0, d - 1);
+            a.call((const void *) printNumber);
+         } else {
+            a.call((const void *) printEnd);
+         }
+         for (int i = 0; i < live; i++) a.load(i, RSP, 8 * i);
+         break;
+      }
+      default: {
+         Exit exit = { a.jump(), addr, d };
+         exits.push_back(exit);
+         break;
+      }
+      }
+      if (branch >= 0) {
+         int target = code[addr + getJumpOperand(op)];
+         addBranch(branch, target, header, end, depthAt, labels, exits);
+      }
+   }
+   Exit fallThrough = { a.jump(), end, 0 };
+   exits.push_back(fallThrough);
+
+   /* Exit stubs, each followed by a jump to the shared epilogue */
+   vector<int> toEpilogue;
+   for (size_t i = 0; i < exits.size(); i++) {
+      a.patch(exits[i].pos, a.size());
+      if (exits[i].depth > 0) {
+         a.byte(0x49); a.byte(0x8B); a.byte(0x45);   /* mov rax, [r13+..] */
+         a.byte(offsetof(JitContext, stack));
+         for (int j = 0; j < exits[i].depth; j++) a.store(j, RAX, 8 * j);
+      }
+      a.byte(0x41); a.byte(0xC7); a.byte(0x45);      /* mov [r13+..], d   */
+      a.byte(offsetof(JitContext, depth));
+      a.dword(exits[i].depth);
+      a.byte(0xB8); a.dword(exits[i].addr);          /* mov eax, addr     */
+      toEpilogue.push_back(a.jump());
+   }
+   for (size_t i = 0; i < labels.size(); i++) {
+      a.patch(labels[i].pos, nativeAt[labels[i].addr - header]);
+   }
+
+   /* Epilogue */
+   for (size_t i = 0; i < toEpilogue.size(); i++) {
+      a.patch(toEpilogue[i], a.size());
+   }
+   a.byte(0x48); a.byte(0x81); a.byte(0xC4);         /* add rsp, SPILL */
+   a.dword(SPILL_AREA);
+   a.byte(0x41); a.byte(0x5F);                       /* pop r15        */
+   a.byte(0x41); a.byte(0x5E);                       /* pop r14        */
+   a.byte(0x41); a.byte(0x5D);                       /* pop r13        */
+   a.byte(0x5B);                                     /* pop rbx        */
+   a.byte(0xC3);                                     /* ret            */
+
+   /* Copy into fresh pages, then make them executable but not writable */
+   size_t pageSize = sysconf(_SC_PAGESIZE);
+   size_t size = (a.bytes.size() + pageSize - 1) / pageSize * pageSize;
+   void *page = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+   if (page == MAP_FAILED) return NULL;
+   memcpy(page, &a.bytes[0], a.bytes.size());
+   if (mprotect(page, size, PROT_READ | PROT_EXEC) != 0) {
+      munmap(page, size);
+      return NULL;
+   }
+   pages.push_back(page);
+   pageSizes.push_back(size);
+   return reinterpret_cast<NativeLoop>(page);
+}
+
+#endif
@@ -0,0 +1,128 @@
+/*
+ * File: jit.h
+ * -----------
+ * This interface exports the Jit class, which translates hot loops of
+ * a compiled program into native x86-64 machine code.  The stack VM in
+ * vm.cpp counts how often each backward jump is taken and hands the
+ * loop to the JIT once it becomes hot; the native code then runs the
+ * loop until control leaves it and returns to the VM at the bytecode
+ * address where execution should continue.
+ *
+ * Native code is generated only on x86-64 Linux.  Everywhere else
+ * isSupported returns false and the VM simply never enters the JIT.
+ */
+
+#ifndef _jit_h
+#define _jit_h
+
+#include <vector>
+#include "bytecode.h"
+#include "evalstate.h"
+
+/*
+ * Type: JitContext
+ * ----------------
+ * The block of state shared between the VM and native code: the
+ * constant pool, the VM value stack into which native code spills
+ * live values when it exits in the middle of an expression, the depth
+ * of that stack on exit, the program, for its PRINT strings, and the
+ * buffer PRINT writes to.  Native code reads the fields at fixed
+ * offsets, so their order must not change.
+ */
+
+struct JitContext {
+   const double *constants;
+   double *stack;
+   const CodeView *view;
+   int depth;
+   OutputBuffer *output;
+};
+
+/*
+ * Class: Jit
+ * ----------
+ * Holds the native code generated for one run of one compiled program.
+ * A Jit is created by runBytecode and destroyed, together with all of
+ * its code pages, when the run ends.
+ */
+
+class Jit {
+
+public:
+
+/*
+ * Constructor: Jit
+ * Usage: Jit jit(view, state, stack);
+ * -----------------------------------
+ * Prepares to compile loops of the program seen through view that
+ * read and write the variables of state and use stack as the VM
+ * value stack.
+ */
+
+   Jit(const CodeView & view, EvalState & state, double *stack);
+
+/*
+ * Destructor: ~Jit
+ * Usage: usually implicit
+ * -----------------------
+ * Releases every page of native code.
+ */
+
+   ~Jit();
+
+/*
+ * Method: isSupported
+ * Usage: if (Jit::isSupported()) . . .
+ * ------------------------------------
+ * Returns true if native code can be generated on this platform.
+ */
+
+   static bool isSupported();
+
+/*
+ * Method: runLoop
+ * Usage: int addr = jit.runLoop(header, end, depth);
+ * --------------------------------------------------
+ * Called by the VM each time it takes a backward jump to header from
+ * the instruction ending at end.  Once the loop has been seen often
+ * enough it is compiled, and from then on runLoop executes it natively
+ * and returns the address at which the VM must continue, with depth
+ * set to the number of values left on the VM stack.  Returns -1 while
+ * the loop is still cold or could not be compiled, in which case the
+ * VM carries on at header itself.
+ */
+
+   int runLoop(int header, int end, int & depth);
+
+private:
+
+/*
+ * Type: NativeLoop
+ * ----------------
+ * Entry point of a compiled loop.  The function receives the slot
+ * arrays of the EvalState and the shared context and returns the
+ * bytecode address at which the VM continues.
+ */
+
+   typedef int (*NativeLoop)(double *values, unsigned int *defined,
+                             JitContext *ctx);
+
+   const CodeView & view;
+   EvalState & state;
+   JitContext ctx;
+   std::vector<int> hits;
+   std::vector<NativeLoop> loops;
+   std::vector<bool> failed;
+   std::vector<void *> pages;
+   std::vector<size_t> pageSizes;
+
+   NativeLoop compileLoop(int header, int end);
+
+/* Prevent copying */
+
+   Jit(const Jit &);
+   Jit & operator=(const Jit &);
+
+};
+
+#endif
@@ -0,0 +1,289 @@
+/*
+ * File: lexer.cpp
+ * ---------------
+ * Implements the lexer.h interface.
+ */
+
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include "lexer.h"
+using namespace std;
+
+/*
+ * Constants
+ * ---------
+ * NUMBER_BUFFER -- Size of the buffer in which a number is handed to
+ *                  strtod; longer numbers go through a string
+ */
+
+static const int NUMBER_BUFFER = 64;
+
+/* Function prototypes */
+
+static Keyword findKeyword(const char *text, int length);
+static Operator findOperator(char ch);
+
+/* Token methods */
+
+bool Token::isInteger() const {
+   if (kind != NUMBER_TOKEN) return false;
+   for (int i = 0; i < length; i++) {
+      if (!isdigit((unsigned char) text[i])) return false;
+   }
+   return true;
+}
+
+string Token::getText() const {
+   return string(text, length);
+}
+
+/* Lexer methods */
+
+Lexer::Lexer() {
+   cp = end = NULL;
+   hasLookahead = false;
+}
+
+Lexer::Lexer(const string & line) {
+   setInput(line);
+}
+
+void Lexer::setInput(const string & line) {
+   setInput(line.data(), line.data() + line.size());
+}
+
+void Lexer::setInput(const char *start, const char *end) {
+   cp = start;
+   this->end = end;
+   hasLookahead = false;
+}
+
+Token Lexer::nextToken() {
+   if (hasLookahead) {
+      hasLookahead = false;
+      return lookahead;
+   }
+   Token token;
+   scanToken(token);
+   return token;
+}
+
+const Token & Lexer::peekToken() {
+   if (!hasLookahead) {
+      scanToken(lookahead);
+      hasLookahead = true;
+   }
+   return lookahead;
+}
+
+bool Lexer::hasMoreTokens() {
+   return peekToken().kind != END_TOKEN;
+}
+
+/*
+ * Implementation notes: scanToken
+ * -------------------------------
+ * The token rules are those of TokenScanner with whitespace ignored
+ * and numbers scanned: a token starting with a digit is a number, a
+ * letter starts a word of letters, digits and underscores, and any
+ * other character is a symbol by itself.
+ */
+
+void Lexer::scanToken(Token & token) {
+   while (cp < end && isspace((unsigned char) *cp)) cp++;
+   token.text = cp;
+   token.number = 0;
+   token.keyword = NO_KEYWORD;
+   token.op = INVALID_OP;
+   if (cp == end) {
+      token.kind = END_TOKEN;
+      token.length = 0;
+      return;
+   }
+   unsigned char ch = *cp;
+   if (isdigit(ch)) {
+      scanNumber(token);
+   } else if (isalpha(ch) || ch == '_') {
+      scanWord(token);
+   } else {
+      cp++;
+      token.kind = SYMBOL_TOKEN;
+      token.length = 1;
+      token.op = findOperator(ch);
+   }
+}
+
+/*
+ * Implementation notes: scanNumber
+ * --------------------------------
+ * A number is digits, an optional fraction and an optional exponent.
+ * An E that is not followed by digits, with or without a sign, is
+ * not part of the number.  The digits are passed to strtod from a
+ * buffer on the stack, so the conversion is exact without building a
+ * string, and strtod never sees characters beyond the token.
+ */
+
+void Lexer::scanNumber(Token & token) {
+   const char *start = cp;
+   while (cp < end && isdigit((unsigned char) *cp)) cp++;
+   if (cp < end && *cp == '.') {
+      cp++;
+      while (cp < end && isdigit((unsigned char) *cp)) cp++;
+   }
+   if (cp < end && (*cp == 'E' || *cp == 'e')) {
+      const char *exp = cp + 1;
+      if (exp < end && (*exp == '+' || *exp == '-')) exp++;
+      if (exp < end && isdigit((unsigned char) *exp)) {
+         cp = exp;
+         while (cp < end && isdigit((unsigned char) *cp)) cp++;
+      }
+   }
+   token.kind = NUMBER_TOKEN;
+   token.length = cp - start;
+   if (token.length < NUMBER_BUFFER) {
+      char buffer[NUMBER_BUFFER];
+      memcpy(buffer, start, token.length);
+      buffer[token.length] = '\0';
+      token.number = strtod(buffer, NULL);
+   } else {
+      token.number = strtod(token.getText().c_str(), NULL);
+   }
+}
+
+void Lexer::scanWord(Token & token) {
+   const char *start = cp;
+   while (cp < end && (isalnum((unsigned char) *cp) || *cp == '_')) cp++;
+   token.kind = WORD_TOKEN;
+   token.length = cp - start;
+   token.keyword = findKeyword(start, token.length);
+}
+
+/*
+ * Implementation notes: findKeyword
+ * ---------------------------------
+ * The keywords are found through a perfect hash: hashWord gives each
+ * of them a different position in KEYWORD_TABLE, so a word is a
+ * keyword only if it matches the single entry at its own position.
+ * The hash adds the first letter, six times the second and eleven
+ * times the last to the length, taken modulo the size of the table;
+ * 6 and 11 are the smallest multipliers that leave no two keywords in
+ * the same place.  The second letter needs a multiplier of its own
+ * because JIT and DOT would otherwise always collide.
+ * Letters are folded to upper case by clearing bit 0x20, both in the
+ * hash and in the comparison.  No character that can appear in a
+ * word other than a letter folds to an upper-case letter, so the
+ * comparison matches exactly the keyword in any case.  A new keyword
+ * must be placed at its position in the table, and the multipliers
+ * changed if that position is already taken.
+ */
+
+struct KeywordEntry {
+   const char *name;
+   Keyword keyword;
+};
+
+static const int KEYWORD_TABLE_SIZE = 128;
+static const int MAX_KEYWORD_LENGTH = 7;
+
+static const KeywordEntry KEYWORD_TABLE[KEYWORD_TABLE_SIZE] = {
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /*   0 */
+   { NULL, NO_KEYWORD },      { "WHILE", WHILE_KW },    /*   2 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /*   4 */
+   { "OLD", OLD_KW },         { NULL, NO_KEYWORD },     /*   6 */
+   { "END", END_KW },         { "LET", LET_KW },        /*   8 */
+   { "GOTO", GOTO_KW },       { NULL, NO_KEYWORD },     /*  10 */
+   { "NEXT", NEXT_KW },       { NULL, NO_KEYWORD },     /*  12 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /*  14 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /*  16 */
+   { "FOLDED", FOLDED_KW },   { "IMAGE", IMAGE_KW },    /*  18 */
+   { NULL, NO_KEYWORD },      { "TO", TO_KW },          /*  20 */
+   { "CLEAR", CLEAR_KW },     { NULL, NO_KEYWORD },     /*  22 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /*  24 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /*  26 */
+   { NULL, NO_KEYWORD },      { "TRN", TRN_KW },        /*  28 */
+   { NULL, NO_KEYWORD },      { "JIT", JIT_KW },        /*  30 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /*  32 */
+   { "LIST", LIST_KW },       { "SUM", SUM_KW },        /*  34 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /*  36 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /*  38 */
+   { NULL, NO_KEYWORD },      { "FOR", FOR_KW },        /*  40 */
+   { NULL, NO_KEYWORD },      { "FLUSH", FLUSH_KW },    /*  42 */
+   { NULL, NO_KEYWORD },      { "RUN", RUN_KW },        /*  44 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /*  46 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /*  48 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /*  50 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /*  52 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /*  54 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /*  56 */
+   { "PROFILE", PROFILE_KW }, { "TREE", TREE_KW },      /*  58 */
+   { NULL, NO_KEYWORD },      { "DOT", DOT_KW },        /*  60 */
+   { "INPUT", INPUT_KW },     { "STEP", STEP_KW },      /*  62 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /*  64 */
+   { "REM", REM_KW },         { NULL, NO_KEYWORD },     /*  66 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /*  68 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /*  70 */
+   { "BLOCK", BLOCK_KW },     { NULL, NO_KEYWORD },     /*  72 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /*  74 */
+   { "DIM", DIM_KW },         { NULL, NO_KEYWORD },     /*  76 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /*  78 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /*  80 */
+   { "INV", INV_KW },         { NULL, NO_KEYWORD },     /*  82 */
+   { "SAVE", SAVE_KW },       { NULL, NO_KEYWORD },     /*  84 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /*  86 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /*  88 */
+   { "HELP", HELP_KW },       { NULL, NO_KEYWORD },     /*  90 */
+   { NULL, NO_KEYWORD },      { "PRINT", PRINT_KW },    /*  92 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /*  94 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /*  96 */
+   { "THEN", THEN_KW },       { NULL, NO_KEYWORD },     /*  98 */
+   { NULL, NO_KEYWORD },      { "WEND", WEND_KW },      /* 100 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /* 102 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /* 104 */
+   { "CSV", CSV_KW },         { NULL, NO_KEYWORD },     /* 106 */
+   { "FAST", FAST_KW },       { NULL, NO_KEYWORD },     /* 108 */
+   { NULL, NO_KEYWORD },      { "QUIT", QUIT_KW },      /* 110 */
+   { NULL, NO_KEYWORD },      { "IF", IF_KW },          /* 112 */
+   { "MAT", MAT_KW },         { NULL, NO_KEYWORD },     /* 114 */
+   { "DEBUG", DEBUG_KW },     { NULL, NO_KEYWORD },     /* 116 */
+   { NULL, NO_KEYWORD },      { "NEVER", NEVER_KW },    /* 118 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /* 120 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD },     /* 122 */
+   { NULL, NO_KEYWORD },      { "LINE", LINE_KW },      /* 124 */
+   { NULL, NO_KEYWORD },      { NULL, NO_KEYWORD }      /* 126 */
+};
+
+static inline int foldCase(char ch) {
+   return ch & ~0x20;
+}
+
+static inline int hashWord(const char *text, int length) {
+   int hash = foldCase(text[0]) + 6 * foldCase(text[1])
+            + 11 * foldCase(text[length - 1]) + length;
+   return hash & (KEYWORD_TABLE_SIZE - 1);
+}
+
+static Keyword findKeyword(const char *text, int length) {
+   if (length < 2 || length > MAX_KEYWORD_LENGTH) return NO_KEYWORD;
+   const KeywordEntry & entry = KEYWORD_TABLE[hashWord(text, length)];
+   if (entry.name == NULL) return NO_KEYWORD;
+   for (int i = 0; i < length; i++) {
+      if (foldCase(text[i]) != entry.name[i]) return NO_KEYWORD;
+   }
+   if (entry.name[length] != '\0') return NO_KEYWORD;
+   return entry.keyword;
+}
+
+static Operator findOperator(char ch) {
+   switch (ch) {
+   case '+': return PLUS_OP;
+   case '-': return MINUS_OP;
+   case '*': return TIMES_OP;
+   case '/': return DIVIDE_OP;
+   case '=': return ASSIGN_OP;
+   case '<': return LESS_OP;
+   case '>': return GREATER_OP;
+   default: return INVALID_OP;
+   }
+}
@@ -0,0 +1,159 @@
+/*
+ * File: lexer.h
+ * -------------
+ * This interface exports the Lexer class, the scanner used for
+ * program text and commands.  Unlike TokenScanner, which returns
+ * every token as a new string and classifies it again on request,
+ * the lexer returns small Token records that point into the text
+ * being scanned.  Numbers arrive already converted, words already
+ * checked against the statement keywords and symbols already mapped
+ * to their operator, so the parser never allocates to look at a
+ * token.
+ */
+
+#ifndef _lexer_h
+#define _lexer_h
+
+#include <string>
+#include "exp.h"
+
+/*
+ * Type: TokenKind
+ * ---------------
+ * The kinds of token: the end of the input, a number, a word (an
+ * identifier or keyword) and any other single character.
+ */
+
+enum TokenKind {
+   END_TOKEN, NUMBER_TOKEN, WORD_TOKEN, SYMBOL_TOKEN
+};
+
+/*
+ * Type: Keyword
+ * -------------
+ * The keywords of the interpreter: the statement keywords, the
+ * array functions SUM and DOT, the TRN and INV of MAT, the TO and
+ * STEP of FOR, the commands and the words that may follow RUN, SAVE,
+ * FLUSH and PROFILE.  They are recognized in any mix of upper and
+ * lower case.  A word that is not a keyword has NO_KEYWORD.  Whether
+ * a keyword means anything depends on where it appears: a command
+ * name is an ordinary variable inside a statement, and so is SUM or
+ * DOT unless a parenthesis follows, TRN or INV outside of MAT, or TO
+ * or STEP outside of FOR.
+ */
+
+enum Keyword {
+   NO_KEYWORD,
+   REM_KW, LET_KW, PRINT_KW, INPUT_KW, GOTO_KW, IF_KW, THEN_KW, END_KW,
+   DIM_KW, SUM_KW, DOT_KW, MAT_KW, TRN_KW, INV_KW,
+   FOR_KW, TO_KW, STEP_KW, NEXT_KW, WHILE_KW, WEND_KW,
+   SAVE_KW, OLD_KW, RUN_KW, DEBUG_KW, FLUSH_KW, LIST_KW, CLEAR_KW,
+   HELP_KW, QUIT_KW,
+   PROFILE_KW,
+   IMAGE_KW, FAST_KW, TREE_KW, JIT_KW, LINE_KW, BLOCK_KW, NEVER_KW,
+   CSV_KW, FOLDED_KW
+};
+
+/*
+ * Type: Token
+ * -----------
+ * One token.  text and length delimit its characters in the scanned
+ * text, which must stay alive while the token is used.  number holds
+ * the value of a NUMBER_TOKEN, keyword the keyword of a WORD_TOKEN
+ * and op the operator of a SYMBOL_TOKEN, or INVALID_OP for a symbol
+ * that is not an operator.
+ */
+
+struct Token {
+   TokenKind kind;
+   const char *text;
+   int length;
+   double number;
+   Keyword keyword;
+   Operator op;
+
+/*
+ * Methods: is, isInteger, getText
+ * Usage: if (token.is(',')) ...
+ *        if (token.isInteger()) ...
+ *        string str = token.getText();
+ * ------------------------------------
+ * is tests for the symbol ch, isInteger tests for a number written
+ * with digits only and getText copies the characters of the token
+ * into a string, for messages and for the few places that keep them.
+ */
+
+   bool is(char ch) const {
+      return kind == SYMBOL_TOKEN && text[0] == ch;
+   }
+
+   bool isInteger() const;
+
+   std::string getText() const;
+
+};
+
+/*
+ * Class: Lexer
+ * ------------
+ * Splits a line of text into tokens, skipping whitespace.  The lexer
+ * does not copy the text, which must outlive it.
+ */
+
+class Lexer {
+
+public:
+
+/*
+ * Constructor: Lexer
+ * Usage: Lexer lexer;
+ *        Lexer lexer(line);
+ * -------------------------
+ * Creates a lexer, optionally reading from line.
+ */
+
+   Lexer();
+   Lexer(const std::string & line);
+
+/*
+ * Methods: setInput
+ * Usage: lexer.setInput(line);
+ *        lexer.setInput(start, end);
+ * ----------------------------------
+ * Starts reading from line, or from the characters between start
+ * and end, discarding any token already looked at.
+ */
+
+   void setInput(const std::string & line);
+   void setInput(const char *start, const char *end);
+
+/*
+ * Methods: nextToken, peekToken, hasMoreTokens
+ * Usage: Token token = lexer.nextToken();
+ *        const Token & token = lexer.peekToken();
+ *        if (lexer.hasMoreTokens()) ...
+ * -----------------------------------------------
+ * nextToken returns the next token and moves past it; at the end of
+ * the input it returns an END_TOKEN every time.  peekToken returns
+ * the same token without moving past it, and hasMoreTokens tells
+ * whether it is not the end.
+ */
+
+   Token nextToken();
+   const Token & peekToken();
+   bool hasMoreTokens();
+
+private:
+
+   const char *cp;
+   const char *end;
+   Token lookahead;
+   bool hasLookahead;
+
+   void scanToken(Token & token);
+   void scanNumber(Token & token);
+   void scanWord(Token & token);
+
+};
+
+#endif
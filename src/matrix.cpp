@@ -0,0 +1,441 @@
+/*
+ * File: matrix.cpp
+ * ----------------
+ * Implements the matrix.h interface.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include "matrix.h"
+#include "simd.h"
+using namespace std;
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#  define SIMD_X86_64
+#  define AVX_TARGET __attribute__((target("avx")))
+#  include <immintrin.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#  define MATRIX_THREADS
+#  include <pthread.h>
+#  include <unistd.h>
+#endif
+
+/*
+ * Implementation notes: blocking
+ * ------------------------------
+ * The product is computed in the manner of the usual fast matrix
+ * libraries.  The columns of b are taken NC at a time and its rows KC
+ * at a time; each such block of b is copied into panels of NR columns
+ * that are read in order, and stays in the second-level cache.  The
+ * matching block of a is taken MC rows at a time and copied into
+ * panels of MR rows, each of which stays in the first-level cache
+ * while it meets every panel of b.  The micro-kernel multiplies one
+ * panel of a by one panel of b, keeping the MR x NR partial sums in
+ * registers for all KC terms, and adds them to c only at the end.
+ * Panels at the edges are padded with zeros, and the sums computed
+ * from the padding are never stored.
+ *
+ * Every kernel computes each partial sum from zero over the terms of
+ * its block in order, rounding each product before adding it, and c
+ * starts out zero and receives the partial sums in the order of the
+ * blocks.  That is the whole arithmetic of an element, whatever the
+ * instruction set or the thread that computes it.
+ */
+
+static const int MR = 4;
+static const int NR = 8;
+static const int KC = 256;
+static const int MC = 96;
+static const int NC = 2048;
+
+/*
+ * Implementation notes: threads
+ * -----------------------------
+ * A product with at least MIN_THREAD_WORK multiply-adds per thread is
+ * split by rows of c into bands of whole panels, one per thread.  Each
+ * thread packs its own copies of the blocks of b, which costs far less
+ * than the multiplications it saves, and needs no locks: the threads
+ * write disjoint rows and are joined before multiplyMatrices returns.
+ */
+
+static const double MIN_THREAD_WORK = 1 << 21;
+
+static int countProcessors() {
+#ifdef MATRIX_THREADS
+   long n = sysconf(_SC_NPROCESSORS_ONLN);
+   if (n > 0) return (int) n;
+#endif
+   return 1;
+}
+
+static int threadCount = countProcessors();
+
+int getMatrixThreadCount() {
+   return threadCount;
+}
+
+void setMatrixThreadCount(int nThreads) {
+   threadCount = (nThreads < 1) ? 1 : nThreads;
+}
+
+/*
+ * Function: packA
+ * Usage: packA(dst, a, lda, mc, kc);
+ * ----------------------------------
+ * Copies the mc x kc block of a whose rows are lda apart into panels
+ * of MR rows, storing the MR elements of each column of a panel
+ * together.  Rows past mc are filled with zeros.
+ */
+
+static void packA(double *dst, const double *a, int lda, int mc, int kc) {
+   for (int i = 0; i < mc; i += MR) {
+      int mr = min(MR, mc - i);
+      for (int k = 0; k < kc; k++) {
+         for (int r = 0; r < MR; r++) {
+            *dst++ = (r < mr) ? a[(i + r) * lda + k] : 0;
+         }
+      }
+   }
+}
+
+/*
+ * Function: packB
+ * Usage: packB(dst, b, ldb, kc, nc);
+ * ----------------------------------
+ * Copies the kc x nc block of b whose rows are ldb apart into panels
+ * of NR columns, storing the NR elements of each row of a panel
+ * together.  Columns past nc are filled with zeros.
+ */
+
+static void packB(double *dst, const double *b, int ldb, int kc, int nc) {
+   for (int j = 0; j < nc; j += NR) {
+      int nr = min(NR, nc - j);
+      for (int k = 0; k < kc; k++) {
+         const double *row = b + k * ldb + j;
+         for (int r = 0; r < NR; r++) {
+            *dst++ = (r < nr) ? row[r] : 0;
+         }
+      }
+   }
+}
+
+/*
+ * Function: addTile
+ * Usage: addTile(c, ldc, tile, mr, nr);
+ * -------------------------------------
+ * Adds the first mr x nr partial sums of an MR x NR tile to c.
+ */
+
+static void addTile(double *c, int ldc, const double tile[MR][NR], int mr,
+                    int nr) {
+   for (int i = 0; i < mr; i++) {
+      for (int j = 0; j < nr; j++) {
+         c[i * ldc + j] += tile[i][j];
+      }
+   }
+}
+
+/*
+ * Implementation notes: micro-kernels
+ * -----------------------------------
+ * Each kernel multiplies a packed panel of a by a packed panel of b
+ * over kc terms and adds the MR x NR result to c.  The AVX kernel
+ * holds the tile in eight registers, two per row, and broadcasts one
+ * element of a against two registers of b at each step.  SSE2 has
+ * only sixteen registers, so its kernel makes one pass over each half
+ * of the panel of b with the half tile in eight registers.
+ */
+
+static void kernelScalar(int kc, const double *a, const double *b, double *c,
+                         int ldc, int mr, int nr) {
+   double tile[MR][NR];
+   memset(tile, 0, sizeof tile);
+   for (int k = 0; k < kc; k++) {
+      for (int i = 0; i < MR; i++) {
+         for (int j = 0; j < NR; j++) {
+            tile[i][j] += a[i] * b[j];
+         }
+      }
+      a += MR;
+      b += NR;
+   }
+   addTile(c, ldc, tile, mr, nr);
+}
+
+#ifdef SIMD_X86_64
+
+static void kernelSse2(int kc, const double *a, const double *b, double *c,
+                       int ldc, int mr, int nr) {
+   double tile[MR][NR];
+   for (int half = 0; half < NR; half += 4) {
+      __m128d c00 = _mm_setzero_pd(), c01 = _mm_setzero_pd();
+      __m128d c10 = _mm_setzero_pd(), c11 = _mm_setzero_pd();
+      __m128d c20 = _mm_setzero_pd(), c21 = _mm_setzero_pd();
+      __m128d c30 = _mm_setzero_pd(), c31 = _mm_setzero_pd();
+      const double *ak = a;
+      const double *bk = b + half;
+      for (int k = 0; k < kc; k++) {
+         __m128d b0 = _mm_loadu_pd(bk);
+         __m128d b1 = _mm_loadu_pd(bk + 2);
+         __m128d ai = _mm_set1_pd(ak[0]);
+         c00 = _mm_add_pd(c00, _mm_mul_pd(ai, b0));
+         c01 = _mm_add_pd(c01, _mm_mul_pd(ai, b1));
+         ai = _mm_set1_pd(ak[1]);
+         c10 = _mm_add_pd(c10, _mm_mul_pd(ai, b0));
+         c11 = _mm_add_pd(c11, _mm_mul_pd(ai, b1));
+         ai = _mm_set1_pd(ak[2]);
+         c20 = _mm_add_pd(c20, _mm_mul_pd(ai, b0));
+         c21 = _mm_add_pd(c21, _mm_mul_pd(ai, b1));
+         ai = _mm_set1_pd(ak[3]);
+         c30 = _mm_add_pd(c30, _mm_mul_pd(ai, b0));
+         c31 = _mm_add_pd(c31, _mm_mul_pd(ai, b1));
+         ak += MR;
+         bk += NR;
+      }
+      _mm_storeu_pd(&tile[0][half], c00);
+      _mm_storeu_pd(&tile[0][half + 2], c01);
+      _mm_storeu_pd(&tile[1][half], c10);
+      _mm_storeu_pd(&tile[1][half + 2], c11);
+      _mm_storeu_pd(&tile[2][half], c20);
+      _mm_storeu_pd(&tile[2][half + 2], c21);
+      _mm_storeu_pd(&tile[3][half], c30);
+      _mm_storeu_pd(&tile[3][half + 2], c31);
+   }
+   addTile(c, ldc, tile, mr, nr);
+}
+
+AVX_TARGET static void kernelAvx(int kc, const double *a, const double *b,
+                                 double *c, int ldc, int mr, int nr) {
+   __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+   __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+   __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+   __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+   for (int k = 0; k < kc; k++) {
+      __m256d b0 = _mm256_loadu_pd(b);
+      __m256d b1 = _mm256_loadu_pd(b + 4);
+      __m256d ai = _mm256_broadcast_sd(a);
+      c00 = _mm256_add_pd(c00, _mm256_mul_pd(ai, b0));
+      c01 = _mm256_add_pd(c01, _mm256_mul_pd(ai, b1));
+      ai = _mm256_broadcast_sd(a + 1);
+      c10 = _mm256_add_pd(c10, _mm256_mul_pd(ai, b0));
+      c11 = _mm256_add_pd(c11, _mm256_mul_pd(ai, b1));
+      ai = _mm256_broadcast_sd(a + 2);
+      c20 = _mm256_add_pd(c20, _mm256_mul_pd(ai, b0));
+      c21 = _mm256_add_pd(c21, _mm256_mul_pd(ai, b1));
+      ai = _mm256_broadcast_sd(a + 3);
+      c30 = _mm256_add_pd(c30, _mm256_mul_pd(ai, b0));
+      c31 = _mm256_add_pd(c31, _mm256_mul_pd(ai, b1));
+      a += MR;
+      b += NR;
+   }
+   double tile[MR][NR];
+   _mm256_storeu_pd(&tile[0][0], c00);
+   _mm256_storeu_pd(&tile[0][4], c01);
+   _mm256_storeu_pd(&tile[1][0], c10);
+   _mm256_storeu_pd(&tile[1][4], c11);
+   _mm256_storeu_pd(&tile[2][0], c20);
+   _mm256_storeu_pd(&tile[2][4], c21);
+   _mm256_storeu_pd(&tile[3][0], c30);
+   _mm256_storeu_pd(&tile[3][4], c31);
+   addTile(c, ldc, tile, mr, nr);
+}
+
+#endif
+
+typedef void (*MicroKernel)(int kc, const double *a, const double *b,
+                            double *c, int ldc, int mr, int nr);
+
+static MicroKernel chooseKernel() {
+   switch (getSimdLevel()) {
+#ifdef SIMD_X86_64
+   case SIMD_AVX: return kernelAvx;
+   case SIMD_SSE2: return kernelSse2;
+#endif
+   default: return kernelScalar;
+   }
+}
+
+/*
+ * Type: Band
+ * ----------
+ * The operands of a product together with the rows of c, from first
+ * up to but not including last, that one thread computes.
+ */
+
+struct Band {
+   double *c;
+   const double *a;
+   const double *b;
+   int p;
+   int m;
+   int first;
+   int last;
+};
+
+/*
+ * Function: multiplyBand
+ * Usage: multiplyBand(band);
+ * --------------------------
+ * Computes the rows of c in band through the loops over blocks and
+ * panels described in the notes on blocking.
+ */
+
+static void multiplyBand(const Band & band) {
+   MicroKernel kernel = chooseKernel();
+   int p = band.p;
+   int m = band.m;
+   vector<double> aPack(MC * KC);
+   vector<double> bPack(KC * min(NC, (m + NR - 1) / NR * NR));
+   for (int i = band.first; i < band.last; i++) {
+      memset(band.c + (size_t) i * m, 0, m * sizeof(double));
+   }
+   for (int jc = 0; jc < m; jc += NC) {
+      int nc = min(NC, m - jc);
+      for (int pc = 0; pc < p; pc += KC) {
+         int kc = min(KC, p - pc);
+         packB(&bPack[0], band.b + (size_t) pc * m + jc, m, kc, nc);
+         for (int ic = band.first; ic < band.last; ic += MC) {
+            int mc = min(MC, band.last - ic);
+            packA(&aPack[0], band.a + (size_t) ic * p + pc, p, mc, kc);
+            for (int jr = 0; jr < nc; jr += NR) {
+               for (int ir = 0; ir < mc; ir += MR) {
+                  kernel(kc, &aPack[ir * kc], &bPack[jr * kc],
+                         band.c + (size_t) (ic + ir) * m + jc + jr, m,
+                         min(MR, mc - ir), min(NR, nc - jr));
+               }
+            }
+         }
+      }
+   }
+}
+
+#ifdef MATRIX_THREADS
+
+static void *bandMain(void *arg) {
+   multiplyBand(*(Band *) arg);
+   return NULL;
+}
+
+#endif
+
+void multiplyMatrices(double *c, const double *a, const double *b,
+                      int n, int p, int m) {
+   int panels = (n + MR - 1) / MR;
+   double work = (double) n * p * m;
+   int nThreads = threadCount;
+   if (nThreads > panels) nThreads = panels;
+   if (nThreads > work / MIN_THREAD_WORK) nThreads = (int) (work / MIN_THREAD_WORK);
+   if (nThreads < 1) nThreads = 1;
+   vector<Band> bands(nThreads);
+   for (int t = 0; t < nThreads; t++) {
+      Band & band = bands[t];
+      band.c = c;
+      band.a = a;
+      band.b = b;
+      band.p = p;
+      band.m = m;
+      band.first = min(n, (int) ((double) panels * t / nThreads) * MR);
+      band.last = min(n, (int) ((double) panels * (t + 1) / nThreads) * MR);
+   }
+#ifdef MATRIX_THREADS
+   vector<pthread_t> threads(nThreads);
+   vector<bool> started(nThreads, false);
+   for (int t = 1; t < nThreads; t++) {
+      started[t] = pthread_create(&threads[t], NULL, bandMain, &bands[t]) == 0;
+   }
+   multiplyBand(bands[0]);
+   for (int t = 1; t < nThreads; t++) {
+      if (started[t]) {
+         pthread_join(threads[t], NULL);
+      } else {
+         multiplyBand(bands[t]);
+      }
+   }
+#else
+   for (int t = 0; t < nThreads; t++) {
+      multiplyBand(bands[t]);
+   }
+#endif
+}
+
+/*
+ * Implementation notes: transposeMatrix
+ * -------------------------------------
+ * A transpose does no arithmetic, so its speed is that of memory.  It
+ * runs over tiles of TILE x TILE elements, so that the lines of src
+ * and of dst a tile touches stay in the first-level cache while it is
+ * copied, instead of walking the whole of dst a column at a time.  A
+ * row of a tile is one cache line.  Larger tiles are no faster, and
+ * when the rows are a power of two apart their lines compete for the
+ * same few sets of the cache and they become several times slower.
+ */
+
+static const int TILE = 8;
+
+void transposeMatrix(double *dst, const double *src, int rows, int cols) {
+   for (int ib = 0; ib < rows; ib += TILE) {
+      int iEnd = min(rows, ib + TILE);
+      for (int jb = 0; jb < cols; jb += TILE) {
+         int jEnd = min(cols, jb + TILE);
+         for (int i = ib; i < iEnd; i++) {
+            for (int j = jb; j < jEnd; j++) {
+               dst[(size_t) j * rows + i] = src[(size_t) i * cols + j];
+            }
+         }
+      }
+   }
+}
+
+/*
+ * Implementation notes: invertMatrix
+ * ----------------------------------
+ * The elimination reduces a copy of src to the identity while applying
+ * the same row operations to dst, which starts out as the identity.
+ * At column k, the row with the entry of greatest magnitude is swapped
+ * into place and divided by its pivot, and a multiple of it is then
+ * subtracted from every other row.  The columns of the copy left of k
+ * are already settled and are not touched again.  Each row operation
+ * is one call to a vector kernel of simd.h.
+ */
+
+bool invertMatrix(double *dst, const double *src, int n) {
+   vector<double> work(src, src + (size_t) n * n);
+   double *w = &work[0];
+   memset(dst, 0, (size_t) n * n * sizeof(double));
+   for (int i = 0; i < n; i++) {
+      dst[(size_t) i * n + i] = 1;
+   }
+   for (int k = 0; k < n; k++) {
+      double *wk = w + (size_t) k * n;
+      double *dk = dst + (size_t) k * n;
+      int pivot = k;
+      double largest = fabs(wk[k]);
+      for (int i = k + 1; i < n; i++) {
+         double magnitude = fabs(w[(size_t) i * n + k]);
+         if (magnitude > largest) {
+            pivot = i;
+            largest = magnitude;
+         }
+      }
+      if (largest == 0) return false;
+      if (pivot != k) {
+         swap_ranges(wk + k, wk + n, w + (size_t) pivot * n + k);
+         swap_ranges(dk, dk + n, dst + (size_t) pivot * n);
+      }
+      double d = wk[k];
+      combineVectorScalar(ARRAY_DIV, wk + k, wk + k, d, n - k);
+      combineVectorScalar(ARRAY_DIV, dk, dk, d, n);
+      for (int i = 0; i < n; i++) {
+         double *wi = w + (size_t) i * n;
+         double f = wi[k];
+         if (i == k || f == 0) continue;
+         subtractScaledVector(wi + k, f, wk + k, n - k);
+         subtractScaledVector(dst + (size_t) i * n, f, dk, n);
+      }
+   }
+   return true;
+}
@@ -0,0 +1,66 @@
+/*
+ * File: matrix.h
+ * --------------
+ * This interface exports the matrix kernels behind the MAT statements:
+ * multiplication, transposition and inversion of dense matrices of
+ * doubles stored row by row.  Multiplication works on blocks sized for
+ * the caches and tiles sized for the registers, uses the instruction
+ * set chosen in simd.h and spreads large products over several
+ * threads.  Neither the instruction set nor the number of threads can
+ * change a single bit of any result.
+ */
+
+#ifndef _matrix_h
+#define _matrix_h
+
+/*
+ * Functions: getMatrixThreadCount, setMatrixThreadCount
+ * Usage: int nThreads = getMatrixThreadCount();
+ *        setMatrixThreadCount(1);
+ * -----------------------------------------------------
+ * Return and set the largest number of threads a product may use.
+ * The count starts out as the number of processors online, or 1 on
+ * systems without threads; setMatrixThreadCount, meant for benchmarks
+ * and tests, treats any count below 1 as 1.  The count is shared by
+ * every thread and should only be set before any runs.
+ */
+
+int getMatrixThreadCount();
+void setMatrixThreadCount(int nThreads);
+
+/*
+ * Function: multiplyMatrices
+ * Usage: multiplyMatrices(c, a, b, n, p, m);
+ * ------------------------------------------
+ * Sets the n x m matrix c to the product of the n x p matrix a and
+ * the p x m matrix b.  c must not overlap a or b.  Each element is
+ * summed over p in order, in runs of up to 256 terms whose partial
+ * sums are added to the element one after another.
+ */
+
+void multiplyMatrices(double *c, const double *a, const double *b,
+                      int n, int p, int m);
+
+/*
+ * Function: transposeMatrix
+ * Usage: transposeMatrix(dst, src, rows, cols);
+ * ---------------------------------------------
+ * Sets the cols x rows matrix dst to the transpose of the rows x cols
+ * matrix src.  dst must not overlap src.
+ */
+
+void transposeMatrix(double *dst, const double *src, int rows, int cols);
+
+/*
+ * Function: invertMatrix
+ * Usage: if (!invertMatrix(dst, src, n)) ...
+ * ------------------------------------------
+ * Sets the n x n matrix dst to the inverse of src by Gauss-Jordan
+ * elimination with partial pivoting and returns true, or returns
+ * false if a column has no nonzero pivot, in which case src is
+ * singular and dst is left undefined.  dst must not overlap src.
+ */
+
+bool invertMatrix(double *dst, const double *src, int n);
+
+#endif
@@ -0,0 +1,115 @@
+/*
+ * File: optimizer.cpp
+ * -------------------
+ * Implements the optimizer.h interface.
+ */
+
+#include <cmath>
+#include <string>
+#include "optimizer.h"
+using namespace std;
+
+/* Function prototypes */
+
+static Expression *optimizeCompound(CompoundExp *exp, Arena & arena);
+static Expression *optimizeArray(ArrayExp *exp, Arena & arena);
+static bool isConstant(Expression *exp, double value);
+static bool hasExactReciprocal(double value);
+
+/*
+ * Implementation notes: optimizeExp
+ * ---------------------------------
+ * Leaves are shared with the original tree, which is safe because
+ * arena nodes are never freed one by one; compound nodes are rebuilt
+ * from their optimized operands through newCompoundExp, so the result
+ * also picks up the specialized node classes wherever a rewrite
+ * exposes a new variable/constant pair.  Array elements are rebuilt
+ * with optimized subscripts.
+ */
+
+Expression *optimizeExp(Expression *exp, Arena & arena) {
+   switch (exp->getType()) {
+   case COMPOUND: return optimizeCompound((CompoundExp *) exp, arena);
+   case ARRAY: return optimizeArray((ArrayExp *) exp, arena);
+   default: return exp;
+   }
+}
+
+/*
+ * Implementation notes: optimizeCompound
+ * --------------------------------------
+ * Folding evaluates a temporary node on the stack against a scratch
+ * EvalState, which is safe because a node whose operands are both
+ * constants never reads a variable.  Each identity returns the
+ * surviving operand; the other one is simply left in the arena.
+ */
+
+static Expression *optimizeCompound(CompoundExp *exp, Arena & arena) {
+   Operator op = exp->getOperator();
+   Expression *lhs = optimizeExp(exp->getLHS(), arena);
+   Expression *rhs = optimizeExp(exp->getRHS(), arena);
+   if (op == ASSIGN_OP) return new (arena) CompoundExp(op, lhs, rhs);
+   if (lhs->getType() == CONSTANT && rhs->getType() == CONSTANT) {
+      CompoundExp node(op, lhs, rhs);
+      EvalState scratch;
+      return new (arena) ConstantExp(node.eval(scratch));
+   }
+   if ((op == PLUS_OP && isConstant(rhs, 0)) 
+       || (op == MINUS_OP && isConstant(rhs, 0))
+       || (op == TIMES_OP && isConstant(rhs, 1))
+       || (op == DIVIDE_OP && isConstant(rhs, 1))) {
+      return lhs;
+   }
+   if ((op == PLUS_OP && isConstant(lhs, 0)) 
+       || (op == TIMES_OP && isConstant(lhs, 1))) {
+      return rhs;
+   }
+   if (op == DIVIDE_OP && rhs->getType() == CONSTANT) {
+      double divisor = ((ConstantExp *) rhs)->getValue();
+      if (hasExactReciprocal(divisor)) {
+         Expression *reciprocal = new (arena) ConstantExp(1 / divisor);
+         return newCompoundExp(TIMES_OP, lhs, reciprocal, arena);
+      }
+   }
+   return newCompoundExp(op, lhs, rhs, arena);
+}
+
+static Expression *optimizeArray(ArrayExp *exp, Arena & arena) {
+   int nSubscripts = exp->getSubscriptCount();
+   if (nSubscripts == 0) return exp;
+   Expression **subscripts = arena.allocateArray<Expression *>(nSubscripts);
+   for (int i = 0; i < nSubscripts; i++) {
+      subscripts[i] = optimizeExp(exp->getSubscript(i), arena);
+   }
+   return new (arena) ArrayExp(exp->getSlot(), nSubscripts, subscripts);
+}
+
+/*
+ * Function: isConstant
+ * Usage: if (isConstant(exp, value)) . . .
+ * ----------------------------------------
+ * Returns true if exp is a constant node with the given value.
+ */
+
+static bool isConstant(Expression *exp, double value) {
+   return exp->getType() == CONSTANT 
+       && ((ConstantExp *) exp)->getValue() == value;
+}
+
+/*
+ * Function: hasExactReciprocal
+ * Usage: if (hasExactReciprocal(value)) . . .
+ * -------------------------------------------
+ * Returns true if value is a power of two whose reciprocal is a
+ * normal double.  Multiplying by such a reciprocal only adjusts the
+ * exponent, exactly like dividing by value does.
+ */
+
+static bool hasExactReciprocal(double value) {
+   int exponent;
+   if (value == 0 || value != value) return false;
+   if (fabs(frexp(value, &exponent)) != 0.5) return false;
+   double reciprocal = 1 / value;
+   return fabs(reciprocal) >= 2.2250738585072014e-308
+       && fabs(reciprocal) <= 1.7976931348623157e+308;
+}
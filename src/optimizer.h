@@ -0,0 +1,41 @@
+/*
+ * File: optimizer.h
+ * -----------------
+ * This interface exports the expression optimizer, which rewrites a
+ * parsed expression tree into an equivalent tree that is cheaper to
+ * evaluate.
+ */
+
+#ifndef _optimizer_h
+#define _optimizer_h
+
+#include "exp.h"
+
+/*
+ * Function: optimizeExp
+ * Usage: Expression *fast = optimizeExp(exp, arena);
+ * --------------------------------------------------
+ * Returns an expression tree, built in arena, that computes the same
+ * value as exp.  The original tree is left untouched, so statements keep it for
+ * display (the debugger shows the expression as it was written) and
+ * evaluate the optimized copy.  The following rewrites are applied
+ * bottom-up:
+ *
+ *  - Constant folding: an operator applied to two constants becomes
+ *    a single constant, so 2*3+x becomes 6+x and the unary minus
+ *    form 0-5 becomes -5.
+ *  - Algebraic identities: x+0, 0+x, x-0, x*1, 1*x and x/1 become x.
+ *  - Strength reduction: x/c becomes x*(1/c) when c is a power of
+ *    two, the only case in which the reciprocal is exact and the
+ *    product is bit-for-bit equal to the quotient.
+ *
+ * Rewrites that could change a result (such as x*0, which differs
+ * for an undefined or infinite x, or reassociating sums) are not
+ * performed.  The only observable difference is the sign of zero:
+ * x+0 with x equal to -0 now yields -0 instead of 0.  The result
+ * may share leaves with exp.
+ */
+
+Expression *optimizeExp(Expression *exp, Arena & arena);
+
+#endif
@@ -0,0 +1,174 @@
+/*
+ * File: output.cpp
+ * ----------------
+ * Implements the output.h interface.
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include "output.h"
+#include "error.h"
+#include "simpio.h"
+#include "strlib.h"
+using namespace std;
+
+#if defined(__unix__) || defined(__APPLE__)
+#  define OUTPUT_THREADS
+#  include <pthread.h>
+#endif
+
+/*
+ * Constants
+ * ---------
+ * BLOCK_SIZE -- Size at which FLUSH_BLOCK writes the console out
+ */
+
+static const size_t BLOCK_SIZE = 1 << 16;
+
+/*
+ * Implementation notes: console buffer
+ * ------------------------------------
+ * The console buffer is created on first use, which also registers
+ * flushOutput with atexit, so output still pending when QUIT calls
+ * exit is not lost.  The first use may come from several threads at
+ * once, so the creation runs under pthread_once where threads exist.
+ * Other buffers are plain strings; only the console consults its
+ * flush policy.
+ */
+
+static OutputBuffer *consoleBuffer = NULL;
+
+static void exitHandler() {
+   flushOutput();
+}
+
+void OutputBuffer::createConsole() {
+   consoleBuffer = new OutputBuffer();
+   consoleBuffer->console = true;
+   consoleBuffer->text.reserve(BLOCK_SIZE + BLOCK_SIZE / 4);
+   atexit(exitHandler);
+}
+
+OutputBuffer & getConsoleOutput() {
+#ifdef OUTPUT_THREADS
+   static pthread_once_t once = PTHREAD_ONCE_INIT;
+   pthread_once(&once, OutputBuffer::createConsole);
+#else
+   if (consoleBuffer == NULL) OutputBuffer::createConsole();
+#endif
+   return *consoleBuffer;
+}
+
+void setFlushPolicy(FlushPolicy policy) {
+   getConsoleOutput().setFlushPolicy(policy);
+}
+
+FlushPolicy getFlushPolicy() {
+   return getConsoleOutput().getFlushPolicy();
+}
+
+/* Implementation of the OutputBuffer class */
+
+OutputBuffer::OutputBuffer() {
+   console = false;
+   policy = FLUSH_BLOCK;
+}
+
+void OutputBuffer::setFlushPolicy(FlushPolicy policy) {
+   this->policy = policy;
+}
+
+FlushPolicy OutputBuffer::getFlushPolicy() const {
+   return policy;
+}
+
+void OutputBuffer::write(const string & str) {
+   text.append(str);
+   checkFlush();
+}
+
+void OutputBuffer::write(const char *chars, int length) {
+   text.append(chars, length);
+   checkFlush();
+}
+
+void OutputBuffer::writeNumber(double value) {
+   text += realToString(value);
+   text += ' ';
+   checkFlush();
+}
+
+void OutputBuffer::endLine() {
+   text += '\n';
+   if (console && policy == FLUSH_LINE) {
+      flush();
+   } else {
+      checkFlush();
+   }
+}
+
+void OutputBuffer::checkFlush() {
+   if (console && policy == FLUSH_BLOCK && text.size() >= BLOCK_SIZE) flush();
+}
+
+void OutputBuffer::flush() {
+   if (!console) return;
+   if (!text.empty()) {
+      cout.write(text.data(), text.size());
+      text.clear();
+   }
+   cout.flush();
+}
+
+const string & OutputBuffer::getText() const {
+   return text;
+}
+
+void OutputBuffer::takeText(string & str) {
+   text.swap(str);
+}
+
+void OutputBuffer::clear() {
+   text.clear();
+}
+
+/* Console functions */
+
+void writeOutput(const string & str) {
+   getConsoleOutput().write(str);
+}
+
+void writeOutput(const char *chars, int length) {
+   getConsoleOutput().write(chars, length);
+}
+
+void writeNumber(double value) {
+   getConsoleOutput().writeNumber(value);
+}
+
+void endOutputLine() {
+   getConsoleOutput().endLine();
+}
+
+void flushOutput() {
+   getConsoleOutput().flush();
+}
+
+/*
+ * Implementation notes: readInput
+ * -------------------------------
+ * Interactive input goes through getReal, which prompts again on a
+ * bad entry.  Input from a stream is read a word at a time, so it
+ * does not matter how the values are laid out over lines.
+ */
+
+double readInput(const string & name, istream *input) {
+   if (input == NULL) {
+      flushOutput();
+      return getReal(name + " ? ");
+   }
+   string word;
+   if (!(*input >> word)) error("No input left for " + name);
+   return stringToReal(word);
+}
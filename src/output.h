@@ -0,0 +1,208 @@
+/*
+ * File: output.h
+ * --------------
+ * This interface exports the buffered writer through which every
+ * engine sends the output of PRINT.  Output collects in a large
+ * user-space buffer and reaches cout only when the flush policy says
+ * so, which turns a program printing millions of lines into a handful
+ * of writes instead of one flush per line.
+ *
+ * Whatever the policy, the buffer is always flushed before an INPUT
+ * prompt, when a run ends or stops on an error and when the process
+ * exits, so program output and prompts appear in the order they were
+ * produced.  INPUT itself reads through readInput, which also serves
+ * the batch modes of the interpreter.
+ *
+ * The writer behind cout is the console buffer.  Each EvalState
+ * names the buffer its program prints to, which is the console buffer
+ * unless the state was given one of its own; a batch runner gives
+ * every run a private buffer and collects its text.  No buffer locks
+ * its text, so programs running at the same time must each print to
+ * a buffer of their own.
+ */
+
+#ifndef _output_h
+#define _output_h
+
+#include <iosfwd>
+#include <string>
+
+/*
+ * Type: FlushPolicy
+ * -----------------
+ * Controls when a buffer that writes to cout, which only the console
+ * buffer does, is written out in addition to the points listed above:
+ *
+ *  FLUSH_LINE  -- after every completed PRINT line
+ *  FLUSH_BLOCK -- whenever the buffer fills up (the default)
+ *  FLUSH_NEVER -- never; output appears only at the points above
+ */
+
+enum FlushPolicy { FLUSH_LINE, FLUSH_BLOCK, FLUSH_NEVER };
+
+/*
+ * Functions: setFlushPolicy, getFlushPolicy
+ * Usage: setFlushPolicy(FLUSH_LINE);
+ *        FlushPolicy policy = getFlushPolicy();
+ * ---------------------------------------------
+ * Set and return the flush policy of the console buffer.
+ */
+
+void setFlushPolicy(FlushPolicy policy);
+FlushPolicy getFlushPolicy();
+
+/*
+ * Class: OutputBuffer
+ * -------------------
+ * A buffer of PRINT output.  A buffer created by a client collects
+ * text until the client takes it with getText; only the console
+ * buffer (see getConsoleOutput) ever writes to cout.
+ */
+
+class OutputBuffer {
+
+public:
+
+/*
+ * Constructor: OutputBuffer
+ * Usage: OutputBuffer output;
+ * ---------------------------
+ * Creates an empty buffer that collects text without writing it.
+ */
+
+   OutputBuffer();
+
+/*
+ * Methods: write, writeNumber, endLine
+ * Usage: output.write(str);
+ *        output.write(chars, length);
+ *        output.writeNumber(value);
+ *        output.endLine();
+ * -----------------------------------
+ * write appends str, or length characters starting at chars.
+ * writeNumber appends value, formatted as PRINT formats it, followed
+ * by a space, and endLine ends the current PRINT line.
+ */
+
+   void write(const std::string & str);
+   void write(const char *chars, int length);
+   void writeNumber(double value);
+   void endLine();
+
+/*
+ * Method: flush
+ * Usage: output.flush();
+ * ----------------------
+ * Writes out everything buffered so far if this is the console
+ * buffer.  Other buffers keep their text.
+ */
+
+   void flush();
+
+/*
+ * Methods: setFlushPolicy, getFlushPolicy
+ * Usage: output.setFlushPolicy(FLUSH_LINE);
+ *        FlushPolicy policy = output.getFlushPolicy();
+ * ----------------------------------------------------
+ * Set and return the flush policy of this buffer, which starts out
+ * as FLUSH_BLOCK.  Only the console buffer acts on it.
+ */
+
+   void setFlushPolicy(FlushPolicy policy);
+   FlushPolicy getFlushPolicy() const;
+
+/*
+ * Methods: getText, takeText, clear
+ * Usage: string text = output.getText();
+ *        output.takeText(text);
+ *        output.clear();
+ * -------------------------------------
+ * getText returns the text collected so far and clear discards it.
+ * takeText moves the text into str without copying it, so it cannot
+ * run out of memory, and leaves the buffer holding the old contents
+ * of str.
+ */
+
+   const std::string & getText() const;
+   void takeText(std::string & str);
+   void clear();
+
+private:
+
+   std::string text;
+   bool console;
+   FlushPolicy policy;
+
+   void checkFlush();
+   static void createConsole();
+
+   friend OutputBuffer & getConsoleOutput();
+
+};
+
+/*
+ * Function: getConsoleOutput
+ * Usage: OutputBuffer & output = getConsoleOutput();
+ * --------------------------------------------------
+ * Returns the console buffer, which writes to cout according to the
+ * flush policy and is flushed when the process exits.
+ */
+
+OutputBuffer & getConsoleOutput();
+
+/*
+ * Function: writeOutput
+ * Usage: writeOutput(str);
+ *        writeOutput(chars, length);
+ * ----------------------------------
+ * Appends str, or length characters starting at chars, to the
+ * console buffer.
+ */
+
+void writeOutput(const std::string & str);
+void writeOutput(const char *chars, int length);
+
+/*
+ * Function: writeNumber
+ * Usage: writeNumber(value);
+ * --------------------------
+ * Appends value to the console buffer, formatted as PRINT formats
+ * it, followed by a space.
+ */
+
+void writeNumber(double value);
+
+/*
+ * Function: endOutputLine
+ * Usage: endOutputLine();
+ * -----------------------
+ * Ends the current PRINT line of the console buffer, flushing it
+ * under FLUSH_LINE.
+ */
+
+void endOutputLine();
+
+/*
+ * Function: flushOutput
+ * Usage: flushOutput();
+ * ---------------------
+ * Writes everything in the console buffer to cout and flushes cout.
+ */
+
+void flushOutput();
+
+/*
+ * Function: readInput
+ * Usage: double value = readInput(name, input);
+ * ---------------------------------------------
+ * Reads the value of the variable name for INPUT.  If input is NULL,
+ * the console buffer is flushed and the user is prompted with
+ * "name ? " until a number is entered.  Otherwise the value is the
+ * next word of input, without a prompt and without touching the
+ * console; values may be separated by spaces or newlines, and a word
+ * that is not a number, or the end of the input, is an error.
+ */
+
+double readInput(const std::string & name, std::istream *input);
+
+#endif
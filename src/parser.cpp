@@ -17,42 +17,45 @@ using namespace std;
  * This code just reads an expression and then checks for extra tokens.
  */
 
-Expression *parseExp(TokenScanner & scanner) {
-   Expression *exp = readE(scanner);
-   if (scanner.hasMoreTokens()) {
-      error("parseExp: Found extra token: " + scanner.nextToken());
+Expression *parseExp(Lexer & lexer, Arena & arena) {
+   Expression *exp = readE(lexer, arena);
+   if (lexer.hasMoreTokens()) {
+      error("parseExp: Found extra token: " + lexer.nextToken().getText());
    }
    return exp;
 }
 
 /*
  * Implementation notes: readE
- * Usage: exp = readE(scanner, prec);
- * ----------------------------------
+ * Usage: exp = readE(lexer, prec);
+ * --------------------------------
  * This version of readE uses precedence to resolve the ambiguity in
  * the grammar.  At each recursive level, the parser reads operators and
  * subexpressions until it finds an operator whose precedence is greater
  * than the prevailing one.  When a higher-precedence operator is found,
  * readE calls itself recursively to read in that subexpression as a unit.
  * 
- * If the use of minus sign (-) as a unary operator is detected, adds
- * 0 in front of the expression to evalutate it as (0-exp).
+ * If the use of minus sign (-) as a unary operator is detected, starts
+ * from a constant 0 in place of the first term, so that the expression
+ * is evaluated as (0-exp).
  */
 
-Expression *readE(TokenScanner & scanner, int prec) {
-   string temp = scanner.nextToken();
-   scanner.saveToken(temp);
-   if (temp == "-") scanner.saveToken("0");
-   Expression *exp = readT(scanner);
-   string token;
+Expression *readE(Lexer & lexer, Arena & arena, int prec) {
+   Expression *exp;
+   if (lexer.peekToken().is('-')) {
+      exp = new (arena) ConstantExp(0);
+   } else {
+      exp = readT(lexer, arena);
+   }
    while (true) {
-      token = scanner.nextToken();
+      const Token & token = lexer.peekToken();
       int newPrec = precedence(token);
       if (newPrec <= prec) break;
-      Expression *rhs = readE(scanner, newPrec);
-      exp = new CompoundExp(token, exp, rhs);
+      Operator op = token.op;
+      lexer.nextToken();
+      Expression *rhs = readE(lexer, arena, newPrec);
+      exp = newCompoundExp(op, exp, rhs, arena);
    }
-   scanner.saveToken(token);
    return exp;
 }
 
@@ -60,17 +63,89 @@ Expression *readE(TokenScanner & scanner, int prec) {
  * Implementation notes: readT
  * ---------------------------
  * This function scans a term, which is either an integer, a identifier,
- * or a parenthesized subexpression.
+ * an array reference, a call of SUM or DOT, or a parenthesized
+ * subexpression.  A word followed by a parenthesis names an array,
+ * except that SUM and DOT name their functions there.
+ */
+
+Expression *readT(Lexer & lexer, Arena & arena) {
+   Token token = lexer.nextToken();
+   if (token.kind == WORD_TOKEN) {
+      if (!lexer.peekToken().is('(')) {
+         return new (arena) IdentifierExp(getVariableSlot(token.text, token.length));
+      }
+      if (token.keyword == SUM_KW || token.keyword == DOT_KW) {
+         return readReduction(token.keyword, lexer, arena);
+      }
+      return readArray(getVariableSlot(token.text, token.length), lexer, arena);
+   }
+   if (token.kind == NUMBER_TOKEN) return new (arena) ConstantExp(token.number);
+   if (!token.is('(')) error("Illegal term in expression" + token.getText());
+   Expression *exp = readE(lexer, arena);
+   if (!lexer.nextToken().is(')')) {
+      error("Unbalanced parentheses in expression");
+   }
+   return exp;
+}
+
+/*
+ * Implementation notes: readArray
+ * -------------------------------
+ * Reads the subscripts into a fixed buffer, since there are never
+ * more than two, and copies them into the arena.
+ */
+
+Expression *readArray(int slot, Lexer & lexer, Arena & arena) {
+   lexer.nextToken();
+   Expression *buffer[2];
+   int nSubscripts = 0;
+   if (lexer.peekToken().is(')')) {
+      lexer.nextToken();
+   } else {
+      while (true) {
+         if (nSubscripts == 2) {
+            error("Array " + getVariableName(slot) + " has too many subscripts");
+         }
+         buffer[nSubscripts++] = readE(lexer, arena);
+         Token token = lexer.nextToken();
+         if (token.is(')')) break;
+         if (!token.is(',')) error("Unbalanced parentheses in expression");
+      }
+   }
+   Expression **subscripts = arena.allocateArray<Expression *>(nSubscripts);
+   for (int i = 0; i < nSubscripts; i++) {
+      subscripts[i] = buffer[i];
+   }
+   return new (arena) ArrayExp(slot, nSubscripts, subscripts);
+}
+
+/*
+ * Implementation notes: readReduction
+ * -----------------------------------
+ * The arguments of SUM and DOT must be whole arrays, written with
+ * empty parentheses; readWholeArray reads one and returns its slot.
  */
 
-Expression *readT(TokenScanner & scanner) {
-   string token = scanner.nextToken();
-   TokenType type = scanner.getTokenType(token);
-   if (type == WORD) return new IdentifierExp(token);
-   if (type == NUMBER) return new ConstantExp(stringToReal(token));
-   if (token != "(") error("Illegal term in expression" + token);
-   Expression *exp = readE(scanner);
-   if (scanner.nextToken() != ")") {
+static int readWholeArray(Lexer & lexer) {
+   Token name = lexer.nextToken();
+   if (name.kind != WORD_TOKEN || !lexer.nextToken().is('(')
+       || !lexer.nextToken().is(')')) {
+      error("SUM and DOT take whole arrays, such as A()");
+   }
+   return getVariableSlot(name.text, name.length);
+}
+
+Expression *readReduction(Keyword keyword, Lexer & lexer, Arena & arena) {
+   lexer.nextToken();
+   int slot = readWholeArray(lexer);
+   Expression *exp;
+   if (keyword == SUM_KW) {
+      exp = new (arena) ReductionExp(slot);
+   } else {
+      if (!lexer.nextToken().is(',')) error("DOT takes two arrays");
+      exp = new (arena) ReductionExp(slot, readWholeArray(lexer));
+   }
+   if (!lexer.nextToken().is(')')) {
       error("Unbalanced parentheses in expression");
    }
    return exp;
@@ -79,45 +154,102 @@ Expression *readT(TokenScanner & scanner) {
 /*
  * Implementation notes: precedence
  * --------------------------------
- * This function checks the token against each of the defined operators
- * and returns the appropriate precedence value.
+ * This function checks the operator of the token against each of the
+ * arithmetic operators and returns the appropriate precedence value.
  */
 
-int precedence(string token) {
-   if (token == "+" || token == "-") return 1;
-   if (token == "*" || token == "/") return 2;
+int precedence(const Token & token) {
+   if (token.op == PLUS_OP || token.op == MINUS_OP) return 1;
+   if (token.op == TIMES_OP || token.op == DIVIDE_OP) return 2;
    return 0;
 }
 
+/*
+ * Function: newLetStmt
+ * Usage: Statement *stmt = newLetStmt(lexer, arena);
+ * -------------------------------------------------
+ * Creates an ArrayLetStmt if the target is a whole array and a
+ * LetStmt otherwise.  The target is looked at through a copy of
+ * the lexer, so the statement still reads it from the start.
+ */
+static Statement *newLetStmt(Lexer & lexer, Arena & arena) {
+	Lexer probe = lexer;
+	if (probe.nextToken().kind == WORD_TOKEN && probe.nextToken().is('(')
+		&& probe.nextToken().is(')')) {
+		return new (arena) ArrayLetStmt(lexer, arena);
+	}
+	return new (arena) LetStmt(lexer, arena);
+}
+
+/*
+ * Implementation notes: readStatement
+ * ------------------------------------------------------
+ * Does the work of parseStatement short of describing the
+ * statement and releasing the arena after an error.
+ */
+static Statement *readStatement(Lexer & lexer, Arena & arena){
+	const Token & statement = lexer.peekToken();
+	Keyword keyword = statement.keyword;
+	switch (keyword) {
+	case REM_KW: case LET_KW: case PRINT_KW: case INPUT_KW:
+	case GOTO_KW: case IF_KW: case END_KW: case DIM_KW: case MAT_KW:
+	case FOR_KW: case NEXT_KW: case WHILE_KW: case WEND_KW:
+		lexer.nextToken();
+		break;
+	default:
+		break;
+	}
+	Statement *stmt;
+	switch (keyword) {
+	case REM_KW: stmt = new (arena) RemStmt(lexer, arena); break;
+	case LET_KW: stmt = newLetStmt(lexer, arena); break;
+	case DIM_KW: stmt = new (arena) DimStmt(lexer, arena); break;
+	case MAT_KW: stmt = new (arena) MatStmt(lexer); break;
+	case PRINT_KW: stmt = new (arena) PrintStmt(lexer, arena); break;
+	case INPUT_KW: stmt = new (arena) InputStmt(lexer); break;
+	case GOTO_KW: stmt = new (arena) GotoStmt(lexer); break;
+	case IF_KW: stmt = new (arena) IfStmt(lexer, arena); break;
+	case FOR_KW: stmt = new (arena) ForStmt(lexer, arena); break;
+	case NEXT_KW: stmt = new (arena) NextStmt(lexer); break;
+	case WHILE_KW: stmt = new (arena) WhileStmt(lexer, arena); break;
+	case WEND_KW: stmt = new (arena) WendStmt(lexer); break;
+	case END_KW: stmt = new (arena) EndStmt(lexer); break;
+	default:
+		if (statement.kind != WORD_TOKEN) {
+			error("Invald statement: " + statement.getText());
+		}
+		stmt = newLetStmt(lexer, arena);
+		break;
+	}
+	stmt->optimize(arena);
+	return stmt;
+}
+
 /*
  * Implementation notes: processStatement
  * ------------------------------------------------------
- * Receives a scanner and checks the validity of the first
- * statement occurence. If valid, returns the corresponding 
+ * Receives a lexer and checks the validity of the first
+ * statement occurence, which is matched as a keyword in any
+ * case. If valid, returns the corresponding 
  * executable statement (as defined in documentation intro).
  * If no first statement exists, but token begins with a valid
- * variable term, then a LET executable statement is returned.
+ * variable term, then a LET executable statement is returned
+ * and the variable is left for it to read.  A LET whose target
+ * is a whole array, such as A(), becomes an ArrayLetStmt.
+ * Finally the expressions of the statement are run through
+ * the optimizer and the statement is described on the display,
+ * if any. Everything is allocated from arena, and a parse that
+ * fails gives back what it took from it, so that a mistyped
+ * line costs the program no memory.
  */
-Statement *parseStatement(TokenScanner & scanner){
-	string statement = scanner.nextToken();
-	Statement *stmt;
-	if(statement == "REM" || statement == "rem") {
-		stmt = new RemStmt(scanner);
-	} else if(statement == "LET" || statement == "let") {
-		stmt = new LetStmt(scanner);
-	} else if(statement == "PRINT" || statement == "print") {
-		stmt = new PrintStmt(scanner);
-	} else if(statement == "INPUT" || statement == "input") {
-		stmt = new InputStmt(scanner);
-	} else if(statement == "GOTO" || statement == "goto") {
-		stmt = new GotoStmt(scanner);
-	} else if(statement == "IF" || statement == "if") {
-		stmt = new IfStmt(scanner);
-	} else if(statement == "END" || statement == "end") {
-		stmt = new EndStmt(scanner);
-	} else if(scanner.getTokenType(statement) == WORD) {
-		scanner.saveToken(statement);
-		stmt = new LetStmt(scanner);
-	} else error("Invald statement: " + statement);
-	return stmt;
-}
\ No newline at end of file
+Statement *parseStatement(Lexer & lexer, Arena & arena, Display *display){
+	Arena::Mark mark = arena.getMark();
+	try {
+		Statement *stmt = readStatement(lexer, arena);
+		if (display != NULL) stmt->describe(*display);
+		return stmt;
+	} catch (...) {
+		arena.release(mark);
+		throw;
+	}
+}
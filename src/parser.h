@@ -10,39 +10,54 @@
 #include <string>
 #include "exp.h"
 #include "statement.h"
-#include "tokenscanner.h"
+#include "lexer.h"
 
 /*
  * Function: parseExp
- * Usage: Expression *exp = parseExp(scanner);
- * -------------------------------------------
- * Parses an expression by reading tokens from the scanner, which must
- * be provided by the client.  The scanner should be set to ignore
- * whitespace and to scan numbers.
+ * Usage: Expression *exp = parseExp(lexer, arena);
+ * ------------------------------------------------
+ * Parses an expression by reading tokens from the lexer, which must
+ * be provided by the client.  The nodes of the expression are
+ * allocated from arena, as are those built by the functions below.
  */
 
-Expression *parseExp(TokenScanner & scanner);
+Expression *parseExp(Lexer & lexer, Arena & arena);
 
 /*
  * Function: readE
- * Usage: Expression *exp = readE(scanner, prec);
- * ----------------------------------------------
- * Returns the next expression from the scanner involving only operators
+ * Usage: Expression *exp = readE(lexer, arena, prec);
+ * ---------------------------------------------------
+ * Returns the next expression from the lexer involving only operators
  * whose precedence is at least prec.  The prec argument is optional and
  * defaults to 0, which means that the function reads the entire expression.
  */
 
-Expression *readE(TokenScanner & scanner, int prec = 0);
+Expression *readE(Lexer & lexer, Arena & arena, int prec = 0);
 
 /*
  * Function: readT
- * Usage: Expression *exp = readT(scanner);
- * ----------------------------------------
+ * Usage: Expression *exp = readT(lexer, arena);
+ * ---------------------------------------------
  * Returns the next individual term, which is either a constant, an
- * identifier, or a parenthesized subexpression.
+ * identifier, an array reference, a call of SUM or DOT, or a
+ * parenthesized subexpression.
  */
 
-Expression *readT(TokenScanner & scanner);
+Expression *readT(Lexer & lexer, Arena & arena);
+
+/*
+ * Functions: readArray, readReduction
+ * Usage: Expression *exp = readArray(slot, lexer, arena);
+ *        Expression *exp = readReduction(SUM_KW, lexer, arena);
+ * -------------------------------------------------------------
+ * Read the rest of a term that started with a word followed by an
+ * opening parenthesis, which the lexer is about to return.
+ * readArray reads the subscripts of the array in slot, if any, and
+ * readReduction the arguments of SUM or DOT.
+ */
+
+Expression *readArray(int slot, Lexer & lexer, Arena & arena);
+Expression *readReduction(Keyword keyword, Lexer & lexer, Arena & arena);
 
 /*
  * Function: precedence
@@ -52,17 +67,23 @@ Expression *readT(TokenScanner & scanner);
  * is not an operator, precedence returns 0.
  */
 
-int precedence(std::string token);
+int precedence(const Token & token);
 
 /*
  * Function: parseStatement
- * Usage: Statement *stmt = parseStatement(scanner);
- * -------------------------------------------------
- * Parses a statement by reading tokens from the scanner, which
- * must be provided by the client.  The scanner should be set to 
- * ignore whitespace.
+ * Usage: Statement *stmt = parseStatement(lexer, arena, display);
+ * ---------------------------------------------------------------
+ * Parses a statement by reading tokens from the lexer, which
+ * must be provided by the client.  The returned statement has already been
+ * passed through the expression optimizer.  The statement and
+ * all of its expressions are allocated from arena, usually the
+ * one of the program that will hold it (see Program::getArena).
+ * If display is given, the statement describes itself on it (see
+ * Statement::describe); the display argument is optional and
+ * defaults to NULL, which parses without drawing.
  */
 
-Statement *parseStatement(TokenScanner & scanner);
+Statement *parseStatement(Lexer & lexer, Arena & arena,
+                          Display *display = NULL);
 
 #endif
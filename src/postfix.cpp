@@ -0,0 +1,303 @@
+/*
+ * File: postfix.cpp
+ * -----------------
+ * Implements the postfix.h interface.
+ */
+
+#include <string>
+#include <vector>
+#include "postfix.h"
+#include "arrays.h"
+#include "error.h"
+using namespace std;
+
+/*
+ * Constants
+ * ---------
+ * SMALL_STACK -- Depth of the value stack kept in the frame of
+ *                evalPostfix; deeper expressions use the heap
+ */
+
+static const int SMALL_STACK = 32;
+
+/* Function prototypes */
+
+static void compileNode(Expression *exp, vector<PostfixInstr> & out,
+                        int & depth, int & maxDepth);
+static void emit(vector<PostfixInstr> & out, int op, int slot, double value);
+static void emitPair(vector<PostfixInstr> & out, int op, int slot, int rhsSlot);
+static int operatorOffset(Operator op);
+
+/*
+ * Implementation notes: compilePostfix
+ * ------------------------------------
+ * The instructions are collected in a vector and then copied into
+ * the arena as a single array of the exact size.
+ */
+
+PostfixCode compilePostfix(Expression *exp, Arena & arena) {
+   vector<PostfixInstr> out;
+   int depth = 0;
+   int maxDepth = 0;
+   compileNode(exp, out, depth, maxDepth);
+   PostfixInstr *code = arena.allocateArray<PostfixInstr>(out.size());
+   for (size_t i = 0; i < out.size(); i++) {
+      code[i] = out[i];
+   }
+   PostfixCode result;
+   result.code = code;
+   result.length = out.size();
+   result.maxDepth = maxDepth;
+   return result;
+}
+
+/*
+ * Implementation notes: compileNode
+ * ---------------------------------
+ * A compound node whose operands are a variable and a constant, or
+ * two variables, becomes a single _VC or _VV instruction.  Otherwise
+ * it emits its left operand and then, if the right operand is a leaf,
+ * the _CONST or _VAR form of its operator; only a compound right
+ * operand needs to go through the stack.  Assignment
+ * keeps the semantics of CompoundExp::eval: the right side is
+ * evaluated and stored, and a left side that is not a variable is an
+ * error when the expression runs.  A whole array has no value, so it
+ * is reported here, when the statement is parsed, rather than when
+ * the expression runs.
+ */
+
+static void compileNode(Expression *exp, vector<PostfixInstr> & out,
+                        int & depth, int & maxDepth) {
+   switch (exp->getType()) {
+   case CONSTANT:
+      emit(out, PF_CONST, 0, ((ConstantExp *) exp)->getValue());
+      depth++;
+      break;
+   case IDENTIFIER:
+      emit(out, PF_LOAD, ((IdentifierExp *) exp)->getSlot(), 0);
+      depth++;
+      break;
+   case ARRAY: {
+      ArrayExp *node = (ArrayExp *) exp;
+      int nSubscripts = node->getSubscriptCount();
+      if (nSubscripts == 0) {
+         error("Whole array " + node->toString() + " cannot be used as a number");
+      }
+      for (int i = 0; i < nSubscripts; i++) {
+         compileNode(node->getSubscript(i), out, depth, maxDepth);
+      }
+      emit(out, (nSubscripts == 1) ? PF_ELEM1 : PF_ELEM2, node->getSlot(), 0);
+      if (nSubscripts == 2) depth--;
+      break;
+   }
+   case REDUCTION: {
+      ReductionExp *node = (ReductionExp *) exp;
+      if (node->isDot()) {
+         emitPair(out, PF_DOT, node->getSlot(), node->getRhsSlot());
+      } else {
+         emit(out, PF_SUM, node->getSlot(), 0);
+      }
+      depth++;
+      break;
+   }
+   default: {
+      CompoundExp *node = (CompoundExp *) exp;
+      Expression *lhs = node->getLHS();
+      Expression *rhs = node->getRHS();
+      if (node->getOperator() == ASSIGN_OP) {
+         compileNode(rhs, out, depth, maxDepth);
+         int slot = (lhs->getType() == IDENTIFIER)
+                  ? ((IdentifierExp *) lhs)->getSlot() : -1;
+         emit(out, PF_ASSIGN, slot, 0);
+         break;
+      }
+      int offset = operatorOffset(node->getOperator());
+      if (lhs->getType() == IDENTIFIER
+          && (rhs->getType() == CONSTANT || rhs->getType() == IDENTIFIER)) {
+         int slot = ((IdentifierExp *) lhs)->getSlot();
+         if (rhs->getType() == CONSTANT) {
+            emit(out, PF_ADD_VC + offset, slot, ((ConstantExp *) rhs)->getValue());
+         } else {
+            emitPair(out, PF_ADD_VV + offset, slot, ((IdentifierExp *) rhs)->getSlot());
+         }
+         depth++;
+         break;
+      }
+      compileNode(lhs, out, depth, maxDepth);
+      if (rhs->getType() == CONSTANT) {
+         emit(out, PF_ADD_CONST + offset, 0, ((ConstantExp *) rhs)->getValue());
+      } else if (rhs->getType() == IDENTIFIER) {
+         emit(out, PF_ADD_VAR + offset, ((IdentifierExp *) rhs)->getSlot(), 0);
+      } else {
+         compileNode(rhs, out, depth, maxDepth);
+         emit(out, PF_ADD + offset, 0, 0);
+         depth--;
+      }
+      break;
+   }
+   }
+   if (depth > maxDepth) maxDepth = depth;
+}
+
+static void emit(vector<PostfixInstr> & out, int op, int slot, double value) {
+   PostfixInstr instr;
+   instr.op = op;
+   instr.slot = slot;
+   instr.value = value;
+   out.push_back(instr);
+}
+
+static void emitPair(vector<PostfixInstr> & out, int op, int slot, int rhsSlot) {
+   PostfixInstr instr;
+   instr.op = op;
+   instr.slot = slot;
+   instr.rhsSlot = rhsSlot;
+   out.push_back(instr);
+}
+
+/*
+ * Function: operatorOffset
+ * Usage: int offset = operatorOffset(op);
+ * ---------------------------------------
+ * Returns the position of op within each group of operator opcodes.
+ */
+
+static int operatorOffset(Operator op) {
+   switch (op) {
+   case PLUS_OP: return 0;
+   case MINUS_OP: return 1;
+   case TIMES_OP: return 2;
+   case DIVIDE_OP: return 3;
+   case EQUAL_OP: return 4;
+   case LESS_OP: return 5;
+   case GREATER_OP: return 6;
+   default: break;
+   }
+   error("Illegal operator in expression");
+   return 0;
+}
+
+/*
+ * Implementation notes: evalPostfix
+ * ---------------------------------
+ * The top of the value stack is cached in the local variable acc,
+ * which the compiler keeps in a register; the values below it are
+ * kept in stack, and sp points just past the last of them.  A push
+ * spills acc (on the first push, a meaningless zero) and a binary
+ * operator combines acc with the value it pops.  The _CONST and _VAR
+ * forms therefore never touch memory apart from the variable they
+ * read.  Expressions too deep for the stack in the frame get one
+ * from the heap.
+ */
+
+static void undefinedError(int slot) {
+   error(getVariableName(slot) + " is undefined");
+}
+
+static inline double loadVariable(EvalState & state, int slot) {
+   if (!state.isDefined(slot)) undefinedError(slot);
+   return state.getValue(slot);
+}
+
+static void illegalInstruction() {
+   error("Illegal instruction in postfix code");
+}
+
+static inline double runPostfix(const PostfixCode & code, EvalState & state,
+                                double *stack) {
+   double acc = 0;
+   double *sp = stack;
+   const PostfixInstr *ip = code.code;
+   const PostfixInstr *end = ip + code.length;
+   for (; ip < end; ip++) {
+      switch (ip->op) {
+      case PF_CONST: *sp++ = acc; acc = ip->value; break;
+      case PF_LOAD: *sp++ = acc; acc = loadVariable(state, ip->slot); break;
+      case PF_ASSIGN:
+         if (ip->slot < 0) error("Illegal variable in assignment");
+         state.setValue(ip->slot, acc);
+         break;
+      case PF_ELEM1: acc = *state.getElement(ip->slot, acc); break;
+      case PF_ELEM2: sp--; acc = *state.getElement(ip->slot, *sp, acc); break;
+      case PF_SUM: *sp++ = acc; acc = sumArray(state, ip->slot); break;
+      case PF_DOT: *sp++ = acc; acc = dotArrays(state, ip->slot, ip->rhsSlot); break;
+      case PF_ADD: acc = *--sp + acc; break;
+      case PF_SUB: acc = *--sp - acc; break;
+      case PF_MUL: acc = *--sp * acc; break;
+      case PF_DIV: acc = *--sp / acc; break;
+      case PF_EQ: sp--; acc = (*sp == acc) ? 1 : 0; break;
+      case PF_LT: sp--; acc = (*sp < acc) ? 1 : 0; break;
+      case PF_GT: sp--; acc = (*sp > acc) ? 1 : 0; break;
+      case PF_ADD_CONST: acc += ip->value; break;
+      case PF_SUB_CONST: acc -= ip->value; break;
+      case PF_MUL_CONST: acc *= ip->value; break;
+      case PF_DIV_CONST: acc /= ip->value; break;
+      case PF_EQ_CONST: acc = (acc == ip->value) ? 1 : 0; break;
+      case PF_LT_CONST: acc = (acc < ip->value) ? 1 : 0; break;
+      case PF_GT_CONST: acc = (acc > ip->value) ? 1 : 0; break;
+      case PF_ADD_VAR: acc += loadVariable(state, ip->slot); break;
+      case PF_SUB_VAR: acc -= loadVariable(state, ip->slot); break;
+      case PF_MUL_VAR: acc *= loadVariable(state, ip->slot); break;
+      case PF_DIV_VAR: acc /= loadVariable(state, ip->slot); break;
+      case PF_EQ_VAR: acc = (acc == loadVariable(state, ip->slot)) ? 1 : 0; break;
+      case PF_LT_VAR: acc = (acc < loadVariable(state, ip->slot)) ? 1 : 0; break;
+      case PF_GT_VAR: acc = (acc > loadVariable(state, ip->slot)) ? 1 : 0; break;
+      case PF_ADD_VC: *sp++ = acc; acc = loadVariable(state, ip->slot) + ip->value; break;
+      case PF_SUB_VC: *sp++ = acc; acc = loadVariable(state, ip->slot) - ip->value; break;
+      case PF_MUL_VC: *sp++ = acc; acc = loadVariable(state, ip->slot) * ip->value; break;
+      case PF_DIV_VC: *sp++ = acc; acc = loadVariable(state, ip->slot) / ip->value; break;
+      case PF_EQ_VC:
+         *sp++ = acc;
+         acc = (loadVariable(state, ip->slot) == ip->value) ? 1 : 0;
+         break;
+      case PF_LT_VC:
+         *sp++ = acc;
+         acc = (loadVariable(state, ip->slot) < ip->value) ? 1 : 0;
+         break;
+      case PF_GT_VC:
+         *sp++ = acc;
+         acc = (loadVariable(state, ip->slot) > ip->value) ? 1 : 0;
+         break;
+      case PF_ADD_VV:
+         *sp++ = acc;
+         acc = loadVariable(state, ip->slot) + loadVariable(state, ip->rhsSlot);
+         break;
+      case PF_SUB_VV:
+         *sp++ = acc;
+         acc = loadVariable(state, ip->slot) - loadVariable(state, ip->rhsSlot);
+         break;
+      case PF_MUL_VV:
+         *sp++ = acc;
+         acc = loadVariable(state, ip->slot) * loadVariable(state, ip->rhsSlot);
+         break;
+      case PF_DIV_VV:
+         *sp++ = acc;
+         acc = loadVariable(state, ip->slot) / loadVariable(state, ip->rhsSlot);
+         break;
+      case PF_EQ_VV:
+         *sp++ = acc;
+         acc = (loadVariable(state, ip->slot) == loadVariable(state, ip->rhsSlot)) ? 1 : 0;
+         break;
+      case PF_LT_VV:
+         *sp++ = acc;
+         acc = (loadVariable(state, ip->slot) < loadVariable(state, ip->rhsSlot)) ? 1 : 0;
+         break;
+      case PF_GT_VV:
+         *sp++ = acc;
+         acc = (loadVariable(state, ip->slot) > loadVariable(state, ip->rhsSlot)) ? 1 : 0;
+         break;
+      default:
+         illegalInstruction();
+      }
+   }
+   return acc;
+}
+
+double evalPostfix(const PostfixCode & code, EvalState & state) {
+   if (code.maxDepth <= SMALL_STACK) {
+      double stack[SMALL_STACK];
+      return runPostfix(code, state, stack);
+   }
+   vector<double> stack(code.maxDepth);
+   return runPostfix(code, state, &stack[0]);
+}
@@ -0,0 +1,104 @@
+/*
+ * File: postfix.h
+ * ---------------
+ * This interface exports the flat postfix form of an expression used
+ * by the tree-walking engine.  Instead of following pointers through
+ * a tree of Expression nodes and making a virtual call per node,
+ * every statement translates its optimized expressions once, when it
+ * is parsed, into an array of compact instructions.  evalPostfix runs
+ * that array in a single loop over a small value stack, without
+ * recursion, so the depth of an expression no longer matters to the
+ * C++ call stack at run time.
+ */
+
+#ifndef _postfix_h
+#define _postfix_h
+
+#include "arena.h"
+#include "evalstate.h"
+#include "exp.h"
+
+/*
+ * Type: PostfixOp
+ * ---------------
+ * The postfix instruction set.  PF_CONST and PF_LOAD push a constant
+ * or the value of a variable; the plain operators pop two values and
+ * push the result.  The _CONST and _VAR forms of each operator take
+ * their right operand from the instruction itself, replacing a push
+ * followed by an operator whenever the right operand is a leaf.  The
+ * _VC and _VV forms push the result of applying the operator to a
+ * variable and a constant or to two variables, the commonest shapes
+ * of a whole subexpression.  Comparisons yield 1 when they hold and 0
+ * otherwise, and PF_ASSIGN stores the top of the stack into a
+ * variable and leaves it there.  PF_ELEM1 replaces a subscript, and
+ * PF_ELEM2 a pair of them, by the element of an array they select;
+ * PF_SUM and PF_DOT push the value of SUM or DOT.
+ */
+
+enum PostfixOp {
+   PF_CONST, PF_LOAD, PF_ASSIGN,
+   PF_ELEM1, PF_ELEM2, PF_SUM, PF_DOT,
+   PF_ADD, PF_SUB, PF_MUL, PF_DIV, PF_EQ, PF_LT, PF_GT,
+   PF_ADD_CONST, PF_SUB_CONST, PF_MUL_CONST, PF_DIV_CONST,
+   PF_EQ_CONST, PF_LT_CONST, PF_GT_CONST,
+   PF_ADD_VAR, PF_SUB_VAR, PF_MUL_VAR, PF_DIV_VAR,
+   PF_EQ_VAR, PF_LT_VAR, PF_GT_VAR,
+   PF_ADD_VC, PF_SUB_VC, PF_MUL_VC, PF_DIV_VC,
+   PF_EQ_VC, PF_LT_VC, PF_GT_VC,
+   PF_ADD_VV, PF_SUB_VV, PF_MUL_VV, PF_DIV_VV,
+   PF_EQ_VV, PF_LT_VV, PF_GT_VV
+};
+
+/*
+ * Type: PostfixInstr
+ * ------------------
+ * One instruction: its opcode, the variable slot it reads or writes
+ * and either the constant it uses or, for the _VV forms and PF_DOT,
+ * the slot of its right operand.
+ */
+
+struct PostfixInstr {
+   int op;
+   int slot;
+   union {
+      double value;
+      int rhsSlot;
+   };
+};
+
+/*
+ * Type: PostfixCode
+ * -----------------
+ * A compiled expression: its instructions, which live in the arena of
+ * the owning statement, their number and the deepest value stack they
+ * need.  Statements hold this small record by value.
+ */
+
+struct PostfixCode {
+   const PostfixInstr *code;
+   int length;
+   int maxDepth;
+};
+
+/*
+ * Function: compilePostfix
+ * Usage: PostfixCode code = compilePostfix(exp, arena);
+ * -----------------------------------------------------
+ * Translates exp into postfix instructions allocated from arena.  The
+ * operands are evaluated in the same order as by Expression::eval, so
+ * a reference to an undefined variable is reported for the same name.
+ */
+
+PostfixCode compilePostfix(Expression *exp, Arena & arena);
+
+/*
+ * Function: evalPostfix
+ * Usage: double value = evalPostfix(code, state);
+ * -----------------------------------------------
+ * Evaluates a compiled expression in the context of state and returns
+ * its value, exactly as eval would on the expression it came from.
+ */
+
+double evalPostfix(const PostfixCode & code, EvalState & state);
+
+#endif
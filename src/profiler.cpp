@@ -0,0 +1,213 @@
+/*
+ * File: profiler.cpp
+ * ------------------
+ * Implements the profiler.h interface.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "profiler.h"
+#include "statement.h"
+using namespace std;
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#  define PROFILER_TSC
+#  include <x86intrin.h>
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#  define PROFILER_TSC
+#  include <intrin.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#  define PROFILER_MONOTONIC
+#endif
+
+/*
+ * Implementation notes: ticks
+ * ---------------------------
+ * Each line is timed in ticks of the cheapest clock there is: the
+ * time-stamp counter on x86, read in a few cycles without a system
+ * call, and the monotonic clock in nanoseconds elsewhere.  The rate
+ * of the time-stamp counter is not known in advance, so the whole
+ * run is also timed on the wall clock, and the ticks are converted
+ * to seconds at the rate observed over the run.  The time of a line
+ * includes the two reads of the counter around it, which is what
+ * makes the profile of a very short line somewhat high.
+ */
+
+static unsigned long long readTicks() {
+#if defined(PROFILER_TSC)
+   return __rdtsc();
+#elif defined(PROFILER_MONOTONIC)
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (unsigned long long) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+#else
+   return clock();
+#endif
+}
+
+static double wallSeconds() {
+#ifdef PROFILER_MONOTONIC
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ts.tv_sec + ts.tv_nsec * 1e-9;
+#else
+   return (double) clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+/*
+ * Function: statementText
+ * Usage: string text = statementText(program.getSourceLine(lineNumber));
+ * ----------------------------------------------------------------------
+ * Returns a source line without its line number.
+ */
+
+static string statementText(const string & line) {
+   size_t start = 0;
+   while (start < line.length() && isdigit(line[start])) start++;
+   while (start < line.length() && isspace(line[start])) start++;
+   return line.substr(start);
+}
+
+Profiler::Profiler() {
+   totalCount = 0;
+   totalSeconds = 0;
+}
+
+/*
+ * Implementation notes: run
+ * -------------------------
+ * The loop is the one of runHeadless with the counter read around
+ * every statement.  The counts and ticks are kept in arrays indexed
+ * by the position Program::link gives each statement, so that
+ * recording a line costs two increments and no lookup.
+ */
+
+void Profiler::run(Program & program, EvalState & state) {
+   lines.clear();
+   totalCount = 0;
+   totalSeconds = 0;
+   program.link();
+   program.clearHiddenVariables(state);
+   int size = 0;
+   for (Statement *stmt = program.getFirstStatement(); stmt != NULL;
+        stmt = stmt->getSuccessor()) {
+      size++;
+   }
+   vector<long> counts(size, 0);
+   vector<unsigned long long> ticks(size, 0);
+   double startSeconds = wallSeconds();
+   unsigned long long startTicks = readTicks();
+   Statement *stmt = program.getFirstStatement();
+   try {
+      while (stmt != NULL) {
+         int index = stmt->getIndex();
+         state.setNextStatement(stmt->getSuccessor());
+         unsigned long long before = readTicks();
+         stmt->execute(state);
+         ticks[index] += readTicks() - before;
+         counts[index]++;
+         stmt = state.getNextStatement();
+      }
+   } catch (...) {
+      if (stmt != NULL) counts[stmt->getIndex()]++;
+      double elapsed = wallSeconds() - startSeconds;
+      unsigned long long total = readTicks() - startTicks;
+      collect(program, counts, ticks, (total == 0) ? 0 : elapsed / total);
+      throw;
+   }
+   double elapsed = wallSeconds() - startSeconds;
+   unsigned long long total = readTicks() - startTicks;
+   collect(program, counts, ticks, (total == 0) ? 0 : elapsed / total);
+}
+
+void Profiler::collect(Program & program, const vector<long> & counts,
+                       const vector<unsigned long long> & ticks,
+                       double secondsPerTick) {
+   for (Statement *stmt = program.getFirstStatement(); stmt != NULL;
+        stmt = stmt->getSuccessor()) {
+      int index = stmt->getIndex();
+      if (counts[index] == 0) continue;
+      LineProfile line;
+      line.lineNumber = stmt->getLineNumber();
+      line.text = statementText(program.getSourceLine(line.lineNumber));
+      line.count = counts[index];
+      line.seconds = ticks[index] * secondsPerTick;
+      lines.push_back(line);
+      totalCount += line.count;
+      totalSeconds += line.seconds;
+   }
+}
+
+namespace {
+
+struct ByTime {
+   template <typename T>
+   bool operator()(const T & a, const T & b) const {
+      if (a.seconds != b.seconds) return a.seconds > b.seconds;
+      return a.lineNumber < b.lineNumber;
+   }
+};
+
+}
+
+void Profiler::printReport(ostream & out, int maxLines) {
+   vector<LineProfile> sorted = lines;
+   stable_sort(sorted.begin(), sorted.end(), ByTime());
+   if ((int) sorted.size() > maxLines) sorted.resize(maxLines);
+   char buffer[80];
+   out << "   Line        Count     Time ms   % Time  Statement" << endl;
+   for (size_t i = 0; i < sorted.size(); i++) {
+      double share = (totalSeconds > 0) ? 100 * sorted[i].seconds / totalSeconds : 0;
+      sprintf(buffer, "%7d %12ld %11.3f %7.1f%%  ", sorted[i].lineNumber,
+              sorted[i].count, sorted[i].seconds * 1000, share);
+      out << buffer << sorted[i].text << endl;
+   }
+   if (lines.size() > sorted.size()) {
+      out << "   (" << lines.size() - sorted.size() << " more lines)" << endl;
+   }
+   sprintf(buffer, "  Total %12ld %11.3f", totalCount, totalSeconds * 1000);
+   out << buffer << endl;
+}
+
+/*
+ * Implementation notes: writeCsv, writeFolded
+ * -------------------------------------------
+ * The statement text is quoted in CSV with any quote doubled.  In the
+ * folded format a semicolon separates frames and the last space
+ * separates the value, so semicolons in the text become commas; the
+ * spaces are kept, since only the last one counts.
+ */
+
+void Profiler::writeCsv(ostream & out) {
+   char buffer[80];
+   out << "line,count,seconds,statement" << endl;
+   for (size_t i = 0; i < lines.size(); i++) {
+      sprintf(buffer, "%d,%ld,%.9f,", lines[i].lineNumber, lines[i].count,
+              lines[i].seconds);
+      string text = lines[i].text;
+      string quoted = "\"";
+      for (size_t k = 0; k < text.length(); k++) {
+         if (text[k] == '"') quoted += '"';
+         quoted += text[k];
+      }
+      out << buffer << quoted << "\"" << endl;
+   }
+}
+
+void Profiler::writeFolded(ostream & out) {
+   for (size_t i = 0; i < lines.size(); i++) {
+      string text = lines[i].text;
+      replace(text.begin(), text.end(), ';', ',');
+      long micros = (long) (lines[i].seconds * 1e6 + 0.5);
+      out << "program;" << lines[i].lineNumber << " " << text << " "
+          << micros << endl;
+   }
+}
@@ -0,0 +1,107 @@
+/*
+ * File: profiler.h
+ * ----------------
+ * This interface exports the line profiler behind the PROFILE
+ * command.  The profiler runs a program on the tree-walking engine
+ * with a loop of its own that counts how often every line executes
+ * and adds up the time spent in it, read from the cycle counter of
+ * the processor where there is one.  The ordinary run loops contain
+ * no profiling code at all, so a program that is not being profiled
+ * pays nothing for the profiler.
+ */
+
+#ifndef _profiler_h
+#define _profiler_h
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+#include "program.h"
+#include "evalstate.h"
+
+/*
+ * Class: Profiler
+ * ---------------
+ * Holds the profile of the last program it ran.
+ */
+
+class Profiler {
+
+public:
+
+/*
+ * Constructor: Profiler
+ * Usage: Profiler profiler;
+ * -------------------------
+ * Creates a profiler with an empty profile.
+ */
+
+   Profiler();
+
+/*
+ * Method: run
+ * Usage: profiler.run(program, state);
+ * ------------------------------------
+ * Links and runs program in state on the tree-walking engine,
+ * replacing the profile with one of this run.  If the program stops
+ * on an error, the profile of the lines executed until then is kept
+ * and the error is passed on.  The time of a line includes any
+ * output it writes and, for INPUT, the wait for the user.
+ */
+
+   void run(Program & program, EvalState & state);
+
+/*
+ * Method: printReport
+ * Usage: profiler.printReport(out, maxLines);
+ * -------------------------------------------
+ * Writes a table of the maxLines lines that took the most time, with
+ * their execution counts, their time and their share of the total,
+ * followed by the totals of the run.
+ */
+
+   void printReport(std::ostream & out, int maxLines);
+
+/*
+ * Method: writeCsv
+ * Usage: profiler.writeCsv(out);
+ * ------------------------------
+ * Writes the profile of every line that executed as CSV, one line of
+ * the program per record, in line order.  Times are in seconds.
+ */
+
+   void writeCsv(std::ostream & out);
+
+/*
+ * Method: writeFolded
+ * Usage: profiler.writeFolded(out);
+ * ---------------------------------
+ * Writes the profile in the folded-stack format read by flame graph
+ * tools: one record per line that executed, with the stack "program"
+ * followed by the line and its statement, and the time in
+ * microseconds as the value.  BASIC has no subroutines, so every
+ * stack is two frames deep.
+ */
+
+   void writeFolded(std::ostream & out);
+
+private:
+
+   struct LineProfile {
+      int lineNumber;
+      std::string text;
+      long count;
+      double seconds;
+   };
+
+   std::vector<LineProfile> lines;
+   long totalCount;
+   double totalSeconds;
+
+   void collect(Program & program, const std::vector<long> & counts,
+                const std::vector<unsigned long long> & ticks,
+                double secondsPerTick);
+
+};
+
+#endif
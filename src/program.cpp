@@ -4,11 +4,21 @@
  * Implements the program.h interface.
  */
 
+#include <algorithm>
 #include <iostream>
 #include "program.h"
-#include "hashmap.h"
+#include "parser.h"
+#include "error.h"
 using namespace std;
 
+/*
+ * Constants
+ * ---------
+ * MIN_DROPPED_LINES -- Dropped statements the arena may always hold
+ */
+
+static const int MIN_DROPPED_LINES = 256;
+
 /*
  * Implementation: Program
  * --------------------------
@@ -16,13 +26,14 @@ using namespace std;
  */
 
 Program::Program() {
-	firstLineNum = -1;
+	linked = false;
+	droppedLines = 0;
 }
 
 /*
  * Implementation: ~Program
  * --------------------------
- * Frees any heap storage associated with the program.
+ * The arena frees the parsed statements when it is destroyed.
  */
 
 Program::~Program() {
@@ -32,20 +43,25 @@ Program::~Program() {
 /*
  * Implementation: clear
  * -----------------------
- * Removes all lines from the program.
+ * Removes all lines from the program. Nodes in the arena own no
+ * other storage, so the statements need no destructor calls.
  */
 
 void Program::clear() {
-	int index = firstLineNum;
-	while(map.size() > 0){
-		if(map[index]->next == NULL) break;
-		int nextIndex = map[index]->next->lineNum;
-		delete map[index];
-		index = nextIndex;
-	}
-	delete map[index];
-	map.clear();
-	firstLineNum = -1;
+	lines.clear();
+	arena.clear();
+	linked = false;
+	droppedLines = 0;
+}
+
+/*
+ * Implementation: getArena
+ * -----------------------
+ * Returns the arena that holds the parsed statements.
+ */
+
+Arena & Program::getArena() {
+	return arena;
 }
 
 /*
@@ -54,30 +70,99 @@ void Program::clear() {
  * Adds a source line to the program with the specified line number.
  * If that line already exists, the text of the line replaces
  * the text of any existing line and the parsed representation
- * (if any) is deleted.  If the line is new, it is added to the
+ * (if any) is dropped.  If the line is new, it is added to the
  * program in the correct sequence.
  */
 
 void Program::addSourceLine(int lineNumber, string line) {
-	if (firstLineNum == -1) firstLineNum = lineNumber;
-	Entry *temp = insertEntry(lineNumber, line);
-	int prevLineNumber = findPrevLine(lineNumber);
-	connectEntry(lineNumber, prevLineNumber, temp);
-	//print();
+	map<int, Entry>::iterator it = lines.lower_bound(lineNumber);
+	if (it == lines.end() || it->first != lineNumber) {
+		Entry entry;
+		entry.stmt = NULL;
+		it = lines.insert(it, make_pair(lineNumber, entry));
+	} else {
+		dropStatement(it->second);
+	}
+	it->second.command = line;
+	linked = false;
+}
+
+/*
+ * Implementation: addSourceLines
+ * -----------------------------------------------
+ * Sorts an array of indices into the batch by line number and then
+ * by position, so the lines themselves are never copied, and skips
+ * every line followed by one with the same number.  Walking the
+ * sorted lines, a line past the end of the program is appended with
+ * end() as the insertion hint; any other line is found with
+ * lower_bound.
+ */
+
+struct BatchOrder {
+	const vector<SourceLine> *batch;
+	bool operator()(int a, int b) const {
+		int lineA = (*batch)[a].lineNumber;
+		int lineB = (*batch)[b].lineNumber;
+		return (lineA != lineB) ? lineA < lineB : a < b;
+	}
+};
+
+void Program::addSourceLines(vector<SourceLine> & batch) {
+	vector<int> order(batch.size());
+	for (size_t i = 0; i < batch.size(); i++) {
+		order[i] = i;
+	}
+	BatchOrder less;
+	less.batch = &batch;
+	sort(order.begin(), order.end(), less);
+	for (size_t k = 0; k < order.size(); k++) {
+		SourceLine & line = batch[order[k]];
+		if (k + 1 < order.size() && batch[order[k + 1]].lineNumber == line.lineNumber) {
+			if (line.stmt != NULL) droppedLines++;
+			continue;
+		}
+		if (line.stmt == NULL) {
+			map<int, Entry>::iterator old = lines.find(line.lineNumber);
+			if (old != lines.end()) {
+				dropStatement(old->second);
+				lines.erase(old);
+			}
+			continue;
+		}
+		map<int, Entry>::iterator it = lines.end();
+		if (!lines.empty() && line.lineNumber <= lines.rbegin()->first) {
+			it = lines.lower_bound(line.lineNumber);
+		}
+		if (it == lines.end() || it->first != line.lineNumber) {
+			Entry entry;
+			entry.stmt = NULL;
+			it = lines.insert(it, make_pair(line.lineNumber, entry));
+		} else {
+			dropStatement(it->second);
+		}
+		it->second.command.swap(line.text);
+		it->second.stmt = line.stmt;
+	}
+	batch.clear();
+	linked = false;
+	reclaimArena();
 }
 
 /*
  * Implementation: removeSourceLine
  * --------------------------------------------
- * Removes the line with the specified number from the program,
- * freeing the memory associated with any parsed representation.
+ * Removes the line with the specified number from the program.
  * If no such line exists, this method simply returns without
  * performing any action.
  */
 
 void Program::removeSourceLine(int lineNumber) {
-	if(map.containsKey(lineNumber)) removeEntry(lineNumber);
-	//print();
+	map<int, Entry>::iterator it = lines.find(lineNumber);
+	if (it == lines.end()) return;
+	dropStatement(it->second);
+	lines.erase(it);
+	linked = false;
+	reclaimArena();
 }
 
 /*
@@ -88,8 +173,8 @@ void Program::removeSourceLine(int lineNumber) {
  */
 
 string Program::getSourceLine(int lineNumber) {
-   if(map.containsKey(lineNumber)) return map[lineNumber]->command;
-   return "";
+	Entry *entry = findEntry(lineNumber);
+	return (entry == NULL) ? "" : entry->command;
 }
 
 /*
@@ -97,16 +182,19 @@ string Program::getSourceLine(int lineNumber) {
  * ----------------------------------------------------
  * Adds the parsed representation of the statement to the statement
  * at the specified line number.  If no such line exists, this
- * method raises an error.  If a previous parsed representation
- * exists, the memory for that statement is reclaimed.
+ * method raises an error.  Any previous parsed representation is
+ * dropped.
  */
 
 void Program::setParsedStatement(int lineNumber, Statement *stmt) {
-	if(map.containsKey(lineNumber)) {
-		map[lineNumber]->stmt = stmt;
-	} else {
+	Entry *entry = findEntry(lineNumber);
+	if (entry == NULL) {
 		error ("Invalid like number" + integerToString(lineNumber));
 	}
+	dropStatement(*entry);
+	entry->stmt = stmt;
+	linked = false;
+	reclaimArena();
 }
 
 /*
@@ -118,12 +206,11 @@ void Program::setParsedStatement(int lineNumber, Statement *stmt) {
  */
 
 Statement *Program::getParsedStatement(int lineNumber) {
-	if(map.containsKey(lineNumber)) {
-		return map[lineNumber]->stmt;
-	} else {
+	Entry *entry = findEntry(lineNumber);
+	if (entry == NULL) {
 		error("Invalid line number: " + integerToString(lineNumber));
 	}
-   return NULL;
+	return entry->stmt;
 }
 
 /*
@@ -134,133 +221,153 @@ Statement *Program::getParsedStatement(int lineNumber) {
  */
 
 int Program::getFirstLineNumber() {
-   if(!map.isEmpty()) return firstLineNum;
-   return -1;
+	if (lines.empty()) return -1;
+	return lines.begin()->first;
 }
 
 /*
  * Impletementation: getNextLineNumber
  * ------------------------------------------------------------
  * Returns the line number of the first line in the program whose
- * number is larger than the specified one, which must already exist
- * in the program.  If no more lines remain, this method returns -1.
+ * number is larger than the specified one.  If no more lines remain,
+ * this method returns -1.
  */
 
 int Program::getNextLineNumber(int lineNumber) {
-   if(!map.containsKey(lineNumber)) {
-	 int prevLineNumber = findPrevLine(lineNumber);
-	 if (prevLineNumber == 0) return map[firstLineNum]->lineNum;
-	 if(map[prevLineNumber]->next != NULL) {
-		 return map[prevLineNumber]->next->lineNum;
-	 }
-	 return -1;
-   }
-   if(map[lineNumber]->next != NULL) return map[lineNumber]->next->lineNum;
-   return -1;
+	map<int, Entry>::iterator it = lines.upper_bound(lineNumber);
+	if (it == lines.end()) return -1;
+	return it->first;
 }
 
+/*
+ * Implementation: getPreviousLineNumber
+ * ------------------------------------------------------------
+ * Returns the line number of the last line in the program whose
+ * number is smaller than the specified one, or -1.
+ */
 
-/*--PRIVATE METHODS--*/
+int Program::getPreviousLineNumber(int lineNumber) {
+	map<int, Entry>::iterator it = lines.lower_bound(lineNumber);
+	if (it == lines.begin()) return -1;
+	--it;
+	return it->first;
+}
 
 /*
- * Function: insertEntry
- * Usage: Entry *temp = insertEntry(lineNumber, line);
- * ------------------------------------------------------
- * Receives a line number followed by a line of code.
- * Generates a corresponding Entry object and inserts it
- * into the map that stores the whole sorted program.
+ * Implementation: link
+ * ------------------------------------------------------------
+ * Walks the lines in order twice: the first pass records each
+ * statement's line number, index and successor, and the second lets
+ * IF and GOTO statements resolve their targets, which may lie
+ * anywhere in the program, and pairs up the loop statements through
+ * openLoops.  A loop still open at the end has no closing statement.
  */
-Program::Entry *Program::insertEntry(int lineNumber, string line) {
-	Entry *temp = new Entry;
-	temp->lineNum = lineNumber;
-	temp->command = line;
-	temp->stmt = NULL;
-	if(!map.containsKey(lineNumber)) {
-		temp->next = NULL;
-	} else {
-		temp->next = map[lineNumber]->next;
+
+void Program::link() {
+	if (linked || lines.empty()) return;
+	map<int, Entry>::iterator it = lines.begin();
+	int index = 0;
+	while (it != lines.end()) {
+		map<int, Entry>::iterator next = it;
+		++next;
+		Statement *successor = (next == lines.end()) ? NULL : next->second.stmt;
+		it->second.stmt->setSuccessor(it->first, index++, successor);
+		it = next;
+	}
+	openLoops.clear();
+	hiddenSlots.clear();
+	for (it = lines.begin(); it != lines.end(); ++it) {
+		it->second.stmt->link(*this);
 	}
-	map[lineNumber] = temp;
-	return temp;
+	if (!openLoops.empty()) {
+		Loop & loop = openLoops.back();
+		error(loop.kind + " on line " 
+			+ integerToString(loop.stmt->getLineNumber()) + " has no " 
+			+ loop.closer);
+	}
+	linked = true;
 }
-	
+
 /*
- * Function: findPrevLine
- * Usage: int prevLineNumber = findPrevLine(lineNumber);
- * ------------------------------------------------------
- * Returns the line number index that comes right before
- * the given line number in the map.
+ * Implementation: openLoop, closeLoop
+ * ------------------------------------------------------------
+ * The open loops form a stack, so loops must nest: a NEXT inside
+ * a WHILE that is still open does not reach past it to a FOR.
  */
-int Program::findPrevLine(int lineNumber){
-	for(int i = lineNumber-1; i >= 0; i--){
-		if(map.containsKey(i)) return i;
+
+void Program::openLoop(Statement *stmt, string kind, string closer) {
+	Loop loop;
+	loop.kind = kind;
+	loop.closer = closer;
+	loop.stmt = stmt;
+	openLoops.push_back(loop);
+}
+
+Statement *Program::closeLoop(string kind, string closer, int lineNumber) {
+	if (openLoops.empty()) {
+		error(closer + " without " + kind + " on line " 
+			+ integerToString(lineNumber));
+	}
+	Loop loop = openLoops.back();
+	if (loop.kind != kind) {
+		error(closer + " on line " + integerToString(lineNumber) 
+			+ " does not match the " + loop.kind + " on line " 
+			+ integerToString(loop.stmt->getLineNumber()));
 	}
-	return -1;
+	openLoops.pop_back();
+	return loop.stmt;
 }
 
 /*
- * Function: connectEntry
- * Usage: connectEntry(lineNumber, prevLineNumber, temp);
- * ------------------------------------------------------
- * Inserts an entry into the existing map, and ensures that
- * all pointers point to elements in ascending order of 
- * line numbers.
+ * Implementation: addHiddenVariable, getHiddenVariables,
+ *                 clearHiddenVariables
+ * ------------------------------------------------------------
+ * link starts the list afresh, so it holds exactly the hidden
+ * variables of the statements in the linked program.
  */
-void Program::connectEntry(int lineNumber, int prevLineNumber, Entry *temp) {
-	if (lineNumber < firstLineNum){
-		map[lineNumber]->next = map[firstLineNum];
-		firstLineNum = lineNumber;
-	} else {
-		insertInBetween(lineNumber, prevLineNumber, temp);
+
+int Program::addHiddenVariable(string name) {
+	int slot = getVariableSlot(name);
+	hiddenSlots.push_back(slot);
+	return slot;
+}
+
+const vector<int> & Program::getHiddenVariables() {
+	return hiddenSlots;
+}
+
+void Program::clearHiddenVariables(EvalState & state) {
+	for (size_t i = 0; i < hiddenSlots.size(); i++) {
+		state.clearValue(hiddenSlots[i]);
 	}
 }
 
 /*
- * Function: insertInBetween
- * Usage: insertInBetween(lineNumber, prevLineNumber, temp);
- * ---------------------------------------------------------
- * Inserts an entry "temp" between two already existing 
- * entries at line number "lineNumber".
- * Ensures the entry right before this new entry points to 
- * it and the new entry in turn points to the entry right
- * after it.
+ * Implementation: getFirstStatement
+ * -----------------------------------------------------
+ * Returns the statement on the first line of the program, or NULL
+ * if the program is empty.
  */
-void Program::insertInBetween(int lineNumber, int prevLineNumber, Entry *temp) {
-	if(lineNumber > firstLineNum) {
-		if(map[prevLineNumber]->next != NULL) {
-			Entry *store = new Entry;
-			store = map[prevLineNumber]->next;
-			if(map[prevLineNumber]->next->lineNum != 
-				map[lineNumber]->lineNum) map[lineNumber]->next = store;
-		}
-		map[prevLineNumber]->next = temp;
-	} 
+
+Statement *Program::getFirstStatement() {
+	if (lines.empty()) return NULL;
+	return lines.begin()->second.stmt;
 }
 
+
+/*--PRIVATE METHODS--*/
+
 /*
- * Function: removeEntry
- * Usage: removeEntry(lineNumber);
+ * Function: findEntry
+ * Usage: Entry *entry = findEntry(lineNumber);
  * ------------------------------------------------------
- * Removes entry corresponding to received line number from map.
- * Ensures that the entry originally before now points to the
- * entry that was originally after it, thereby mainiting program
- * execution chain.
+ * Returns the entry stored for the given line number, or
+ * NULL if there is no such line.
  */
-void Program::removeEntry(int lineNumber){
-	if(lineNumber != firstLineNum){
-		int lastIndex;
-		for(int i = lineNumber-1; i >= 0; i--){
-			if(map.containsKey(i) && map[i]->next != NULL){
-				if (map[i]->next->lineNum == lineNumber) lastIndex = i;
-			}
-		}
-		map[lastIndex]->next = map[lineNumber]->next;
-	} else {
-		if(map.size() != 1) firstLineNum = map[lineNumber]->next->lineNum;
-	}
-	delete map[lineNumber]->stmt;
-	delete map[lineNumber];
-	map.remove(lineNumber);	
+Program::Entry *Program::findEntry(int lineNumber) {
+	map<int, Entry>::iterator it = lines.find(lineNumber);
+	if (it == lines.end()) return NULL;
+	return &it->second;
 }
 
 /*
@@ -272,12 +379,55 @@ void Program::removeEntry(int lineNumber){
  * Useful for debugging.
  */
 void Program::print(){
-	int index = firstLineNum;
-	while(map.size() > 0){
-		cout <<  "this: " << integerToString(map[index]->lineNum);
-		if(map[index]->next == NULL) break;
-		cout << " -> next: " << integerToString(map[index]->next->lineNum) << endl;
-		index = map[index]->next->lineNum;
+	for (map<int, Entry>::iterator it = lines.begin(); it != lines.end(); ++it) {
+		cout << "this: " << integerToString(it->first);
+		int next = getNextLineNumber(it->first);
+		if (next == -1) break;
+		cout << " -> next: " << integerToString(next) << endl;
 	}
 	cout << endl;
-}
\ No newline at end of file
+}
+
+/*
+ * Implementation notes: dropStatement, reclaimArena
+ * ------------------------------------------------------------
+ * dropStatement forgets the statement of a line and counts it as
+ * dropped.  Once the dropped statements outnumber the lines of the
+ * program, reclaimArena parses every line again from its text into
+ * a fresh arena, which takes time proportional to the lines, and
+ * frees the old arena with the dropped statements in it.  Since at
+ * least as many lines were dropped since the last rebuild, the cost
+ * per dropped line is constant.  The new statements replace the old
+ * ones only once every line has parsed, which it did before.
+ */
+
+void Program::dropStatement(Entry & entry) {
+	if (entry.stmt != NULL) droppedLines++;
+	entry.stmt = NULL;
+}
+
+void Program::reclaimArena() {
+	if (droppedLines < MIN_DROPPED_LINES || droppedLines <= (int) lines.size()) {
+		return;
+	}
+	Arena fresh;
+	Lexer lexer;
+	vector<Statement *> stmts;
+	map<int, Entry>::iterator it;
+	for (it = lines.begin(); it != lines.end(); ++it) {
+		Statement *stmt = NULL;
+		if (it->second.stmt != NULL) {
+			lexer.setInput(it->second.command);
+			if (lexer.peekToken().kind == NUMBER_TOKEN) lexer.nextToken();
+			stmt = parseStatement(lexer, fresh);
+		}
+		stmts.push_back(stmt);
+	}
+	int i = 0;
+	for (it = lines.begin(); it != lines.end(); ++it) {
+		it->second.stmt = stmts[i++];
+	}
+	arena.swap(fresh);
+	droppedLines = 0;
+	linked = false;
+}
@@ -8,16 +8,20 @@
 #ifndef _program_h
 #define _program_h
 
+#include <map>
 #include <string>
+#include <vector>
 #include "statement.h"
-#include "hashmap.h"
 #include "strlib.h"
 #include "foreach.h"
 using namespace std;
 
 /*
  * This class stores the lines in a BASIC program.  Each line
- * in the program is stored in order according to its line number.
+ * in the program is stored in order according to its line number,
+ * in a balanced tree, so that adding, removing and finding a line
+ * and stepping to the next or previous line all take O(log n) time
+ * however sparse the line numbers are.
  * Moreover, each line in the program is associated with two
  * components:
  *
@@ -26,8 +30,31 @@ using namespace std;
  *
  * 2. The parsed representation of that statement, which is a
  *    pointer to a Statement.
+ *
+ * The statements and their expressions are allocated from an arena
+ * owned by the program (see getArena), and clearing the program
+ * releases every node at once.  A statement that is replaced or
+ * removed stays in the arena only until as many lines have been
+ * dropped as the program holds; the program then parses its lines
+ * again into a fresh arena and frees the old one.  Editing a line
+ * thus costs amortized constant time, and the arena never holds
+ * many more statements than twice the lines of the program.
  */
 
+/*
+ * Type: SourceLine
+ * ----------------
+ * One parsed line of a program being loaded in bulk: its number, its
+ * complete text and its parsed statement.  A NULL statement stands
+ * for a line holding only a number, which removes that line.
+ */
+
+struct SourceLine {
+   int lineNumber;
+   std::string text;
+   Statement *stmt;
+};
+
 class Program {
    
 public:
@@ -54,11 +81,26 @@ public:
  * Method: clear
  * Usage: program.clear();
  * -----------------------
- * Removes all lines from the program.
+ * Removes all lines from the program and releases its arena without
+ * visiting the statements one by one.
  */
    
    void clear();
 
+/*
+ * Method: getArena
+ * Usage: Statement *stmt = parseStatement(scanner, program.getArena());
+ * ---------------------------------------------------------------------
+ * Returns the arena from which the statements of this program must be
+ * allocated.  Statements passed to setParsedStatement or
+ * addSourceLines have to come from it.  Those two methods and
+ * removeSourceLine may move every statement to a fresh arena, so a
+ * statement parsed but not yet handed to the program must not be
+ * kept across a call to them.
+ */
+
+   Arena & getArena();
+
 /*
  * Method: addSourceLine
  * Usage: program.addSourceLine(lineNumber, line);
@@ -66,18 +108,32 @@ public:
  * Adds a source line to the program with the specified line number.
  * If that line already exists, the text of the line replaces
  * the text of any existing line and the parsed representation
- * (if any) is deleted.  If the line is new, it is added to the
+ * (if any) is dropped.  If the line is new, it is added to the
  * program in the correct sequence.
  */
    
    void addSourceLine(int lineNumber, std::string line);
    
+/*
+ * Method: addSourceLines
+ * Usage: program.addSourceLines(batch);
+ * -------------------------------------
+ * Adds or removes every line in batch, in any order, with the same
+ * result as passing each line in turn to addSourceLine and
+ * setParsedStatement (or removeSourceLine): where several lines share
+ * a number, the last one wins.  The batch is sorted once and lines
+ * beyond the current end of the program are appended in constant
+ * time.  The statements must come from the arena of the program, and
+ * batch is left empty.
+ */
+
+   void addSourceLines(std::vector<SourceLine> & batch);
+
 /*
  * Method: removeSourceLine
  * Usage: program.removeSourceLine(lineNumber);
  * --------------------------------------------
- * Removes the line with the specified number from the program,
- * freeing the memory associated with any parsed representation.
+ * Removes the line with the specified number from the program.
  * If no such line exists, this method simply returns without
  * performing any action.
  */
@@ -100,8 +156,8 @@ public:
  * ----------------------------------------------------
  * Adds the parsed representation of the statement to the statement
  * at the specified line number.  If no such line exists, this
- * method raises an error.  If a previous parsed representation
- * exists, the memory for that statement is reclaimed.
+ * method raises an error.  Any previous parsed representation is
+ * dropped.
  */
    
    void setParsedStatement(int lineNumber, Statement *stmt);
@@ -132,11 +188,88 @@ public:
  * Usage: int nextLine = program.getNextLineNumber(lineNumber);
  * ------------------------------------------------------------
  * Returns the line number of the first line in the program whose
- * number is larger than the specified one, which must already exist
- * in the program.  If no more lines remain, this method returns -1.
+ * number is larger than the specified one, which need not exist in
+ * the program.  If no more lines remain, this method returns -1.
+ * Calling it with start - 1 therefore finds the first line of a
+ * range such as LIST 50-80.
  */
    
    int getNextLineNumber(int lineNumber);
+
+/*
+ * Method: getPreviousLineNumber
+ * Usage: int prevLine = program.getPreviousLineNumber(lineNumber);
+ * ----------------------------------------------------------------
+ * Returns the line number of the last line in the program whose
+ * number is smaller than the specified one, or -1 if there is none.
+ */
+
+   int getPreviousLineNumber(int lineNumber);
+
+/*
+ * Method: link
+ * Usage: program.link();
+ * ----------------------
+ * Resolves the program into a chain of directly linked statements:
+ * every statement learns its line number, its position in the
+ * program and its fall-through successor, every IF and GOTO
+ * resolves its target line to a statement pointer, and every NEXT
+ * and WEND finds the FOR or WHILE it closes.  Raises an error naming
+ * the offending line if any target does not exist or a loop is not
+ * properly nested.  The work
+ * is redone only if the program has changed since the last call, so
+ * it is cheap to call before every run.
+ */
+
+   void link();
+
+/*
+ * Methods: openLoop, closeLoop
+ * Usage: program.openLoop(stmt, "FOR", "NEXT");
+ *        Statement *header = program.closeLoop("FOR", "NEXT", lineNumber);
+ * ----------------------------------------------------------------------
+ * Pair the statements that open and close a loop while link visits
+ * the lines in order.  openLoop makes stmt the innermost open loop,
+ * to be closed by the statement named closer.  closeLoop, called from
+ * the closing statement on the given line, returns the statement
+ * that opened the innermost loop and closes it, raising an error if
+ * no loop is open or the innermost one is not of the given kind.
+ * Only the link methods of statements call these.
+ */
+
+   void openLoop(Statement *stmt, std::string kind, std::string closer);
+   Statement *closeLoop(std::string kind, std::string closer, int lineNumber);
+
+/*
+ * Methods: addHiddenVariable, getHiddenVariables, clearHiddenVariables
+ * Usage: limitSlot = program.addHiddenVariable("FOR 20 TO");
+ *        program.clearHiddenVariables(state);
+ * ----------------------------------------------------------------------
+ * Keep track of the hidden variables, such as the limit of a FOR
+ * loop, that statements set up for themselves while link visits the
+ * lines.  addHiddenVariable returns the slot of the variable with the
+ * given name, which must not be a valid BASIC name, and records it.
+ * Every run has to start with these variables undefined, or a NEXT
+ * reached before its FOR would pick up a limit left over from an
+ * earlier run in the same state.  The tree-walking engine therefore
+ * calls clearHiddenVariables before each run, and compiled code
+ * starts by clearing the slots returned by getHiddenVariables.
+ */
+
+   int addHiddenVariable(std::string name);
+   const std::vector<int> & getHiddenVariables();
+   void clearHiddenVariables(EvalState & state);
+
+/*
+ * Method: getFirstStatement
+ * Usage: Statement *stmt = program.getFirstStatement();
+ * -----------------------------------------------------
+ * Returns the statement on the first line of the program, or NULL
+ * if the program is empty.  Following getSuccessor from here visits
+ * the program in line order; the links are valid only after link.
+ */
+
+   Statement *getFirstStatement();
    
 #include "programpriv.h"
    
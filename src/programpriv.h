@@ -8,18 +8,23 @@ private:
 
 	/* Instance variables */
 	struct Entry{
-		int lineNum;
 		string command;
 		Statement *stmt;
-		Entry *next;
 	};
-	HashMap<int, Entry*> map;
-	int firstLineNum;
+	struct Loop{
+		string kind;
+		string closer;
+		Statement *stmt;
+	};
+	std::map<int, Entry> lines;		// Ordered by line number
+	Arena arena;					// Holds every Statement and Expression
+	std::vector<Loop> openLoops;	// Innermost last, only during link
+	std::vector<int> hiddenSlots;	// Recorded by addHiddenVariable
+	bool linked;
+	int droppedLines;				// Statements left in the arena
 
 	/* Function prototypes */
-	Entry *insertEntry(int lineNumber, string line);
-	int findPrevLine(int lineNumber);
-	void connectEntry(int lineNumber, int prevLineNumber, Entry *temp);
-	void insertInBetween(int lineNumber, int prevLineNumber, Entry *temp);
-	void removeEntry(int lineNumber);
+	Entry *findEntry(int lineNumber);
+	void dropStatement(Entry & entry);
+	void reclaimArena();
 	void print();
@@ -0,0 +1,312 @@
+/*
+ * File: runner.cpp
+ * ----------------
+ * Implements the runner.h interface.
+ */
+
+#include <exception>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "runner.h"
+#include "evalstate.h"
+#include "output.h"
+#include "vm.h"
+#include "error.h"
+#include "strlib.h"
+using namespace std;
+
+#if defined(__unix__) || defined(__APPLE__)
+#  define RUNNER_THREADS
+#  include <pthread.h>
+#  include <unistd.h>
+#endif
+
+/*
+ * Implementation notes: work distribution
+ * ---------------------------------------
+ * The input sets are split into one contiguous range per worker.  A
+ * worker takes sets from the front of its own range; when the range
+ * is empty, it steals the back half of the range of another worker,
+ * trying them in turn starting with its neighbour, and stops when
+ * every range is empty.  Taking from the front keeps each worker on
+ * the lowest sets it owns, so results become ready roughly in order;
+ * stealing from the back takes the work its owner would reach last.
+ * Each range has its own lock, which is held only to move the bounds.
+ *
+ * A finished run stores its output and error in its Result and marks
+ * it done under doneLock.  The calling thread writes the results out
+ * in order, waiting on doneCond for the next one, and frees each
+ * output as soon as it is written.
+ */
+
+namespace {
+
+struct Result {
+   string output;
+   string error;
+   bool failed;
+   bool done;
+};
+
+struct WorkRange {
+   int begin;
+   int end;
+#ifdef RUNNER_THREADS
+   pthread_mutex_t lock;
+#endif
+};
+
+class BatchRunner {
+
+public:
+
+   BatchRunner(const CodeView & view, const vector<string> & inputSets,
+               bool useJit, int nThreads);
+   ~BatchRunner();
+
+   int run();
+   void work(int self);
+
+private:
+
+   const CodeView & view;
+   const vector<string> & inputSets;
+   bool useJit;
+   int nThreads;
+   vector<Result> results;
+   vector<WorkRange> ranges;
+#ifdef RUNNER_THREADS
+   pthread_mutex_t doneLock;
+   pthread_cond_t doneCond;
+#endif
+
+   bool takeWork(int self, int & index);
+   bool stealWork(int self, int & index);
+   void runOne(int index);
+   void finish(int index);
+   void waitFor(int index);
+
+};
+
+struct WorkerArgs {
+   BatchRunner *runner;
+   int self;
+};
+
+}
+
+#ifdef RUNNER_THREADS
+extern "C" {
+   static void *workerMain(void *arg) {
+      WorkerArgs *args = (WorkerArgs *) arg;
+      args->runner->work(args->self);
+      return NULL;
+   }
+}
+#endif
+
+int getDefaultThreadCount() {
+#ifdef RUNNER_THREADS
+   long n = sysconf(_SC_NPROCESSORS_ONLN);
+   if (n > 0) return (int) n;
+#endif
+   return 1;
+}
+
+int runInputSets(const CodeView & view, const vector<string> & inputSets,
+                 bool useJit, int nThreads) {
+   BatchRunner runner(view, inputSets, useJit, nThreads);
+   return runner.run();
+}
+
+BatchRunner::BatchRunner(const CodeView & view,
+                         const vector<string> & inputSets,
+                         bool useJit, int nThreads)
+      : view(view), inputSets(inputSets) {
+   int n = inputSets.size();
+#ifndef RUNNER_THREADS
+   nThreads = 1;
+#endif
+   if (nThreads > n) nThreads = n;
+   if (nThreads < 1) nThreads = 1;
+   this->useJit = useJit;
+   this->nThreads = nThreads;
+   results.resize(n);
+   for (int i = 0; i < n; i++) {
+      results[i].failed = false;
+      results[i].done = false;
+   }
+   ranges.resize(nThreads);
+   for (int i = 0; i < nThreads; i++) {
+      ranges[i].begin = (int) ((long long) n * i / nThreads);
+      ranges[i].end = (int) ((long long) n * (i + 1) / nThreads);
+#ifdef RUNNER_THREADS
+      pthread_mutex_init(&ranges[i].lock, NULL);
+#endif
+   }
+#ifdef RUNNER_THREADS
+   pthread_mutex_init(&doneLock, NULL);
+   pthread_cond_init(&doneCond, NULL);
+#endif
+}
+
+BatchRunner::~BatchRunner() {
+#ifdef RUNNER_THREADS
+   for (int i = 0; i < nThreads; i++) {
+      pthread_mutex_destroy(&ranges[i].lock);
+   }
+   pthread_mutex_destroy(&doneLock);
+   pthread_cond_destroy(&doneCond);
+#endif
+}
+
+/*
+ * Implementation notes: run
+ * -------------------------
+ * Without threads the single worker runs to completion first and the
+ * results are written afterwards.
+ */
+
+int BatchRunner::run() {
+   int n = inputSets.size();
+   flushOutput();
+#ifdef RUNNER_THREADS
+   vector<pthread_t> threads(nThreads);
+   vector<WorkerArgs> args(nThreads);
+   int started = 0;
+   for (int i = 0; i < nThreads; i++) {
+      args[i].runner = this;
+      args[i].self = i;
+      if (pthread_create(&threads[i], NULL, workerMain, &args[i]) != 0) break;
+      started++;
+   }
+   if (started == 0) work(0);
+#else
+   work(0);
+#endif
+   int failures = 0;
+   for (int i = 0; i < n; i++) {
+      waitFor(i);
+      Result & result = results[i];
+      cout.write(result.output.data(), result.output.size());
+      if (result.failed) {
+         cout.flush();
+         cerr << "Error in input set " << (i + 1) << ": " << result.error << endl;
+         failures++;
+      }
+      string().swap(result.output);
+   }
+   cout.flush();
+#ifdef RUNNER_THREADS
+   for (int i = 0; i < started; i++) {
+      pthread_join(threads[i], NULL);
+   }
+#endif
+   return failures;
+}
+
+void BatchRunner::work(int self) {
+   int index;
+   while (takeWork(self, index) || stealWork(self, index)) {
+      runOne(index);
+      finish(index);
+   }
+}
+
+bool BatchRunner::takeWork(int self, int & index) {
+   WorkRange & range = ranges[self];
+   bool found = false;
+#ifdef RUNNER_THREADS
+   pthread_mutex_lock(&range.lock);
+#endif
+   if (range.begin < range.end) {
+      index = range.begin++;
+      found = true;
+   }
+#ifdef RUNNER_THREADS
+   pthread_mutex_unlock(&range.lock);
+#endif
+   return found;
+}
+
+bool BatchRunner::stealWork(int self, int & index) {
+#ifdef RUNNER_THREADS
+   for (int i = 1; i < nThreads; i++) {
+      WorkRange & victim = ranges[(self + i) % nThreads];
+      pthread_mutex_lock(&victim.lock);
+      int left = victim.end - victim.begin;
+      if (left <= 0) {
+         pthread_mutex_unlock(&victim.lock);
+         continue;
+      }
+      int start = victim.end - (left + 1) / 2;
+      int end = victim.end;
+      victim.end = start;
+      pthread_mutex_unlock(&victim.lock);
+      WorkRange & range = ranges[self];
+      pthread_mutex_lock(&range.lock);
+      range.begin = start + 1;
+      range.end = end;
+      pthread_mutex_unlock(&range.lock);
+      index = start;
+      return true;
+   }
+#endif
+   return false;
+}
+
+/*
+ * Implementation notes: runOne
+ * ----------------------------
+ * The run is headless, so nothing touches the graphics window, and
+ * its state prints only into its own buffer.  Any exception, such as
+ * bad_alloc from output that outgrows memory, fails this input set
+ * alone; letting it escape a worker thread would end the process.
+ * The output is moved into the result rather than copied, since a
+ * copy of output that has just run out of memory could throw again
+ * outside the handler.
+ */
+
+void BatchRunner::runOne(int index) {
+   Result & result = results[index];
+   EvalState state;
+   OutputBuffer output;
+   istringstream input(inputSets[index]);
+   state.setHeadless(true);
+   state.setOutput(&output);
+   state.setInput(&input);
+   try {
+      runBytecode(view, state, useJit);
+      output.endLine();
+   } catch (ErrorException & ex) {
+      result.failed = true;
+      result.error = ex.getMessage();
+   } catch (exception & ex) {
+      result.failed = true;
+      result.error = ex.what();
+   }
+   output.takeText(result.output);
+}
+
+void BatchRunner::finish(int index) {
+#ifdef RUNNER_THREADS
+   pthread_mutex_lock(&doneLock);
+   results[index].done = true;
+   pthread_cond_broadcast(&doneCond);
+   pthread_mutex_unlock(&doneLock);
+#else
+   results[index].done = true;
+#endif
+}
+
+void BatchRunner::waitFor(int index) {
+#ifdef RUNNER_THREADS
+   pthread_mutex_lock(&doneLock);
+   while (!results[index].done) {
+      pthread_cond_wait(&doneCond, &doneLock);
+   }
+   pthread_mutex_unlock(&doneLock);
+#endif
+}
@@ -0,0 +1,47 @@
+/*
+ * File: runner.h
+ * --------------
+ * This interface exports the batch runner, which runs one compiled
+ * program over many sets of INPUT values on all the cores of the
+ * machine.  The compiled code is shared by every thread and never
+ * written; each run gets its own EvalState, reading its values from
+ * its input set and printing into a private OutputBuffer, so runs do
+ * not interfere and need no locking while they execute.
+ */
+
+#ifndef _runner_h
+#define _runner_h
+
+#include <string>
+#include <vector>
+#include "bytecode.h"
+
+/*
+ * Function: getDefaultThreadCount
+ * Usage: int nThreads = getDefaultThreadCount();
+ * ----------------------------------------------
+ * Returns the number of processors available, or 1 where the runner
+ * cannot use threads.
+ */
+
+int getDefaultThreadCount();
+
+/*
+ * Function: runInputSets
+ * Usage: int failures = runInputSets(view, inputSets, useJit, nThreads);
+ * ----------------------------------------------------------------------
+ * Runs the compiled program view once for each string in inputSets,
+ * using nThreads threads.  Each run starts with no variables defined
+ * and its INPUT statements read the words of its input set in order.
+ * The output of every run is written to cout, and the message of a
+ * run that stops on an error to cerr, in the order of inputSets
+ * whatever order the runs finish in.  Returns the number of runs that
+ * stopped on an error.  Other interpreters may go on parsing and
+ * running in other threads while the runner works.
+ */
+
+int runInputSets(const CodeView & view,
+                 const std::vector<std::string> & inputSets,
+                 bool useJit, int nThreads);
+
+#endif
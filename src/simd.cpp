@@ -0,0 +1,351 @@
+/*
+ * File: simd.cpp
+ * --------------
+ * Implements the simd.h interface.
+ */
+
+#include "simd.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#  define SIMD_X86_64
+#  define AVX_TARGET __attribute__((target("avx")))
+#  include <immintrin.h>
+#endif
+
+/*
+ * Implementation notes: dispatch
+ * ------------------------------
+ * SSE2 is part of every x86-64 processor, so only AVX needs to be
+ * detected.  The AVX kernels are compiled for AVX through a function
+ * attribute while the rest of the interpreter is not, and run only
+ * when the processor and the operating system support it.  Each
+ * public function switches on the level once per call, not once per
+ * element.
+ */
+
+static SimdLevel detectSimdLevel() {
+#ifdef SIMD_X86_64
+   __builtin_cpu_init();
+   if (__builtin_cpu_supports("avx")) return SIMD_AVX;
+   return SIMD_SSE2;
+#else
+   return SIMD_SCALAR;
+#endif
+}
+
+static const SimdLevel supportedLevel = detectSimdLevel();
+static SimdLevel currentLevel = supportedLevel;
+
+SimdLevel getSimdLevel() {
+   return currentLevel;
+}
+
+void setSimdLevel(SimdLevel level) {
+   currentLevel = (level > supportedLevel) ? supportedLevel : level;
+}
+
+SimdLevel getSupportedSimdLevel() {
+   return supportedLevel;
+}
+
+const char *simdLevelName(SimdLevel level) {
+   switch (level) {
+   case SIMD_SSE2: return "SSE2";
+   case SIMD_AVX: return "AVX";
+   default: return "scalar";
+   }
+}
+
+/*
+ * Implementation notes: operations and operands
+ * ---------------------------------------------
+ * An operation class applies its operator to a pair of doubles, of
+ * SSE2 registers or of AVX registers.  An operand class supplies the
+ * values of one side of an element-wise operation at position i:
+ * VectorOperand reads them from a block, ScalarOperand repeats a
+ * single value, whose broadcast the compiler moves out of the loop,
+ * and ScaledOperand multiplies the values of a block by a constant.
+ * Every kernel is a template over one operation and two operands.
+ */
+
+struct AddOp {
+   static double apply(double a, double b) { return a + b; }
+#ifdef SIMD_X86_64
+   static __m128d apply(__m128d a, __m128d b) { return _mm_add_pd(a, b); }
+   AVX_TARGET static __m256d apply(__m256d a, __m256d b) { return _mm256_add_pd(a, b); }
+#endif
+};
+
+struct SubOp {
+   static double apply(double a, double b) { return a - b; }
+#ifdef SIMD_X86_64
+   static __m128d apply(__m128d a, __m128d b) { return _mm_sub_pd(a, b); }
+   AVX_TARGET static __m256d apply(__m256d a, __m256d b) { return _mm256_sub_pd(a, b); }
+#endif
+};
+
+struct MulOp {
+   static double apply(double a, double b) { return a * b; }
+#ifdef SIMD_X86_64
+   static __m128d apply(__m128d a, __m128d b) { return _mm_mul_pd(a, b); }
+   AVX_TARGET static __m256d apply(__m256d a, __m256d b) { return _mm256_mul_pd(a, b); }
+#endif
+};
+
+struct DivOp {
+   static double apply(double a, double b) { return a / b; }
+#ifdef SIMD_X86_64
+   static __m128d apply(__m128d a, __m128d b) { return _mm_div_pd(a, b); }
+   AVX_TARGET static __m256d apply(__m256d a, __m256d b) { return _mm256_div_pd(a, b); }
+#endif
+};
+
+struct VectorOperand {
+   const double *data;
+   VectorOperand(const double *data) : data(data) { }
+   double at(int i) const { return data[i]; }
+#ifdef SIMD_X86_64
+   __m128d sse2(int i) const { return _mm_loadu_pd(data + i); }
+   AVX_TARGET __m256d avx(int i) const { return _mm256_loadu_pd(data + i); }
+#endif
+};
+
+struct ScalarOperand {
+   double value;
+   ScalarOperand(double value) : value(value) { }
+   double at(int) const { return value; }
+#ifdef SIMD_X86_64
+   __m128d sse2(int) const { return _mm_set1_pd(value); }
+   AVX_TARGET __m256d avx(int) const { return _mm256_set1_pd(value); }
+#endif
+};
+
+struct ScaledOperand {
+   double k;
+   const double *data;
+   ScaledOperand(double k, const double *data) : k(k), data(data) { }
+   double at(int i) const { return k * data[i]; }
+#ifdef SIMD_X86_64
+   __m128d sse2(int i) const {
+      return _mm_mul_pd(_mm_set1_pd(k), _mm_loadu_pd(data + i));
+   }
+   AVX_TARGET __m256d avx(int i) const {
+      return _mm256_mul_pd(_mm256_set1_pd(k), _mm256_loadu_pd(data + i));
+   }
+#endif
+};
+
+/*
+ * Implementation notes: element-wise kernels
+ * ------------------------------------------
+ * Both operands of a step are loaded before its result is stored, so
+ * dst may be one of the operands.  The AVX kernel handles eight
+ * elements per step, which keeps two independent operations in
+ * flight, then four, and leaves the rest to the scalar loop.
+ */
+
+template <class Op, class Lhs, class Rhs>
+static void combineScalar(double *dst, Lhs x, Rhs y, int i, int n) {
+   for (; i < n; i++) {
+      dst[i] = Op::apply(x.at(i), y.at(i));
+   }
+}
+
+#ifdef SIMD_X86_64
+
+template <class Op, class Lhs, class Rhs>
+static void combineSse2(double *dst, Lhs x, Rhs y, int n) {
+   int i = 0;
+   for (; i + 2 <= n; i += 2) {
+      _mm_storeu_pd(dst + i, Op::apply(x.sse2(i), y.sse2(i)));
+   }
+   combineScalar<Op>(dst, x, y, i, n);
+}
+
+template <class Op, class Lhs, class Rhs>
+AVX_TARGET static void combineAvx(double *dst, Lhs x, Rhs y, int n) {
+   int i = 0;
+   for (; i + 8 <= n; i += 8) {
+      __m256d a = Op::apply(x.avx(i), y.avx(i));
+      __m256d b = Op::apply(x.avx(i + 4), y.avx(i + 4));
+      _mm256_storeu_pd(dst + i, a);
+      _mm256_storeu_pd(dst + i + 4, b);
+   }
+   for (; i + 4 <= n; i += 4) {
+      _mm256_storeu_pd(dst + i, Op::apply(x.avx(i), y.avx(i)));
+   }
+   combineScalar<Op>(dst, x, y, i, n);
+}
+
+#endif
+
+template <class Op, class Lhs, class Rhs>
+static void combine(double *dst, Lhs x, Rhs y, int n) {
+   switch (currentLevel) {
+#ifdef SIMD_X86_64
+   case SIMD_AVX: combineAvx<Op>(dst, x, y, n); return;
+   case SIMD_SSE2: combineSse2<Op>(dst, x, y, n); return;
+#endif
+   default: combineScalar<Op>(dst, x, y, 0, n); return;
+   }
+}
+
+template <class Lhs, class Rhs>
+static void combineOp(ArrayOp op, double *dst, Lhs x, Rhs y, int n) {
+   switch (op) {
+   case ARRAY_ADD: combine<AddOp>(dst, x, y, n); break;
+   case ARRAY_SUB: combine<SubOp>(dst, x, y, n); break;
+   case ARRAY_MUL: combine<MulOp>(dst, x, y, n); break;
+   case ARRAY_DIV: combine<DivOp>(dst, x, y, n); break;
+   }
+}
+
+void combineVectors(ArrayOp op, double *dst, const double *x,
+                    const double *y, int n) {
+   combineOp(op, dst, VectorOperand(x), VectorOperand(y), n);
+}
+
+void combineVectorScalar(ArrayOp op, double *dst, const double *x,
+                         double k, int n) {
+   combineOp(op, dst, VectorOperand(x), ScalarOperand(k), n);
+}
+
+void combineScalarVector(ArrayOp op, double *dst, double k,
+                         const double *x, int n) {
+   combineOp(op, dst, ScalarOperand(k), VectorOperand(x), n);
+}
+
+void subtractScaledVector(double *dst, double k, const double *x, int n) {
+   combine<SubOp>(dst, VectorOperand(dst), ScaledOperand(k, x), n);
+}
+
+/*
+ * Implementation notes: fillVector
+ * --------------------------------
+ * Filling only stores, so it runs at the speed of memory with any
+ * instruction set; the compiler vectorizes the plain loop.
+ */
+
+void fillVector(double *dst, double k, int n) {
+   for (int i = 0; i < n; i++) {
+      dst[i] = k;
+   }
+}
+
+/*
+ * Implementation notes: sumVector, dotVectors
+ * -------------------------------------------
+ * Partial sum j takes the terms whose index leaves j modulo 8, up to
+ * the last multiple of 8.  The eight sums are then combined as
+ * ((s0 + s4) + (s2 + s6)) + ((s1 + s5) + (s3 + s7)), which is how the
+ * lanes of two AVX registers fold together, and the remaining terms
+ * are added one by one.  The SSE2 kernel keeps the same sums in four
+ * registers and the scalar kernel in eight variables, and both fold
+ * them in the same order, so all three return the same bits.  A
+ * product is rounded before it is added, never fused with the
+ * addition, so the interpreter must not be built with floating-point
+ * contraction.
+ */
+
+struct SumTerm {
+   const double *x;
+   SumTerm(const double *x) : x(x) { }
+   double at(int i) const { return x[i]; }
+#ifdef SIMD_X86_64
+   __m128d sse2(int i) const { return _mm_loadu_pd(x + i); }
+   AVX_TARGET __m256d avx(int i) const { return _mm256_loadu_pd(x + i); }
+#endif
+};
+
+struct DotTerm {
+   const double *x;
+   const double *y;
+   DotTerm(const double *x, const double *y) : x(x), y(y) { }
+   double at(int i) const { return x[i] * y[i]; }
+#ifdef SIMD_X86_64
+   __m128d sse2(int i) const {
+      return _mm_mul_pd(_mm_loadu_pd(x + i), _mm_loadu_pd(y + i));
+   }
+   AVX_TARGET __m256d avx(int i) const {
+      return _mm256_mul_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i));
+   }
+#endif
+};
+
+template <class Term>
+static double reduceScalar(Term term, int n) {
+   double s[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+   int i = 0;
+   for (; i + 8 <= n; i += 8) {
+      for (int j = 0; j < 8; j++) {
+         s[j] += term.at(i + j);
+      }
+   }
+   double sum = ((s[0] + s[4]) + (s[2] + s[6])) + ((s[1] + s[5]) + (s[3] + s[7]));
+   for (; i < n; i++) {
+      sum += term.at(i);
+   }
+   return sum;
+}
+
+#ifdef SIMD_X86_64
+
+template <class Term>
+static double reduceSse2(Term term, int n) {
+   __m128d s01 = _mm_setzero_pd();
+   __m128d s23 = _mm_setzero_pd();
+   __m128d s45 = _mm_setzero_pd();
+   __m128d s67 = _mm_setzero_pd();
+   int i = 0;
+   for (; i + 8 <= n; i += 8) {
+      s01 = _mm_add_pd(s01, term.sse2(i));
+      s23 = _mm_add_pd(s23, term.sse2(i + 2));
+      s45 = _mm_add_pd(s45, term.sse2(i + 4));
+      s67 = _mm_add_pd(s67, term.sse2(i + 6));
+   }
+   __m128d u = _mm_add_pd(_mm_add_pd(s01, s45), _mm_add_pd(s23, s67));
+   double sum = _mm_cvtsd_f64(u) + _mm_cvtsd_f64(_mm_unpackhi_pd(u, u));
+   for (; i < n; i++) {
+      sum += term.at(i);
+   }
+   return sum;
+}
+
+template <class Term>
+AVX_TARGET static double reduceAvx(Term term, int n) {
+   __m256d s0123 = _mm256_setzero_pd();
+   __m256d s4567 = _mm256_setzero_pd();
+   int i = 0;
+   for (; i + 8 <= n; i += 8) {
+      s0123 = _mm256_add_pd(s0123, term.avx(i));
+      s4567 = _mm256_add_pd(s4567, term.avx(i + 4));
+   }
+   __m256d t = _mm256_add_pd(s0123, s4567);
+   __m128d u = _mm_add_pd(_mm256_castpd256_pd128(t), _mm256_extractf128_pd(t, 1));
+   double sum = _mm_cvtsd_f64(u) + _mm_cvtsd_f64(_mm_unpackhi_pd(u, u));
+   for (; i < n; i++) {
+      sum += term.at(i);
+   }
+   return sum;
+}
+
+#endif
+
+template <class Term>
+static double reduce(Term term, int n) {
+   switch (currentLevel) {
+#ifdef SIMD_X86_64
+   case SIMD_AVX: return reduceAvx(term, n);
+   case SIMD_SSE2: return reduceSse2(term, n);
+#endif
+   default: return reduceScalar(term, n);
+   }
+}
+
+double sumVector(const double *x, int n) {
+   return reduce(SumTerm(x), n);
+}
+
+double dotVectors(const double *x, const double *y, int n) {
+   return reduce(DotTerm(x, y), n);
+}
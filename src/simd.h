@@ -0,0 +1,110 @@
+/*
+ * File: simd.h
+ * ------------
+ * This interface exports the vector kernels behind the whole-array
+ * statements: element-wise arithmetic, filling, summing and dot
+ * products over blocks of doubles.  Each kernel exists in a scalar
+ * version and, on x86-64, in SSE2 and AVX versions; the fastest one
+ * the processor supports is chosen when the program starts.  Every
+ * version computes exactly the same results, so which one runs can
+ * never change the output of a program.
+ */
+
+#ifndef _simd_h
+#define _simd_h
+
+/*
+ * Type: ArrayOp
+ * -------------
+ * The element-wise operations of a whole-array assignment.
+ */
+
+enum ArrayOp { ARRAY_ADD, ARRAY_SUB, ARRAY_MUL, ARRAY_DIV };
+
+/*
+ * Type: SimdLevel
+ * ---------------
+ * The instruction sets the kernels can be built for, from the
+ * slowest to the fastest.
+ */
+
+enum SimdLevel { SIMD_SCALAR, SIMD_SSE2, SIMD_AVX };
+
+/*
+ * Functions: getSimdLevel, setSimdLevel, getSupportedSimdLevel
+ * Usage: SimdLevel level = getSimdLevel();
+ *        setSimdLevel(SIMD_SCALAR);
+ * ------------------------------------------------------------
+ * Return and set the instruction set the kernels use.  The level
+ * starts out as the best one the processor supports, which
+ * getSupportedSimdLevel returns; setSimdLevel, meant for benchmarks
+ * and tests, lowers it and never raises it beyond that.  The level is
+ * shared by every thread and should only be set before any runs.
+ */
+
+SimdLevel getSimdLevel();
+void setSimdLevel(SimdLevel level);
+SimdLevel getSupportedSimdLevel();
+
+/*
+ * Function: simdLevelName
+ * Usage: string name = simdLevelName(level);
+ * ------------------------------------------
+ * Returns "scalar", "SSE2" or "AVX".
+ */
+
+const char *simdLevelName(SimdLevel level);
+
+/*
+ * Functions: combineVectors, combineVectorScalar, combineScalarVector
+ * Usage: combineVectors(ARRAY_ADD, dst, x, y, n);
+ *        combineVectorScalar(ARRAY_MUL, dst, x, k, n);
+ *        combineScalarVector(ARRAY_SUB, dst, k, x, n);
+ * -------------------------------------------------------------------
+ * Set dst[i] to x[i] op y[i], x[i] op k or k op x[i] for i from 0 to
+ * n - 1.  dst may be the same block as x or y, but must not overlap
+ * them otherwise.
+ */
+
+void combineVectors(ArrayOp op, double *dst, const double *x,
+                    const double *y, int n);
+void combineVectorScalar(ArrayOp op, double *dst, const double *x,
+                         double k, int n);
+void combineScalarVector(ArrayOp op, double *dst, double k,
+                         const double *x, int n);
+
+/*
+ * Function: subtractScaledVector
+ * Usage: subtractScaledVector(dst, k, x, n);
+ * ------------------------------------------
+ * Sets dst[i] to dst[i] - k * x[i] for i from 0 to n - 1, rounding the
+ * product before the subtraction.  dst must not overlap x.
+ */
+
+void subtractScaledVector(double *dst, double k, const double *x, int n);
+
+/*
+ * Function: fillVector
+ * Usage: fillVector(dst, k, n);
+ * -----------------------------
+ * Sets the n elements of dst to k.
+ */
+
+void fillVector(double *dst, double k, int n);
+
+/*
+ * Functions: sumVector, dotVectors
+ * Usage: double sum = sumVector(x, n);
+ *        double dot = dotVectors(x, y, n);
+ * ----------------------------------------
+ * Return the sum of the n elements of x and the sum of the products
+ * x[i] * y[i].  The terms are added in eight interleaved partial sums
+ * that are combined at the end, which is what lets the vector
+ * versions run at full speed; a loop adding them one at a time may
+ * therefore round differently in the last bits.
+ */
+
+double sumVector(const double *x, int n);
+double dotVectors(const double *x, const double *y, int n);
+
+#endif
@@ -7,52 +7,114 @@
 #include <string>
 #include "statement.h"
 #include "parser.h"
-#include "graphics.h"
+#include "bytecode.h"
+#include "arrays.h"
+#include "optimizer.h"
+#include "postfix.h"
+#include "program.h"
+#include "output.h"
+#include "display.h"
 using namespace std;
 
 /* Implementation of the Statement class */
 
-/* Static constants */
-static const double COLUMN_WIDTH = 400;				//WINDOW_WIDTH/2
-static const double COLUMN_HEIGHT =	220;			//WINDOW_HEIGHT - 80
-static const string BG_FILE = "bg.jpg";
-static const double INIT_HEIGHT = 55;
-static const double PRINT_HEIGHT = COLUMN_HEIGHT + 25;
+Statement::Statement() {
+	lineNumber = -1;
+	index = -1;
+	successor = NULL;
+}
 
+Statement::~Statement() {
+   /* Empty */
+}
 
-/* Global variables keeping track of graphics order for all elements */
-int orderB = 0;			// Y-coordinate for Before Execution column
-int orderA = 0;			// Y-coordinate for After Execution column
+void *Statement::operator new(size_t size, Arena & arena) {
+   return arena.allocate(size);
+}
 
-Statement::Statement() {
-	setColor("#fbcc62");
+void Statement::operator delete(void *ptr, Arena & arena) {
+   /* Empty */
 }
 
-Statement::~Statement() {
+void Statement::operator delete(void *ptr) {
+   /* Empty */
+}
+
+void Statement::link(Program & program) {
+   /* Empty */
+}
+
+void Statement::optimize(Arena & arena) {
    /* Empty */
 }
 
+void Statement::describe(Display & display) {
+   /* Empty */
+}
+
+void Statement::setSuccessor(int lineNumber, int index, Statement *next) {
+	this->lineNumber = lineNumber;
+	this->index = index;
+	successor = next;
+}
+
+Statement *Statement::getSuccessor() {
+	return successor;
+}
+
+int Statement::getLineNumber() {
+	return lineNumber;
+}
+
+int Statement::getIndex() {
+	return index;
+}
+
+/*
+ * Function: resolveTarget
+ * Usage: target = resolveTarget(program, next, "GOTO", lineNumber);
+ * ------------------------------------------------------------------
+ * Returns the statement stored at line next, or raises an error
+ * naming the jumping statement if no such line exists.
+ */
+static Statement *resolveTarget(Program & program, int next, 
+								string stmtName, int lineNumber) {
+	if (program.getSourceLine(next) == "") {
+		error("Invalid line number: " + integerToString(next) + " (" 
+			+ stmtName + " on line " + integerToString(lineNumber) + ")");
+	}
+	return program.getParsedStatement(next);
+}
+
 /*
  * Method: PrintStmt
- * Usage: Statement *stmt = new PrintStmt(scanner);
+ * Usage: Statement *stmt = new (arena) PrintStmt(lexer, arena);
  * -------------------------------------------------
  * Checks for extraneous tokens, and creates a PrintStmt
  * object that stores the parsed representation of the 
  * expression in an instance variable.
  *
  * Optionally accepts a list of expressions separated by a 
- * comma and stores PrintStmt objects for each one in a vector.
- * Also optionally accepts an optional beginning with a string 
- * bound by "".
+ * comma, collects them in a vector and then copies them to an
+ * array in the arena. Also optionally accepts an optional
+ * beginning with a string bound by "".
  */
-PrintStmt::PrintStmt(TokenScanner & scanner) {
-	string test = scanner.nextToken();
-	handleGraphicsB();
-	testInitComment(scanner, test);
-	addRest(scanner);
-	if (scanner.hasMoreTokens()) {
-		error("Extraneous token " + scanner.nextToken());
+PrintStmt::PrintStmt(Lexer & lexer, Arena & arena) {
+	string text;
+	Vector<Expression *> vec;
+	testInitComment(lexer, text, vec, arena);
+	addRest(lexer, vec, arena);
+	if (lexer.hasMoreTokens()) {
+		error("Extraneous token " + lexer.nextToken().getText());
 	}
+	comment = arena.copyString(text);
+	nExps = vec.size();
+	exps = arena.allocateArray<Expression *>(nExps);
+	for (int i = 0; i < nExps; i++) {
+		exps[i] = vec[i];
+	}
+	optExps = exps;
+	codes = NULL;
 }
 
 /*
@@ -65,61 +127,112 @@ PrintStmt::~PrintStmt()	{
 
 /*
  * Method: execute
- * Usage: program.getParsedStatement(index)->execute(state);
+ * Usage: stmt->execute(state);
  * ----------------------------------------------------------
- * Iterates through vec and reads all stored expressions, 
+ * Iterates through the optimized expressions, 
  * evaluates each expression in the context of the corresponding 
- * EvalState object and sends the result to cout.
+ * EvalState object and sends the result to the output buffer.
  */
 void PrintStmt::execute(EvalState & state) {
-	cout << comment;
-	handleGraphicsA();
-	if (comment != "") {
-		drawString("Printed: " + comment, 
-			getWindowWidth()/2 + 20, orderA);
+	OutputBuffer & output = state.getOutput();
+	if (comment[0] != '\0') output.write(comment);
+	if (!state.isHeadless()) {
+		state.getDisplay()->startAfter();
+		if (comment[0] != '\0') {
+			state.getDisplay()->drawAfter("Printed: " + string(comment));
+		}
 	}
 	printExps(state);
-	cout << endl;
-	state.setNextLine("NULL");
+	output.endLine();
+}
+
+/*
+ * Method: compile
+ * Usage: stmt->compile(compiler);
+ * ----------------------------------------------------------
+ * Emits the optional comment string, then each expression
+ * followed by a print instruction, and finally the line end.
+ */
+void PrintStmt::compile(Compiler & compiler) {
+	if (comment[0] != '\0') {
+		compiler.emit(OP_PRINT_STR, compiler.stringIndex(comment));
+	}
+	for (int i = 0; i < nExps; i++) {
+		compiler.compileExp(optExps[i]);
+		compiler.emit(OP_PRINT_NUM);
+	}
+	compiler.emit(OP_PRINT_END);
+}
+
+/*
+ * Method: describe
+ * Usage: stmt->describe(display);
+ * ----------------------------------------------------------
+ * Lists the expressions to be printed, one per line. The
+ * first one shares the line of the statement unless the
+ * statement begins with a string.
+ */
+void PrintStmt::describe(Display & display) {
+	display.startBefore();
+	for (int i = 0; i < nExps; i++) {
+		if (i > 0 || comment[0] != '\0') display.stepBefore();
+		display.drawBefore("To be printed: " + exps[i]->toString());
+	}
+}
+
+/*
+ * Method: optimize
+ * Usage: stmt->optimize(arena);
+ * ----------------------------------------------------------
+ * Stores an optimized copy of every expression in optExps
+ * and its postfix form in codes.
+ */
+void PrintStmt::optimize(Arena & arena) {
+	optExps = arena.allocateArray<Expression *>(nExps);
+	codes = arena.allocateArray<PostfixCode>(nExps);
+	for (int i = 0; i < nExps; i++) {
+		optExps[i] = optimizeExp(exps[i], arena);
+		codes[i] = compilePostfix(optExps[i], arena);
+	}
 }
 
 /*
  * Method: testInitComment
- * Usage: testInitComment(scanner, test);
+ * Usage: testInitComment(lexer, text, vec, arena);
  * -------------------------------------------------
  * Tests if input begins with an initial string, and updates
- * 'comment' accordingly for printing. If no initial string is
+ * text accordingly for printing. The words of the string are
+ * kept separated by single spaces. If no initial string is
  * detected, then the first expression is added to vec.
  */
-void PrintStmt::testInitComment(TokenScanner & scanner, string test){
-    if(test == "\"") {
-		string temp = scanner.nextToken();
-		while(temp != "\""){
-			comment += temp + " ";
-			temp = scanner.nextToken();
+void PrintStmt::testInitComment(Lexer & lexer, string & text, 
+								Vector<Expression *> & vec, Arena & arena){
+    if(lexer.peekToken().is('"')) {
+		lexer.nextToken();
+		Token temp = lexer.nextToken();
+		while(!temp.is('"')){
+			if (temp.kind == END_TOKEN) error("Missing closing quote");
+			text.append(temp.text, temp.length);
+			text += ' ';
+			temp = lexer.nextToken();
 		}
 	} else {
-		comment = "";
-		scanner.saveToken(test);
-		Expression *exp = readE(scanner);
-		vec.add(exp);
-		drawString("To be printed: " + exp->toString(), 20, orderB);
+		text = "";
+		vec.add(readE(lexer, arena));
 	}
 }
 
 /*
  * Method: addRest
- * Usage: addRest(scanner);
+ * Usage: addRest(lexer, vec, arena);
  * -------------------------------------------------
  * Using commas (,) as tokenizers, creates and adds
  * a list of expressions in the input to vec.
  */
-void PrintStmt::addRest(TokenScanner & scanner){
-	while(scanner.nextToken() == ","){
-		Expression *exp = readE(scanner);
-		vec.add(exp);
-		orderB += 15;
-		drawString("To be printed: " + exp->toString(), 20, orderB);
+void PrintStmt::addRest(Lexer & lexer, Vector<Expression *> & vec,
+						Arena & arena){
+	while(lexer.nextToken().is(',')){
+		vec.add(readE(lexer, arena));
 	}
 }
 
@@ -127,64 +240,37 @@ void PrintStmt::addRest(TokenScanner & scanner){
  * Method: printExps
  * Usage: printExps();
  * ---------------------------------------------------------
- * Reads all expressions stored in ve and prints out their 
- * evaluated states to the console. Also updates graphics window.
+ * Reads all optimized expressions and prints out their 
+ * evaluated states to the output buffer. Also updates graphics
+ * window unless the state is headless.
  */
 void PrintStmt::printExps(EvalState & state){
-	foreach(Expression * exp in vec){
-		double result = exp->eval(state);
-		cout << realToString(result) << " ";
-		drawString("Printed: " + realToString(result), 
-						getWindowWidth()/2 + 20, orderA);
-		orderA += 15;
-	}
-}
-
-/*
- * Method: handleGraphicsB
- * Usage: handleGraphicsB();
- * ------------------------------------------------------------
- * Handles initialization of printing points in for 'Before
- * Execution' column in graphics window. 
- */
-void PrintStmt::handleGraphicsB(){
-	if (orderB > PRINT_HEIGHT) {
-		drawImage(BG_FILE, 0, 45, COLUMN_WIDTH, COLUMN_HEIGHT);
-		orderB = 0;
+	OutputBuffer & output = state.getOutput();
+	for (int i = 0; i < nExps; i++) {
+		double result = evalPostfix(codes[i], state);
+		output.writeNumber(result);
+		if (state.isHeadless()) continue;
+		state.getDisplay()->drawAfter("Printed: " + realToString(result));
+		state.getDisplay()->stepAfter();
 	}
-	if (orderB == 0) orderB = INIT_HEIGHT;
-	orderB += 15;
 }
 
 
-/*
- * Method: handleGraphicsA
- * Usage: handleGraphicsA();
- * ------------------------------------------------------------
- * Handles initialization of printing points in for 'After
- * Execution' column in graphics window. 
- */
-void PrintStmt::handleGraphicsA(){
-	if (orderA > PRINT_HEIGHT) {
-		drawImage(BG_FILE, getWindowWidth()/2 + 10,45, COLUMN_WIDTH, COLUMN_HEIGHT);
-		orderA = 0;
-	}
-	if (orderA == 0) orderA = INIT_HEIGHT;
-	orderA += 15;
-}
-
 /*
  * Method: RemStmt
- * Usage: Statement *stmt = new RemStmt(scanner);
+ * Usage: Statement *stmt = new (arena) RemStmt(lexer, arena);
  * -------------------------------------------------
- * Creates a blank RemStmt object.
+ * Creates a RemStmt object that keeps the comment text in
+ * the arena for display.
  */
-RemStmt::RemStmt(TokenScanner & scanner) {
-	while(scanner.hasMoreTokens()){
-		str += scanner.nextToken() + " ";
+RemStmt::RemStmt(Lexer & lexer, Arena & arena) {
+	string text;
+	while(lexer.hasMoreTokens()){
+		Token token = lexer.nextToken();
+		text.append(token.text, token.length);
+		text += ' ';
 	}
-	handleGraphicsB();
-	drawString("Comment: " + str, 20, orderB);
+	str = arena.copyString(text);
 }
 
 /*
@@ -197,66 +283,54 @@ RemStmt::~RemStmt()	{
 
 /*
  * Method: execute
- * Usage: program.getParsedStatement(index)->execute(state);
+ * Usage: stmt->execute(state);
  * ----------------------------------------------------------
  * Ensures execution order is restored after IF and GOTO 
  * disruptions have been handled.
  */
 void RemStmt::execute(EvalState & state) {
-	state.setNextLine("NULL");
-	handleGraphicsA();
-	drawString("Skipped comment: " + str, 
-			getWindowWidth()/2 + 20, orderA);
+	if (state.isHeadless()) return;
+	state.getDisplay()->startAfter();
+	state.getDisplay()->drawAfter("Skipped comment: " + string(str));
 }
 
 /*
- * Method: handleGraphicsB
- * Usage: handleGraphicsB();
- * ------------------------------------------------------------
- * Handles initialization of printing points in for 'Before
- * Execution' column in graphics window. 
+ * Method: compile
+ * Usage: stmt->compile(compiler);
+ * ----------------------------------------------------------
+ * Comments emit no code.
  */
-void RemStmt::handleGraphicsB(){
-	if (orderB > PRINT_HEIGHT) {
-		drawImage(BG_FILE, 0, 45, COLUMN_WIDTH, COLUMN_HEIGHT);
-		orderB = 0;
-	}
-	if (orderB == 0) orderB = INIT_HEIGHT;
-	orderB += 15;
+void RemStmt::compile(Compiler & compiler) {
+	/* Empty */
 }
 
 /*
- * Method: handleGraphicsA
- * Usage: handleGraphicsA();
- * ------------------------------------------------------------
- * Handles initialization of printing points in for 'After
- * Execution' column in graphics window. 
+ * Method: describe
+ * Usage: stmt->describe(display);
+ * ----------------------------------------------------------
+ * Shows the comment text.
  */
-void RemStmt::handleGraphicsA(){
-	if (orderA > PRINT_HEIGHT) {
-		drawImage(BG_FILE, getWindowWidth()/2 + 10,45, COLUMN_WIDTH, COLUMN_HEIGHT);
-		orderA = 0;
-	}
-	if (orderA == 0) orderA = INIT_HEIGHT;
-	orderA += 15;
+void RemStmt::describe(Display & display) {
+	display.startBefore();
+	display.drawBefore("Comment: " + string(str));
 }
 
 /*
  * Method: InputStmt
- * Usage: Statement *stmt = new InputStmt(scanner);
+ * Usage: Statement *stmt = new (arena) InputStmt(lexer);
  * -------------------------------------------------
  * Ensures first token after statement is a valid lvalue.
  * Checks for extraneous tokens, and creates an InputStmt
- * object that stores the lvalue in an instance variable.
+ * object that stores the slot of the lvalue in an instance
+ * variable.
  */
-InputStmt::InputStmt(TokenScanner & scanner) {
-	var = scanner.nextToken();
-	if(scanner.getTokenType(var) != WORD) error("Only letters allowed.");
-	if (scanner.hasMoreTokens()) {
-		error("Extraneous token " + scanner.nextToken());
+InputStmt::InputStmt(Lexer & lexer) {
+	Token token = lexer.nextToken();
+	if(token.kind != WORD_TOKEN) error("Only letters allowed.");
+	slot = getVariableSlot(token.text, token.length);
+	if (lexer.hasMoreTokens()) {
+		error("Extraneous token " + lexer.nextToken().getText());
 	}
-	handleGraphicsB();
-	drawString("Variable stored: " + var + " = ?", 20, orderB);
 }
 
 /*
@@ -269,75 +343,75 @@ InputStmt::~InputStmt()	{
 
 /*
  * Method: execute
- * Usage: program.getParsedStatement(index)->execute(state);
+ * Usage: stmt->execute(state);
  * ----------------------------------------------------------
  * Asks the user to key in an integer value, and sets the stored
- * lvalue equal to the input.
+ * lvalue equal to the input. Pending PRINT output is flushed
+ * before the prompt.
  */
 void InputStmt::execute(EvalState & state) {
-	handleGraphicsA();
-	drawString("Requested input for: " + var, 
-				getWindowWidth()/2 + 20, orderA);
-	double val = getReal(var + " ? ");
-	state.setValue(var, val);
-	state.setNextLine("NULL");
-	handleGraphicsA();
-	drawString("Value updated: " + var + " = " + realToString(val),
-		getWindowWidth()/2 + 20, orderA);
+	const string & var = getVariableName(slot);
+	if (!state.isHeadless()) {
+		state.getDisplay()->startAfter();
+		state.getDisplay()->drawAfter("Requested input for: " + var);
+	}
+	double val = readInput(var, state.getInput());
+	state.setValue(slot, val);
+	if (state.isHeadless()) return;
+	state.getDisplay()->startAfter();
+	state.getDisplay()->drawAfter("Value updated: " + var + " = " 
+		+ realToString(val));
 }
 
 /*
- * Method: handleGraphicsB
- * Usage: handleGraphicsB();
- * ------------------------------------------------------------
- * Handles initialization of printing points in for 'Before
- * Execution' column in graphics window. 
+ * Method: compile
+ * Usage: stmt->compile(compiler);
+ * ----------------------------------------------------------
+ * Emits a single input instruction for the stored lvalue.
  */
-void InputStmt::handleGraphicsB(){
-	if (orderB > PRINT_HEIGHT) {
-		drawImage(BG_FILE, 0, 45, COLUMN_WIDTH, COLUMN_HEIGHT);
-		orderB = 0;
-	}
-	if (orderB == 0) orderB = INIT_HEIGHT;
-	orderB += 15;
+void InputStmt::compile(Compiler & compiler) {
+	compiler.emit(OP_INPUT, slot);
 }
 
 /*
- * Method: handleGraphicsA
- * Usage: handleGraphicsA();
- * ------------------------------------------------------------
- * Handles initialization of printing points in for 'After
- * Execution' column in graphics window. 
+ * Method: describe
+ * Usage: stmt->describe(display);
+ * ----------------------------------------------------------
+ * Shows the variable whose value will be read.
  */
-void InputStmt::handleGraphicsA(){
-	if (orderA > PRINT_HEIGHT) {
-		drawImage(BG_FILE, getWindowWidth()/2 + 10,45, COLUMN_WIDTH, COLUMN_HEIGHT);
-		orderA = 0;
-	}
-	if (orderA == 0) orderA = INIT_HEIGHT;
-	orderA += 15;
+void InputStmt::describe(Display & display) {
+	display.startBefore();
+	display.drawBefore("Variable stored: " + getVariableName(slot) + " = ?");
 }
 
 /*
  * Method: LetStmt
- * Usage: Statement *stmt = new LetStmt(scanner);
+ * Usage: Statement *stmt = new (arena) LetStmt(lexer, arena);
  * -------------------------------------------------
  * Ensures the valid presence of an assignment operator.
  * Checks for extraneous tokens, and creates a LetStmt
- * object that stores the lvalue and the expression following
- * the operator in instance variables.
+ * object that stores the slot of the lvalue and the expression
+ * following the operator in instance variables. An lvalue
+ * followed by a parenthesis is an array element, read by
+ * readArray.
  */
-LetStmt::LetStmt(TokenScanner & scanner) {
-	var = scanner.nextToken();
-	string op = scanner.nextToken();
-	if (op != "=") error("Illegal operator: " + op);
-	exp = readE(scanner);
-	if (scanner.hasMoreTokens()) {
-		error("Extraneous token " + scanner.nextToken());
+LetStmt::LetStmt(Lexer & lexer, Arena & arena) {
+	Token var = lexer.nextToken();
+	slot = getVariableSlot(var.text, var.length);
+	element = NULL;
+	optElement = NULL;
+	subscriptCodes = NULL;
+	if (lexer.peekToken().is('(')) {
+		element = (ArrayExp *) readArray(slot, lexer, arena);
+		if (element->isWholeArray()) error("Illegal variable: " + element->toString());
+	}
+	Token op = lexer.nextToken();
+	if (!op.is('=')) error("Illegal operator: " + op.getText());
+	exp = readE(lexer, arena);
+	optExp = NULL;
+	if (lexer.hasMoreTokens()) {
+		error("Extraneous token " + lexer.nextToken().getText());
 	}
-	handleGraphicsB();
-	drawString("Variable stored: " + var + " = " + 
-							exp->toString(), 20, orderB);
 }
 
 /*
@@ -346,72 +420,584 @@ LetStmt::LetStmt(TokenScanner & scanner) {
  * Destructor for LetStmt subclass.
  */
 LetStmt::~LetStmt()	{
-	delete exp;
 }
 
 /*
  * Method: execute
- * Usage: program.getParsedStatement(index)->execute(state);
+ * Usage: stmt->execute(state);
  * ----------------------------------------------------------
  * Evaluates the stored expression and assigns it to the stored lvalue.
  */
 void LetStmt::execute(EvalState & state) {
-	double val = exp->eval(state);
-	state.setValue(var, val);
-	state.setNextLine("NULL");
-	handleGraphicsA();
-	drawString("Value updated: " + var + " = " + 
-		realToString(val), getWindowWidth()/2 + 20, orderA);
+	if (element != NULL) {
+		storeElement(state);
+		return;
+	}
+	double val = evalPostfix(code, state);
+	state.setValue(slot, val);
+	if (state.isHeadless()) return;
+	state.getDisplay()->startAfter();
+	state.getDisplay()->drawAfter("Value updated: " + getVariableName(slot) 
+		+ " = " + realToString(val));
 }
 
 /*
- * Method: handleGraphicsB
- * Usage: handleGraphicsB();
- * ------------------------------------------------------------
- * Handles initialization of printing points in for 'Before
- * Execution' column in graphics window. 
+ * Method: compile
+ * Usage: stmt->compile(compiler);
+ * ----------------------------------------------------------
+ * Emits the stored expression followed by a store into the lvalue.
+ * An element store first emits the subscripts, which the store
+ * instruction finds below the value.
  */
-void LetStmt::handleGraphicsB(){
-	if (orderB > PRINT_HEIGHT) {
-		drawImage(BG_FILE, 0, 45, COLUMN_WIDTH, COLUMN_HEIGHT);
-		orderB = 0;
+void LetStmt::compile(Compiler & compiler) {
+	if (element == NULL) {
+		compiler.compileExp(optExp);
+		compiler.emit(OP_STORE, slot);
+		return;
 	}
-	if (orderB == 0) orderB = INIT_HEIGHT;
-	orderB += 15;
+	int nSubscripts = optElement->getSubscriptCount();
+	for (int i = 0; i < nSubscripts; i++) {
+		compiler.compileExp(optElement->getSubscript(i));
+	}
+	compiler.compileExp(optExp);
+	compiler.emit((nSubscripts == 1) ? OP_STORE_ELEM1 : OP_STORE_ELEM2, slot);
+}
+
+/*
+ * Method: describe
+ * Usage: stmt->describe(display);
+ * ----------------------------------------------------------
+ * Shows the assignment as written.
+ */
+void LetStmt::describe(Display & display) {
+	string target = (element == NULL) ? getVariableName(slot) 
+									  : element->toString();
+	display.startBefore();
+	display.drawBefore("Variable stored: " + target + " = " + exp->toString());
 }
 
 /*
- * Method: handleGraphicsA
- * Usage: handleGraphicsA();
- * ------------------------------------------------------------
- * Handles initialization of printing points in for 'After
- * Execution' column in graphics window. 
+ * Method: optimize
+ * Usage: stmt->optimize(arena);
+ * ----------------------------------------------------------
+ * Stores an optimized copy of the expression in optExp
+ * and its postfix form in code, and does the same for the
+ * subscripts of an element.
  */
-void LetStmt::handleGraphicsA(){
-	if (orderA > PRINT_HEIGHT) {
-		drawImage(BG_FILE, getWindowWidth()/2 + 10,45, COLUMN_WIDTH, COLUMN_HEIGHT);
-		orderA = 0;
+void LetStmt::optimize(Arena & arena) {
+	if (element != NULL) {
+		optElement = (ArrayExp *) optimizeExp(element, arena);
+		int nSubscripts = optElement->getSubscriptCount();
+		subscriptCodes = arena.allocateArray<PostfixCode>(nSubscripts);
+		for (int i = 0; i < nSubscripts; i++) {
+			subscriptCodes[i] = compilePostfix(optElement->getSubscript(i), arena);
+		}
+	}
+	optExp = optimizeExp(exp, arena);
+	code = compilePostfix(optExp, arena);
+}
+
+/*
+ * Method: storeElement
+ * Usage: storeElement(state);
+ * ----------------------------------------------------------
+ * Evaluates the subscripts and then the expression, and stores
+ * the value into the element they select, in the same order
+ * as the bytecode does.
+ */
+void LetStmt::storeElement(EvalState & state) {
+	double i = evalPostfix(subscriptCodes[0], state);
+	bool twoDimensional = optElement->getSubscriptCount() == 2;
+	double j = twoDimensional ? evalPostfix(subscriptCodes[1], state) : 0;
+	double val = evalPostfix(code, state);
+	if (twoDimensional) {
+		*state.getElement(slot, i, j) = val;
+	} else {
+		*state.getElement(slot, i) = val;
+	}
+	if (state.isHeadless()) return;
+	string subscripts = realToString(i);
+	if (twoDimensional) subscripts += ", " + realToString(j);
+	state.getDisplay()->startAfter();
+	state.getDisplay()->drawAfter("Value updated: " + getVariableName(slot) 
+		+ "(" + subscripts + ") = " + realToString(val));
+}
+
+/*
+ * Function: shapeToString
+ * Usage: string str = shapeToString(slot, state);
+ * ------------------------------------------------------------------
+ * Returns the name and extents of the array in slot, such as A(10)
+ * or B(3, 4), for the display.
+ */
+static string shapeToString(int slot, EvalState & state) {
+	ArrayValue & array = state.getDimensionedArray(slot);
+	string str = getVariableName(slot) + "(" + integerToString(array.rows);
+	if (array.rank == 2) str += ", " + integerToString(array.cols);
+	return str + ")";
+}
+
+/*
+ * Method: DimStmt
+ * Usage: Statement *stmt = new (arena) DimStmt(lexer, arena);
+ * -------------------------------------------------
+ * Reads a list of arrays separated by commas, each with one or
+ * two extents, collects them in a vector and then copies them to
+ * an array in the arena. Checks for extraneous tokens.
+ */
+DimStmt::DimStmt(Lexer & lexer, Arena & arena) {
+	Vector<ArrayExp *> vec;
+	while (true) {
+		Token name = lexer.nextToken();
+		if (name.kind != WORD_TOKEN || !lexer.peekToken().is('(')) {
+			error("DIM needs an array such as A(10)");
+		}
+		int slot = getVariableSlot(name.text, name.length);
+		ArrayExp *array = (ArrayExp *) readArray(slot, lexer, arena);
+		if (array->isWholeArray()) {
+			error("DIM needs the extents of " + getVariableName(slot));
+		}
+		vec.add(array);
+		if (!lexer.peekToken().is(',')) break;
+		lexer.nextToken();
+	}
+	if (lexer.hasMoreTokens()) {
+		error("Extraneous token " + lexer.nextToken().getText());
+	}
+	nArrays = vec.size();
+	arrays = arena.allocateArray<ArrayExp *>(nArrays);
+	for (int i = 0; i < nArrays; i++) {
+		arrays[i] = vec[i];
+	}
+	optArrays = arrays;
+	codes = NULL;
+}
+
+/*
+ * Method: ~DimStmt()
+ * ---------------------
+ * Destructor for DimStmt subclass.
+ */
+DimStmt::~DimStmt()	{
+}
+
+/*
+ * Method: execute
+ * Usage: stmt->execute(state);
+ * ----------------------------------------------------------
+ * Evaluates the extents of each array in turn and dimensions
+ * it, replacing any array of the same name.
+ */
+void DimStmt::execute(EvalState & state) {
+	if (!state.isHeadless()) state.getDisplay()->startAfter();
+	const PostfixCode *code = codes;
+	for (int i = 0; i < nArrays; i++) {
+		int slot = optArrays[i]->getSlot();
+		int rank = optArrays[i]->getSubscriptCount();
+		double rows = evalPostfix(*code++, state);
+		double cols = (rank == 2) ? evalPostfix(*code++, state) : 1;
+		dimensionArray(state, slot, rank, rows, cols);
+		if (state.isHeadless()) continue;
+		if (i > 0) state.getDisplay()->stepAfter();
+		state.getDisplay()->drawAfter("Array dimensioned: " 
+			+ shapeToString(slot, state));
+	}
+}
+
+/*
+ * Method: compile
+ * Usage: stmt->compile(compiler);
+ * ----------------------------------------------------------
+ * Emits the extents of each array followed by a DIM
+ * instruction of its rank.
+ */
+void DimStmt::compile(Compiler & compiler) {
+	for (int i = 0; i < nArrays; i++) {
+		int rank = optArrays[i]->getSubscriptCount();
+		for (int k = 0; k < rank; k++) {
+			compiler.compileExp(optArrays[i]->getSubscript(k));
+		}
+		compiler.emit((rank == 1) ? OP_DIM1 : OP_DIM2, optArrays[i]->getSlot());
+	}
+}
+
+/*
+ * Method: describe
+ * Usage: stmt->describe(display);
+ * ----------------------------------------------------------
+ * Lists the arrays to be dimensioned, one per line.
+ */
+void DimStmt::describe(Display & display) {
+	display.startBefore();
+	for (int i = 0; i < nArrays; i++) {
+		if (i > 0) display.stepBefore();
+		display.drawBefore("Array to be dimensioned: " + arrays[i]->toString());
+	}
+}
+
+/*
+ * Method: optimize
+ * Usage: stmt->optimize(arena);
+ * ----------------------------------------------------------
+ * Stores an optimized copy of every array in optArrays and
+ * the postfix forms of all their extents, in order, in codes.
+ */
+void DimStmt::optimize(Arena & arena) {
+	optArrays = arena.allocateArray<ArrayExp *>(nArrays);
+	int nCodes = 0;
+	for (int i = 0; i < nArrays; i++) {
+		optArrays[i] = (ArrayExp *) optimizeExp(arrays[i], arena);
+		nCodes += optArrays[i]->getSubscriptCount();
+	}
+	codes = arena.allocateArray<PostfixCode>(nCodes);
+	PostfixCode *code = codes;
+	for (int i = 0; i < nArrays; i++) {
+		for (int k = 0; k < optArrays[i]->getSubscriptCount(); k++) {
+			*code++ = compilePostfix(optArrays[i]->getSubscript(k), arena);
+		}
+	}
+}
+
+/*
+ * Method: ArrayLetStmt
+ * Usage: Statement *stmt = new (arena) ArrayLetStmt(lexer, arena);
+ * -------------------------------------------------
+ * Reads the target array, written with empty parentheses, and
+ * the expression following the assignment operator. Checks for
+ * extraneous tokens. The form of the assignment is worked out
+ * by optimize.
+ */
+ArrayLetStmt::ArrayLetStmt(Lexer & lexer, Arena & arena) {
+	Token var = lexer.nextToken();
+	slot = getVariableSlot(var.text, var.length);
+	lexer.nextToken();
+	lexer.nextToken();
+	Token op = lexer.nextToken();
+	if (!op.is('=')) error("Illegal operator: " + op.getText());
+	exp = readE(lexer, arena);
+	if (lexer.hasMoreTokens()) {
+		error("Extraneous token " + lexer.nextToken().getText());
+	}
+	form = FILL;
+	this->op = ARRAY_ADD;
+	xSlot = ySlot = -1;
+	scalar = NULL;
+}
+
+/*
+ * Method: ~ArrayLetStmt()
+ * ---------------------
+ * Destructor for ArrayLetStmt subclass.
+ */
+ArrayLetStmt::~ArrayLetStmt()	{
+}
+
+/*
+ * Method: execute
+ * Usage: stmt->execute(state);
+ * ----------------------------------------------------------
+ * Evaluates the scalar, if any, and hands the assignment to
+ * the functions of arrays.h.
+ */
+void ArrayLetStmt::execute(EvalState & state) {
+	switch (form) {
+	case COPY: 
+		copyArray(state, slot, xSlot); 
+		break;
+	case FILL: 
+		fillArray(state, slot, evalPostfix(scalarCode, state)); 
+		break;
+	case COMBINE: 
+		combineArrays(state, op, slot, xSlot, ySlot); 
+		break;
+	case ARRAY_SCALAR:
+		combineArrayScalar(state, op, slot, xSlot, evalPostfix(scalarCode, state));
+		break;
+	case SCALAR_ARRAY:
+		combineScalarArray(state, op, slot, evalPostfix(scalarCode, state), xSlot);
+		break;
+	}
+	if (state.isHeadless()) return;
+	state.getDisplay()->startAfter();
+	state.getDisplay()->drawAfter("Array updated: " + shapeToString(slot, state));
+}
+
+/*
+ * Method: compile
+ * Usage: stmt->compile(compiler);
+ * ----------------------------------------------------------
+ * Emits the scalar, if any, followed by the single array
+ * instruction of the form.
+ */
+void ArrayLetStmt::compile(Compiler & compiler) {
+	if (scalar != NULL) compiler.compileExp(scalar);
+	switch (form) {
+	case COPY: compiler.emit(OP_ARRAY_COPY, slot, xSlot); break;
+	case FILL: compiler.emit(OP_ARRAY_FILL, slot); break;
+	case COMBINE: compiler.emit(OP_ARRAY_OP, slot, xSlot, ySlot, op); break;
+	case ARRAY_SCALAR: compiler.emit(OP_ARRAY_SCALAR, slot, xSlot, op); break;
+	case SCALAR_ARRAY: compiler.emit(OP_SCALAR_ARRAY, slot, xSlot, op); break;
+	}
+}
+
+/*
+ * Method: describe
+ * Usage: stmt->describe(display);
+ * ----------------------------------------------------------
+ * Shows the assignment as written.
+ */
+void ArrayLetStmt::describe(Display & display) {
+	display.startBefore();
+	display.drawBefore("Array stored: " + getVariableName(slot) + "() = " 
+		+ exp->toString());
+}
+
+/*
+ * Method: optimize
+ * Usage: stmt->optimize(arena);
+ * ----------------------------------------------------------
+ * Classifies the optimized expression and stores the postfix
+ * form of its scalar, if any, in scalarCode.
+ */
+void ArrayLetStmt::optimize(Arena & arena) {
+	classify(optimizeExp(exp, arena));
+	if (scalar != NULL) scalarCode = compilePostfix(scalar, arena);
+}
+
+/*
+ * Functions: isWholeArray, hasWholeArray
+ * Usage: if (isWholeArray(exp)) ...
+ *        if (hasWholeArray(exp)) ...
+ * ----------------------------------------------------------
+ * Return true if exp is a whole array, or has one anywhere
+ * among its operands.
+ */
+static bool isWholeArray(Expression *exp) {
+	return exp->getType() == ARRAY && ((ArrayExp *) exp)->isWholeArray();
+}
+
+static bool hasWholeArray(Expression *exp) {
+	if (exp->getType() != COMPOUND) return isWholeArray(exp);
+	CompoundExp *node = (CompoundExp *) exp;
+	return hasWholeArray(node->getLHS()) || hasWholeArray(node->getRHS());
+}
+
+/*
+ * Method: classify
+ * Usage: classify(optExp);
+ * ----------------------------------------------------------
+ * Sets form, op, the operand slots and the scalar from the
+ * shape of the optimized expression, raising an error for
+ * any expression that is not one of the forms of the class.
+ */
+void ArrayLetStmt::classify(Expression *optExp) {
+	if (isWholeArray(optExp)) {
+		form = COPY;
+		xSlot = ((ArrayExp *) optExp)->getSlot();
+		return;
+	}
+	if (!hasWholeArray(optExp)) {
+		form = FILL;
+		scalar = optExp;
+		return;
+	}
+	if (optExp->getType() == COMPOUND) {
+		CompoundExp *node = (CompoundExp *) optExp;
+		Expression *lhs = node->getLHS();
+		Expression *rhs = node->getRHS();
+		bool validOp = true;
+		switch (node->getOperator()) {
+		case PLUS_OP: op = ARRAY_ADD; break;
+		case MINUS_OP: op = ARRAY_SUB; break;
+		case TIMES_OP: op = ARRAY_MUL; break;
+		case DIVIDE_OP: op = ARRAY_DIV; break;
+		default: validOp = false; break;
+		}
+		if (validOp && isWholeArray(lhs) && isWholeArray(rhs)) {
+			form = COMBINE;
+			xSlot = ((ArrayExp *) lhs)->getSlot();
+			ySlot = ((ArrayExp *) rhs)->getSlot();
+			return;
+		}
+		if (validOp && isWholeArray(lhs) && !hasWholeArray(rhs)) {
+			form = ARRAY_SCALAR;
+			xSlot = ((ArrayExp *) lhs)->getSlot();
+			scalar = rhs;
+			return;
+		}
+		if (validOp && !hasWholeArray(lhs) && isWholeArray(rhs)) {
+			form = SCALAR_ARRAY;
+			xSlot = ((ArrayExp *) rhs)->getSlot();
+			scalar = lhs;
+			return;
+		}
+	}
+	error("Array assignment takes a single operator: "
+		  "A() = B() op C(), B() op k or k op B()");
+}
+
+/*
+ * Function: readMatrix
+ * Usage: int slot = readMatrix(lexer);
+ * ------------------------------------------------------------------
+ * Reads the name of an array in a MAT statement, with or without
+ * empty parentheses, and returns its slot.
+ */
+static int readMatrix(Lexer & lexer) {
+	Token name = lexer.nextToken();
+	if (name.kind != WORD_TOKEN) {
+		error("MAT needs an array name, not " + name.getText());
+	}
+	if (lexer.peekToken().is('(')) {
+		lexer.nextToken();
+		if (!lexer.nextToken().is(')')) {
+			error("MAT takes whole arrays, such as A or A()");
+		}
+	}
+	return getVariableSlot(name.text, name.length);
+}
+
+/*
+ * Method: MatStmt
+ * Usage: Statement *stmt = new (arena) MatStmt(lexer);
+ * -------------------------------------------------
+ * Reads the target matrix, the assignment operator and one of
+ * the forms of the right-hand side: a matrix, two matrices
+ * joined by +, - or *, or TRN or INV of a matrix in parentheses.
+ * TRN and INV followed by empty parentheses name arrays, which
+ * is told apart through a copy of the lexer. Checks for 
+ * extraneous tokens.
+ */
+MatStmt::MatStmt(Lexer & lexer) {
+	slot = readMatrix(lexer);
+	Token op = lexer.nextToken();
+	if (!op.is('=')) error("Illegal operator: " + op.getText());
+	ySlot = -1;
+	Lexer probe = lexer;
+	Keyword keyword = probe.nextToken().keyword;
+	if ((keyword == TRN_KW || keyword == INV_KW) && probe.nextToken().is('(')
+		&& !probe.nextToken().is(')')) {
+		form = (keyword == TRN_KW) ? TRANSPOSE : INVERT;
+		lexer.nextToken();
+		lexer.nextToken();
+		xSlot = readMatrix(lexer);
+		if (!lexer.nextToken().is(')')) {
+			error("Unbalanced parentheses in MAT statement");
+		}
+	} else {
+		xSlot = readMatrix(lexer);
+		form = COPY;
+		if (lexer.hasMoreTokens()) {
+			switch (lexer.nextToken().op) {
+			case PLUS_OP: form = ADD; break;
+			case MINUS_OP: form = SUBTRACT; break;
+			case TIMES_OP: form = MULTIPLY; break;
+			default: 
+				error("MAT takes A + B, A - B, A * B, TRN(A) or INV(A)");
+			}
+			ySlot = readMatrix(lexer);
+		}
+	}
+	if (lexer.hasMoreTokens()) {
+		error("Extraneous token " + lexer.nextToken().getText());
+	}
+}
+
+/*
+ * Method: ~MatStmt()
+ * ---------------------
+ * Destructor for MatStmt subclass.
+ */
+MatStmt::~MatStmt()	{
+}
+
+/*
+ * Method: execute
+ * Usage: stmt->execute(state);
+ * ----------------------------------------------------------
+ * Hands the assignment to the functions of arrays.h.
+ */
+void MatStmt::execute(EvalState & state) {
+	switch (form) {
+	case COPY: copyArray(state, slot, xSlot); break;
+	case ADD: combineArrays(state, ARRAY_ADD, slot, xSlot, ySlot); break;
+	case SUBTRACT: combineArrays(state, ARRAY_SUB, slot, xSlot, ySlot); break;
+	case MULTIPLY: multiplyArrays(state, slot, xSlot, ySlot); break;
+	case TRANSPOSE: transposeArray(state, slot, xSlot); break;
+	case INVERT: invertArray(state, slot, xSlot); break;
+	}
+	if (state.isHeadless()) return;
+	state.getDisplay()->startAfter();
+	state.getDisplay()->drawAfter("Array updated: " + shapeToString(slot, state));
+}
+
+/*
+ * Method: compile
+ * Usage: stmt->compile(compiler);
+ * ----------------------------------------------------------
+ * Emits the single array instruction of the form. Copies, sums
+ * and differences share their instructions with ArrayLetStmt.
+ */
+void MatStmt::compile(Compiler & compiler) {
+	switch (form) {
+	case COPY: compiler.emit(OP_ARRAY_COPY, slot, xSlot); break;
+	case ADD: compiler.emit(OP_ARRAY_OP, slot, xSlot, ySlot, ARRAY_ADD); break;
+	case SUBTRACT: compiler.emit(OP_ARRAY_OP, slot, xSlot, ySlot, ARRAY_SUB); break;
+	case MULTIPLY: compiler.emit(OP_MAT_MUL, slot, xSlot, ySlot); break;
+	case TRANSPOSE: compiler.emit(OP_MAT_TRN, slot, xSlot); break;
+	case INVERT: compiler.emit(OP_MAT_INV, slot, xSlot); break;
+	}
+}
+
+/*
+ * Method: describe
+ * Usage: stmt->describe(display);
+ * ----------------------------------------------------------
+ * Shows the assignment in its normalized form.
+ */
+void MatStmt::describe(Display & display) {
+	display.startBefore();
+	display.drawBefore("Matrix stored: MAT " + getVariableName(slot) + " = " 
+		+ formToString());
+}
+
+/*
+ * Method: formToString
+ * Usage: string str = formToString();
+ * ----------------------------------------------------------
+ * Returns the right-hand side of the assignment.
+ */
+string MatStmt::formToString() {
+	string x = getVariableName(xSlot);
+	switch (form) {
+	case ADD: return x + " + " + getVariableName(ySlot);
+	case SUBTRACT: return x + " - " + getVariableName(ySlot);
+	case MULTIPLY: return x + " * " + getVariableName(ySlot);
+	case TRANSPOSE: return "TRN(" + x + ")";
+	case INVERT: return "INV(" + x + ")";
+	default: return x;
 	}
-	if (orderA == 0) orderA = INIT_HEIGHT;
-	orderA += 15;
 }
 
 /*
  * Method: Goto
- * Usage: Statement *stmt = new GotoStmt(scanner);
+ * Usage: Statement *stmt = new (arena) GotoStmt(lexer);
  * -------------------------------------------------
- * Checks for extraneous tokens, and creates an InputStmt
+ * Checks for extraneous tokens, and creates a GotoStmt
  * object that stores the number following the statement in 
- * an instance variable.
+ * an instance variable. The target statement itself is
+ * resolved by link.
  */
-GotoStmt::GotoStmt(TokenScanner & scanner) {
-	next = scanner.nextToken();
-	if (scanner.hasMoreTokens()) {
-		error("Extraneous token " + scanner.nextToken());
+GotoStmt::GotoStmt(Lexer & lexer) {
+	Token token = lexer.nextToken();
+	if(!token.isInteger()){
+		error("GOTO needs to be followed by an integer line number");
+	}
+	next = (int) token.number;
+	target = NULL;
+	if (lexer.hasMoreTokens()) {
+		error("Extraneous token " + lexer.nextToken().getText());
 	}
-	handleGraphicsB();
-	drawString("Will skip to line " + next + 
-		" during execution.", 20, orderB);
 }
 
 /*
@@ -424,67 +1010,64 @@ GotoStmt::~GotoStmt()	{
 
 /*
  * Method: execute
- * Usage: program.getParsedStatement(index)->execute(state);
+ * Usage: stmt->execute(state);
  * ----------------------------------------------------------
  * Forces program to execute the stored line number, instead of 
  * what is in its usual order.
  */
 void GotoStmt::execute(EvalState & state) {
-	state.setNextLine(next);
-	handleGraphicsA();
-	drawString("Skipped to line: " + next, 
-		getWindowWidth()/2 + 20, orderA);
+	state.setNextStatement(target);
+	if (state.isHeadless()) return;
+	state.getDisplay()->startAfter();
+	state.getDisplay()->drawAfter("Skipped to line: " + integerToString(next));
 }
 
 /*
- * Method: handleGraphicsB
- * Usage: handleGraphicsB();
- * ------------------------------------------------------------
- * Handles initialization of printing points in for 'Before
- * Execution' column in graphics window. 
+ * Method: compile
+ * Usage: stmt->compile(compiler);
+ * ----------------------------------------------------------
+ * Emits an unconditional jump to the stored line number.
  */
-void GotoStmt::handleGraphicsB(){
-	if (orderB > PRINT_HEIGHT) {
-		drawImage(BG_FILE, 0, 45, COLUMN_WIDTH, COLUMN_HEIGHT);
-		orderB = 0;
-	}
-	if (orderB == 0) orderB = INIT_HEIGHT;
-	orderB += 15;
+void GotoStmt::compile(Compiler & compiler) {
+	compiler.emitJump(OP_JUMP, next);
 }
 
 /*
- * Method: handleGraphicsA
- * Usage: handleGraphicsA();
- * ------------------------------------------------------------
- * Handles initialization of printing points in for 'After
- * Execution' column in graphics window. 
+ * Method: describe
+ * Usage: stmt->describe(display);
+ * ----------------------------------------------------------
+ * Shows the line that execution will skip to.
  */
-void GotoStmt::handleGraphicsA(){
-	if (orderA > PRINT_HEIGHT) {
-		drawImage(BG_FILE, getWindowWidth()/2 + 10,45, COLUMN_WIDTH, COLUMN_HEIGHT);
-		orderA = 0;
-	}
-	if (orderA == 0) orderA = INIT_HEIGHT;
-	orderA += 15;
+void GotoStmt::describe(Display & display) {
+	display.startBefore();
+	display.drawBefore("Will skip to line " + integerToString(next) 
+		+ " during execution.");
+}
+
+/*
+ * Method: link
+ * Usage: stmt->link(program);
+ * ----------------------------------------------------------
+ * Resolves the stored line number to the statement it names.
+ */
+void GotoStmt::link(Program & program) {
+	target = resolveTarget(program, next, "GOTO", getLineNumber());
 }
 
 /*
  * Method: IfStmt
- * Usage: Statement *stmt = new IfStmt(scanner);
+ * Usage: Statement *stmt = new (arena) IfStmt(lexer, arena);
  * -------------------------------------------------
  * Ensures the validity of statement syntax, and checks for 
  * extraneous tokens. Creates an IfStmt object that stores 
  * the operator and the expressions on either side of the
  * operator in instance variable.
  */
-IfStmt::IfStmt(TokenScanner & scanner) {
-	storeExp(scanner);
-	if (scanner.hasMoreTokens()) {
-		error("Extraneous token " + scanner.nextToken());
+IfStmt::IfStmt(Lexer & lexer, Arena & arena) {
+	storeExp(lexer, arena);
+	if (lexer.hasMoreTokens()) {
+		error("Extraneous token " + lexer.nextToken().getText());
 	}
-	handleGraphicsB();
-	drawString("Condition stored: " + expL->toString() + " " 
-					+ op + " " + expR->toString(), 20, orderB);
 }
 
 /*
@@ -493,13 +1076,11 @@ IfStmt::IfStmt(TokenScanner & scanner) {
  * Destructor for IfStmt subclass.
  */
 IfStmt::~IfStmt()	{
-	delete expL;
-	delete expR;
 }
 
 /*
  * Method: execute
- * Usage: program.getParsedStatement(index)->execute(state);
+ * Usage: stmt->execute(state);
  * ----------------------------------------------------------
  * Compares the two stored expressions according to operator (=, > or <).
  * If condition holds, forces program to execute the stored line number
@@ -508,27 +1089,95 @@ IfStmt::~IfStmt()	{
  */
 void IfStmt::execute(EvalState & state) {
 	bool result = processCondition(state);
-	handleGraphicsA();
-	displayResult(result, state);
+	if (result) state.setNextStatement(target);
+	if (state.isHeadless()) return;
+	state.getDisplay()->startAfter();
+	displayResult(*state.getDisplay(), result);
+}
+
+/*
+ * Method: compile
+ * Usage: stmt->compile(compiler);
+ * ----------------------------------------------------------
+ * Emits both expressions followed by a conditional jump matching
+ * the operator.  As in processCondition, any other operator never
+ * holds, so nothing is emitted for it.
+ */
+void IfStmt::compile(Compiler & compiler) {
+	Opcode jump;
+	switch (op) {
+	case EQUAL_OP: jump = OP_JUMP_EQ; break;
+	case GREATER_OP: jump = OP_JUMP_GT; break;
+	case LESS_OP: jump = OP_JUMP_LT; break;
+	default: return;
+	}
+	CompoundExp *test = (CompoundExp *) cond;
+	compiler.compileExp(test->getLHS());
+	compiler.compileExp(test->getRHS());
+	compiler.emitJump(jump, next);
+}
+
+/*
+ * Method: link
+ * Usage: stmt->link(program);
+ * ----------------------------------------------------------
+ * Resolves the stored line number to the statement it names.
+ */
+void IfStmt::link(Program & program) {
+	target = resolveTarget(program, next, "IF", getLineNumber());
+}
+
+/*
+ * Method: describe
+ * Usage: stmt->describe(display);
+ * ----------------------------------------------------------
+ * Shows the condition as written.
+ */
+void IfStmt::describe(Display & display) {
+	display.startBefore();
+	display.drawBefore("Condition stored: " + expL->toString() + " " 
+		+ operatorToString(op) + " " + expR->toString());
+}
+
+/*
+ * Method: optimize
+ * Usage: stmt->optimize(arena);
+ * ----------------------------------------------------------
+ * Combines optimized copies of both sides of a valid comparison
+ * into a single (usually specialized) compound node, cond, and
+ * stores its postfix form in test.
+ */
+void IfStmt::optimize(Arena & arena) {
+	if (op == INVALID_OP) return;
+	cond = newCompoundExp(op, optimizeExp(expL, arena), 
+						  optimizeExp(expR, arena), arena);
+	test = compilePostfix(cond, arena);
 }
 
 /*
  * Method: storeExp
- * Usage:storeExp(scanner);
+ * Usage:storeExp(lexer, arena);
  * -------------------------------------------------
- * Receives a scanner and parses the expression to
+ * Receives a lexer and parses the expression to
  * the condition components and redirection command. 
+ * The operator is converted to an Operator once here. Any
+ * operator other than =, < and > becomes INVALID_OP, and
+ * such a condition never holds.
  */
-void IfStmt::storeExp(TokenScanner & scanner){
-	expL = readE(scanner);
-	op = scanner.nextToken();
-	expR = readE(scanner);
-	string then = scanner.nextToken();
-	if(then != "THEN" && then != "then") error("Incorrect command format.");
-	next = scanner.nextToken();
-	if(scanner.getTokenType(next) != NUMBER){
+void IfStmt::storeExp(Lexer & lexer, Arena & arena){
+	expL = readE(lexer, arena);
+	op = lexer.nextToken().op;
+	if (op == ASSIGN_OP) op = EQUAL_OP;
+	if (op != EQUAL_OP && op != LESS_OP && op != GREATER_OP) op = INVALID_OP;
+	expR = readE(lexer, arena);
+	cond = NULL;
+	if(lexer.nextToken().keyword != THEN_KW) error("Incorrect command format.");
+	Token token = lexer.nextToken();
+	if(!token.isInteger()){
 		error("Condition result needs to be an integer line number");
 	}
+	next = (int) token.number;
+	target = NULL;
 }
 
 /*
@@ -539,84 +1188,529 @@ void IfStmt::storeExp(TokenScanner & scanner){
  * and returns of the condition holds or not.
  */
 bool IfStmt::processCondition(EvalState & state){
-	if(op == "=") {
-		if (expL->eval(state) == expR->eval(state)) return true;
-	}
-	if(op == ">") {
-		if (expL->eval(state) > expR->eval(state)) return true;
-	}
-	if(op == "<") {
-		if (expL->eval(state) < expR->eval(state)) return true;
-	}
-	return false;
+	return cond != NULL && evalPostfix(test, state) != 0;
 }
 
 /*
  * Method: displayResult
- * Usage: void displayResult(bool result);
+ * Usage: void displayResult(display, result);
  * -------------------------------------------------
  * Receives a boolean and accordingly prints the result
- * on the graphics window and reroutes program execution.
+ * on the display.
  */
-void IfStmt::displayResult(bool result, EvalState & state){
+void IfStmt::displayResult(Display & display, bool result){
 	if(result) {
-		state.setNextLine(next);
-		drawString("Condition " + expL->toString() + " " + op 
-			+ " " + expR->toString() + " is TRUE. Skippin to line " 
-			+ next,  getWindowWidth()/2 + 20, orderA);
+		display.drawAfter("Condition " + expL->toString() + " " 
+			+ operatorToString(op) + " " + expR->toString() 
+			+ " is TRUE. Skippin to line " + integerToString(next));
+	} else {
+		display.drawAfter("Condition " + expL->toString() + " " 
+			+ operatorToString(op) + " " + expR->toString() 
+			+ " is FALSE. Execution order remains.");
+	}
+}
+
+/*
+ * Method: ForStmt
+ * Usage: Statement *stmt = new (arena) ForStmt(lexer, arena);
+ * -------------------------------------------------
+ * Checks for a variable, an assignment operator and the word
+ * TO, and for extraneous tokens. Creates a ForStmt object that
+ * stores the slot of the counter and the expressions for the
+ * start, the limit and the optional step in instance variables.
+ */
+ForStmt::ForStmt(Lexer & lexer, Arena & arena) {
+	Token var = lexer.nextToken();
+	if (var.kind != WORD_TOKEN) error("Illegal variable: " + var.getText());
+	slot = getVariableSlot(var.text, var.length);
+	Token op = lexer.nextToken();
+	if (!op.is('=')) error("Illegal operator: " + op.getText());
+	start = readE(lexer, arena);
+	if (lexer.nextToken().keyword != TO_KW) error("FOR needs TO before its limit");
+	limit = readE(lexer, arena);
+	step = NULL;
+	if (lexer.peekToken().keyword == STEP_KW) {
+		lexer.nextToken();
+		step = readE(lexer, arena);
+	}
+	optStart = optLimit = optStep = NULL;
+	limitSlot = stepSlot = -1;
+	closer = NULL;
+	if (lexer.hasMoreTokens()) {
+		error("Extraneous token " + lexer.nextToken().getText());
+	}
+}
+
+/*
+ * Method: ~ForStmt()
+ * ---------------------
+ * Destructor for ForStmt subclass.
+ */
+ForStmt::~ForStmt()	{
+}
+
+/*
+ * Method: execute
+ * Usage: stmt->execute(state);
+ * ----------------------------------------------------------
+ * Evaluates the start, the limit and the step, stores them and
+ * skips past the matching NEXT if the loop does not run at all.
+ */
+void ForStmt::execute(EvalState & state) {
+	double value = evalPostfix(startCode, state);
+	double to = evalPostfix(limitCode, state);
+	double by = (step == NULL) ? 1 : evalPostfix(stepCode, state);
+	state.setValue(stepSlot, by);
+	state.setValue(limitSlot, to);
+	state.setValue(slot, value);
+	bool running = isLoopRunning(value, to, by);
+	if (!running) state.setNextStatement(closer->getSuccessor());
+	if (state.isHeadless()) return;
+	state.getDisplay()->startAfter();
+	if (running) {
+		state.getDisplay()->drawAfter("Loop started: " + getVariableName(slot) 
+			+ " = " + realToString(value));
+	} else {
+		state.getDisplay()->drawAfter("Loop skipped: " + getVariableName(slot) 
+			+ " = " + realToString(value) + " is past " + realToString(to));
+	}
+}
+
+/*
+ * Method: compile
+ * Usage: stmt->compile(compiler);
+ * ----------------------------------------------------------
+ * Emits the three expressions and stores them in the order the
+ * stack returns them, followed by a jump past the matching NEXT
+ * (or to the end of the program) for a loop that does not run.
+ */
+void ForStmt::compile(Compiler & compiler) {
+	compiler.compileExp(optStart);
+	compiler.compileExp(optLimit);
+	if (optStep == NULL) {
+		compiler.emit(OP_CONST, compiler.constantIndex(1));
+	} else {
+		compiler.compileExp(optStep);
+	}
+	compiler.emit(OP_STORE, stepSlot);
+	compiler.emit(OP_STORE, limitSlot);
+	compiler.emit(OP_STORE, slot);
+	Statement *exit = closer->getSuccessor();
+	compiler.emitJump(OP_FOR_ENTER, slot, limitSlot, stepSlot, 
+					  (exit == NULL) ? PROGRAM_END : exit->getLineNumber());
+}
+
+/*
+ * Method: describe
+ * Usage: stmt->describe(display);
+ * ----------------------------------------------------------
+ * Shows the loop as written.
+ */
+void ForStmt::describe(Display & display) {
+	string text = getVariableName(slot) + " = " + start->toString() 
+		+ " TO " + limit->toString();
+	if (step != NULL) text += " STEP " + step->toString();
+	display.startBefore();
+	display.drawBefore("Loop stored: " + text);
+}
+
+/*
+ * Method: link
+ * Usage: stmt->link(program);
+ * ----------------------------------------------------------
+ * Opens the loop for the matching NEXT to close and assigns the
+ * hidden variables, whose names hold a space and the line number
+ * so that no program can use them and no two loops share them.
+ */
+void ForStmt::link(Program & program) {
+	program.openLoop(this, "FOR", "NEXT");
+	closer = NULL;
+	string prefix = "FOR " + integerToString(getLineNumber());
+	limitSlot = program.addHiddenVariable(prefix + " TO");
+	stepSlot = program.addHiddenVariable(prefix + " STEP");
+}
+
+/*
+ * Method: optimize
+ * Usage: stmt->optimize(arena);
+ * ----------------------------------------------------------
+ * Stores optimized copies of the expressions and their postfix
+ * forms.
+ */
+void ForStmt::optimize(Arena & arena) {
+	optStart = optimizeExp(start, arena);
+	startCode = compilePostfix(optStart, arena);
+	optLimit = optimizeExp(limit, arena);
+	limitCode = compilePostfix(optLimit, arena);
+	if (step != NULL) {
+		optStep = optimizeExp(step, arena);
+		stepCode = compilePostfix(optStep, arena);
+	}
+}
+
+/*
+ * Methods: getVariable, getLimitSlot, getStepSlot
+ * Usage: int slot = header->getVariable();
+ * ----------------------------------------------------------
+ * Return the slots of the counter and of the hidden variables
+ * holding the limit and the step, for the matching NEXT.
+ */
+int ForStmt::getVariable() {
+	return slot;
+}
+
+int ForStmt::getLimitSlot() {
+	return limitSlot;
+}
+
+int ForStmt::getStepSlot() {
+	return stepSlot;
+}
+
+/*
+ * Method: close
+ * Usage: header->close(stmt);
+ * ----------------------------------------------------------
+ * Records the NEXT that closes this loop, whose successor is
+ * where the loop exits.
+ */
+void ForStmt::close(Statement *next) {
+	closer = next;
+}
+
+/*
+ * Method: NextStmt
+ * Usage: Statement *stmt = new (arena) NextStmt(lexer);
+ * -------------------------------------------------
+ * Checks for extraneous tokens, and creates a NextStmt object
+ * that stores the slot of the counter if one is named. The loop
+ * itself is found by link.
+ */
+NextStmt::NextStmt(Lexer & lexer) {
+	slot = -1;
+	if (lexer.hasMoreTokens()) {
+		Token var = lexer.nextToken();
+		if (var.kind != WORD_TOKEN) error("Illegal variable: " + var.getText());
+		slot = getVariableSlot(var.text, var.length);
+	}
+	header = NULL;
+	if (lexer.hasMoreTokens()) {
+		error("Extraneous token " + lexer.nextToken().getText());
+	}
+}
+
+/*
+ * Method: ~NextStmt()
+ * ---------------------
+ * Destructor for NextStmt subclass.
+ */
+NextStmt::~NextStmt()	{
+}
+
+/*
+ * Method: execute
+ * Usage: stmt->execute(state);
+ * ----------------------------------------------------------
+ * Adds the step to the counter and goes back to the line after
+ * the FOR unless the counter has passed the limit. A limit that
+ * was never stored means that the FOR has not run in this run, as
+ * every run starts with the hidden variables cleared.
+ */
+void NextStmt::execute(EvalState & state) {
+	int counter = header->getVariable();
+	if (!state.isDefined(header->getLimitSlot())) {
+		error("NEXT " + getVariableName(counter) + " without FOR");
+	}
+	double by = state.getValue(header->getStepSlot());
+	double value = state.getValue(counter) + by;
+	state.setValue(counter, value);
+	double to = state.getValue(header->getLimitSlot());
+	bool running = isLoopRunning(value, to, by);
+	if (running) state.setNextStatement(header->getSuccessor());
+	if (state.isHeadless()) return;
+	state.getDisplay()->startAfter();
+	string text = "Value updated: " + getVariableName(counter) + " = " 
+		+ realToString(value);
+	if (running) {
+		state.getDisplay()->drawAfter(text + ". Loop continues at line " 
+			+ integerToString(header->getSuccessor()->getLineNumber()));
 	} else {
-		state.setNextLine("NULL");
-		drawString("Condition " + expL->toString() + " " + op 
-			+ " " + expR->toString() + " is FALSE. Execution "
-			+ "order remains.", getWindowWidth()/2 + 20, orderA);
+		state.getDisplay()->drawAfter(text + ". Loop finished.");
 	}
 }
 
 /*
- * Method: handleGraphicsB
- * Usage: handleGraphicsB();
- * ------------------------------------------------------------
- * Handles initialization of printing points in for 'Before
- * Execution' column in graphics window. 
+ * Method: compile
+ * Usage: stmt->compile(compiler);
+ * ----------------------------------------------------------
+ * Emits a single instruction that steps the counter and jumps
+ * back to the line after the FOR.
  */
-void IfStmt::handleGraphicsB(){
-	if (orderB > PRINT_HEIGHT) {
-		drawImage(BG_FILE, 0, 45, COLUMN_WIDTH, COLUMN_HEIGHT);
-		orderB = 0;
+void NextStmt::compile(Compiler & compiler) {
+	compiler.emitJump(OP_FOR_NEXT, header->getVariable(), 
+					  header->getLimitSlot(), header->getStepSlot(), 
+					  header->getSuccessor()->getLineNumber());
+}
+
+/*
+ * Method: describe
+ * Usage: stmt->describe(display);
+ * ----------------------------------------------------------
+ * Shows the counter that will be stepped.
+ */
+void NextStmt::describe(Display & display) {
+	string counter = (slot < 0) ? "the counter of the innermost FOR" 
+								: getVariableName(slot);
+	display.startBefore();
+	display.drawBefore("Will step " + counter + " and repeat the loop.");
+}
+
+/*
+ * Method: link
+ * Usage: stmt->link(program);
+ * ----------------------------------------------------------
+ * Closes the innermost open loop, which must be a FOR over the
+ * counter this statement names, if any.
+ */
+void NextStmt::link(Program & program) {
+	header = (ForStmt *) program.closeLoop("FOR", "NEXT", getLineNumber());
+	if (slot >= 0 && slot != header->getVariable()) {
+		error("NEXT " + getVariableName(slot) + " on line " 
+			+ integerToString(getLineNumber()) + " does not match the FOR " 
+			+ getVariableName(header->getVariable()) + " on line " 
+			+ integerToString(header->getLineNumber()));
 	}
-	if (orderB == 0) orderB = INIT_HEIGHT;
-	orderB += 15;
+	header->close(this);
 }
 
 /*
- * Method: handleGraphicsA
- * Usage: handleGraphicsA();
- * ------------------------------------------------------------
- * Handles initialization of printing points in for 'After
- * Execution' column in graphics window. 
+ * Method: WhileStmt
+ * Usage: Statement *stmt = new (arena) WhileStmt(lexer, arena);
+ * -------------------------------------------------
+ * Ensures the validity of the condition, which compares two
+ * expressions with =, < or > as in IF, and checks for
+ * extraneous tokens.
  */
-void IfStmt::handleGraphicsA(){
-	if (orderA > PRINT_HEIGHT) {
-		drawImage(BG_FILE, getWindowWidth()/2 + 10,45, COLUMN_WIDTH, COLUMN_HEIGHT);
-		orderA = 0;
+WhileStmt::WhileStmt(Lexer & lexer, Arena & arena) {
+	expL = readE(lexer, arena);
+	op = lexer.nextToken().op;
+	if (op == ASSIGN_OP) op = EQUAL_OP;
+	if (op != EQUAL_OP && op != LESS_OP && op != GREATER_OP) {
+		error("WHILE needs a comparison with =, < or >");
+	}
+	expR = readE(lexer, arena);
+	cond = NULL;
+	closer = NULL;
+	if (lexer.hasMoreTokens()) {
+		error("Extraneous token " + lexer.nextToken().getText());
 	}
-	if (orderA == 0) orderA = INIT_HEIGHT;
-	orderA += 15;
+}
+
+/*
+ * Method: ~WhileStmt()
+ * ---------------------
+ * Destructor for WhileStmt subclass.
+ */
+WhileStmt::~WhileStmt()	{
+}
+
+/*
+ * Method: execute
+ * Usage: stmt->execute(state);
+ * ----------------------------------------------------------
+ * Skips past the matching WEND if the condition does not hold.
+ */
+void WhileStmt::execute(EvalState & state) {
+	bool result = processCondition(state);
+	if (!result) state.setNextStatement(closer->getSuccessor());
+	if (state.isHeadless()) return;
+	state.getDisplay()->startAfter();
+	state.getDisplay()->drawAfter("Condition " + conditionToString() 
+		+ (result ? " is TRUE. Loop entered." : " is FALSE. Loop skipped."));
+}
+
+/*
+ * Method: compile
+ * Usage: stmt->compile(compiler);
+ * ----------------------------------------------------------
+ * Emits a jump to the matching WEND, which tests the condition,
+ * so that each pass runs a single conditional jump.
+ */
+void WhileStmt::compile(Compiler & compiler) {
+	compiler.emitJump(OP_JUMP, closer->getLineNumber());
+}
+
+/*
+ * Method: describe
+ * Usage: stmt->describe(display);
+ * ----------------------------------------------------------
+ * Shows the condition as written.
+ */
+void WhileStmt::describe(Display & display) {
+	display.startBefore();
+	display.drawBefore("Condition stored: " + conditionToString());
+}
+
+/*
+ * Method: link
+ * Usage: stmt->link(program);
+ * ----------------------------------------------------------
+ * Opens the loop for the matching WEND to close.
+ */
+void WhileStmt::link(Program & program) {
+	program.openLoop(this, "WHILE", "WEND");
+	closer = NULL;
+}
+
+/*
+ * Method: optimize
+ * Usage: stmt->optimize(arena);
+ * ----------------------------------------------------------
+ * Combines optimized copies of both sides into a single
+ * compound node, cond, and stores its postfix form in test.
+ */
+void WhileStmt::optimize(Arena & arena) {
+	cond = newCompoundExp(op, optimizeExp(expL, arena), 
+						  optimizeExp(expR, arena), arena);
+	test = compilePostfix(cond, arena);
+}
+
+/*
+ * Method: processCondition
+ * Usage: if (header->processCondition(state)) ...
+ * ----------------------------------------------------------
+ * Returns true if the condition holds.
+ */
+bool WhileStmt::processCondition(EvalState & state) {
+	return evalPostfix(test, state) != 0;
+}
+
+/*
+ * Method: compileCondition
+ * Usage: header->compileCondition(compiler, next);
+ * ----------------------------------------------------------
+ * Emits both sides of the condition followed by a conditional
+ * jump to line next, taken when the condition holds.
+ */
+void WhileStmt::compileCondition(Compiler & compiler, int next) {
+	Opcode jump = OP_JUMP_EQ;
+	if (op == LESS_OP) jump = OP_JUMP_LT;
+	if (op == GREATER_OP) jump = OP_JUMP_GT;
+	CompoundExp *test = (CompoundExp *) cond;
+	compiler.compileExp(test->getLHS());
+	compiler.compileExp(test->getRHS());
+	compiler.emitJump(jump, next);
+}
+
+/*
+ * Method: conditionToString
+ * Usage: string str = header->conditionToString();
+ * ----------------------------------------------------------
+ * Returns the condition as written.
+ */
+string WhileStmt::conditionToString() {
+	return expL->toString() + " " + operatorToString(op) + " " 
+		+ expR->toString();
+}
+
+/*
+ * Method: close
+ * Usage: header->close(stmt);
+ * ----------------------------------------------------------
+ * Records the WEND that closes this loop, whose successor is
+ * where the loop exits.
+ */
+void WhileStmt::close(Statement *wend) {
+	closer = wend;
+}
+
+/*
+ * Method: WendStmt
+ * Usage: Statement *stmt = new (arena) WendStmt(lexer);
+ * -------------------------------------------------
+ * Checks for extraneous tokens, and creates a blank WendStmt
+ * object. The loop itself is found by link.
+ */
+WendStmt::WendStmt(Lexer & lexer) {
+	header = NULL;
+	if (lexer.hasMoreTokens()) {
+		error("Extraneous token " + lexer.nextToken().getText());
+	}
+}
+
+/*
+ * Method: ~WendStmt()
+ * ---------------------
+ * Destructor for WendStmt subclass.
+ */
+WendStmt::~WendStmt()	{
+}
+
+/*
+ * Method: execute
+ * Usage: stmt->execute(state);
+ * ----------------------------------------------------------
+ * Goes back to the line after the WHILE if its condition still
+ * holds.
+ */
+void WendStmt::execute(EvalState & state) {
+	bool result = header->processCondition(state);
+	if (result) state.setNextStatement(header->getSuccessor());
+	if (state.isHeadless()) return;
+	state.getDisplay()->startAfter();
+	if (result) {
+		state.getDisplay()->drawAfter("Condition " + header->conditionToString() 
+			+ " is TRUE. Loop continues at line " 
+			+ integerToString(header->getSuccessor()->getLineNumber()));
+	} else {
+		state.getDisplay()->drawAfter("Condition " + header->conditionToString() 
+			+ " is FALSE. Loop finished.");
+	}
+}
+
+/*
+ * Method: compile
+ * Usage: stmt->compile(compiler);
+ * ----------------------------------------------------------
+ * Emits the condition of the WHILE with a jump back to the line
+ * after it.
+ */
+void WendStmt::compile(Compiler & compiler) {
+	header->compileCondition(compiler, header->getSuccessor()->getLineNumber());
+}
+
+/*
+ * Method: describe
+ * Usage: stmt->describe(display);
+ * ----------------------------------------------------------
+ * Shows that the loop will be tested here.
+ */
+void WendStmt::describe(Display & display) {
+	display.startBefore();
+	display.drawBefore("Will repeat the loop while its condition holds.");
+}
+
+/*
+ * Method: link
+ * Usage: stmt->link(program);
+ * ----------------------------------------------------------
+ * Closes the innermost open loop, which must be a WHILE.
+ */
+void WendStmt::link(Program & program) {
+	header = (WhileStmt *) program.closeLoop("WHILE", "WEND", getLineNumber());
+	header->close(this);
 }
 
 /*
  * Method: End
- * Usage: Statement *stmt = new EndStmt(scanner);
+ * Usage: Statement *stmt = new (arena) EndStmt(lexer);
  * -------------------------------------------------
  * Checks for extraneous tokens, and creates a blank EndStmt object.
  */
-EndStmt::EndStmt(TokenScanner & scanner) {
-	cout << endl;
-	if (scanner.hasMoreTokens()) {
-		error("Extraneous token " + scanner.nextToken());
+EndStmt::EndStmt(Lexer & lexer) {
+	if (lexer.hasMoreTokens()) {
+		error("Extraneous token " + lexer.nextToken().getText());
 	}
-	handleGraphicsB();
-	drawString("Program will halt at this point.", 20, orderB);
 }
 
 /*
@@ -629,44 +1723,34 @@ EndStmt::~EndStmt()	{
 
 /*
  * Method: execute
- * Usage: program.getParsedStatement(index)->execute(state);
+ * Usage: stmt->execute(state);
  * ----------------------------------------------------------
  * Halts program execution.
  */
 void EndStmt::execute(EvalState & state) {
-	state.setNextLine("-1");
-	handleGraphicsA();
-	drawString("Program halted.", getWindowWidth()/2 + 20, orderA);
+	state.setNextStatement(NULL);
+	if (state.isHeadless()) return;
+	state.getDisplay()->startAfter();
+	state.getDisplay()->drawAfter("Program halted.");
 }
 
 /*
- * Method: handleGraphicsB
- * Usage: handleGraphicsB();
- * ------------------------------------------------------------
- * Handles initialization of printing points in for 'Before
- * Execution' column in graphics window. 
+ * Method: compile
+ * Usage: stmt->compile(compiler);
+ * ----------------------------------------------------------
+ * Emits a halt instruction.
  */
-void EndStmt::handleGraphicsB(){
-	if (orderB > PRINT_HEIGHT) {
-		drawImage(BG_FILE, 0, 45, COLUMN_WIDTH, COLUMN_HEIGHT);
-		orderB = 0;
-	}
-	if (orderB == 0) orderB = INIT_HEIGHT;
-	orderB += 15;
+void EndStmt::compile(Compiler & compiler) {
+	compiler.emit(OP_HALT);
 }
 
 /*
- * Method: handleGraphicsA
- * Usage: handleGraphicsA();
- * ------------------------------------------------------------
- * Handles initialization of printing points in for 'After
- * Execution' column in graphics window. 
+ * Method: describe
+ * Usage: stmt->describe(display);
+ * ----------------------------------------------------------
+ * Shows that the program will halt here.
  */
-void EndStmt::handleGraphicsA(){
-	if (orderA > PRINT_HEIGHT) {
-		drawImage(BG_FILE, getWindowWidth()/2 + 10,45, COLUMN_WIDTH, COLUMN_HEIGHT);
-		orderA = 0;
-	}
-	if (orderA == 0) orderA = INIT_HEIGHT;
-	orderA += 15;
-}
\ No newline at end of file
+void EndStmt::describe(Display & display) {
+	display.startBefore();
+	display.drawBefore("Program will halt at this point.");
+}
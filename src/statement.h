@@ -14,11 +14,17 @@
 
 #include "exp.h"
 #include "evalstate.h"
-#include "tokenscanner.h"
+#include "postfix.h"
+#include "lexer.h"
+#include "simd.h"
 #include "simpio.h"
 #include "strlib.h"
 #include "vector.h"
 
+class Compiler;
+class Display;
+class Program;
+
 /*
  * Class: Statement
  * ----------------
@@ -26,7 +32,8 @@
  * The model for this class is Expression in the exp.h interface.
  * Like Expression, Statement is an abstract class with subclasses
  * for each of the statement and command types required for the
- * BASIC interpreter.
+ * BASIC interpreter.  Statements are allocated from an Arena in the
+ * same way as expressions, and hold no storage outside of it.
  */
 
 class Statement {
@@ -44,15 +51,26 @@ public:
 
 /*
  * Destructor: ~Statement
- * Usage: delete stmt;
- * -------------------
- * The destructor deallocates the storage for this expression.
- * It must be declared virtual to ensure that the correct subclass
- * destructor is called when deleting a statement.
+ * ----------------------
+ * Statements are released with their arena, so the destructor is
+ * never run; it is declared virtual only because the class is
+ * polymorphic.
  */
 
    virtual ~Statement();
 
+/*
+ * Operators: new, delete
+ * Usage: Statement *stmt = new (arena) EndStmt(lexer);
+ * ----------------------------------------------------
+ * Allocates a statement from the given arena.  There is no form of
+ * new without an arena, and delete releases no memory.
+ */
+
+   static void *operator new(size_t size, Arena & arena);
+   static void operator delete(void *ptr, Arena & arena);
+   static void operator delete(void *ptr);
+
 /*
  * Method: execute
  * Usage: stmt->execute(state);
@@ -61,11 +79,90 @@ public:
  * defines its own execute method that implements the necessary
  * operations.  As was true for the expression evaluator, this
  * method takes an EvalState object for looking up variables or
- * controlling the operation of the interpreter.
+ * controlling the operation of the interpreter.  Unless the state
+ * is headless, execute shows its effect in the 'After Execution'
+ * column of the display of the state; a headless state makes it
+ * build no display strings at all.
  */
 
    virtual void execute(EvalState & state) = 0;
 
+/*
+ * Method: compile
+ * Usage: stmt->compile(compiler);
+ * -------------------------------
+ * Emits the bytecode for this statement through the compiler, which
+ * lowers a whole program for the VM.  Each subclass emits the
+ * instructions that have the same effect as its execute method.
+ */
+
+   virtual void compile(Compiler & compiler) = 0;
+
+/*
+ * Method: describe
+ * Usage: stmt->describe(display);
+ * -------------------------------
+ * Shows what this statement will do in the 'Before Execution'
+ * column of display.  parseStatement calls this method on every
+ * statement it creates when it is given a display; constructors
+ * never draw.  The base class version does nothing.
+ */
+
+   virtual void describe(Display & display);
+
+/*
+ * Method: optimize
+ * Usage: stmt->optimize(arena);
+ * -----------------------------
+ * Runs the expression optimizer (see optimizer.h) over the
+ * expressions of this statement, building the results in arena.
+ * parseStatement calls this method on every statement it creates.
+ * Statements keep the expressions as written for display, compile
+ * the optimized copies to bytecode and evaluate them in the postfix
+ * form of postfix.h, which is also built here.  The base class
+ * version does nothing, which suits statements without expressions.
+ */
+
+   virtual void optimize(Arena & arena);
+
+/*
+ * Method: link
+ * Usage: stmt->link(program);
+ * ---------------------------
+ * Resolves any line numbers this statement refers to into direct
+ * pointers to the target statements, raising an error if a target
+ * does not exist.  Program::link calls this method for every line
+ * whenever the program has changed.  The base class version does
+ * nothing, which suits statements that never jump.
+ */
+
+   virtual void link(Program & program);
+
+/*
+ * Methods: setSuccessor, getSuccessor, getLineNumber, getIndex
+ * Usage: stmt->setSuccessor(lineNumber, index, next);
+ *        Statement *next = stmt->getSuccessor();
+ *        int lineNumber = stmt->getLineNumber();
+ *        int index = stmt->getIndex();
+ * ----------------------------------------------
+ * Record and return the line number of this statement, its position
+ * in the program counting from 0 and the statement stored on the
+ * following line (NULL for the last line), as filled in by
+ * Program::link.  Tools that keep data per line, such as the
+ * profiler, use the index to find it in an array.
+ */
+
+   void setSuccessor(int lineNumber, int index, Statement *next);
+   Statement *getSuccessor();
+   int getLineNumber();
+   int getIndex();
+
+private:
+
+   int lineNumber;
+   int index;
+   Statement *successor;
+
 };
 
 /*
@@ -73,8 +170,8 @@ public:
  * ----------------------------
  * Represents a PRINT statement. Prepares a corresponding executable 
  * from input. Optionally accepts a list of expressions separated by 
- * a comma and stores PrintStmt objects for each one in a vector. 
- * Reads all stored expressions from vec, evaluates each expression
+ * a comma and stores them in an array carved from the arena. 
+ * Reads all stored expressions, evaluates each expression
  * in the context of  the corresponding EvalState object and sends 
  * the result to cout.
  * Also optionally accepts an optional beginning with a string 
@@ -82,17 +179,23 @@ public:
  */
 class PrintStmt: public Statement {
 	public:
-		PrintStmt(TokenScanner & scanner);
+		PrintStmt(Lexer & lexer, Arena & arena);
 		virtual ~PrintStmt();
 		virtual void execute(EvalState & state);
+		virtual void compile(Compiler & compiler);
+		virtual void describe(Display & display);
+		virtual void optimize(Arena & arena);
 	private:
-		Vector<Expression *> vec;
-		string comment;
-		void testInitComment(TokenScanner & scanner, string test);
-		void addRest(TokenScanner & scanner);
+		Expression **exps;
+		Expression **optExps;
+		PostfixCode *codes;
+		int nExps;
+		const char *comment;
+		void testInitComment(Lexer & lexer, string & text, 
+							 Vector<Expression *> & vec, Arena & arena);
+		void addRest(Lexer & lexer, Vector<Expression *> & vec,
+					 Arena & arena);
 		void printExps(EvalState & state);
-		void handleGraphicsB();
-		void handleGraphicsA();
 };
 
 /*
@@ -104,13 +207,13 @@ class PrintStmt: public Statement {
  */
 class RemStmt: public Statement {
 	public:
-		RemStmt(TokenScanner & scanner);
+		RemStmt(Lexer & lexer, Arena & arena);
 		virtual ~RemStmt();
 		virtual void execute(EvalState & state);
+		virtual void compile(Compiler & compiler);
+		virtual void describe(Display & display);
 	private:
-		string str;
-		void handleGraphicsB();
-		void handleGraphicsA();
+		const char *str;
 };
 
 /*
@@ -122,13 +225,13 @@ class RemStmt: public Statement {
  */
 class InputStmt: public Statement {
 	public:
-		InputStmt(TokenScanner & scanner);
+		InputStmt(Lexer & lexer);
 		virtual ~InputStmt();
 		virtual void execute(EvalState & state);
+		virtual void compile(Compiler & compiler);
+		virtual void describe(Display & display);
 	private:
-		string var;
-		void handleGraphicsB();
-		void handleGraphicsA();
+		int slot;
 };
 
 /*
@@ -138,17 +241,108 @@ class InputStmt: public Statement {
  * that stores the given variable and expression. During execution,
  * evaluates the expression and assigns it to the variable. Stores
  * the pair.
+ * The target may also be an array element, such as A(I) or
+ * A(I, J), whose subscripts are kept as an ArrayExp in element
+ * and evaluated before the expression.
  */
 class LetStmt: public Statement {
 	public:
-		LetStmt(TokenScanner & scanner);
+		LetStmt(Lexer & lexer, Arena & arena);
 		virtual ~LetStmt();
 		virtual void execute(EvalState & state);
+		virtual void compile(Compiler & compiler);
+		virtual void describe(Display & display);
+		virtual void optimize(Arena & arena);
+	private:
+		int slot;
+		ArrayExp *element;
+		ArrayExp *optElement;
+		PostfixCode *subscriptCodes;
+		Expression *exp;
+		Expression *optExp;
+		PostfixCode code;
+		void storeElement(EvalState & state);
+};
+
+/*
+ * Class: DimStmt
+ * ----------------------------
+ * Represents a DIM statement, which creates one or more arrays of
+ * one or two dimensions, such as DIM A(10), B(N, N + 1). The
+ * extents are expressions, kept as the subscripts of an ArrayExp
+ * per array and evaluated every time the statement runs; every
+ * element of a new array is zero.
+ */
+class DimStmt: public Statement {
+	public:
+		DimStmt(Lexer & lexer, Arena & arena);
+		virtual ~DimStmt();
+		virtual void execute(EvalState & state);
+		virtual void compile(Compiler & compiler);
+		virtual void describe(Display & display);
+		virtual void optimize(Arena & arena);
+	private:
+		ArrayExp **arrays;
+		ArrayExp **optArrays;
+		PostfixCode *codes;
+		int nArrays;
+};
+
+/*
+ * Class: ArrayLetStmt
+ * ----------------------------
+ * Represents an assignment to a whole array, written with empty
+ * parentheses: A() = B() copies B, A() = k sets every element of
+ * A to k, and A() = B() op C(), A() = B() op k and A() = k op B()
+ * apply one of the operators +, -, * and / element by element.
+ * The kind of assignment is worked out from the optimized
+ * expression, and the scalar k may be any expression.
+ */
+class ArrayLetStmt: public Statement {
+	public:
+		ArrayLetStmt(Lexer & lexer, Arena & arena);
+		virtual ~ArrayLetStmt();
+		virtual void execute(EvalState & state);
+		virtual void compile(Compiler & compiler);
+		virtual void describe(Display & display);
+		virtual void optimize(Arena & arena);
 	private:
-		string var;
+		enum Form { COPY, FILL, COMBINE, ARRAY_SCALAR, SCALAR_ARRAY };
+		int slot;
 		Expression *exp;
-		void handleGraphicsB();
-		void handleGraphicsA();
+		Form form;
+		ArrayOp op;
+		int xSlot;
+		int ySlot;
+		Expression *scalar;
+		PostfixCode scalarCode;
+		void classify(Expression *optExp);
+};
+
+/*
+ * Class: MatStmt
+ * ----------------------------
+ * Represents a MAT statement, which assigns a whole matrix: 
+ * MAT C = A copies A, MAT C = A + B and MAT C = A - B add and 
+ * subtract element by element, MAT C = A * B is the matrix 
+ * product, and MAT C = TRN(A) and MAT C = INV(A) are the 
+ * transpose and the inverse. The arrays may also be written 
+ * with empty parentheses, as in the other array statements.
+ */
+class MatStmt: public Statement {
+	public:
+		MatStmt(Lexer & lexer);
+		virtual ~MatStmt();
+		virtual void execute(EvalState & state);
+		virtual void compile(Compiler & compiler);
+		virtual void describe(Display & display);
+	private:
+		enum Form { COPY, ADD, SUBTRACT, MULTIPLY, TRANSPOSE, INVERT };
+		int slot;
+		Form form;
+		int xSlot;
+		int ySlot;
+		string formToString();
 };
 
 /*
@@ -160,13 +354,15 @@ class LetStmt: public Statement {
  */
 class GotoStmt: public Statement {
 	public:
-		GotoStmt(TokenScanner & scanner);
+		GotoStmt(Lexer & lexer);
 		virtual ~GotoStmt();
 		virtual void execute(EvalState & state);
+		virtual void compile(Compiler & compiler);
+		virtual void describe(Display & display);
+		virtual void link(Program & program);
 	private:
-		string next;
-		void handleGraphicsB();
-		void handleGraphicsA();
+		int next;
+		Statement *target;
 };
 
 /*
@@ -179,19 +375,134 @@ class GotoStmt: public Statement {
  */
 class IfStmt: public Statement {
 	public:
-		IfStmt(TokenScanner & scanner);
+		IfStmt(Lexer & lexer, Arena & arena);
 		virtual ~IfStmt();
 		virtual void execute(EvalState & state);
+		virtual void compile(Compiler & compiler);
+		virtual void describe(Display & display);
+		virtual void link(Program & program);
+		virtual void optimize(Arena & arena);
 	private:
 		Expression *expL;
 		Expression *expR;
-		string op;
-		string next;
-		void storeExp(TokenScanner & scanner);
+		Expression *cond;
+		PostfixCode test;
+		Operator op;
+		int next;
+		Statement *target;
+		void storeExp(Lexer & lexer, Arena & arena);
+		bool processCondition(EvalState & state);
+		void displayResult(Display & display, bool result);
+};
+
+/*
+ * Class: ForStmt
+ * ----------------------------
+ * Represents a FOR statement, such as FOR I = 1 TO N STEP 2, which
+ * opens a loop closed by a NEXT. Evaluates the start, the limit and
+ * the step (1 if it is left out) once, keeps the limit and the step
+ * in hidden variables and sets the counter to the start; if the
+ * counter is already past the limit, skips to the line after the
+ * matching NEXT. The hidden variables have names no program can
+ * use and are assigned by link.
+ */
+class ForStmt: public Statement {
+	public:
+		ForStmt(Lexer & lexer, Arena & arena);
+		virtual ~ForStmt();
+		virtual void execute(EvalState & state);
+		virtual void compile(Compiler & compiler);
+		virtual void describe(Display & display);
+		virtual void link(Program & program);
+		virtual void optimize(Arena & arena);
+		int getVariable();
+		int getLimitSlot();
+		int getStepSlot();
+		void close(Statement *next);
+	private:
+		int slot;
+		int limitSlot;
+		int stepSlot;
+		Expression *start;
+		Expression *limit;
+		Expression *step;
+		Expression *optStart;
+		Expression *optLimit;
+		Expression *optStep;
+		PostfixCode startCode;
+		PostfixCode limitCode;
+		PostfixCode stepCode;
+		Statement *closer;
+};
+
+/*
+ * Class: NextStmt
+ * ----------------------------
+ * Represents a NEXT statement, which closes the innermost open FOR
+ * loop and may name its counter, as in NEXT I. Adds the step to the
+ * counter and goes back to the line after the FOR while the counter
+ * has not passed the limit.
+ */
+class NextStmt: public Statement {
+	public:
+		NextStmt(Lexer & lexer);
+		virtual ~NextStmt();
+		virtual void execute(EvalState & state);
+		virtual void compile(Compiler & compiler);
+		virtual void describe(Display & display);
+		virtual void link(Program & program);
+	private:
+		int slot;
+		ForStmt *header;
+};
+
+/*
+ * Class: WhileStmt
+ * ----------------------------
+ * Represents a WHILE statement, which opens a loop closed by a WEND
+ * and holds a condition written as in IF, such as WHILE I < N. If
+ * the condition fails, skips to the line after the matching WEND.
+ * The WEND tests the condition again at the bottom of the loop.
+ */
+class WhileStmt: public Statement {
+	public:
+		WhileStmt(Lexer & lexer, Arena & arena);
+		virtual ~WhileStmt();
+		virtual void execute(EvalState & state);
+		virtual void compile(Compiler & compiler);
+		virtual void describe(Display & display);
+		virtual void link(Program & program);
+		virtual void optimize(Arena & arena);
 		bool processCondition(EvalState & state);
-		void displayResult(bool result, EvalState & state);
-		void handleGraphicsB();
-		void handleGraphicsA();
+		void compileCondition(Compiler & compiler, int next);
+		string conditionToString();
+		void close(Statement *wend);
+	private:
+		Expression *expL;
+		Expression *expR;
+		Expression *cond;
+		PostfixCode test;
+		Operator op;
+		Statement *closer;
+};
+
+/*
+ * Class: WendStmt
+ * ----------------------------
+ * Represents a WEND statement, which closes the innermost open WHILE
+ * loop and goes back to the line after the WHILE as long as its
+ * condition holds.
+ */
+class WendStmt: public Statement {
+	public:
+		WendStmt(Lexer & lexer);
+		virtual ~WendStmt();
+		virtual void execute(EvalState & state);
+		virtual void compile(Compiler & compiler);
+		virtual void describe(Display & display);
+		virtual void link(Program & program);
+	private:
+		WhileStmt *header;
 };
 
 /*
@@ -202,12 +513,12 @@ class IfStmt: public Statement {
  */
 class EndStmt: public Statement {
 	public:
-		EndStmt(TokenScanner & scanner);
+		EndStmt(Lexer & lexer);
 		virtual ~EndStmt();
 		virtual void execute(EvalState & state);
+		virtual void compile(Compiler & compiler);
+		virtual void describe(Display & display);
 	private:
-		void handleGraphicsB();
-		void handleGraphicsA();
 };
 
 #endif
@@ -0,0 +1,268 @@
+/*
+ * File: vm.cpp
+ * ------------
+ * Implements the vm.h interface.
+ */
+
+#include <string>
+#include "vm.h"
+#include "arrays.h"
+#include "jit.h"
+#include "output.h"
+#include "error.h"
+#include "strlib.h"
+using namespace std;
+
+/* Function prototypes */
+
+static void execute(const CodeView & view, double *stack,
+                    EvalState & state, Jit *jit);
+static const int *backEdge(Jit *jit, const int *code, const int *target,
+                           const int *end, double *stack, double *&sp);
+
+/*
+ * Implementation notes: runBytecode
+ * ---------------------------------
+ * Variables are read and written directly in the slots of state, so
+ * the values a run leaves behind are visible to the debugger and to
+ * later runs.  Room for every slot is reserved up front so that no
+ * store has to grow the arrays.
+ */
+
+void runBytecode(Bytecode & bc, EvalState & state, bool useJit) {
+   runBytecode(getCodeView(bc), state, useJit);
+}
+
+void runBytecode(const CodeView & view, EvalState & state, bool useJit) {
+   state.reserve(getVariableCount());
+   double *stack = new double[view.maxStack + 1];
+   Jit *jit = (useJit && Jit::isSupported()) ? new Jit(view, state, stack) : NULL;
+   try {
+      execute(view, stack, state, jit);
+   } catch (...) {
+      delete jit;
+      delete[] stack;
+      throw;
+   }
+   delete jit;
+   delete[] stack;
+}
+
+/*
+ * Implementation notes: execute
+ * -----------------------------
+ * The main interpreter loop.  The program counter and stack pointer
+ * are raw pointers into the code array and the value stack, and each
+ * instruction is dispatched through a single switch.  Every taken
+ * backward jump closes a loop and is reported to the JIT, if any.
+ * OP_FOR_NEXT steps its counter in place, so a FOR loop costs one
+ * instruction per pass on top of its body.  The array instructions
+ * call the same functions of arrays.h and EvalState as the statements
+ * do, so both engines fail alike.
+ */
+
+static void execute(const CodeView & view, double *stack,
+                    EvalState & state, Jit *jit) {
+   const int *code = view.code;
+   const double *constants = view.constants;
+   const int *stringOffsets = view.stringOffsets;
+   OutputBuffer & output = state.getOutput();
+   double *sp = stack;
+   const int *pc = code;
+   const int *next;
+   double lhs, rhs;
+   while (true) {
+      switch (*pc++) {
+      case OP_CONST:
+         *sp++ = constants[*pc++];
+         break;
+      case OP_LOAD:
+         if (!state.isDefined(*pc)) error(getVariableName(*pc) + " is undefined");
+         *sp++ = state.getValue(*pc++);
+         break;
+      case OP_STORE:
+         state.setValue(*pc++, *--sp);
+         break;
+      case OP_DUP:
+         sp[0] = sp[-1];
+         sp++;
+         break;
+      case OP_ADD:
+         sp--;
+         sp[-1] += sp[0];
+         break;
+      case OP_SUB:
+         sp--;
+         sp[-1] -= sp[0];
+         break;
+      case OP_MUL:
+         sp--;
+         sp[-1] *= sp[0];
+         break;
+      case OP_DIV:
+         sp--;
+         sp[-1] /= sp[0];
+         break;
+      case OP_JUMP:
+         next = code + *pc;
+         if (next < pc && jit != NULL) next = backEdge(jit, code, next, pc + 1, stack, sp);
+         pc = next;
+         break;
+      case OP_JUMP_EQ:
+         rhs = *--sp;
+         lhs = *--sp;
+         if (lhs == rhs) {
+            next = code + *pc;
+            if (next < pc && jit != NULL) next = backEdge(jit, code, next, pc + 1, stack, sp);
+            pc = next;
+         } else {
+            pc++;
+         }
+         break;
+      case OP_JUMP_LT:
+         rhs = *--sp;
+         lhs = *--sp;
+         if (lhs < rhs) {
+            next = code + *pc;
+            if (next < pc && jit != NULL) next = backEdge(jit, code, next, pc + 1, stack, sp);
+            pc = next;
+         } else {
+            pc++;
+         }
+         break;
+      case OP_JUMP_GT:
+         rhs = *--sp;
+         lhs = *--sp;
+         if (lhs > rhs) {
+            next = code + *pc;
+            if (next < pc && jit != NULL) next = backEdge(jit, code, next, pc + 1, stack, sp);
+            pc = next;
+         } else {
+            pc++;
+         }
+         break;
+      case OP_PRINT_STR:
+         output.write(view.stringData + stringOffsets[*pc],
+                      stringOffsets[*pc + 1] - stringOffsets[*pc]);
+         pc++;
+         break;
+      case OP_PRINT_NUM:
+         output.writeNumber(*--sp);
+         break;
+      case OP_PRINT_END:
+         output.endLine();
+         break;
+      case OP_INPUT:
+         state.setValue(*pc, readInput(getVariableName(*pc), state.getInput()));
+         pc++;
+         break;
+      case OP_DIM1:
+         dimensionArray(state, *pc++, 1, sp[-1], 1);
+         sp--;
+         break;
+      case OP_DIM2:
+         dimensionArray(state, *pc++, 2, sp[-2], sp[-1]);
+         sp -= 2;
+         break;
+      case OP_LOAD_ELEM1:
+         sp[-1] = *state.getElement(*pc++, sp[-1]);
+         break;
+      case OP_LOAD_ELEM2:
+         sp--;
+         sp[-1] = *state.getElement(*pc++, sp[-1], sp[0]);
+         break;
+      case OP_STORE_ELEM1:
+         sp -= 2;
+         *state.getElement(*pc++, sp[0]) = sp[1];
+         break;
+      case OP_STORE_ELEM2:
+         sp -= 3;
+         *state.getElement(*pc++, sp[0], sp[1]) = sp[2];
+         break;
+      case OP_ARRAY_COPY:
+         copyArray(state, pc[0], pc[1]);
+         pc += 2;
+         break;
+      case OP_ARRAY_FILL:
+         fillArray(state, *pc++, *--sp);
+         break;
+      case OP_ARRAY_OP:
+         combineArrays(state, (ArrayOp) pc[3], pc[0], pc[1], pc[2]);
+         pc += 4;
+         break;
+      case OP_ARRAY_SCALAR:
+         combineArrayScalar(state, (ArrayOp) pc[2], pc[0], pc[1], *--sp);
+         pc += 3;
+         break;
+      case OP_SCALAR_ARRAY:
+         combineScalarArray(state, (ArrayOp) pc[2], pc[0], *--sp, pc[1]);
+         pc += 3;
+         break;
+      case OP_ARRAY_SUM:
+         *sp++ = sumArray(state, *pc++);
+         break;
+      case OP_ARRAY_DOT:
+         *sp++ = dotArrays(state, pc[0], pc[1]);
+         pc += 2;
+         break;
+      case OP_MAT_MUL:
+         multiplyArrays(state, pc[0], pc[1], pc[2]);
+         pc += 3;
+         break;
+      case OP_MAT_TRN:
+         transposeArray(state, pc[0], pc[1]);
+         pc += 2;
+         break;
+      case OP_MAT_INV:
+         invertArray(state, pc[0], pc[1]);
+         pc += 2;
+         break;
+      case OP_FOR_ENTER:
+         if (isLoopRunning(state.getValue(pc[0]), state.getValue(pc[1]),
+                           state.getValue(pc[2]))) {
+            pc += 4;
+         } else {
+            pc = code + pc[3];
+         }
+         break;
+      case OP_FOR_NEXT:
+         if (!state.isDefined(pc[1])) {
+            error("NEXT " + getVariableName(pc[0]) + " without FOR");
+         }
+         lhs = state.getValue(pc[0]) + state.getValue(pc[2]);
+         state.setValue(pc[0], lhs);
+         if (isLoopRunning(lhs, state.getValue(pc[1]), state.getValue(pc[2]))) {
+            next = code + pc[3];
+            if (next < pc && jit != NULL) next = backEdge(jit, code, next, pc + 4, stack, sp);
+            pc = next;
+         } else {
+            pc += 4;
+         }
+         break;
+      case OP_CLEAR:
+         state.clearValue(*pc++);
+         break;
+      case OP_HALT:
+         return;
+      default:
+         error("Illegal instruction in bytecode");
+      }
+   }
+}
+
+/*
+ * Implementation notes: backEdge
+ * ------------------------------
+ * Offers the loop [target, end) to the JIT.  If the JIT ran it, the
+ * VM continues wherever the native code left off; otherwise it simply
+ * takes the jump.
+ */
+
+static const int *backEdge(Jit *jit, const int *code, const int *target,
+                           const int *end, double *stack, double *&sp) {
+   int depth;
+   int addr = jit->runLoop(target - code, end - code, depth);
+   if (addr < 0) return target;
+   sp = stack + depth;
+   return code + addr;
+}
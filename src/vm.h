@@ -0,0 +1,30 @@
+/*
+ * File: vm.h
+ * ----------
+ * This interface exports the stack machine that executes programs
+ * compiled by the Compiler class in bytecode.h.
+ */
+
+#ifndef _vm_h
+#define _vm_h
+
+#include "bytecode.h"
+#include "evalstate.h"
+
+/*
+ * Function: runBytecode
+ * Usage: runBytecode(bc, state);
+ *        runBytecode(view, state, true);
+ * --------------------------------------
+ * Executes the compiled program bc, or the program seen through
+ * view, until it reaches OP_HALT.  The program reads and writes its
+ * variables directly in the slots of state, just as the tree-walking
+ * interpreter does.  If useJit is true and the platform supports it,
+ * hot loops are translated into native code (see jit.h); otherwise
+ * the flag is ignored.
+ */
+
+void runBytecode(Bytecode & bc, EvalState & state, bool useJit = false);
+void runBytecode(const CodeView & view, EvalState & state, bool useJit = false);
+
+#endif